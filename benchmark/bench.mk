@@ -160,3 +160,39 @@ $(OUTPUT_DIR)/bc-%.out: $(GRAPH_DIR)/%.sg bc
 
 $(OUTPUT_DIR)/tc-%.out: $(GRAPH_DIR)/%U.sg tc
 	./tc -f $< -n3 > $@
+
+
+# Same kernels & options, but the suite runner (gapbs) loads each graph once
+SUITE_OUTPUT_FILES = \
+	$(addsuffix .out, $(addprefix $(OUTPUT_DIR)/suite-, $(GRAPHS)))
+
+.PHONY: bench-suite
+bench-suite: $(OUTPUT_DIR) $(SUITE_OUTPUT_FILES)
+
+SUITE_DELTA = 2
+$(OUTPUT_DIR)/suite-road.out: SUITE_DELTA = 50000
+SUITE_PLAN = bfs -n64\npr -i1000 -t1e-4 -n16\ncc -n16\nbc -i4 -n16\nsssp $(SSSP_ARGS) -d$(SUITE_DELTA)\ntc -n3\n
+
+$(OUTPUT_DIR)/suite-%.out: $(GRAPH_DIR)/%.sg $(GRAPH_DIR)/%.wsg $(GRAPH_DIR)/%U.sg gapbs
+	printf '$(SUITE_PLAN)' | ./gapbs -f $< -w $(GRAPH_DIR)/$*.wsg -U $(GRAPH_DIR)/$*U.sg -P /dev/stdin > $@
+
+
+# Scaling Studies ------------------------------------------------------#
+#-----------------------------------------------------------------------#
+
+# Sweeps thread counts (-T) within each run, and scales across runs
+SCALING_KERNELS = bfs pr cc bc sssp tc
+SCALING_SCALES = 18 20 22
+SCALING_THREADS = 1,2,4,8
+SCALING_ARGS = -n16 -I2
+
+SCALING_FILES = $(foreach k, $(SCALING_KERNELS), \
+	$(foreach s, $(SCALING_SCALES), $(OUTPUT_DIR)/scaling-$(k)-g$(s).out))
+
+.PHONY: bench-scaling
+bench-scaling: $(OUTPUT_DIR) $(SCALING_FILES)
+
+# Stem is <kernel>-g<scale>, and results are also kept as JSON lines (-j)
+$(OUTPUT_DIR)/scaling-%.out: $(SCALING_KERNELS)
+	./$(word 1, $(subst -, ,$*)) -$(word 2, $(subst -, ,$*)) \
+		-T $(SCALING_THREADS) $(SCALING_ARGS) -j $(@:.out=.json) > $@
@@ -0,0 +1,192 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef ALLOC_H_
+#define ALLOC_H_
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+
+/*
+GAP Benchmark Suite
+File:   Alloc
+Author: Scott Beamer
+
+Allocator for the large arrays (pvector, Bitmap, & graph arrays)
+ - Page policy is selected at runtime (-H), so kernels don't change:
+     default: heap allocation
+     thp: 2MB-aligned anonymous mapping advised to use transparent huge pages
+     2M or 1G: explicit huge pages (hugetlbfs), falls back to thp if the
+               system has none reserved
+ - Only arrays of at least kHugeMinBytes use huge pages
+ - Each allocation records how it was made in a small header just before it,
+   so FreeArray is always correct even if the policy is changed later
+ - Elements are left uninitialized (like pvector), so only types that need
+   no destructor are allowed
+*/
+
+
+enum PagePolicy {kSmallPages, kTransparentHugePages, kHugePages2M,
+                 kHugePages1G};
+
+inline PagePolicy& GlobalPagePolicy() {
+  static PagePolicy policy = kSmallPages;
+  return policy;
+}
+
+inline void SetPagePolicy(const std::string &name) {
+  if (name == "") {
+    GlobalPagePolicy() = kSmallPages;
+  } else if (name == "thp") {
+    GlobalPagePolicy() = kTransparentHugePages;
+  } else if (name == "2M") {
+    GlobalPagePolicy() = kHugePages2M;
+  } else if (name == "1G") {
+    GlobalPagePolicy() = kHugePages1G;
+  } else {
+    std::cout << "Unrecognized huge page policy: " << name << std::endl;
+    std::exit(-37);
+  }
+}
+
+
+struct AllocHeader {
+  void *base;
+  size_t length;      // bytes allocated starting at base
+  size_t page_bytes;  // 0 if from heap
+  char padding[40];
+};
+
+static_assert(sizeof(AllocHeader) == 64, "AllocHeader must be 64 bytes");
+
+static const size_t kHugeMinBytes = 1 << 21;
+static const size_t kHugePageBytes2M = 1 << 21;
+static const size_t kHugePageBytes1G = 1 << 30;
+
+inline size_t AllocRoundUp(size_t bytes, size_t page_bytes) {
+  return (bytes + page_bytes - 1) / page_bytes * page_bytes;
+}
+
+// Returns page size of mapping at *base (or 0 if it couldn't be made)
+inline size_t MapHugePages(size_t bytes, PagePolicy policy, void **base,
+                           size_t *length) {
+#ifdef MAP_HUGETLB
+  if ((policy == kHugePages2M) || (policy == kHugePages1G)) {
+    size_t page_bytes = (policy == kHugePages1G) ? kHugePageBytes1G :
+                                                   kHugePageBytes2M;
+    int page_shift = (policy == kHugePages1G) ? 30 : 21;
+    *length = AllocRoundUp(bytes, page_bytes);
+    *base = mmap(nullptr, *length, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                 (page_shift << MAP_HUGE_SHIFT), -1, 0);
+    if (*base != MAP_FAILED)
+      return page_bytes;
+    static bool warned = false;
+    if (!warned) {
+      std::cout << "Couldn't get explicit huge pages, using thp" << std::endl;
+      warned = true;
+    }
+  }
+#endif
+  // over-allocate to align start to a huge page, and trim the excess
+  *length = AllocRoundUp(bytes, kHugePageBytes2M);
+  char *raw = static_cast<char*>(mmap(nullptr, *length + kHugePageBytes2M,
+                                      PROT_READ | PROT_WRITE,
+                                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  if (raw == MAP_FAILED)
+    return 0;
+  uintptr_t start = AllocRoundUp(reinterpret_cast<uintptr_t>(raw),
+                                 kHugePageBytes2M);
+  char *aligned = reinterpret_cast<char*>(start);
+  if (aligned != raw)
+    munmap(raw, aligned - raw);
+  munmap(aligned + *length, kHugePageBytes2M - (aligned - raw));
+#ifdef MADV_HUGEPAGE
+  madvise(aligned, *length, MADV_HUGEPAGE);
+#endif
+  *base = aligned;
+  return kHugePageBytes2M;
+}
+
+inline void* AllocBytes(size_t bytes) {
+  AllocHeader header;
+  size_t total = bytes + sizeof(AllocHeader);
+  header.page_bytes = 0;
+  if ((GlobalPagePolicy() != kSmallPages) && (total >= kHugeMinBytes))
+    header.page_bytes = MapHugePages(total, GlobalPagePolicy(), &header.base,
+                                     &header.length);
+  if (header.page_bytes == 0) {
+    header.length = total;
+    if (posix_memalign(&header.base, sizeof(AllocHeader), total) != 0) {
+      std::cout << "Couldn't allocate " << bytes << " bytes" << std::endl;
+      std::exit(-38);
+    }
+  }
+  std::memcpy(header.base, &header, sizeof(AllocHeader));
+  return static_cast<char*>(header.base) + sizeof(AllocHeader);
+}
+
+inline AllocHeader* HeaderOf(void *ptr) {
+  return reinterpret_cast<AllocHeader*>(static_cast<char*>(ptr) -
+                                        sizeof(AllocHeader));
+}
+
+inline void FreeBytes(void *ptr) {
+  if (ptr == nullptr)
+    return;
+  AllocHeader *header = HeaderOf(ptr);
+  if (header->page_bytes == 0)
+    std::free(header->base);
+  else
+    munmap(header->base, header->length);
+}
+
+// Keeps contents (up to new size), shrinks mappings in place when possible
+inline void* ResizeBytes(void *ptr, size_t bytes) {
+  if (ptr == nullptr)
+    return AllocBytes(bytes);
+  AllocHeader *header = HeaderOf(ptr);
+  size_t total = bytes + sizeof(AllocHeader);
+  if ((header->page_bytes != 0) && (total <= header->length)) {
+    size_t length = AllocRoundUp(total, header->page_bytes);
+    if (length < header->length) {
+      munmap(static_cast<char*>(header->base) + length,
+             header->length - length);
+      header->length = length;
+    }
+    return ptr;
+  }
+  // Not realloc for heap blocks, since it wouldn't keep them aligned
+  void *resized = AllocBytes(bytes);
+  std::memcpy(resized, ptr, std::min(header->length, total) -
+                            sizeof(AllocHeader));
+  FreeBytes(ptr);
+  return resized;
+}
+
+template <typename T_>
+T_* AllocArray(size_t num_elements) {
+  static_assert(std::is_trivially_destructible<T_>::value,
+                "AllocArray elements are never destructed");
+  return static_cast<T_*>(AllocBytes(num_elements * sizeof(T_)));
+}
+
+template <typename T_>
+T_* ResizeArray(T_ *ptr, size_t num_elements) {
+  return static_cast<T_*>(ResizeBytes(ptr, num_elements * sizeof(T_)));
+}
+
+template <typename T_>
+void FreeArray(T_ *ptr) {
+  FreeBytes(ptr);
+}
+
+#endif  // ALLOC_H_
@@ -3,12 +3,14 @@
 
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include "benchmark.h"
 #include "bitmap.h"
 #include "builder.h"
 #include "command_line.h"
+#include "frontier.h"
 #include "graph.h"
 #include "platform_atomics.h"
 #include "pvector.h"
@@ -33,6 +35,19 @@ As an optimization to save memory, this implementation uses a Bitmap to hold
 succ (list of successors) found during the BFS phase that are used in the back-
 propagation phase.
 
+The BFS phase is direction-optimizing [3]: large frontiers are expanded bottom-
+up, where each unvisited vertex sums the path counts of its in-neighbors in the
+frontier, so no atomics are needed. Those levels don't mark succ, so back-
+propagation finds their successors by depth instead. The epoch-tagged mode (-E)
+stays top-down, since it targets searches that reach little of the graph.
+
+With -b k, BrandesBatched runs k sources per traversal (like MS-BFS [4]), in
+both the BFS and back-propagation phases. Each vertex has a lane per source
+(Lane) for its depth, path count, and delta, kept adjacent so an edge examined
+serves every source of the batch at once, and per-vertex bitmasks tell which
+lanes are in the frontier (or are successors) so other lanes are skipped. It
+gives the same scores as running the sources one at a time.
+
 [1] Ulrik Brandes. "A faster algorithm for betweenness centrality." Journal of
     Mathematical Sociology, 25(2):163–177, 2001.
 
@@ -40,6 +55,16 @@ propagation phase.
     Chavarria-Miranda. "A faster parallel algorithm and efficient multithreaded
     implementations for evaluating betweenness centrality on massive datasets."
     International Symposium on Parallel & Distributed Processing (IPDPS), 2009.
+
+[3] Scott Beamer, Krste Asanović, and David Patterson. "Direction-Optimizing
+    Breadth-First Search." International Conference on High Performance
+    Computing, Networking, Storage and Analysis (SC), Salt Lake City, Utah,
+    November 2012.
+
+[4] Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu,
+    Kien Pham, Alfons Kemper, Thomas Neumann, and Huy T. Vo. "The More the
+    Merrier: Efficient Multi-Source Graph Traversal." Proceedings of the VLDB
+    Endowment, 8(4), 2014.
 */
 
 
@@ -48,37 +73,222 @@ typedef float ScoreT;
 typedef double CountT;
 
 
+// What back-propagation reads of a successor, together so it's one access
+struct SuccInfo {
+  CountT path_count;
+  ScoreT delta;
+};
+
+
+typedef uint64_t SourceMask;
+const int kMaxBatch = 64;
+
+
+// A vertex's values for one source of a batch (depth is -1 if unreached)
+struct Lane {
+  CountT path_count;
+  ScoreT delta;
+  NodeID depth;
+};
+
+
+// Storage for BrandesBatched, with a lane per source of the batch, so each
+// vertex's values for all of the batch are adjacent ([v * width + lane])
+struct BCLanes {
+  int width;
+  pvector<Lane> lanes;
+  pvector<SourceMask> seen;
+  pvector<SourceMask> frontier;
+  pvector<SourceMask> next;
+  vector<SlidingQueue<NodeID>::iterator> depth_index;
+  SlidingQueue<NodeID> queue;   // a vertex is queued at each depth it has
+
+  BCLanes(const Graph &g, int batch_size)
+      : width(batch_size), lanes(g.num_nodes() * width), seen(g.num_nodes()),
+        frontier(g.num_nodes(), 0), next(g.num_nodes(), 0),
+        queue(g.num_nodes() * width) {}
+
+  Lane* of(NodeID v) { return &lanes[static_cast<int64_t>(v) * width]; }
+};
+
+
+// Storage for Brandes, allocated once per graph and reused by every source
+struct BCScratch {
+  pvector<ScoreT> scores;
+  pvector<CountT> path_counts;
+  pvector<NodeID> depths;
+  pvector<SuccInfo> succ_info;
+  Bitmap succ;
+  Bitmap front;                 // frontier for bottom-up steps
+  vector<bool> bottom_up;       // whether each depth was found bottom-up
+  vector<SlidingQueue<NodeID>::iterator> depth_index;
+  SlidingQueue<NodeID> queue;
+  pvector<uint64_t> stamps;     // epoch << 32 | depth, only for PBFSEpoch
+  EdgeBalancer<NodeID> balancer;
+  uint32_t epoch = 0;
+  bool counts_clear = false;    // path_counts & succ all zero
+  unique_ptr<BCLanes> lanes;    // only for BrandesBatched
+
+  explicit BCScratch(const Graph &g)
+      : scores(g.num_nodes()), path_counts(g.num_nodes()),
+        depths(g.num_nodes()), succ_info(g.num_nodes()),
+        succ(g.num_edges_directed()), front(g.num_nodes()),
+        queue(g.num_nodes()) {}
+
+  // Starts a new epoch, so every vertex is unvisited without a reset (unless
+  // epoch wrapped around)
+  uint32_t NextEpoch() {
+    if (stamps.size() != depths.size())
+      stamps = pvector<uint64_t>(depths.size(), 0);
+    if (!counts_clear) {
+      path_counts.fill(0);
+      succ.reset();
+      counts_clear = true;
+    }
+    epoch++;
+    if (epoch == 0) {
+      stamps.fill(0);
+      epoch = 1;
+    }
+    return epoch;
+  }
+
+  BCLanes& Lanes(const Graph &g, int batch_size) {
+    if (!lanes || (lanes->width != batch_size))
+      lanes.reset(new BCLanes(g, batch_size));
+    return *lanes;
+  }
+};
+
+
+// Top-down step: claims unvisited out-neighbors of the frontier, and adds the
+// path counts of frontier vertices to those at the next depth (marking succ)
+void TDStep(const Graph &g, NodeID depth, pvector<CountT> &path_counts,
+            Bitmap &succ, SlidingQueue<NodeID> &queue, pvector<NodeID> &depths,
+            EdgeBalancer<NodeID> &balancer) {
+  const NodeID* g_out_start = g.out_neigh(0).begin();
+  #pragma omp parallel
+  {
+    QueueBuffer<NodeID> lqueue(queue);
+    balancer.ForEachEdge(g, queue.begin(), queue.end(),
+                         [&](NodeID u, NodeID &v) {
+      if ((depths[v] == -1) &&
+          (compare_and_swap(depths[v], static_cast<NodeID>(-1), depth))) {
+        lqueue.push_back(v);
+      }
+      if (depths[v] == depth) {
+        succ.set_bit_atomic(&v - g_out_start);
+        #pragma omp atomic
+        path_counts[v] += path_counts[u];
+      }
+    });
+    lqueue.flush();
+  }
+}
+
+
+// Bottom-up step: each unvisited vertex sums the path counts of its
+// in-neighbors in the frontier (front), so no atomics are needed
+void BUStep(const Graph &g, NodeID depth, pvector<CountT> &path_counts,
+            SlidingQueue<NodeID> &queue, pvector<NodeID> &depths,
+            const Bitmap &front) {
+  #pragma omp parallel
+  {
+    QueueBuffer<NodeID> lqueue(queue);
+    #pragma omp for schedule(dynamic, 1024) nowait
+    for (NodeID v=0; v < g.num_nodes(); v++) {
+      if (depths[v] != -1)
+        continue;
+      CountT incoming = 0;
+      for (NodeID u : g.in_neigh(v)) {
+        if (front.get_bit(u))
+          incoming += path_counts[u];
+      }
+      if (incoming != 0) {
+        depths[v] = depth;
+        path_counts[v] = incoming;
+        lqueue.push_back(v);
+      }
+    }
+    lqueue.flush();
+  }
+}
+
+
+// Direction-optimizing: a depth is found bottom-up (and recorded in
+// bottom_up) when the frontier's out-edges outnumber those left unexplored
+// divided by kAlpha. Its succ bits are then not set, since its vertices were
+// reached via in-edges, so back-propagation checks their depths instead.
 void PBFS(const Graph &g, NodeID source, pvector<CountT> &path_counts,
     Bitmap &succ, vector<SlidingQueue<NodeID>::iterator> &depth_index,
-    SlidingQueue<NodeID> &queue) {
-  pvector<NodeID> depths(g.num_nodes(), -1);
+    SlidingQueue<NodeID> &queue, pvector<NodeID> &depths,
+    EdgeBalancer<NodeID> &balancer, Bitmap &front, vector<bool> &bottom_up) {
+  const int64_t kAlpha = 4;
+  depths.fill(-1);
   depths[source] = 0;
   path_counts[source] = 1;
   queue.push_back(source);
   depth_index.push_back(queue.begin());
   queue.slide_window();
+  bottom_up.assign(1, false);
+  int64_t edges_to_check = g.num_edges_directed();
+  for (NodeID depth=1; !queue.empty(); depth++) {
+    int64_t scout_count = 0;
+    #pragma omp parallel for reduction(+ : scout_count)
+    for (auto q_iter = queue.begin(); q_iter < queue.end(); q_iter++)
+      scout_count += g.out_degree(*q_iter);
+    edges_to_check -= scout_count;
+    if (scout_count > edges_to_check / kAlpha) {
+      front.reset();
+      #pragma omp parallel for
+      for (auto q_iter = queue.begin(); q_iter < queue.end(); q_iter++)
+        front.set_bit_atomic(*q_iter);
+      BUStep(g, depth, path_counts, queue, depths, front);
+      bottom_up.push_back(true);
+    } else {
+      TDStep(g, depth, path_counts, succ, queue, depths, balancer);
+      bottom_up.push_back(false);
+    }
+    depth_index.push_back(queue.begin());
+    queue.slide_window();
+  }
+  depth_index.push_back(queue.begin());
+}
+
+
+// Same as PBFS, but a vertex has been visited (at depth) iff its stamp has
+// the current epoch (and depth), so depths needs no initialization. Both are
+// in one word so they change together when a vertex is claimed.
+void PBFSEpoch(const Graph &g, NodeID source, pvector<CountT> &path_counts,
+    Bitmap &succ, vector<SlidingQueue<NodeID>::iterator> &depth_index,
+    SlidingQueue<NodeID> &queue, pvector<uint64_t> &stamps, uint32_t epoch,
+    EdgeBalancer<NodeID> &balancer) {
+  const uint64_t epoch_tag = static_cast<uint64_t>(epoch) << 32;
+  stamps[source] = epoch_tag;
+  path_counts[source] = 1;
+  queue.push_back(source);
+  depth_index.push_back(queue.begin());
+  queue.slide_window();
   const NodeID* g_out_start = g.out_neigh(0).begin();
   #pragma omp parallel
   {
-    NodeID depth = 0;
+    uint64_t depth_stamp = epoch_tag;
     QueueBuffer<NodeID> lqueue(queue);
     while (!queue.empty()) {
-      depth++;
-      #pragma omp for schedule(dynamic, 64) nowait
-      for (auto q_iter = queue.begin(); q_iter < queue.end(); q_iter++) {
-        NodeID u = *q_iter;
-        for (NodeID &v : g.out_neigh(u)) {
-          if ((depths[v] == -1) &&
-              (compare_and_swap(depths[v], static_cast<NodeID>(-1), depth))) {
-            lqueue.push_back(v);
-          }
-          if (depths[v] == depth) {
-            succ.set_bit_atomic(&v - g_out_start);
-            #pragma omp atomic
-            path_counts[v] += path_counts[u];
-          }
+      depth_stamp++;
+      balancer.ForEachEdge(g, queue.begin(), queue.end(),
+                           [&](NodeID u, NodeID &v) {
+        uint64_t v_stamp = stamps[v];
+        if (((v_stamp >> 32) != epoch) &&
+            (compare_and_swap(stamps[v], v_stamp, depth_stamp))) {
+          lqueue.push_back(v);
         }
-      }
+        if (stamps[v] == depth_stamp) {
+          succ.set_bit_atomic(&v - g_out_start);
+          #pragma omp atomic
+          path_counts[v] += path_counts[u];
+        }
+      });
       lqueue.flush();
       #pragma omp barrier
       #pragma omp single
@@ -92,15 +302,34 @@ void PBFS(const Graph &g, NodeID source, pvector<CountT> &path_counts,
 }
 
 
-pvector<ScoreT> Brandes(const Graph &g, SourcePicker<Graph> &sp,
-                        NodeID num_iters, bool logging_enabled = false) {
+// Clears path_counts & succ for vertices reached (all others are still zero)
+void ClearReached(const Graph &g, pvector<CountT> &path_counts, Bitmap &succ,
+                  const vector<SlidingQueue<NodeID>::iterator> &depth_index) {
+  const NodeID* g_out_start = g.out_neigh(0).begin();
+  #pragma omp parallel for schedule(dynamic, 64)
+  for (auto it = depth_index.front(); it < depth_index.back(); it++) {
+    NodeID u = *it;
+    path_counts[u] = 0;
+    succ.reset_words(g.out_neigh(u).begin() - g_out_start,
+                     g.out_neigh(u).end() - g_out_start);
+  }
+}
+
+
+// Returned scores are owned by scratch (valid until its next use)
+const pvector<ScoreT>& Brandes(const Graph &g, SourcePicker<Graph> &sp,
+                               NodeID num_iters, BCScratch &scratch,
+                               bool logging_enabled = false,
+                               bool epoch_tagged = false) {
   Timer t;
   t.Start();
-  pvector<ScoreT> scores(g.num_nodes(), 0);
-  pvector<CountT> path_counts(g.num_nodes());
-  Bitmap succ(g.num_edges_directed());
-  vector<SlidingQueue<NodeID>::iterator> depth_index;
-  SlidingQueue<NodeID> queue(g.num_nodes());
+  pvector<ScoreT> &scores = scratch.scores;
+  pvector<CountT> &path_counts = scratch.path_counts;
+  pvector<SuccInfo> &succ_info = scratch.succ_info;
+  Bitmap &succ = scratch.succ;
+  vector<SlidingQueue<NodeID>::iterator> &depth_index = scratch.depth_index;
+  SlidingQueue<NodeID> &queue = scratch.queue;
+  scores.fill(0);
   t.Stop();
   if (logging_enabled)
     PrintStep("a", t.Seconds());
@@ -110,30 +339,279 @@ pvector<ScoreT> Brandes(const Graph &g, SourcePicker<Graph> &sp,
     if (logging_enabled)
       PrintStep("Source", static_cast<int64_t>(source));
     t.Start();
-    path_counts.fill(0);
     depth_index.resize(0);
     queue.reset();
-    succ.reset();
-    PBFS(g, source, path_counts, succ, depth_index, queue);
+    if (epoch_tagged) {
+      uint32_t epoch = scratch.NextEpoch();
+      PBFSEpoch(g, source, path_counts, succ, depth_index, queue,
+                scratch.stamps, epoch, scratch.balancer);
+      scratch.bottom_up.assign(depth_index.size(), false);
+    } else {
+      path_counts.fill(0);
+      succ.reset();
+      scratch.counts_clear = false;
+      PBFS(g, source, path_counts, succ, depth_index, queue, scratch.depths,
+           scratch.balancer, scratch.front, scratch.bottom_up);
+    }
     t.Stop();
     if (logging_enabled)
       PrintStep("b", t.Seconds());
-    pvector<ScoreT> deltas(g.num_nodes(), 0);
+    // succ_info isn't reset, since successors (deeper) are written before read
+    // (vertices of depth_index[d] to depth_index[d+1] have depth d-1)
     t.Start();
     for (int d=depth_index.size()-2; d >= 0; d--) {
+      bool succ_bottom_up = scratch.bottom_up[d];
       #pragma omp parallel for schedule(dynamic, 64)
       for (auto it = depth_index[d]; it < depth_index[d+1]; it++) {
         NodeID u = *it;
         ScoreT delta_u = 0;
-        for (NodeID &v : g.out_neigh(u)) {
-          if (succ.get_bit(&v - g_out_start)) {
-            delta_u += (path_counts[u] / path_counts[v]) * (1 + deltas[v]);
+        auto add_succ = [&](NodeID v) {
+          SuccInfo info = succ_info[v];
+          delta_u += (path_counts[u] / info.path_count) * (1 + info.delta);
+        };
+        if (succ_bottom_up) {
+          for (NodeID v : g.out_neigh(u)) {
+            if (scratch.depths[v] == d)
+              add_succ(v);
+          }
+        } else {
+          for (NodeID &v : g.out_neigh(u)) {
+            if (succ.get_bit(&v - g_out_start))
+              add_succ(v);
           }
         }
-        deltas[u] = delta_u;
+        succ_info[u] = {path_counts[u], delta_u};
         scores[u] += delta_u;
       }
     }
+    if (epoch_tagged)
+      ClearReached(g, path_counts, succ, depth_index);
+    t.Stop();
+    if (logging_enabled)
+      PrintStep("p", t.Seconds());
+  }
+  // normalize scores
+  ScoreT biggest_score = 0;
+  #pragma omp parallel for reduction(max : biggest_score)
+  for (NodeID n=0; n < g.num_nodes(); n++)
+    biggest_score = max(biggest_score, scores[n]);
+  #pragma omp parallel for
+  for (NodeID n=0; n < g.num_nodes(); n++)
+    scores[n] = scores[n] / biggest_score;
+  return scores;
+}
+
+
+// Batched top-down step: pushes each frontier vertex's lanes (sources)
+// that are in its frontier to its out-neighbors, claiming them per lane
+void BatchTDStep(const Graph &g, NodeID depth, BCLanes &bl,
+                 EdgeBalancer<NodeID> &balancer) {
+  SlidingQueue<NodeID> &queue = bl.queue;
+  #pragma omp parallel
+  {
+    QueueBuffer<NodeID> lqueue(queue);
+    balancer.ForEachEdge(g, queue.begin(), queue.end(),
+                         [&](NodeID u, NodeID v) {
+      // lanes where v is unvisited or was just reached at this depth
+      SourceMask active = bl.frontier[u] & ~bl.seen[v];
+      if (active == 0)
+        return;
+      const Lane *u_lanes = bl.of(u);
+      Lane *v_lanes = bl.of(v);
+      for (; active != 0; active &= active - 1) {
+        int s = LowestBit(active);
+        if ((v_lanes[s].depth == -1) &&
+            compare_and_swap(v_lanes[s].depth, static_cast<NodeID>(-1),
+                             depth)) {
+          if (fetch_and_or(bl.next[v], SourceMask(1) << s) == 0)
+            lqueue.push_back(v);
+        }
+        if (v_lanes[s].depth == depth) {
+          #pragma omp atomic
+          v_lanes[s].path_count += u_lanes[s].path_count;
+        }
+      }
+    });
+    lqueue.flush();
+  }
+}
+
+
+// Batched bottom-up step: each vertex sums path counts from its in-
+// neighbors for every lane it hasn't seen yet, so no atomics are needed
+void BatchBUStep(const Graph &g, NodeID depth, BCLanes &bl,
+                 SourceMask batch_mask) {
+  #pragma omp parallel
+  {
+    QueueBuffer<NodeID> lqueue(bl.queue);
+    #pragma omp for schedule(dynamic, 1024) nowait
+    for (NodeID v=0; v < g.num_nodes(); v++) {
+      SourceMask unseen = batch_mask & ~bl.seen[v];
+      if (unseen == 0)
+        continue;
+      SourceMask found = 0;
+      Lane *v_lanes = bl.of(v);
+      for (NodeID u : g.in_neigh(v)) {
+        SourceMask from_u = bl.frontier[u] & unseen;
+        if (from_u == 0)
+          continue;
+        found |= from_u;
+        const Lane *u_lanes = bl.of(u);
+        for (; from_u != 0; from_u &= from_u - 1) {
+          int s = LowestBit(from_u);
+          v_lanes[s].path_count += u_lanes[s].path_count;
+        }
+      }
+      if (found != 0) {
+        for (SourceMask to_set = found; to_set != 0; to_set &= to_set - 1)
+          v_lanes[LowestBit(to_set)].depth = depth;
+        bl.next[v] = found;
+        lqueue.push_back(v);
+      }
+    }
+    lqueue.flush();
+  }
+}
+
+
+// Like PBFS, but for a lane per source, so every edge examined can advance
+// all of the batch. A vertex is queued once per depth it is reached at (in
+// any lane), and vertices of depth d are depth_index[d] to depth_index[d+1].
+void BatchPBFS(const Graph &g, const vector<NodeID> &sources, BCLanes &bl,
+               EdgeBalancer<NodeID> &balancer) {
+  const int64_t kAlpha = 4;
+  SlidingQueue<NodeID> &queue = bl.queue;
+  bl.lanes.fill({0, 0, -1});
+  bl.seen.fill(0);
+  queue.reset();
+  for (size_t s=0; s < sources.size(); s++) {
+    NodeID source = sources[s];
+    bl.of(source)[s] = {1, 0, 0};
+    if (bl.frontier[source] == 0)
+      queue.push_back(source);
+    bl.frontier[source] |= SourceMask(1) << s;
+  }
+  queue.slide_window();
+  for (auto q_iter = queue.begin(); q_iter < queue.end(); q_iter++)
+    bl.seen[*q_iter] = bl.frontier[*q_iter];
+  bl.depth_index.assign(1, queue.begin());
+  SourceMask batch_mask = sources.size() == kMaxBatch ? ~SourceMask(0) :
+                          (SourceMask(1) << sources.size()) - 1;
+  int64_t edges_to_check = g.num_edges_directed();
+  for (NodeID depth=1; !queue.empty(); depth++) {
+    int64_t scout_count = 0;
+    #pragma omp parallel for reduction(+ : scout_count)
+    for (auto q_iter = queue.begin(); q_iter < queue.end(); q_iter++)
+      scout_count += g.out_degree(*q_iter);
+    edges_to_check -= scout_count;
+    if (scout_count > edges_to_check / kAlpha)
+      BatchBUStep(g, depth, bl, batch_mask);
+    else
+      BatchTDStep(g, depth, bl, balancer);
+    #pragma omp parallel for
+    for (auto q_iter = queue.begin(); q_iter < queue.end(); q_iter++)
+      bl.frontier[*q_iter] = 0;
+    queue.slide_window();
+    #pragma omp parallel for
+    for (auto q_iter = queue.begin(); q_iter < queue.end(); q_iter++) {
+      NodeID v = *q_iter;
+      bl.frontier[v] = bl.next[v];
+      bl.seen[v] |= bl.next[v];
+      bl.next[v] = 0;
+    }
+    bl.depth_index.push_back(queue.begin());
+  }
+}
+
+
+// Same results as Brandes, but runs batch_size sources per traversal, both
+// forward and back, with each source in its own lane of the per-vertex arrays
+const pvector<ScoreT>& BrandesBatched(const Graph &g, SourcePicker<Graph> &sp,
+                                      NodeID num_iters, int batch_size,
+                                      BCScratch &scratch,
+                                      bool logging_enabled = false) {
+  Timer t;
+  t.Start();
+  pvector<ScoreT> &scores = scratch.scores;
+  BCLanes &bl = scratch.Lanes(g, batch_size);
+  scores.fill(0);
+  t.Stop();
+  if (logging_enabled)
+    PrintStep("a", t.Seconds());
+  vector<NodeID> sources;
+  for (NodeID iter=0; iter < num_iters; iter += batch_size) {
+    sources.resize(min(static_cast<NodeID>(batch_size), num_iters - iter));
+    for (NodeID &source : sources) {
+      source = sp.PickNext();
+      if (logging_enabled)
+        PrintStep("Source", static_cast<int64_t>(source));
+    }
+    t.Start();
+    BatchPBFS(g, sources, bl, scratch.balancer);
+    t.Stop();
+    if (logging_enabled)
+      PrintStep("b", t.Seconds());
+    // deltas aren't reset, since successors (deeper) are written before read
+    // (frontier & next are free, so they hold which lanes are at depth d & d+1)
+    t.Start();
+    const vector<SlidingQueue<NodeID>::iterator> &depth_index = bl.depth_index;
+    NodeID max_depth = depth_index.size() - 2;
+    for (NodeID d=max_depth; d >= 0; d--) {
+      #pragma omp parallel for
+      for (auto it = depth_index[d]; it < depth_index[d+1]; it++) {
+        const Lane *u_lanes = bl.of(*it);
+        SourceMask at_depth = 0;
+        for (int s=0; s < bl.width; s++) {
+          if (u_lanes[s].depth == d)
+            at_depth |= SourceMask(1) << s;
+        }
+        bl.frontier[*it] = at_depth;
+      }
+      #pragma omp parallel for schedule(dynamic, 64)
+      for (auto it = depth_index[d]; it < depth_index[d+1]; it++) {
+        NodeID u = *it;
+        Lane *u_lanes = bl.of(u);
+        SourceMask at_depth = bl.frontier[u];
+        ScoreT delta_u[kMaxBatch] = {};
+        for (NodeID v : g.out_neigh(u)) {
+          SourceMask succ_lanes = at_depth & bl.next[v];
+          if (succ_lanes == 0)
+            continue;
+          const Lane *v_lanes = bl.of(v);
+          for (; succ_lanes != 0; succ_lanes &= succ_lanes - 1) {
+            int s = LowestBit(succ_lanes);
+            delta_u[s] += (u_lanes[s].path_count / v_lanes[s].path_count) *
+                          (1 + v_lanes[s].delta);
+          }
+        }
+        for (; at_depth != 0; at_depth &= at_depth - 1) {
+          int s = LowestBit(at_depth);
+          u_lanes[s].delta = delta_u[s];
+        }
+      }
+      if (d < max_depth) {
+        #pragma omp parallel for
+        for (auto it = depth_index[d+1]; it < depth_index[d+2]; it++)
+          bl.next[*it] = 0;
+      }
+      #pragma omp parallel for
+      for (auto it = depth_index[d]; it < depth_index[d+1]; it++) {
+        bl.next[*it] = bl.frontier[*it];
+        bl.frontier[*it] = 0;
+      }
+    }
+    #pragma omp parallel for
+    for (auto it = depth_index[0]; it < depth_index[1]; it++)
+      bl.next[*it] = 0;
+    // added in source order, so scores match those of Brandes exactly
+    #pragma omp parallel for
+    for (NodeID n=0; n < g.num_nodes(); n++) {
+      const Lane *n_lanes = bl.of(n);
+      for (size_t s=0; s < sources.size(); s++) {
+        if (n_lanes[s].depth != -1)
+          scores[n] += n_lanes[s].delta;
+      }
+    }
     t.Stop();
     if (logging_enabled)
       PrintStep("p", t.Seconds());
@@ -157,7 +635,7 @@ void PrintTopScores(const Graph &g, const pvector<ScoreT> &scores) {
   int k = 5;
   vector<pair<ScoreT, NodeID>> top_k = TopK(score_pairs, k);
   for (auto kvp : top_k)
-    cout << kvp.second << ":" << kvp.first << endl;
+    cout << OriginalID(g, kvp.second) << ":" << kvp.first << endl;
 }
 
 
@@ -230,23 +708,49 @@ bool BCVerifier(const Graph &g, SourcePicker<Graph> &sp, NodeID num_iters,
 }
 
 
-int main(int argc, char* argv[]) {
-  CLIterApp cli(argc, argv, "betweenness-centrality", 1);
-  if (!cli.ParseArgs())
-    return -1;
+void BenchmarkBC(const CLBatch &cli, const Graph &g, BCScratch &scratch) {
   if (cli.num_iters() > 1 && cli.start_vertex() != -1)
     cout << "Warning: iterating from same source (-r & -i)" << endl;
-  Builder b(cli);
-  Graph g = b.MakeGraph();
+  if ((cli.batch_size() < 1) || (cli.batch_size() > kMaxBatch)) {
+    cout << "Batch size (-b) must be from 1 to " << kMaxBatch << endl;
+    exit(-43);
+  }
+  if ((cli.batch_size() > 1) && cli.epoch_tagged())
+    cout << "Warning: batched sources don't use epoch tags (-b & -E)" << endl;
   SourcePicker<Graph> sp(g, cli.start_vertex());
-  auto BCBound = [&sp, &cli] (const Graph &g) {
-    return Brandes(g, sp, cli.num_iters(), cli.logging_en());
+  auto BCBound = [&sp, &cli, &scratch] (const Graph &g)
+      -> const pvector<ScoreT>& {
+    if (cli.batch_size() > 1)
+      return BrandesBatched(g, sp, cli.num_iters(), cli.batch_size(), scratch,
+                            cli.logging_en());
+    return Brandes(g, sp, cli.num_iters(), scratch, cli.logging_en(),
+                   cli.epoch_tagged());
   };
   SourcePicker<Graph> vsp(g, cli.start_vertex());
   auto VerifierBound = [&vsp, &cli] (const Graph &g,
                                      const pvector<ScoreT> &scores) {
     return BCVerifier(g, vsp, cli.num_iters(), scores);
   };
-  BenchmarkKernel(cli, g, BCBound, PrintTopScores, VerifierBound);
+  auto ResetSources = [&sp, &vsp] { sp.Reset(); vsp.Reset(); };
+  BenchmarkKernel(cli, g, BCBound, PrintTopScores, VerifierBound,
+                  ResetSources);
+}
+
+
+void BenchmarkBC(const CLBatch &cli, const Graph &g) {
+  BCScratch scratch(g);
+  BenchmarkBC(cli, g, scratch);
+}
+
+
+#ifndef NO_MAIN
+int main(int argc, char* argv[]) {
+  CLBatch cli(argc, argv, "betweenness-centrality", 1);
+  if (!cli.ParseArgs())
+    return -1;
+  Builder b(cli);
+  Graph g = b.MakeGraph();
+  BenchmarkBC(cli, g);
   return 0;
 }
+#endif
@@ -6,13 +6,26 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <cmath>
+#include <cstdio>
 #include <functional>
 #include <random>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "builder.h"
+#include "compressed_graph.h"
+#include "counters.h"
+#include "dynamic_graph.h"
 #include "graph.h"
+#include "split_graph.h"
+#include "stream_builder.h"
 #include "timer.h"
 #include "util.h"
 #include "writer.h"
@@ -24,30 +37,98 @@ File:   Benchmark
 Author: Scott Beamer
 
 Various helper functions to ease writing of kernels
+ - BenchmarkKernel times trials of a kernel (after untimed warmups, -I), and
+   with -T it repeats them at each thread count of a scaling sweep, adding
+   the median, 95th percentile, & standard deviation of trial times, GTEPS,
+   and the effective bandwidth of one pass over the graph's arrays (a lower
+   bound for kernels that make several passes)
 */
 
 
-// Default type signatures for commonly used types
+// Default type signatures for commonly used types, with 64-bit vertex IDs
+// only in the 64-bit build (-DGAP_ID64, e.g. bfs64) for graphs too big for
+// 32-bit IDs, since they use more memory (and bandwidth)
+#ifdef GAP_ID64
+typedef int64_t NodeID;
+#else
 typedef int32_t NodeID;
+#endif
 typedef int32_t WeightT;
 typedef NodeWeight<NodeID, WeightT> WNode;
 
 typedef CSRGraph<NodeID> Graph;
 typedef CSRGraph<NodeID, WNode> WGraph;
+typedef CompressedGraph<NodeID> CGraph;
+typedef DynamicGraph<NodeID> DGraph;
+template <typename StoreT_>
+using SWGraph = SplitWGraph<NodeID, WeightT, StoreT_>;
 
 typedef BuilderBase<NodeID, NodeID, WeightT> Builder;
 typedef BuilderBase<NodeID, WNode, WeightT> WeightedBuilder;
 
+typedef StreamBuilderBase<NodeID, NodeID, WeightT> StreamBuilder;
+typedef StreamBuilderBase<NodeID, WNode, WeightT> WeightedStreamBuilder;
+
 typedef WriterBase<NodeID, NodeID> Writer;
 typedef WriterBase<NodeID, WNode> WeightedWriter;
+template <typename StoreT_>
+using SplitWeightedWriter = SplitWriter<NodeID, WeightT, StoreT_>;
+
+
+// Vertex IDs as in the input, for graphs relabeled (-O) after being read
+template<typename GraphT_>
+NodeID OriginalID(const GraphT_ &g, NodeID n) {
+  return n;
+}
+
+template<typename DestID_, bool invert>
+NodeID OriginalID(const CSRGraph<NodeID, DestID_, invert> &g, NodeID n) {
+  return g.original_id(n);
+}
+
+template<typename WeightT_, typename StoreT_, bool invert>
+NodeID OriginalID(const SplitWGraph<NodeID, WeightT_, StoreT_, invert> &g,
+                  NodeID n) {
+  return g.original_id(n);
+}
+
+template<bool invert>
+NodeID OriginalID(const DynamicGraph<NodeID, invert> &g, NodeID n) {
+  return g.original_id(n);
+}
+
+template<typename GraphT_>
+NodeID RelabeledID(const GraphT_ &g, NodeID original) {
+  return original;
+}
+
+template<typename DestID_, bool invert>
+NodeID RelabeledID(const CSRGraph<NodeID, DestID_, invert> &g,
+                   NodeID original) {
+  return g.relabeled_id(original);
+}
+
+template<typename WeightT_, typename StoreT_, bool invert>
+NodeID RelabeledID(const SplitWGraph<NodeID, WeightT_, StoreT_, invert> &g,
+                   NodeID original) {
+  return g.relabeled_id(original);
+}
+
+template<bool invert>
+NodeID RelabeledID(const DynamicGraph<NodeID, invert> &g, NodeID original) {
+  return g.relabeled_id(original);
+}
 
 
 // Used to pick random non-zero degree starting points for search algorithms
+//   (a given source is an input ID, so it is mapped if graph was relabeled)
 template<typename GraphT_>
 class SourcePicker {
  public:
   explicit SourcePicker(const GraphT_ &g, NodeID given_source = -1)
-      : given_source_(given_source), rng_(kRandSeed),
+      : given_source_(given_source == -1 ? -1 :
+                                           RelabeledID(g, given_source)),
+        rng_(kRandSeed),
         udist_(g.num_nodes()-1, rng_), g_(g) {}
 
   NodeID PickNext() {
@@ -60,6 +141,11 @@ class SourcePicker {
     return source;
   }
 
+  // Starts the same sequence of sources over (e.g. for each -T thread count)
+  void Reset() {
+    rng_.seed(kRandSeed);
+  }
+
  private:
   NodeID given_source_;
   std::mt19937_64 rng_;
@@ -94,21 +180,114 @@ bool VerifyUnimplemented(...) {
 }
 
 
-// Calls (and times) kernel according to command line arguments
+inline int MaxThreads() {
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+// Returns the number of threads actually set (1 without OpenMP)
+inline int SetNumThreads(int num_threads) {
+#ifdef _OPENMP
+  omp_set_num_threads(num_threads);
+#endif
+  return MaxThreads();
+}
+
+
+// Records graph & run configuration if a Report is open (-j)
+template<typename GraphT_>
+void ReportConfig(const CLApp &cli, const GraphT_ &g) {
+  int num_threads = MaxThreads();
+  std::string input = cli.filename();
+  if (input == "")
+    input = (cli.uniform() ? "u" : "g") + std::to_string(cli.scale());
+  Report::Get().Write("graph", {
+      Report::String("input", input),
+      Report::Number("nodes", g.num_nodes()),
+      Report::Number("edges", g.num_edges()),
+      Report::Number("edges_directed", g.num_edges_directed()),
+      Report::Bool("directed", g.directed())});
+  Report::Get().Write("config", {
+      Report::Number("threads", static_cast<int64_t>(num_threads)),
+      Report::Number("trials", static_cast<int64_t>(cli.num_trials())),
+      Report::Bool("verify", cli.do_verify())});
+}
+
+
+// Summary of a set of trial times
+struct TrialStats {
+  double average;
+  double min;
+  double max;
+  double median;
+  double p95;
+  double stddev;
+
+  explicit TrialStats(std::vector<double> seconds) {
+    std::sort(seconds.begin(), seconds.end());
+    size_t n = seconds.size();
+    double total = 0;
+    for (double s : seconds)
+      total += s;
+    average = total / n;
+    min = seconds.front();
+    max = seconds.back();
+    median = (seconds[(n-1) / 2] + seconds[n / 2]) / 2;
+    p95 = seconds[static_cast<size_t>(std::ceil(0.95 * n)) - 1];
+    double sum_squares = 0;
+    for (double s : seconds)
+      sum_squares += (s - average) * (s - average);
+    stddev = std::sqrt(sum_squares / n);
+  }
+};
+
+
+// Bytes of one pass over the graph's neighbors & offsets (one direction)
+template<typename GraphT_>
+int64_t GraphPassBytes(const GraphT_ &g) {
+  typedef typename std::decay<decltype(*g.out_neigh(0).begin())>::type DestT;
+  return g.num_edges_directed() * static_cast<int64_t>(sizeof(DestT)) +
+         (g.num_nodes() + 1) * static_cast<int64_t>(sizeof(SGOffset));
+}
+
+
+// Runs warmups & then timed trials at the current number of threads
 template<typename GraphT_, typename GraphFunc, typename AnalysisFunc,
          typename VerifierFunc>
-void BenchmarkKernel(const CLApp &cli, const GraphT_ &g,
-                     GraphFunc kernel, AnalysisFunc stats,
-                     VerifierFunc verify) {
-  g.PrintStats();
-  double total_seconds = 0;
+void RunTrials(const CLApp &cli, const GraphT_ &g, GraphFunc kernel,
+               AnalysisFunc stats, VerifierFunc verify, int num_threads,
+               bool scaling) {
   Timer trial_timer;
+  for (int iter=0; iter < cli.num_warmups(); iter++) {
+    trial_timer.Start();
+    auto &&result = kernel(g);
+    trial_timer.Stop();
+    PrintTime("Warmup Time", trial_timer.Seconds());
+    // also keeps verifier's source picker in step with kernel's
+    if (cli.do_verify())
+      PrintLabel("Verification",
+                 verify(std::ref(g), std::ref(result)) ? "PASS" : "FAIL");
+  }
+  std::vector<double> seconds;
   for (int iter=0; iter < cli.num_trials(); iter++) {
+    Report::Get().set_trial(iter);
+    PerfCounters::Get().Begin("trial");
     trial_timer.Start();
-    auto result = kernel(g);
+    auto &&result = kernel(g);      // kernel could return its own storage
     trial_timer.Stop();
+    PerfCounters::Get().End("trial");
     PrintTime("Trial Time", trial_timer.Seconds());
-    total_seconds += trial_timer.Seconds();
+    PerfCounters::Get().PrintRegions();
+    seconds.push_back(trial_timer.Seconds());
+    Report::Get().Write("trial", {
+        Report::Number("seconds", trial_timer.Seconds()),
+        Report::Number("threads", static_cast<int64_t>(num_threads)),
+        Report::Number("teps", g.num_edges() / trial_timer.Seconds()),
+        Report::Number("edges_per_second",
+                       g.num_edges_directed() / trial_timer.Seconds())});
     if (cli.do_analysis() && (iter == (cli.num_trials()-1)))
       stats(g, result);
     if (cli.do_verify()) {
@@ -119,7 +298,71 @@ void BenchmarkKernel(const CLApp &cli, const GraphT_ &g,
       PrintTime("Verification Time", trial_timer.Seconds());
     }
   }
-  PrintTime("Average Time", total_seconds / cli.num_trials());
+  Report::Get().set_trial(-1);
+  if (seconds.empty())
+    return;
+  TrialStats t(seconds);
+  double gteps = g.num_edges() / t.median / 1e9;
+  double gbps = GraphPassBytes(g) / t.median / 1e9;
+  PrintTime("Average Time", t.average);
+  if (scaling) {
+    PrintTime("Median Time", t.median);
+    PrintTime("P95 Time", t.p95);
+    PrintTime("Stddev Time", t.stddev);
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.5lf", gteps);
+    PrintLabel("GTEPS", buf);
+    snprintf(buf, sizeof(buf), "%.5lf", gbps);
+    PrintLabel("Graph GB/s", buf);
+  }
+  Report::Get().Write("summary", {
+      Report::Number("threads", static_cast<int64_t>(num_threads)),
+      Report::Number("average_seconds", t.average),
+      Report::Number("min_seconds", t.min),
+      Report::Number("max_seconds", t.max),
+      Report::Number("median_seconds", t.median),
+      Report::Number("p95_seconds", t.p95),
+      Report::Number("stddev_seconds", t.stddev),
+      Report::Number("teps", g.num_edges() / t.average),
+      Report::Number("edges_per_second",
+                     g.num_edges_directed() / t.average),
+      Report::Number("gteps_median", gteps),
+      Report::Number("pass_gb_per_second", gbps)});
+}
+
+
+// Calls (and times) kernel according to command line arguments, at each
+// thread count if sweeping them (-T), calling reset before each count's trials
+// so kernels picking sources (SourcePicker::Reset) time the same ones at each
+template<typename GraphT_, typename GraphFunc, typename AnalysisFunc,
+         typename VerifierFunc, typename ResetFunc>
+void BenchmarkKernel(const CLApp &cli, const GraphT_ &g,
+                     GraphFunc kernel, AnalysisFunc stats,
+                     VerifierFunc verify, ResetFunc reset) {
+  g.PrintStats();
+  ReportConfig(cli, g);
+  if (cli.thread_counts().empty()) {
+    RunTrials(cli, g, kernel, stats, verify, MaxThreads(), false);
+    return;
+  }
+  int default_threads = MaxThreads();
+  for (int num_threads : cli.thread_counts()) {
+    num_threads = SetNumThreads(num_threads);
+    NumaBindThreads();
+    PrintLabel("Threads", std::to_string(num_threads));
+    reset();
+    RunTrials(cli, g, kernel, stats, verify, num_threads, true);
+  }
+  SetNumThreads(default_threads);
+  NumaBindThreads();
+}
+
+template<typename GraphT_, typename GraphFunc, typename AnalysisFunc,
+         typename VerifierFunc>
+void BenchmarkKernel(const CLApp &cli, const GraphT_ &g,
+                     GraphFunc kernel, AnalysisFunc stats,
+                     VerifierFunc verify) {
+  BenchmarkKernel(cli, g, kernel, stats, verify, [] {});
 }
 
 #endif  // BENCHMARK_H_
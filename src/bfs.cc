@@ -8,7 +8,10 @@
 #include "bitmap.h"
 #include "builder.h"
 #include "command_line.h"
+#include "counters.h"
+#include "frontier.h"
 #include "graph.h"
+#include "partition.h"
 #include "platform_atomics.h"
 #include "pvector.h"
 #include "sliding_queue.h"
@@ -34,6 +37,9 @@ them in the parent array as negative numbers. Thus, the encoding of parent is:
   parent[x] < 0 implies x is unvisited and parent[x] = -out_degree(x)
   parent[x] >= 0 implies x been visited
 
+The kernel is templated on the graph type, so it can also run directly on a
+compressed graph (.csg), which trades decoding work for less memory traffic.
+
 [1] Scott Beamer, Krste Asanović, and David Patterson. "Direction-Optimizing
     Breadth-First Search." International Conference on High Performance
     Computing, Networking, Storage and Analysis (SC), Salt Lake City, Utah,
@@ -43,46 +49,42 @@ them in the parent array as negative numbers. Thus, the encoding of parent is:
 
 using namespace std;
 
-int64_t BUStep(const Graph &g, pvector<NodeID> &parent, Bitmap &front,
+template <typename GraphT_>
+int64_t BUStep(const GraphT_ &g, pvector<NodeID> &parent, Bitmap &front,
                Bitmap &next) {
-  int64_t awake_count = 0;
   next.reset();
-  #pragma omp parallel for reduction(+ : awake_count) schedule(dynamic, 1024)
-  for (NodeID u=0; u < g.num_nodes(); u++) {
+  return ParallelSumVertices<int64_t>(g.VertexBlocks(true), [&](NodeID u) {
     if (parent[u] < 0) {
       for (NodeID v : g.in_neigh(u)) {
         if (front.get_bit(v)) {
           parent[u] = v;
-          awake_count++;
           next.set_bit(u);
-          break;
+          return 1;
         }
       }
     }
-  }
-  return awake_count;
+    return 0;
+  });
 }
 
 
-int64_t TDStep(const Graph &g, pvector<NodeID> &parent,
-               SlidingQueue<NodeID> &queue) {
+template <typename GraphT_>
+int64_t TDStep(const GraphT_ &g, pvector<NodeID> &parent,
+               SlidingQueue<NodeID> &queue, EdgeBalancer<NodeID> &balancer) {
   int64_t scout_count = 0;
-  #pragma omp parallel
+  #pragma omp parallel reduction(+ : scout_count)
   {
     QueueBuffer<NodeID> lqueue(queue);
-    #pragma omp for reduction(+ : scout_count) nowait
-    for (auto q_iter = queue.begin(); q_iter < queue.end(); q_iter++) {
-      NodeID u = *q_iter;
-      for (NodeID v : g.out_neigh(u)) {
-        NodeID curr_val = parent[v];
-        if (curr_val < 0) {
-          if (compare_and_swap(parent[v], curr_val, u)) {
-            lqueue.push_back(v);
-            scout_count += -curr_val;
-          }
+    balancer.ForEachEdge(g, queue.begin(), queue.end(),
+                         [&](NodeID u, NodeID v) {
+      NodeID curr_val = parent[v];
+      if (curr_val < 0) {
+        if (compare_and_swap(parent[v], curr_val, u)) {
+          lqueue.push_back(v);
+          scout_count += -curr_val;
         }
       }
-    }
+    });
     lqueue.flush();
   }
   return scout_count;
@@ -97,7 +99,8 @@ void QueueToBitmap(const SlidingQueue<NodeID> &queue, Bitmap &bm) {
   }
 }
 
-void BitmapToQueue(const Graph &g, const Bitmap &bm,
+template <typename GraphT_>
+void BitmapToQueue(const GraphT_ &g, const Bitmap &bm,
                    SlidingQueue<NodeID> &queue) {
   #pragma omp parallel
   {
@@ -111,44 +114,81 @@ void BitmapToQueue(const Graph &g, const Bitmap &bm,
   queue.slide_window();
 }
 
-pvector<NodeID> InitParent(const Graph &g) {
-  pvector<NodeID> parent(g.num_nodes());
+template <typename GraphT_>
+void InitParent(const GraphT_ &g, pvector<NodeID> &parent) {
   #pragma omp parallel for
   for (NodeID n=0; n < g.num_nodes(); n++)
     parent[n] = g.out_degree(n) != 0 ? -g.out_degree(n) : -1;
-  return parent;
 }
 
-pvector<NodeID> DOBFS(const Graph &g, NodeID source, bool logging_enabled = false,
-                      int alpha = 15, int beta = 18) {
+
+// Storage for DOBFS, allocated once per graph and reused by every search
+struct BFSScratch {
+  pvector<NodeID> parent;
+  SlidingQueue<NodeID> queue;
+  Bitmap curr;
+  Bitmap front;
+  pvector<uint32_t> epochs;     // only for SparseDOBFS
+  uint32_t epoch = 0;
+  EdgeBalancer<NodeID> balancer;
+
+  explicit BFSScratch(int64_t num_nodes)
+      : parent(num_nodes), queue(num_nodes), curr(num_nodes),
+        front(num_nodes) {}
+
+  // Starts a new epoch, so every vertex is unvisited without a reset (unless
+  // epoch wrapped around)
+  uint32_t NextEpoch() {
+    if (epochs.size() != parent.size())
+      epochs = pvector<uint32_t>(parent.size(), 0);
+    epoch++;
+    if (epoch == 0) {
+      epochs.fill(0);
+      epoch = 1;
+    }
+    return epoch;
+  }
+};
+
+
+// Returned parent array is owned by scratch (valid until its next search)
+template <typename GraphT_>
+const pvector<NodeID>& DOBFS(const GraphT_ &g, NodeID source,
+                             BFSScratch &scratch,
+                             bool logging_enabled = false, int alpha = 15,
+                             int beta = 18) {
   if (logging_enabled)
     PrintStep("Source", static_cast<int64_t>(source));
-  Timer t;
-  t.Start();
-  pvector<NodeID> parent = InitParent(g);
+  pvector<NodeID> &parent = scratch.parent;
+  SlidingQueue<NodeID> &queue = scratch.queue;
+  Bitmap &curr = scratch.curr;
+  Bitmap &front = scratch.front;
+  RegionTimer t;
+  t.Start("i");
+  InitParent(g, parent);
+  queue.reset();
+  curr.reset();
+  front.reset();
   t.Stop();
   if (logging_enabled)
     PrintStep("i", t.Seconds());
   parent[source] = source;
-  SlidingQueue<NodeID> queue(g.num_nodes());
   queue.push_back(source);
   queue.slide_window();
-  Bitmap curr(g.num_nodes());
-  curr.reset();
-  Bitmap front(g.num_nodes());
-  front.reset();
   int64_t edges_to_check = g.num_edges_directed();
   int64_t scout_count = g.out_degree(source);
   while (!queue.empty()) {
     if (scout_count > edges_to_check / alpha) {
       int64_t awake_count, old_awake_count;
-      TIME_OP(t, QueueToBitmap(queue, front));
+      t.Start("e");
+      QueueToBitmap(queue, front);
+      t.Stop();
       if (logging_enabled)
         PrintStep("e", t.Seconds());
       awake_count = queue.size();
       queue.slide_window();
       do {
-        t.Start();
+        t.Start("bu");
         old_awake_count = awake_count;
         awake_count = BUStep(g, parent, front, curr);
         front.swap(curr);
@@ -157,14 +197,16 @@ pvector<NodeID> DOBFS(const Graph &g, NodeID source, bool logging_enabled = fals
           PrintStep("bu", t.Seconds(), awake_count);
       } while ((awake_count >= old_awake_count) ||
                (awake_count > g.num_nodes() / beta));
-      TIME_OP(t, BitmapToQueue(g, front, queue));
+      t.Start("c");
+      BitmapToQueue(g, front, queue);
+      t.Stop();
       if (logging_enabled)
         PrintStep("c", t.Seconds());
       scout_count = 1;
     } else {
-      t.Start();
+      t.Start("td");
       edges_to_check -= scout_count;
-      scout_count = TDStep(g, parent, queue);
+      scout_count = TDStep(g, parent, queue, scratch.balancer);
       queue.slide_window();
       t.Stop();
       if (logging_enabled)
@@ -179,7 +221,158 @@ pvector<NodeID> DOBFS(const Graph &g, NodeID source, bool logging_enabled = fals
 }
 
 
-void PrintBFSStats(const Graph &g, const pvector<NodeID> &bfs_tree) {
+// Vertices reached by a search paired with their parents
+typedef vector<pair<NodeID, NodeID>> SparseParents;
+
+
+// Versions of the steps for SparseDOBFS, where a vertex has been visited iff
+//   its epoch is the current one (and then parent is valid)
+template <typename GraphT_>
+int64_t TDStepEpoch(const GraphT_ &g, pvector<NodeID> &parent,
+                    pvector<uint32_t> &epochs, uint32_t epoch,
+                    SlidingQueue<NodeID> &queue,
+                    EdgeBalancer<NodeID> &balancer) {
+  int64_t scout_count = 0;
+  #pragma omp parallel reduction(+ : scout_count)
+  {
+    QueueBuffer<NodeID> lqueue(queue);
+    balancer.ForEachEdge(g, queue.begin(), queue.end(),
+                         [&](NodeID u, NodeID v) {
+      uint32_t v_epoch = epochs[v];
+      if ((v_epoch != epoch) && compare_and_swap(epochs[v], v_epoch, epoch)) {
+        parent[v] = u;
+        lqueue.push_back(v);
+        scout_count += g.out_degree(v);
+      }
+    });
+    lqueue.flush();
+  }
+  return scout_count;
+}
+
+
+template <typename GraphT_>
+int64_t BUStepEpoch(const GraphT_ &g, pvector<NodeID> &parent,
+                    pvector<uint32_t> &epochs, uint32_t epoch, Bitmap &front,
+                    Bitmap &next) {
+  next.reset();
+  return ParallelSumVertices<int64_t>(g.VertexBlocks(true), [&](NodeID u) {
+    if (epochs[u] != epoch) {
+      for (NodeID v : g.in_neigh(u)) {
+        if (front.get_bit(v)) {
+          parent[u] = v;
+          epochs[u] = epoch;
+          next.set_bit(u);
+          return 1;
+        }
+      }
+    }
+    return 0;
+  });
+}
+
+
+// Same search as DOBFS, but with epoch-tagged visited state instead of
+// initializing parent, and returning only the vertices reached. If it stays
+// top-down, every reached vertex passed through the queue, so the search and
+// its output are proportional to the vertices reached rather than all of
+// them, which helps searches that reach only a small part of the graph.
+template <typename GraphT_>
+SparseParents SparseDOBFS(const GraphT_ &g, NodeID source,
+                          BFSScratch &scratch, bool logging_enabled = false,
+                          int alpha = 15, int beta = 18) {
+  if (logging_enabled)
+    PrintStep("Source", static_cast<int64_t>(source));
+  pvector<NodeID> &parent = scratch.parent;
+  SlidingQueue<NodeID> &queue = scratch.queue;
+  Bitmap &curr = scratch.curr;
+  Bitmap &front = scratch.front;
+  RegionTimer t;
+  t.Start("i");
+  uint32_t epoch = scratch.NextEpoch();
+  pvector<uint32_t> &epochs = scratch.epochs;
+  queue.reset();
+  t.Stop();
+  if (logging_enabled)
+    PrintStep("i", t.Seconds());
+  parent[source] = source;
+  epochs[source] = epoch;
+  queue.push_back(source);
+  queue.slide_window();
+  const NodeID *all_visited = queue.begin();
+  bool went_bottom_up = false;
+  int64_t edges_to_check = g.num_edges_directed();
+  int64_t scout_count = g.out_degree(source);
+  while (!queue.empty()) {
+    if (scout_count > edges_to_check / alpha) {
+      int64_t awake_count, old_awake_count;
+      t.Start("e");
+      if (!went_bottom_up) {
+        curr.reset();
+        front.reset();
+        went_bottom_up = true;
+      }
+      QueueToBitmap(queue, front);
+      t.Stop();
+      if (logging_enabled)
+        PrintStep("e", t.Seconds());
+      awake_count = queue.size();
+      queue.slide_window();
+      do {
+        t.Start("bu");
+        old_awake_count = awake_count;
+        awake_count = BUStepEpoch(g, parent, epochs, epoch, front, curr);
+        front.swap(curr);
+        t.Stop();
+        if (logging_enabled)
+          PrintStep("bu", t.Seconds(), awake_count);
+      } while ((awake_count >= old_awake_count) ||
+               (awake_count > g.num_nodes() / beta));
+      t.Start("c");
+      BitmapToQueue(g, front, queue);
+      t.Stop();
+      if (logging_enabled)
+        PrintStep("c", t.Seconds());
+      scout_count = 1;
+    } else {
+      t.Start("td");
+      edges_to_check -= scout_count;
+      scout_count = TDStepEpoch(g, parent, epochs, epoch, queue,
+                                scratch.balancer);
+      queue.slide_window();
+      t.Stop();
+      if (logging_enabled)
+        PrintStep("td", t.Seconds(), queue.size());
+    }
+  }
+  SparseParents reached;
+  if (!went_bottom_up) {
+    reached.resize(queue.end() - all_visited);
+    #pragma omp parallel for
+    for (size_t i=0; i < reached.size(); i++)
+      reached[i] = make_pair(all_visited[i], parent[all_visited[i]]);
+  } else {
+    for (NodeID n=0; n < g.num_nodes(); n++) {
+      if (epochs[n] == epoch)
+        reached.push_back(make_pair(n, parent[n]));
+    }
+  }
+  return reached;
+}
+
+
+// Dense parent array (-1 if not reached) for checking sparse output
+template <typename GraphT_>
+pvector<NodeID> DenseParents(const GraphT_ &g, const SparseParents &reached) {
+  pvector<NodeID> parent(g.num_nodes(), -1);
+  for (auto node_parent : reached)
+    parent[node_parent.first] = node_parent.second;
+  return parent;
+}
+
+
+template <typename GraphT_>
+void PrintBFSStats(const GraphT_ &g, const pvector<NodeID> &bfs_tree) {
   int64_t tree_size = 0;
   int64_t n_edges = 0;
   for (NodeID n : g.vertices()) {
@@ -198,7 +391,8 @@ void PrintBFSStats(const Graph &g, const pvector<NodeID> &bfs_tree) {
 // - parent[v] = u  =>  depth[v] = depth[u] + 1 (except for source)
 // - parent[v] = u  => there is edge from u to v
 // - all vertices reachable from source have a parent
-bool BFSVerifier(const Graph &g, NodeID source,
+template <typename GraphT_>
+bool BFSVerifier(const GraphT_ &g, NodeID source,
                  const pvector<NodeID> &parent) {
   pvector<int> depth(g.num_nodes(), -1);
   depth[source] = 0;
@@ -247,20 +441,68 @@ bool BFSVerifier(const Graph &g, NodeID source,
 }
 
 
+template <typename GraphT_>
+void BenchmarkSparseBFS(const CLApp &cli, const GraphT_ &g,
+                        BFSScratch &scratch) {
+  SourcePicker<GraphT_> sp(g, cli.start_vertex());
+  auto BFSBound = [&sp, &cli, &scratch] (const GraphT_ &g) {
+    return SparseDOBFS(g, sp.PickNext(), scratch, cli.logging_en());
+  };
+  auto StatsBound = [] (const GraphT_ &g, const SparseParents &reached) {
+    PrintBFSStats(g, DenseParents(g, reached));
+  };
+  SourcePicker<GraphT_> vsp(g, cli.start_vertex());
+  auto VerifierBound = [&vsp] (const GraphT_ &g,
+                               const SparseParents &reached) {
+    return BFSVerifier(g, vsp.PickNext(), DenseParents(g, reached));
+  };
+  auto ResetSources = [&sp, &vsp] { sp.Reset(); vsp.Reset(); };
+  BenchmarkKernel(cli, g, BFSBound, StatsBound, VerifierBound, ResetSources);
+}
+
+
+template <typename GraphT_>
+void BenchmarkBFS(const CLApp &cli, const GraphT_ &g, BFSScratch &scratch) {
+  if (cli.epoch_tagged()) {
+    BenchmarkSparseBFS(cli, g, scratch);
+    return;
+  }
+  SourcePicker<GraphT_> sp(g, cli.start_vertex());
+  auto BFSBound = [&sp, &cli, &scratch] (const GraphT_ &g)
+      -> const pvector<NodeID>& {
+    return DOBFS(g, sp.PickNext(), scratch, cli.logging_en());
+  };
+  SourcePicker<GraphT_> vsp(g, cli.start_vertex());
+  auto VerifierBound = [&vsp] (const GraphT_ &g,
+                               const pvector<NodeID> &parent) {
+    return BFSVerifier(g, vsp.PickNext(), parent);
+  };
+  auto ResetSources = [&sp, &vsp] { sp.Reset(); vsp.Reset(); };
+  BenchmarkKernel(cli, g, BFSBound, PrintBFSStats<GraphT_>, VerifierBound,
+                  ResetSources);
+}
+
+
+template <typename GraphT_>
+void BenchmarkBFS(const CLApp &cli, const GraphT_ &g) {
+  BFSScratch scratch(g.num_nodes());
+  BenchmarkBFS(cli, g, scratch);
+}
+
+
+#ifndef NO_MAIN
 int main(int argc, char* argv[]) {
   CLApp cli(argc, argv, "breadth-first search");
   if (!cli.ParseArgs())
     return -1;
   Builder b(cli);
-  Graph g = b.MakeGraph();
-  SourcePicker<Graph> sp(g, cli.start_vertex());
-  auto BFSBound = [&sp,&cli] (const Graph &g) {
-    return DOBFS(g, sp.PickNext(), cli.logging_en());
-  };
-  SourcePicker<Graph> vsp(g, cli.start_vertex());
-  auto VerifierBound = [&vsp] (const Graph &g, const pvector<NodeID> &parent) {
-    return BFSVerifier(g, vsp.PickNext(), parent);
-  };
-  BenchmarkKernel(cli, g, BFSBound, PrintBFSStats, VerifierBound);
+  if (b.compressed_input()) {
+    CGraph g = b.MakeCompressedGraph();
+    BenchmarkBFS(cli, g);
+  } else {
+    Graph g = b.MakeGraph();
+    BenchmarkBFS(cli, g);
+  }
   return 0;
 }
+#endif
@@ -0,0 +1,277 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#include <algorithm>
+#include <cinttypes>
+#include <iostream>
+#include <vector>
+
+#include "benchmark.h"
+#include "builder.h"
+#include "command_line.h"
+#include "graph.h"
+#include "platform_atomics.h"
+#include "pvector.h"
+#include "timer.h"
+#include "util.h"
+
+
+/*
+GAP Benchmark Suite
+Kernel: Multi-Source Breadth-First Search (MS-BFS)
+Author: Scott Beamer
+
+Will return per-source statistics (vertices reached, sum of depths, and
+eccentricity) for BFS traversals from a batch of sources
+
+This implementation runs a batch of up to 64 sources at once, in the style of
+MS-BFS [1]. Each vertex has a bitmask (SourceMask) with a bit per source for
+whether it has been seen, is in the current frontier, or is in the next
+frontier, so every edge examined advances all of the batch's traversals that
+can use it. Like bfs, it uses direction optimization [2]:
+ - Top-down (TDStep) pushes each frontier vertex's mask to its neighbors
+ - Bottom-up (BUStep) has each vertex gather masks from its in-neighbors, and
+   it can stop early once it has found every source it hasn't yet seen
+The same alpha and beta heuristics as bfs pick the direction, counting each
+frontier vertex once, however many sources reached it.
+
+Depths are not stored per source (that would need 64 arrays), instead they
+are aggregated per source as the frontier is advanced (UpdateFrontier).
+
+[1] Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu,
+    Kien Pham, Alfons Kemper, Thomas Neumann, and Huy T. Vo. "The More the
+    Merrier: Efficient Multi-Source Graph Traversal." Proceedings of the VLDB
+    Endowment, 8(4), 2014.
+
+[2] Scott Beamer, Krste Asanović, and David Patterson. "Direction-Optimizing
+    Breadth-First Search." International Conference on High Performance
+    Computing, Networking, Storage and Analysis (SC), Salt Lake City, Utah,
+    November 2012.
+*/
+
+
+using namespace std;
+
+typedef uint64_t SourceMask;
+const int kBatchSize = 64;
+
+
+// Per-source results for a batch
+struct MSBFSResult {
+  vector<NodeID> sources;
+  vector<int64_t> reached;      // vertices reached (including source)
+  vector<int64_t> depth_sums;   // sum of depths of all reached vertices
+  vector<int> max_depths;       // depth of farthest vertex reached
+
+  explicit MSBFSResult(const vector<NodeID> &batch)
+      : sources(batch), reached(batch.size(), 1),
+        depth_sums(batch.size(), 0), max_depths(batch.size(), 0) {}
+};
+
+
+template <typename GraphT_>
+void TDStep(const GraphT_ &g, const pvector<SourceMask> &frontier,
+            const pvector<SourceMask> &seen, pvector<SourceMask> &next) {
+  #pragma omp parallel for schedule(dynamic, 1024)
+  for (NodeID u=0; u < g.num_nodes(); u++) {
+    SourceMask u_frontier = frontier[u];
+    if (u_frontier != 0) {
+      for (NodeID v : g.out_neigh(u)) {
+        SourceMask unseen = u_frontier & ~(seen[v] | next[v]);
+        if (unseen != 0)
+          fetch_and_or(next[v], unseen);
+      }
+    }
+  }
+}
+
+
+template <typename GraphT_>
+void BUStep(const GraphT_ &g, const pvector<SourceMask> &frontier,
+            const pvector<SourceMask> &seen, pvector<SourceMask> &next,
+            SourceMask batch_mask) {
+  #pragma omp parallel for schedule(dynamic, 1024)
+  for (NodeID u=0; u < g.num_nodes(); u++) {
+    SourceMask unseen = ~seen[u] & batch_mask;
+    if (unseen != 0) {
+      SourceMask found = 0;
+      for (NodeID v : g.in_neigh(u)) {
+        found |= frontier[v] & unseen;
+        if (found == unseen)
+          break;
+      }
+      next[u] = found;
+    }
+  }
+}
+
+
+// Makes next the frontier, and records depth of newly reached vertices
+// Returns number of vertices in new frontier, scout_count is their edges
+template <typename GraphT_>
+int64_t UpdateFrontier(const GraphT_ &g, int depth,
+                       pvector<SourceMask> &frontier,
+                       pvector<SourceMask> &seen, pvector<SourceMask> &next,
+                       MSBFSResult &result, int64_t &scout_count) {
+  int64_t awake_count = 0;
+  int64_t edges_out = 0;
+  vector<int64_t> newly_reached(kBatchSize, 0);
+  #pragma omp parallel
+  {
+    vector<int64_t> local_reached(kBatchSize, 0);
+    #pragma omp for reduction(+ : awake_count, edges_out) nowait
+    for (NodeID n=0; n < g.num_nodes(); n++) {
+      SourceMask fresh = next[n] & ~seen[n];
+      next[n] = 0;
+      frontier[n] = fresh;
+      if (fresh != 0) {
+        seen[n] |= fresh;
+        awake_count++;
+        edges_out += g.out_degree(n);
+        while (fresh != 0) {
+          local_reached[LowestBit(fresh)]++;
+          fresh &= fresh - 1;
+        }
+      }
+    }
+    #pragma omp critical
+    for (int i=0; i < kBatchSize; i++)
+      newly_reached[i] += local_reached[i];
+  }
+  for (size_t i=0; i < result.sources.size(); i++) {
+    if (newly_reached[i] != 0) {
+      result.reached[i] += newly_reached[i];
+      result.depth_sums[i] += depth * newly_reached[i];
+      result.max_depths[i] = depth;
+    }
+  }
+  scout_count = edges_out;
+  return awake_count;
+}
+
+
+template <typename GraphT_>
+MSBFSResult MSBFS(const GraphT_ &g, const vector<NodeID> &sources,
+                  bool logging_enabled = false, int alpha = 15,
+                  int beta = 18) {
+  MSBFSResult result(sources);
+  SourceMask batch_mask = sources.size() == kBatchSize ? ~SourceMask(0) :
+                          (SourceMask(1) << sources.size()) - 1;
+  pvector<SourceMask> seen(g.num_nodes(), 0);
+  pvector<SourceMask> frontier(g.num_nodes(), 0);
+  pvector<SourceMask> next(g.num_nodes(), 0);
+  int64_t scout_count = 0;
+  for (size_t i=0; i < sources.size(); i++) {
+    seen[sources[i]] |= SourceMask(1) << i;
+    frontier[sources[i]] |= SourceMask(1) << i;
+    scout_count += g.out_degree(sources[i]);
+  }
+  int64_t edges_to_check = g.num_edges_directed();
+  int64_t awake_count = sources.size();
+  int64_t old_awake_count = 0;
+  bool bottom_up = false;
+  Timer t;
+  for (int depth=1; awake_count > 0; depth++) {
+    if (!bottom_up)
+      bottom_up = scout_count > edges_to_check / alpha;
+    else
+      bottom_up = (awake_count >= old_awake_count) ||
+                  (awake_count > g.num_nodes() / beta);
+    t.Start();
+    if (bottom_up) {
+      BUStep(g, frontier, seen, next, batch_mask);
+    } else {
+      edges_to_check -= scout_count;
+      TDStep(g, frontier, seen, next);
+    }
+    old_awake_count = awake_count;
+    awake_count = UpdateFrontier(g, depth, frontier, seen, next, result,
+                                 scout_count);
+    t.Stop();
+    if (logging_enabled)
+      PrintStep(bottom_up ? "bu" : "td", t.Seconds(), awake_count);
+  }
+  return result;
+}
+
+
+template <typename GraphT_>
+void PrintMSBFSStats(const GraphT_ &g, const MSBFSResult &result) {
+  int64_t total_reached = 0;
+  int max_depth = 0;
+  for (size_t i=0; i < result.sources.size(); i++) {
+    total_reached += result.reached[i];
+    max_depth = max(max_depth, result.max_depths[i]);
+  }
+  cout << "Batch of " << result.sources.size() << " sources reached ";
+  cout << total_reached / result.sources.size() << " nodes on average ";
+  cout << "with max depth " << max_depth << endl;
+}
+
+
+// MS-BFS verifier does a serial BFS from each source in batch and asserts
+// its reached count, depth sum, and eccentricity match
+template <typename GraphT_>
+bool MSBFSVerifier(const GraphT_ &g, const MSBFSResult &result) {
+  pvector<int> depth(g.num_nodes());
+  vector<NodeID> to_visit;
+  to_visit.reserve(g.num_nodes());
+  for (size_t i=0; i < result.sources.size(); i++) {
+    NodeID source = result.sources[i];
+    depth.fill(-1);
+    depth[source] = 0;
+    to_visit.clear();
+    to_visit.push_back(source);
+    int64_t depth_sum = 0;
+    int max_depth = 0;
+    for (auto it = to_visit.begin(); it != to_visit.end(); it++) {
+      NodeID u = *it;
+      for (NodeID v : g.out_neigh(u)) {
+        if (depth[v] == -1) {
+          depth[v] = depth[u] + 1;
+          depth_sum += depth[v];
+          max_depth = max(max_depth, depth[v]);
+          to_visit.push_back(v);
+        }
+      }
+    }
+    if ((static_cast<int64_t>(to_visit.size()) != result.reached[i]) ||
+        (depth_sum != result.depth_sums[i]) ||
+        (max_depth != result.max_depths[i])) {
+      cout << "Mismatch for source " << source << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+
+template <typename GraphT_>
+void BenchmarkMSBFS(const CLApp &cli, const GraphT_ &g) {
+  SourcePicker<GraphT_> sp(g, cli.start_vertex());
+  auto MSBFSBound = [&sp, &cli] (const GraphT_ &g) {
+    vector<NodeID> sources(kBatchSize);
+    for (NodeID &source : sources)
+      source = sp.PickNext();
+    return MSBFS(g, sources, cli.logging_en());
+  };
+  auto ResetSources = [&sp] { sp.Reset(); };
+  BenchmarkKernel(cli, g, MSBFSBound, PrintMSBFSStats<GraphT_>,
+                  MSBFSVerifier<GraphT_>, ResetSources);
+}
+
+
+int main(int argc, char* argv[]) {
+  CLApp cli(argc, argv, "multi-source breadth-first search");
+  if (!cli.ParseArgs())
+    return -1;
+  Builder b(cli);
+  if (b.compressed_input()) {
+    CGraph g = b.MakeCompressedGraph();
+    BenchmarkMSBFS(cli, g);
+  } else {
+    Graph g = b.MakeGraph();
+    BenchmarkMSBFS(cli, g);
+  }
+  return 0;
+}
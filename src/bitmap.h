@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cinttypes>
 
+#include "alloc.h"
 #include "platform_atomics.h"
 
 
@@ -24,16 +25,26 @@ class Bitmap {
  public:
   explicit Bitmap(size_t size) {
     uint64_t num_words = (size + kBitsPerWord - 1) / kBitsPerWord;
-    start_ = new uint64_t[num_words];
+    start_ = AllocArray<uint64_t>(num_words);
     end_ = start_ + num_words;
   }
 
   ~Bitmap() {
-    delete[] start_;
+    FreeArray(start_);
   }
 
   void reset() {
-    std::fill(start_, end_, 0);
+    #pragma omp parallel for
+    for (uint64_t *word=start_; word < end_; word++)
+      *word = 0;
+  }
+
+  // Zeroes the words containing bits [begin, end), so bits sharing those
+  // words (outside the range) are cleared too
+  void reset_words(size_t begin, size_t end) {
+    if (begin < end)
+      std::fill(start_ + word_offset(begin), start_ + word_offset(end-1) + 1,
+                0);
   }
 
   void set_bit(size_t pos) {
@@ -10,13 +10,18 @@
 #include <functional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "alloc.h"
 #include "command_line.h"
+#include "compressed_graph.h"
 #include "generator.h"
 #include "graph.h"
+#include "parallel_sort.h"
 #include "platform_atomics.h"
 #include "pvector.h"
 #include "reader.h"
+#include "reorder.h"
 #include "timer.h"
 #include "util.h"
 
@@ -31,6 +36,14 @@ Given arguments from the command line (cli), returns a built graph
    MakeGraphFromEL(edgelist) to perform the actual graph construction
  - edgelist can be from file (Reader) or synthetically generated (Generator)
  - Common case: BuilderBase typedef'd (w/ params) to be Builder (benchmark.h)
+ - MakeCompressedGraph() instead returns a CompressedGraph (read from .csg)
+ - MakeSplitGraph() instead returns a SplitWGraph (weights apart, -W), read
+   from .swsg or split from the built weighted graph, and unweighted kernels
+   read just the topology of a .swsg
+ - Both first apply the NUMA (-N) and huge page (-H) policies so they cover
+   graph building too
+ - MakeGraph() relabels the built graph if a vertex order is given (-O), and
+   any permutation can be applied with Relabel(g, new_ids)
 */
 
 
@@ -58,10 +71,11 @@ class BuilderBase {
     }
   }
 
-  DestID_ GetSource(EdgePair<NodeID_, NodeID_> e) {
+  static DestID_ GetSource(EdgePair<NodeID_, NodeID_> e) {
     return e.u;
   }
 
+  static
   DestID_ GetSource(EdgePair<NodeID_, NodeWeight<NodeID_, WeightT_>> e) {
     return NodeWeight<NodeID_, WeightT_>(e.u, e.v.w);
   }
@@ -138,49 +152,75 @@ class BuilderBase {
 
   // Removes self-loops and redundant edges
   // Side effect: neighbor IDs will be sorted
-  void SquishCSR(const CSRGraph<NodeID_, DestID_, invert> &g, bool transpose,
-                 DestID_*** sq_index, DestID_** sq_neighs) {
-    pvector<NodeID_> diffs(g.num_nodes());
-    DestID_ *n_start, *n_end;
-    #pragma omp parallel for private(n_start, n_end)
-    for (NodeID_ n=0; n < g.num_nodes(); n++) {
-      if (transpose) {
-        n_start = g.in_neigh(n).begin();
-        n_end = g.in_neigh(n).end();
-      } else {
-        n_start = g.out_neigh(n).begin();
-        n_end = g.out_neigh(n).end();
-      }
-      std::sort(n_start, n_end);
+  // Sorts each neighborhood and removes duplicates & self-loops from it, where
+  // neigh(n) gives the [begin, end) of n's and lengths[n] gets its new length
+  // - Neighborhoods bigger than kParallelSortMin are set aside and then each
+  //   sorted by all threads (ParallelSort), so a hub doesn't hold up one thread
+  template <typename RangeT_, typename LengthT_>
+  static void SquishNeighborhoods(int64_t num_nodes, RangeT_ neigh,
+                                  LengthT_ *lengths) {
+    const int64_t kParallelSortMin = 1 << 16;
+    auto squish = [&](NodeID_ n, DestID_ *n_start, DestID_ *n_end) {
       DestID_ *new_end = std::unique(n_start, n_end);
       new_end = std::remove(n_start, new_end, n);
-      diffs[n] = new_end - n_start;
+      lengths[n] = new_end - n_start;
+    };
+    std::vector<NodeID_> heavy;
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (NodeID_ n=0; n < num_nodes; n++) {
+      std::pair<DestID_*, DestID_*> range = neigh(n);
+      if (range.second - range.first > kParallelSortMin) {
+        #pragma omp critical
+        heavy.push_back(n);
+      } else {
+        std::sort(range.first, range.second);
+        squish(n, range.first, range.second);
+      }
+    }
+    for (NodeID_ n : heavy) {
+      std::pair<DestID_*, DestID_*> range = neigh(n);
+      ParallelSort(range.first, range.second);
+      squish(n, range.first, range.second);
     }
-    pvector<SGOffset> sq_offsets = ParallelPrefixSum(diffs);
-    *sq_neighs = new DestID_[sq_offsets[g.num_nodes()]];
-    *sq_index = CSRGraph<NodeID_, DestID_>::GenIndex(sq_offsets, *sq_neighs);
+  }
+
+  void SquishCSR(const CSRGraph<NodeID_, DestID_, invert> &g, bool transpose,
+                 SGOffset** sq_offsets, DestID_** sq_neighs) {
+    pvector<NodeID_> diffs(g.num_nodes());
+    DestID_ *n_start;
+    SquishNeighborhoods(g.num_nodes(),
+                        [&](NodeID_ n) -> std::pair<DestID_*, DestID_*> {
+      if (transpose)
+        return std::make_pair(g.in_neigh(n).begin(), g.in_neigh(n).end());
+      else
+        return std::make_pair(g.out_neigh(n).begin(), g.out_neigh(n).end());
+    }, diffs.data());
+    pvector<SGOffset> offsets = ParallelPrefixSum(diffs);
+    *sq_neighs = AllocArray<DestID_>(offsets[g.num_nodes()]);
+    *sq_offsets = CSRGraph<NodeID_, DestID_>::CopyOffsets(offsets);
     #pragma omp parallel for private(n_start)
     for (NodeID_ n=0; n < g.num_nodes(); n++) {
       if (transpose)
         n_start = g.in_neigh(n).begin();
       else
         n_start = g.out_neigh(n).begin();
-      std::copy(n_start, n_start+diffs[n], (*sq_index)[n]);
+      std::copy(n_start, n_start+diffs[n], *sq_neighs + offsets[n]);
     }
   }
 
   CSRGraph<NodeID_, DestID_, invert> SquishGraph(
       const CSRGraph<NodeID_, DestID_, invert> &g) {
-    DestID_ **out_index, *out_neighs, **in_index, *in_neighs;
-    SquishCSR(g, false, &out_index, &out_neighs);
+    SGOffset *out_offsets, *in_offsets = nullptr;
+    DestID_ *out_neighs, *in_neighs = nullptr;
+    SquishCSR(g, false, &out_offsets, &out_neighs);
     if (g.directed()) {
       if (invert)
-        SquishCSR(g, true, &in_index, &in_neighs);
-      return CSRGraph<NodeID_, DestID_, invert>(g.num_nodes(), out_index,
-                                                out_neighs, in_index,
+        SquishCSR(g, true, &in_offsets, &in_neighs);
+      return CSRGraph<NodeID_, DestID_, invert>(g.num_nodes(), out_offsets,
+                                                out_neighs, in_offsets,
                                                 in_neighs);
     } else {
-      return CSRGraph<NodeID_, DestID_, invert>(g.num_nodes(), out_index,
+      return CSRGraph<NodeID_, DestID_, invert>(g.num_nodes(), out_offsets,
                                                 out_neighs);
     }
   }
@@ -194,10 +234,10 @@ class BuilderBase {
     - if being symmetrized
       - search for needed inverses, make room for them, add them in place
   */
-  void MakeCSRInPlace(EdgeList &el, DestID_*** index, DestID_** neighs,
-                      DestID_*** inv_index, DestID_** inv_neighs) {
+  void MakeCSRInPlace(EdgeList &el, SGOffset** final_offsets, DestID_** neighs,
+                      SGOffset** inv_offsets, DestID_** inv_neighs) {
     // preprocess EdgeList - sort & squish in place
-    std::sort(el.begin(), el.end());
+    ParallelSort(el.begin(), el.end());
     auto new_end = std::unique(el.begin(), el.end());
     el.resize(new_end - el.begin());
     auto self_loop = [](Edge e){ return e.u == e.v; };
@@ -216,16 +256,15 @@ class BuilderBase {
     for (NodeID_ n = num_nodes_; n >= 0; n--)
       offsets[n] = n != 0 ? offsets[n-1] : 0;
     if (!symmetrize_) {   // not going to symmetrize so no need to add edges
-      size_t new_size = num_edges * sizeof(DestID_);
-      *neighs = static_cast<DestID_*>(std::realloc(*neighs, new_size));
-      *index = CSRGraph<NodeID_, DestID_>::GenIndex(offsets, *neighs);
-      if (invert) {       // create inv_neighs & inv_index for incoming edges
+      *neighs = ResizeArray(*neighs, num_edges);
+      *final_offsets = CSRGraph<NodeID_, DestID_>::CopyOffsets(offsets);
+      if (invert) {       // create inv_neighs & inv_offsets for incoming edges
         pvector<SGOffset> inoffsets = ParallelPrefixSum(indegrees);
-        *inv_neighs = new DestID_[inoffsets[num_nodes_]];
-        *inv_index = CSRGraph<NodeID_, DestID_>::GenIndex(inoffsets,
-                                                          *inv_neighs);
+        *inv_neighs = AllocArray<DestID_>(inoffsets[num_nodes_]);
+        *inv_offsets = CSRGraph<NodeID_, DestID_>::CopyOffsets(inoffsets);
         for (NodeID_ u = 0; u < num_nodes_; u++) {
-          for (DestID_* it = (*index)[u]; it < (*index)[u+1]; it++) {
+          for (DestID_* it = *neighs + offsets[u];
+               it < *neighs + offsets[u+1]; it++) {
             NodeID_ v = static_cast<NodeID_>(*it);
             (*inv_neighs)[inoffsets[v]] = u;
             inoffsets[v]++;
@@ -252,12 +291,7 @@ class BuilderBase {
         total_missing_inv += invs_needed[n];
       }
       offsets[num_nodes_] += total_missing_inv;
-      size_t newsize = (offsets[num_nodes_] * sizeof(DestID_));
-      *neighs = static_cast<DestID_*>(std::realloc(*neighs, newsize));
-      if (*neighs == nullptr) {
-        std::cout << "Call to realloc() failed" << std::endl;
-        exit(-33);
-      }
+      *neighs = ResizeArray(*neighs, offsets[num_nodes_]);
       // Step 2 - spread out existing neighs to make room for inverses
       //   copies backwards (overwrites) and inserts free space at starts
       SGOffset tail_index = offsets[num_nodes_] - 1;
@@ -286,7 +320,7 @@ class BuilderBase {
       }
       for (NodeID_ n = 0; n < num_nodes_; n++)
         std::sort(*neighs + offsets[n], *neighs + offsets[n+1]);
-      *index = CSRGraph<NodeID_, DestID_>::GenIndex(offsets, *neighs);
+      *final_offsets = CSRGraph<NodeID_, DestID_>::CopyOffsets(offsets);
     }
   }
 
@@ -294,15 +328,15 @@ class BuilderBase {
   Graph Building Steps (for CSR):
     - Read edgelist once to determine vertex degrees (CountDegrees)
     - Determine vertex offsets by a prefix sum (ParallelPrefixSum)
-    - Allocate storage and set points according to offsets (GenIndex)
+    - Allocate storage and keep a copy of offsets to index it (CopyOffsets)
     - Copy edges into storage
   */
-  void MakeCSR(const EdgeList &el, bool transpose, DestID_*** index,
+  void MakeCSR(const EdgeList &el, bool transpose, SGOffset** final_offsets,
                DestID_** neighs) {
     pvector<NodeID_> degrees = CountDegrees(el, transpose);
     pvector<SGOffset> offsets = ParallelPrefixSum(degrees);
-    *neighs = new DestID_[offsets[num_nodes_]];
-    *index = CSRGraph<NodeID_, DestID_>::GenIndex(offsets, *neighs);
+    *neighs = AllocArray<DestID_>(offsets[num_nodes_]);
+    *final_offsets = CSRGraph<NodeID_, DestID_>::CopyOffsets(offsets);
     #pragma omp parallel for
     for (auto it = el.begin(); it < el.end(); it++) {
       Edge e = *it;
@@ -315,7 +349,7 @@ class BuilderBase {
   }
 
   CSRGraph<NodeID_, DestID_, invert> MakeGraphFromEL(EdgeList &el) {
-    DestID_ **index = nullptr, **inv_index = nullptr;
+    SGOffset *offsets = nullptr, *inv_offsets = nullptr;
     DestID_ *neighs = nullptr, *inv_neighs = nullptr;
     Timer t;
     t.Start();
@@ -324,35 +358,86 @@ class BuilderBase {
     if (needs_weights_)
       Generator<NodeID_, DestID_, WeightT_>::InsertWeights(el);
     if (in_place_) {
-      MakeCSRInPlace(el, &index, &neighs, &inv_index, &inv_neighs);
+      MakeCSRInPlace(el, &offsets, &neighs, &inv_offsets, &inv_neighs);
     } else {
-      MakeCSR(el, false, &index, &neighs);
+      MakeCSR(el, false, &offsets, &neighs);
       if (!symmetrize_ && invert) {
-        MakeCSR(el, true, &inv_index, &inv_neighs);
+        MakeCSR(el, true, &inv_offsets, &inv_neighs);
       }
     }
     t.Stop();
     PrintTime("Build Time", t.Seconds());
     if (symmetrize_)
-      return CSRGraph<NodeID_, DestID_, invert>(num_nodes_, index, neighs);
+      return CSRGraph<NodeID_, DestID_, invert>(num_nodes_, offsets, neighs);
     else
-      return CSRGraph<NodeID_, DestID_, invert>(num_nodes_, index, neighs,
-                                                inv_index, inv_neighs);
+      return CSRGraph<NodeID_, DestID_, invert>(num_nodes_, offsets, neighs,
+                                                inv_offsets, inv_neighs);
+  }
+
+  // Streams generated edges twice, to count degrees and then to place them,
+  // so the edgelist is never held in memory (synthetic graphs are undirected)
+  CSRGraph<NodeID_, DestID_, invert> MakeGraphFromGenerator(
+      Generator<NodeID_, DestID_, WeightT_> &gen, bool uniform) {
+    Timer t;
+    t.Start();
+    num_nodes_ = gen.num_nodes();
+    pvector<NodeID_> degrees(num_nodes_, 0);
+    gen.StreamEL(uniform, [&](int64_t block, EdgeList &el) {
+      for (Edge e : el) {
+        fetch_and_add(degrees[e.u], 1);
+        fetch_and_add(degrees[static_cast<NodeID_>(e.v)], 1);
+      }
+    });
+    pvector<SGOffset> offsets = ParallelPrefixSum(degrees);
+    DestID_ *neighs = AllocArray<DestID_>(offsets[num_nodes_]);
+    SGOffset *final_offsets = CSRGraph<NodeID_, DestID_>::CopyOffsets(offsets);
+    gen.StreamEL(uniform, [&](int64_t block, EdgeList &el) {
+      for (Edge e : el) {
+        neighs[fetch_and_add(offsets[e.u], 1)] = e.v;
+        neighs[fetch_and_add(offsets[static_cast<NodeID_>(e.v)], 1)] =
+            GetSource(e);
+      }
+    });
+    t.Stop();
+    PrintTime("Generate & Build Time", t.Seconds());
+    return CSRGraph<NodeID_, DestID_, invert>(num_nodes_, final_offsets,
+                                              neighs);
   }
 
   CSRGraph<NodeID_, DestID_, invert> MakeGraph() {
+    NumaSetup(cli_.numa_policy());
+    SetPagePolicy(cli_.page_policy());
+    CSRGraph<NodeID_, DestID_, invert> g = BuildGraph();
+    if (cli_.vertex_order() != "")
+      g = Reorder(g, cli_.vertex_order());
+    if (NumaPartitioned())
+      g.PartitionNuma();
+    return g;
+  }
+
+  CSRGraph<NodeID_, DestID_, invert> BuildGraph() {
     CSRGraph<NodeID_, DestID_, invert> g;
     {  // extra scope to trigger earlier deletion of el (save memory)
       EdgeList el;
       if (cli_.filename() != "") {
         Reader<NodeID_, DestID_, WeightT_, invert> r(cli_.filename());
         if ((r.GetSuffix() == ".sg") || (r.GetSuffix() == ".wsg")) {
-          return r.ReadSerializedGraph();
+          return r.ReadSerializedGraph(cli_.use_mmap());
+        } else if (r.GetSuffix() == ".swsg") {
+          return ReadSplitTopology(std::is_same<NodeID_, DestID_>());
+        } else if (r.GetSuffix() == ".csg") {
+          std::cout << "Compressed graph (.csg) not supported by this kernel"
+                    << std::endl;
+          std::exit(-32);
         } else {
           el = r.ReadFile(needs_weights_);
         }
       } else if (cli_.scale() != -1) {
-        Generator<NodeID_, DestID_> gen(cli_.scale(), cli_.degree());
+        Generator<NodeID_, DestID_, WeightT_> gen(cli_.scale(), cli_.degree(),
+                                                  cli_.fast_generator());
+        // fast generator is cheap enough to run twice instead of holding el
+        if (cli_.fast_generator() && !in_place_)
+          return SquishGraph(MakeGraphFromGenerator(gen, cli_.uniform()));
         el = gen.GenerateEL(cli_.uniform());
       }
       g = MakeGraphFromEL(el);
@@ -363,6 +448,130 @@ class BuilderBase {
       return SquishGraph(g);
   }
 
+  bool InputHasSuffix(const std::string &suffix) const {
+    std::string filename = cli_.filename();
+    return (filename.size() >= suffix.size()) &&
+           (filename.compare(filename.size() - suffix.size(), suffix.size(),
+                             suffix) == 0);
+  }
+
+  // True if input is a compressed graph (.csg), so use MakeCompressedGraph()
+  bool compressed_input() const {
+    return InputHasSuffix(".csg");
+  }
+
+  // Bits per weight for MakeSplitGraph (from .swsg or -W), 0 if not split
+  int split_weight_bits() const {
+    int bits = cli_.split_weight_bits();
+    if (InputHasSuffix(".swsg")) {
+      Reader<NodeID_, NodeID_, WeightT_, invert> r(cli_.filename());
+      bits = r.SplitWeightBits();
+    }
+    if ((bits != 0) && (bits != 8) && (bits != 16) && (bits != 32)) {
+      std::cout << "Split weights (-W) must be 8, 16, or 32 bits" << std::endl;
+      std::exit(-45);
+    }
+    return bits;
+  }
+
+  template <typename StoreT_>
+  SplitWGraph<NodeID_, WeightT_, StoreT_, invert> MakeSplitGraph() {
+    static_assert(!std::is_same<NodeID_, DestID_>::value,
+                  "Split graphs are built by a weighted builder");
+    if (InputHasSuffix(".swsg")) {
+      NumaSetup(cli_.numa_policy());
+      SetPagePolicy(cli_.page_policy());
+      Reader<NodeID_, NodeID_, WeightT_, invert> r(cli_.filename());
+      return r.template ReadSplitGraph<StoreT_>(cli_.use_mmap());
+    }
+    CSRGraph<NodeID_, DestID_, invert> g = MakeGraph();
+    Timer t;
+    t.Start();
+    SplitWGraph<NodeID_, WeightT_, StoreT_, invert> sg(g);
+    t.Stop();
+    PrintTime("Split Time", t.Seconds());
+    return sg;
+  }
+
+  CompressedGraph<NodeID_, invert> MakeCompressedGraph() {
+    NumaSetup(cli_.numa_policy());
+    SetPagePolicy(cli_.page_policy());
+    Reader<NodeID_, DestID_, WeightT_, invert> r(cli_.filename());
+    return r.ReadCompressedGraph(cli_.use_mmap());
+  }
+
+  // Topology of a .swsg, only for unweighted graphs
+  CSRGraph<NodeID_, DestID_, invert> ReadSplitTopology(std::true_type) {
+    Reader<NodeID_, NodeID_, WeightT_, invert> r(cli_.filename());
+    return r.ReadSplitTopology(cli_.use_mmap());
+  }
+
+  CSRGraph<NodeID_, DestID_, invert> ReadSplitTopology(std::false_type) {
+    std::cout << "Split weighted graph (.swsg) needs split weights (-W)"
+              << std::endl;
+    std::exit(-32);
+  }
+
+  static NodeID_ RelabelDest(NodeID_ v, const pvector<NodeID_> &new_ids) {
+    return new_ids[v];
+  }
+
+  static NodeWeight<NodeID_, WeightT_> RelabelDest(
+      NodeWeight<NodeID_, WeightT_> nw, const pvector<NodeID_> &new_ids) {
+    return NodeWeight<NodeID_, WeightT_>(new_ids[nw.v], nw.w);
+  }
+
+  static void RelabelCSR(const CSRGraph<NodeID_, DestID_, invert> &g,
+                         const pvector<NodeID_> &new_ids, bool transpose,
+                         SGOffset** final_offsets, DestID_** neighs) {
+    pvector<NodeID_> degrees(g.num_nodes());
+    #pragma omp parallel for
+    for (NodeID_ n=0; n < g.num_nodes(); n++)
+      degrees[new_ids[n]] = transpose ? g.in_degree(n) : g.out_degree(n);
+    pvector<SGOffset> offsets = ParallelPrefixSum(degrees);
+    *neighs = AllocArray<DestID_>(offsets[g.num_nodes()]);
+    *final_offsets = CSRGraph<NodeID_, DestID_>::CopyOffsets(offsets);
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (NodeID_ u=0; u < g.num_nodes(); u++) {
+      NodeID_ new_u = new_ids[u];
+      DestID_ *n_start = transpose ? g.in_neigh(u).begin() :
+                                     g.out_neigh(u).begin();
+      DestID_ *n_end = transpose ? g.in_neigh(u).end() : g.out_neigh(u).end();
+      for (DestID_ *it = n_start; it < n_end; it++)
+        (*neighs)[offsets[new_u]++] = RelabelDest(*it, new_ids);
+      std::sort(*neighs + (*final_offsets)[new_u],
+                *neighs + (*final_offsets)[new_u+1]);
+    }
+  }
+
+  // Rebuilds graph with vertex n renamed to new_ids[n], and remembers the
+  //   IDs before relabeling (composed with any earlier relabeling)
+  static
+  CSRGraph<NodeID_, DestID_, invert> Relabel(
+      const CSRGraph<NodeID_, DestID_, invert> &g,
+      const pvector<NodeID_> &new_ids) {
+    SGOffset *out_offsets, *in_offsets = nullptr;
+    DestID_ *out_neighs, *in_neighs = nullptr;
+    RelabelCSR(g, new_ids, false, &out_offsets, &out_neighs);
+    CSRGraph<NodeID_, DestID_, invert> relabeled;
+    if (g.directed()) {
+      if (invert)
+        RelabelCSR(g, new_ids, true, &in_offsets, &in_neighs);
+      relabeled = CSRGraph<NodeID_, DestID_, invert>(
+                      g.num_nodes(), out_offsets, out_neighs, in_offsets,
+                      in_neighs);
+    } else {
+      relabeled = CSRGraph<NodeID_, DestID_, invert>(g.num_nodes(),
+                                                     out_offsets, out_neighs);
+    }
+    NodeID_ *original_ids = AllocArray<NodeID_>(g.num_nodes());
+    #pragma omp parallel for
+    for (NodeID_ n=0; n < g.num_nodes(); n++)
+      original_ids[new_ids[n]] = g.original_id(n);
+    relabeled.SetOriginalIDs(original_ids);
+    return relabeled;
+  }
+
   // Relabels (and rebuilds) graph by order of decreasing degree
   static
   CSRGraph<NodeID_, DestID_, invert> RelabelByDegree(
@@ -373,32 +582,23 @@ class BuilderBase {
     }
     Timer t;
     t.Start();
-    typedef std::pair<int64_t, NodeID_> degree_node_p;
-    pvector<degree_node_p> degree_id_pairs(g.num_nodes());
-    #pragma omp parallel for
-    for (NodeID_ n=0; n < g.num_nodes(); n++)
-      degree_id_pairs[n] = std::make_pair(g.out_degree(n), n);
-    std::sort(degree_id_pairs.begin(), degree_id_pairs.end(),
-              std::greater<degree_node_p>());
-    pvector<NodeID_> degrees(g.num_nodes());
-    pvector<NodeID_> new_ids(g.num_nodes());
-    #pragma omp parallel for
-    for (NodeID_ n=0; n < g.num_nodes(); n++) {
-      degrees[n] = degree_id_pairs[n].first;
-      new_ids[degree_id_pairs[n].second] = n;
-    }
-    pvector<SGOffset> offsets = ParallelPrefixSum(degrees);
-    DestID_* neighs = new DestID_[offsets[g.num_nodes()]];
-    DestID_** index = CSRGraph<NodeID_, DestID_>::GenIndex(offsets, neighs);
-    #pragma omp parallel for
-    for (NodeID_ u=0; u < g.num_nodes(); u++) {
-      for (NodeID_ v : g.out_neigh(u))
-        neighs[offsets[new_ids[u]]++] = new_ids[v];
-      std::sort(index[new_ids[u]], index[new_ids[u]+1]);
-    }
+    CSRGraph<NodeID_, DestID_, invert> relabeled = Relabel(g, DegreeOrder(g));
     t.Stop();
     PrintTime("Relabel", t.Seconds());
-    return CSRGraph<NodeID_, DestID_, invert>(g.num_nodes(), index, neighs);
+    return relabeled;
+  }
+
+  // Relabels graph by named vertex order (see reorder.h)
+  static
+  CSRGraph<NodeID_, DestID_, invert> Reorder(
+      const CSRGraph<NodeID_, DestID_, invert> &g, const std::string &order) {
+    Timer t;
+    t.Start();
+    CSRGraph<NodeID_, DestID_, invert> reordered =
+        Relabel(g, ComputeOrder(g, order));
+    t.Stop();
+    PrintTime("Reorder Time", t.Seconds());
+    return reordered;
   }
 };
 
@@ -5,12 +5,14 @@
 #include <cinttypes>
 #include <iostream>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "benchmark.h"
 #include "bitmap.h"
 #include "builder.h"
 #include "command_line.h"
+#include "counters.h"
 #include "graph.h"
 #include "pvector.h"
 
@@ -23,7 +25,11 @@ Authors: Michael Sutton, Scott Beamer
 Will return comp array labelling each vertex with a connected component ID
 
 This CC implementation makes use of the Afforest subgraph sampling algorithm [1],
-which restructures and extends the Shiloach-Vishkin algorithm [2].
+which restructures and extends the Shiloach-Vishkin algorithm [2]. The kernel
+also runs on compressed graphs (.csg). Vertex loops are schedule(runtime), see
+numa.h for how that is set. After edges are only inserted into a dynamic graph
+(e.g. by the server), components can be updated from the previous ones by just
+linking the new edges (AfforestInsert with CCHistory).
 
 [1] Michael Sutton, Tal Ben-Nun, and Amnon Barak. "Optimizing Parallel 
     Graph Connectivity Computation via Subgraph Sampling" Symposium on 
@@ -56,8 +62,9 @@ void Link(NodeID u, NodeID v, pvector<NodeID>& comp) {
 
 
 // Reduce depth of tree for each component to 1 by crawling up parents
-void Compress(const Graph &g, pvector<NodeID>& comp) {
-  #pragma omp parallel for schedule(dynamic, 16384)
+template <typename GraphT_>
+void Compress(const GraphT_ &g, pvector<NodeID>& comp) {
+  #pragma omp parallel for schedule(runtime)
   for (NodeID n = 0; n < g.num_nodes(); n++) {
     while (comp[n] != comp[comp[n]]) {
       comp[n] = comp[comp[n]];
@@ -92,7 +99,8 @@ NodeID SampleFrequentElement(const pvector<NodeID>& comp,
 }
 
 
-pvector<NodeID> Afforest(const Graph &g, bool logging_enabled = false,
+template <typename GraphT_>
+pvector<NodeID> Afforest(const GraphT_ &g, bool logging_enabled = false,
                          int32_t neighbor_rounds = 2) {
   pvector<NodeID> comp(g.num_nodes());
 
@@ -103,8 +111,9 @@ pvector<NodeID> Afforest(const Graph &g, bool logging_enabled = false,
 
   // Process a sparse sampled subgraph first for approximating components.
   // Sample by processing a fixed number of neighbors for each node (see paper)
+  PerfCounters::Get().Begin("sample");
   for (int r = 0; r < neighbor_rounds; ++r) {
-  #pragma omp parallel for schedule(dynamic,16384)
+  #pragma omp parallel for schedule(runtime)
     for (NodeID u = 0; u < g.num_nodes(); u++) {
       for (NodeID v : g.out_neigh(u, r)) {
         // Link at most one time if neighbor available at offset r
@@ -114,14 +123,16 @@ pvector<NodeID> Afforest(const Graph &g, bool logging_enabled = false,
     }
     Compress(g, comp);
   }
+  PerfCounters::Get().End("sample");
 
   // Sample 'comp' to find the most frequent element -- due to prior
   // compression, this value represents the largest intermediate component
   NodeID c = SampleFrequentElement(comp, logging_enabled);
 
   // Final 'link' phase over remaining edges (excluding the largest component)
+  PerfCounters::Get().Begin("link");
   if (!g.directed()) {
-    #pragma omp parallel for schedule(dynamic, 16384)
+    #pragma omp parallel for schedule(runtime)
     for (NodeID u = 0; u < g.num_nodes(); u++) {
       // Skip processing nodes in the largest component
       if (comp[u] == c)
@@ -132,7 +143,7 @@ pvector<NodeID> Afforest(const Graph &g, bool logging_enabled = false,
       }
     }
   } else {
-    #pragma omp parallel for schedule(dynamic, 16384)
+    #pragma omp parallel for schedule(runtime)
     for (NodeID u = 0; u < g.num_nodes(); u++) {
       if (comp[u] == c)
         continue;
@@ -145,13 +156,56 @@ pvector<NodeID> Afforest(const Graph &g, bool logging_enabled = false,
       }
     }
   }
+  PerfCounters::Get().End("link");
   // Finally, 'compress' for final convergence
+  PerfCounters::Get().Begin("compress");
   Compress(g, comp);
+  PerfCounters::Get().End("compress");
   return comp;
 }
 
 
-void PrintCompStats(const Graph &g, const pvector<NodeID> &comp) {
+// Components after inserting new_edges into a graph whose components were
+// prev_comp (from Afforest), since linking only the new edges suffices
+template <typename GraphT_>
+pvector<NodeID> AfforestInsert(const GraphT_ &g,
+                               const pvector<NodeID> &prev_comp,
+                               const std::vector<EdgePair<NodeID>> &new_edges) {
+  pvector<NodeID> comp(g.num_nodes());
+  #pragma omp parallel for
+  for (NodeID n = 0; n < g.num_nodes(); n++)
+    comp[n] = prev_comp[n];
+  #pragma omp parallel for schedule(dynamic, 1024)
+  for (size_t i = 0; i < new_edges.size(); i++)
+    Link(new_edges[i].u, new_edges[i].v, comp);
+  Compress(g, comp);
+  return comp;
+}
+
+
+// Components as of the previous run and the edges inserted since then,
+// kept across runs (by the server) so they can be updated incrementally
+struct CCHistory {
+  pvector<NodeID> comp;
+  std::vector<EdgePair<NodeID>> inserted;
+  bool valid = false;
+
+  // Without valid components the next run is from scratch, so nothing to keep
+  void Insert(const pvector<EdgePair<NodeID>> &edges) {
+    if (valid)
+      inserted.insert(inserted.end(), edges.begin(), edges.end());
+  }
+
+  // Deleting edges can split components, so they must be found from scratch
+  void Invalidate() {
+    valid = false;
+    inserted.clear();
+  }
+};
+
+
+template <typename GraphT_>
+void PrintCompStats(const GraphT_ &g, const pvector<NodeID> &comp) {
   cout << endl;
   unordered_map<NodeID, NodeID> count;
   for (NodeID comp_i : comp)
@@ -174,7 +228,8 @@ void PrintCompStats(const Graph &g, const pvector<NodeID> &comp) {
 // - Asserts search does not reach a vertex with a different component label
 // - If the graph is directed, it performs the search as if it was undirected
 // - Asserts every vertex is visited (degree-0 vertex should have own label)
-bool CCVerifier(const Graph &g, const pvector<NodeID> &comp) {
+template <typename GraphT_>
+bool CCVerifier(const GraphT_ &g, const pvector<NodeID> &comp) {
   unordered_map<NodeID, NodeID> label_to_source;
   for (NodeID n : g.vertices())
     label_to_source[comp[n]] = n;
@@ -217,13 +272,52 @@ bool CCVerifier(const Graph &g, const pvector<NodeID> &comp) {
 }
 
 
+template <typename GraphT_>
+void BenchmarkCC(const CLApp &cli, const GraphT_ &g) {
+  auto CCBound = [&cli](const GraphT_& gr){
+    return Afforest(gr, cli.logging_en());
+  };
+  BenchmarkKernel(cli, g, CCBound, PrintCompStats<GraphT_>,
+                  CCVerifier<GraphT_>);
+}
+
+
+// Runs incrementally if edges were only inserted since history was recorded,
+// and then records the new components in history
+template <typename GraphT_>
+void BenchmarkCC(const CLApp &cli, const GraphT_ &g, CCHistory &history) {
+  bool incremental = history.valid && !history.inserted.empty();
+  pvector<NodeID> latest;
+  auto CCBound = [&](const GraphT_& gr){
+    pvector<NodeID> comp = incremental ?
+        AfforestInsert(gr, history.comp, history.inserted) :
+        Afforest(gr, cli.logging_en());
+    latest = pvector<NodeID>(comp.begin(), comp.end());
+    return comp;
+  };
+  BenchmarkKernel(cli, g, CCBound, PrintCompStats<GraphT_>,
+                  CCVerifier<GraphT_>);
+  if (latest.size() == static_cast<size_t>(g.num_nodes())) {
+    history.comp = std::move(latest);
+    history.inserted.clear();
+    history.valid = true;
+  }
+}
+
+
+#ifndef NO_MAIN
 int main(int argc, char* argv[]) {
   CLApp cli(argc, argv, "connected-components-afforest");
   if (!cli.ParseArgs())
     return -1;
   Builder b(cli);
-  Graph g = b.MakeGraph();
-  auto CCBound = [&cli](const Graph& gr){ return Afforest(gr, cli.logging_en()); };
-  BenchmarkKernel(cli, g, CCBound, PrintCompStats, CCVerifier);
+  if (b.compressed_input()) {
+    CGraph g = b.MakeCompressedGraph();
+    BenchmarkCC(cli, g);
+  } else {
+    Graph g = b.MakeGraph();
+    BenchmarkCC(cli, g);
+  }
   return 0;
 }
+#endif
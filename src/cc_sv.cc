@@ -12,6 +12,7 @@
 #include "builder.h"
 #include "command_line.h"
 #include "graph.h"
+#include "partition.h"
 #include "pvector.h"
 
 
@@ -56,8 +57,7 @@ pvector<NodeID> ShiloachVishkin(const Graph &g) {
   while (change) {
     change = false;
     num_iter++;
-    #pragma omp parallel for
-    for (NodeID u=0; u < g.num_nodes(); u++) {
+    ParallelForVertices(g.VertexBlocks(), [&](NodeID u) {
       for (NodeID v : g.out_neigh(u)) {
         NodeID comp_u = comp[u];
         NodeID comp_v = comp[v];
@@ -70,7 +70,7 @@ pvector<NodeID> ShiloachVishkin(const Graph &g) {
           comp[high_comp] = low_comp;
         }
       }
-    }
+    });
     #pragma omp parallel for
     for (NodeID n=0; n < g.num_nodes(); n++) {
       while (comp[n] != comp[comp[n]]) {
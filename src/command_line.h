@@ -13,6 +13,9 @@
 #include <type_traits>
 #include <vector>
 
+#include "counters.h"
+#include "report.h"
+
 
 /*
 GAP Benchmark Suite
@@ -30,7 +33,7 @@ class CLBase {
   int argc_;
   char** argv_;
   std::string name_;
-  std::string get_args_ = "f:g:hk:su:m";
+  std::string get_args_ = "f:g:hk:su:qmMN:H:O:";
   std::vector<std::string> help_strings_;
 
   int scale_ = -1;
@@ -38,7 +41,13 @@ class CLBase {
   std::string filename_ = "";
   bool symmetrize_ = false;
   bool uniform_ = false;
+  bool fast_generator_ = false;
   bool in_place_ = false;
+  bool use_mmap_ = false;
+  std::string numa_policy_ = "";
+  std::string page_policy_ = "";
+  std::string vertex_order_ = "";
+  int split_weight_bits_ = 0;
 
   void AddHelpLine(char opt, std::string opt_arg, std::string text,
                    std::string def = "") {
@@ -53,6 +62,13 @@ class CLBase {
     help_strings_.push_back(buf);
   }
 
+  // Only for the kernel (sssp) & converter that can split weights (-W)
+  void AddSplitWeightsArg() {
+    get_args_ += "W:";
+    AddHelpLine('W', "bits",
+                "weights apart from neighbors in 8, 16, or 32 bits");
+  }
+
  public:
   CLBase(int argc, char** argv, std::string name = "") :
          argc_(argc), argv_(argv), name_(name) {
@@ -63,16 +79,24 @@ class CLBase {
     AddHelpLine('u', "scale", "generate 2^scale uniform-random graph");
     AddHelpLine('k', "degree", "average degree for synthetic graph",
                 std::to_string(degree_));
+    AddHelpLine('q', "", "faster generator (but a different graph)", "false");
     AddHelpLine('m', "", "reduces memory usage during graph building", "false");
+    AddHelpLine('M', "", "memory-map serialized graph instead of reading it",
+                "false");
+    AddHelpLine('N', "policy", "NUMA placement: interleave or partition");
+    AddHelpLine('H', "pages", "huge pages for large arrays: thp, 2M, or 1G");
+    AddHelpLine('O', "order",
+                "relabel by: degree, hubsort, hubcluster, rcm, gorder");
   }
 
-  bool ParseArgs() {
+  // Graph input can be optional if the graph is already loaded (server)
+  bool ParseArgs(bool graph_required = true) {
     signed char c_opt;
     extern char *optarg;          // from and for getopt
     while ((c_opt = getopt(argc_, argv_, get_args_.c_str())) != -1) {
       HandleArg(c_opt, optarg);
     }
-    if ((filename_ == "") && (scale_ == -1)) {
+    if (graph_required && (filename_ == "") && (scale_ == -1)) {
       std::cout << "No graph input specified. (Use -h for help)" << std::endl;
       return false;
     }
@@ -89,7 +113,13 @@ class CLBase {
       case 'k': degree_ = atoi(opt_arg);                    break;
       case 's': symmetrize_ = true;                         break;
       case 'u': uniform_ = true; scale_ = atoi(opt_arg);    break;
+      case 'q': fast_generator_ = true;                     break;
       case 'm': in_place_ = true;                           break;
+      case 'M': use_mmap_ = true;                           break;
+      case 'N': numa_policy_ = std::string(opt_arg);        break;
+      case 'H': page_policy_ = std::string(opt_arg);        break;
+      case 'O': vertex_order_ = std::string(opt_arg);       break;
+      case 'W': split_weight_bits_ = atoi(opt_arg);         break;
     }
   }
 
@@ -106,7 +136,16 @@ class CLBase {
   std::string filename() const { return filename_; }
   bool symmetrize() const { return symmetrize_; }
   bool uniform() const { return uniform_; }
+  bool fast_generator() const { return fast_generator_; }
   bool in_place() const { return in_place_; }
+  bool use_mmap() const { return use_mmap_; }
+  std::string numa_policy() const { return numa_policy_; }
+  std::string page_policy() const { return page_policy_; }
+  std::string vertex_order() const { return vertex_order_; }
+  int split_weight_bits() const { return split_weight_bits_; }
+
+  // Same options for another input, e.g. the weighted variant of a graph
+  void set_filename(std::string filename) { filename_ = filename; }
 };
 
 
@@ -117,15 +156,26 @@ class CLApp : public CLBase {
   int64_t start_vertex_ = -1;
   bool do_verify_ = false;
   bool enable_logging_ = false;
+  std::string report_filename_ = "";
+  bool epoch_tagged_ = false;
+  std::vector<int> thread_counts_;
+  int num_warmups_ = 0;
 
  public:
   CLApp(int argc, char** argv, std::string name) : CLBase(argc, argv, name) {
-    get_args_ += "an:r:vl";
+    get_args_ += "an:r:vlj:pET:I:";
     AddHelpLine('a', "", "output analysis of last run", "false");
     AddHelpLine('n', "n", "perform n trials", std::to_string(num_trials_));
     AddHelpLine('r', "node", "start from node r", "rand");
     AddHelpLine('v', "", "verify the output of each run", "false");
     AddHelpLine('l', "", "log performance within each trial", "false");
+    AddHelpLine('j', "file", "also write results to file (.csv or JSON lines)");
+    AddHelpLine('p', "", "count hardware events per trial & region", "false");
+    AddHelpLine('E', "", "epoch-tagged state & sparse output (bfs, bc)",
+                "false");
+    AddHelpLine('T', "list", "sweep trials over thread counts, e.g. 1,2,4,8");
+    AddHelpLine('I', "n", "run n untimed warmup trials (per thread count)",
+                std::to_string(num_warmups_));
   }
 
   void HandleArg(signed char opt, char* opt_arg) override {
@@ -135,6 +185,11 @@ class CLApp : public CLBase {
       case 'r': start_vertex_ = atol(opt_arg);          break;
       case 'v': do_verify_ = true;                      break;
       case 'l': enable_logging_ = true;                 break;
+      case 'j': OpenReport(opt_arg);                    break;
+      case 'p': PerfCounters::Get().Open();             break;
+      case 'E': epoch_tagged_ = true;                   break;
+      case 'T': ParseThreadCounts(opt_arg);             break;
+      case 'I': num_warmups_ = atoi(opt_arg);           break;
       default: CLBase::HandleArg(opt, opt_arg);
     }
   }
@@ -144,6 +199,37 @@ class CLApp : public CLBase {
   int64_t start_vertex() const { return start_vertex_; }
   bool do_verify() const { return do_verify_; }
   bool logging_en() const { return enable_logging_; }
+  std::string report_filename() const { return report_filename_; }
+  bool epoch_tagged() const { return epoch_tagged_; }
+  const std::vector<int>& thread_counts() const { return thread_counts_; }
+  int num_warmups() const { return num_warmups_; }
+
+ private:
+  void ParseThreadCounts(std::string list) {
+    thread_counts_.clear();
+    size_t begin = 0;
+    while (begin <= list.size()) {
+      size_t comma = std::min(list.find(',', begin), list.size());
+      int count = atoi(list.substr(begin, comma - begin).c_str());
+      if (count < 1) {
+        std::cout << "Thread counts (-T) must be positive, e.g. 1,2,4"
+                  << std::endl;
+        std::exit(-46);
+      }
+      thread_counts_.push_back(count);
+      begin = comma + 1;
+    }
+  }
+
+  // Opened while parsing, so graph loading & building times are recorded too
+  void OpenReport(std::string filename) {
+    report_filename_ = filename;
+    std::string kernel = argv_[0];
+    size_t slash = kernel.find_last_of('/');
+    if (slash != std::string::npos)
+      kernel = kernel.substr(slash + 1);
+    Report::Get().Open(filename, kernel);
+  }
 };
 
 
@@ -170,6 +256,29 @@ class CLIterApp : public CLApp {
 
 
 
+class CLBatch : public CLIterApp {
+  int batch_size_ = 1;
+
+ public:
+  CLBatch(int argc, char** argv, std::string name, int num_iters) :
+    CLIterApp(argc, argv, name, num_iters) {
+    get_args_ += "b:";
+    AddHelpLine('b', "k", "run k iterations' sources per traversal (<= 64)",
+                std::to_string(batch_size_));
+  }
+
+  void HandleArg(signed char opt, char* opt_arg) override {
+    switch (opt) {
+      case 'b': batch_size_ = atoi(opt_arg);            break;
+      default: CLIterApp::HandleArg(opt, opt_arg);
+    }
+  }
+
+  int batch_size() const { return batch_size_; }
+};
+
+
+
 class CLPageRank : public CLApp {
   int max_iters_;
   double tolerance_;
@@ -198,19 +307,53 @@ class CLPageRank : public CLApp {
 
 
 
+class CLPageRankWarm : public CLPageRank {
+  std::string scores_in_ = "";
+  std::string scores_out_ = "";
+  bool delta_push_ = false;
+
+ public:
+  CLPageRankWarm(int argc, char** argv, std::string name, double tolerance,
+                 int max_iters) :
+    CLPageRank(argc, argv, name, tolerance, max_iters) {
+    get_args_ += "y:z:e";
+    AddHelpLine('y', "file", "start from scores in file (from -z)", "");
+    AddHelpLine('z', "file", "write scores to file", "");
+    AddHelpLine('e', "", "push only residuals above t/|V| (delta)", "false");
+  }
+
+  void HandleArg(signed char opt, char* opt_arg) override {
+    switch (opt) {
+      case 'y': scores_in_ = std::string(opt_arg);          break;
+      case 'z': scores_out_ = std::string(opt_arg);         break;
+      case 'e': delta_push_ = true;                         break;
+      default: CLPageRank::HandleArg(opt, opt_arg);
+    }
+  }
+
+  std::string scores_in() const { return scores_in_; }
+  std::string scores_out() const { return scores_out_; }
+  bool delta_push() const { return delta_push_; }
+};
+
+
+
 template<typename WeightT_>
 class CLDelta : public CLApp {
   WeightT_ delta_ = 1;
+  bool auto_delta_ = true;
 
  public:
   CLDelta(int argc, char** argv, std::string name) : CLApp(argc, argv, name) {
     get_args_ += "d:";
-    AddHelpLine('d', "d", "delta parameter", std::to_string(delta_));
+    AddHelpLine('d', "d", "delta parameter (or auto to estimate it)", "auto");
+    AddSplitWeightsArg();
   }
 
   void HandleArg(signed char opt, char* opt_arg) override {
     switch (opt) {
       case 'd':
+        auto_delta_ = std::string(opt_arg) == "auto";
         if (std::is_floating_point<WeightT_>::value)
           delta_ = static_cast<WeightT_>(atof(opt_arg));
         else
@@ -221,6 +364,61 @@ class CLDelta : public CLApp {
   }
 
   WeightT_ delta() const { return delta_; }
+  bool auto_delta() const { return auto_delta_; }
+};
+
+
+
+class CLIntersect : public CLApp {
+  std::string method_ = "auto";
+
+ public:
+  CLIntersect(int argc, char** argv, std::string name)
+      : CLApp(argc, argv, name) {
+    get_args_ += "x:";
+    AddHelpLine('x', "method",
+                "intersection: merge, gallop, sse, avx2, avx512, auto",
+                method_);
+  }
+
+  void HandleArg(signed char opt, char* opt_arg) override {
+    switch (opt) {
+      case 'x': method_ = std::string(opt_arg);            break;
+      default: CLApp::HandleArg(opt, opt_arg);
+    }
+  }
+
+  std::string intersect_method() const { return method_; }
+};
+
+
+
+class CLSuite : public CLApp {
+  std::string weighted_filename_ = "";
+  std::string undirected_filename_ = "";
+  std::string plan_filename_ = "";
+
+ public:
+  CLSuite(int argc, char** argv, std::string name) : CLApp(argc, argv, name) {
+    get_args_ += "w:U:P:";
+    AddHelpLine('w', "file", "weighted variant of graph (for sssp)", "input");
+    AddHelpLine('U', "file", "undirected variant of graph (for tc)", "input");
+    AddHelpLine('P', "file", "kernels to run, each line: <kernel> [options]",
+                "GAP suite");
+  }
+
+  void HandleArg(signed char opt, char* opt_arg) override {
+    switch (opt) {
+      case 'w': weighted_filename_ = std::string(opt_arg);    break;
+      case 'U': undirected_filename_ = std::string(opt_arg);  break;
+      case 'P': plan_filename_ = std::string(opt_arg);        break;
+      default: CLApp::HandleArg(opt, opt_arg);
+    }
+  }
+
+  std::string weighted_filename() const { return weighted_filename_; }
+  std::string undirected_filename() const { return undirected_filename_; }
+  std::string plan_filename() const { return plan_filename_; }
 };
 
 
@@ -230,21 +428,29 @@ class CLConvert : public CLBase {
   bool out_weighted_ = false;
   bool out_el_ = false;
   bool out_sg_ = false;
+  bool out_csg_ = false;
+  bool out_of_core_ = false;
 
  public:
   CLConvert(int argc, char** argv, std::string name)
       : CLBase(argc, argv, name) {
-    get_args_ += "e:b:w";
+    get_args_ += "e:b:c:wo";
     AddHelpLine('b', "file", "output serialized graph to file");
+    AddHelpLine('c', "file", "output compressed serialized graph to file");
     AddHelpLine('e', "file", "output edge list to file");
     AddHelpLine('w', "file", "make output weighted");
+    AddHelpLine('o', "", "build serialized graph without holding edge list",
+                "false");
+    AddSplitWeightsArg();
   }
 
   void HandleArg(signed char opt, char* opt_arg) override {
     switch (opt) {
       case 'b': out_sg_ = true; out_filename_ = std::string(opt_arg);   break;
+      case 'c': out_csg_ = true; out_filename_ = std::string(opt_arg);  break;
       case 'e': out_el_ = true; out_filename_ = std::string(opt_arg);   break;
       case 'w': out_weighted_ = true;                                   break;
+      case 'o': out_of_core_ = true;                                    break;
       default: CLBase::HandleArg(opt, opt_arg);
     }
   }
@@ -253,6 +459,8 @@ class CLConvert : public CLBase {
   bool out_weighted() const { return out_weighted_; }
   bool out_el() const { return out_el_; }
   bool out_sg() const { return out_sg_; }
+  bool out_csg() const { return out_csg_; }
+  bool out_of_core() const { return out_of_core_; }
 };
 
 #endif  // COMMAND_LINE_H_
@@ -0,0 +1,405 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef COMPRESSED_GRAPH_H_
+#define COMPRESSED_GRAPH_H_
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include <sys/mman.h>
+
+#include "alloc.h"
+#include "graph.h"
+#include "pvector.h"
+#include "util.h"
+
+
+/*
+GAP Benchmark Suite
+Class:  CompressedGraph
+Author: Scott Beamer
+
+Unweighted graph in CSR format with byte-encoded (compressed) neighborhoods
+ - Intended to be constructed from a built CSRGraph or read from a .csg file
+ - Each neighborhood is encoded as varint(degree), then zigzag-varint of the
+   first neighbor's difference from the vertex's own ID, and then varints of
+   the gaps between consecutive (sorted) neighbors
+ - Per-vertex byte offsets index the start of each encoded neighborhood
+ - Neighborhoods decode on the fly through the same Neighborhood interface as
+   CSRGraph, but iterators yield values, so kernels can't take the address
+   of a neighbor (e.g. to index per-edge data)
+*/
+
+
+template <class NodeID_, bool MakeInverse = true>
+class CompressedGraph {
+  // Used for *non-negative* offsets within a neighborhood
+  typedef std::make_unsigned<std::ptrdiff_t>::type OffsetT;
+
+ public:
+  static size_t VarintBytes(uint64_t x) {
+    size_t num_bytes = 1;
+    while (x >= 128) {
+      x >>= 7;
+      num_bytes++;
+    }
+    return num_bytes;
+  }
+
+  static uint8_t* WriteVarint(uint64_t x, uint8_t *out) {
+    while (x >= 128) {
+      *out++ = static_cast<uint8_t>(x) | 128;
+      x >>= 7;
+    }
+    *out++ = static_cast<uint8_t>(x);
+    return out;
+  }
+
+  static uint64_t ReadVarint(const uint8_t* &in) {
+    uint64_t x = *in++;
+    if (x < 128)
+      return x;
+    x &= 127;
+    int shift = 7;
+    uint64_t b;
+    do {
+      b = *in++;
+      x |= (b & 127) << shift;
+      shift += 7;
+    } while (b >= 128);
+    return x;
+  }
+
+  static uint64_t ZigZag(int64_t x) {
+    return (static_cast<uint64_t>(x) << 1) ^ static_cast<uint64_t>(x >> 63);
+  }
+
+  static int64_t UnZigZag(uint64_t x) {
+    return static_cast<int64_t>(x >> 1) ^ -static_cast<int64_t>(x & 1);
+  }
+
+  // Decodes neighbors one at a time, remaining counts down to 0 (end)
+  class NeighIterator {
+    const uint8_t* pos_;
+    NodeID_ curr_;
+    int64_t remaining_;
+   public:
+    NeighIterator(const uint8_t* pos, NodeID_ curr, int64_t remaining) :
+        pos_(pos), curr_(curr), remaining_(remaining) {}
+    NodeID_ operator*() const { return curr_; }
+    NeighIterator& operator++() {
+      remaining_--;
+      if (remaining_ > 0)
+        curr_ += static_cast<NodeID_>(ReadVarint(pos_));
+      return *this;
+    }
+    NeighIterator operator++(int) {
+      NeighIterator old = *this;
+      ++(*this);
+      return old;
+    }
+    bool operator==(const NeighIterator &other) const {
+      return remaining_ == other.remaining_;
+    }
+    bool operator!=(const NeighIterator &other) const {
+      return remaining_ != other.remaining_;
+    }
+  };
+
+ private:
+  // Used to access neighbors of vertex, basically sugar for iterators
+  class Neighborhood {
+    NodeID_ n_;
+    const uint8_t* start_;
+    OffsetT start_offset_;
+   public:
+    Neighborhood(NodeID_ n, const SGOffset* g_offsets, const uint8_t* g_bytes,
+                 OffsetT start_offset) :
+        n_(n), start_(g_bytes + g_offsets[n]), start_offset_(start_offset) {}
+    typedef NeighIterator iterator;
+    iterator begin() {
+      const uint8_t* pos = start_;
+      int64_t degree = ReadVarint(pos);
+      if (degree == 0)
+        return end();
+      NodeID_ first = n_ + static_cast<NodeID_>(UnZigZag(ReadVarint(pos)));
+      iterator it(pos, first, degree);
+      OffsetT to_skip = std::min(start_offset_, static_cast<OffsetT>(degree));
+      for (OffsetT i=0; i < to_skip; i++)
+        ++it;
+      return it;
+    }
+    iterator end() { return iterator(nullptr, 0, 0); }
+  };
+
+  void ReleaseResources() {
+    if (mapping_ != nullptr) {
+      munmap(mapping_, mapping_bytes_);
+      return;
+    }
+    if (out_offsets_ != nullptr)
+      FreeArray(out_offsets_);
+    if (out_bytes_ != nullptr)
+      FreeArray(out_bytes_);
+    if (directed_) {
+      if (in_offsets_ != nullptr)
+        FreeArray(in_offsets_);
+      if (in_bytes_ != nullptr)
+        FreeArray(in_bytes_);
+    }
+  }
+
+  // Returns bytes needed to encode neighborhood, writes it if out != nullptr
+  static int64_t EncodeNeighborhood(NodeID_ n, std::vector<NodeID_> &neighs,
+                                    uint8_t *out) {
+    if (!std::is_sorted(neighs.begin(), neighs.end()))
+      std::sort(neighs.begin(), neighs.end());
+    int64_t num_bytes = VarintBytes(neighs.size());
+    if (out != nullptr)
+      out = WriteVarint(neighs.size(), out);
+    NodeID_ prev = n;
+    for (size_t i=0; i < neighs.size(); i++) {
+      uint64_t code;
+      if (i == 0)
+        code = ZigZag(static_cast<int64_t>(neighs[i]) - n);
+      else
+        code = neighs[i] - prev;
+      prev = neighs[i];
+      num_bytes += VarintBytes(code);
+      if (out != nullptr)
+        out = WriteVarint(code, out);
+    }
+    return num_bytes;
+  }
+
+  template <typename GraphT_>
+  static void Compress(const GraphT_ &g, bool transpose, SGOffset** offsets,
+                       uint8_t** bytes) {
+    pvector<SGOffset> sizes(g.num_nodes());
+    #pragma omp parallel
+    {
+      std::vector<NodeID_> neighs;
+      #pragma omp for schedule(dynamic, 1024)
+      for (NodeID_ n=0; n < g.num_nodes(); n++) {
+        neighs.clear();
+        if (transpose)
+          neighs.assign(g.in_neigh(n).begin(), g.in_neigh(n).end());
+        else
+          neighs.assign(g.out_neigh(n).begin(), g.out_neigh(n).end());
+        sizes[n] = EncodeNeighborhood(n, neighs, nullptr);
+      }
+    }
+    *offsets = AllocArray<SGOffset>(g.num_nodes() + 1);
+    SGOffset total = 0;
+    for (NodeID_ n=0; n < g.num_nodes(); n++) {
+      (*offsets)[n] = total;
+      total += sizes[n];
+    }
+    (*offsets)[g.num_nodes()] = total;
+    *bytes = AllocArray<uint8_t>(total);
+    #pragma omp parallel
+    {
+      std::vector<NodeID_> neighs;
+      #pragma omp for schedule(dynamic, 1024)
+      for (NodeID_ n=0; n < g.num_nodes(); n++) {
+        neighs.clear();
+        if (transpose)
+          neighs.assign(g.in_neigh(n).begin(), g.in_neigh(n).end());
+        else
+          neighs.assign(g.out_neigh(n).begin(), g.out_neigh(n).end());
+        EncodeNeighborhood(n, neighs, *bytes + (*offsets)[n]);
+      }
+    }
+  }
+
+ public:
+  CompressedGraph() : directed_(false), num_nodes_(-1), num_edges_(-1),
+    out_offsets_(nullptr), out_bytes_(nullptr),
+    in_offsets_(nullptr), in_bytes_(nullptr),
+    mapping_(nullptr), mapping_bytes_(0) {}
+
+  explicit CompressedGraph(const CSRGraph<NodeID_, NodeID_, MakeInverse> &g) :
+    directed_(g.directed()), num_nodes_(g.num_nodes()),
+    num_edges_(g.num_edges()), out_offsets_(nullptr), out_bytes_(nullptr),
+    in_offsets_(nullptr), in_bytes_(nullptr),
+    mapping_(nullptr), mapping_bytes_(0) {
+      Compress(g, false, &out_offsets_, &out_bytes_);
+      if (directed_ && MakeInverse) {
+        Compress(g, true, &in_offsets_, &in_bytes_);
+      } else if (!directed_) {
+        in_offsets_ = out_offsets_;
+        in_bytes_ = out_bytes_;
+      }
+    }
+
+  CompressedGraph(bool directed, int64_t num_nodes, int64_t num_edges,
+                  SGOffset* out_offsets, uint8_t* out_bytes,
+                  SGOffset* in_offsets, uint8_t* in_bytes) :
+    directed_(directed), num_nodes_(num_nodes), num_edges_(num_edges),
+    out_offsets_(out_offsets), out_bytes_(out_bytes),
+    in_offsets_(directed ? in_offsets : out_offsets),
+    in_bytes_(directed ? in_bytes : out_bytes),
+    mapping_(nullptr), mapping_bytes_(0) {}
+
+  CompressedGraph(CompressedGraph&& other) : directed_(other.directed_),
+    num_nodes_(other.num_nodes_), num_edges_(other.num_edges_),
+    out_offsets_(other.out_offsets_), out_bytes_(other.out_bytes_),
+    in_offsets_(other.in_offsets_), in_bytes_(other.in_bytes_),
+    mapping_(other.mapping_), mapping_bytes_(other.mapping_bytes_) {
+      other.num_edges_ = -1;
+      other.num_nodes_ = -1;
+      other.out_offsets_ = nullptr;
+      other.out_bytes_ = nullptr;
+      other.in_offsets_ = nullptr;
+      other.in_bytes_ = nullptr;
+      other.mapping_ = nullptr;
+      other.mapping_bytes_ = 0;
+  }
+
+  ~CompressedGraph() {
+    ReleaseResources();
+  }
+
+  CompressedGraph& operator=(CompressedGraph&& other) {
+    if (this != &other) {
+      ReleaseResources();
+      directed_ = other.directed_;
+      num_edges_ = other.num_edges_;
+      num_nodes_ = other.num_nodes_;
+      out_offsets_ = other.out_offsets_;
+      out_bytes_ = other.out_bytes_;
+      in_offsets_ = other.in_offsets_;
+      in_bytes_ = other.in_bytes_;
+      mapping_ = other.mapping_;
+      mapping_bytes_ = other.mapping_bytes_;
+      out_blocks_ = VertexPartition<NodeID_>();
+      in_blocks_ = VertexPartition<NodeID_>();
+      other.num_edges_ = -1;
+      other.num_nodes_ = -1;
+      other.out_offsets_ = nullptr;
+      other.out_bytes_ = nullptr;
+      other.in_offsets_ = nullptr;
+      other.in_bytes_ = nullptr;
+      other.mapping_ = nullptr;
+      other.mapping_bytes_ = 0;
+    }
+    return *this;
+  }
+
+  // Graph takes ownership of mapped region that holds all of its arrays
+  void AdoptMapping(void *mapping, size_t mapping_bytes) {
+    mapping_ = mapping;
+    mapping_bytes_ = mapping_bytes;
+  }
+
+  bool directed() const {
+    return directed_;
+  }
+
+  int64_t num_nodes() const {
+    return num_nodes_;
+  }
+
+  int64_t num_edges() const {
+    return num_edges_;
+  }
+
+  int64_t num_edges_directed() const {
+    return directed_ ? num_edges_ : 2*num_edges_;
+  }
+
+  int64_t out_degree(NodeID_ v) const {
+    const uint8_t* pos = out_bytes_ + out_offsets_[v];
+    return ReadVarint(pos);
+  }
+
+  int64_t in_degree(NodeID_ v) const {
+    static_assert(MakeInverse, "Graph inversion disabled but reading inverse");
+    const uint8_t* pos = in_bytes_ + in_offsets_[v];
+    return ReadVarint(pos);
+  }
+
+  Neighborhood out_neigh(NodeID_ n, OffsetT start_offset = 0) const {
+    return Neighborhood(n, out_offsets_, out_bytes_, start_offset);
+  }
+
+  Neighborhood in_neigh(NodeID_ n, OffsetT start_offset = 0) const {
+    static_assert(MakeInverse, "Graph inversion disabled but reading inverse");
+    return Neighborhood(n, in_offsets_, in_bytes_, start_offset);
+  }
+
+  // Vertex blocks with about equal out (or in) encoded bytes plus vertices,
+  // built on first use (needs to be called from outside a parallel region)
+  const VertexPartition<NodeID_>& VertexBlocks(bool in_graph = false) const {
+    if (!in_graph || !directed_) {
+      out_blocks_.Update(out_offsets_, num_nodes_);
+      return out_blocks_;
+    }
+    in_blocks_.Update(in_offsets_, num_nodes_);
+    return in_blocks_;
+  }
+
+  int64_t num_bytes(bool in_graph = false) const {
+    return in_graph ? in_offsets_[num_nodes_] : out_offsets_[num_nodes_];
+  }
+
+  const SGOffset* byte_offsets(bool in_graph = false) const {
+    return in_graph ? in_offsets_ : out_offsets_;
+  }
+
+  const uint8_t* neigh_bytes(bool in_graph = false) const {
+    return in_graph ? in_bytes_ : out_bytes_;
+  }
+
+  void PrintStats() const {
+    std::cout << "Graph has " << num_nodes_ << " nodes and "
+              << num_edges_ << " ";
+    if (!directed_)
+      std::cout << "un";
+    std::cout << "directed edges for degree: ";
+    std::cout << num_edges_/num_nodes_ << std::endl;
+    int64_t total_bytes = num_bytes(false);
+    int64_t stored_edges = num_edges_directed();
+    if (directed_ && (in_offsets_ != nullptr)) {
+      total_bytes += num_bytes(true);
+      stored_edges *= 2;
+    }
+    double bytes_per_edge = static_cast<double>(total_bytes) /
+                            std::max(stored_edges, int64_t(1));
+    printf("Compressed neighbors use %.2lf bytes/edge\n", bytes_per_edge);
+  }
+
+  void PrintTopology() const {
+    for (NodeID_ i=0; i < num_nodes_; i++) {
+      std::cout << i << ": ";
+      for (NodeID_ j : out_neigh(i)) {
+        std::cout << j << " ";
+      }
+      std::cout << std::endl;
+    }
+  }
+
+  Range<NodeID_> vertices() const {
+    return Range<NodeID_>(num_nodes());
+  }
+
+ private:
+  bool directed_;
+  int64_t num_nodes_;
+  int64_t num_edges_;
+  SGOffset* out_offsets_;
+  uint8_t*  out_bytes_;
+  SGOffset* in_offsets_;
+  uint8_t*  in_bytes_;
+  void*     mapping_;
+  size_t    mapping_bytes_;
+  mutable VertexPartition<NodeID_> out_blocks_;
+  mutable VertexPartition<NodeID_> in_blocks_;
+};
+
+#endif  // COMPRESSED_GRAPH_H_
@@ -11,9 +11,60 @@
 
 using namespace std;
 
+template <typename StoreT_>
+void WriteSplitGraph(WeightedBuilder &bw, string filename) {
+  SWGraph<StoreT_> sg = bw.MakeSplitGraph<StoreT_>();
+  sg.PrintStats();
+  SplitWeightedWriter<StoreT_> sw(sg);
+  sw.WriteGraph(filename);
+}
+
 int main(int argc, char* argv[]) {
   CLConvert cli(argc, argv, "converter");
   cli.ParseArgs();
+  if (cli.out_weighted() && cli.out_csg()) {
+    cout << "Compressed graphs (-c) can't be weighted" << endl;
+    return -1;
+  }
+  if (cli.out_of_core()) {
+    if (!cli.out_sg()) {
+      cout << "Out-of-core building (-o) only outputs serialized graphs (-b)"
+           << endl;
+      return -1;
+    }
+    if (cli.vertex_order() != "") {
+      cout << "Out-of-core building (-o) can't relabel vertices (-O)" << endl;
+      return -1;
+    }
+    if (cli.split_weight_bits() != 0) {
+      cout << "Out-of-core building (-o) can't split weights (-W)" << endl;
+      return -1;
+    }
+    if (cli.out_weighted()) {
+      WeightedStreamBuilder bw(cli);
+      WGraph wg = bw.MakeGraph(cli.out_filename());
+      wg.PrintStats();
+    } else {
+      StreamBuilder b(cli);
+      Graph g = b.MakeGraph(cli.out_filename());
+      g.PrintStats();
+    }
+    return 0;
+  }
+  if (cli.split_weight_bits() != 0) {
+    if (!cli.out_weighted() || !cli.out_sg()) {
+      cout << "Split weights (-W) only output weighted serialized graphs (-wb)"
+           << endl;
+      return -1;
+    }
+    WeightedBuilder bw(cli);
+    switch (bw.split_weight_bits()) {
+      case 8:  WriteSplitGraph<uint8_t>(bw, cli.out_filename());   break;
+      case 16: WriteSplitGraph<uint16_t>(bw, cli.out_filename());  break;
+      default: WriteSplitGraph<WeightT>(bw, cli.out_filename());
+    }
+    return 0;
+  }
   if (cli.out_weighted()) {
     WeightedBuilder bw(cli);
     WGraph wg = bw.MakeGraph();
@@ -25,7 +76,10 @@ int main(int argc, char* argv[]) {
     Graph g = b.MakeGraph();
     g.PrintStats();
     Writer w(g);
-    w.WriteGraph(cli.out_filename(), cli.out_sg());
+    if (cli.out_csg())
+      w.WriteCompressedGraph(cli.out_filename());
+    else
+      w.WriteGraph(cli.out_filename(), cli.out_sg());
   }
   return 0;
 }
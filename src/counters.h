@@ -0,0 +1,244 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef COUNTERS_H_
+#define COUNTERS_H_
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <stdio.h>
+#include <cinttypes>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "report.h"
+#include "timer.h"
+
+
+/*
+GAP Benchmark Suite
+Class:  PerfCounters
+Author: Scott Beamer
+
+Optional hardware performance counters (-p), using perf_event_open (Linux)
+ - Counts (user-space only) for the whole process: cycles, instructions,
+   last-level cache misses, data TLB misses, branch misses, and page faults
+ - Counts are accumulated per named region: kernels bracket phases with
+   Begin(name) & End(name), or use a RegionTimer, and BenchmarkKernel adds a
+   "trial" region around each trial and prints all regions after it
+ - Memory bandwidth is estimated as LLC misses * kLineBytes per second, so it
+   leaves out prefetches and writebacks
+ - Counters are opened while parsing arguments, before OpenMP starts its
+   threads, since they are only inherited by threads created afterwards
+ - Events the CPU (or a VM) doesn't provide are left out, and if none are
+   available (or not Linux), regions are ignored
+ - Counts are scaled if the kernel had to multiplex the events
+*/
+
+
+class PerfCounters {
+ public:
+  static const int64_t kLineBytes = 64;
+
+  static PerfCounters& Get() {
+    static PerfCounters counters;
+    return counters;
+  }
+
+  void Open() {
+    if (enabled())
+      return;
+    std::string unavailable;
+#if defined(__linux__)
+    for (const Event &e : AllEvents()) {
+      struct perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = e.type;
+      attr.config = e.config;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.inherit = 1;
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+      int fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+      if (fd != -1) {
+        events_.push_back(e);
+        fds_.push_back(fd);
+      } else {
+        unavailable += std::string(" ") + e.name;
+      }
+    }
+#endif
+    if (events_.empty())
+      std::cout << "No performance counters available" << std::endl;
+    else if (!unavailable.empty())
+      std::cout << "Counters unavailable:" << unavailable << std::endl;
+  }
+
+  bool enabled() const { return !events_.empty(); }
+
+  void Begin(const std::string &region) {
+    if (!enabled())
+      return;
+    Region &r = FindRegion(region);
+    r.start = Read();
+    r.timer.Start();
+  }
+
+  void End(const std::string &region) {
+    if (!enabled())
+      return;
+    std::vector<Reading> now = Read();
+    Region &r = FindRegion(region);
+    if (r.start.empty())
+      return;
+    r.timer.Stop();
+    r.seconds += r.timer.Seconds();
+    r.calls++;
+    for (size_t e=0; e < events_.size(); e++) {
+      Reading delta = {now[e].value - r.start[e].value,
+                       now[e].enabled - r.start[e].enabled,
+                       now[e].running - r.start[e].running};
+      if ((delta.running != 0) && (delta.running != delta.enabled))
+        delta.value = delta.value * (static_cast<double>(delta.enabled) /
+                                     delta.running);
+      r.totals[e] += delta.value;
+    }
+  }
+
+  // Prints (and records) totals of each region in order of first use, and
+  //   then clears them
+  void PrintRegions() {
+    if (!enabled())
+      return;
+    printf("%-8s", "Region");
+    for (const Event &e : events_)
+      printf("%11s", e.name);
+    if (llc_index() != -1)
+      printf("%11s", "est-GB/s");
+    printf("\n");
+    for (const std::string &name : region_order_) {
+      const Region &r = regions_[name];
+      printf("%-8s", name.c_str());
+      Report::Fields fields = {Report::String("region", name),
+                               Report::Number("calls", r.calls),
+                               Report::Number("seconds", r.seconds)};
+      for (size_t e=0; e < events_.size(); e++) {
+        printf("%11.4g", static_cast<double>(r.totals[e]));
+        fields.push_back(Report::Number(events_[e].name, r.totals[e]));
+      }
+      if ((llc_index() != -1) && (r.seconds > 0)) {
+        double gbps = r.totals[llc_index()] * kLineBytes / r.seconds / 1e9;
+        printf("%11.4g", gbps);
+        fields.push_back(Report::Number("est_gb_per_second", gbps));
+      }
+      printf("\n");
+      Report::Get().Write("counters", fields);
+    }
+    regions_.clear();
+    region_order_.clear();
+  }
+
+ private:
+  struct Event {
+    const char *name;
+    uint32_t type;
+    uint64_t config;
+  };
+
+  struct Reading {
+    int64_t value;
+    int64_t enabled;
+    int64_t running;
+  };
+
+  struct Region {
+    std::vector<Reading> start;
+    std::vector<int64_t> totals;
+    Timer timer;
+    double seconds = 0;
+    int64_t calls = 0;
+  };
+
+  PerfCounters() {}
+
+  static std::vector<Event> AllEvents() {
+#if defined(__linux__)
+    const uint64_t kDTLBReadMiss = PERF_COUNT_HW_CACHE_DTLB |
+        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    return {{"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {"instrs", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {"llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {"dtlb_misses", PERF_TYPE_HW_CACHE, kDTLBReadMiss},
+            {"br_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {"faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS}};
+#else
+    return {};
+#endif
+  }
+
+  int llc_index() const {
+    for (size_t e=0; e < events_.size(); e++) {
+      if (strcmp(events_[e].name, "llc_misses") == 0)
+        return e;
+    }
+    return -1;
+  }
+
+  std::vector<Reading> Read() const {
+    std::vector<Reading> readings(fds_.size(), Reading{0, 0, 0});
+#if defined(__linux__)
+    for (size_t e=0; e < fds_.size(); e++) {
+      uint64_t buf[3];
+      if (read(fds_[e], buf, sizeof(buf)) == sizeof(buf))
+        readings[e] = Reading{static_cast<int64_t>(buf[0]),
+                              static_cast<int64_t>(buf[1]),
+                              static_cast<int64_t>(buf[2])};
+    }
+#endif
+    return readings;
+  }
+
+  Region& FindRegion(const std::string &name) {
+    if (regions_.count(name) == 0) {
+      region_order_.push_back(name);
+      regions_[name].totals.resize(events_.size(), 0);
+    }
+    return regions_[name];
+  }
+
+  std::vector<Event> events_;
+  std::vector<int> fds_;
+  std::map<std::string, Region> regions_;
+  std::vector<std::string> region_order_;
+};
+
+
+// Timer that also counts the region it times (if counters are enabled)
+class RegionTimer : public Timer {
+ public:
+  void Start(const std::string &region) {
+    region_ = region;
+    PerfCounters::Get().Begin(region_);
+    Timer::Start();
+  }
+
+  void Stop() {
+    Timer::Stop();
+    PerfCounters::Get().End(region_);
+  }
+
+ private:
+  std::string region_;
+};
+
+#endif  // COUNTERS_H_
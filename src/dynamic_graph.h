@@ -0,0 +1,478 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef DYNAMIC_GRAPH_H_
+#define DYNAMIC_GRAPH_H_
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "alloc.h"
+#include "graph.h"
+#include "parallel_sort.h"
+#include "partition.h"
+#include "pvector.h"
+#include "util.h"
+
+
+/*
+GAP Benchmark Suite
+Class:  DynamicGraph
+Author: Scott Beamer
+
+Unweighted graph that takes batches of edge insertions and deletions
+ - Wraps a built CSRGraph (the base), and for each vertex keeps a sorted delta
+   of neighbors added to its base neighborhood and neighbors deleted from it,
+   so the base is never modified by updates
+ - Deltas of all vertices are stored together in CSR form, and each batch
+   (InsertEdges or DeleteEdges) merges its edges into them, rewriting only
+   the touched vertices' deltas
+ - Neighborhoods merge base and delta on the fly through the same
+   Neighborhood interface as CSRGraph, in sorted order, but like
+   CompressedGraph, iterators yield values
+ - Once deltas hold more than 1/kCompactRatio as many edges as the base, they
+   are compacted into a new base (Compact), which can also be done on demand
+   (e.g. to get a CSRGraph for kernels that need one)
+ - Vertex set is fixed, so updates can only use existing vertex IDs, and as
+   in the builder, self-loops are ignored
+*/
+
+
+template <class NodeID_, bool MakeInverse = true>
+class DynamicGraph {
+  typedef CSRGraph<NodeID_, NodeID_, MakeInverse> BaseGraph;
+  typedef EdgePair<NodeID_, NodeID_> Edge;
+  typedef pvector<Edge> EdgeList;
+  // Used for *non-negative* offsets within a neighborhood
+  typedef std::make_unsigned<std::ptrdiff_t>::type OffsetT;
+
+  // Neighbors added to (adds) and deleted from (dels) base neighborhoods
+  struct Delta {
+    pvector<SGOffset> add_offsets;
+    pvector<NodeID_> adds;
+    pvector<SGOffset> del_offsets;
+    pvector<NodeID_> dels;
+
+    void Reset(int64_t num_nodes) {
+      add_offsets = pvector<SGOffset>(num_nodes + 1, 0);
+      adds = pvector<NodeID_>();
+      del_offsets = pvector<SGOffset>(num_nodes + 1, 0);
+      dels = pvector<NodeID_>();
+    }
+
+    int64_t size() const { return adds.size() + dels.size(); }
+  };
+
+ public:
+  static const int64_t kCompactRatio = 8;
+
+  // Merges a base neighborhood (skipping deleted) with added neighbors
+  class NeighIterator {
+    const NodeID_ *base_, *base_end_;
+    const NodeID_ *del_, *del_end_;
+    const NodeID_ *add_, *add_end_;
+
+    void SkipDeleted() {
+      while (base_ != base_end_) {
+        while ((del_ != del_end_) && (*del_ < *base_))
+          del_++;
+        if ((del_ == del_end_) || (*del_ != *base_))
+          return;
+        base_++;
+        del_++;
+      }
+    }
+
+   public:
+    NeighIterator(const NodeID_ *base, const NodeID_ *base_end,
+                  const NodeID_ *del, const NodeID_ *del_end,
+                  const NodeID_ *add, const NodeID_ *add_end) :
+        base_(base), base_end_(base_end), del_(del), del_end_(del_end),
+        add_(add), add_end_(add_end) {
+      SkipDeleted();
+    }
+    NodeID_ operator*() const {
+      if ((add_ == add_end_) ||
+          ((base_ != base_end_) && (*base_ < *add_)))
+        return *base_;
+      return *add_;
+    }
+    NeighIterator& operator++() {
+      if ((add_ == add_end_) ||
+          ((base_ != base_end_) && (*base_ < *add_))) {
+        base_++;
+        SkipDeleted();
+      } else {
+        add_++;
+      }
+      return *this;
+    }
+    NeighIterator operator++(int) {
+      NeighIterator old = *this;
+      ++(*this);
+      return old;
+    }
+    bool operator==(const NeighIterator &other) const {
+      return (base_ == other.base_) && (add_ == other.add_);
+    }
+    bool operator!=(const NeighIterator &other) const {
+      return !(*this == other);
+    }
+  };
+
+ private:
+  // Used to access neighbors of vertex, basically sugar for iterators
+  class Neighborhood {
+    NeighIterator begin_;
+    NeighIterator end_;
+   public:
+    Neighborhood(const NodeID_ *base, const NodeID_ *base_end,
+                 const NodeID_ *del, const NodeID_ *del_end,
+                 const NodeID_ *add, const NodeID_ *add_end,
+                 OffsetT start_offset) :
+        begin_(base, base_end, del, del_end, add, add_end),
+        end_(base_end, base_end, del_end, del_end, add_end, add_end) {
+      for (OffsetT i=0; (i < start_offset) && (begin_ != end_); i++)
+        ++begin_;
+    }
+    typedef NeighIterator iterator;
+    iterator begin() { return begin_; }
+    iterator end()   { return end_; }
+  };
+
+  Neighborhood MakeNeigh(NodeID_ n, bool in_graph, OffsetT start_offset) const {
+    const Delta &d = delta(in_graph);
+    auto base = in_graph ? base_.in_neigh(n) : base_.out_neigh(n);
+    return Neighborhood(base.begin(), base.end(),
+                        d.dels.data() + d.del_offsets[n],
+                        d.dels.data() + d.del_offsets[n+1],
+                        d.adds.data() + d.add_offsets[n],
+                        d.adds.data() + d.add_offsets[n+1], start_offset);
+  }
+
+  const Delta& delta(bool in_graph) const {
+    return (in_graph && base_.directed()) ? in_delta_ : out_delta_;
+  }
+
+  // Sorted (u, v) pairs of batch for this direction, without duplicates
+  EdgeList DirectedBatch(const EdgeList &batch, bool transpose) const {
+    bool both = !base_.directed();
+    EdgeList pairs(batch.size() * (both ? 2 : 1));
+    #pragma omp parallel for
+    for (size_t i=0; i < batch.size(); i++) {
+      Edge e = batch[i];
+      if ((e.u < 0) || (e.v < 0) || (e.u >= num_nodes()) ||
+          (e.v >= num_nodes())) {
+        std::cout << "Vertex ID out of range: " << e.u << " " << e.v
+                  << std::endl;
+        std::exit(-41);
+      }
+      if (both) {
+        pairs[2*i] = e;
+        pairs[2*i+1] = Edge(e.v, e.u);
+      } else {
+        pairs[i] = transpose ? Edge(e.v, e.u) : e;
+      }
+    }
+    ParallelSort(pairs.begin(), pairs.end());
+    auto new_end = std::unique(pairs.begin(), pairs.end());
+    new_end = std::remove_if(pairs.begin(), new_end,
+                             [](Edge e) { return e.u == e.v; });
+    pairs.resize(new_end - pairs.begin());
+    return pairs;
+  }
+
+  // Merges sorted batch into delta d (of base's out or in neighborhoods)
+  void UpdateDelta(const EdgeList &pairs, bool insert, bool in_graph,
+                   Delta &d) {
+    // Starts of each touched vertex's run of pairs
+    std::vector<size_t> runs;
+    for (size_t i=0; i < pairs.size(); i++) {
+      if ((i == 0) || (pairs[i].u != pairs[i-1].u))
+        runs.push_back(i);
+    }
+    runs.push_back(pairs.size());
+    int64_t num_touched = runs.size() - 1;
+    std::vector<std::vector<NodeID_>> new_adds(num_touched);
+    std::vector<std::vector<NodeID_>> new_dels(num_touched);
+    pvector<int64_t> touched_index(num_nodes(), -1);
+    #pragma omp parallel
+    {
+      std::vector<NodeID_> batch, merged;
+      #pragma omp for schedule(dynamic, 64)
+      for (int64_t t=0; t < num_touched; t++) {
+        NodeID_ u = pairs[runs[t]].u;
+        touched_index[u] = t;
+        batch.clear();
+        for (size_t i=runs[t]; i < runs[t+1]; i++)
+          batch.push_back(pairs[i].v);
+        auto base = in_graph ? base_.in_neigh(u) : base_.out_neigh(u);
+        const NodeID_ *adds = d.adds.data() + d.add_offsets[u];
+        const NodeID_ *adds_end = d.adds.data() + d.add_offsets[u+1];
+        const NodeID_ *dels = d.dels.data() + d.del_offsets[u];
+        const NodeID_ *dels_end = d.dels.data() + d.del_offsets[u+1];
+        merged.clear();
+        if (insert) {
+          // adds' = adds + (batch - base), dels' = dels - batch
+          std::set_difference(batch.begin(), batch.end(), base.begin(),
+                              base.end(), std::back_inserter(merged));
+          std::set_union(adds, adds_end, merged.begin(), merged.end(),
+                         std::back_inserter(new_adds[t]));
+          std::set_difference(dels, dels_end, batch.begin(), batch.end(),
+                              std::back_inserter(new_dels[t]));
+        } else {
+          // adds' = adds - batch, dels' = dels + (batch & base)
+          std::set_difference(adds, adds_end, batch.begin(), batch.end(),
+                              std::back_inserter(new_adds[t]));
+          std::set_intersection(batch.begin(), batch.end(), base.begin(),
+                                base.end(), std::back_inserter(merged));
+          std::set_union(dels, dels_end, merged.begin(), merged.end(),
+                         std::back_inserter(new_dels[t]));
+        }
+      }
+    }
+    Delta updated;
+    updated.add_offsets = pvector<SGOffset>(num_nodes() + 1);
+    updated.del_offsets = pvector<SGOffset>(num_nodes() + 1);
+    SGOffset add_total = 0, del_total = 0;
+    for (NodeID_ n=0; n < num_nodes(); n++) {
+      updated.add_offsets[n] = add_total;
+      updated.del_offsets[n] = del_total;
+      int64_t t = touched_index[n];
+      if (t == -1) {
+        add_total += d.add_offsets[n+1] - d.add_offsets[n];
+        del_total += d.del_offsets[n+1] - d.del_offsets[n];
+      } else {
+        add_total += new_adds[t].size();
+        del_total += new_dels[t].size();
+      }
+    }
+    updated.add_offsets[num_nodes()] = add_total;
+    updated.del_offsets[num_nodes()] = del_total;
+    updated.adds = pvector<NodeID_>(add_total);
+    updated.dels = pvector<NodeID_>(del_total);
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (NodeID_ n=0; n < num_nodes(); n++) {
+      int64_t t = touched_index[n];
+      NodeID_ *add_out = updated.adds.data() + updated.add_offsets[n];
+      NodeID_ *del_out = updated.dels.data() + updated.del_offsets[n];
+      if (t == -1) {
+        std::copy(d.adds.data() + d.add_offsets[n],
+                  d.adds.data() + d.add_offsets[n+1], add_out);
+        std::copy(d.dels.data() + d.del_offsets[n],
+                  d.dels.data() + d.del_offsets[n+1], del_out);
+      } else {
+        std::copy(new_adds[t].begin(), new_adds[t].end(), add_out);
+        std::copy(new_dels[t].begin(), new_dels[t].end(), del_out);
+      }
+    }
+    d = std::move(updated);
+  }
+
+  // Rebuilds offsets of merged neighborhoods from base and delta
+  void UpdateOffsets(bool in_graph, pvector<SGOffset> &offsets) {
+    const Delta &d = delta(in_graph);
+    offsets = pvector<SGOffset>(num_nodes() + 1);
+    SGOffset total = 0;
+    for (NodeID_ n=0; n < num_nodes(); n++) {
+      offsets[n] = total;
+      int64_t base_degree = in_graph ? base_.in_degree(n) :
+                                       base_.out_degree(n);
+      total += base_degree + (d.add_offsets[n+1] - d.add_offsets[n]) -
+               (d.del_offsets[n+1] - d.del_offsets[n]);
+    }
+    offsets[num_nodes()] = total;
+  }
+
+  void Update(const EdgeList &batch, bool insert) {
+    UpdateDelta(DirectedBatch(batch, false), insert, false, out_delta_);
+    UpdateOffsets(false, out_offsets_);
+    if (base_.directed() && MakeInverse) {
+      UpdateDelta(DirectedBatch(batch, true), insert, true, in_delta_);
+      UpdateOffsets(true, in_offsets_);
+    }
+    out_blocks_ = VertexPartition<NodeID_>();
+    in_blocks_ = VertexPartition<NodeID_>();
+    if (delta_edges() * kCompactRatio > base_.num_edges_directed())
+      Compact();
+  }
+
+  // Copies merged neighborhoods into a new array laid out by offsets
+  NodeID_* MergeNeighs(bool in_graph, const pvector<SGOffset> &offsets) const {
+    NodeID_ *neighs = AllocArray<NodeID_>(offsets[num_nodes()]);
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (NodeID_ n=0; n < num_nodes(); n++) {
+      NodeID_ *out = neighs + offsets[n];
+      for (NodeID_ v : MakeNeigh(n, in_graph, 0))
+        *out++ = v;
+    }
+    return neighs;
+  }
+
+ public:
+  DynamicGraph() {}
+
+  explicit DynamicGraph(BaseGraph &&base) : base_(std::move(base)) {
+    out_delta_.Reset(num_nodes());
+    in_delta_.Reset(base_.directed() ? num_nodes() : 0);
+    UpdateOffsets(false, out_offsets_);
+    if (base_.directed() && MakeInverse)
+      UpdateOffsets(true, in_offsets_);
+  }
+
+  // Adds edges (both directions if undirected), skipping ones already present
+  void InsertEdges(const EdgeList &batch) {
+    Update(batch, true);
+  }
+
+  // Removes edges (both directions if undirected), skipping ones not present
+  void DeleteEdges(const EdgeList &batch) {
+    Update(batch, false);
+  }
+
+  // Makes merged neighborhoods the new base (keeping any original IDs),
+  //   leaving deltas empty
+  void Compact() {
+    if (delta_edges() == 0)
+      return;
+    SGOffset *out_offsets = BaseGraph::CopyOffsets(out_offsets_);
+    NodeID_ *out_neighs = MergeNeighs(false, out_offsets_);
+    NodeID_ *original_ids = nullptr;
+    if (base_.relabeled()) {
+      original_ids = AllocArray<NodeID_>(num_nodes());
+      #pragma omp parallel for
+      for (NodeID_ n=0; n < num_nodes(); n++)
+        original_ids[n] = base_.original_id(n);
+    }
+    if (base_.directed()) {
+      SGOffset *in_offsets = nullptr;
+      NodeID_ *in_neighs = nullptr;
+      if (MakeInverse) {
+        in_offsets = BaseGraph::CopyOffsets(in_offsets_);
+        in_neighs = MergeNeighs(true, in_offsets_);
+      }
+      base_ = BaseGraph(num_nodes(), out_offsets, out_neighs, in_offsets,
+                        in_neighs);
+    } else {
+      base_ = BaseGraph(num_nodes(), out_offsets, out_neighs);
+    }
+    if (original_ids != nullptr)
+      base_.SetOriginalIDs(original_ids);
+    out_delta_.Reset(num_nodes());
+    in_delta_.Reset(base_.directed() ? num_nodes() : 0);
+  }
+
+  // Base graph, which includes all updates only right after Compact()
+  const BaseGraph& base() const {
+    return base_;
+  }
+
+  // Updates don't change IDs, so original IDs (-O) are base's
+  bool relabeled() const {
+    return base_.relabeled();
+  }
+
+  NodeID_ original_id(NodeID_ n) const {
+    return base_.original_id(n);
+  }
+
+  NodeID_ relabeled_id(NodeID_ original) const {
+    return base_.relabeled_id(original);
+  }
+
+  // Edges (counted per direction stored) held in deltas instead of base
+  int64_t delta_edges() const {
+    return out_delta_.size() + (base_.directed() ? in_delta_.size() : 0);
+  }
+
+  bool directed() const {
+    return base_.directed();
+  }
+
+  int64_t num_nodes() const {
+    return base_.num_nodes();
+  }
+
+  int64_t num_edges() const {
+    return directed() ? out_offsets_[num_nodes()] :
+                        out_offsets_[num_nodes()] / 2;
+  }
+
+  int64_t num_edges_directed() const {
+    return out_offsets_[num_nodes()];
+  }
+
+  int64_t out_degree(NodeID_ v) const {
+    return out_offsets_[v+1] - out_offsets_[v];
+  }
+
+  int64_t in_degree(NodeID_ v) const {
+    static_assert(MakeInverse, "Graph inversion disabled but reading inverse");
+    if (!directed())
+      return out_degree(v);
+    return in_offsets_[v+1] - in_offsets_[v];
+  }
+
+  Neighborhood out_neigh(NodeID_ n, OffsetT start_offset = 0) const {
+    return MakeNeigh(n, false, start_offset);
+  }
+
+  Neighborhood in_neigh(NodeID_ n, OffsetT start_offset = 0) const {
+    static_assert(MakeInverse, "Graph inversion disabled but reading inverse");
+    return MakeNeigh(n, directed(), start_offset);
+  }
+
+  // Vertex blocks with about equal out (or in) edges, built on first use
+  // after an update (needs to be called from outside a parallel region)
+  const VertexPartition<NodeID_>& VertexBlocks(bool in_graph = false) const {
+    if (!in_graph || !directed()) {
+      out_blocks_.Update(out_offsets_.data(), num_nodes());
+      return out_blocks_;
+    }
+    in_blocks_.Update(in_offsets_.data(), num_nodes());
+    return in_blocks_;
+  }
+
+  void PrintStats() const {
+    std::cout << "Graph has " << num_nodes() << " nodes and "
+              << num_edges() << " ";
+    if (!directed())
+      std::cout << "un";
+    std::cout << "directed edges for degree: ";
+    std::cout << num_edges()/num_nodes() << std::endl;
+    std::cout << "Updates hold " << delta_edges() << " edges outside of base"
+              << std::endl;
+  }
+
+  void PrintTopology() const {
+    for (NodeID_ i=0; i < num_nodes(); i++) {
+      std::cout << i << ": ";
+      for (NodeID_ j : out_neigh(i)) {
+        std::cout << j << " ";
+      }
+      std::cout << std::endl;
+    }
+  }
+
+  Range<NodeID_> vertices() const {
+    return Range<NodeID_>(num_nodes());
+  }
+
+ private:
+  BaseGraph base_;
+  Delta out_delta_;
+  Delta in_delta_;
+  pvector<SGOffset> out_offsets_;
+  pvector<SGOffset> in_offsets_;
+  mutable VertexPartition<NodeID_> out_blocks_;
+  mutable VertexPartition<NodeID_> in_blocks_;
+};
+
+#endif  // DYNAMIC_GRAPH_H_
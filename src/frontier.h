@@ -0,0 +1,123 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef FRONTIER_H_
+#define FRONTIER_H_
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+#include "graph.h"
+#include "split_graph.h"
+
+
+/*
+GAP Benchmark Suite
+Class:  EdgeBalancer
+Author: Scott Beamer
+
+Edge-balanced loop over the out-edges of a frontier of vertices
+ - Spreading the frontier's vertices across threads (even dynamically) is
+   imbalanced when a few vertices in it have most of its edges, since all of
+   a vertex's edges go to one thread
+ - Instead, ForEachEdge first processes vertices with at most kChunkEdges
+   out-edges (dynamically scheduled), setting aside heavier ones, and then
+   splits the heavy ones' edges into chunks of kChunkEdges that idle threads
+   grab one at a time, so no thread is left with a huge neighborhood
+ - Called by every thread of a parallel region (like an omp for), and ends
+   with a barrier
+ - For graphs other than CSRGraph & SplitWGraph (e.g. compressed),
+   neighborhoods can't be split cheaply, so vertices are just dynamically
+   scheduled
+*/
+
+
+template <typename NodeID_>
+class EdgeBalancer {
+ public:
+  static const int64_t kChunkEdges = 4096;
+
+  // Calls visit(u, v) for every out-edge in [begin, end), where v is a
+  // reference to the edge in the graph
+  template <typename DestID_, bool invert, typename IterT_, typename VisitorT_>
+  void ForEachEdge(const CSRGraph<NodeID_, DestID_, invert> &g, IterT_ begin,
+                   IterT_ end, VisitorT_ visit) {
+    ForEachEdgeChunked(g, begin, end, visit);
+  }
+
+  // Calls visit(u, wn) with each out-edge as a NodeWeight value
+  template <typename WeightT_, typename StoreT_, bool invert, typename IterT_,
+            typename VisitorT_>
+  void ForEachEdge(const SplitWGraph<NodeID_, WeightT_, StoreT_, invert> &g,
+                   IterT_ begin, IterT_ end, VisitorT_ visit) {
+    ForEachEdgeChunked(g, begin, end, visit);
+  }
+
+  template <typename GraphT_, typename IterT_, typename VisitorT_>
+  void ForEachEdge(const GraphT_ &g, IterT_ begin, IterT_ end,
+                   VisitorT_ visit) {
+    #pragma omp for schedule(dynamic, 64)
+    for (IterT_ it = begin; it < end; it++) {
+      NodeID_ u = *it;
+      for (NodeID_ v : g.out_neigh(u))
+        visit(u, v);
+    }
+  }
+
+ private:
+  // For graphs whose neighborhoods can start at an offset (out_neigh(u, i))
+  template <typename GraphT_, typename IterT_, typename VisitorT_>
+  void ForEachEdgeChunked(const GraphT_ &g, IterT_ begin, IterT_ end,
+                          VisitorT_ visit) {
+    std::vector<NodeID_> local_heavy;
+    #pragma omp for schedule(dynamic, 64) nowait
+    for (IterT_ it = begin; it < end; it++) {
+      NodeID_ u = *it;
+      if (g.out_degree(u) > kChunkEdges) {
+        local_heavy.push_back(u);
+      } else {
+        for (auto &&v : g.out_neigh(u))
+          visit(u, v);
+      }
+    }
+    if (!local_heavy.empty()) {
+      #pragma omp critical
+      heavy_.insert(heavy_.end(), local_heavy.begin(), local_heavy.end());
+    }
+    #pragma omp barrier
+    #pragma omp single
+    {
+      // Chunks of heavy vertex i are [chunk_starts_[i], chunk_starts_[i+1])
+      chunk_owners_.swap(heavy_);
+      heavy_.clear();
+      chunk_starts_.resize(chunk_owners_.size() + 1);
+      chunk_starts_[0] = 0;
+      for (size_t i=0; i < chunk_owners_.size(); i++) {
+        int64_t degree = g.out_degree(chunk_owners_[i]);
+        chunk_starts_[i+1] = chunk_starts_[i] +
+                             (degree + kChunkEdges - 1) / kChunkEdges;
+      }
+    }
+    int64_t num_chunks = chunk_starts_.back();
+    if (num_chunks == 0)
+      return;
+    #pragma omp for schedule(dynamic, 1)
+    for (int64_t c=0; c < num_chunks; c++) {
+      size_t i = std::upper_bound(chunk_starts_.begin(), chunk_starts_.end(),
+                                  c) - chunk_starts_.begin() - 1;
+      NodeID_ u = chunk_owners_[i];
+      int64_t chunk_begin = (c - chunk_starts_[i]) * kChunkEdges;
+      auto v = g.out_neigh(u, chunk_begin).begin();
+      auto chunk_end = g.out_neigh(u, chunk_begin + kChunkEdges).begin();
+      for (; v != chunk_end; ++v)
+        visit(u, *v);
+    }
+  }
+
+  std::vector<NodeID_> heavy_;
+  std::vector<NodeID_> chunk_owners_;
+  std::vector<int64_t> chunk_starts_;
+};
+
+#endif  // FRONTIER_H_
@@ -0,0 +1,100 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+
+/*
+GAP Benchmark Suite
+File:   Suite Runner (gapbs)
+Author: Scott Beamer
+
+Loads a graph once and then runs a plan of kernels on it, so a full suite
+run on a large input doesn't load and build the graph again for each kernel
+
+The plan (-P) has a line per kernel run, each a kernel (bc, bfs, cc, pr,
+sssp, or tc) followed by that kernel's options (e.g. "bfs -n64 -r 12"), just
+like requests to the server, whose KernelServer runs them. Unlike the server,
+kernels keep their own default trial counts. Without a plan, it runs the GAP
+suite with the same options as benchmark/bench.mk (kGAPSuite), except that
+sssp estimates its delta from the graph, since bench.mk's delta depends on the
+input (-d2, but -d50000 for road), so bench-suite passes those in its plan.
+
+sssp needs a weighted graph, so its variant is loaded from -w if given, or
+else built from the same input (so a plan with sssp on an input without
+weights, like a .sg, needs -w and is rejected before loading without it), and
+tc needs an undirected graph, so it runs on -U if given, or else on the input
+itself. Both variants are only loaded if the plan uses them, and then kept
+for later kernels.
+*/
+
+
+#define NO_SERVER_MAIN
+#include "server.cc"
+#undef NO_SERVER_MAIN
+
+
+using namespace std;
+
+
+const char kGAPSuite[] =
+    "bfs -n64\n"
+    "pr -i1000 -t1e-4 -n16\n"
+    "cc -n16\n"
+    "bc -i4 -n16\n"
+    "sssp -n64\n"
+    "tc -n3\n";
+
+
+// True if any line of plan runs kernel
+bool PlanUses(const string &plan, const string &kernel) {
+  istringstream lines(plan);
+  string line;
+  while (getline(lines, line)) {
+    istringstream tokens(line);
+    string first;
+    if ((tokens >> first) && (first == kernel))
+      return true;
+  }
+  return false;
+}
+
+
+int main(int argc, char* argv[]) {
+  CLSuite cli(argc, argv, "gap benchmark suite");
+  if (!cli.ParseArgs())
+    return -1;
+  string plan = kGAPSuite;
+  if (cli.plan_filename() != "") {
+    ifstream plan_file(cli.plan_filename());
+    if (!plan_file.is_open()) {
+      cout << "Couldn't open file " << cli.plan_filename() << endl;
+      return -1;
+    }
+    ostringstream plan_text;
+    plan_text << plan_file.rdbuf();
+    plan = plan_text.str();
+  }
+  if (PlanUses(plan, "sssp") &&
+      !KernelServer::HasWeightedInput(cli.filename(),
+                                      cli.weighted_filename())) {
+    cout << "Plan runs sssp, but " << cli.filename() << " has no weights "
+         << "(give a weighted variant with -w)" << endl;
+    return -1;
+  }
+  Builder b(cli);
+  Graph g = b.MakeGraph();
+  KernelServer suite(cli, std::move(g), false);
+  suite.set_variant_inputs(cli.weighted_filename(),
+                           cli.undirected_filename());
+  Timer t;
+  t.Start();
+  istringstream plan_lines(plan);
+  suite.Run(plan_lines);
+  t.Stop();
+  PrintTime("Suite Time", t.Seconds());
+  return 0;
+}
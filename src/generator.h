@@ -27,6 +27,17 @@ Given scale and degree, generates edgelist for synthetic graph
    to Graph500 parameters (uniform=false)
  - Can also randomize weights within a weighted edgelist (InsertWeights)
  - Blocking/reseeding is for parallelism with deterministic output edgelist
+ - Edges are generated a block at a time, with the vertex permutation (for
+   R-MAT) applied as each edge is made rather than in a pass afterwards
+ - StreamEL instead hands each block of edges (weighted if DestID_ is) to a
+   callback, so the entire edgelist is never held in memory, and since the
+   output is deterministic, it can be streamed again (e.g. to count degrees
+   and then to place edges)
+ - Fast mode (-q) uses a counter-based RNG (the hash of each random number's
+   index) that draws 16 bits per R-MAT level instead of 32, and it permutes
+   vertex IDs with an invertible hash instead of a shuffled array. It is much
+   faster and needs no per-vertex memory, but its graphs differ from the
+   default ones of the same scale.
 */
 
 
@@ -64,6 +75,16 @@ class UniDist {
 };
 
 
+// Counter-based RNG, the i-th number is the SplitMix64 hash of i, so any
+// range of the sequence can be generated independently (and in any order)
+inline uint64_t CounterRand(uint64_t counter) {
+  uint64_t z = (counter + kRandSeed) * 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+
 template <typename NodeID_, typename DestID_ = NodeID_,
           typename WeightT_ = NodeID_,
           typename uNodeID_ = typename std::make_unsigned<NodeID_>::type,
@@ -77,10 +98,11 @@ class Generator {
   typedef pvector<Edge> EdgeList;
 
  public:
-  Generator(int scale, int degree) {
+  Generator(int scale, int degree, bool fast = false) {
     scale_ = scale;
     num_nodes_ = 1l << scale;
     num_edges_ = num_nodes_ * degree;
+    fast_ = fast;
     if (num_nodes_ > std::numeric_limits<NodeID_>::max()) {
       std::cout << "NodeID type (max: " << std::numeric_limits<NodeID_>::max();
       std::cout << ") too small to hold " << num_nodes_ << std::endl;
@@ -90,78 +112,126 @@ class Generator {
     }
   }
 
-  void PermuteIDs(EdgeList &el) {
-    pvector<NodeID_> permutation(num_nodes_);
+  int64_t num_nodes() const { return num_nodes_; }
+
+  void MakePermutation() {
+    permutation_ = pvector<NodeID_>(num_nodes_);
     rng_t_ rng(kRandSeed);
     #pragma omp parallel for
     for (NodeID_ n=0; n < num_nodes_; n++)
-      permutation[n] = n;
-    shuffle(permutation.begin(), permutation.end(), rng);
-    #pragma omp parallel for
-    for (int64_t e=0; e < num_edges_; e++)
-      el[e] = Edge(permutation[el[e].u], permutation[el[e].v]);
+      permutation_[n] = n;
+    shuffle(permutation_.begin(), permutation_.end(), rng);
   }
 
-  EdgeList MakeUniformEL() {
-    EdgeList el(num_edges_);
-    #pragma omp parallel
-    {
-      rng_t_ rng;
-      UniDist<NodeID_, rng_t_> udist(num_nodes_-1, rng);
-      #pragma omp for
-      for (int64_t block=0; block < num_edges_; block+=block_size) {
-        rng.seed(kRandSeed + block/block_size);
-        for (int64_t e=block; e < std::min(block+block_size, num_edges_); e++) {
-          el[e] = Edge(udist(), udist());
-        }
+  // Bijection on [0, num_nodes_), rounds of multiplying by an odd constant
+  // and xor-shifting, which are each invertible modulo a power of two
+  NodeID_ HashPermute(NodeID_ n) const {
+    const uint64_t mask = num_nodes_ - 1;
+    const int shift = std::max(1, scale_ / 2);
+    uint64_t x = n;
+    x = (x * 0x9e3779b97f4a7c15ULL + 0x632be59bd9b4e019ULL) & mask;
+    x ^= x >> shift;
+    x = (x * 0xbf58476d1ce4e5b9ULL) & mask;
+    x ^= x >> shift;
+    x = (x * 0x94d049bb133111ebULL) & mask;
+    x ^= x >> shift;
+    return static_cast<NodeID_>(x);
+  }
+
+  void MakeUniformBlock(int64_t block_start, int64_t block_end, Edge *out) {
+    if (fast_) {
+      const uint64_t mask = num_nodes_ - 1;
+      for (int64_t e=block_start; e < block_end; e++) {
+        uint64_t rand_src = CounterRand(2*e), rand_dst = CounterRand(2*e + 1);
+        out[e - block_start] = Edge(static_cast<NodeID_>(rand_src & mask),
+                                    static_cast<NodeID_>(rand_dst & mask));
       }
+      return;
     }
-    return el;
+    rng_t_ rng(kRandSeed + block_start/block_size);
+    UniDist<NodeID_, rng_t_> udist(num_nodes_-1, rng);
+    for (int64_t e=block_start; e < block_end; e++)
+      out[e - block_start] = Edge(udist(), udist());
   }
 
-  EdgeList MakeRMatEL() {
+  void MakeRMatBlock(int64_t block_start, int64_t block_end, Edge *out) {
+    if (fast_) {
+      // 16 bits per level, so 4 levels per random number
+      const uint32_t max = 1 << 16;
+      const uint32_t A = 0.57*max, B = 0.19*max, C = 0.19*max;
+      const int scale = scale_;
+      const int64_t rands_per_edge = (scale + 3) / 4;
+      for (int64_t e=block_start; e < block_end; e++) {
+        uint64_t src = 0, dst = 0, rand_bits = 0;
+        for (int depth=0; depth < scale; depth++) {
+          if (depth % 4 == 0)
+            rand_bits = CounterRand(e*rands_per_edge + depth/4);
+          uint32_t rand_point = rand_bits & (max - 1);
+          rand_bits >>= 16;
+          // same quadrants as below, but branch-free
+          uint64_t src_bit = rand_point >= A+B;
+          uint64_t dst_bit = (rand_point > A) ^ src_bit ^ (rand_point > A+B+C);
+          src = (src << 1) | src_bit;
+          dst = (dst << 1) | dst_bit;
+        }
+        out[e - block_start] = Edge(HashPermute(src), HashPermute(dst));
+      }
+      return;
+    }
     const uint32_t max = std::numeric_limits<uint32_t>::max();
     const uint32_t A = 0.57*max, B = 0.19*max, C = 0.19*max;
-    EdgeList el(num_edges_);
+    std::mt19937 rng(kRandSeed + block_start/block_size);
+    for (int64_t e=block_start; e < block_end; e++) {
+      NodeID_ src = 0, dst = 0;
+      for (int depth=0; depth < scale_; depth++) {
+        uint32_t rand_point = rng();
+        src = src << 1;
+        dst = dst << 1;
+        if (rand_point < A+B) {
+          if (rand_point > A)
+            dst++;
+        } else {
+          src++;
+          if (rand_point > A+B+C)
+            dst++;
+        }
+      }
+      out[e - block_start] = Edge(permutation_[src], permutation_[dst]);
+    }
+  }
+
+  // Calls callback(block, el) for every block of edges (in parallel), where
+  // el holds that block's edges, weighted (InsertWeights) if DestID_ is
+  template <typename CallbackT_>
+  void StreamEL(bool uniform, CallbackT_ callback) {
+    if (!uniform && !fast_ && (permutation_.size() == 0))
+      MakePermutation();
     #pragma omp parallel
     {
-      std::mt19937 rng;
-      #pragma omp for
+      EdgeList el(block_size);
+      #pragma omp for schedule(dynamic, 1)
       for (int64_t block=0; block < num_edges_; block+=block_size) {
-        rng.seed(kRandSeed + block/block_size);
-        for (int64_t e=block; e < std::min(block+block_size, num_edges_); e++) {
-          NodeID_ src = 0, dst = 0;
-          for (int depth=0; depth < scale_; depth++) {
-            uint32_t rand_point = rng();
-            src = src << 1;
-            dst = dst << 1;
-            if (rand_point < A+B) {
-              if (rand_point > A)
-                dst++;
-            } else {
-              src++;
-              if (rand_point > A+B+C)
-                dst++;
-            }
-          }
-          el[e] = Edge(src, dst);
-        }
+        int64_t block_end = std::min(block+block_size, num_edges_);
+        el.resize(block_end - block);
+        MakeBlock(uniform, block, block_end, el.data());
+        WeighBlock(el.data(), el.size(), block/block_size);
+        callback(block/block_size, el);
       }
     }
-    PermuteIDs(el);
-    // TIME_PRINT("Shuffle", std::shuffle(el.begin(), el.end(),
-    //                                    std::mt19937()));
-    return el;
   }
 
   EdgeList GenerateEL(bool uniform) {
-    EdgeList el;
     Timer t;
     t.Start();
-    if (uniform)
-      el = MakeUniformEL();
-    else
-      el = MakeRMatEL();
+    if (!uniform && !fast_)
+      MakePermutation();
+    EdgeList el(num_edges_);
+    #pragma omp parallel for
+    for (int64_t block=0; block < num_edges_; block+=block_size) {
+      MakeBlock(uniform, block, std::min(block+block_size, num_edges_),
+                el.data() + block);
+    }
+    permutation_ = pvector<NodeID_>();
     t.Stop();
     PrintTime("Generate Time", t.Seconds());
     return el;
@@ -171,25 +241,39 @@ class Generator {
 
   // Overwrites existing weights with random from [1,255]
   static void InsertWeights(pvector<WEdge> &el) {
-    #pragma omp parallel
-    {
-      rng_t_ rng;
-      UniDist<WeightT_, rng_t_> udist(254, rng);
-      int64_t el_size = el.size();
-      #pragma omp for
-      for (int64_t block=0; block < el_size; block+=block_size) {
-        rng.seed(kRandSeed + block/block_size);
-        for (int64_t e=block; e < std::min(block+block_size, el_size); e++) {
-          el[e].v.w = static_cast<WeightT_>(udist()+1);
-        }
-      }
+    int64_t el_size = el.size();
+    #pragma omp parallel for
+    for (int64_t block=0; block < el_size; block+=block_size) {
+      WeighBlock(el.data() + block,
+                 std::min(block_size, el_size - block), block/block_size);
     }
   }
 
  private:
+  void MakeBlock(bool uniform, int64_t block_start, int64_t block_end,
+                 Edge *out) {
+    if (uniform)
+      MakeUniformBlock(block_start, block_end, out);
+    else
+      MakeRMatBlock(block_start, block_end, out);
+  }
+
+  static void WeighBlock(EdgePair<NodeID_, NodeID_> *edges, int64_t count,
+                         int64_t block) {}
+
+  // Same weights as InsertWeights gives these edges when in a whole edgelist
+  static void WeighBlock(WEdge *edges, int64_t count, int64_t block) {
+    rng_t_ rng(kRandSeed + block);
+    UniDist<WeightT_, rng_t_> udist(254, rng);
+    for (int64_t e=0; e < count; e++)
+      edges[e].v.w = static_cast<WeightT_>(udist()+1);
+  }
+
   int scale_;
   int64_t num_nodes_;
   int64_t num_edges_;
+  bool fast_;
+  pvector<NodeID_> permutation_;
   static const int64_t block_size = 1<<18;
 };
 
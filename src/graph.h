@@ -10,6 +10,11 @@
 #include <iostream>
 #include <type_traits>
 
+#include <sys/mman.h>
+
+#include "alloc.h"
+#include "numa.h"
+#include "partition.h"
 #include "pvector.h"
 #include "util.h"
 
@@ -23,6 +28,14 @@ Simple container for graph in CSR format
  - Intended to be constructed by a Builder
  - To make weighted, set DestID_ template type to NodeWeight
  - MakeInverse parameter controls whether graph stores incoming edges
+ - Neighborhoods are located by the prefix-summed offsets (as in the
+   serialized format), so no per-vertex pointer index is needed
+ - Arrays can live in a memory-mapped file (AdoptMapping), in which case they
+   are unmapped rather than deleted when the graph is destroyed
+ - PartitionNuma moves each NUMA node's block of vertices (and their edges)
+   onto that node (see numa.h)
+ - A relabeled graph (see reorder.h) keeps each vertex's ID from before
+   relabeling (original_id), so results can be reported in the input's IDs
 */
 
 
@@ -102,64 +115,78 @@ class CSRGraph {
 
   // Used to access neighbors of vertex, basically sugar for iterators
   class Neighborhood {
-    NodeID_ n_;
-    DestID_** g_index_;
-    OffsetT start_offset_;
+    DestID_* begin_;
+    DestID_* end_;
    public:
-    Neighborhood(NodeID_ n, DestID_** g_index, OffsetT start_offset) :
-        n_(n), g_index_(g_index), start_offset_(0) {
-      OffsetT max_offset = end() - begin();
-      start_offset_ = std::min(start_offset, max_offset);
+    Neighborhood(NodeID_ n, const SGOffset* g_offsets, DestID_* g_neighs,
+                 OffsetT start_offset) :
+        begin_(g_neighs + g_offsets[n]), end_(g_neighs + g_offsets[n+1]) {
+      OffsetT max_offset = end_ - begin_;
+      begin_ += std::min(start_offset, max_offset);
     }
     typedef DestID_* iterator;
-    iterator begin() { return g_index_[n_] + start_offset_; }
-    iterator end()   { return g_index_[n_+1]; }
+    iterator begin() { return begin_; }
+    iterator end()   { return end_; }
   };
 
   void ReleaseResources() {
-    if (out_index_ != nullptr)
-      delete[] out_index_;
+    if (mapping_ != nullptr) {
+      munmap(mapping_, mapping_bytes_);
+      return;
+    }
+    if (out_offsets_ != nullptr)
+      FreeArray(out_offsets_);
     if (out_neighbors_ != nullptr)
-      delete[] out_neighbors_;
+      FreeArray(out_neighbors_);
     if (directed_) {
-      if (in_index_ != nullptr)
-        delete[] in_index_;
+      if (in_offsets_ != nullptr)
+        FreeArray(in_offsets_);
       if (in_neighbors_ != nullptr)
-        delete[] in_neighbors_;
+        FreeArray(in_neighbors_);
     }
+    if (original_ids_ != nullptr)
+      FreeArray(original_ids_);
   }
 
 
  public:
   CSRGraph() : directed_(false), num_nodes_(-1), num_edges_(-1),
-    out_index_(nullptr), out_neighbors_(nullptr),
-    in_index_(nullptr), in_neighbors_(nullptr) {}
+    out_offsets_(nullptr), out_neighbors_(nullptr),
+    in_offsets_(nullptr), in_neighbors_(nullptr), original_ids_(nullptr),
+    mapping_(nullptr), mapping_bytes_(0) {}
 
-  CSRGraph(int64_t num_nodes, DestID_** index, DestID_* neighs) :
+  CSRGraph(int64_t num_nodes, SGOffset* offsets, DestID_* neighs) :
     directed_(false), num_nodes_(num_nodes),
-    out_index_(index), out_neighbors_(neighs),
-    in_index_(index), in_neighbors_(neighs) {
-      num_edges_ = (out_index_[num_nodes_] - out_index_[0]) / 2;
+    out_offsets_(offsets), out_neighbors_(neighs),
+    in_offsets_(offsets), in_neighbors_(neighs),
+    original_ids_(nullptr), mapping_(nullptr), mapping_bytes_(0) {
+      num_edges_ = (out_offsets_[num_nodes_] - out_offsets_[0]) / 2;
     }
 
-  CSRGraph(int64_t num_nodes, DestID_** out_index, DestID_* out_neighs,
-        DestID_** in_index, DestID_* in_neighs) :
+  CSRGraph(int64_t num_nodes, SGOffset* out_offsets, DestID_* out_neighs,
+        SGOffset* in_offsets, DestID_* in_neighs) :
     directed_(true), num_nodes_(num_nodes),
-    out_index_(out_index), out_neighbors_(out_neighs),
-    in_index_(in_index), in_neighbors_(in_neighs) {
-      num_edges_ = out_index_[num_nodes_] - out_index_[0];
+    out_offsets_(out_offsets), out_neighbors_(out_neighs),
+    in_offsets_(in_offsets), in_neighbors_(in_neighs),
+    original_ids_(nullptr), mapping_(nullptr), mapping_bytes_(0) {
+      num_edges_ = out_offsets_[num_nodes_] - out_offsets_[0];
     }
 
   CSRGraph(CSRGraph&& other) : directed_(other.directed_),
     num_nodes_(other.num_nodes_), num_edges_(other.num_edges_),
-    out_index_(other.out_index_), out_neighbors_(other.out_neighbors_),
-    in_index_(other.in_index_), in_neighbors_(other.in_neighbors_) {
+    out_offsets_(other.out_offsets_), out_neighbors_(other.out_neighbors_),
+    in_offsets_(other.in_offsets_), in_neighbors_(other.in_neighbors_),
+    original_ids_(other.original_ids_), mapping_(other.mapping_),
+    mapping_bytes_(other.mapping_bytes_) {
       other.num_edges_ = -1;
       other.num_nodes_ = -1;
-      other.out_index_ = nullptr;
+      other.out_offsets_ = nullptr;
       other.out_neighbors_ = nullptr;
-      other.in_index_ = nullptr;
+      other.in_offsets_ = nullptr;
       other.in_neighbors_ = nullptr;
+      other.original_ids_ = nullptr;
+      other.mapping_ = nullptr;
+      other.mapping_bytes_ = 0;
   }
 
   ~CSRGraph() {
@@ -172,20 +199,76 @@ class CSRGraph {
       directed_ = other.directed_;
       num_edges_ = other.num_edges_;
       num_nodes_ = other.num_nodes_;
-      out_index_ = other.out_index_;
+      out_offsets_ = other.out_offsets_;
       out_neighbors_ = other.out_neighbors_;
-      in_index_ = other.in_index_;
+      in_offsets_ = other.in_offsets_;
       in_neighbors_ = other.in_neighbors_;
+      original_ids_ = other.original_ids_;
+      mapping_ = other.mapping_;
+      mapping_bytes_ = other.mapping_bytes_;
+      out_blocks_ = VertexPartition<NodeID_>();
+      in_blocks_ = VertexPartition<NodeID_>();
       other.num_edges_ = -1;
       other.num_nodes_ = -1;
-      other.out_index_ = nullptr;
+      other.out_offsets_ = nullptr;
       other.out_neighbors_ = nullptr;
-      other.in_index_ = nullptr;
+      other.in_offsets_ = nullptr;
       other.in_neighbors_ = nullptr;
+      other.original_ids_ = nullptr;
+      other.mapping_ = nullptr;
+      other.mapping_bytes_ = 0;
     }
     return *this;
   }
 
+  // Graph takes ownership of mapped region that holds all of its arrays
+  void AdoptMapping(void *mapping, size_t mapping_bytes) {
+    mapping_ = mapping;
+    mapping_bytes_ = mapping_bytes;
+  }
+
+  // Graph takes ownership of array (or it points into mapping) that gives
+  //   each vertex's ID before the graph was relabeled
+  void SetOriginalIDs(NodeID_ *original_ids) {
+    if ((original_ids_ != nullptr) && (mapping_ == nullptr))
+      FreeArray(original_ids_);
+    original_ids_ = original_ids;
+  }
+
+  bool relabeled() const {
+    return original_ids_ != nullptr;
+  }
+
+  NodeID_ original_id(NodeID_ n) const {
+    return original_ids_ != nullptr ? original_ids_[n] : n;
+  }
+
+  // Inverse of original_id (linear search, so intended for a few vertices)
+  NodeID_ relabeled_id(NodeID_ original) const {
+    if (original_ids_ == nullptr)
+      return original;
+    for (NodeID_ n=0; n < num_nodes_; n++) {
+      if (original_ids_[n] == original)
+        return n;
+    }
+    return -1;
+  }
+
+  // Moves arrays for block of vertices onto NUMA node that will process it
+  void PartitionNuma() const {
+    if (mapping_ != nullptr)
+      return;
+    int num_blocks = NumaNumNodes();
+    for (int b=0; b < num_blocks; b++) {
+      int64_t low = num_nodes_ * b / num_blocks;
+      int64_t high = num_nodes_ * (b+1) / num_blocks;
+      int node = NumaNodeOfBlock(b, num_blocks);
+      PartitionRange(out_offsets_, out_neighbors_, low, high, node);
+      if (directed_ && MakeInverse)
+        PartitionRange(in_offsets_, in_neighbors_, low, high, node);
+    }
+  }
+
   bool directed() const {
     return directed_;
   }
@@ -203,21 +286,21 @@ class CSRGraph {
   }
 
   int64_t out_degree(NodeID_ v) const {
-    return out_index_[v+1] - out_index_[v];
+    return out_offsets_[v+1] - out_offsets_[v];
   }
 
   int64_t in_degree(NodeID_ v) const {
     static_assert(MakeInverse, "Graph inversion disabled but reading inverse");
-    return in_index_[v+1] - in_index_[v];
+    return in_offsets_[v+1] - in_offsets_[v];
   }
 
   Neighborhood out_neigh(NodeID_ n, OffsetT start_offset = 0) const {
-    return Neighborhood(n, out_index_, start_offset);
+    return Neighborhood(n, out_offsets_, out_neighbors_, start_offset);
   }
 
   Neighborhood in_neigh(NodeID_ n, OffsetT start_offset = 0) const {
     static_assert(MakeInverse, "Graph inversion disabled but reading inverse");
-    return Neighborhood(n, in_index_, start_offset);
+    return Neighborhood(n, in_offsets_, in_neighbors_, start_offset);
   }
 
   void PrintStats() const {
@@ -239,37 +322,58 @@ class CSRGraph {
     }
   }
 
-  static DestID_** GenIndex(const pvector<SGOffset> &offsets, DestID_* neighs) {
-    NodeID_ length = offsets.size();
-    DestID_** index = new DestID_*[length];
+  // Copies offsets into a new array so the graph can own it
+  static SGOffset* CopyOffsets(const pvector<SGOffset> &offsets) {
+    SGOffset* copy = AllocArray<SGOffset>(offsets.size());
     #pragma omp parallel for
-    for (NodeID_ n=0; n < length; n++)
-      index[n] = neighs + offsets[n];
-    return index;
+    for (size_t n=0; n < offsets.size(); n++)
+      copy[n] = offsets[n];
+    return copy;
   }
 
   pvector<SGOffset> VertexOffsets(bool in_graph = false) const {
-    pvector<SGOffset> offsets(num_nodes_+1);
+    const SGOffset* offsets = in_graph ? in_offsets_ : out_offsets_;
+    pvector<SGOffset> copy(num_nodes_+1);
     for (NodeID_ n=0; n < num_nodes_+1; n++)
-      if (in_graph)
-        offsets[n] = in_index_[n] - in_index_[0];
-      else
-        offsets[n] = out_index_[n] - out_index_[0];
-    return offsets;
+      copy[n] = offsets[n] - offsets[0];
+    return copy;
   }
 
   Range<NodeID_> vertices() const {
     return Range<NodeID_>(num_nodes());
   }
 
+  // Vertex blocks with about equal out (or in) edges, built on first use
+  // (needs to be called from outside a parallel region)
+  const VertexPartition<NodeID_>& VertexBlocks(bool in_graph = false) const {
+    if (!in_graph || !directed_) {
+      out_blocks_.Update(out_offsets_, num_nodes_);
+      return out_blocks_;
+    }
+    in_blocks_.Update(in_offsets_, num_nodes_);
+    return in_blocks_;
+  }
+
  private:
+  static void PartitionRange(const SGOffset *offsets, const DestID_ *neighs,
+                             int64_t low, int64_t high, int node) {
+    NumaBindRange(offsets + low, (high - low) * sizeof(SGOffset), node);
+    NumaBindRange(neighs + offsets[low],
+                  (offsets[high] - offsets[low]) * sizeof(DestID_), node);
+  }
+
   bool directed_;
   int64_t num_nodes_;
   int64_t num_edges_;
-  DestID_** out_index_;
+  SGOffset* out_offsets_;
   DestID_*  out_neighbors_;
-  DestID_** in_index_;
+  SGOffset* in_offsets_;
   DestID_*  in_neighbors_;
+  NodeID_*  original_ids_;
+  void*     mapping_;
+  size_t    mapping_bytes_;
+  mutable VertexPartition<NodeID_> out_blocks_;
+  mutable VertexPartition<NodeID_> in_blocks_;
 };
 
 #endif  // GRAPH_H_
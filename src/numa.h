@@ -0,0 +1,210 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef NUMA_H_
+#define NUMA_H_
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+/*
+GAP Benchmark Suite
+File:   NUMA
+Author: Scott Beamer
+
+Optional NUMA-aware placement (-N policy), using syscalls (no libnuma)
+ - interleave: all later allocations are interleaved across NUMA nodes
+ - partition: threads are bound to NUMA nodes in blocks, so statically
+   scheduled loops (like pvector's fill) first-touch vertex ranges local to
+   the thread that will process them, and graph arrays are moved to match
+   (CSRGraph::PartitionNuma)
+ - Long-running vertex loops use schedule(runtime), which is dynamic,16384
+   by default and static with partition, so threads stay on their own range
+   (pull loops using partition.h switch to it only with partition)
+ - Memory-mapped graphs (-M) stay wherever the OS file cache put them
+ - If the number of threads changes (e.g. a -T sweep), NumaBindThreads binds
+   them again, so each thread's static range stays on its node
+ - On other platforms, or with a single NUMA node, policies have no effect
+*/
+
+
+static const int kMPolBind = 2;
+static const int kMPolInterleave = 3;
+static const unsigned kMPolMFMove = 1 << 1;
+
+// Parses lists like "0-3,8-11" as used by sysfs
+inline std::vector<int> NumaParseList(const std::string &list) {
+  std::vector<int> ids;
+  std::stringstream ss(list);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    int lo, hi;
+    int found = std::sscanf(range.c_str(), "%d-%d", &lo, &hi);
+    if (found == 1)
+      hi = lo;
+    if (found >= 1)
+      for (int i=lo; i <= hi; i++)
+        ids.push_back(i);
+  }
+  return ids;
+}
+
+inline std::vector<int> NumaReadSysList(const std::string &path) {
+  std::ifstream file(path);
+  std::string list;
+  std::getline(file, list);
+  return NumaParseList(list);
+}
+
+inline const std::vector<int>& NumaNodes() {
+  static const std::vector<int> nodes =
+      NumaReadSysList("/sys/devices/system/node/online");
+  return nodes;
+}
+
+inline int NumaNumNodes() {
+  return std::max(static_cast<int>(NumaNodes().size()), 1);
+}
+
+// NUMA node for block b of num_blocks, used to block-distribute both
+// threads and vertex ranges, so static schedules line up
+inline int NumaNodeOfBlock(int64_t b, int64_t num_blocks) {
+  if (NumaNodes().empty())
+    return 0;
+  return NumaNodes()[b * NumaNumNodes() / num_blocks];
+}
+
+#if defined(__linux__)
+inline long NumaSetMemPolicy(int mode,
+                             const std::vector<unsigned long> &mask) {
+  return syscall(SYS_set_mempolicy, mode, mask.data(), mask.size() * 64);
+}
+
+inline long NumaMBind(void *addr, size_t bytes, int mode,
+                      const std::vector<unsigned long> &mask, unsigned flags) {
+  return syscall(SYS_mbind, addr, bytes, mode, mask.data(),
+                 mask.size() * 64, flags);
+}
+
+inline
+std::vector<unsigned long> NumaNodeMask(const std::vector<int> &nodes) {
+  std::vector<unsigned long> mask(1, 0);
+  for (int n : nodes) {
+    if (static_cast<size_t>(n / 64) >= mask.size())
+      mask.resize(n / 64 + 1, 0);
+    mask[n / 64] |= 1ul << (n % 64);
+  }
+  // kernel mask size excludes the last bit, so leave room
+  mask.push_back(0);
+  return mask;
+}
+
+// Pins calling thread to CPUs of NUMA node
+inline void NumaBindThread(int node) {
+  std::vector<int> cpus = NumaReadSysList("/sys/devices/system/node/node" +
+                                          std::to_string(node) + "/cpulist");
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus)
+    CPU_SET(cpu, &cpu_set);
+  sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+}
+
+// Moves (page-aligned superset of) range onto NUMA node
+inline void NumaBindRange(const void *start, size_t bytes, int node) {
+  if (bytes == 0)
+    return;
+  const uintptr_t kPageSize = sysconf(_SC_PAGESIZE);
+  uintptr_t begin = reinterpret_cast<uintptr_t>(start) & ~(kPageSize - 1);
+  uintptr_t end = reinterpret_cast<uintptr_t>(start) + bytes;
+  NumaMBind(reinterpret_cast<void*>(begin), end - begin, kMPolBind,
+            NumaNodeMask(std::vector<int>(1, node)), kMPolMFMove);
+}
+#else
+inline void NumaBindRange(const void *start, size_t bytes, int node) {}
+#endif
+
+inline bool &NumaPartitioned() {
+  static bool partitioned = false;
+  return partitioned;
+}
+
+// With partition, binds each thread to the node of its block (for the current
+// number of threads), so it can be redone if the number of threads changes
+// (needs to be called from outside a parallel region)
+inline void NumaBindThreads() {
+#if defined(__linux__)
+  if (!NumaPartitioned())
+    return;
+  #pragma omp parallel
+  {
+#ifdef _OPENMP
+    int t = omp_get_thread_num();
+    int num_threads = omp_get_num_threads();
+#else
+    int t = 0;
+    int num_threads = 1;
+#endif
+    NumaBindThread(NumaNodeOfBlock(t, num_threads));
+  }
+#endif
+}
+
+// Sets up policy (from -N) before graph is built, needs to be called from
+// outside a parallel region
+inline void NumaSetup(const std::string &policy) {
+  const int kDefaultChunk = 16384;
+#ifdef _OPENMP
+  omp_set_schedule(omp_sched_dynamic, kDefaultChunk);
+#endif
+  if (policy == "")
+    return;
+  if ((policy != "interleave") && (policy != "partition")) {
+    std::cout << "Unrecognized NUMA policy: " << policy << std::endl;
+    std::exit(-36);
+  }
+#if defined(__linux__)
+  if (NumaNumNodes() == 1) {
+    std::cout << "Only one NUMA node, ignoring NUMA policy" << std::endl;
+    return;
+  }
+  std::vector<unsigned long> all_nodes = NumaNodeMask(NumaNodes());
+  bool interleave = policy == "interleave";
+  // memory policy and affinity are per thread, so set in every thread
+  if (interleave) {
+    #pragma omp parallel
+    NumaSetMemPolicy(kMPolInterleave, all_nodes);
+  } else {
+    NumaPartitioned() = true;
+    NumaBindThreads();
+  }
+#ifdef _OPENMP
+  if (!interleave)
+    omp_set_schedule(omp_sched_static, 0);
+#endif
+  std::cout << "NUMA policy " << policy << " across " << NumaNumNodes()
+            << " nodes" << std::endl;
+#else
+  std::cout << "NUMA policies only supported on Linux" << std::endl;
+#endif
+}
+
+#endif  // NUMA_H_
@@ -0,0 +1,132 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef PARALLEL_IO_H_
+#define PARALLEL_IO_H_
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <type_traits>
+#include <vector>
+
+
+/*
+GAP Benchmark Suite
+File:   Parallel I/O
+Author: Scott Beamer
+
+Reads & writes large arrays of serialized graphs with many streams at once
+ - Each array is cut into chunks (kIOChunkBytes) that are spread dynamically
+   across threads, and each thread issues its own pread/pwrite at its chunk's
+   position, so file systems that serve parallel requests faster than a
+   single stream (e.g. network or parallel file systems) are kept busy
+ - The thread reading a chunk is the first to touch its pages, so arrays are
+   also placed on the NUMA nodes of the threads that read them
+ - If the file's element type differs from memory's (other ID width), each
+   thread converts its chunk from a buffer, overlapping conversion with the
+   other threads' reads
+ - All return false on any error (including reading past the end of file)
+*/
+
+
+static const int64_t kIOChunkBytes = 16 << 20;
+
+
+// Retries until all of num_bytes is transferred (pread/pwrite can be short)
+template <typename BufT_, typename TransferFunc>
+bool TransferFully(TransferFunc transfer, BufT_ *buf, int64_t num_bytes,
+                   int64_t pos) {
+  while (num_bytes > 0) {
+    ssize_t done = transfer(buf, num_bytes, pos);
+    if (done <= 0) {
+      if ((done == -1) && (errno == EINTR))
+        continue;
+      return false;
+    }
+    buf += done;
+    pos += done;
+    num_bytes -= done;
+  }
+  return true;
+}
+
+inline bool PReadFully(int fd, void *dest, int64_t num_bytes, int64_t pos) {
+  auto transfer = [fd](char *buf, int64_t n, int64_t p) {
+    return pread(fd, buf, n, p);
+  };
+  return TransferFully(transfer, static_cast<char*>(dest), num_bytes, pos);
+}
+
+inline bool PWriteFully(int fd, const void *src, int64_t num_bytes,
+                        int64_t pos) {
+  auto transfer = [fd](const char *buf, int64_t n, int64_t p) {
+    return pwrite(fd, buf, n, p);
+  };
+  return TransferFully(transfer, static_cast<const char*>(src), num_bytes,
+                       pos);
+}
+
+
+// Reads num_bytes at pos of fd into dest, a chunk per thread at a time
+inline bool ParallelRead(int fd, int64_t pos, int64_t num_bytes, void *dest) {
+  int64_t num_chunks = (num_bytes + kIOChunkBytes - 1) / kIOChunkBytes;
+  bool ok = true;
+  #pragma omp parallel for schedule(dynamic, 1) reduction(&& : ok)
+  for (int64_t c=0; c < num_chunks; c++) {
+    int64_t begin = c * kIOChunkBytes;
+    int64_t chunk_bytes = std::min(kIOChunkBytes, num_bytes - begin);
+    ok = PReadFully(fd, static_cast<char*>(dest) + begin, chunk_bytes,
+                    pos + begin) && ok;
+  }
+  return ok;
+}
+
+// Writes num_bytes of src at pos of fd, a chunk per thread at a time
+inline bool ParallelWrite(int fd, int64_t pos, int64_t num_bytes,
+                          const void *src) {
+  int64_t num_chunks = (num_bytes + kIOChunkBytes - 1) / kIOChunkBytes;
+  bool ok = true;
+  #pragma omp parallel for schedule(dynamic, 1) reduction(&& : ok)
+  for (int64_t c=0; c < num_chunks; c++) {
+    int64_t begin = c * kIOChunkBytes;
+    int64_t chunk_bytes = std::min(kIOChunkBytes, num_bytes - begin);
+    ok = PWriteFully(fd, static_cast<const char*>(src) + begin, chunk_bytes,
+                     pos + begin) && ok;
+  }
+  return ok;
+}
+
+// Reads count elements of type FileT_ at pos into dest, converting them if
+//   the types differ (with a buffer per thread)
+template <typename FileT_, typename T_, typename ConvertT_>
+bool ParallelReadConverted(int fd, int64_t pos, int64_t count, T_ *dest,
+                           ConvertT_ convert) {
+  if (std::is_same<FileT_, T_>::value)
+    return ParallelRead(fd, pos, count * sizeof(T_), dest);
+  const int64_t kChunkSize = kIOChunkBytes / sizeof(FileT_);
+  int64_t num_chunks = (count + kChunkSize - 1) / kChunkSize;
+  bool ok = true;
+  #pragma omp parallel reduction(&& : ok)
+  {
+    std::vector<FileT_> buffer;
+    #pragma omp for schedule(dynamic, 1)
+    for (int64_t c=0; c < num_chunks; c++) {
+      int64_t begin = c * kChunkSize;
+      int64_t chunk = std::min(kChunkSize, count - begin);
+      buffer.resize(chunk);
+      if (!PReadFully(fd, buffer.data(), chunk * sizeof(FileT_),
+                      pos + begin * sizeof(FileT_))) {
+        ok = false;
+        continue;
+      }
+      for (int64_t i=0; i < chunk; i++)
+        dest[begin + i] = convert(buffer[i]);
+    }
+  }
+  return ok;
+}
+
+#endif  // PARALLEL_IO_H_
@@ -0,0 +1,162 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef PARALLEL_SORT_H_
+#define PARALLEL_SORT_H_
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <type_traits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "pvector.h"
+
+
+/*
+GAP Benchmark Suite
+File:   Parallel Sort
+Author: Scott Beamer
+
+Sorts a single large array with all threads, for when one array (e.g. a hub's
+neighborhood or a whole edgelist) would otherwise be sorted by one thread
+ - Integers are radix sorted (LSD, 8 bits per pass), with each thread
+   counting and then scattering its own contiguous slice, so it is stable
+   and every pass splits evenly. Keys are offset by the minimum value, so
+   only the bytes the values actually span get a pass.
+ - Other types (e.g. NodeWeight & EdgePair) are merge sorted: each thread
+   std::sorts a slice, and then slices are merged pairwise in parallel
+ - Both give the same order as std::sort, so results don't change
+ - Must be called outside of a parallel region
+*/
+
+
+inline int SortThreads() {
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+
+template <typename T_>
+void ParallelMergeSort(T_ *begin, T_ *end) {
+  int64_t n = end - begin;
+  int64_t num_slices = SortThreads();
+  if ((num_slices == 1) || (n < 2 * num_slices)) {
+    std::sort(begin, end);
+    return;
+  }
+  std::vector<int64_t> bounds(num_slices + 1);
+  for (int64_t s=0; s <= num_slices; s++)
+    bounds[s] = n * s / num_slices;
+  #pragma omp parallel for schedule(dynamic, 1)
+  for (int64_t s=0; s < num_slices; s++)
+    std::sort(begin + bounds[s], begin + bounds[s+1]);
+  pvector<T_> buffer(n);
+  T_ *src = begin;
+  T_ *dst = buffer.data();
+  for (int64_t width=1; width < num_slices; width*=2) {
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int64_t s=0; s < num_slices; s+=2*width) {
+      int64_t mid = bounds[std::min(s + width, num_slices)];
+      int64_t right = bounds[std::min(s + 2*width, num_slices)];
+      std::merge(src + bounds[s], src + mid, src + mid, src + right,
+                 dst + bounds[s]);
+    }
+    std::swap(src, dst);
+  }
+  if (src != begin) {
+    #pragma omp parallel for
+    for (int64_t i=0; i < n; i++)
+      begin[i] = src[i];
+  }
+}
+
+
+template <typename T_>
+void ParallelRadixSort(T_ *begin, T_ *end) {
+  typedef typename std::make_unsigned<T_>::type KeyT;
+  const int64_t kRadix = 256;
+  int64_t n = end - begin;
+  if (n < 2)
+    return;
+  T_ min_value = *std::min_element(begin, end);
+  T_ max_value = *std::max_element(begin, end);
+  KeyT key_range = static_cast<KeyT>(max_value) - static_cast<KeyT>(min_value);
+  int num_passes = 0;
+  while ((num_passes < static_cast<int>(sizeof(KeyT))) &&
+         ((key_range >> (8 * num_passes)) != 0))
+    num_passes++;
+  if (num_passes == 0)
+    return;
+  auto digit = [&](T_ x, int shift) {
+    KeyT key = static_cast<KeyT>(x) - static_cast<KeyT>(min_value);
+    return static_cast<int64_t>((key >> shift) & (kRadix - 1));
+  };
+  pvector<T_> buffer(n);
+  T_ *src = begin;
+  T_ *dst = buffer.data();
+  std::vector<std::array<int64_t, kRadix>> counts(SortThreads());
+  for (int pass=0; pass < num_passes; pass++) {
+    int shift = 8 * pass;
+    #pragma omp parallel
+    {
+#ifdef _OPENMP
+      int tid = omp_get_thread_num();
+      int num_threads = omp_get_num_threads();
+#else
+      int tid = 0;
+      int num_threads = 1;
+#endif
+      int64_t slice_begin = n * tid / num_threads;
+      int64_t slice_end = n * (tid+1) / num_threads;
+      std::array<int64_t, kRadix> &local = counts[tid];
+      local.fill(0);
+      for (int64_t i=slice_begin; i < slice_end; i++)
+        local[digit(src[i], shift)]++;
+      #pragma omp barrier
+      #pragma omp single
+      {
+        // Each thread's start for each digit: after all smaller digits, and
+        // after lower threads with the same digit
+        int64_t total = 0;
+        for (int64_t d=0; d < kRadix; d++) {
+          for (int t=0; t < num_threads; t++) {
+            int64_t count = counts[t][d];
+            counts[t][d] = total;
+            total += count;
+          }
+        }
+      }
+      for (int64_t i=slice_begin; i < slice_end; i++)
+        dst[local[digit(src[i], shift)]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+  if (src != begin) {
+    #pragma omp parallel for
+    for (int64_t i=0; i < n; i++)
+      begin[i] = src[i];
+  }
+}
+
+
+template <typename T_>
+typename std::enable_if<std::is_integral<T_>::value>::type
+ParallelSort(T_ *begin, T_ *end) {
+  ParallelRadixSort(begin, end);
+}
+
+template <typename T_>
+typename std::enable_if<!std::is_integral<T_>::value>::type
+ParallelSort(T_ *begin, T_ *end) {
+  ParallelMergeSort(begin, end);
+}
+
+#endif  // PARALLEL_SORT_H_
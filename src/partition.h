@@ -0,0 +1,127 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef PARTITION_H_
+#define PARTITION_H_
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "numa.h"
+
+
+/*
+GAP Benchmark Suite
+Class:  VertexPartition
+Author: Scott Beamer
+
+Contiguous blocks of vertices with about equal work, for pull-style loops
+ - Work of a vertex range is its edges (from the graph's offsets) plus its
+   vertices, so blocks with many low-degree vertices aren't too big either
+ - kBlocksPerThread blocks per thread are scheduled one at a time, so a block
+   with a slow vertex doesn't stall its thread's whole share
+ - Graphs build their partitions lazily and keep them (VertexBlocks), and they
+   are only rebuilt if the number of threads changes
+ - ParallelForVertices & ParallelSumVertices run a loop body on every vertex
+   using the blocks. With NUMA partitioning (-N partition), they instead keep
+   schedule(runtime) over vertices, so threads stay on the vertex ranges that
+   were placed on their node.
+*/
+
+
+template <typename NodeID_>
+class VertexPartition {
+ public:
+  static const int kBlocksPerThread = 16;
+
+  // (Re)builds blocks from offsets, unless already built for this many threads
+  template <typename OffsetT_>
+  void Update(const OffsetT_ *offsets, int64_t num_nodes) {
+#ifdef _OPENMP
+    int num_threads = omp_get_max_threads();
+#else
+    int num_threads = 1;
+#endif
+    if ((num_threads == num_threads_) && !bounds_.empty())
+      return;
+    num_threads_ = num_threads;
+    int64_t num_blocks = static_cast<int64_t>(num_threads) * kBlocksPerThread;
+    num_blocks = std::max(static_cast<int64_t>(1),
+                          std::min(num_blocks, num_nodes));
+    auto work = [&](int64_t n) { return offsets[n] - offsets[0] + n; };
+    int64_t total_work = work(num_nodes);
+    bounds_.resize(num_blocks + 1);
+    bounds_[0] = 0;
+    for (int64_t b=1; b < num_blocks; b++) {
+      // first vertex whose preceding work reaches this block's share
+      int64_t target = total_work * b / num_blocks;
+      int64_t low = bounds_[b-1], high = num_nodes;
+      while (low < high) {
+        int64_t mid = low + (high - low) / 2;
+        if (work(mid) < target)
+          low = mid + 1;
+        else
+          high = mid;
+      }
+      bounds_[b] = low;
+    }
+    bounds_[num_blocks] = num_nodes;
+  }
+
+  int64_t num_blocks() const { return bounds_.size() - 1; }
+
+  NodeID_ block_begin(int64_t b) const { return bounds_[b]; }
+
+  NodeID_ block_end(int64_t b) const { return bounds_[b+1]; }
+
+  NodeID_ num_nodes() const { return bounds_.back(); }
+
+ private:
+  int num_threads_ = 0;
+  std::vector<NodeID_> bounds_;
+};
+
+
+// Calls body(n) for every vertex n, with blocks as the unit of scheduling
+template <typename NodeID_, typename BodyT_>
+void ParallelForVertices(const VertexPartition<NodeID_> &blocks,
+                         BodyT_ body) {
+  if (NumaPartitioned()) {
+    #pragma omp parallel for schedule(runtime)
+    for (NodeID_ n=0; n < blocks.num_nodes(); n++)
+      body(n);
+    return;
+  }
+  #pragma omp parallel for schedule(dynamic, 1)
+  for (int64_t b=0; b < blocks.num_blocks(); b++) {
+    for (NodeID_ n=blocks.block_begin(b); n < blocks.block_end(b); n++)
+      body(n);
+  }
+}
+
+
+// Same as ParallelForVertices, but returns the sum of what body(n) returns
+template <typename SumT_, typename NodeID_, typename BodyT_>
+SumT_ ParallelSumVertices(const VertexPartition<NodeID_> &blocks,
+                          BodyT_ body) {
+  SumT_ sum = 0;
+  if (NumaPartitioned()) {
+    #pragma omp parallel for reduction(+ : sum) schedule(runtime)
+    for (NodeID_ n=0; n < blocks.num_nodes(); n++)
+      sum += body(n);
+    return sum;
+  }
+  #pragma omp parallel for reduction(+ : sum) schedule(dynamic, 1)
+  for (int64_t b=0; b < blocks.num_blocks(); b++) {
+    for (NodeID_ n=blocks.block_begin(b); n < blocks.block_end(b); n++)
+      sum += body(n);
+  }
+  return sum;
+}
+
+#endif  // PARTITION_H_
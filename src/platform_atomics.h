@@ -26,6 +26,11 @@ Wrappers for compiler intrinsics for atomic memory operations (AMOs)
       return __sync_fetch_and_add(&x, inc);
     }
 
+    template<typename T, typename U>
+    T fetch_and_or(T &x, U bits) {
+      return __sync_fetch_and_or(&x, bits);
+    }
+
     template<typename T>
     bool compare_and_swap(T &x, const T &old_val, const T &new_val) {
       return __sync_bool_compare_and_swap(&x, old_val, new_val);
@@ -70,6 +75,14 @@ Wrappers for compiler intrinsics for atomic memory operations (AMOs)
       return atomic_add_64_nv((volatile uint64_t*) &x, inc) - inc;
     }
 
+    uint64_t fetch_and_or(uint64_t &x, uint64_t bits) {
+      uint64_t orig_val = x;
+      while (orig_val != atomic_cas_64((volatile uint64_t*) &x, orig_val,
+                                       orig_val | bits))
+        orig_val = x;
+      return orig_val;
+    }
+
     bool compare_and_swap(int32_t &x, const int32_t &old_val, const int32_t &new_val) {
       return old_val == atomic_cas_32((volatile uint32_t*) &x, old_val, new_val);
     }
@@ -115,6 +128,13 @@ Wrappers for compiler intrinsics for atomic memory operations (AMOs)
     return orig_val;
   }
 
+  template<typename T, typename U>
+  T fetch_and_or(T &x, U bits) {
+    T orig_val = x;
+    x |= bits;
+    return orig_val;
+  }
+
   template<typename T>
   bool compare_and_swap(T &x, const T &old_val, const T &new_val) {
     if (x == old_val) {
@@ -2,14 +2,23 @@
 // See LICENSE.txt for license details
 
 #include <algorithm>
+#include <cinttypes>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "benchmark.h"
 #include "builder.h"
 #include "command_line.h"
 #include "graph.h"
+#include "parallel_sort.h"
+#include "partition.h"
+#include "platform_atomics.h"
 #include "pvector.h"
+#include "sliding_queue.h"
 
 /*
 GAP Benchmark Suite
@@ -21,7 +30,21 @@ Will return pagerank scores for all vertices once total change < epsilon
 This PR implementation uses the traditional iterative approach. It performs
 updates in the pull direction to remove the need for atomics, and it allows
 new values to be immediately visible (like Gauss-Seidel method). The prior PR
-implementation is still available in src/pr_spmv.cc.
+implementation is still available in src/pr_spmv.cc. The kernel also runs on
+compressed graphs (.csg). The vertex loop is scheduled in blocks of about
+equal in-edges (ParallelSumVertices), or statically with NUMA partitioning
+(-N partition) so each thread works on its own local vertex range.
+
+After a small change to the graph, PageRank can start from the scores of an
+earlier run (-y, written with -z), since those are already close. With -e,
+it instead propagates changes (PageRankDelta): each vertex tracks its residual
+(how far its score is from what its in-neighbors imply), and each round only
+vertices whose residual exceeds epsilon/|V| add it to their score and push it
+to their out-neighbors' residuals, until the total residual is below epsilon.
+Pushes queue the neighbors they take over that threshold for the next round
+and update the total residual, so a round never scans all vertices. Work per
+round shrinks as scores converge, and when started from nearby scores, only
+vertices near the change do any.
 */
 
 
@@ -31,27 +54,40 @@ typedef float ScoreT;
 const float kDamp = 0.85;
 
 
-pvector<ScoreT> PageRankPullGS(const Graph &g, int max_iters, double epsilon=0,
-                               bool logging_enabled = false) {
-  const ScoreT init_score = 1.0f / g.num_nodes();
+// Starting scores, either uniform or copied from init_scores
+template <typename GraphT_>
+pvector<ScoreT> InitialScores(const GraphT_ &g,
+                              const pvector<ScoreT> *init_scores) {
+  pvector<ScoreT> scores(g.num_nodes());
+  #pragma omp parallel for
+  for (NodeID n=0; n < g.num_nodes(); n++)
+    scores[n] = init_scores ? (*init_scores)[n] : 1.0f / g.num_nodes();
+  return scores;
+}
+
+
+template <typename GraphT_>
+pvector<ScoreT> PageRankPullGS(const GraphT_ &g, int max_iters,
+                               double epsilon = 0,
+                               bool logging_enabled = false,
+                               const pvector<ScoreT> *init_scores = nullptr) {
   const ScoreT base_score = (1.0f - kDamp) / g.num_nodes();
-  pvector<ScoreT> scores(g.num_nodes(), init_score);
+  pvector<ScoreT> scores = InitialScores(g, init_scores);
   pvector<ScoreT> outgoing_contrib(g.num_nodes());
   #pragma omp parallel for
   for (NodeID n=0; n < g.num_nodes(); n++)
-    outgoing_contrib[n] = init_score / g.out_degree(n);
+    outgoing_contrib[n] = scores[n] / g.out_degree(n);
   for (int iter=0; iter < max_iters; iter++) {
-    double error = 0;
-    #pragma omp parallel for reduction(+ : error) schedule(dynamic, 16384)
-    for (NodeID u=0; u < g.num_nodes(); u++) {
+    double error = ParallelSumVertices<double>(g.VertexBlocks(true),
+                                               [&](NodeID u) {
       ScoreT incoming_total = 0;
       for (NodeID v : g.in_neigh(u))
         incoming_total += outgoing_contrib[v];
       ScoreT old_score = scores[u];
       scores[u] = base_score + kDamp * incoming_total;
-      error += fabs(scores[u] - old_score);
       outgoing_contrib[u] = scores[u] / g.out_degree(u);
-    }
+      return fabs(scores[u] - old_score);
+    });
     if (logging_enabled)
       PrintStep(iter, error);
     if (error < epsilon)
@@ -61,7 +97,150 @@ pvector<ScoreT> PageRankPullGS(const Graph &g, int max_iters, double epsilon=0,
 }
 
 
-void PrintTopScores(const Graph &g, const pvector<ScoreT> &scores) {
+// Returns new value
+ScoreT AtomicAdd(ScoreT &x, ScoreT inc) {
+  ScoreT old_val = x;
+  while (!compare_and_swap(x, old_val, old_val + inc))
+    old_val = x;
+  return old_val + inc;
+}
+
+
+// queued[u] claims u's place in the next round's queue, so only the push
+// taking u's residual over threshold enqueues it, and only once (u clears it
+// when taking its residual, so later pushes can enqueue it again). Each round
+// refills the other of two queues, since a vertex can be in every round's.
+template <typename GraphT_>
+pvector<ScoreT> PageRankDelta(const GraphT_ &g, int max_iters,
+                              double epsilon = 0,
+                              bool logging_enabled = false,
+                              const pvector<ScoreT> *init_scores = nullptr) {
+  const ScoreT base_score = (1.0f - kDamp) / g.num_nodes();
+  const ScoreT threshold = epsilon / g.num_nodes();
+  pvector<ScoreT> scores = InitialScores(g, init_scores);
+  pvector<ScoreT> residuals(g.num_nodes());
+  pvector<uint8_t> queued(g.num_nodes());
+  SlidingQueue<NodeID> queue_a(g.num_nodes()), queue_b(g.num_nodes());
+  SlidingQueue<NodeID> *queue = &queue_a, *next_queue = &queue_b;
+  // Total residual bounds error as PRVerifier measures it
+  double total_residual = ParallelSumVertices<double>(g.VertexBlocks(true),
+                                                      [&](NodeID u) {
+    ScoreT incoming_total = 0;
+    for (NodeID v : g.in_neigh(u))
+      incoming_total += scores[v] / g.out_degree(v);
+    residuals[u] = base_score + kDamp * incoming_total - scores[u];
+    return fabs(residuals[u]);
+  });
+  #pragma omp parallel
+  {
+    QueueBuffer<NodeID> lqueue(*queue);
+    #pragma omp for nowait
+    for (NodeID u=0; u < g.num_nodes(); u++) {
+      queued[u] = fabs(residuals[u]) > threshold;
+      if (queued[u])
+        lqueue.push_back(u);
+    }
+    lqueue.flush();
+  }
+  queue->slide_window();
+  for (int iter=0; iter < max_iters; iter++) {
+    if ((total_residual < epsilon) || queue->empty())
+      break;
+    double error = 0;
+    next_queue->reset();
+    #pragma omp parallel reduction(+ : error, total_residual)
+    {
+      QueueBuffer<NodeID> lqueue(*next_queue);
+      #pragma omp for schedule(dynamic, 64) nowait
+      for (auto q_iter = queue->begin(); q_iter < queue->end(); q_iter++) {
+        NodeID u = *q_iter;
+        // atomic so clearing the claim is visible before residual is read
+        compare_and_swap(queued[u], static_cast<uint8_t>(1),
+                         static_cast<uint8_t>(0));
+        ScoreT delta = residuals[u];
+        // later pushes (of other signs) can take it back under threshold
+        if (fabs(delta) <= threshold)
+          continue;
+        ScoreT remaining = AtomicAdd(residuals[u], -delta);
+        total_residual += fabs(remaining) - fabs(remaining + delta);
+        // pushes that came between read and subtract saw no crossing
+        if ((fabs(remaining) > threshold) &&
+            compare_and_swap(queued[u], static_cast<uint8_t>(0),
+                             static_cast<uint8_t>(1)))
+          lqueue.push_back(u);
+        scores[u] += delta;
+        error += fabs(delta);
+        if (g.out_degree(u) == 0)
+          continue;
+        ScoreT contrib = kDamp * delta / g.out_degree(u);
+        ScoreT pushed_change = 0;
+        for (NodeID v : g.out_neigh(u)) {
+          ScoreT residual = AtomicAdd(residuals[v], contrib);
+          ScoreT prev = residual - contrib;
+          pushed_change += fabs(residual) - fabs(prev);
+          if ((fabs(residual) > threshold) && (fabs(prev) <= threshold) &&
+              compare_and_swap(queued[v], static_cast<uint8_t>(0),
+                               static_cast<uint8_t>(1)))
+            lqueue.push_back(v);
+        }
+        total_residual += pushed_change;
+      }
+      lqueue.flush();
+    }
+    if (logging_enabled)
+      PrintStep(iter, error, queue->size());
+    next_queue->slide_window();
+    // in order of vertex IDs, like a scan would give, for locality
+    ParallelSort(next_queue->begin(), next_queue->end());
+    swap(queue, next_queue);
+  }
+  return scores;
+}
+
+
+// Scores file has a score per line, in order of vertex IDs of the input
+template <typename GraphT_>
+pvector<ScoreT> ReadScores(const GraphT_ &g, const string &filename) {
+  ifstream in(filename);
+  if (!in.is_open()) {
+    cout << "Couldn't open file " << filename << endl;
+    exit(-2);
+  }
+  vector<ScoreT> file_scores;
+  ScoreT score;
+  while (in >> score)
+    file_scores.push_back(score);
+  if (file_scores.size() != static_cast<size_t>(g.num_nodes())) {
+    cout << "Scores file has " << file_scores.size() << " scores, but graph "
+         << "has " << g.num_nodes() << " vertices" << endl;
+    exit(-42);
+  }
+  pvector<ScoreT> scores(g.num_nodes());
+  for (NodeID n=0; n < g.num_nodes(); n++)
+    scores[n] = file_scores[OriginalID(g, n)];
+  return scores;
+}
+
+
+template <typename GraphT_>
+void WriteScores(const GraphT_ &g, const pvector<ScoreT> &scores,
+                 const string &filename) {
+  vector<ScoreT> file_scores(g.num_nodes());
+  for (NodeID n=0; n < g.num_nodes(); n++)
+    file_scores[OriginalID(g, n)] = scores[n];
+  ofstream out(filename);
+  out.precision(numeric_limits<ScoreT>::max_digits10);
+  for (ScoreT score : file_scores)
+    out << score << "\n";
+  if (!out) {
+    cout << "Couldn't write to file " << filename << endl;
+    exit(-5);
+  }
+}
+
+
+template <typename GraphT_>
+void PrintTopScores(const GraphT_ &g, const pvector<ScoreT> &scores) {
   vector<pair<NodeID, ScoreT>> score_pairs(g.num_nodes());
   for (NodeID n=0; n < g.num_nodes(); n++) {
     score_pairs[n] = make_pair(n, scores[n]);
@@ -69,13 +248,14 @@ void PrintTopScores(const Graph &g, const pvector<ScoreT> &scores) {
   int k = 5;
   vector<pair<ScoreT, NodeID>> top_k = TopK(score_pairs, k);
   for (auto kvp : top_k)
-    cout << kvp.second << ":" << kvp.first << endl;
+    cout << OriginalID(g, kvp.second) << ":" << kvp.first << endl;
 }
 
 
 // Verifies by asserting a single serial iteration in push direction has
 //   error < target_error
-bool PRVerifier(const Graph &g, const pvector<ScoreT> &scores,
+template <typename GraphT_>
+bool PRVerifier(const GraphT_ &g, const pvector<ScoreT> &scores,
                         double target_error) {
   const ScoreT base_score = (1.0f - kDamp) / g.num_nodes();
   pvector<ScoreT> incoming_sums(g.num_nodes(), 0);
@@ -94,18 +274,46 @@ bool PRVerifier(const Graph &g, const pvector<ScoreT> &scores,
 }
 
 
+template <typename GraphT_>
+void BenchmarkPR(const CLPageRankWarm &cli, const GraphT_ &g) {
+  pvector<ScoreT> init_scores;
+  if (cli.scores_in() != "")
+    init_scores = ReadScores(g, cli.scores_in());
+  const pvector<ScoreT> *init = cli.scores_in() != "" ? &init_scores : nullptr;
+  pvector<ScoreT> latest;
+  auto PRBound = [&] (const GraphT_ &g) {
+    pvector<ScoreT> scores = cli.delta_push() ?
+        PageRankDelta(g, cli.max_iters(), cli.tolerance(), cli.logging_en(),
+                      init) :
+        PageRankPullGS(g, cli.max_iters(), cli.tolerance(), cli.logging_en(),
+                       init);
+    if (cli.scores_out() != "")
+      latest = pvector<ScoreT>(scores.begin(), scores.end());
+    return scores;
+  };
+  auto VerifierBound = [&cli] (const GraphT_ &g,
+                               const pvector<ScoreT> &scores) {
+    return PRVerifier(g, scores, cli.tolerance());
+  };
+  BenchmarkKernel(cli, g, PRBound, PrintTopScores<GraphT_>, VerifierBound);
+  if (cli.scores_out() != "")
+    WriteScores(g, latest, cli.scores_out());
+}
+
+
+#ifndef NO_MAIN
 int main(int argc, char* argv[]) {
-  CLPageRank cli(argc, argv, "pagerank", 1e-4, 20);
+  CLPageRankWarm cli(argc, argv, "pagerank", 1e-4, 20);
   if (!cli.ParseArgs())
     return -1;
   Builder b(cli);
-  Graph g = b.MakeGraph();
-  auto PRBound = [&cli] (const Graph &g) {
-    return PageRankPullGS(g, cli.max_iters(), cli.tolerance(), cli.logging_en());
-  };
-  auto VerifierBound = [&cli] (const Graph &g, const pvector<ScoreT> &scores) {
-    return PRVerifier(g, scores, cli.tolerance());
-  };
-  BenchmarkKernel(cli, g, PRBound, PrintTopScores, VerifierBound);
+  if (b.compressed_input()) {
+    CGraph g = b.MakeCompressedGraph();
+    BenchmarkPR(cli, g);
+  } else {
+    Graph g = b.MakeGraph();
+    BenchmarkPR(cli, g);
+  }
   return 0;
 }
+#endif
@@ -0,0 +1,212 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "benchmark.h"
+#include "builder.h"
+#include "command_line.h"
+#include "graph.h"
+#include "pvector.h"
+
+
+/*
+GAP Benchmark Suite
+Kernel: PageRank (PR)
+Author: Scott Beamer
+
+Will return pagerank scores for all vertices once total change < epsilon
+
+This PR implementation uses propagation blocking [1] to avoid the random
+reads of outgoing contributions done by pr and pr_spmv. Like pr_spmv, values
+are not visible until the next iteration (Jacobi-style), so the two are
+directly comparable. Each iteration has two phases:
+ - Binning: sources are processed in blocks, and each pushes its
+   contribution into the bin for every destination's vertex range. These
+   writes are sequential within each (block, bin) pair.
+ - Accumulate: each bin is summed into its destinations, whose range is
+   small enough to stay in cache, and the new scores are computed
+Since the graph doesn't change, the destination of every binned value (the
+binning layout) is computed once (PBLayout) and reused by all iterations.
+
+[1] Scott Beamer, Krste Asanović, and David Patterson. "Reducing PageRank
+    Communication via Propagation Blocking." International Parallel and
+    Distributed Processing Symposium (IPDPS), 2017.
+*/
+
+
+using namespace std;
+
+typedef float ScoreT;
+const float kDamp = 0.85;
+
+
+// Where each source block writes its contributions in each bin
+class PBLayout {
+ public:
+  // Bins cover 2^kBinShift destinations, so a bin's sums fit in cache
+  static const int kBinShift = 16;
+  // Fixed number of source blocks, so sum order doesn't depend on threads
+  static const int64_t kNumBlocks = 256;
+
+  explicit PBLayout(const Graph &g) {
+    num_bins_ = (g.num_nodes() >> kBinShift) + 1;
+    block_starts_ = pvector<NodeID>(kNumBlocks + 1);
+    for (int64_t b=0; b <= kNumBlocks; b++)
+      block_starts_[b] = g.num_nodes() * b / kNumBlocks;
+    pvector<SGOffset> counts(num_bins_ * kNumBlocks, 0);
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int64_t b=0; b < kNumBlocks; b++) {
+      for (NodeID u=block_starts_[b]; u < block_starts_[b+1]; u++) {
+        for (NodeID v : g.out_neigh(u))
+          counts[Index(b, BinOf(v))]++;
+      }
+    }
+    starts_ = pvector<SGOffset>(num_bins_ * kNumBlocks + 1);
+    SGOffset total = 0;
+    for (size_t i=0; i < counts.size(); i++) {
+      starts_[i] = total;
+      total += counts[i];
+    }
+    starts_[counts.size()] = total;
+    dests_ = pvector<NodeID>(total);
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int64_t b=0; b < kNumBlocks; b++) {
+      vector<SGOffset> cursors = BlockCursors(b);
+      for (NodeID u=block_starts_[b]; u < block_starts_[b+1]; u++) {
+        for (NodeID v : g.out_neigh(u))
+          dests_[cursors[BinOf(v)]++] = v;
+      }
+    }
+  }
+
+  static int64_t BinOf(NodeID v) {
+    return v >> kBinShift;
+  }
+
+  int64_t Index(int64_t block, int64_t bin) const {
+    return bin * kNumBlocks + block;
+  }
+
+  // Starting position of block in every bin
+  vector<SGOffset> BlockCursors(int64_t block) const {
+    vector<SGOffset> cursors(num_bins_);
+    for (int64_t bin=0; bin < num_bins_; bin++)
+      cursors[bin] = starts_[Index(block, bin)];
+    return cursors;
+  }
+
+  int64_t num_bins() const { return num_bins_; }
+  NodeID block_start(int64_t block) const { return block_starts_[block]; }
+  SGOffset bin_start(int64_t bin) const { return starts_[Index(0, bin)]; }
+  NodeID dest(SGOffset pos) const { return dests_[pos]; }
+  SGOffset num_binned() const { return dests_.size(); }
+
+ private:
+  int64_t num_bins_;
+  pvector<NodeID> block_starts_;
+  pvector<SGOffset> starts_;
+  pvector<NodeID> dests_;
+};
+
+
+pvector<ScoreT> PageRankPB(const Graph &g, const PBLayout &layout,
+                           int max_iters, double epsilon = 0,
+                           bool logging_enabled = false) {
+  const ScoreT init_score = 1.0f / g.num_nodes();
+  const ScoreT base_score = (1.0f - kDamp) / g.num_nodes();
+  pvector<ScoreT> scores(g.num_nodes(), init_score);
+  pvector<ScoreT> outgoing_contrib(g.num_nodes());
+  pvector<ScoreT> incoming_total(g.num_nodes(), 0);
+  pvector<ScoreT> binned_contribs(layout.num_binned());
+  for (int iter=0; iter < max_iters; iter++) {
+    double error = 0;
+    #pragma omp parallel for
+    for (NodeID n=0; n < g.num_nodes(); n++)
+      outgoing_contrib[n] = scores[n] / g.out_degree(n);
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int64_t b=0; b < PBLayout::kNumBlocks; b++) {
+      vector<SGOffset> cursors = layout.BlockCursors(b);
+      for (NodeID u=layout.block_start(b); u < layout.block_start(b+1); u++) {
+        ScoreT contrib = outgoing_contrib[u];
+        for (NodeID v : g.out_neigh(u))
+          binned_contribs[cursors[PBLayout::BinOf(v)]++] = contrib;
+      }
+    }
+    #pragma omp parallel for reduction(+ : error) schedule(dynamic, 1)
+    for (int64_t bin=0; bin < layout.num_bins(); bin++) {
+      for (SGOffset i=layout.bin_start(bin); i < layout.bin_start(bin+1); i++)
+        incoming_total[layout.dest(i)] += binned_contribs[i];
+      NodeID bin_end = min(g.num_nodes(), (bin+1) << PBLayout::kBinShift);
+      for (NodeID u = bin << PBLayout::kBinShift; u < bin_end; u++) {
+        ScoreT old_score = scores[u];
+        scores[u] = base_score + kDamp * incoming_total[u];
+        error += fabs(scores[u] - old_score);
+        incoming_total[u] = 0;
+      }
+    }
+    if (logging_enabled)
+      PrintStep(iter, error);
+    if (error < epsilon)
+      break;
+  }
+  return scores;
+}
+
+
+void PrintTopScores(const Graph &g, const pvector<ScoreT> &scores) {
+  vector<pair<NodeID, ScoreT>> score_pairs(g.num_nodes());
+  for (NodeID n=0; n < g.num_nodes(); n++) {
+    score_pairs[n] = make_pair(n, scores[n]);
+  }
+  int k = 5;
+  vector<pair<ScoreT, NodeID>> top_k = TopK(score_pairs, k);
+  for (auto kvp : top_k)
+    cout << OriginalID(g, kvp.second) << ":" << kvp.first << endl;
+}
+
+
+// Verifies by asserting a single serial iteration in push direction has
+//   error < target_error
+bool PRVerifier(const Graph &g, const pvector<ScoreT> &scores,
+                        double target_error) {
+  const ScoreT base_score = (1.0f - kDamp) / g.num_nodes();
+  pvector<ScoreT> incoming_sums(g.num_nodes(), 0);
+  double error = 0;
+  for (NodeID u : g.vertices()) {
+    ScoreT outgoing_contrib = scores[u] / g.out_degree(u);
+    for (NodeID v : g.out_neigh(u))
+      incoming_sums[v] += outgoing_contrib;
+  }
+  for (NodeID n : g.vertices()) {
+    error += fabs(base_score + kDamp * incoming_sums[n] - scores[n]);
+    incoming_sums[n] = 0;
+  }
+  PrintTime("Total Error", error);
+  return error < target_error;
+}
+
+
+int main(int argc, char* argv[]) {
+  CLPageRank cli(argc, argv, "pagerank", 1e-4, 20);
+  if (!cli.ParseArgs())
+    return -1;
+  Builder b(cli);
+  Graph g = b.MakeGraph();
+  Timer t;
+  t.Start();
+  PBLayout layout(g);
+  t.Stop();
+  PrintTime("Layout Time", t.Seconds());
+  auto PRBound = [&cli, &layout] (const Graph &g) {
+    return PageRankPB(g, layout, cli.max_iters(), cli.tolerance(),
+                      cli.logging_en());
+  };
+  auto VerifierBound = [&cli] (const Graph &g, const pvector<ScoreT> &scores) {
+    return PRVerifier(g, scores, cli.tolerance());
+  };
+  BenchmarkKernel(cli, g, PRBound, PrintTopScores, VerifierBound);
+  return 0;
+}
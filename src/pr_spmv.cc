@@ -9,6 +9,7 @@
 #include "builder.h"
 #include "command_line.h"
 #include "graph.h"
+#include "partition.h"
 #include "pvector.h"
 
 
@@ -23,7 +24,9 @@ This legacy PR implementation uses the traditional iterative approach. This is
 done to ease comparisons to other implementations (often use same algorithm),
 but it is not necessarily the fastest way to implement it. It performs each
 iteration as a sparse-matrix vector multiply (SpMV), and values are not visible
-until the next iteration (like Jacobi-style method).
+until the next iteration (like Jacobi-style method). Like pr, its vertex loop
+is scheduled in blocks of about equal in-edges, or follows NUMA partitioning
+(see numa.h).
 */
 
 
@@ -43,15 +46,14 @@ pvector<ScoreT> PageRankPull(const Graph &g, int max_iters, double epsilon = 0,
     #pragma omp parallel for
     for (NodeID n=0; n < g.num_nodes(); n++)
       outgoing_contrib[n] = scores[n] / g.out_degree(n);
-    #pragma omp parallel for reduction(+ : error) schedule(dynamic, 16384)
-    for (NodeID u=0; u < g.num_nodes(); u++) {
+    error = ParallelSumVertices<double>(g.VertexBlocks(true), [&](NodeID u) {
       ScoreT incoming_total = 0;
       for (NodeID v : g.in_neigh(u))
         incoming_total += outgoing_contrib[v];
       ScoreT old_score = scores[u];
       scores[u] = base_score + kDamp * incoming_total;
-      error += fabs(scores[u] - old_score);
-    }
+      return fabs(scores[u] - old_score);
+    });
     if (logging_enabled)
       PrintStep(iter, error);
     if (error < epsilon)
@@ -69,7 +71,7 @@ void PrintTopScores(const Graph &g, const pvector<ScoreT> &scores) {
   int k = 5;
   vector<pair<ScoreT, NodeID>> top_k = TopK(score_pairs, k);
   for (auto kvp : top_k)
-    cout << kvp.second << ":" << kvp.first << endl;
+    cout << OriginalID(g, kvp.second) << ":" << kvp.first << endl;
 }
 
 
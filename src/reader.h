@@ -4,13 +4,28 @@
 #ifndef READER_H_
 #define READER_H_
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
+#include "alloc.h"
+#include "compressed_graph.h"
+#include "parallel_io.h"
 #include "pvector.h"
+#include "sg_format.h"
+#include "split_graph.h"
 #include "util.h"
 
 
@@ -24,7 +39,17 @@ Given filename, returns an edgelist or the entire graph (if serialized)
  - Determines file format from the filename's suffix
  - If the input graph is serialized (.sg or .wsg), reads the graph
    directly into the returned graph instance
+ - Serialized graphs can instead be memory-mapped (use_mmap), so the returned
+   graph's neighbors point into the mapped file (see sg_format.h for layout)
+ - Otherwise, their arrays are read by all threads at once in large chunks
+   (ParallelRead in parallel_io.h), each placing the pages it reads
+ - Compressed serialized graphs (.csg) are read by ReadCompressedGraph
+ - Split weighted graphs (.swsg) are read by ReadSplitGraph, or only their
+   topology by ReadSplitTopology (both need an unweighted Reader)
  - Otherwise, reads the file and returns an edgelist
+ - Text edge lists (.el, .wel, .gr, .mtx) are parsed in parallel (ParseLines)
+ - StreamFile instead hands each parsed chunk of a text edge list to a
+   callback, so the entire edgelist is never held in memory
 */
 
 
@@ -47,41 +72,215 @@ class Reader {
     return filename_.substr(suff_pos);
   }
 
-  EdgeList ReadInEL(std::ifstream &in) {
-    EdgeList el;
-    NodeID_ u, v;
-    while (in >> u >> v) {
-      el.push_back(Edge(u, v));
+  // Fast path for parsing an integer, skips leading blanks
+  static bool ParseInt(const char* &p, const char* end, int64_t &x) {
+    while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+      p++;
+    bool negative = (p < end) && (*p == '-');
+    if ((p < end) && ((*p == '-') || (*p == '+')))
+      p++;
+    if ((p == end) || (*p < '0') || (*p > '9'))
+      return false;
+    int64_t val = 0;
+    while ((p < end) && (*p >= '0') && (*p <= '9'))
+      val = val * 10 + (*p++ - '0');
+    x = negative ? -val : val;
+    return true;
+  }
+
+  // Parses a decimal number (optional fraction & exponent) as a double
+  static bool ParseReal(const char* &p, const char* end, double &x) {
+    while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+      p++;
+    bool negative = (p < end) && (*p == '-');
+    if ((p < end) && ((*p == '-') || (*p == '+')))
+      p++;
+    bool found_digit = false;
+    double val = 0;
+    while ((p < end) && (*p >= '0') && (*p <= '9')) {
+      val = val * 10 + (*p++ - '0');
+      found_digit = true;
+    }
+    if ((p < end) && (*p == '.')) {
+      p++;
+      double place = 0.1;
+      while ((p < end) && (*p >= '0') && (*p <= '9')) {
+        val += (*p++ - '0') * place;
+        place *= 0.1;
+        found_digit = true;
+      }
+    }
+    if (!found_digit)
+      return false;
+    if ((p < end) && ((*p == 'e') || (*p == 'E'))) {
+      p++;
+      int64_t exponent;
+      if (ParseInt(p, end, exponent))
+        val *= std::pow(10.0, static_cast<double>(exponent));
+    }
+    x = negative ? -val : val;
+    return true;
+  }
+
+  // Weights are parsed as reals if needed and then casted to WeightT_
+  static bool ParseWeight(const char* &p, const char* end, bool real,
+                          WeightT_ &w) {
+    if (real || std::is_floating_point<WeightT_>::value) {
+      double x;
+      if (!ParseReal(p, end, x))
+        return false;
+      w = static_cast<WeightT_>(x);
+    } else {
+      int64_t x;
+      if (!ParseInt(p, end, x))
+        return false;
+      w = static_cast<WeightT_>(x);
+    }
+    return true;
+  }
+
+  int64_t FileSize() {
+    struct stat file_stats;
+    if (stat(filename_.c_str(), &file_stats) == -1) {
+      std::cout << "Couldn't open file " << filename_ << std::endl;
+      std::exit(-2);
+    }
+    return file_stats.st_size;
+  }
+
+  static int64_t NumChunks(int64_t file_size, int64_t start) {
+    const int64_t kChunkBytes = 1 << 22;
+    if (file_size <= start)
+      return 0;
+    return (file_size - start + kChunkBytes - 1) / kChunkBytes;
+  }
+
+  /*
+  Parses text file in parallel, starting from byte position start
+    - file is memory-mapped and split into fixed-size chunks
+    - a chunk owns every line that starts within it (so it skips a partial
+      first line, and it finishes its last line even if it crosses the end)
+    - each chunk calls parse_line(line_start, line_end, el) for each of its
+      lines, appending edges to a chunk-local EdgeList, and then hands that
+      EdgeList to consume(chunk_index, el)
+  */
+  template <typename LineParser, typename ChunkConsumer>
+  void ParseChunks(int64_t start, LineParser parse_line,
+                   ChunkConsumer consume) {
+    int64_t file_size = FileSize();
+    int64_t num_chunks = NumChunks(file_size, start);
+    if (num_chunks == 0)
+      return;
+    int64_t chunk_bytes = (file_size - start + num_chunks - 1) / num_chunks;
+    void *mapping = MapFile(file_size);
+    const char *file_start = static_cast<const char*>(mapping);
+    const char *file_end = file_start + file_size;
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int64_t c=0; c < num_chunks; c++) {
+      const char *p = file_start + start + c * chunk_bytes;
+      const char *chunk_end = std::min(p + chunk_bytes, file_end);
+      if ((c != 0) && (*(p-1) != '\n')) {
+        p = static_cast<const char*>(std::memchr(p, '\n', file_end - p));
+        p = (p == nullptr) ? file_end : p + 1;
+      }
+      EdgeList chunk_el;
+      while (p < chunk_end) {
+        const char *line_end =
+            static_cast<const char*>(std::memchr(p, '\n', file_end - p));
+        if (line_end == nullptr)
+          line_end = file_end;
+        parse_line(p, line_end, chunk_el);
+        p = line_end + 1;
+      }
+      consume(c, chunk_el);
+    }
+    munmap(mapping, file_size);
+  }
+
+  // Chunk-local EdgeLists are concatenated in order, so the result matches
+  // a serial read of the file
+  template <typename LineParser>
+  EdgeList ParseLines(int64_t start, LineParser parse_line) {
+    int64_t num_chunks = NumChunks(FileSize(), start);
+    std::vector<EdgeList> chunk_els(num_chunks);
+    ParseChunks(start, parse_line, [&chunk_els] (int64_t c, EdgeList &el) {
+      chunk_els[c].swap(el);
+    });
+    pvector<size_t> chunk_starts(num_chunks + 1);
+    chunk_starts[0] = 0;
+    for (int64_t c=0; c < num_chunks; c++)
+      chunk_starts[c+1] = chunk_starts[c] + chunk_els[c].size();
+    EdgeList el(chunk_starts[num_chunks]);
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int64_t c=0; c < num_chunks; c++) {
+      std::copy(chunk_els[c].begin(), chunk_els[c].end(),
+                el.begin() + chunk_starts[c]);
+      chunk_els[c] = EdgeList();
     }
     return el;
   }
 
-  EdgeList ReadInWEL(std::ifstream &in) {
-    EdgeList el;
-    NodeID_ u;
-    NodeWeight<NodeID_, WeightT_> v;
-    while (in >> u >> v) {
+  static void ParseELLine(const char *p, const char *end, EdgeList &el) {
+    int64_t u, v;
+    if (ParseInt(p, end, u) && ParseInt(p, end, v))
       el.push_back(Edge(u, v));
+  }
+
+  static void ParseWELLine(const char *p, const char *end, EdgeList &el) {
+    int64_t u, v;
+    WeightT_ w;
+    if (ParseInt(p, end, u) && ParseInt(p, end, v) &&
+        ParseWeight(p, end, false, w))
+      el.push_back(Edge(u, NodeWeight<NodeID_, WeightT_>(v, w)));
+  }
+
+  // Note: converts vertex numbering from 1..N to 0..N-1
+  static void ParseGRLine(const char *p, const char *end, EdgeList &el) {
+    int64_t u, v;
+    WeightT_ w;
+    if ((p < end) && (*p == 'a')) {
+      p++;
+      if (ParseInt(p, end, u) && ParseInt(p, end, v) &&
+          ParseWeight(p, end, false, w))
+        el.push_back(Edge(u - 1, NodeWeight<NodeID_, WeightT_>(v - 1, w)));
     }
-    return el;
   }
 
   // Note: converts vertex numbering from 1..N to 0..N-1
-  EdgeList ReadInGR(std::ifstream &in) {
-    EdgeList el;
-    char c;
-    NodeID_ u;
-    NodeWeight<NodeID_, WeightT_> v;
-    while (!in.eof()) {
-      c = in.peek();
-      if (c == 'a') {
-        in >> c >> u >> v;
-        el.push_back(Edge(u - 1, NodeWeight<NodeID_, WeightT_>(v.v-1, v.w)));
+  struct MTXLineParser {
+    bool read_weights;
+    bool real_weights;
+    bool undirected;
+
+    void operator()(const char *p, const char *end, EdgeList &el) const {
+      int64_t u, v;
+      if (!ParseInt(p, end, u) || !ParseInt(p, end, v))
+        return;
+      if (read_weights) {
+        WeightT_ w;
+        if (!ParseWeight(p, end, real_weights, w))
+          return;
+        el.push_back(Edge(u - 1, NodeWeight<NodeID_, WeightT_>(v - 1, w)));
+        if (undirected)
+          el.push_back(Edge(v - 1, NodeWeight<NodeID_, WeightT_>(u - 1, w)));
       } else {
-        in.ignore(200, '\n');
+        el.push_back(Edge(u - 1, v - 1));
+        if (undirected)
+          el.push_back(Edge(v - 1, u - 1));
       }
     }
-    return el;
+  };
+
+  EdgeList ReadInEL() {
+    return ParseLines(0, ParseELLine);
+  }
+
+  EdgeList ReadInWEL() {
+    return ParseLines(0, ParseWELLine);
+  }
+
+  EdgeList ReadInGR() {
+    return ParseLines(0, ParseGRLine);
   }
 
   // Note: converts vertex numbering from 1..N to 0..N-1
@@ -142,11 +341,9 @@ class Reader {
     return el;
   }
 
-  // Note: converts vertex numbering from 1..N to 0..N-1
-  // Note: weights casted to type WeightT_
-  EdgeList ReadInMTX(std::ifstream &in, bool &needs_weights) {
-    EdgeList el;
-    std::string start, object, format, field, symmetry, line;
+  // Leaves in at start of first line of entries
+  MTXLineParser ReadMTXHeader(std::ifstream &in) {
+    std::string start, object, format, field, symmetry;
     in >> start >> object >> format >> field >> symmetry >> std::ws;
     if (start != "%%MatrixMarket") {
       std::cout << ".mtx file did not start with %%MatrixMarket" << std::endl;
@@ -194,29 +391,18 @@ class Reader {
       std::cout << "matrix must be square for .mtx" << std::endl;
       std::exit(-26);
     }
-    while (std::getline(in, line)) {
-      if (line.empty())
-        continue;
-      std::istringstream edge_stream(line);
-      NodeID_ u;
-      edge_stream >> u;
-      if (read_weights) {
-        NodeWeight<NodeID_, WeightT_> v;
-        edge_stream >> v;
-        v.v -= 1;
-        el.push_back(Edge(u - 1, v));
-        if (undirected)
-          el.push_back(Edge(v.v, NodeWeight<NodeID_, WeightT_>(u - 1, v.w)));
-      } else {
-        NodeID_ v;
-        edge_stream >> v;
-        el.push_back(Edge(u - 1, v - 1));
-        if (undirected)
-          el.push_back(Edge(v - 1, u - 1));
-      }
-    }
-    needs_weights = !read_weights;
-    return el;
+    MTXLineParser parse_line;
+    parse_line.read_weights = read_weights;
+    parse_line.real_weights = field != "integer";
+    parse_line.undirected = undirected;
+    return parse_line;
+  }
+
+  // Note: weights casted to type WeightT_
+  EdgeList ReadInMTX(std::ifstream &in, bool &needs_weights) {
+    MTXLineParser parse_line = ReadMTXHeader(in);
+    needs_weights = !parse_line.read_weights;
+    return ParseLines(in.tellg(), parse_line);
   }
 
   EdgeList ReadFile(bool &needs_weights) {
@@ -230,13 +416,13 @@ class Reader {
       std::exit(-2);
     }
     if (suffix == ".el") {
-      el = ReadInEL(file);
+      el = ReadInEL();
     } else if (suffix == ".wel") {
       needs_weights = false;
-      el = ReadInWEL(file);
+      el = ReadInWEL();
     } else if (suffix == ".gr") {
       needs_weights = false;
-      el = ReadInGR(file);
+      el = ReadInGR();
     } else if (suffix == ".graph") {
       el = ReadInMetis(file, needs_weights);
     } else if (suffix == ".mtx") {
@@ -251,12 +437,230 @@ class Reader {
     return el;
   }
 
-  CSRGraph<NodeID_, DestID_, invert> ReadSerializedGraph() {
-    bool weighted = GetSuffix() == ".wsg";
-    if (!std::is_same<NodeID_, SGID>::value) {
-      std::cout << "serialized graphs only allowed for 32bit" << std::endl;
+  // Parses text edge list (.el, .wel, .gr, or .mtx) without collecting it,
+  // instead consume(chunk_index, el) is called (in parallel) for each chunk
+  template <typename ChunkConsumer>
+  void StreamFile(ChunkConsumer consume) {
+    std::string suffix = GetSuffix();
+    if (suffix == ".el") {
+      ParseChunks(0, ParseELLine, consume);
+    } else if (suffix == ".wel") {
+      ParseChunks(0, ParseWELLine, consume);
+    } else if (suffix == ".gr") {
+      ParseChunks(0, ParseGRLine, consume);
+    } else if (suffix == ".mtx") {
+      std::ifstream file(filename_);
+      if (!file.is_open()) {
+        std::cout << "Couldn't open file " << filename_ << std::endl;
+        std::exit(-2);
+      }
+      MTXLineParser parse_line = ReadMTXHeader(file);
+      ParseChunks(file.tellg(), parse_line, consume);
+    } else {
+      std::cout << "Can't stream input with suffix: " << suffix << std::endl;
+      std::exit(-3);
+    }
+  }
+
+  // True if a text edge list (for StreamFile) provides weights
+  bool TextHasWeights() {
+    std::string suffix = GetSuffix();
+    if ((suffix == ".wel") || (suffix == ".gr"))
+      return true;
+    if (suffix == ".mtx") {
+      std::ifstream file(filename_);
+      return file.is_open() && ReadMTXHeader(file).read_weights;
+    }
+    return false;
+  }
+
+  // Reads graphs serialized before SGHeader was introduced
+  CSRGraph<NodeID_, DestID_, invert> ReadLegacySerializedGraph(
+      std::ifstream &file) {
+    bool directed;
+    SGOffset num_nodes, num_edges;
+    SGOffset *offsets = nullptr, *inv_offsets = nullptr;
+    DestID_ *neighs = nullptr, *inv_neighs = nullptr;
+    file.read(reinterpret_cast<char*>(&directed), sizeof(bool));
+    file.read(reinterpret_cast<char*>(&num_edges), sizeof(SGOffset));
+    file.read(reinterpret_cast<char*>(&num_nodes), sizeof(SGOffset));
+    offsets = AllocArray<SGOffset>(num_nodes+1);
+    neighs = AllocArray<DestID_>(num_edges);
+    std::streamsize num_index_bytes = (num_nodes+1) * sizeof(SGOffset);
+    std::streamsize num_neigh_bytes = num_edges * sizeof(DestID_);
+    file.read(reinterpret_cast<char*>(offsets), num_index_bytes);
+    file.read(reinterpret_cast<char*>(neighs), num_neigh_bytes);
+    if (directed && invert) {
+      inv_offsets = AllocArray<SGOffset>(num_nodes+1);
+      inv_neighs = AllocArray<DestID_>(num_edges);
+      file.read(reinterpret_cast<char*>(inv_offsets), num_index_bytes);
+      file.read(reinterpret_cast<char*>(inv_neighs), num_neigh_bytes);
+    }
+    if (directed)
+      return CSRGraph<NodeID_, DestID_, invert>(num_nodes, offsets, neighs,
+                                                inv_offsets, inv_neighs);
+    else
+      return CSRGraph<NodeID_, DestID_, invert>(num_nodes, offsets, neighs);
+  }
+
+  // Neighbor type in a serialized graph with FileID_ vertex IDs
+  template <typename FileID_>
+  using FileDest = typename std::conditional<
+      std::is_same<NodeID_, DestID_>::value, FileID_,
+      NodeWeight<FileID_, WeightT_>>::type;
+
+  template <typename FileID_>
+  static DestID_ ConvertNeigh(FileID_ v) {
+    return static_cast<NodeID_>(v);
+  }
+
+  template <typename FileID_>
+  static DestID_ ConvertNeigh(NodeWeight<FileID_, WeightT_> wn) {
+    return DestID_(static_cast<NodeID_>(wn.v), wn.w);
+  }
+
+  // Arrays are read in parallel (ParallelRead) through their own descriptor
+  int OpenForParallelRead() {
+    int fd = open(filename_.c_str(), O_RDONLY);
+    if (fd == -1) {
+      std::cout << "Couldn't open file " << filename_ << std::endl;
+      std::exit(-6);
+    }
+    return fd;
+  }
+
+  // Reads arrays into memory, FileID_ is the width of IDs in the file
+  template <typename FileID_>
+  CSRGraph<NodeID_, DestID_, invert> StreamSerializedGraph(
+      const SGHeader &header) {
+    typedef FileDest<FileID_> FileDestT;
+    auto ConvertDest = [](FileDestT v) { return ConvertNeigh(v); };
+    auto ConvertID = [](FileID_ n) { return static_cast<NodeID_>(n); };
+    SGLayout layout(header);
+    SGOffset *offsets = nullptr, *inv_offsets = nullptr;
+    DestID_ *neighs = nullptr, *inv_neighs = nullptr;
+    int fd = OpenForParallelRead();
+    offsets = AllocArray<SGOffset>(header.num_nodes+1);
+    neighs = AllocArray<DestID_>(header.num_edges);
+    bool ok = ParallelRead(fd, layout.out_offsets, layout.offsets_bytes,
+                           offsets);
+    ok = ParallelReadConverted<FileDestT>(fd, layout.out_neighs,
+                                          header.num_edges, neighs,
+                                          ConvertDest) && ok;
+    if (header.directed && invert) {
+      inv_offsets = AllocArray<SGOffset>(header.num_nodes+1);
+      inv_neighs = AllocArray<DestID_>(header.num_edges);
+      ok = ParallelRead(fd, layout.in_offsets, layout.offsets_bytes,
+                        inv_offsets) && ok;
+      ok = ParallelReadConverted<FileDestT>(fd, layout.in_neighs,
+                                            header.num_edges, inv_neighs,
+                                            ConvertDest) && ok;
+    }
+    NodeID_ *original_ids = nullptr;
+    if (header.has_original_ids) {
+      original_ids = AllocArray<NodeID_>(header.num_nodes);
+      ok = ParallelReadConverted<FileID_>(fd, layout.original_ids,
+                                          header.num_nodes, original_ids,
+                                          ConvertID) && ok;
+    }
+    close(fd);
+    if (!ok) {
+      std::cout << "Truncated serialized graph " << filename_ << std::endl;
+      std::exit(-7);
+    }
+    CSRGraph<NodeID_, DestID_, invert> g;
+    if (header.directed)
+      g = CSRGraph<NodeID_, DestID_, invert>(header.num_nodes, offsets, neighs,
+                                             inv_offsets, inv_neighs);
+    else
+      g = CSRGraph<NodeID_, DestID_, invert>(header.num_nodes, offsets,
+                                             neighs);
+    g.SetOriginalIDs(original_ids);
+    return g;
+  }
+
+  // Maps (read-only) the first num_bytes of the file
+  void* MapFile(int64_t num_bytes) {
+    int fd = open(filename_.c_str(), O_RDONLY);
+    struct stat file_stats;
+    if ((fd == -1) || (fstat(fd, &file_stats) == -1)) {
+      std::cout << "Couldn't open file " << filename_ << std::endl;
+      std::exit(-6);
+    }
+    if (file_stats.st_size < num_bytes) {
+      std::cout << "Truncated serialized graph " << filename_ << std::endl;
+      std::exit(-7);
+    }
+    void *mapping = mmap(nullptr, num_bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+      std::cout << "Couldn't mmap file " << filename_ << std::endl;
+      std::exit(-7);
+    }
+    return mapping;
+  }
+
+  // Graph's arrays point directly into the (read-only) mapped file, so pages
+  //   are shared with the OS file cache and other processes
+  CSRGraph<NodeID_, DestID_, invert> MapSerializedGraph(
+      const SGHeader &header, char **mapped_base = nullptr) {
+    SGLayout layout(header);
+    void *mapping = MapFile(layout.file_size);
+    if (mapped_base != nullptr)
+      *mapped_base = static_cast<char*>(mapping);
+    char *base = static_cast<char*>(mapping);
+    SGOffset *offsets = reinterpret_cast<SGOffset*>(base + layout.out_offsets);
+    DestID_ *neighs = reinterpret_cast<DestID_*>(base + layout.out_neighs);
+    CSRGraph<NodeID_, DestID_, invert> g;
+    if (header.directed) {
+      SGOffset *inv_offsets = nullptr;
+      DestID_ *inv_neighs = nullptr;
+      if (invert) {
+        inv_offsets = reinterpret_cast<SGOffset*>(base + layout.in_offsets);
+        inv_neighs = reinterpret_cast<DestID_*>(base + layout.in_neighs);
+      }
+      g = CSRGraph<NodeID_, DestID_, invert>(header.num_nodes, offsets, neighs,
+                                             inv_offsets, inv_neighs);
+    } else {
+      g = CSRGraph<NodeID_, DestID_, invert>(header.num_nodes, offsets,
+                                             neighs);
+    }
+    g.AdoptMapping(mapping, layout.file_size);
+    if (header.has_original_ids)
+      g.SetOriginalIDs(reinterpret_cast<NodeID_*>(base + layout.original_ids));
+    return g;
+  }
+
+  // Exits if the file has IDs (or weights) this build can't hold
+  void CheckWidths(const SGHeader &header, bool weighted) {
+    int64_t id_bytes = header.id_width();
+    if ((id_bytes != sizeof(int32_t)) && (id_bytes != sizeof(int64_t))) {
+      std::cout << "Unsupported vertex ID width in " << filename_ << ": "
+                << id_bytes << " bytes" << std::endl;
+      std::exit(-7);
+    }
+    if (header.num_nodes > std::numeric_limits<NodeID_>::max()) {
+      std::cout << filename_ << " has too many vertices for "
+                << 8 * sizeof(NodeID_) << "-bit IDs (use 64-bit build)"
+                << std::endl;
+      std::exit(-5);
+    }
+    if (weighted && (header.weight_width() != sizeof(WeightT_))) {
+      std::cout << "Weight width in " << filename_ << " does not match build"
+                << std::endl;
       std::exit(-5);
     }
+  }
+
+  template <typename FileID_>
+  static bool NeighSizeMatches(const SGHeader &header) {
+    return header.out_neighs_bytes == header.num_edges *
+                                      static_cast<int64_t>(sizeof(
+                                          FileDest<FileID_>));
+  }
+
+  CSRGraph<NodeID_, DestID_, invert> ReadSerializedGraph(bool use_mmap = false) {
+    bool weighted = GetSuffix() == ".wsg";
     if (!weighted && !std::is_same<NodeID_, DestID_>::value) {
       std::cout << ".sg not allowed for weighted graphs" << std::endl;
       std::exit(-5);
@@ -269,41 +673,239 @@ class Reader {
       std::cout << ".wsg only allowed for int32_t weights" << std::endl;
       std::exit(-5);
     }
-    std::ifstream file(filename_);
+    std::ifstream file(filename_, std::ios::in | std::ios::binary);
     if (!file.is_open()) {
       std::cout << "Couldn't open file " << filename_ << std::endl;
       std::exit(-6);
     }
     Timer t;
     t.Start();
-    bool directed;
-    SGOffset num_nodes, num_edges;
-    DestID_ **index = nullptr, **inv_index = nullptr;
-    DestID_ *neighs = nullptr, *inv_neighs = nullptr;
-    file.read(reinterpret_cast<char*>(&directed), sizeof(bool));
-    file.read(reinterpret_cast<char*>(&num_edges), sizeof(SGOffset));
-    file.read(reinterpret_cast<char*>(&num_nodes), sizeof(SGOffset));
-    pvector<SGOffset> offsets(num_nodes+1);
-    neighs = new DestID_[num_edges];
-    std::streamsize num_index_bytes = (num_nodes+1) * sizeof(SGOffset);
-    std::streamsize num_neigh_bytes = num_edges * sizeof(DestID_);
-    file.read(reinterpret_cast<char*>(offsets.data()), num_index_bytes);
-    file.read(reinterpret_cast<char*>(neighs), num_neigh_bytes);
-    index = CSRGraph<NodeID_, DestID_>::GenIndex(offsets, neighs);
-    if (directed && invert) {
-      inv_neighs = new DestID_[num_edges];
-      file.read(reinterpret_cast<char*>(offsets.data()), num_index_bytes);
-      file.read(reinterpret_cast<char*>(inv_neighs), num_neigh_bytes);
-      inv_index = CSRGraph<NodeID_, DestID_>::GenIndex(offsets, inv_neighs);
+    SGHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(SGHeader));
+    CSRGraph<NodeID_, DestID_, invert> g;
+    if (!header.HasMagic()) {
+      if (!std::is_same<NodeID_, SGID>::value) {
+        std::cout << "Legacy serialized graphs need 32-bit build" << std::endl;
+        std::exit(-5);
+      }
+      if (use_mmap)
+        std::cout << "Legacy serialized graph can't be mapped, reading instead"
+                  << std::endl;
+      file.clear();
+      file.seekg(0);
+      g = ReadLegacySerializedGraph(file);
+      file.close();
+      t.Stop();
+      PrintTime("Read Time", t.Seconds());
+      return g;
+    }
+    if (!header.SupportedVersion()) {
+      std::cout << "Unsupported serialized graph version: " << header.version
+                << std::endl;
+      std::exit(-7);
     }
+    CheckWidths(header, weighted);
+    header.FillLegacyNeighSizes(sizeof(FileDest<int32_t>));
+    bool narrow_file = header.id_width() == sizeof(int32_t);
+    if (!(narrow_file ? NeighSizeMatches<int32_t>(header)
+                      : NeighSizeMatches<int64_t>(header))) {
+      std::cout << "Neighbor size in " << filename_ << " does not match "
+                << (weighted ? ".wsg" : ".sg") << std::endl;
+      std::exit(-7);
+    }
+    bool same_width = header.id_width() == sizeof(NodeID_);
+    if (use_mmap && !same_width) {
+      std::cout << "Serialized graph with " << 8 * header.id_width()
+                << "-bit IDs can't be mapped, reading instead" << std::endl;
+      use_mmap = false;
+    }
+    if (use_mmap)
+      g = MapSerializedGraph(header);
+    else if (narrow_file)
+      g = StreamSerializedGraph<int32_t>(header);
+    else
+      g = StreamSerializedGraph<int64_t>(header);
     file.close();
     t.Stop();
-    PrintTime("Read Time", t.Seconds());
-    if (directed)
-      return CSRGraph<NodeID_, DestID_, invert>(num_nodes, index, neighs,
-                                                inv_index, inv_neighs);
+    PrintTime(use_mmap ? "Map Time" : "Read Time", t.Seconds());
+    return g;
+  }
+
+  // Opens .swsg and checks its header, exits if it can't be read as weights
+  // of weight_bytes (0 for any, as when reading only the topology)
+  SGHeader OpenSplitGraph(std::ifstream &file, int64_t weight_bytes) {
+    static_assert(std::is_same<NodeID_, DestID_>::value,
+                  ".swsg topology is read by an unweighted Reader");
+    file.open(filename_, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+      std::cout << "Couldn't open file " << filename_ << std::endl;
+      std::exit(-6);
+    }
+    SGHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(SGHeader));
+    if (!header.HasMagic(kSWSGMagic) || !header.SupportedVersion()) {
+      std::cout << filename_ << " is not a split weighted graph" << std::endl;
+      std::exit(-7);
+    }
+    CheckWidths(header, false);
+    if ((weight_bytes != 0) && (header.weight_width() != weight_bytes)) {
+      std::cout << "Weight width in " << filename_ << " does not match -W"
+                << std::endl;
+      std::exit(-5);
+    }
+    bool narrow_file = header.id_width() == sizeof(int32_t);
+    if (!(narrow_file ? NeighSizeMatches<int32_t>(header)
+                      : NeighSizeMatches<int64_t>(header))) {
+      std::cout << "Neighbor size in " << filename_ << " does not match .swsg"
+                << std::endl;
+      std::exit(-7);
+    }
+    return header;
+  }
+
+  // Topology is laid out as in .sg, so it is read (or mapped) the same way
+  CSRGraph<NodeID_, DestID_, invert> ReadSplitTopology(
+      const SGHeader &header, bool &use_mmap, char **mapped_base = nullptr) {
+    if (use_mmap && (header.id_width() != sizeof(NodeID_))) {
+      std::cout << "Serialized graph with " << 8 * header.id_width()
+                << "-bit IDs can't be mapped, reading instead" << std::endl;
+      use_mmap = false;
+    }
+    if (use_mmap)
+      return MapSerializedGraph(header, mapped_base);
+    else if (header.id_width() == sizeof(int32_t))
+      return StreamSerializedGraph<int32_t>(header);
     else
-      return CSRGraph<NodeID_, DestID_, invert>(num_nodes, index, neighs);
+      return StreamSerializedGraph<int64_t>(header);
+  }
+
+  // Unweighted kernels can use a .swsg by reading only its topology
+  CSRGraph<NodeID_, DestID_, invert> ReadSplitTopology(bool use_mmap = false) {
+    Timer t;
+    t.Start();
+    std::ifstream file;
+    SGHeader header = OpenSplitGraph(file, 0);
+    file.close();
+    CSRGraph<NodeID_, DestID_, invert> g = ReadSplitTopology(header, use_mmap);
+    t.Stop();
+    PrintTime(use_mmap ? "Map Time" : "Read Time", t.Seconds());
+    return g;
+  }
+
+  template <typename StoreT_>
+  SplitWGraph<NodeID_, WeightT_, StoreT_, invert> ReadSplitGraph(
+      bool use_mmap = false) {
+    Timer t;
+    t.Start();
+    std::ifstream file;
+    SGHeader header = OpenSplitGraph(file, sizeof(StoreT_));
+    file.close();
+    SGLayout layout(header);
+    char *base = nullptr;
+    CSRGraph<NodeID_, DestID_, invert> topology =
+        ReadSplitTopology(header, use_mmap, &base);
+    StoreT_ *weights = nullptr, *inv_weights = nullptr;
+    bool read_inverse = header.directed && invert;
+    if (use_mmap) {
+      weights = reinterpret_cast<StoreT_*>(base + layout.out_weights);
+      if (read_inverse)
+        inv_weights = reinterpret_cast<StoreT_*>(base + layout.in_weights);
+    } else {
+      int64_t weights_bytes = header.num_edges * sizeof(StoreT_);
+      int fd = OpenForParallelRead();
+      weights = AllocArray<StoreT_>(header.num_edges);
+      bool ok = ParallelRead(fd, layout.out_weights, weights_bytes, weights);
+      if (read_inverse) {
+        inv_weights = AllocArray<StoreT_>(header.num_edges);
+        ok = ParallelRead(fd, layout.in_weights, weights_bytes, inv_weights) &&
+             ok;
+      }
+      close(fd);
+      if (!ok) {
+        std::cout << "Truncated serialized graph " << filename_ << std::endl;
+        std::exit(-7);
+      }
+    }
+    WeightT_ scale = std::max(header.weight_scale, static_cast<uint32_t>(1));
+    SplitWGraph<NodeID_, WeightT_, StoreT_, invert> g(std::move(topology),
+        weights, inv_weights, scale, use_mmap);
+    t.Stop();
+    PrintTime(use_mmap ? "Map Time" : "Read Time", t.Seconds());
+    return g;
+  }
+
+  // Width of weights in a .swsg (in bits)
+  int SplitWeightBits() {
+    std::ifstream file;
+    return 8 * OpenSplitGraph(file, 0).weight_width();
+  }
+
+  CompressedGraph<NodeID_, invert> ReadCompressedGraph(bool use_mmap = false) {
+    if (!std::is_same<NodeID_, DestID_>::value) {
+      std::cout << ".csg not allowed for weighted graphs" << std::endl;
+      std::exit(-5);
+    }
+    std::ifstream file(filename_, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+      std::cout << "Couldn't open file " << filename_ << std::endl;
+      std::exit(-6);
+    }
+    Timer t;
+    t.Start();
+    SGHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(SGHeader));
+    if (!header.HasMagic(kCSGMagic) || !header.SupportedVersion()) {
+      std::cout << filename_ << " is not a compressed graph" << std::endl;
+      std::exit(-7);
+    }
+    CheckWidths(header, false);
+    SGLayout layout(header);
+    SGOffset *offsets = nullptr, *inv_offsets = nullptr;
+    uint8_t *bytes = nullptr, *inv_bytes = nullptr;
+    void *mapping = nullptr;
+    bool read_inverse = header.directed && invert;
+    if (use_mmap) {
+      mapping = MapFile(layout.file_size);
+      char *base = static_cast<char*>(mapping);
+      offsets = reinterpret_cast<SGOffset*>(base + layout.out_offsets);
+      bytes = reinterpret_cast<uint8_t*>(base + layout.out_neighs);
+      if (read_inverse) {
+        inv_offsets = reinterpret_cast<SGOffset*>(base + layout.in_offsets);
+        inv_bytes = reinterpret_cast<uint8_t*>(base + layout.in_neighs);
+      }
+    } else {
+      int fd = OpenForParallelRead();
+      offsets = AllocArray<SGOffset>(header.num_nodes + 1);
+      bytes = AllocArray<uint8_t>(layout.out_neighs_bytes);
+      bool ok = ParallelRead(fd, layout.out_offsets, layout.offsets_bytes,
+                             offsets);
+      ok = ParallelRead(fd, layout.out_neighs, layout.out_neighs_bytes,
+                        bytes) && ok;
+      if (read_inverse) {
+        inv_offsets = AllocArray<SGOffset>(header.num_nodes + 1);
+        inv_bytes = AllocArray<uint8_t>(layout.in_neighs_bytes);
+        ok = ParallelRead(fd, layout.in_offsets, layout.offsets_bytes,
+                          inv_offsets) && ok;
+        ok = ParallelRead(fd, layout.in_neighs, layout.in_neighs_bytes,
+                          inv_bytes) && ok;
+      }
+      close(fd);
+      if (!ok) {
+        std::cout << "Truncated compressed graph " << filename_ << std::endl;
+        std::exit(-7);
+      }
+    }
+    file.close();
+    int64_t num_edges = header.directed ? header.num_edges
+                                        : header.num_edges / 2;
+    CompressedGraph<NodeID_, invert> g(header.directed, header.num_nodes,
+                                       num_edges, offsets, bytes,
+                                       inv_offsets, inv_bytes);
+    if (use_mmap)
+      g.AdoptMapping(mapping, layout.file_size);
+    t.Stop();
+    PrintTime(use_mmap ? "Map Time" : "Read Time", t.Seconds());
+    return g;
   }
 };
 
@@ -0,0 +1,306 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef REORDER_H_
+#define REORDER_H_
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+#include "pvector.h"
+
+
+/*
+GAP Benchmark Suite
+File:   Reorder
+Author: Scott Beamer
+
+Vertex orderings to improve locality, selected by name (-O)
+ - degree: decreasing degree
+ - hubsort: hubs (above average degree) first by decreasing degree, and then
+   the rest in their original order [1]
+ - hubcluster: hubs first and then the rest, each in their original order [2]
+ - rcm: reverse Cuthill-McKee [3], BFS from the lowest degree unvisited vertex
+   of each component that visits neighbors by increasing degree, so it gives
+   nearby IDs to neighbors (good for high-diameter graphs like road networks)
+ - gorder: greedy Gorder-style ordering [4] that places next the vertex with
+   the most neighbors and siblings (shared neighbors) among the last kWindow
+   placed. To stay lightweight, siblings are only found through neighbors of
+   degree at most kMaxSiblingDegree, and scores are kept in buckets so every
+   update is O(1) (GorderQueue).
+Each returns new_ids (new_ids[n] is the new ID for n) for BuilderBase::Relabel
+to apply. For directed graphs, neighbors in both directions are used.
+
+[1] Yunming Zhang, Vladimir Kiriansky, Charith Mendis, Saman Amarasinghe, and
+    Matei Zaharia. "Making Caches Work for Graph Analytics." IEEE
+    International Conference on Big Data, 2017.
+
+[2] Vignesh Balaji and Brandon Lucia. "When is Graph Reordering an
+    Optimization? Studying the Effect of Lightweight Graph Reordering Across
+    Applications and Input Graphs." IEEE International Symposium on Workload
+    Characterization (IISWC), 2018.
+
+[3] Elizabeth Cuthill and James McKee. "Reducing the Bandwidth of Sparse
+    Symmetric Matrices." ACM National Conference, 1969.
+
+[4] Hao Wei, Jeffrey Xu Yu, Can Lu, and Xuemin Lin. "Speedup Graph Processing
+    by Graph Ordering." International Conference on Management of Data
+    (SIGMOD), 2016.
+*/
+
+
+template <typename NodeID_, typename DestID_, bool invert>
+int64_t TotalDegree(const CSRGraph<NodeID_, DestID_, invert> &g, NodeID_ n) {
+  if (g.directed())
+    return g.out_degree(n) + g.in_degree(n);
+  return g.out_degree(n);
+}
+
+
+// Calls visit(v) for each neighbor v of n (in both directions if directed)
+template <typename NodeID_, typename DestID_, bool invert, typename VisitorT_>
+void ForEachNeighbor(const CSRGraph<NodeID_, DestID_, invert> &g, NodeID_ n,
+                     VisitorT_ visit) {
+  for (DestID_ d : g.out_neigh(n))
+    visit(static_cast<NodeID_>(d));
+  if (g.directed()) {
+    for (DestID_ d : g.in_neigh(n))
+      visit(static_cast<NodeID_>(d));
+  }
+}
+
+
+// Vertices paired with their degrees, sorted (by degree, then ID)
+template <typename NodeID_, typename DestID_, bool invert, typename CompareT_>
+pvector<std::pair<int64_t, NodeID_>> SortByDegree(
+    const CSRGraph<NodeID_, DestID_, invert> &g, CompareT_ compare) {
+  pvector<std::pair<int64_t, NodeID_>> degree_id_pairs(g.num_nodes());
+  #pragma omp parallel for
+  for (NodeID_ n=0; n < g.num_nodes(); n++)
+    degree_id_pairs[n] = std::make_pair(TotalDegree(g, n), n);
+  std::sort(degree_id_pairs.begin(), degree_id_pairs.end(), compare);
+  return degree_id_pairs;
+}
+
+
+template <typename NodeID_, typename DestID_, bool invert>
+pvector<NodeID_> DegreeOrder(const CSRGraph<NodeID_, DestID_, invert> &g) {
+  typedef std::pair<int64_t, NodeID_> degree_node_p;
+  pvector<degree_node_p> degree_id_pairs =
+      SortByDegree(g, std::greater<degree_node_p>());
+  pvector<NodeID_> new_ids(g.num_nodes());
+  #pragma omp parallel for
+  for (NodeID_ n=0; n < g.num_nodes(); n++)
+    new_ids[degree_id_pairs[n].second] = n;
+  return new_ids;
+}
+
+
+// Hubs first (sorted by decreasing degree if sort_hubs), then non-hubs
+template <typename NodeID_, typename DestID_, bool invert>
+pvector<NodeID_> HubOrder(const CSRGraph<NodeID_, DestID_, invert> &g,
+                          bool sort_hubs) {
+  int64_t total_degree = 0;
+  #pragma omp parallel for reduction(+ : total_degree)
+  for (NodeID_ n=0; n < g.num_nodes(); n++)
+    total_degree += TotalDegree(g, n);
+  double average_degree = static_cast<double>(total_degree) / g.num_nodes();
+  std::vector<std::pair<int64_t, NodeID_>> hubs;
+  for (NodeID_ n=0; n < g.num_nodes(); n++) {
+    if (TotalDegree(g, n) > average_degree)
+      hubs.push_back(std::make_pair(TotalDegree(g, n), n));
+  }
+  if (sort_hubs) {
+    std::stable_sort(hubs.begin(), hubs.end(),
+                     [](const std::pair<int64_t, NodeID_> &a,
+                        const std::pair<int64_t, NodeID_> &b) {
+                       return a.first > b.first;
+                     });
+  }
+  pvector<NodeID_> new_ids(g.num_nodes());
+  NodeID_ next_id = 0;
+  for (auto hub : hubs)
+    new_ids[hub.second] = next_id++;
+  for (NodeID_ n=0; n < g.num_nodes(); n++) {
+    if (TotalDegree(g, n) <= average_degree)
+      new_ids[n] = next_id++;
+  }
+  return new_ids;
+}
+
+
+template <typename NodeID_, typename DestID_, bool invert>
+pvector<NodeID_> RCMOrder(const CSRGraph<NodeID_, DestID_, invert> &g) {
+  typedef std::pair<int64_t, NodeID_> degree_node_p;
+  pvector<degree_node_p> degree_id_pairs =
+      SortByDegree(g, std::less<degree_node_p>());
+  std::vector<bool> visited(g.num_nodes(), false);
+  pvector<NodeID_> order(g.num_nodes());
+  int64_t head = 0, tail = 0;
+  std::vector<degree_node_p> to_add;
+  for (degree_node_p start : degree_id_pairs) {
+    if (visited[start.second])
+      continue;
+    visited[start.second] = true;
+    order[tail++] = start.second;
+    while (head < tail) {
+      NodeID_ u = order[head++];
+      to_add.clear();
+      ForEachNeighbor(g, u, [&](NodeID_ v) {
+        if (!visited[v]) {
+          visited[v] = true;
+          to_add.push_back(std::make_pair(TotalDegree(g, v), v));
+        }
+      });
+      std::sort(to_add.begin(), to_add.end());
+      for (degree_node_p p : to_add)
+        order[tail++] = p.second;
+    }
+  }
+  pvector<NodeID_> new_ids(g.num_nodes());
+  #pragma omp parallel for
+  for (NodeID_ n=0; n < g.num_nodes(); n++)
+    new_ids[order[n]] = g.num_nodes() - 1 - n;
+  return new_ids;
+}
+
+
+// Max priority queue of vertex scores with O(1) increment and decrement,
+//   vertices with a score of zero are left out
+template <typename NodeID_>
+class GorderQueue {
+ public:
+  explicit GorderQueue(int64_t num_nodes)
+      : scores_(num_nodes, 0), prev_(num_nodes), next_(num_nodes),
+        heads_(1, -1) {}
+
+  void Increment(NodeID_ v) {
+    Unlink(v);
+    scores_[v]++;
+    Link(v);
+  }
+
+  void Decrement(NodeID_ v) {
+    Unlink(v);
+    scores_[v]--;
+    Link(v);
+  }
+
+  void Remove(NodeID_ v) {
+    Unlink(v);
+    scores_[v] = 0;
+  }
+
+  // Returns vertex with highest score, or -1 if all scores are zero
+  NodeID_ Top() {
+    while ((top_ > 0) && (heads_[top_] == -1))
+      top_--;
+    return heads_[top_];
+  }
+
+ private:
+  void Link(NodeID_ v) {
+    int64_t s = scores_[v];
+    if (s == 0)
+      return;
+    if (s >= static_cast<int64_t>(heads_.size()))
+      heads_.resize(s + 1, -1);
+    prev_[v] = -1;
+    next_[v] = heads_[s];
+    if (heads_[s] != -1)
+      prev_[heads_[s]] = v;
+    heads_[s] = v;
+    top_ = std::max(top_, s);
+  }
+
+  void Unlink(NodeID_ v) {
+    if (scores_[v] == 0)
+      return;
+    if (prev_[v] != -1)
+      next_[prev_[v]] = next_[v];
+    else
+      heads_[scores_[v]] = next_[v];
+    if (next_[v] != -1)
+      prev_[next_[v]] = prev_[v];
+  }
+
+  pvector<int64_t> scores_;
+  pvector<NodeID_> prev_;
+  pvector<NodeID_> next_;
+  std::vector<NodeID_> heads_;
+  int64_t top_ = 0;
+};
+
+
+template <typename NodeID_, typename DestID_, bool invert>
+pvector<NodeID_> GorderOrder(const CSRGraph<NodeID_, DestID_, invert> &g) {
+  const int64_t kWindow = 5;
+  const int64_t kMaxSiblingDegree = 32;
+  typedef std::pair<int64_t, NodeID_> degree_node_p;
+  pvector<degree_node_p> degree_id_pairs =
+      SortByDegree(g, std::greater<degree_node_p>());
+  GorderQueue<NodeID_> queue(g.num_nodes());
+  std::vector<bool> placed(g.num_nodes(), false);
+  // Adds (or removes) score from v being in the window to unplaced vertices
+  auto UpdateScores = [&](NodeID_ v, bool entering) {
+    auto Update = [&](NodeID_ u) {
+      if (!placed[u]) {
+        if (entering)
+          queue.Increment(u);
+        else
+          queue.Decrement(u);
+      }
+    };
+    ForEachNeighbor(g, v, [&](NodeID_ x) {
+      Update(x);
+      if (TotalDegree(g, x) <= kMaxSiblingDegree)
+        ForEachNeighbor(g, x, Update);
+    });
+  };
+  pvector<NodeID_> new_ids(g.num_nodes());
+  std::vector<NodeID_> window(kWindow);
+  int64_t next_by_degree = 0;
+  for (int64_t i=0; i < g.num_nodes(); i++) {
+    NodeID_ v = queue.Top();
+    if (v == -1) {
+      while (placed[degree_id_pairs[next_by_degree].second])
+        next_by_degree++;
+      v = degree_id_pairs[next_by_degree].second;
+    }
+    queue.Remove(v);
+    placed[v] = true;
+    new_ids[v] = i;
+    if (i >= kWindow)
+      UpdateScores(window[i % kWindow], false);
+    window[i % kWindow] = v;
+    UpdateScores(v, true);
+  }
+  return new_ids;
+}
+
+
+template <typename NodeID_, typename DestID_, bool invert>
+pvector<NodeID_> ComputeOrder(const CSRGraph<NodeID_, DestID_, invert> &g,
+                              const std::string &order) {
+  if (order == "degree")
+    return DegreeOrder(g);
+  if (order == "hubsort")
+    return HubOrder(g, true);
+  if (order == "hubcluster")
+    return HubOrder(g, false);
+  if (order == "rcm")
+    return RCMOrder(g);
+  if (order == "gorder")
+    return GorderOrder(g);
+  std::cout << "Unrecognized vertex order: " << order << std::endl;
+  std::exit(-40);
+}
+
+#endif  // REORDER_H_
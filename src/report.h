@@ -0,0 +1,160 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef REPORT_H_
+#define REPORT_H_
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+/*
+GAP Benchmark Suite
+Class:  Report
+Author: Scott Beamer
+
+Machine-readable copy of benchmark output (-j file), for tracking results
+ - Each record has a type, and the kernel and trial (if during one) it is from
+ - util.h's PrintTime, PrintStep, & PrintLabel also write time, step, & label
+   records, so everything printed (including -l logging) is captured
+ - BenchmarkKernel adds graph, config, trial, & summary records, with derived
+   rates (teps counts undirected edges once, edges_per_second counts arcs)
+ - Format is CSV if file ends in .csv (one row per field, with the record's
+   sequence number to regroup them), otherwise JSON lines (one object per
+   record)
+ - Human-readable output to stdout is unchanged
+*/
+
+
+class Report {
+ public:
+  struct Field {
+    std::string key;
+    std::string value;
+    bool is_string;
+  };
+  typedef std::vector<Field> Fields;
+
+  static Report& Get() {
+    static Report report;
+    return report;
+  }
+
+  void Open(const std::string &filename, const std::string &kernel) {
+    out_.open(filename);
+    if (!out_) {
+      std::cout << "Couldn't write to file " << filename << std::endl;
+      std::exit(-5);
+    }
+    std::string suffix = ".csv";
+    csv_ = (filename.size() >= suffix.size()) &&
+           (filename.compare(filename.size() - suffix.size(), suffix.size(),
+                             suffix) == 0);
+    if (csv_)
+      out_ << "kernel,record,type,trial,key,value" << std::endl;
+    kernel_ = kernel;
+  }
+
+  bool enabled() const { return out_.is_open(); }
+
+  void set_kernel(const std::string &kernel) { kernel_ = kernel; }
+
+  // Subsequent records are from trial (-1 if not in a trial)
+  void set_trial(int trial) { trial_ = trial; }
+
+  static Field String(const std::string &key, const std::string &value) {
+    return Field{key, value, true};
+  }
+
+  // Non-finite values (e.g. rates of a zero time) aren't valid JSON numbers
+  static Field Number(const std::string &key, double value) {
+    if (!std::isfinite(value))
+      return Field{key, "null", false};
+    std::ostringstream ss;
+    ss.precision(9);
+    ss << value;
+    return Field{key, ss.str(), false};
+  }
+
+  static Field Number(const std::string &key, int64_t value) {
+    return Field{key, std::to_string(value), false};
+  }
+
+  static Field Bool(const std::string &key, bool value) {
+    return Field{key, value ? "true" : "false", false};
+  }
+
+  void Write(const std::string &type, const Fields &fields) {
+    if (!enabled())
+      return;
+    if (csv_) {
+      for (const Field &f : fields) {
+        out_ << CSVQuote(kernel_) << "," << num_records_ << "," << type
+             << ",";
+        if (trial_ != -1)
+          out_ << trial_;
+        out_ << "," << CSVQuote(f.key) << ","
+             << (f.is_string ? CSVQuote(f.value) : f.value) << "\n";
+      }
+    } else {
+      out_ << "{\"type\": " << JSONQuote(type) << ", \"kernel\": "
+           << JSONQuote(kernel_);
+      if (trial_ != -1)
+        out_ << ", \"trial\": " << trial_;
+      for (const Field &f : fields) {
+        out_ << ", " << JSONQuote(f.key) << ": "
+             << (f.is_string ? JSONQuote(f.value) : f.value);
+      }
+      out_ << "}\n";
+    }
+    out_.flush();
+    num_records_++;
+  }
+
+ private:
+  Report() {}
+
+  static std::string JSONQuote(const std::string &s) {
+    std::string quoted = "\"";
+    for (char c : s) {
+      if ((c == '"') || (c == '\\')) {
+        quoted += '\\';
+        quoted += c;
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        char escaped[8];
+        snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        quoted += escaped;
+      } else {
+        quoted += c;
+      }
+    }
+    return quoted + "\"";
+  }
+
+  static std::string CSVQuote(const std::string &s) {
+    if (s.find_first_of(",\"\n") == std::string::npos)
+      return s;
+    std::string quoted = "\"";
+    for (char c : s) {
+      if (c == '"')
+        quoted += '"';
+      quoted += c;
+    }
+    return quoted + "\"";
+  }
+
+  std::ofstream out_;
+  bool csv_ = false;
+  std::string kernel_;
+  int trial_ = -1;
+  int64_t num_records_ = 0;
+};
+
+#endif  // REPORT_H_
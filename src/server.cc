@@ -0,0 +1,345 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+#include "bitmap.h"
+#include "builder.h"
+#include "command_line.h"
+#include "counters.h"
+#include "dynamic_graph.h"
+#include "frontier.h"
+#include "graph.h"
+#include "partition.h"
+#include "intersect.h"
+#include "platform_atomics.h"
+#include "pvector.h"
+#include "sliding_queue.h"
+#include "timer.h"
+#include "util.h"
+
+
+/*
+GAP Benchmark Suite
+File:   Server
+Author: Scott Beamer
+
+Loads a graph once and then runs kernels on it for each request read from
+stdin, so graph loading & building isn't repeated for every query
+
+Each request is a line with a kernel (bfs, bc, cc, pr, sssp, or tc) followed
+by that kernel's options, e.g. "bfs -r 12 -v", and its output is followed by
+its Request Time. Requests run a single trial unless -n is given, and graph
+options (-f, -g, -O, ...) are ignored since the graph is already built.
+Results of all requests go to the file given to the server by -j, so requests
+can't give their own. The weighted graph (for sssp) is built from the same
+input on its first request, and then also kept, as are the scratch buffers of
+bc, bfs, and sssp, so later requests don't allocate them again. Serialized
+inputs without weights (.sg, .csg, or .swsg) can't give a weighted graph, so
+sssp requests are refused. "quit" (or end of input) stops the server.
+
+The graph can be changed between requests by "insert <file>" and "delete
+<file>", which apply the edges of a text edge list (.el) as one batch to a
+DynamicGraph wrapping the graph. While it holds updates, bfs, cc, and pr run
+on it directly (and cc only links newly inserted edges to update its previous
+components when nothing was deleted), while bc and tc first compact it back
+into a CSRGraph. Updates aren't weighted, so sssp is unavailable after them.
+Like -r, update files use the input's vertex IDs, even if relabeled (-O).
+
+The kernels are compiled in from their own source files, each wrapped in a
+namespace (and without their main functions), so they run exactly as their
+standalone binaries do. All headers they use must be included above first.
+Like the standalone kernels, invalid options exit (and so stop the server).
+
+The suite runner (gapbs.cc) reuses KernelServer to run a plan of requests on
+one loaded graph, with each kernel's own default trial count, and it can load
+the weighted (sssp) and undirected (tc) variants of the graph from their own
+files instead.
+*/
+
+
+#define NO_MAIN
+namespace bc_kernel {
+#include "bc.cc"
+}
+namespace bfs_kernel {
+#include "bfs.cc"
+}
+namespace cc_kernel {
+#include "cc.cc"
+}
+namespace pr_kernel {
+#include "pr.cc"
+}
+namespace sssp_kernel {
+#include "sssp.cc"
+}
+namespace tc_kernel {
+#include "tc.cc"
+}
+#undef NO_MAIN
+
+
+using namespace std;
+
+
+class KernelServer {
+ public:
+  KernelServer(const CLApp &cli, Graph &&g, bool single_trial = true) :
+    cli_(cli), dg_(std::move(g)), single_trial_(single_trial) {}
+
+  // True if sssp's weighted graph can be built, which it can't be from
+  //   serialized inputs that don't hold weights (or hold them split)
+  static bool HasWeightedInput(const string &filename,
+                               const string &weighted_filename) {
+    if ((weighted_filename != "") || (filename == ""))
+      return true;
+    string suffix = Reader<NodeID, NodeID, WeightT>(filename).GetSuffix();
+    return (suffix != ".sg") && (suffix != ".csg") && (suffix != ".swsg");
+  }
+
+  // Input files of graph's variants, otherwise built from (or same as) graph
+  void set_variant_inputs(string weighted_filename,
+                          string undirected_filename) {
+    weighted_filename_ = weighted_filename;
+    undirected_filename_ = undirected_filename;
+  }
+
+  void Run(istream &requests) {
+    string line;
+    while (getline(requests, line)) {
+      vector<string> args = Tokenize(line);
+      if (args.empty())
+        continue;
+      if ((args[0] == "quit") || (args[0] == "exit"))
+        break;
+      if (args[0] == "help") {
+        cout << "Request: <kernel> [options], kernels: "
+             << "bc bfs cc pr sssp tc" << endl;
+        cout << "Update: insert <file.el> or delete <file.el>" << endl;
+        continue;
+      }
+      if (find(args.begin(), args.end(), "-h") != args.end()) {
+        cout << "Kernel help (-h) is only available from its binary" << endl;
+        continue;
+      }
+      auto is_report_arg = [](const string &arg) {
+        return arg.compare(0, 2, "-j") == 0;
+      };
+      if (find_if(args.begin(), args.end(), is_report_arg) != args.end()) {
+        cout << "Results file (-j) can only be given when starting" << endl;
+        continue;
+      }
+      Timer t;
+      t.Start();
+      if ((args[0] == "insert") || (args[0] == "delete"))
+        HandleUpdate(args);
+      else
+        HandleRequest(args);
+      t.Stop();
+      PrintTime("Request Time", t.Seconds());
+      cout << flush;
+    }
+  }
+
+ private:
+  static vector<string> Tokenize(const string &line) {
+    vector<string> tokens;
+    istringstream ss(line);
+    string token;
+    while (ss >> token)
+      tokens.push_back(token);
+    return tokens;
+  }
+
+  void HandleUpdate(const vector<string> &args) {
+    if (args.size() != 2) {
+      cout << "Update needs one edge list file, e.g. insert new.el" << endl;
+      return;
+    }
+    Reader<NodeID, NodeID, WeightT> r(args[1]);
+    bool needs_weights = false;
+    pvector<EdgePair<NodeID>> el = r.ReadFile(needs_weights);
+    MapToRelabeled(el);
+    if (args[0] == "insert") {
+      dg_.InsertEdges(el);
+      cc_history_.Insert(el);
+    } else {
+      dg_.DeleteEdges(el);
+      cc_history_.Invalidate();
+    }
+    updated_ = true;
+    bc_scratch_.reset();        // sized by number of edges
+    dg_.PrintStats();
+  }
+
+  // Update files use input IDs (like -r), so if the graph was relabeled (-O),
+  //   maps them to its IDs (RelabeledID, but inverting original IDs once)
+  void MapToRelabeled(pvector<EdgePair<NodeID>> &el) const {
+    const Graph &base = dg_.base();
+    if (!base.relabeled())
+      return;
+    pvector<NodeID> new_ids(base.num_nodes());
+    #pragma omp parallel for
+    for (NodeID n=0; n < base.num_nodes(); n++)
+      new_ids[base.original_id(n)] = n;
+    #pragma omp parallel for
+    for (size_t i=0; i < el.size(); i++) {
+      el[i].u = new_ids[el[i].u];
+      el[i].v = new_ids[el[i].v];
+    }
+  }
+
+  void HandleRequest(vector<string> args) {
+    string kernel = args[0];
+    if (single_trial_)
+      args.insert(args.begin() + 1, {"-n", "1"});
+    vector<char*> argv;
+    for (string &arg : args)
+      argv.push_back(&arg[0]);
+    argv.push_back(nullptr);
+    int argc = args.size();
+    optind = 1;                   // reset getopt for this request
+    Report::Get().set_kernel(kernel);
+    if ((kernel == "bfs") || (kernel == "cc") || (kernel == "pr")) {
+      if (dg_.delta_edges() == 0)
+        RunOnAnyGraph(kernel, argc, argv.data(), dg_.base());
+      else
+        RunOnAnyGraph(kernel, argc, argv.data(), dg_);
+    } else if (kernel == "bc") {
+      CLBatch cli(argc, argv.data(), "betweenness-centrality", 1);
+      if (cli.ParseArgs(false))
+        bc_kernel::BenchmarkBC(cli, csr_graph(),
+                               Scratch(bc_scratch_, csr_graph()));
+    } else if (kernel == "sssp") {
+      if (updated_) {
+        cout << "Updated graph has no weights for sssp" << endl;
+        return;
+      }
+      if (!HasWeightedInput(cli_.filename(), weighted_filename_)) {
+        cout << "Input " << cli_.filename() << " has no weights for sssp "
+             << "(needs a .wsg or a text input)" << endl;
+        return;
+      }
+      CLDelta<WeightT> cli(argc, argv.data(), "single-source shortest-path");
+      if (!cli.ParseArgs(false))
+        return;
+      if (cli.split_weight_bits() != 0)
+        cout << "Split weights (-W) need the sssp binary" << endl;
+      else
+        sssp_kernel::BenchmarkSSSP(cli, weighted_graph(),
+                                   Scratch(sssp_scratch_, weighted_graph()));
+    } else if (kernel == "tc") {
+      if (updated_ && (undirected_filename_ != "")) {
+        cout << "Undirected variant doesn't include updates for tc" << endl;
+        return;
+      }
+      CLIntersect cli(argc, argv.data(), "triangle count");
+      if (cli.ParseArgs(false))
+        tc_kernel::BenchmarkTC(cli, undirected_graph());
+    } else {
+      cout << "Unrecognized kernel: " << kernel << " (try help)" << endl;
+    }
+  }
+
+  // Kernels that run on either the CSRGraph or the DynamicGraph
+  template <typename GraphT_>
+  void RunOnAnyGraph(const string &kernel, int argc, char** argv,
+                     const GraphT_ &g) {
+    if (kernel == "bfs") {
+      CLApp cli(argc, argv, "breadth-first search");
+      if (cli.ParseArgs(false))
+        bfs_kernel::BenchmarkBFS(cli, g, Scratch(bfs_scratch_, g.num_nodes()));
+    } else if (kernel == "cc") {
+      CLApp cli(argc, argv, "connected-components-afforest");
+      if (cli.ParseArgs(false))
+        cc_kernel::BenchmarkCC(cli, g, cc_history_);
+    } else if (kernel == "pr") {
+      CLPageRankWarm cli(argc, argv, "pagerank", 1e-4, 20);
+      if (cli.ParseArgs(false))
+        pr_kernel::BenchmarkPR(cli, g);
+    }
+  }
+
+  // Folds any updates into the base graph, for kernels that need a CSRGraph
+  const Graph& csr_graph() {
+    dg_.Compact();
+    return dg_.base();
+  }
+
+  // Allocates kernel scratch on first use
+  template <typename ScratchT_, typename ArgT_>
+  static ScratchT_& Scratch(unique_ptr<ScratchT_> &scratch, const ArgT_ &arg) {
+    if (!scratch)
+      scratch.reset(new ScratchT_(arg));
+    return *scratch;
+  }
+
+  const WGraph& weighted_graph() {
+    if (!weighted_built_) {
+      CLApp variant_cli = cli_;
+      if (weighted_filename_ != "")
+        variant_cli.set_filename(weighted_filename_);
+      WeightedBuilder b(variant_cli);
+      wg_ = b.MakeGraph();
+      weighted_built_ = true;
+    }
+    return wg_;
+  }
+
+  const Graph& undirected_graph() {
+    if (undirected_filename_ == "")
+      return csr_graph();
+    if (!undirected_built_) {
+      CLApp variant_cli = cli_;
+      variant_cli.set_filename(undirected_filename_);
+      Builder b(variant_cli);
+      ug_ = b.MakeGraph();
+      undirected_built_ = true;
+    }
+    return ug_;
+  }
+
+  const CLApp &cli_;
+  DGraph dg_;
+  bool single_trial_;
+  string weighted_filename_ = "";
+  string undirected_filename_ = "";
+  WGraph wg_;
+  bool weighted_built_ = false;
+  Graph ug_;
+  bool undirected_built_ = false;
+  bool updated_ = false;
+  cc_kernel::CCHistory cc_history_;
+  unique_ptr<bc_kernel::BCScratch> bc_scratch_;
+  unique_ptr<bfs_kernel::BFSScratch> bfs_scratch_;
+  unique_ptr<sssp_kernel::SSSPScratch> sssp_scratch_;
+};
+
+
+#ifndef NO_SERVER_MAIN
+int main(int argc, char* argv[]) {
+  CLApp cli(argc, argv, "kernel server");
+  if (!cli.ParseArgs())
+    return -1;
+  Builder b(cli);
+  Graph g = b.MakeGraph();
+  KernelServer server(cli, std::move(g));
+  server.Run(cin);
+  return 0;
+}
+#endif
@@ -0,0 +1,162 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef SG_FORMAT_H_
+#define SG_FORMAT_H_
+
+#include <cinttypes>
+#include <cstring>
+
+
+/*
+GAP Benchmark Suite
+File:   SG Format
+Author: Scott Beamer
+
+On-disk layout for serialized graphs (.sg, .wsg, compressed .csg, & split
+weighted .swsg)
+ - Fixed 64B header (SGHeader) followed by the CSR arrays in this order:
+   out offsets, out neighbors, [in offsets, in neighbors] (only if directed)
+ - For .csg, neighbors are byte-encoded (see CompressedGraph), so the header
+   records the size of each neighbor array and offsets are byte positions
+ - Every array starts on a kSGAlignment boundary so a memory-mapped file can
+   be used in place without copying
+ - Relabeled graphs (see reorder.h) also store each vertex's original ID in
+   an array after the rest (flagged by has_original_ids)
+ - Version 1 files written before the neighbor array sizes were recorded
+   have zeros there, so they are filled in when read (FillLegacyNeighSizes)
+ - Since version 2, the header records the widths of vertex IDs and weights
+   (id_bytes & weight_bytes), so 32-bit & 64-bit ID builds (-DGAP_ID64) can
+   tell files apart. Version 1 files have 32-bit IDs and weights.
+ - For .swsg (see SplitWGraph), the arrays are those of an unweighted .sg,
+   followed by weights (weight_bytes each) for out & [in] neighbors, and
+   stored weights are multiplied by weight_scale when read
+ - Files written before the header was introduced (legacy) start directly
+   with the directed flag, and they are still readable (but not mappable)
+*/
+
+
+static const char kSGMagic[4] = {'G', 'A', 'P', 'S'};
+static const char kCSGMagic[4] = {'G', 'A', 'P', 'C'};
+static const char kSWSGMagic[4] = {'G', 'A', 'P', 'W'};
+static const uint32_t kSGVersion = 2;
+static const uint32_t kSGMinVersion = 1;
+static const int64_t kSGAlignment = 4096;
+
+
+struct SGHeader {
+  char magic[4];
+  uint32_t version;
+  uint8_t directed;
+  uint8_t has_original_ids;
+  uint8_t id_bytes;         // version 2+
+  uint8_t weight_bytes;     // version 2+, 0 if unweighted
+  uint32_t weight_scale;    // .swsg only
+  int64_t num_nodes;
+  int64_t num_edges;        // number of edges stored per direction
+  int64_t out_neighs_bytes;
+  int64_t in_neighs_bytes;
+  uint8_t padding[16];
+
+  SGHeader() {
+    std::memset(this, 0, sizeof(SGHeader));
+  }
+
+  SGHeader(bool is_directed, int64_t nodes, int64_t edges,
+           int64_t bytes_per_neigh, int64_t bytes_per_id,
+           int64_t bytes_per_weight, const char *file_magic = kSGMagic)
+      : SGHeader() {
+    std::memcpy(magic, file_magic, sizeof(magic));
+    version = kSGVersion;
+    directed = is_directed;
+    id_bytes = bytes_per_id;
+    weight_bytes = bytes_per_weight;
+    num_nodes = nodes;
+    num_edges = edges;
+    out_neighs_bytes = edges * bytes_per_neigh;
+    in_neighs_bytes = is_directed ? out_neighs_bytes : 0;
+  }
+
+  bool HasMagic(const char *file_magic = kSGMagic) const {
+    return std::memcmp(magic, file_magic, sizeof(magic)) == 0;
+  }
+
+  // The first version 1 files (.sg & .wsg) left neighbor sizes as zeros, but
+  //   their neighbors (32-bit, like all version 1) are laid out the same
+  void FillLegacyNeighSizes(int64_t bytes_per_neigh) {
+    if ((version == 1) && (num_edges > 0) && (out_neighs_bytes == 0) &&
+        (in_neighs_bytes == 0)) {
+      out_neighs_bytes = num_edges * bytes_per_neigh;
+      in_neighs_bytes = directed ? out_neighs_bytes : 0;
+    }
+  }
+
+  bool SupportedVersion() const {
+    return (version >= kSGMinVersion) && (version <= kSGVersion);
+  }
+
+  int64_t id_width() const {
+    return version >= 2 ? id_bytes : sizeof(int32_t);
+  }
+
+  int64_t weight_width() const {
+    return version >= 2 ? weight_bytes : sizeof(int32_t);
+  }
+};
+
+static_assert(sizeof(SGHeader) == 64, "SGHeader must be 64 bytes");
+
+
+inline int64_t SGAlignUp(int64_t pos) {
+  return (pos + kSGAlignment - 1) / kSGAlignment * kSGAlignment;
+}
+
+
+// Byte positions of each array within a serialized graph file
+struct SGLayout {
+  int64_t out_offsets;
+  int64_t out_neighs;
+  int64_t in_offsets;
+  int64_t in_neighs;
+  int64_t original_ids;
+  int64_t out_weights;
+  int64_t in_weights;
+  int64_t file_size;
+  int64_t offsets_bytes;
+  int64_t out_neighs_bytes;
+  int64_t in_neighs_bytes;
+
+  explicit SGLayout(const SGHeader &header) {
+    offsets_bytes = (header.num_nodes + 1) * sizeof(int64_t);
+    out_neighs_bytes = header.out_neighs_bytes;
+    in_neighs_bytes = header.in_neighs_bytes;
+    out_offsets = SGAlignUp(sizeof(SGHeader));
+    out_neighs = SGAlignUp(out_offsets + offsets_bytes);
+    int64_t out_end = out_neighs + out_neighs_bytes;
+    if (header.directed) {
+      in_offsets = SGAlignUp(out_end);
+      in_neighs = SGAlignUp(in_offsets + offsets_bytes);
+      file_size = in_neighs + in_neighs_bytes;
+    } else {
+      in_offsets = in_neighs = -1;
+      file_size = out_end;
+    }
+    original_ids = -1;
+    if (header.has_original_ids) {
+      original_ids = SGAlignUp(file_size);
+      file_size = original_ids + header.num_nodes * header.id_width();
+    }
+    out_weights = in_weights = -1;
+    if (header.HasMagic(kSWSGMagic)) {
+      int64_t weights_bytes = header.num_edges * header.weight_width();
+      out_weights = SGAlignUp(file_size);
+      file_size = out_weights + weights_bytes;
+      if (header.directed) {
+        in_weights = SGAlignUp(file_size);
+        file_size = in_weights + weights_bytes;
+      }
+    }
+  }
+};
+
+#endif  // SG_FORMAT_H_
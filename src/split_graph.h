@@ -0,0 +1,314 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef SPLIT_GRAPH_H_
+#define SPLIT_GRAPH_H_
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+#include "alloc.h"
+#include "graph.h"
+#include "pvector.h"
+#include "util.h"
+
+
+/*
+GAP Benchmark Suite
+Class:  SplitWGraph
+Author: Scott Beamer
+
+Weighted graph in CSR format with weights kept apart from destinations
+ - Intended to be constructed from a built weighted CSRGraph or read from a
+   .swsg file
+ - Destinations are an unweighted CSRGraph (topology), so kernels that only
+   need the topology can run on it without pulling weights through cache
+ - Weights are in arrays parallel to the neighbor arrays, in StoreT_, which
+   can be narrower than WeightT_ (e.g. 8 or 16 bits). If the largest weight
+   doesn't fit, weights are quantized by a weight_scale (stored weight times
+   scale, positive weights stay at least 1), so distances are approximate.
+ - Neighborhoods yield NodeWeight values through the same Neighborhood
+   interface as CSRGraph, so kernels can't take the address of a neighbor
+ - Weights must be non-negative if StoreT_ is unsigned
+*/
+
+
+template <class NodeID_, class WeightT_, class StoreT_ = WeightT_,
+          bool MakeInverse = true>
+class SplitWGraph {
+  // Used for *non-negative* offsets within a neighborhood
+  typedef std::make_unsigned<std::ptrdiff_t>::type OffsetT;
+  typedef NodeWeight<NodeID_, WeightT_> WNodeT;
+  typedef CSRGraph<NodeID_, NodeID_, MakeInverse> TopologyT;
+
+ public:
+  // Walks destinations and weights together, yielding NodeWeights
+  class NeighIterator {
+    const NodeID_* dest_;
+    const StoreT_* weight_;
+    WeightT_ scale_;
+   public:
+    NeighIterator(const NodeID_* dest, const StoreT_* weight, WeightT_ scale) :
+        dest_(dest), weight_(weight), scale_(scale) {}
+    WNodeT operator*() const {
+      return WNodeT(*dest_, static_cast<WeightT_>(*weight_) * scale_);
+    }
+    NeighIterator& operator++() {
+      dest_++;
+      weight_++;
+      return *this;
+    }
+    NeighIterator operator++(int) {
+      NeighIterator old = *this;
+      ++(*this);
+      return old;
+    }
+    bool operator==(const NeighIterator &other) const {
+      return dest_ == other.dest_;
+    }
+    bool operator!=(const NeighIterator &other) const {
+      return dest_ != other.dest_;
+    }
+  };
+
+ private:
+  // Used to access neighbors of vertex, basically sugar for iterators
+  class Neighborhood {
+    const NodeID_* begin_;
+    const NodeID_* end_;
+    const StoreT_* weights_;
+    WeightT_ scale_;
+   public:
+    Neighborhood(const NodeID_* begin, const NodeID_* end,
+                 const StoreT_* weights, WeightT_ scale) :
+        begin_(begin), end_(end), weights_(weights), scale_(scale) {}
+    typedef NeighIterator iterator;
+    iterator begin() { return iterator(begin_, weights_, scale_); }
+    iterator end() {
+      return iterator(end_, weights_ + (end_ - begin_), scale_);
+    }
+  };
+
+  void ReleaseResources() {
+    if (weights_mapped_)
+      return;
+    if (out_weights_ != nullptr)
+      FreeArray(out_weights_);
+    if (topology_.directed() && (in_weights_ != nullptr))
+      FreeArray(in_weights_);
+  }
+
+  static StoreT_ Quantize(WeightT_ w, WeightT_ scale) {
+    if (scale == 1)
+      return static_cast<StoreT_>(w);
+    WeightT_ q = (w + scale / 2) / scale;
+    if ((q == 0) && (w > 0))
+      q = 1;
+    return static_cast<StoreT_>(std::min(q, static_cast<WeightT_>(
+                                    std::numeric_limits<StoreT_>::max())));
+  }
+
+  // Copies neighborhoods of g apart (destinations into neighs, weights into
+  // weights), with the offsets for both
+  template <typename GraphT_>
+  static void Split(const GraphT_ &g, bool transpose, WeightT_ scale,
+                    SGOffset** offsets, NodeID_** neighs, StoreT_** weights) {
+    pvector<SGOffset> g_offsets = g.VertexOffsets(transpose);
+    *offsets = TopologyT::CopyOffsets(g_offsets);
+    *neighs = AllocArray<NodeID_>(g_offsets[g.num_nodes()]);
+    *weights = AllocArray<StoreT_>(g_offsets[g.num_nodes()]);
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (NodeID_ n=0; n < g.num_nodes(); n++) {
+      SGOffset i = g_offsets[n];
+      for (WNodeT wn : (transpose ? g.in_neigh(n) : g.out_neigh(n))) {
+        (*neighs)[i] = wn.v;
+        (*weights)[i] = Quantize(wn.w, scale);
+        i++;
+      }
+    }
+  }
+
+  // Scale that fits the largest weight into StoreT_ (exits on negatives for
+  // unsigned StoreT_)
+  template <typename GraphT_>
+  static WeightT_ FindScale(const GraphT_ &g) {
+    WeightT_ max_weight = 0;
+    WeightT_ min_weight = 0;
+    #pragma omp parallel for reduction(max : max_weight) \
+                             reduction(min : min_weight)
+    for (NodeID_ n=0; n < g.num_nodes(); n++) {
+      for (WNodeT wn : g.out_neigh(n)) {
+        max_weight = std::max(max_weight, wn.w);
+        min_weight = std::min(min_weight, wn.w);
+      }
+    }
+    if (std::is_unsigned<StoreT_>::value && (min_weight < 0)) {
+      std::cout << "Narrow weights (-W) need non-negative weights" << std::endl;
+      std::exit(-44);
+    }
+    const WeightT_ kMaxStored = std::numeric_limits<StoreT_>::max();
+    if ((sizeof(StoreT_) >= sizeof(WeightT_)) || (max_weight <= kMaxStored))
+      return 1;
+    return (max_weight + kMaxStored - 1) / kMaxStored;
+  }
+
+ public:
+  SplitWGraph() : out_weights_(nullptr), in_weights_(nullptr),
+                  weight_scale_(1), weights_mapped_(false) {}
+
+  explicit SplitWGraph(
+      const CSRGraph<NodeID_, WNodeT, MakeInverse> &g) : SplitWGraph() {
+    weight_scale_ = FindScale(g);
+    SGOffset *offsets, *inv_offsets;
+    NodeID_ *neighs, *inv_neighs;
+    Split(g, false, weight_scale_, &offsets, &neighs, &out_weights_);
+    if (g.directed()) {
+      if (MakeInverse) {
+        Split(g, true, weight_scale_, &inv_offsets, &inv_neighs,
+              &in_weights_);
+      } else {
+        inv_offsets = nullptr;
+        inv_neighs = nullptr;
+      }
+      topology_ = TopologyT(g.num_nodes(), offsets, neighs, inv_offsets,
+                            inv_neighs);
+    } else {
+      in_weights_ = out_weights_;
+      topology_ = TopologyT(g.num_nodes(), offsets, neighs);
+    }
+    if (g.relabeled()) {
+      NodeID_ *original_ids = AllocArray<NodeID_>(g.num_nodes());
+      #pragma omp parallel for
+      for (NodeID_ n=0; n < g.num_nodes(); n++)
+        original_ids[n] = g.original_id(n);
+      topology_.SetOriginalIDs(original_ids);
+    }
+  }
+
+  // Takes ownership of weights unless they point into topology's mapping
+  SplitWGraph(TopologyT &&topology, StoreT_* out_weights, StoreT_* in_weights,
+              WeightT_ weight_scale, bool weights_mapped) :
+    topology_(std::move(topology)), out_weights_(out_weights),
+    in_weights_(topology_.directed() ? in_weights : out_weights),
+    weight_scale_(weight_scale), weights_mapped_(weights_mapped) {}
+
+  SplitWGraph(SplitWGraph&& other) :
+    topology_(std::move(other.topology_)), out_weights_(other.out_weights_),
+    in_weights_(other.in_weights_), weight_scale_(other.weight_scale_),
+    weights_mapped_(other.weights_mapped_) {
+      other.out_weights_ = nullptr;
+      other.in_weights_ = nullptr;
+  }
+
+  ~SplitWGraph() {
+    ReleaseResources();
+  }
+
+  SplitWGraph& operator=(SplitWGraph&& other) {
+    if (this != &other) {
+      ReleaseResources();
+      topology_ = std::move(other.topology_);
+      out_weights_ = other.out_weights_;
+      in_weights_ = other.in_weights_;
+      weight_scale_ = other.weight_scale_;
+      weights_mapped_ = other.weights_mapped_;
+      other.out_weights_ = nullptr;
+      other.in_weights_ = nullptr;
+    }
+    return *this;
+  }
+
+  // Unweighted view of the same graph (owned by this graph)
+  const TopologyT& topology() const {
+    return topology_;
+  }
+
+  bool directed() const {
+    return topology_.directed();
+  }
+
+  int64_t num_nodes() const {
+    return topology_.num_nodes();
+  }
+
+  int64_t num_edges() const {
+    return topology_.num_edges();
+  }
+
+  int64_t num_edges_directed() const {
+    return topology_.num_edges_directed();
+  }
+
+  int64_t out_degree(NodeID_ v) const {
+    return topology_.out_degree(v);
+  }
+
+  int64_t in_degree(NodeID_ v) const {
+    return topology_.in_degree(v);
+  }
+
+  Neighborhood out_neigh(NodeID_ n, OffsetT start_offset = 0) const {
+    const NodeID_* g_start = topology_.out_neigh(0).begin();
+    auto neigh = topology_.out_neigh(n, start_offset);
+    return Neighborhood(neigh.begin(), neigh.end(),
+                        out_weights_ + (neigh.begin() - g_start),
+                        weight_scale_);
+  }
+
+  Neighborhood in_neigh(NodeID_ n, OffsetT start_offset = 0) const {
+    const NodeID_* g_start = topology_.in_neigh(0).begin();
+    auto neigh = topology_.in_neigh(n, start_offset);
+    return Neighborhood(neigh.begin(), neigh.end(),
+                        in_weights_ + (neigh.begin() - g_start),
+                        weight_scale_);
+  }
+
+  const StoreT_* weights(bool in_graph = false) const {
+    return in_graph ? in_weights_ : out_weights_;
+  }
+
+  WeightT_ weight_scale() const {
+    return weight_scale_;
+  }
+
+  bool relabeled() const {
+    return topology_.relabeled();
+  }
+
+  NodeID_ original_id(NodeID_ n) const {
+    return topology_.original_id(n);
+  }
+
+  NodeID_ relabeled_id(NodeID_ original) const {
+    return topology_.relabeled_id(original);
+  }
+
+  const VertexPartition<NodeID_>& VertexBlocks(bool in_graph = false) const {
+    return topology_.VertexBlocks(in_graph);
+  }
+
+  Range<NodeID_> vertices() const {
+    return topology_.vertices();
+  }
+
+  void PrintStats() const {
+    topology_.PrintStats();
+    std::cout << "Weights stored apart in " << 8 * sizeof(StoreT_) << " bits";
+    if (weight_scale_ != 1)
+      std::cout << " (quantized by " << weight_scale_ << ")";
+    std::cout << std::endl;
+  }
+
+ private:
+  TopologyT topology_;
+  StoreT_*  out_weights_;
+  StoreT_*  in_weights_;
+  WeightT_  weight_scale_;
+  bool      weights_mapped_;
+};
+
+#endif  // SPLIT_GRAPH_H_
@@ -1,6 +1,7 @@
 // Copyright (c) 2015, The Regents of the University of California (Regents)
 // See LICENSE.txt for license details
 
+#include <algorithm>
 #include <cinttypes>
 #include <limits>
 #include <iostream>
@@ -10,6 +11,7 @@
 #include "benchmark.h"
 #include "builder.h"
 #include "command_line.h"
+#include "frontier.h"
 #include "graph.h"
 #include "platform_atomics.h"
 #include "pvector.h"
@@ -25,12 +27,17 @@ Returns array of distances for all vertices from given source vertex
 
 This SSSP implementation makes use of the ∆-stepping algorithm [1]. The type
 used for weights and distances (WeightT) is typedefined in benchmark.h. The
-delta parameter (-d) should be set for each input graph. This implementation
+delta parameter (-d) can be set for each input graph, or by default it is
+estimated from the graph (EstimateDelta). This implementation
 incorporates a new bucket fusion optimization [2] that significantly reduces
 the number of iterations (& barriers) needed.
 
-The bins of width delta are actually all thread-local and of type std::vector,
-so they can grow but are otherwise capacity-proportional. Each iteration is
+The frontier's edges are spread across threads by EdgeBalancer (frontier.h), so
+a high-degree vertex in the shared bin is relaxed by many threads. The bins of
+width delta are actually all thread-local (LocalBins) and of type
+std::vector, so they can grow but are otherwise capacity-proportional. Once a
+bin has been emptied, its storage is pooled and reused by a later bin, so
+after the first few iterations bins rarely allocate. Each iteration is
 done in two phases separated by barriers. In the first phase, the current
 shared bin is processed by all threads. As they find vertices whose distance
 they are able to improve, they add them to their thread-local bins. During this
@@ -48,6 +55,16 @@ the same iteration if the vertices in the next thread-local bin have the
 same priority as those in the current shared bin. This optimization greatly
 reduces the number of iterations needed without violating the priority-based
 execution order, leading to significant speedup on large diameter road networks.
+The next thread-local bin is swapped with a reusable buffer to process it, so
+it isn't copied.
+
+With -W (or a .swsg input), the graph is a SplitWGraph, which keeps weights
+in an array apart from the destinations, optionally narrowed to 16 or 8 bits
+(quantized if needed). Relaxing an edge still reads both, but from two
+sequential streams of 4+2 or 4+1 bytes per edge instead of one of 8 bytes.
+
+To estimate delta, we use the heuristic of delta = C / d [3], where C is the
+maximum edge weight (from a sample of edges) and d is the average degree.
 
 [1] Ulrich Meyer and Peter Sanders. "δ-stepping: a parallelizable shortest path
     algorithm." Journal of Algorithms, 49(1):114–152, 2003.
@@ -56,6 +73,11 @@ execution order, leading to significant speedup on large diameter road networks.
     Shoaib Kamil, Saman Amarasinghe, and Julian Shun. "Optimizing ordered graph
     algorithms with GraphIt." The 18th International Symposium on Code Generation
     and Optimization (CGO), pages 158-170, 2020.
+
+[3] Kamesh Madduri, David A. Bader, Jonathan W. Berry, and Joseph R. Crobak.
+    "An Experimental Study of A Parallel Shortest Path Algorithm for Solving
+    Large-Scale Graph Instances." Workshop on Algorithm Engineering and
+    Experiments (ALENEX), 2007.
 */
 
 
@@ -65,31 +87,99 @@ const WeightT kDistInf = numeric_limits<WeightT>::max()/2;
 const size_t kMaxBin = numeric_limits<size_t>::max()/2;
 const size_t kBinSizeThreshold = 1000;
 
+
+// Thread-local bins, emptied bins return their storage to a pool to be reused
+class LocalBins {
+ public:
+  void Push(size_t bin, NodeID u) {
+    if (bin >= bins_.size())
+      bins_.resize(bin+1);
+    if ((bins_[bin].capacity() == 0) && !pool_.empty()) {
+      bins_[bin].swap(pool_.back());
+      pool_.pop_back();
+    }
+    bins_[bin].push_back(u);
+  }
+
+  bool empty(size_t bin) const {
+    return (bin >= bins_.size()) || bins_[bin].empty();
+  }
+
+  size_t size(size_t bin) const {
+    return bin < bins_.size() ? bins_[bin].size() : 0;
+  }
+
+  size_t num_bins() const { return bins_.size(); }
+
+  const vector<NodeID>& operator[](size_t bin) const { return bins_[bin]; }
+
+  // Moves contents of bin into buffer (without copying), and the bin takes
+  // buffer's old storage
+  void SwapOut(size_t bin, vector<NodeID> &buffer) {
+    buffer.clear();
+    buffer.swap(bins_[bin]);
+  }
+
+  // Empties bin and pools its storage (if it has any)
+  void Release(size_t bin) {
+    bins_[bin].clear();
+    if (bins_[bin].capacity() == 0)
+      return;
+    pool_.emplace_back();
+    pool_.back().swap(bins_[bin]);
+  }
+
+ private:
+  vector<vector<NodeID>> bins_;
+  vector<vector<NodeID>> pool_;
+};
+
+
 inline
-void RelaxEdges(const WGraph &g, NodeID u, WeightT delta,
-                pvector<WeightT> &dist, vector <vector<NodeID>> &local_bins) {
-  for (WNode wn : g.out_neigh(u)) {
-    WeightT old_dist = dist[wn.v];
-    WeightT new_dist = dist[u] + wn.w;
-    while (new_dist < old_dist) {
-      if (compare_and_swap(dist[wn.v], old_dist, new_dist)) {
-        size_t dest_bin = new_dist/delta;
-        if (dest_bin >= local_bins.size())
-          local_bins.resize(dest_bin+1);
-        local_bins[dest_bin].push_back(wn.v);
-        break;
-      }
-      old_dist = dist[wn.v];      // swap failed, recheck dist update & retry
+void RelaxEdge(NodeID u, const WNode &wn, WeightT delta,
+               pvector<WeightT> &dist, LocalBins &local_bins) {
+  WeightT old_dist = dist[wn.v];
+  WeightT new_dist = dist[u] + wn.w;
+  while (new_dist < old_dist) {
+    if (compare_and_swap(dist[wn.v], old_dist, new_dist)) {
+      local_bins.Push(new_dist/delta, wn.v);
+      break;
     }
+    old_dist = dist[wn.v];      // swap failed, recheck dist update & retry
   }
 }
 
-pvector<WeightT> DeltaStep(const WGraph &g, NodeID source, WeightT delta,
-                           bool logging_enabled = false) {
+// For a SplitWGraph (-W), destinations & weights are read from separate arrays
+template <typename WGraphT_>
+inline
+void RelaxEdges(const WGraphT_ &g, NodeID u, WeightT delta,
+                pvector<WeightT> &dist, LocalBins &local_bins) {
+  for (WNode wn : g.out_neigh(u))
+    RelaxEdge(u, wn, delta, dist, local_bins);
+}
+
+// Storage for DeltaStep, allocated once per graph and reused by every search
+struct SSSPScratch {
+  pvector<WeightT> dist;
+  pvector<NodeID> frontier;
+  EdgeBalancer<NodeID> balancer;
+
+  template <typename WGraphT_>
+  explicit SSSPScratch(const WGraphT_ &g)
+      : dist(g.num_nodes()), frontier(g.num_edges_directed()) {}
+};
+
+
+// Returned dist array is owned by scratch (valid until its next search)
+template <typename WGraphT_>
+const pvector<WeightT>& DeltaStep(const WGraphT_ &g, NodeID source,
+                                  WeightT delta, SSSPScratch &scratch,
+                                  bool logging_enabled = false) {
   Timer t;
-  pvector<WeightT> dist(g.num_nodes(), kDistInf);
+  pvector<WeightT> &dist = scratch.dist;
+  dist.fill(kDistInf);
   dist[source] = 0;
-  pvector<NodeID> frontier(g.num_edges_directed());
+  pvector<NodeID> &frontier = scratch.frontier;
   // two element arrays for double buffering curr=iter&1, next=(iter+1)&1
   size_t shared_indexes[2] = {0, kMaxBin};
   size_t frontier_tails[2] = {1, 0};
@@ -97,29 +187,29 @@ pvector<WeightT> DeltaStep(const WGraph &g, NodeID source, WeightT delta,
   t.Start();
   #pragma omp parallel
   {
-    vector<vector<NodeID> > local_bins(0);
+    LocalBins local_bins;
+    vector<NodeID> fused_bin;
     size_t iter = 0;
     while (shared_indexes[iter&1] != kMaxBin) {
       size_t &curr_bin_index = shared_indexes[iter&1];
       size_t &next_bin_index = shared_indexes[(iter+1)&1];
       size_t &curr_frontier_tail = frontier_tails[iter&1];
       size_t &next_frontier_tail = frontier_tails[(iter+1)&1];
-      #pragma omp for nowait schedule(dynamic, 64)
-      for (size_t i=0; i < curr_frontier_tail; i++) {
-        NodeID u = frontier[i];
-        if (dist[u] >= delta * static_cast<WeightT>(curr_bin_index))
-          RelaxEdges(g, u, delta, dist, local_bins);
-      }
-      while (curr_bin_index < local_bins.size() &&
-             !local_bins[curr_bin_index].empty() &&
-             local_bins[curr_bin_index].size() < kBinSizeThreshold) {
-        vector<NodeID> curr_bin_copy = local_bins[curr_bin_index];
-        local_bins[curr_bin_index].resize(0);
-        for (NodeID u : curr_bin_copy)
+      WeightT curr_min_dist = delta * static_cast<WeightT>(curr_bin_index);
+      scratch.balancer.ForEachEdge(g, frontier.data(),
+                                   frontier.data() + curr_frontier_tail,
+                                   [&](NodeID u, const WNode &wn) {
+        if (dist[u] >= curr_min_dist)
+          RelaxEdge(u, wn, delta, dist, local_bins);
+      });
+      while (!local_bins.empty(curr_bin_index) &&
+             local_bins.size(curr_bin_index) < kBinSizeThreshold) {
+        local_bins.SwapOut(curr_bin_index, fused_bin);
+        for (NodeID u : fused_bin)
           RelaxEdges(g, u, delta, dist, local_bins);
       }
-      for (size_t i=curr_bin_index; i < local_bins.size(); i++) {
-        if (!local_bins[i].empty()) {
+      for (size_t i=curr_bin_index; i < local_bins.num_bins(); i++) {
+        if (!local_bins.empty(i)) {
           #pragma omp critical
           next_bin_index = min(next_bin_index, i);
           break;
@@ -135,12 +225,12 @@ pvector<WeightT> DeltaStep(const WGraph &g, NodeID source, WeightT delta,
         curr_bin_index = kMaxBin;
         curr_frontier_tail = 0;
       }
-      if (next_bin_index < local_bins.size()) {
+      if (next_bin_index < local_bins.num_bins()) {
         size_t copy_start = fetch_and_add(next_frontier_tail,
-                                          local_bins[next_bin_index].size());
+                                          local_bins.size(next_bin_index));
         copy(local_bins[next_bin_index].begin(),
              local_bins[next_bin_index].end(), frontier.data() + copy_start);
-        local_bins[next_bin_index].resize(0);
+        local_bins.Release(next_bin_index);
       }
       iter++;
       #pragma omp barrier
@@ -153,7 +243,28 @@ pvector<WeightT> DeltaStep(const WGraph &g, NodeID source, WeightT delta,
 }
 
 
-void PrintSSSPStats(const WGraph &g, const pvector<WeightT> &dist) {
+// Estimates delta as max weight / average degree [3], with max weight from
+// edges of sampled vertices
+template <typename WGraphT_>
+WeightT EstimateDelta(const WGraphT_ &g) {
+  const int64_t kNumSamples = 1000;
+  SourcePicker<WGraphT_> sp(g);
+  WeightT max_weight = 0;
+  for (int64_t trial=0; trial < min(kNumSamples, g.num_nodes()); trial++) {
+    for (WNode wn : g.out_neigh(sp.PickNext()))
+      max_weight = max(max_weight, wn.w);
+  }
+  double average_degree = static_cast<double>(g.num_edges_directed()) /
+                          g.num_nodes();
+  WeightT delta = static_cast<WeightT>(max_weight / average_degree);
+  if (numeric_limits<WeightT>::is_integer)
+    delta = max(delta, static_cast<WeightT>(1));
+  return delta;
+}
+
+
+template <typename WGraphT_>
+void PrintSSSPStats(const WGraphT_ &g, const pvector<WeightT> &dist) {
   auto NotInf = [](WeightT d) { return d != kDistInf; };
   int64_t num_reached = count_if(dist.begin(), dist.end(), NotInf);
   cout << "SSSP Tree reaches " << num_reached << " nodes" << endl;
@@ -161,7 +272,8 @@ void PrintSSSPStats(const WGraph &g, const pvector<WeightT> &dist) {
 
 
 // Compares against simple serial implementation
-bool SSSPVerifier(const WGraph &g, NodeID source,
+template <typename WGraphT_>
+bool SSSPVerifier(const WGraphT_ &g, NodeID source,
                   const pvector<WeightT> &dist_to_test) {
   // Serial Dijkstra implementation to get oracle distances
   pvector<WeightT> oracle_dist(g.num_nodes(), kDistInf);
@@ -194,20 +306,64 @@ bool SSSPVerifier(const WGraph &g, NodeID source,
 }
 
 
+template <typename WGraphT_>
+void BenchmarkSSSP(const CLDelta<WeightT> &cli, const WGraphT_ &g,
+                   SSSPScratch &scratch) {
+  WeightT delta = cli.delta();
+  if (cli.auto_delta()) {
+    delta = EstimateDelta(g);
+    cout << "Estimated delta: " << delta << endl;
+  }
+  SourcePicker<WGraphT_> sp(g, cli.start_vertex());
+  auto SSSPBound = [&sp, &cli, &scratch, delta] (const WGraphT_ &g)
+      -> const pvector<WeightT>& {
+    return DeltaStep(g, sp.PickNext(), delta, scratch, cli.logging_en());
+  };
+  SourcePicker<WGraphT_> vsp(g, cli.start_vertex());
+  auto VerifierBound = [&vsp] (const WGraphT_ &g,
+                               const pvector<WeightT> &dist) {
+    return SSSPVerifier(g, vsp.PickNext(), dist);
+  };
+  auto ResetSources = [&sp, &vsp] { sp.Reset(); vsp.Reset(); };
+  BenchmarkKernel(cli, g, SSSPBound, PrintSSSPStats<WGraphT_>, VerifierBound,
+                  ResetSources);
+}
+
+
+template <typename WGraphT_>
+void BenchmarkSSSP(const CLDelta<WeightT> &cli, const WGraphT_ &g) {
+  SSSPScratch scratch(g);
+  BenchmarkSSSP(cli, g, scratch);
+}
+
+
+#ifndef NO_MAIN
 int main(int argc, char* argv[]) {
   CLDelta<WeightT> cli(argc, argv, "single-source shortest-path");
   if (!cli.ParseArgs())
     return -1;
   WeightedBuilder b(cli);
-  WGraph g = b.MakeGraph();
-  SourcePicker<WGraph> sp(g, cli.start_vertex());
-  auto SSSPBound = [&sp, &cli] (const WGraph &g) {
-    return DeltaStep(g, sp.PickNext(), cli.delta(), cli.logging_en());
-  };
-  SourcePicker<WGraph> vsp(g, cli.start_vertex());
-  auto VerifierBound = [&vsp] (const WGraph &g, const pvector<WeightT> &dist) {
-    return SSSPVerifier(g, vsp.PickNext(), dist);
-  };
-  BenchmarkKernel(cli, g, SSSPBound, PrintSSSPStats, VerifierBound);
+  switch (b.split_weight_bits()) {
+    case 8: {
+      SWGraph<uint8_t> g = b.MakeSplitGraph<uint8_t>();
+      BenchmarkSSSP(cli, g);
+      break;
+    }
+    case 16: {
+      SWGraph<uint16_t> g = b.MakeSplitGraph<uint16_t>();
+      BenchmarkSSSP(cli, g);
+      break;
+    }
+    case 32: {
+      SWGraph<WeightT> g = b.MakeSplitGraph<WeightT>();
+      BenchmarkSSSP(cli, g);
+      break;
+    }
+    default: {
+      WGraph g = b.MakeGraph();
+      BenchmarkSSSP(cli, g);
+    }
+  }
   return 0;
 }
+#endif
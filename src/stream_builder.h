@@ -0,0 +1,320 @@
+// Copyright (c) 2015, The Regents of the University of California (Regents)
+// See LICENSE.txt for license details
+
+#ifndef STREAM_BUILDER_H_
+#define STREAM_BUILDER_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "builder.h"
+#include "command_line.h"
+#include "generator.h"
+#include "graph.h"
+#include "platform_atomics.h"
+#include "pvector.h"
+#include "reader.h"
+#include "sg_format.h"
+#include "timer.h"
+#include "util.h"
+
+
+/*
+GAP Benchmark Suite
+Class:  StreamBuilderBase
+Author: Scott Beamer
+
+Builds a serialized graph (.sg or .wsg) from a text edge list out-of-core
+ - Unlike BuilderBase, the edgelist is never held in memory, only per-vertex
+   arrays are, so graphs larger than memory can be converted
+ - Input is streamed (Reader::StreamFile or Generator::StreamEL) twice:
+     1) count degrees (CountDegrees)
+     2) scatter edges into the neighbor arrays of the memory-mapped output
+        file, which is already laid out as in sg_format.h (ScatterEdges)
+ - Each neighborhood is then sorted in place in the file, with duplicates and
+   self-loops removed like SquishCSR (SortNeighborhoods), and the file is
+   compacted to its final size (Compact)
+ - Resulting file is identical to what converter would write in memory, and
+   the returned graph is mapped from it
+*/
+
+
+template <typename NodeID_, typename DestID_ = NodeID_,
+          typename WeightT_ = NodeID_>
+class StreamBuilderBase {
+  typedef EdgePair<NodeID_, DestID_> Edge;
+  typedef pvector<Edge> EdgeList;
+  typedef Reader<NodeID_, DestID_, WeightT_> ReaderT;
+  typedef Generator<NodeID_, DestID_, WeightT_> GeneratorT;
+
+  const CLBase &cli_;
+  bool symmetrize_;
+  int64_t max_nodes_;
+  int64_t num_nodes_ = 0;
+
+  // Zero-filled array for counting, only pages touched use physical memory,
+  // so it can be sized for the largest possible vertex ID
+  SGOffset* ReserveCounts() {
+    void *counts = mmap(nullptr, max_nodes_ * sizeof(SGOffset),
+                        PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (counts == MAP_FAILED) {
+      std::cout << "Couldn't reserve memory for degrees" << std::endl;
+      std::exit(-34);
+    }
+    return static_cast<SGOffset*>(counts);
+  }
+
+  static int64_t weight_bytes() {
+    return std::is_same<NodeID_, DestID_>::value ? 0 : sizeof(WeightT_);
+  }
+
+  void ReleaseCounts(SGOffset *counts) {
+    if (counts != nullptr)
+      munmap(counts, max_nodes_ * sizeof(SGOffset));
+  }
+
+  // Calls callback(chunk, el) on every chunk of edges from the input
+  template <typename CallbackT_>
+  void Stream(ReaderT &r, CallbackT_ callback) {
+    r.StreamFile(callback);
+  }
+
+  template <typename CallbackT_>
+  void Stream(GeneratorT &gen, CallbackT_ callback) {
+    gen.StreamEL(cli_.uniform(), callback);
+  }
+
+  template <typename SourceT_>
+  void CountDegrees(SourceT_ &src, SGOffset *degrees, SGOffset *in_degrees) {
+    NodeID_ max_seen = 0;
+    Stream(src, [&] (int64_t c, EdgeList &el) {
+      NodeID_ chunk_max = 0;
+      for (Edge e : el) {
+        NodeID_ v = static_cast<NodeID_>(e.v);
+        if ((e.u < 0) || (v < 0) || (e.u >= max_nodes_) ||
+            (v >= max_nodes_)) {
+          std::cout << "Vertex ID out of range: " << e.u << " " << v
+                    << std::endl;
+          std::exit(-35);
+        }
+        chunk_max = std::max(chunk_max, std::max(e.u, v));
+        fetch_and_add(degrees[e.u], 1);
+        if (symmetrize_)
+          fetch_and_add(degrees[v], 1);
+        else
+          fetch_and_add(in_degrees[v], 1);
+      }
+      #pragma omp critical
+      max_seen = std::max(max_seen, chunk_max);
+    });
+    num_nodes_ = static_cast<int64_t>(max_seen) + 1;
+  }
+
+  // Writes offsets into file, and leaves degrees holding a copy (cursors)
+  static int64_t PrefixSum(SGOffset *degrees, int64_t num_nodes,
+                           SGOffset *offsets) {
+    SGOffset total = 0;
+    for (int64_t n=0; n < num_nodes; n++) {
+      offsets[n] = total;
+      total += degrees[n];
+      degrees[n] = offsets[n];
+    }
+    offsets[num_nodes] = total;
+    return total;
+  }
+
+  template <typename SourceT_>
+  void ScatterEdges(SourceT_ &src, SGOffset *cursors, DestID_ *neighs,
+                    SGOffset *in_cursors, DestID_ *in_neighs) {
+    Stream(src, [&] (int64_t c, EdgeList &el) {
+      for (Edge e : el) {
+        NodeID_ v = static_cast<NodeID_>(e.v);
+        neighs[fetch_and_add(cursors[e.u], 1)] = e.v;
+        DestID_ source =
+            BuilderBase<NodeID_, DestID_, WeightT_>::GetSource(e);
+        if (symmetrize_)
+          neighs[fetch_and_add(cursors[v], 1)] = source;
+        else
+          in_neighs[fetch_and_add(in_cursors[v], 1)] = source;
+      }
+    });
+  }
+
+  // Sorts neighborhoods in place & removes duplicates/self-loops (SquishCSR)
+  void SortNeighborhoods(const SGOffset *offsets, DestID_ *neighs,
+                         SGOffset *degrees) {
+    BuilderBase<NodeID_, DestID_, WeightT_>::SquishNeighborhoods(num_nodes_,
+        [&](NodeID_ n) {
+          return std::make_pair(neighs + offsets[n], neighs + offsets[n+1]);
+        }, degrees);
+  }
+
+  // Moves squished neighborhoods down to their final positions, always to
+  // a lower address, so processing vertices in order never clobbers input
+  void Compact(const pvector<SGOffset> &old_offsets, const DestID_ *old_neighs,
+               const SGOffset *degrees, SGOffset *new_offsets,
+               DestID_ *new_neighs) {
+    pvector<SGOffset> offsets(num_nodes_ + 1);
+    SGOffset total = 0;
+    for (int64_t n=0; n < num_nodes_; n++) {
+      offsets[n] = total;
+      std::memmove(new_neighs + total, old_neighs + old_offsets[n],
+                   degrees[n] * sizeof(DestID_));
+      total += degrees[n];
+    }
+    offsets[num_nodes_] = total;
+    std::copy(offsets.begin(), offsets.end(), new_offsets);
+  }
+
+  static int OpenOutput(std::string filename) {
+    int fd = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+      std::cout << "Couldn't write to file " << filename << std::endl;
+      std::exit(-5);
+    }
+    return fd;
+  }
+
+ public:
+  explicit StreamBuilderBase(const CLBase &cli) : cli_(cli) {
+    symmetrize_ = cli_.symmetrize();
+    max_nodes_ = std::min(static_cast<int64_t>(
+                              std::numeric_limits<NodeID_>::max()),
+                          static_cast<int64_t>(1) << 40);
+  }
+
+  // Writes serialized graph to out_filename and returns it memory-mapped
+  CSRGraph<NodeID_, DestID_> MakeGraph(std::string out_filename) {
+    if (cli_.filename() == "") {
+      if (cli_.scale() == -1) {
+        std::cout << "Out-of-core building needs an input file (-f) or "
+                  << "synthetic graph (-g or -u)" << std::endl;
+        std::exit(-33);
+      }
+      GeneratorT gen(cli_.scale(), cli_.degree(), cli_.fast_generator());
+      return MakeGraphFrom(gen, out_filename);
+    }
+    ReaderT r(cli_.filename());
+    if (!std::is_same<NodeID_, DestID_>::value && !r.TextHasWeights()) {
+      std::cout << "Out-of-core building of weighted graph needs weighted "
+                << "input" << std::endl;
+      std::exit(-33);
+    }
+    return MakeGraphFrom(r, out_filename);
+  }
+
+ private:
+  template <typename SourceT_>
+  CSRGraph<NodeID_, DestID_> MakeGraphFrom(SourceT_ &src,
+                                           std::string out_filename) {
+    bool directed = !symmetrize_;
+    Timer t;
+    t.Start();
+    SGOffset *degrees = ReserveCounts();
+    SGOffset *in_degrees = directed ? ReserveCounts() : nullptr;
+    CountDegrees(src, degrees, in_degrees);
+    t.Stop();
+    PrintTime("Count Time", t.Seconds());
+
+    // Lay out file for all edges read, before any are removed
+    t.Start();
+    SGOffset num_edges = 0;
+    for (int64_t n=0; n < num_nodes_; n++)
+      num_edges += degrees[n];
+    SGHeader header(directed, num_nodes_, num_edges, sizeof(DestID_),
+                    sizeof(NodeID_), weight_bytes());
+    SGLayout layout(header);
+    int fd = OpenOutput(out_filename);
+    if (ftruncate(fd, layout.file_size) == -1) {
+      std::cout << "Couldn't resize file " << out_filename << std::endl;
+      std::exit(-5);
+    }
+    void *mapping = mmap(nullptr, layout.file_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+      std::cout << "Couldn't mmap file " << out_filename << std::endl;
+      std::exit(-7);
+    }
+    char *base = static_cast<char*>(mapping);
+    SGOffset *offsets = reinterpret_cast<SGOffset*>(base + layout.out_offsets);
+    DestID_ *neighs = reinterpret_cast<DestID_*>(base + layout.out_neighs);
+    SGOffset *in_offsets = nullptr;
+    DestID_ *in_neighs = nullptr;
+    PrefixSum(degrees, num_nodes_, offsets);
+    if (directed) {
+      in_offsets = reinterpret_cast<SGOffset*>(base + layout.in_offsets);
+      in_neighs = reinterpret_cast<DestID_*>(base + layout.in_neighs);
+      PrefixSum(in_degrees, num_nodes_, in_offsets);
+    }
+    ScatterEdges(src, degrees, neighs, in_degrees, in_neighs);
+    t.Stop();
+    PrintTime("Scatter Time", t.Seconds());
+
+    // Squish neighborhoods & compact file now that final edge count is known
+    t.Start();
+    pvector<SGOffset> old_offsets(offsets, offsets + num_nodes_ + 1);
+    SortNeighborhoods(offsets, neighs, degrees);
+    SGOffset squished_edges = 0;
+    for (int64_t n=0; n < num_nodes_; n++)
+      squished_edges += degrees[n];
+    SGHeader final_header(directed, num_nodes_, squished_edges,
+                          sizeof(DestID_), sizeof(NodeID_), weight_bytes());
+    SGLayout final_layout(final_header);
+    DestID_ *final_neighs =
+        reinterpret_cast<DestID_*>(base + final_layout.out_neighs);
+    Compact(old_offsets, neighs, degrees, offsets, final_neighs);
+    neighs = final_neighs;
+    if (directed) {
+      std::copy(in_offsets, in_offsets + num_nodes_ + 1, old_offsets.begin());
+      SortNeighborhoods(in_offsets, in_neighs, in_degrees);
+      in_offsets = reinterpret_cast<SGOffset*>(base + final_layout.in_offsets);
+      DestID_ *final_in_neighs =
+          reinterpret_cast<DestID_*>(base + final_layout.in_neighs);
+      Compact(old_offsets, in_neighs, in_degrees, in_offsets,
+              final_in_neighs);
+      in_neighs = final_in_neighs;
+    }
+    ReleaseCounts(degrees);
+    ReleaseCounts(in_degrees);
+    // Zero leftovers from before compaction that are now padding
+    int64_t out_end = final_layout.out_neighs + final_layout.out_neighs_bytes;
+    if (directed) {
+      std::memset(base + out_end, 0, final_layout.in_offsets - out_end);
+      int64_t in_offsets_end = final_layout.in_offsets +
+                               final_layout.offsets_bytes;
+      std::memset(base + in_offsets_end, 0,
+                  final_layout.in_neighs - in_offsets_end);
+    }
+    std::memcpy(base, &final_header, sizeof(SGHeader));
+    if ((msync(mapping, layout.file_size, MS_SYNC) == -1) ||
+        (ftruncate(fd, final_layout.file_size) == -1)) {
+      std::cout << "Couldn't write to file " << out_filename << std::endl;
+      std::exit(-5);
+    }
+    close(fd);
+    t.Stop();
+    PrintTime("Squish Time", t.Seconds());
+
+    CSRGraph<NodeID_, DestID_> g;
+    if (directed)
+      g = CSRGraph<NodeID_, DestID_>(num_nodes_, offsets, neighs, in_offsets,
+                                     in_neighs);
+    else
+      g = CSRGraph<NodeID_, DestID_>(num_nodes_, offsets, neighs);
+    g.AdoptMapping(mapping, layout.file_size);
+    return g;
+  }
+};
+
+#endif  // STREAM_BUILDER_H_
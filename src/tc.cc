@@ -15,6 +15,7 @@
 #include "builder.h"
 #include "command_line.h"
 #include "graph.h"
+#include "intersect.h"
 #include "pvector.h"
 
 
@@ -40,6 +41,12 @@ a triangle only once, this implementation only counts a triangle if u > v > w.
 Once the remaining unexamined neighbors identifiers get too big, it can break
 out of the loop, but this requires that the neighbors are sorted.
 
+For each edge (u, v), the candidate w's are the neighbors of u before v, and
+they are matched against the neighbors of v with a sorted set intersection
+(Intersector) that stops once the candidates run out. By default it uses
+vector instructions if the CPU supports them, or galloping for very skewed
+degrees, and it can be set with -x (merge is the original scalar loop).
+
 This implementation relabels the vertices by degree. This optimization is
 beneficial if the average degree is sufficiently high and if the degree
 distribution is sufficiently non-uniform. To decide whether to relabel the
@@ -49,22 +56,18 @@ graph, we use the heuristic in WorthRelabelling.
 
 using namespace std;
 
-size_t OrderedCount(const Graph &g) {
+size_t OrderedCount(const Graph &g, const Intersector &isect) {
   size_t total = 0;
   #pragma omp parallel for reduction(+ : total) schedule(dynamic, 64)
   for (NodeID u=0; u < g.num_nodes(); u++) {
-    for (NodeID v : g.out_neigh(u)) {
+    const NodeID *u_start = g.out_neigh(u).begin();
+    const NodeID *u_end = g.out_neigh(u).end();
+    for (const NodeID *v_it = u_start; v_it < u_end; v_it++) {
+      NodeID v = *v_it;
       if (v > u)
         break;
-      auto it = g.out_neigh(v).begin();
-      for (NodeID w : g.out_neigh(u)) {
-        if (w > v)
-          break;
-        while (*it < w)
-          it++;
-        if (w == *it)
-          total++;
-      }
+      total += isect.Count(u_start, v_it, g.out_neigh(v).begin(),
+                           g.out_neigh(v).end());
     }
   }
   return total;
@@ -92,11 +95,11 @@ bool WorthRelabelling(const Graph &g) {
 
 
 // Uses heuristic to see if worth relabeling
-size_t Hybrid(const Graph &g) {
+size_t Hybrid(const Graph &g, const Intersector &isect) {
   if (WorthRelabelling(g))
-    return OrderedCount(Builder::RelabelByDegree(g));
+    return OrderedCount(Builder::RelabelByDegree(g), isect);
   else
-    return OrderedCount(g);
+    return OrderedCount(g, isect);
 }
 
 
@@ -128,16 +131,29 @@ bool TCVerifier(const Graph &g, size_t test_total) {
 }
 
 
+// Returns false (without running) if graph is directed
+bool BenchmarkTC(const CLIntersect &cli, const Graph &g) {
+  if (g.directed()) {
+    cout << "Input graph is directed but tc requires undirected" << endl;
+    return false;
+  }
+  Intersector isect(cli.intersect_method());
+  cout << "Intersection: " << isect.method() << endl;
+  auto HybridBound = [&isect] (const Graph &g) { return Hybrid(g, isect); };
+  BenchmarkKernel(cli, g, HybridBound, PrintTriangleStats, TCVerifier);
+  return true;
+}
+
+
+#ifndef NO_MAIN
 int main(int argc, char* argv[]) {
-  CLApp cli(argc, argv, "triangle count");
+  CLIntersect cli(argc, argv, "triangle count");
   if (!cli.ParseArgs())
     return -1;
   Builder b(cli);
   Graph g = b.MakeGraph();
-  if (g.directed()) {
-    cout << "Input graph is directed but tc requires undirected" << endl;
+  if (!BenchmarkTC(cli, g))
     return -2;
-  }
-  BenchmarkKernel(cli, g, Hybrid, PrintTriangleStats, TCVerifier);
   return 0;
 }
+#endif
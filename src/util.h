@@ -8,6 +8,7 @@
 #include <cinttypes>
 #include <string>
 
+#include "report.h"
 #include "timer.h"
 
 
@@ -16,29 +17,57 @@ GAP Benchmark Suite
 Author: Scott Beamer
 
 Miscellaneous helpers that don't fit into classes
+ - Print* helpers also record what they print if a Report is open (-j)
 */
 
 
 static const int64_t kRandSeed = 27491095;
 
 
+// Index of lowest set bit (mask must be nonzero)
+inline int LowestBit(uint64_t mask) {
+#if defined __GNUC__
+  return __builtin_ctzll(mask);
+#else
+  int i = 0;
+  while ((mask & 1) == 0) {
+    mask >>= 1;
+    i++;
+  }
+  return i;
+#endif
+}
+
+
 void PrintLabel(const std::string &label, const std::string &val) {
   printf("%-21s%7s\n", (label + ":").c_str(), val.c_str());
+  Report::Get().Write("label", {Report::String("name", label),
+                                Report::String("value", val)});
 }
 
 void PrintTime(const std::string &s, double seconds) {
   printf("%-21s%3.5lf\n", (s + ":").c_str(), seconds);
+  Report::Get().Write("time", {Report::String("name", s),
+                               Report::Number("value", seconds)});
 }
 
 void PrintStep(const std::string &s, int64_t count) {
   printf("%-14s%14" PRId64 "\n", (s + ":").c_str(), count);
+  Report::Get().Write("step", {Report::String("name", s),
+                               Report::Number("count", count)});
 }
 
+// Value is usually seconds, but some kernels (pr) log their error instead
 void PrintStep(const std::string &s, double seconds, int64_t count = -1) {
   if (count != -1)
     printf("%5s%11" PRId64 "  %10.5lf\n", s.c_str(), count, seconds);
   else
     printf("%5s%23.5lf\n", s.c_str(), seconds);
+  Report::Fields fields = {Report::String("name", s),
+                           Report::Number("value", seconds)};
+  if (count != -1)
+    fields.push_back(Report::Number("count", count));
+  Report::Get().Write("step", fields);
 }
 
 void PrintStep(int step, double seconds, int64_t count = -1) {
@@ -4,13 +4,23 @@
 #ifndef WRITER_H_
 #define WRITER_H_
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
+#include "compressed_graph.h"
 #include "graph.h"
+#include "parallel_io.h"
+#include "pvector.h"
+#include "sg_format.h"
+#include "split_graph.h"
 
 
 /*
@@ -21,13 +31,20 @@ Author: Scott Beamer
 Given filename and graph, writes out the graph to storage
  - Should use WriteGraph(filename, serialized)
  - If serialized, will write out as serialized graph, otherwise, as edgelist
+ - Serialized arrays are written by all threads at once, each array at its
+   position in the layout (ParallelWrite in parallel_io.h), so the padding
+   between arrays is left as zero-filled holes (and any padding within
+   weighted neighbors is zeroed too)
+ - Unweighted graphs can also be written compressed (WriteCompressedGraph)
+ - SplitWriter writes a SplitWGraph as .swsg (its topology as in .sg, then
+   its weights)
 */
 
 
 template <typename NodeID_, typename DestID_ = NodeID_>
 class WriterBase {
  public:
-  explicit WriterBase(CSRGraph<NodeID_, DestID_> &g) : g_(g) {}
+  explicit WriterBase(const CSRGraph<NodeID_, DestID_> &g) : g_(g) {}
 
   void WriteEL(std::fstream &out) {
     for (NodeID_ u=0; u < g_.num_nodes(); u++) {
@@ -36,39 +53,42 @@ class WriterBase {
     }
   }
 
-  void WriteSerializedGraph(std::fstream &out) {
-    if (!std::is_same<NodeID_, SGID>::value) {
-      std::cout << "serialized graphs only allowed for 32b IDs" << std::endl;
-      std::exit(-4);
-    }
-    if (!std::is_same<DestID_, NodeID_>::value &&
-        !std::is_same<DestID_, NodeWeight<NodeID_, SGID>>::value) {
+  void WriteSerializedGraph(int fd) {
+    bool weighted = !std::is_same<DestID_, NodeID_>::value;
+    if (weighted && !std::is_same<DestID_, NodeWeight<NodeID_, SGID>>::value) {
       std::cout << ".wsg only allowed for int32_t weights" << std::endl;
       std::exit(-8);
     }
-    bool directed = g_.directed();
-    SGOffset num_nodes = g_.num_nodes();
-    SGOffset edges_to_write = g_.num_edges_directed();
-    std::streamsize index_bytes = (num_nodes+1) * sizeof(SGOffset);
-    std::streamsize neigh_bytes;
-    if (std::is_same<DestID_, NodeID_>::value)
-      neigh_bytes = edges_to_write * sizeof(SGID);
-    else
-      neigh_bytes = edges_to_write * sizeof(NodeWeight<NodeID_, SGID>);
-    out.write(reinterpret_cast<char*>(&directed), sizeof(bool));
-    out.write(reinterpret_cast<char*>(&edges_to_write), sizeof(SGOffset));
-    out.write(reinterpret_cast<char*>(&num_nodes), sizeof(SGOffset));
-    pvector<SGOffset> offsets = g_.VertexOffsets(false);
-    out.write(reinterpret_cast<char*>(offsets.data()), index_bytes);
-    out.write(reinterpret_cast<char*>(g_.out_neigh(0).begin()), neigh_bytes);
-    if (directed) {
-      offsets = g_.VertexOffsets(true);
-      out.write(reinterpret_cast<char*>(offsets.data()), index_bytes);
-      out.write(reinterpret_cast<char*>(g_.in_neigh(0).begin()), neigh_bytes);
+    SGHeader header(g_.directed(), g_.num_nodes(), g_.num_edges_directed(),
+                    sizeof(DestID_), sizeof(NodeID_),
+                    weighted ? sizeof(SGID) : 0);
+    WriteSGArrays(fd, header);
+  }
+
+  // Only for unweighted graphs (DestID_ == NodeID_)
+  void WriteCompressedGraph(int fd) {
+    CompressedGraph<NodeID_> cg(g_);
+    cg.PrintStats();
+    SGHeader header(cg.directed(), cg.num_nodes(), cg.num_edges_directed(), 0,
+                    sizeof(NodeID_), 0, kCSGMagic);
+    header.out_neighs_bytes = cg.num_bytes(false);
+    header.in_neighs_bytes = cg.directed() ? cg.num_bytes(true) : 0;
+    SGLayout layout(header);
+    bool ok = PWriteFully(fd, &header, sizeof(SGHeader), 0);
+    ok = ParallelWrite(fd, layout.out_offsets, layout.offsets_bytes,
+                       cg.byte_offsets(false)) && ok;
+    ok = ParallelWrite(fd, layout.out_neighs, layout.out_neighs_bytes,
+                       cg.neigh_bytes(false)) && ok;
+    if (header.directed) {
+      ok = ParallelWrite(fd, layout.in_offsets, layout.offsets_bytes,
+                         cg.byte_offsets(true)) && ok;
+      ok = ParallelWrite(fd, layout.in_neighs, layout.in_neighs_bytes,
+                         cg.neigh_bytes(true)) && ok;
     }
+    CheckWritten(ok);
   }
 
-  void WriteGraph(std::string filename, bool serialized = false) {
+  std::fstream OpenOutput(std::string filename) {
     if (filename == "") {
       std::cout << "No output filename given (Use -h for help)" << std::endl;
       std::exit(-8);
@@ -78,16 +98,152 @@ class WriterBase {
       std::cout << "Couldn't write to file " << filename << std::endl;
       std::exit(-5);
     }
-    if (serialized)
-      WriteSerializedGraph(file);
-    else
+    return file;
+  }
+
+  // Serialized graphs are written with pwrite (ParallelWrite) instead
+  int OpenSerializedOutput(std::string filename) {
+    if (filename == "") {
+      std::cout << "No output filename given (Use -h for help)" << std::endl;
+      std::exit(-8);
+    }
+    filename_ = filename;
+    int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+      std::cout << "Couldn't write to file " << filename << std::endl;
+      std::exit(-5);
+    }
+    return fd;
+  }
+
+  void WriteGraph(std::string filename, bool serialized = false) {
+    if (serialized) {
+      int fd = OpenSerializedOutput(filename);
+      WriteSerializedGraph(fd);
+      CheckWritten(close(fd) == 0);
+    } else {
+      std::fstream file = OpenOutput(filename);
       WriteEL(file);
-    file.close();
+      file.close();
+    }
   }
 
- private:
-  CSRGraph<NodeID_, DestID_> &g_;
+  void WriteCompressedGraph(std::string filename) {
+    int fd = OpenSerializedOutput(filename);
+    WriteCompressedGraph(fd);
+    CheckWritten(close(fd) == 0);
+  }
+
+ protected:
+  // Copies only the fields, so padding of a zeroed dest stays zero
+  static void CopyFields(const NodeID_ &from, NodeID_ *to) {
+    *to = from;
+  }
+
+  template <typename WeightT_>
+  static void CopyFields(const NodeWeight<NodeID_, WeightT_> &from,
+                         NodeWeight<NodeID_, WeightT_> *to) {
+    to->v = from.v;
+    to->w = from.w;
+  }
+
+  // Writes count neighbors at pos, but if DestID_ has padding (e.g. 64-bit
+  //   IDs with 32-bit weights), copies them into zeroed buffers first so the
+  //   file doesn't get uninitialized bytes
+  bool WriteNeighs(int fd, int64_t pos, int64_t count, const DestID_ *neighs) {
+    if (std::is_same<DestID_, NodeID_>::value ||
+        (sizeof(DestID_) == sizeof(NodeID_) + sizeof(SGID)))
+      return ParallelWrite(fd, pos, count * sizeof(DestID_), neighs);
+    const int64_t kChunkSize = kIOChunkBytes / sizeof(DestID_);
+    int64_t num_chunks = (count + kChunkSize - 1) / kChunkSize;
+    bool ok = true;
+    #pragma omp parallel reduction(&& : ok)
+    {
+      std::vector<DestID_> buffer(kChunkSize);
+      #pragma omp for schedule(dynamic, 1)
+      for (int64_t c=0; c < num_chunks; c++) {
+        int64_t begin = c * kChunkSize;
+        int64_t chunk = std::min(kChunkSize, count - begin);
+        std::memset(static_cast<void*>(buffer.data()), 0,
+                    chunk * sizeof(DestID_));
+        for (int64_t i=0; i < chunk; i++)
+          CopyFields(neighs[begin + i], &buffer[i]);
+        ok = PWriteFully(fd, buffer.data(), chunk * sizeof(DestID_),
+                         pos + begin * sizeof(DestID_)) && ok;
+      }
+    }
+    return ok;
+  }
+
+  // Writes header, then CSR arrays (and original IDs) positioned by SGLayout
+  void WriteSGArrays(int fd, SGHeader header) {
+    header.has_original_ids = g_.relabeled();
+    SGLayout layout(header);
+    bool ok = PWriteFully(fd, &header, sizeof(SGHeader), 0);
+    pvector<SGOffset> offsets = g_.VertexOffsets(false);
+    ok = ParallelWrite(fd, layout.out_offsets, layout.offsets_bytes,
+                       offsets.data()) && ok;
+    ok = WriteNeighs(fd, layout.out_neighs, g_.num_edges_directed(),
+                     g_.out_neigh(0).begin()) && ok;
+    if (header.directed) {
+      offsets = g_.VertexOffsets(true);
+      ok = ParallelWrite(fd, layout.in_offsets, layout.offsets_bytes,
+                         offsets.data()) && ok;
+      ok = WriteNeighs(fd, layout.in_neighs, g_.num_edges_directed(),
+                       g_.in_neigh(0).begin()) && ok;
+    }
+    if (header.has_original_ids) {
+      pvector<NodeID_> original_ids(g_.num_nodes());
+      #pragma omp parallel for
+      for (NodeID_ n=0; n < g_.num_nodes(); n++)
+        original_ids[n] = g_.original_id(n);
+      ok = ParallelWrite(fd, layout.original_ids,
+                         g_.num_nodes() * sizeof(NodeID_),
+                         original_ids.data()) && ok;
+    }
+    CheckWritten(ok);
+  }
+
+  void CheckWritten(bool ok) {
+    if (!ok) {
+      std::cout << "Couldn't write to file " << filename_ << std::endl;
+      std::exit(-5);
+    }
+  }
+
+  const CSRGraph<NodeID_, DestID_> &g_;
   std::string filename_;
 };
 
+
+
+template <typename NodeID_, typename WeightT_, typename StoreT_>
+class SplitWriter : public WriterBase<NodeID_> {
+ public:
+  explicit SplitWriter(const SplitWGraph<NodeID_, WeightT_, StoreT_> &g)
+      : WriterBase<NodeID_>(g.topology()), sg_(g) {}
+
+  void WriteGraph(std::string filename) {
+    int fd = this->OpenSerializedOutput(filename);
+    SGHeader header(sg_.directed(), sg_.num_nodes(), sg_.num_edges_directed(),
+                    sizeof(NodeID_), sizeof(NodeID_), sizeof(StoreT_),
+                    kSWSGMagic);
+    header.weight_scale = sg_.weight_scale();
+    this->WriteSGArrays(fd, header);
+    header.has_original_ids = sg_.relabeled();
+    SGLayout layout(header);
+    int64_t weights_bytes = header.num_edges * sizeof(StoreT_);
+    bool ok = ParallelWrite(fd, layout.out_weights, weights_bytes,
+                            sg_.weights(false));
+    if (header.directed) {
+      ok = ParallelWrite(fd, layout.in_weights, weights_bytes,
+                         sg_.weights(true)) && ok;
+    }
+    this->CheckWritten(ok && (close(fd) == 0));
+  }
+
+ private:
+  const SplitWGraph<NodeID_, WeightT_, StoreT_> &sg_;
+};
+
 #endif  // WRITER_H_
@@ -0,0 +1,300 @@
+0 164
+0 871
+0 995
+1 273
+2 6
+2 10
+2 22
+2 43
+2 60
+2 79
+2 86
+2 97
+2 113
+2 120
+2 136
+2 140
+2 148
+2 151
+2 155
+2 162
+2 178
+2 181
+2 201
+2 205
+2 206
+2 235
+2 240
+2 249
+2 256
+2 260
+2 267
+2 270
+2 276
+2 279
+2 283
+2 289
+2 293
+2 302
+2 312
+2 319
+2 329
+2 330
+2 333
+2 339
+2 344
+2 352
+2 353
+2 360
+2 362
+2 373
+2 374
+2 377
+2 380
+2 391
+2 398
+2 411
+2 420
+2 427
+2 441
+2 454
+2 461
+2 474
+2 495
+2 496
+2 502
+2 520
+2 524
+2 530
+2 536
+2 538
+2 542
+2 550
+2 565
+2 569
+2 583
+2 589
+2 598
+2 599
+2 606
+2 632
+2 648
+2 651
+2 661
+2 679
+2 687
+2 688
+2 692
+2 696
+2 697
+2 701
+2 706
+2 707
+2 710
+2 714
+2 715
+2 719
+2 725
+2 730
+2 732
+2 737
+2 740
+2 763
+2 765
+2 768
+2 769
+2 781
+2 787
+2 791
+2 798
+2 800
+2 816
+2 822
+2 826
+2 829
+2 837
+2 869
+2 881
+2 882
+2 883
+2 887
+2 894
+2 919
+2 920
+2 929
+2 937
+2 946
+2 956
+2 976
+2 990
+2 995
+2 1007
+2 1008
+2 1010
+2 1013
+2 1019
+2 1021
+3 137
+3 496
+3 536
+3 617
+3 826
+3 985
+4 72
+4 122
+4 155
+4 158
+4 164
+4 202
+4 270
+4 279
+4 373
+4 536
+4 564
+4 633
+4 662
+4 700
+4 707
+4 754
+4 763
+4 790
+4 822
+4 838
+4 982
+5 6
+5 86
+5 270
+5 329
+5 398
+5 472
+5 542
+5 578
+5 781
+5 798
+5 870
+6 2
+6 5
+6 53
+6 94
+6 97
+6 117
+6 140
+6 162
+6 164
+6 175
+6 215
+6 247
+6 267
+6 270
+6 360
+6 373
+6 440
+6 447
+6 450
+6 496
+6 536
+6 538
+6 542
+6 550
+6 554
+6 563
+6 583
+6 618
+6 632
+6 664
+6 677
+6 679
+6 706
+6 710
+6 725
+6 742
+6 748
+6 758
+6 829
+6 838
+6 841
+6 921
+6 939
+6 976
+6 979
+6 980
+6 986
+7 127
+7 279
+7 344
+7 429
+7 542
+7 574
+7 662
+7 707
+7 877
+7 946
+8 162
+8 260
+8 536
+8 542
+8 583
+8 606
+8 679
+8 706
+8 707
+8 877
+8 919
+8 999
+9 71
+9 103
+9 127
+9 172
+9 197
+9 265
+9 270
+9 279
+9 344
+9 416
+9 435
+9 536
+9 542
+9 579
+9 632
+9 701
+9 732
+9 826
+9 1004
+10 2
+10 86
+10 127
+10 136
+10 162
+10 197
+10 270
+10 324
+10 490
+10 524
+10 536
+10 542
+10 591
+10 593
+10 655
+10 711
+10 812
+10 881
+10 946
+10 1021
+11 35
+11 224
+11 253
+11 279
+11 498
+11 512
+12 86
+12 536
+12 679
+13 536
+13 593
+13 679
+13 883
+15 524
+15 540
+15 542
+15 717
+15 763
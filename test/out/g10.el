@@ -0,0 +1,20992 @@
+0 164
+0 871
+0 995
+1 273
+2 6
+2 10
+2 22
+2 43
+2 60
+2 79
+2 86
+2 97
+2 113
+2 120
+2 136
+2 140
+2 148
+2 151
+2 155
+2 162
+2 178
+2 181
+2 201
+2 205
+2 206
+2 235
+2 240
+2 249
+2 256
+2 260
+2 267
+2 270
+2 276
+2 279
+2 283
+2 289
+2 293
+2 302
+2 312
+2 319
+2 329
+2 330
+2 333
+2 339
+2 344
+2 352
+2 353
+2 360
+2 362
+2 373
+2 374
+2 377
+2 380
+2 391
+2 398
+2 411
+2 420
+2 427
+2 441
+2 454
+2 461
+2 474
+2 495
+2 496
+2 502
+2 520
+2 524
+2 530
+2 536
+2 538
+2 542
+2 550
+2 565
+2 569
+2 583
+2 589
+2 598
+2 599
+2 606
+2 632
+2 648
+2 651
+2 661
+2 679
+2 687
+2 688
+2 692
+2 696
+2 697
+2 701
+2 706
+2 707
+2 710
+2 714
+2 715
+2 719
+2 725
+2 730
+2 732
+2 737
+2 740
+2 763
+2 765
+2 768
+2 769
+2 781
+2 787
+2 791
+2 798
+2 800
+2 816
+2 822
+2 826
+2 829
+2 837
+2 869
+2 881
+2 882
+2 883
+2 887
+2 894
+2 919
+2 920
+2 929
+2 937
+2 946
+2 956
+2 976
+2 990
+2 995
+2 1007
+2 1008
+2 1010
+2 1013
+2 1019
+2 1021
+3 137
+3 496
+3 536
+3 617
+3 826
+3 985
+4 72
+4 122
+4 155
+4 158
+4 164
+4 202
+4 270
+4 279
+4 373
+4 536
+4 564
+4 633
+4 662
+4 700
+4 707
+4 754
+4 763
+4 790
+4 822
+4 838
+4 982
+5 6
+5 86
+5 270
+5 329
+5 398
+5 472
+5 542
+5 578
+5 781
+5 798
+5 870
+6 2
+6 5
+6 53
+6 94
+6 97
+6 117
+6 140
+6 162
+6 164
+6 175
+6 215
+6 247
+6 267
+6 270
+6 360
+6 373
+6 440
+6 447
+6 450
+6 496
+6 536
+6 538
+6 542
+6 550
+6 554
+6 563
+6 583
+6 618
+6 632
+6 664
+6 677
+6 679
+6 706
+6 710
+6 725
+6 742
+6 748
+6 758
+6 829
+6 838
+6 841
+6 921
+6 939
+6 976
+6 979
+6 980
+6 986
+7 127
+7 279
+7 344
+7 429
+7 542
+7 574
+7 662
+7 707
+7 877
+7 946
+8 162
+8 260
+8 536
+8 542
+8 583
+8 606
+8 679
+8 706
+8 707
+8 877
+8 919
+8 999
+9 71
+9 103
+9 127
+9 172
+9 197
+9 265
+9 270
+9 279
+9 344
+9 416
+9 435
+9 536
+9 542
+9 579
+9 632
+9 701
+9 732
+9 826
+9 1004
+10 2
+10 86
+10 127
+10 136
+10 162
+10 197
+10 270
+10 324
+10 490
+10 524
+10 536
+10 542
+10 591
+10 593
+10 655
+10 711
+10 812
+10 881
+10 946
+10 1021
+11 35
+11 224
+11 253
+11 279
+11 498
+11 512
+12 86
+12 536
+12 679
+13 536
+13 593
+13 679
+13 883
+15 524
+15 540
+15 542
+15 717
+15 763
+16 235
+16 294
+16 360
+16 822
+16 949
+17 837
+18 479
+18 526
+19 184
+19 360
+20 22
+20 72
+20 86
+20 175
+20 260
+20 312
+20 326
+20 513
+20 524
+20 583
+20 632
+20 679
+20 701
+20 787
+20 869
+20 878
+20 881
+20 976
+20 985
+21 435
+21 487
+21 536
+21 707
+21 877
+22 2
+22 20
+22 60
+22 72
+22 86
+22 103
+22 113
+22 127
+22 131
+22 136
+22 137
+22 140
+22 145
+22 151
+22 154
+22 155
+22 156
+22 159
+22 162
+22 164
+22 166
+22 195
+22 197
+22 205
+22 206
+22 217
+22 235
+22 247
+22 250
+22 260
+22 264
+22 267
+22 269
+22 270
+22 276
+22 279
+22 294
+22 312
+22 318
+22 319
+22 329
+22 330
+22 339
+22 340
+22 342
+22 344
+22 349
+22 360
+22 362
+22 373
+22 385
+22 386
+22 389
+22 391
+22 410
+22 413
+22 415
+22 433
+22 435
+22 454
+22 468
+22 479
+22 491
+22 496
+22 502
+22 503
+22 524
+22 536
+22 542
+22 549
+22 573
+22 578
+22 579
+22 583
+22 589
+22 591
+22 593
+22 599
+22 606
+22 614
+22 623
+22 632
+22 655
+22 676
+22 679
+22 687
+22 693
+22 700
+22 701
+22 706
+22 707
+22 708
+22 710
+22 725
+22 728
+22 730
+22 742
+22 747
+22 751
+22 754
+22 763
+22 780
+22 781
+22 782
+22 787
+22 791
+22 809
+22 822
+22 830
+22 837
+22 838
+22 849
+22 852
+22 869
+22 882
+22 887
+22 894
+22 905
+22 919
+22 921
+22 946
+22 952
+22 976
+22 985
+22 986
+22 994
+22 997
+22 1004
+22 1021
+24 147
+24 373
+24 479
+24 513
+24 536
+24 591
+24 632
+24 707
+24 826
+24 883
+24 986
+24 1003
+24 1019
+25 155
+25 197
+25 536
+25 679
+25 882
+26 44
+26 77
+26 83
+26 153
+26 156
+26 162
+26 181
+26 191
+26 193
+26 278
+26 305
+26 330
+26 339
+26 366
+26 367
+26 370
+26 375
+26 380
+26 386
+26 413
+26 502
+26 532
+26 536
+26 542
+26 569
+26 573
+26 574
+26 578
+26 589
+26 591
+26 614
+26 679
+26 700
+26 706
+26 707
+26 719
+26 787
+26 791
+26 849
+26 880
+26 894
+26 901
+26 921
+26 946
+26 970
+26 994
+26 995
+27 140
+27 205
+27 259
+27 279
+27 360
+27 536
+27 589
+27 882
+28 444
+29 907
+30 35
+30 39
+30 72
+30 86
+30 158
+30 178
+30 185
+30 205
+30 206
+30 217
+30 235
+30 260
+30 276
+30 281
+30 307
+30 312
+30 318
+30 322
+30 329
+30 360
+30 367
+30 373
+30 485
+30 509
+30 520
+30 536
+30 542
+30 591
+30 618
+30 658
+30 679
+30 686
+30 763
+30 790
+30 829
+30 878
+30 894
+30 946
+30 976
+30 1000
+30 1021
+31 360
+31 593
+32 496
+33 83
+33 583
+33 881
+34 473
+34 611
+34 796
+34 826
+35 11
+35 30
+35 155
+35 206
+35 279
+35 312
+35 375
+35 386
+35 475
+35 536
+35 679
+35 686
+35 700
+35 730
+35 822
+35 905
+35 946
+35 976
+35 982
+37 427
+37 946
+39 30
+39 100
+39 155
+39 162
+39 175
+39 260
+39 279
+39 282
+39 328
+39 360
+39 479
+39 482
+39 509
+39 513
+39 536
+39 542
+39 648
+39 701
+39 719
+39 822
+39 882
+39 966
+39 1004
+40 106
+40 235
+40 265
+40 373
+40 479
+43 2
+43 72
+43 77
+43 206
+43 224
+43 246
+43 329
+43 372
+43 380
+43 435
+43 517
+43 536
+43 545
+43 632
+43 679
+43 717
+43 763
+43 771
+43 894
+43 896
+43 946
+43 1019
+44 26
+44 117
+44 360
+44 520
+44 536
+44 679
+44 822
+45 373
+45 458
+45 573
+45 679
+46 696
+47 496
+48 162
+48 536
+48 621
+48 986
+49 131
+49 162
+49 181
+49 222
+49 230
+49 270
+49 279
+49 312
+49 386
+49 471
+49 479
+49 484
+49 496
+49 533
+49 536
+49 578
+49 617
+49 740
+49 964
+49 1021
+50 162
+50 270
+50 282
+50 496
+50 542
+51 159
+51 329
+51 496
+51 536
+52 483
+53 6
+53 72
+53 83
+53 86
+53 117
+53 127
+53 162
+53 193
+53 240
+53 270
+53 279
+53 282
+53 322
+53 329
+53 330
+53 339
+53 360
+53 375
+53 454
+53 479
+53 487
+53 491
+53 496
+53 519
+53 520
+53 536
+53 539
+53 542
+53 581
+53 589
+53 700
+53 707
+53 730
+53 881
+53 923
+53 986
+53 1021
+54 86
+54 106
+54 153
+54 256
+54 270
+54 329
+54 349
+54 360
+54 444
+54 459
+54 536
+54 544
+54 565
+54 589
+54 627
+54 1021
+55 536
+56 536
+57 360
+57 464
+57 593
+58 162
+58 524
+58 536
+58 686
+58 822
+59 72
+59 162
+59 197
+59 282
+59 342
+59 360
+59 373
+59 475
+59 479
+59 542
+59 579
+59 589
+59 701
+59 707
+59 822
+59 878
+59 995
+60 2
+60 22
+60 72
+60 97
+60 117
+60 126
+60 127
+60 160
+60 162
+60 197
+60 206
+60 211
+60 235
+60 242
+60 264
+60 270
+60 279
+60 302
+60 312
+60 370
+60 373
+60 450
+60 496
+60 520
+60 533
+60 536
+60 538
+60 542
+60 562
+60 569
+60 578
+60 593
+60 621
+60 622
+60 632
+60 635
+60 693
+60 700
+60 706
+60 772
+60 819
+60 822
+60 830
+60 869
+60 898
+60 1003
+60 1010
+60 1019
+61 92
+61 131
+61 189
+61 252
+61 344
+61 496
+61 498
+61 536
+61 542
+61 563
+61 589
+61 593
+61 679
+61 725
+61 733
+61 923
+61 946
+61 995
+62 86
+62 155
+62 270
+62 339
+62 360
+62 391
+62 495
+62 536
+62 569
+62 664
+62 712
+62 822
+62 826
+62 859
+62 946
+62 1021
+63 86
+63 121
+63 136
+63 140
+63 155
+63 162
+63 172
+63 240
+63 339
+63 354
+63 360
+63 407
+63 435
+63 496
+63 513
+63 520
+63 536
+63 686
+63 706
+63 923
+63 982
+63 1010
+64 159
+64 277
+64 312
+64 583
+64 711
+64 997
+65 72
+65 86
+65 375
+65 536
+65 542
+65 882
+65 994
+66 270
+66 344
+67 162
+67 330
+67 542
+67 787
+67 791
+67 870
+67 876
+69 563
+70 373
+70 479
+71 9
+71 109
+72 4
+72 20
+72 22
+72 30
+72 43
+72 53
+72 59
+72 60
+72 65
+72 86
+72 99
+72 117
+72 120
+72 121
+72 127
+72 133
+72 162
+72 164
+72 178
+72 195
+72 196
+72 197
+72 206
+72 211
+72 217
+72 224
+72 235
+72 251
+72 252
+72 259
+72 260
+72 265
+72 266
+72 269
+72 270
+72 276
+72 279
+72 282
+72 294
+72 306
+72 308
+72 312
+72 320
+72 322
+72 324
+72 327
+72 329
+72 339
+72 342
+72 352
+72 354
+72 360
+72 362
+72 373
+72 380
+72 391
+72 405
+72 432
+72 435
+72 455
+72 485
+72 487
+72 496
+72 502
+72 514
+72 520
+72 524
+72 526
+72 532
+72 536
+72 538
+72 539
+72 542
+72 552
+72 568
+72 573
+72 574
+72 583
+72 589
+72 593
+72 594
+72 596
+72 601
+72 605
+72 610
+72 614
+72 617
+72 625
+72 629
+72 632
+72 633
+72 634
+72 635
+72 652
+72 666
+72 679
+72 700
+72 701
+72 706
+72 707
+72 710
+72 725
+72 730
+72 739
+72 740
+72 763
+72 780
+72 781
+72 790
+72 791
+72 805
+72 809
+72 819
+72 822
+72 826
+72 830
+72 839
+72 846
+72 869
+72 881
+72 882
+72 887
+72 925
+72 946
+72 947
+72 976
+72 989
+72 995
+72 997
+72 1021
+73 536
+73 589
+73 662
+73 826
+74 86
+74 115
+74 120
+74 140
+74 206
+74 249
+74 307
+74 339
+74 348
+74 373
+74 442
+74 459
+74 513
+74 520
+74 533
+74 542
+74 717
+74 737
+74 740
+74 787
+74 798
+74 919
+74 946
+74 986
+74 1021
+75 479
+76 686
+77 26
+77 43
+77 140
+77 206
+77 979
+79 2
+79 140
+79 162
+79 270
+79 279
+79 367
+79 496
+79 536
+79 781
+79 782
+79 791
+79 826
+79 995
+80 122
+80 148
+80 155
+80 260
+80 264
+80 279
+80 314
+80 327
+80 345
+80 357
+80 373
+80 436
+80 536
+80 542
+80 869
+80 946
+80 966
+80 986
+80 1021
+81 578
+82 86
+82 978
+83 26
+83 33
+83 53
+83 106
+83 158
+83 162
+83 197
+83 217
+83 247
+83 267
+83 270
+83 279
+83 282
+83 299
+83 312
+83 324
+83 344
+83 352
+83 354
+83 360
+83 373
+83 375
+83 380
+83 403
+83 464
+83 496
+83 513
+83 533
+83 536
+83 542
+83 569
+83 574
+83 578
+83 583
+83 589
+83 679
+83 696
+83 700
+83 701
+83 706
+83 707
+83 727
+83 765
+83 781
+83 801
+83 822
+83 869
+83 871
+83 876
+83 946
+83 995
+83 1019
+83 1021
+84 197
+85 679
+86 2
+86 5
+86 10
+86 12
+86 20
+86 22
+86 30
+86 53
+86 54
+86 62
+86 63
+86 65
+86 72
+86 74
+86 82
+86 93
+86 96
+86 97
+86 102
+86 103
+86 106
+86 112
+86 117
+86 120
+86 127
+86 129
+86 135
+86 136
+86 140
+86 141
+86 143
+86 151
+86 155
+86 159
+86 162
+86 164
+86 167
+86 172
+86 175
+86 177
+86 178
+86 181
+86 189
+86 192
+86 193
+86 197
+86 205
+86 206
+86 207
+86 211
+86 217
+86 218
+86 219
+86 226
+86 235
+86 240
+86 244
+86 249
+86 250
+86 260
+86 265
+86 266
+86 267
+86 269
+86 270
+86 273
+86 276
+86 278
+86 279
+86 282
+86 286
+86 290
+86 294
+86 299
+86 305
+86 312
+86 324
+86 326
+86 329
+86 334
+86 339
+86 344
+86 345
+86 350
+86 352
+86 354
+86 357
+86 360
+86 362
+86 364
+86 366
+86 367
+86 372
+86 373
+86 375
+86 382
+86 386
+86 391
+86 392
+86 398
+86 403
+86 405
+86 412
+86 413
+86 416
+86 417
+86 421
+86 426
+86 433
+86 435
+86 436
+86 437
+86 445
+86 458
+86 459
+86 461
+86 463
+86 466
+86 471
+86 473
+86 479
+86 482
+86 484
+86 495
+86 496
+86 502
+86 503
+86 510
+86 512
+86 520
+86 521
+86 524
+86 526
+86 528
+86 530
+86 532
+86 533
+86 536
+86 537
+86 539
+86 542
+86 545
+86 549
+86 556
+86 562
+86 569
+86 573
+86 574
+86 576
+86 578
+86 579
+86 583
+86 588
+86 589
+86 591
+86 593
+86 594
+86 604
+86 605
+86 606
+86 608
+86 611
+86 618
+86 620
+86 630
+86 632
+86 633
+86 648
+86 650
+86 654
+86 655
+86 656
+86 661
+86 662
+86 664
+86 677
+86 679
+86 685
+86 686
+86 687
+86 688
+86 692
+86 696
+86 699
+86 700
+86 701
+86 706
+86 707
+86 710
+86 714
+86 717
+86 719
+86 722
+86 729
+86 730
+86 733
+86 737
+86 739
+86 740
+86 742
+86 763
+86 765
+86 769
+86 774
+86 777
+86 778
+86 781
+86 783
+86 785
+86 786
+86 787
+86 791
+86 796
+86 805
+86 809
+86 811
+86 819
+86 822
+86 823
+86 826
+86 829
+86 837
+86 838
+86 845
+86 846
+86 860
+86 865
+86 866
+86 869
+86 873
+86 875
+86 876
+86 877
+86 882
+86 883
+86 891
+86 894
+86 905
+86 907
+86 919
+86 921
+86 926
+86 929
+86 946
+86 947
+86 948
+86 970
+86 974
+86 976
+86 979
+86 982
+86 985
+86 988
+86 990
+86 994
+86 995
+86 997
+86 998
+86 1002
+86 1003
+86 1006
+86 1008
+86 1010
+86 1021
+87 162
+87 679
+88 127
+88 536
+88 568
+88 992
+90 536
+91 113
+91 140
+91 205
+91 270
+91 289
+91 312
+91 343
+91 536
+91 601
+91 679
+91 706
+91 730
+91 822
+91 976
+91 1021
+92 61
+92 252
+92 270
+92 279
+92 283
+92 373
+92 542
+92 583
+92 593
+92 632
+92 686
+92 701
+92 707
+92 777
+92 869
+92 894
+93 86
+93 240
+93 279
+93 280
+93 373
+93 629
+94 6
+94 1003
+95 461
+95 513
+96 86
+96 162
+96 279
+96 413
+96 532
+96 577
+96 787
+97 2
+97 6
+97 60
+97 86
+97 106
+97 112
+97 117
+97 127
+97 145
+97 162
+97 164
+97 167
+97 176
+97 181
+97 206
+97 279
+97 312
+97 327
+97 368
+97 373
+97 379
+97 398
+97 424
+97 450
+97 487
+97 491
+97 496
+97 520
+97 536
+97 538
+97 542
+97 570
+97 573
+97 578
+97 591
+97 593
+97 606
+97 611
+97 661
+97 679
+97 700
+97 714
+97 721
+97 768
+97 782
+97 787
+97 822
+97 826
+97 830
+97 865
+97 907
+97 950
+97 976
+97 982
+97 995
+97 1010
+97 1021
+98 282
+98 479
+99 72
+100 39
+100 136
+100 140
+100 319
+100 373
+100 542
+100 573
+100 651
+100 693
+100 751
+100 765
+100 777
+100 869
+100 894
+101 279
+101 391
+101 520
+101 679
+101 838
+101 1019
+102 86
+102 112
+102 140
+102 143
+102 162
+102 279
+102 329
+102 360
+102 437
+102 520
+102 536
+102 736
+102 868
+102 879
+102 959
+102 982
+103 9
+103 22
+103 86
+103 158
+103 235
+103 279
+103 373
+103 391
+103 496
+103 499
+103 504
+103 520
+103 577
+103 578
+103 632
+103 707
+103 822
+103 923
+103 926
+103 946
+103 995
+104 137
+104 264
+104 270
+104 520
+104 648
+104 822
+104 826
+104 1021
+106 40
+106 54
+106 83
+106 86
+106 97
+106 127
+106 162
+106 193
+106 206
+106 247
+106 260
+106 270
+106 312
+106 344
+106 360
+106 373
+106 400
+106 416
+106 427
+106 435
+106 437
+106 479
+106 491
+106 512
+106 524
+106 536
+106 542
+106 581
+106 593
+106 632
+106 659
+106 671
+106 679
+106 701
+106 707
+106 710
+106 722
+106 772
+106 826
+106 869
+106 886
+106 925
+106 994
+106 995
+106 1021
+107 117
+107 536
+107 579
+107 787
+109 71
+109 162
+109 164
+109 279
+109 312
+109 354
+109 373
+109 435
+109 437
+109 461
+109 536
+109 550
+109 615
+109 662
+109 707
+109 822
+110 360
+111 308
+111 329
+111 348
+111 366
+111 756
+112 86
+112 97
+112 102
+112 140
+112 270
+112 360
+112 373
+112 530
+112 536
+112 700
+112 822
+112 826
+112 830
+112 881
+112 891
+112 946
+113 2
+113 22
+113 91
+113 162
+113 197
+113 206
+113 260
+113 342
+113 360
+113 362
+113 435
+113 496
+113 509
+113 513
+113 536
+113 594
+113 679
+113 687
+113 700
+113 740
+113 995
+115 74
+115 270
+115 279
+115 354
+115 610
+115 722
+117 6
+117 44
+117 53
+117 60
+117 72
+117 86
+117 97
+117 107
+117 120
+117 127
+117 136
+117 137
+117 140
+117 143
+117 155
+117 162
+117 164
+117 183
+117 197
+117 200
+117 205
+117 206
+117 240
+117 248
+117 251
+117 260
+117 270
+117 277
+117 278
+117 279
+117 283
+117 293
+117 299
+117 308
+117 311
+117 319
+117 322
+117 329
+117 339
+117 342
+117 344
+117 353
+117 360
+117 373
+117 380
+117 386
+117 392
+117 412
+117 427
+117 433
+117 435
+117 437
+117 440
+117 442
+117 478
+117 479
+117 495
+117 496
+117 502
+117 503
+117 509
+117 519
+117 520
+117 524
+117 526
+117 536
+117 542
+117 550
+117 554
+117 563
+117 565
+117 573
+117 574
+117 577
+117 578
+117 581
+117 589
+117 593
+117 594
+117 596
+117 599
+117 605
+117 610
+117 611
+117 621
+117 632
+117 658
+117 662
+117 664
+117 679
+117 686
+117 687
+117 692
+117 693
+117 699
+117 700
+117 701
+117 706
+117 717
+117 730
+117 733
+117 756
+117 763
+117 765
+117 777
+117 779
+117 781
+117 787
+117 800
+117 816
+117 819
+117 822
+117 826
+117 830
+117 837
+117 866
+117 869
+117 876
+117 894
+117 897
+117 905
+117 907
+117 920
+117 948
+117 949
+117 966
+117 976
+117 985
+117 995
+117 997
+117 1006
+117 1017
+117 1021
+118 946
+119 496
+119 536
+119 948
+120 2
+120 72
+120 74
+120 86
+120 117
+120 158
+120 159
+120 181
+120 224
+120 260
+120 270
+120 294
+120 312
+120 322
+120 373
+120 403
+120 536
+120 599
+120 677
+120 679
+120 772
+120 781
+120 822
+120 837
+120 881
+120 907
+121 63
+121 72
+121 162
+121 177
+121 235
+121 349
+121 360
+121 373
+121 435
+121 479
+121 490
+121 632
+121 637
+121 650
+121 679
+121 765
+121 774
+121 791
+121 865
+121 948
+121 982
+122 4
+122 80
+122 536
+122 710
+123 270
+125 140
+125 270
+125 360
+125 435
+125 498
+125 706
+125 894
+125 976
+126 60
+126 150
+126 172
+126 344
+126 360
+126 387
+126 470
+126 730
+126 781
+126 822
+126 871
+126 873
+126 883
+126 982
+127 7
+127 9
+127 10
+127 22
+127 53
+127 60
+127 72
+127 86
+127 88
+127 97
+127 106
+127 117
+127 131
+127 136
+127 143
+127 151
+127 155
+127 156
+127 158
+127 159
+127 162
+127 164
+127 176
+127 193
+127 197
+127 205
+127 206
+127 211
+127 217
+127 229
+127 230
+127 240
+127 260
+127 264
+127 266
+127 267
+127 270
+127 279
+127 289
+127 290
+127 294
+127 302
+127 317
+127 322
+127 324
+127 329
+127 339
+127 342
+127 344
+127 345
+127 349
+127 354
+127 360
+127 372
+127 373
+127 378
+127 391
+127 392
+127 403
+127 413
+127 461
+127 479
+127 481
+127 513
+127 520
+127 524
+127 532
+127 536
+127 542
+127 554
+127 573
+127 574
+127 578
+127 585
+127 589
+127 593
+127 614
+127 622
+127 632
+127 654
+127 660
+127 665
+127 674
+127 679
+127 687
+127 696
+127 701
+127 706
+127 714
+127 738
+127 763
+127 765
+127 777
+127 787
+127 811
+127 822
+127 826
+127 829
+127 837
+127 848
+127 864
+127 867
+127 869
+127 877
+127 891
+127 894
+127 923
+127 929
+127 946
+127 963
+127 976
+127 977
+127 995
+127 996
+127 1003
+127 1013
+127 1021
+128 270
+128 536
+128 662
+128 1021
+129 86
+129 164
+129 260
+129 312
+129 433
+129 435
+129 496
+129 524
+129 536
+129 542
+129 593
+129 699
+129 997
+130 360
+131 22
+131 49
+131 61
+131 127
+131 143
+131 153
+131 155
+131 162
+131 172
+131 201
+131 206
+131 227
+131 252
+131 256
+131 263
+131 270
+131 279
+131 294
+131 312
+131 339
+131 345
+131 360
+131 373
+131 391
+131 413
+131 444
+131 461
+131 477
+131 496
+131 520
+131 536
+131 542
+131 583
+131 589
+131 594
+131 634
+131 679
+131 706
+131 730
+131 739
+131 787
+131 800
+131 822
+131 826
+131 830
+131 838
+131 846
+131 882
+131 891
+131 945
+131 946
+131 976
+131 997
+131 1021
+132 982
+133 72
+133 279
+133 373
+133 496
+133 536
+133 542
+133 699
+134 136
+134 536
+135 86
+135 496
+135 778
+135 877
+136 2
+136 10
+136 22
+136 63
+136 86
+136 100
+136 117
+136 127
+136 134
+136 145
+136 158
+136 159
+136 162
+136 181
+136 206
+136 215
+136 217
+136 240
+136 260
+136 270
+136 279
+136 282
+136 342
+136 360
+136 366
+136 373
+136 374
+136 386
+136 391
+136 444
+136 471
+136 496
+136 513
+136 520
+136 524
+136 536
+136 539
+136 542
+136 573
+136 593
+136 618
+136 634
+136 686
+136 706
+136 730
+136 781
+136 787
+136 791
+136 826
+136 830
+136 838
+136 841
+136 860
+136 882
+136 921
+136 990
+136 995
+136 1021
+137 3
+137 22
+137 104
+137 117
+137 164
+137 189
+137 193
+137 270
+137 278
+137 308
+137 312
+137 360
+137 386
+137 427
+137 524
+137 536
+137 542
+137 632
+137 765
+137 876
+137 982
+138 373
+138 781
+138 891
+140 2
+140 6
+140 22
+140 27
+140 63
+140 74
+140 77
+140 79
+140 86
+140 91
+140 100
+140 102
+140 112
+140 117
+140 125
+140 153
+140 156
+140 162
+140 164
+140 175
+140 192
+140 193
+140 206
+140 209
+140 221
+140 224
+140 235
+140 244
+140 247
+140 250
+140 260
+140 264
+140 270
+140 279
+140 282
+140 311
+140 322
+140 324
+140 350
+140 360
+140 373
+140 386
+140 391
+140 398
+140 413
+140 427
+140 435
+140 450
+140 455
+140 464
+140 474
+140 479
+140 495
+140 496
+140 509
+140 520
+140 536
+140 537
+140 542
+140 545
+140 563
+140 579
+140 581
+140 583
+140 589
+140 591
+140 593
+140 594
+140 614
+140 632
+140 633
+140 644
+140 648
+140 655
+140 662
+140 679
+140 686
+140 687
+140 693
+140 696
+140 700
+140 701
+140 710
+140 730
+140 750
+140 751
+140 763
+140 769
+140 772
+140 778
+140 781
+140 813
+140 822
+140 826
+140 830
+140 857
+140 862
+140 869
+140 870
+140 877
+140 882
+140 886
+140 888
+140 894
+140 896
+140 898
+140 909
+140 934
+140 946
+140 961
+140 966
+140 976
+140 995
+140 1003
+140 1004
+140 1019
+140 1021
+141 86
+141 151
+141 354
+141 360
+141 435
+141 524
+141 536
+141 569
+141 571
+141 593
+141 661
+141 679
+141 701
+141 707
+141 733
+141 784
+141 830
+141 883
+141 894
+141 1004
+142 153
+142 270
+142 479
+142 536
+142 763
+143 86
+143 102
+143 117
+143 127
+143 131
+143 162
+143 164
+143 178
+143 197
+143 205
+143 233
+143 270
+143 278
+143 279
+143 282
+143 327
+143 329
+143 342
+143 349
+143 373
+143 391
+143 403
+143 413
+143 427
+143 436
+143 455
+143 496
+143 530
+143 536
+143 539
+143 610
+143 629
+143 632
+143 633
+143 657
+143 679
+143 693
+143 696
+143 710
+143 739
+143 763
+143 778
+143 862
+143 894
+143 932
+143 948
+143 966
+143 967
+143 976
+143 985
+143 1010
+143 1021
+145 22
+145 97
+145 136
+145 162
+145 164
+145 299
+145 360
+145 375
+145 427
+145 461
+145 504
+145 593
+145 610
+145 679
+145 700
+145 763
+145 811
+145 966
+146 946
+147 24
+147 538
+148 2
+148 80
+148 196
+148 205
+148 270
+148 373
+148 496
+148 538
+148 722
+148 791
+148 826
+148 829
+148 848
+148 997
+149 536
+149 819
+150 126
+150 205
+150 217
+150 279
+150 360
+150 366
+150 373
+150 491
+150 496
+150 536
+150 578
+150 583
+150 611
+150 655
+150 679
+150 710
+150 765
+150 772
+150 865
+150 885
+150 986
+151 2
+151 22
+151 86
+151 127
+151 141
+151 264
+151 269
+151 282
+151 290
+151 495
+151 542
+151 633
+151 664
+151 732
+151 763
+151 798
+151 800
+151 802
+151 816
+151 1021
+152 894
+153 26
+153 54
+153 131
+153 140
+153 142
+153 162
+153 164
+153 167
+153 175
+153 219
+153 235
+153 247
+153 252
+153 260
+153 270
+153 279
+153 282
+153 290
+153 330
+153 336
+153 344
+153 386
+153 409
+153 435
+153 437
+153 452
+153 479
+153 496
+153 503
+153 536
+153 542
+153 549
+153 569
+153 578
+153 679
+153 686
+153 692
+153 706
+153 763
+153 769
+153 791
+153 822
+153 867
+153 882
+153 894
+153 939
+153 976
+153 982
+153 1020
+154 22
+154 822
+154 882
+155 2
+155 4
+155 22
+155 25
+155 35
+155 39
+155 62
+155 63
+155 80
+155 86
+155 117
+155 127
+155 131
+155 159
+155 162
+155 164
+155 175
+155 178
+155 187
+155 205
+155 206
+155 211
+155 217
+155 218
+155 235
+155 249
+155 250
+155 252
+155 260
+155 265
+155 266
+155 267
+155 270
+155 273
+155 278
+155 279
+155 282
+155 302
+155 314
+155 322
+155 324
+155 330
+155 339
+155 344
+155 360
+155 362
+155 366
+155 372
+155 373
+155 380
+155 382
+155 383
+155 391
+155 399
+155 403
+155 413
+155 427
+155 436
+155 439
+155 474
+155 496
+155 510
+155 512
+155 520
+155 524
+155 532
+155 533
+155 536
+155 541
+155 542
+155 556
+155 559
+155 565
+155 574
+155 578
+155 579
+155 583
+155 588
+155 589
+155 591
+155 593
+155 594
+155 604
+155 611
+155 614
+155 618
+155 664
+155 676
+155 685
+155 687
+155 692
+155 693
+155 694
+155 701
+155 706
+155 707
+155 730
+155 763
+155 765
+155 770
+155 781
+155 786
+155 791
+155 811
+155 822
+155 839
+155 869
+155 876
+155 877
+155 882
+155 883
+155 886
+155 895
+155 905
+155 915
+155 919
+155 920
+155 929
+155 945
+155 949
+155 977
+155 982
+155 985
+155 995
+155 1003
+155 1021
+156 22
+156 26
+156 127
+156 140
+156 164
+156 197
+156 224
+156 235
+156 260
+156 264
+156 270
+156 279
+156 329
+156 342
+156 344
+156 362
+156 366
+156 373
+156 386
+156 427
+156 461
+156 496
+156 526
+156 536
+156 569
+156 578
+156 593
+156 595
+156 598
+156 623
+156 629
+156 637
+156 641
+156 648
+156 659
+156 662
+156 679
+156 692
+156 710
+156 800
+156 839
+156 883
+156 889
+156 919
+157 910
+158 4
+158 30
+158 83
+158 103
+158 120
+158 127
+158 136
+158 162
+158 164
+158 172
+158 181
+158 206
+158 270
+158 324
+158 344
+158 354
+158 360
+158 362
+158 373
+158 391
+158 435
+158 479
+158 496
+158 519
+158 536
+158 540
+158 542
+158 565
+158 573
+158 583
+158 589
+158 599
+158 611
+158 629
+158 634
+158 638
+158 646
+158 692
+158 700
+158 704
+158 706
+158 717
+158 721
+158 725
+158 781
+158 822
+158 837
+158 852
+158 882
+158 894
+158 919
+158 970
+158 1019
+158 1021
+159 22
+159 51
+159 64
+159 86
+159 120
+159 127
+159 136
+159 155
+159 178
+159 181
+159 206
+159 235
+159 252
+159 265
+159 279
+159 282
+159 324
+159 330
+159 360
+159 362
+159 373
+159 391
+159 435
+159 450
+159 479
+159 482
+159 496
+159 536
+159 538
+159 542
+159 554
+159 579
+159 588
+159 599
+159 662
+159 679
+159 692
+159 696
+159 700
+159 701
+159 724
+159 739
+159 763
+159 786
+159 787
+159 822
+159 907
+159 976
+159 989
+159 995
+160 60
+160 526
+160 536
+160 648
+161 270
+161 373
+161 536
+161 882
+162 2
+162 6
+162 8
+162 10
+162 22
+162 26
+162 39
+162 48
+162 49
+162 50
+162 53
+162 58
+162 59
+162 60
+162 63
+162 67
+162 72
+162 79
+162 83
+162 86
+162 87
+162 96
+162 97
+162 102
+162 106
+162 109
+162 113
+162 117
+162 121
+162 127
+162 131
+162 136
+162 140
+162 143
+162 145
+162 153
+162 155
+162 158
+162 164
+162 167
+162 172
+162 175
+162 177
+162 178
+162 189
+162 190
+162 193
+162 197
+162 201
+162 204
+162 205
+162 206
+162 211
+162 214
+162 217
+162 224
+162 227
+162 228
+162 229
+162 235
+162 240
+162 246
+162 250
+162 252
+162 260
+162 264
+162 265
+162 266
+162 267
+162 270
+162 273
+162 276
+162 278
+162 279
+162 282
+162 290
+162 294
+162 295
+162 304
+162 306
+162 311
+162 312
+162 318
+162 324
+162 329
+162 330
+162 339
+162 340
+162 342
+162 344
+162 345
+162 348
+162 353
+162 360
+162 364
+162 366
+162 367
+162 370
+162 372
+162 373
+162 386
+162 389
+162 391
+162 398
+162 412
+162 427
+162 433
+162 435
+162 437
+162 439
+162 443
+162 444
+162 454
+162 456
+162 464
+162 467
+162 479
+162 481
+162 485
+162 487
+162 491
+162 495
+162 496
+162 502
+162 513
+162 520
+162 522
+162 524
+162 526
+162 530
+162 532
+162 533
+162 536
+162 539
+162 542
+162 554
+162 555
+162 556
+162 559
+162 562
+162 563
+162 565
+162 569
+162 573
+162 574
+162 578
+162 579
+162 581
+162 583
+162 585
+162 586
+162 589
+162 591
+162 593
+162 594
+162 599
+162 610
+162 611
+162 614
+162 615
+162 618
+162 621
+162 632
+162 647
+162 648
+162 650
+162 654
+162 655
+162 660
+162 661
+162 662
+162 663
+162 664
+162 676
+162 677
+162 679
+162 687
+162 688
+162 693
+162 696
+162 700
+162 701
+162 704
+162 706
+162 707
+162 710
+162 711
+162 714
+162 717
+162 721
+162 722
+162 730
+162 737
+162 739
+162 740
+162 759
+162 763
+162 772
+162 777
+162 781
+162 787
+162 790
+162 791
+162 798
+162 803
+162 805
+162 811
+162 812
+162 813
+162 819
+162 822
+162 826
+162 830
+162 838
+162 841
+162 846
+162 865
+162 866
+162 869
+162 870
+162 873
+162 875
+162 877
+162 878
+162 880
+162 881
+162 882
+162 886
+162 887
+162 889
+162 890
+162 891
+162 894
+162 895
+162 896
+162 905
+162 907
+162 913
+162 921
+162 923
+162 929
+162 944
+162 946
+162 952
+162 953
+162 964
+162 976
+162 977
+162 978
+162 982
+162 986
+162 995
+162 997
+162 1003
+162 1006
+162 1010
+162 1013
+162 1021
+164 0
+164 4
+164 6
+164 22
+164 72
+164 86
+164 97
+164 109
+164 117
+164 127
+164 129
+164 137
+164 140
+164 143
+164 145
+164 153
+164 155
+164 156
+164 158
+164 162
+164 172
+164 178
+164 189
+164 197
+164 205
+164 224
+164 235
+164 240
+164 250
+164 251
+164 270
+164 273
+164 279
+164 282
+164 299
+164 312
+164 317
+164 318
+164 329
+164 330
+164 352
+164 354
+164 360
+164 367
+164 373
+164 380
+164 386
+164 391
+164 403
+164 412
+164 432
+164 435
+164 436
+164 466
+164 471
+164 479
+164 496
+164 503
+164 513
+164 520
+164 530
+164 533
+164 536
+164 538
+164 542
+164 559
+164 567
+164 573
+164 574
+164 578
+164 583
+164 585
+164 589
+164 594
+164 610
+164 623
+164 632
+164 643
+164 662
+164 669
+164 678
+164 679
+164 685
+164 686
+164 693
+164 700
+164 701
+164 706
+164 707
+164 710
+164 720
+164 730
+164 740
+164 763
+164 772
+164 781
+164 787
+164 791
+164 796
+164 797
+164 798
+164 800
+164 801
+164 811
+164 816
+164 822
+164 826
+164 838
+164 839
+164 860
+164 864
+164 873
+164 877
+164 882
+164 894
+164 903
+164 905
+164 919
+164 923
+164 926
+164 948
+164 950
+164 954
+164 976
+164 984
+164 985
+164 991
+164 994
+164 997
+164 998
+164 1004
+164 1021
+165 206
+165 279
+165 524
+165 536
+165 542
+165 826
+165 829
+165 907
+166 22
+166 279
+166 479
+166 532
+166 536
+166 701
+166 707
+166 777
+166 810
+166 826
+167 86
+167 97
+167 153
+167 162
+167 360
+167 373
+167 496
+167 520
+167 524
+167 536
+167 542
+167 604
+167 610
+167 644
+167 822
+167 881
+167 923
+167 946
+167 997
+167 1021
+168 539
+168 995
+169 344
+169 496
+169 739
+169 837
+170 260
+171 520
+171 822
+171 869
+171 882
+171 1021
+172 9
+172 63
+172 86
+172 126
+172 131
+172 158
+172 162
+172 164
+172 175
+172 178
+172 197
+172 224
+172 235
+172 264
+172 270
+172 279
+172 282
+172 294
+172 373
+172 382
+172 413
+172 442
+172 463
+172 496
+172 520
+172 524
+172 536
+172 542
+172 578
+172 589
+172 632
+172 679
+172 699
+172 706
+172 717
+172 733
+172 782
+172 787
+172 798
+172 822
+172 873
+172 882
+172 919
+172 924
+172 926
+172 948
+172 970
+172 976
+173 224
+173 250
+173 312
+173 350
+173 448
+173 519
+173 578
+174 270
+174 290
+175 6
+175 20
+175 39
+175 86
+175 140
+175 153
+175 155
+175 162
+175 172
+175 216
+175 228
+175 244
+175 264
+175 270
+175 279
+175 312
+175 322
+175 329
+175 358
+175 413
+175 435
+175 454
+175 464
+175 496
+175 509
+175 520
+175 524
+175 536
+175 542
+175 581
+175 589
+175 655
+175 666
+175 710
+175 730
+175 737
+175 822
+175 865
+175 882
+175 951
+175 982
+175 995
+175 997
+175 1006
+175 1019
+176 97
+176 127
+176 191
+176 206
+176 228
+176 270
+176 282
+176 330
+176 391
+176 496
+176 510
+176 536
+176 542
+176 593
+176 679
+176 693
+176 730
+176 981
+177 86
+177 121
+177 162
+177 185
+177 329
+177 360
+177 373
+177 399
+177 437
+177 496
+177 696
+177 971
+178 2
+178 30
+178 72
+178 86
+178 143
+178 155
+178 159
+178 162
+178 164
+178 172
+178 205
+178 211
+178 217
+178 235
+178 247
+178 250
+178 264
+178 267
+178 270
+178 317
+178 344
+178 372
+178 373
+178 403
+178 416
+178 427
+178 459
+178 487
+178 496
+178 502
+178 503
+178 520
+178 524
+178 536
+178 565
+178 568
+178 578
+178 593
+178 594
+178 610
+178 622
+178 679
+178 707
+178 717
+178 763
+178 765
+178 798
+178 812
+178 822
+178 869
+178 882
+178 894
+178 898
+178 946
+178 985
+178 1000
+178 1019
+180 329
+181 2
+181 26
+181 49
+181 86
+181 97
+181 120
+181 136
+181 158
+181 159
+181 205
+181 206
+181 217
+181 260
+181 270
+181 306
+181 329
+181 344
+181 360
+181 362
+181 373
+181 382
+181 383
+181 385
+181 429
+181 461
+181 487
+181 496
+181 502
+181 520
+181 536
+181 538
+181 542
+181 563
+181 565
+181 632
+181 662
+181 686
+181 706
+181 740
+181 756
+181 763
+181 782
+181 787
+181 796
+181 822
+181 846
+181 852
+181 873
+181 894
+181 925
+181 929
+181 970
+181 997
+181 1003
+181 1004
+183 117
+184 19
+184 679
+185 30
+185 177
+185 206
+185 240
+185 367
+185 373
+185 391
+185 472
+185 479
+185 610
+185 635
+185 650
+185 679
+185 693
+185 751
+185 800
+185 822
+185 894
+185 976
+185 978
+186 324
+187 155
+187 193
+187 278
+187 536
+187 578
+187 633
+187 679
+189 61
+189 86
+189 137
+189 162
+189 164
+189 224
+189 270
+189 360
+189 391
+189 520
+189 536
+189 539
+189 578
+189 679
+189 698
+189 763
+189 830
+189 908
+190 162
+190 206
+190 533
+190 686
+190 829
+191 26
+191 176
+191 306
+191 339
+191 360
+191 458
+191 475
+191 536
+191 542
+191 569
+191 577
+191 611
+191 632
+191 668
+191 679
+191 706
+191 822
+191 869
+191 882
+191 891
+191 894
+191 997
+192 86
+192 140
+192 398
+192 496
+192 536
+192 693
+192 822
+192 964
+193 26
+193 53
+193 86
+193 106
+193 127
+193 137
+193 140
+193 162
+193 187
+193 204
+193 235
+193 263
+193 267
+193 270
+193 276
+193 279
+193 280
+193 294
+193 360
+193 366
+193 386
+193 415
+193 435
+193 437
+193 479
+193 504
+193 520
+193 536
+193 555
+193 588
+193 589
+193 593
+193 594
+193 624
+193 632
+193 679
+193 707
+193 733
+193 772
+193 781
+193 822
+193 826
+193 840
+193 846
+193 881
+193 894
+193 903
+193 929
+193 976
+193 982
+193 995
+194 536
+194 826
+195 22
+195 72
+195 270
+195 279
+195 373
+195 391
+195 496
+195 520
+195 536
+195 539
+195 693
+195 869
+195 919
+195 993
+196 72
+196 148
+196 197
+196 244
+196 264
+196 299
+196 391
+196 700
+196 701
+196 822
+196 852
+196 869
+196 881
+196 894
+197 9
+197 10
+197 22
+197 25
+197 59
+197 60
+197 72
+197 83
+197 84
+197 86
+197 113
+197 117
+197 127
+197 143
+197 156
+197 162
+197 164
+197 172
+197 196
+197 205
+197 206
+197 217
+197 228
+197 240
+197 247
+197 248
+197 260
+197 262
+197 270
+197 288
+197 290
+197 294
+197 324
+197 326
+197 344
+197 353
+197 354
+197 358
+197 360
+197 366
+197 373
+197 374
+197 389
+197 397
+197 401
+197 435
+197 450
+197 455
+197 474
+197 479
+197 480
+197 496
+197 502
+197 533
+197 536
+197 542
+197 545
+197 550
+197 551
+197 563
+197 578
+197 583
+197 585
+197 593
+197 603
+197 614
+197 618
+197 632
+197 644
+197 664
+197 668
+197 679
+197 686
+197 696
+197 700
+197 701
+197 707
+197 721
+197 730
+197 733
+197 763
+197 765
+197 769
+197 772
+197 781
+197 786
+197 790
+197 798
+197 800
+197 819
+197 822
+197 826
+197 837
+197 846
+197 860
+197 869
+197 878
+197 882
+197 896
+197 907
+197 915
+197 923
+197 929
+197 946
+197 976
+197 989
+197 993
+197 995
+197 1004
+197 1006
+197 1019
+197 1021
+198 327
+198 542
+200 117
+200 530
+201 2
+201 131
+201 162
+201 312
+201 329
+201 373
+201 539
+201 710
+201 781
+201 1003
+201 1019
+202 4
+202 260
+202 270
+202 342
+202 360
+202 632
+204 162
+204 193
+204 226
+204 270
+204 278
+204 299
+204 330
+204 391
+204 450
+204 536
+204 593
+204 679
+204 706
+204 946
+204 995
+205 2
+205 22
+205 27
+205 30
+205 86
+205 91
+205 117
+205 127
+205 143
+205 148
+205 150
+205 155
+205 162
+205 164
+205 178
+205 181
+205 197
+205 215
+205 217
+205 235
+205 237
+205 250
+205 252
+205 260
+205 263
+205 265
+205 270
+205 279
+205 282
+205 289
+205 290
+205 299
+205 300
+205 312
+205 329
+205 339
+205 344
+205 353
+205 357
+205 360
+205 362
+205 373
+205 374
+205 382
+205 391
+205 432
+205 433
+205 435
+205 448
+205 454
+205 456
+205 459
+205 463
+205 467
+205 479
+205 496
+205 513
+205 520
+205 532
+205 536
+205 538
+205 539
+205 542
+205 562
+205 563
+205 569
+205 570
+205 573
+205 575
+205 578
+205 579
+205 583
+205 589
+205 591
+205 594
+205 610
+205 614
+205 617
+205 632
+205 633
+205 637
+205 649
+205 660
+205 662
+205 676
+205 679
+205 686
+205 687
+205 692
+205 693
+205 700
+205 701
+205 706
+205 707
+205 710
+205 733
+205 758
+205 765
+205 772
+205 785
+205 786
+205 787
+205 798
+205 816
+205 822
+205 826
+205 830
+205 865
+205 869
+205 877
+205 878
+205 882
+205 884
+205 888
+205 891
+205 894
+205 907
+205 921
+205 948
+205 954
+205 966
+205 976
+205 986
+205 988
+205 989
+205 990
+205 991
+205 995
+205 999
+205 1000
+205 1006
+205 1021
+206 2
+206 22
+206 30
+206 35
+206 43
+206 60
+206 72
+206 74
+206 77
+206 86
+206 97
+206 106
+206 113
+206 117
+206 127
+206 131
+206 136
+206 140
+206 155
+206 158
+206 159
+206 162
+206 165
+206 176
+206 181
+206 185
+206 190
+206 197
+206 228
+206 241
+206 244
+206 250
+206 251
+206 260
+206 262
+206 270
+206 279
+206 282
+206 290
+206 312
+206 314
+206 322
+206 324
+206 329
+206 339
+206 341
+206 344
+206 352
+206 360
+206 366
+206 370
+206 373
+206 374
+206 386
+206 391
+206 412
+206 416
+206 427
+206 429
+206 435
+206 450
+206 452
+206 454
+206 459
+206 474
+206 479
+206 483
+206 487
+206 491
+206 496
+206 513
+206 520
+206 524
+206 532
+206 536
+206 538
+206 541
+206 542
+206 563
+206 565
+206 573
+206 577
+206 578
+206 581
+206 583
+206 585
+206 589
+206 591
+206 593
+206 611
+206 615
+206 617
+206 632
+206 633
+206 655
+206 664
+206 679
+206 686
+206 688
+206 693
+206 696
+206 699
+206 706
+206 719
+206 730
+206 750
+206 765
+206 769
+206 772
+206 778
+206 791
+206 798
+206 801
+206 805
+206 809
+206 822
+206 826
+206 863
+206 876
+206 877
+206 881
+206 891
+206 894
+206 907
+206 913
+206 946
+206 947
+206 948
+206 959
+206 976
+206 985
+206 986
+206 993
+206 994
+206 995
+206 997
+206 999
+206 1021
+207 86
+208 373
+209 140
+209 260
+209 279
+209 282
+209 312
+209 373
+209 377
+209 496
+209 524
+209 526
+209 679
+209 837
+210 240
+210 524
+210 536
+211 60
+211 72
+211 86
+211 127
+211 155
+211 162
+211 178
+211 235
+211 243
+211 270
+211 294
+211 324
+211 326
+211 339
+211 344
+211 351
+211 360
+211 373
+211 456
+211 496
+211 510
+211 536
+211 554
+211 572
+211 593
+211 632
+211 637
+211 662
+211 679
+211 700
+211 701
+211 706
+211 710
+211 730
+211 782
+211 791
+211 822
+211 877
+211 881
+211 882
+211 946
+211 995
+212 329
+212 803
+213 830
+214 162
+215 6
+215 136
+215 205
+215 270
+215 391
+215 413
+215 671
+215 679
+215 710
+215 733
+215 774
+215 919
+215 923
+215 932
+216 175
+216 373
+216 524
+216 536
+216 583
+216 730
+216 930
+216 946
+217 22
+217 30
+217 72
+217 83
+217 86
+217 127
+217 136
+217 150
+217 155
+217 162
+217 178
+217 181
+217 197
+217 205
+217 235
+217 279
+217 306
+217 324
+217 342
+217 373
+217 378
+217 398
+217 445
+217 458
+217 496
+217 513
+217 524
+217 536
+217 538
+217 542
+217 570
+217 604
+217 611
+217 651
+217 655
+217 664
+217 675
+217 688
+217 706
+217 707
+217 709
+217 742
+217 756
+217 763
+217 772
+217 822
+217 823
+217 826
+217 865
+217 894
+217 905
+217 929
+217 970
+217 973
+217 976
+217 989
+217 1021
+218 86
+218 155
+218 263
+218 360
+218 569
+218 594
+218 763
+218 869
+218 882
+219 86
+219 153
+219 267
+219 324
+219 354
+219 403
+219 445
+219 524
+219 583
+219 610
+219 677
+219 685
+219 686
+219 710
+219 763
+219 839
+219 995
+220 250
+220 541
+220 706
+220 791
+220 822
+221 140
+221 260
+221 532
+221 536
+221 700
+221 763
+221 822
+222 49
+222 270
+222 289
+222 536
+222 830
+222 837
+222 887
+223 413
+223 1021
+224 11
+224 43
+224 72
+224 120
+224 140
+224 156
+224 162
+224 164
+224 172
+224 173
+224 189
+224 263
+224 294
+224 303
+224 360
+224 373
+224 479
+224 496
+224 504
+224 520
+224 536
+224 537
+224 542
+224 550
+224 554
+224 565
+224 569
+224 583
+224 593
+224 618
+224 679
+224 686
+224 693
+224 700
+224 701
+224 710
+224 719
+224 737
+224 781
+224 870
+224 894
+224 932
+224 946
+224 964
+224 976
+224 985
+224 991
+224 995
+224 1021
+225 282
+225 593
+226 86
+226 204
+226 235
+226 270
+226 279
+226 342
+226 344
+226 373
+226 536
+226 542
+226 611
+226 648
+226 679
+226 701
+226 897
+226 952
+227 131
+227 162
+227 679
+228 162
+228 175
+228 176
+228 197
+228 206
+228 279
+228 294
+228 312
+228 360
+228 435
+228 502
+228 536
+228 589
+228 596
+228 710
+228 765
+228 819
+228 822
+228 866
+228 869
+228 882
+228 946
+228 1006
+229 127
+229 162
+229 235
+229 398
+229 536
+230 49
+230 127
+230 279
+230 344
+230 496
+230 520
+230 536
+230 635
+230 763
+230 869
+230 966
+231 360
+231 380
+231 542
+231 565
+231 976
+232 412
+232 496
+232 532
+233 143
+233 252
+233 279
+233 360
+233 444
+233 538
+233 565
+233 701
+234 260
+234 270
+234 536
+234 542
+234 576
+235 2
+235 16
+235 22
+235 30
+235 40
+235 60
+235 72
+235 86
+235 103
+235 121
+235 140
+235 153
+235 155
+235 156
+235 159
+235 162
+235 164
+235 172
+235 178
+235 193
+235 205
+235 211
+235 217
+235 226
+235 229
+235 252
+235 260
+235 270
+235 278
+235 279
+235 282
+235 294
+235 299
+235 308
+235 312
+235 344
+235 348
+235 349
+235 360
+235 362
+235 367
+235 373
+235 375
+235 380
+235 427
+235 432
+235 435
+235 437
+235 449
+235 474
+235 479
+235 487
+235 496
+235 519
+235 520
+235 524
+235 536
+235 538
+235 541
+235 542
+235 563
+235 578
+235 583
+235 589
+235 591
+235 593
+235 600
+235 607
+235 618
+235 632
+235 655
+235 659
+235 669
+235 679
+235 692
+235 700
+235 710
+235 722
+235 733
+235 763
+235 765
+235 781
+235 787
+235 798
+235 826
+235 837
+235 838
+235 860
+235 862
+235 869
+235 873
+235 877
+235 881
+235 882
+235 894
+235 944
+235 946
+235 949
+235 976
+235 985
+235 986
+235 989
+235 995
+235 997
+235 1021
+236 270
+236 583
+236 772
+236 907
+237 205
+237 279
+237 822
+240 2
+240 53
+240 63
+240 86
+240 93
+240 117
+240 127
+240 136
+240 162
+240 164
+240 185
+240 197
+240 210
+240 250
+240 263
+240 270
+240 279
+240 282
+240 306
+240 312
+240 324
+240 326
+240 360
+240 376
+240 378
+240 380
+240 386
+240 391
+240 401
+240 407
+240 435
+240 437
+240 495
+240 496
+240 513
+240 520
+240 524
+240 526
+240 536
+240 542
+240 545
+240 563
+240 589
+240 614
+240 632
+240 654
+240 670
+240 679
+240 696
+240 706
+240 719
+240 739
+240 763
+240 779
+240 787
+240 791
+240 822
+240 911
+240 929
+240 982
+240 995
+241 206
+241 487
+241 496
+241 536
+242 60
+242 373
+242 510
+242 536
+242 679
+242 701
+242 791
+243 211
+243 260
+243 322
+243 530
+243 536
+243 763
+243 783
+243 787
+244 86
+244 140
+244 175
+244 196
+244 206
+244 269
+244 391
+244 435
+244 479
+244 536
+244 542
+244 632
+244 781
+244 826
+244 837
+244 946
+245 632
+246 43
+246 162
+246 536
+246 662
+246 721
+247 6
+247 22
+247 83
+247 106
+247 140
+247 153
+247 178
+247 197
+247 270
+247 360
+247 520
+247 536
+247 593
+247 605
+247 660
+247 679
+247 707
+247 780
+247 787
+247 822
+247 830
+247 869
+247 895
+247 913
+247 973
+248 117
+248 197
+248 344
+248 542
+248 655
+248 686
+248 717
+248 730
+248 1021
+249 2
+249 74
+249 86
+249 155
+249 632
+249 679
+249 966
+250 22
+250 86
+250 140
+250 155
+250 162
+250 164
+250 173
+250 178
+250 205
+250 206
+250 220
+250 240
+250 252
+250 270
+250 279
+250 282
+250 322
+250 345
+250 360
+250 373
+250 403
+250 422
+250 430
+250 536
+250 542
+250 563
+250 565
+250 579
+250 583
+250 589
+250 679
+250 687
+250 707
+250 742
+250 772
+250 800
+250 805
+250 822
+250 865
+250 869
+250 889
+250 894
+250 948
+250 976
+250 988
+250 995
+251 72
+251 117
+251 164
+251 206
+251 270
+251 360
+251 371
+251 373
+251 464
+251 533
+251 536
+251 568
+251 679
+251 686
+251 766
+251 772
+251 854
+251 986
+252 61
+252 72
+252 92
+252 131
+252 153
+252 155
+252 159
+252 162
+252 205
+252 233
+252 235
+252 250
+252 254
+252 265
+252 279
+252 299
+252 329
+252 344
+252 350
+252 360
+252 373
+252 375
+252 429
+252 450
+252 465
+252 483
+252 491
+252 530
+252 536
+252 542
+252 550
+252 569
+252 574
+252 583
+252 589
+252 593
+252 595
+252 610
+252 679
+252 686
+252 701
+252 704
+252 707
+252 710
+252 732
+252 763
+252 787
+252 822
+252 865
+252 873
+252 889
+252 905
+252 920
+252 923
+252 985
+252 997
+252 1000
+252 1018
+252 1019
+252 1021
+253 11
+253 312
+253 342
+253 403
+253 679
+253 693
+253 837
+254 252
+254 290
+254 579
+254 699
+254 701
+254 822
+254 1003
+254 1019
+256 2
+256 54
+256 131
+256 270
+256 273
+256 455
+256 483
+256 520
+256 536
+256 542
+256 589
+256 679
+256 739
+256 740
+256 856
+256 881
+256 1019
+257 260
+258 822
+259 27
+259 72
+259 279
+259 362
+259 539
+260 2
+260 8
+260 20
+260 22
+260 30
+260 39
+260 72
+260 80
+260 86
+260 106
+260 113
+260 117
+260 120
+260 127
+260 129
+260 136
+260 140
+260 153
+260 155
+260 156
+260 162
+260 170
+260 181
+260 197
+260 202
+260 205
+260 206
+260 209
+260 221
+260 234
+260 235
+260 243
+260 257
+260 270
+260 276
+260 278
+260 279
+260 299
+260 312
+260 322
+260 329
+260 342
+260 344
+260 345
+260 354
+260 360
+260 373
+260 380
+260 381
+260 391
+260 409
+260 413
+260 427
+260 444
+260 479
+260 487
+260 491
+260 495
+260 496
+260 497
+260 502
+260 511
+260 518
+260 519
+260 530
+260 532
+260 536
+260 542
+260 550
+260 564
+260 573
+260 578
+260 583
+260 593
+260 594
+260 601
+260 614
+260 633
+260 637
+260 641
+260 643
+260 644
+260 648
+260 655
+260 660
+260 662
+260 664
+260 667
+260 679
+260 684
+260 686
+260 688
+260 692
+260 700
+260 706
+260 707
+260 710
+260 712
+260 730
+260 737
+260 756
+260 763
+260 772
+260 779
+260 781
+260 784
+260 785
+260 809
+260 822
+260 826
+260 830
+260 836
+260 837
+260 840
+260 865
+260 874
+260 877
+260 878
+260 879
+260 882
+260 890
+260 894
+260 907
+260 947
+260 954
+260 976
+260 982
+260 995
+260 1003
+260 1010
+260 1021
+262 197
+262 206
+262 270
+262 536
+262 692
+263 131
+263 193
+263 205
+263 218
+263 224
+263 240
+263 701
+263 822
+263 946
+264 22
+264 60
+264 80
+264 104
+264 127
+264 140
+264 151
+264 156
+264 162
+264 172
+264 175
+264 178
+264 196
+264 279
+264 312
+264 320
+264 328
+264 344
+264 354
+264 360
+264 386
+264 427
+264 435
+264 471
+264 513
+264 520
+264 526
+264 536
+264 537
+264 542
+264 573
+264 610
+264 659
+264 679
+264 686
+264 710
+264 712
+264 787
+264 819
+264 822
+264 829
+264 869
+264 882
+264 887
+264 894
+264 905
+264 913
+264 929
+264 990
+265 9
+265 40
+265 72
+265 86
+265 155
+265 159
+265 162
+265 205
+265 252
+265 270
+265 279
+265 290
+265 299
+265 302
+265 360
+265 366
+265 373
+265 391
+265 437
+265 450
+265 453
+265 496
+265 520
+265 536
+265 545
+265 578
+265 579
+265 583
+265 591
+265 607
+265 632
+265 633
+265 647
+265 664
+265 687
+265 693
+265 707
+265 710
+265 725
+265 763
+265 801
+265 822
+265 826
+265 829
+265 830
+265 865
+265 869
+265 881
+265 882
+265 907
+265 927
+265 995
+265 1021
+266 72
+266 86
+266 127
+266 155
+266 162
+266 302
+266 354
+266 367
+266 382
+266 487
+266 536
+266 589
+266 655
+266 777
+266 805
+266 826
+266 995
+266 1021
+267 2
+267 6
+267 22
+267 83
+267 86
+267 127
+267 155
+267 162
+267 178
+267 193
+267 219
+267 270
+267 278
+267 279
+267 302
+267 333
+267 344
+267 360
+267 366
+267 373
+267 380
+267 403
+267 435
+267 479
+267 487
+267 496
+267 503
+267 536
+267 538
+267 539
+267 542
+267 550
+267 563
+267 574
+267 578
+267 583
+267 593
+267 626
+267 629
+267 655
+267 679
+267 692
+267 724
+267 763
+267 781
+267 822
+267 826
+267 829
+267 845
+267 846
+267 875
+267 876
+267 882
+267 921
+267 930
+267 976
+267 1004
+269 22
+269 72
+269 86
+269 151
+269 244
+269 279
+269 360
+269 373
+269 391
+269 442
+269 479
+269 496
+269 541
+269 542
+269 740
+269 862
+269 882
+269 966
+270 2
+270 4
+270 5
+270 6
+270 9
+270 10
+270 22
+270 49
+270 50
+270 53
+270 54
+270 60
+270 62
+270 66
+270 72
+270 79
+270 83
+270 86
+270 91
+270 92
+270 104
+270 106
+270 112
+270 115
+270 117
+270 120
+270 123
+270 125
+270 127
+270 128
+270 131
+270 136
+270 137
+270 140
+270 142
+270 143
+270 148
+270 153
+270 155
+270 156
+270 158
+270 161
+270 162
+270 164
+270 172
+270 174
+270 175
+270 176
+270 178
+270 181
+270 189
+270 193
+270 195
+270 197
+270 202
+270 204
+270 205
+270 206
+270 211
+270 215
+270 222
+270 226
+270 234
+270 235
+270 236
+270 240
+270 247
+270 250
+270 251
+270 256
+270 260
+270 262
+270 265
+270 267
+270 278
+270 279
+270 282
+270 283
+270 286
+270 289
+270 290
+270 294
+270 299
+270 302
+270 306
+270 312
+270 317
+270 318
+270 322
+270 324
+270 329
+270 330
+270 342
+270 344
+270 352
+270 354
+270 359
+270 360
+270 362
+270 366
+270 373
+270 377
+270 378
+270 379
+270 382
+270 386
+270 387
+270 391
+270 398
+270 403
+270 405
+270 410
+270 413
+270 414
+270 423
+270 427
+270 435
+270 436
+270 437
+270 448
+270 452
+270 455
+270 458
+270 461
+270 479
+270 483
+270 487
+270 490
+270 495
+270 496
+270 502
+270 513
+270 520
+270 524
+270 526
+270 532
+270 533
+270 536
+270 538
+270 539
+270 541
+270 542
+270 543
+270 549
+270 554
+270 558
+270 563
+270 569
+270 577
+270 578
+270 579
+270 581
+270 583
+270 588
+270 589
+270 591
+270 593
+270 610
+270 611
+270 614
+270 629
+270 632
+270 633
+270 637
+270 641
+270 646
+270 648
+270 655
+270 661
+270 662
+270 664
+270 676
+270 679
+270 680
+270 685
+270 686
+270 687
+270 692
+270 696
+270 698
+270 700
+270 701
+270 704
+270 706
+270 709
+270 710
+270 720
+270 726
+270 730
+270 733
+270 737
+270 739
+270 740
+270 747
+270 758
+270 763
+270 765
+270 766
+270 768
+270 772
+270 777
+270 781
+270 785
+270 786
+270 787
+270 790
+270 791
+270 796
+270 798
+270 801
+270 809
+270 811
+270 819
+270 822
+270 826
+270 829
+270 830
+270 837
+270 838
+270 840
+270 841
+270 847
+270 862
+270 865
+270 869
+270 873
+270 877
+270 878
+270 880
+270 881
+270 882
+270 884
+270 886
+270 889
+270 891
+270 894
+270 901
+270 903
+270 907
+270 919
+270 921
+270 923
+270 928
+270 929
+270 943
+270 946
+270 947
+270 948
+270 954
+270 964
+270 966
+270 976
+270 986
+270 991
+270 994
+270 995
+270 997
+270 999
+270 1000
+270 1003
+270 1004
+270 1008
+270 1010
+270 1019
+270 1021
+271 282
+271 822
+272 398
+272 811
+272 1010
+273 1
+273 86
+273 155
+273 162
+273 164
+273 256
+273 278
+273 373
+273 496
+273 536
+273 542
+273 593
+273 594
+273 632
+273 633
+273 679
+273 700
+273 787
+273 875
+273 889
+273 995
+274 496
+276 2
+276 22
+276 30
+276 72
+276 86
+276 162
+276 193
+276 260
+276 282
+276 294
+276 360
+276 373
+276 378
+276 435
+276 520
+276 524
+276 536
+276 583
+276 662
+276 675
+276 679
+276 730
+276 822
+276 869
+277 64
+277 117
+277 479
+277 536
+277 542
+277 593
+277 822
+277 877
+278 26
+278 86
+278 117
+278 137
+278 143
+278 155
+278 162
+278 187
+278 204
+278 235
+278 260
+278 267
+278 270
+278 273
+278 324
+278 329
+278 344
+278 360
+278 373
+278 409
+278 416
+278 435
+278 454
+278 461
+278 487
+278 490
+278 496
+278 520
+278 524
+278 536
+278 542
+278 565
+278 589
+278 601
+278 614
+278 632
+278 686
+278 704
+278 706
+278 707
+278 712
+278 733
+278 781
+278 787
+278 822
+278 867
+278 882
+278 907
+278 915
+278 946
+278 966
+278 978
+278 982
+279 2
+279 4
+279 7
+279 9
+279 11
+279 22
+279 27
+279 35
+279 39
+279 49
+279 53
+279 60
+279 72
+279 79
+279 80
+279 83
+279 86
+279 92
+279 93
+279 96
+279 97
+279 101
+279 102
+279 103
+279 109
+279 115
+279 117
+279 127
+279 131
+279 133
+279 136
+279 140
+279 143
+279 150
+279 153
+279 155
+279 156
+279 159
+279 162
+279 164
+279 165
+279 166
+279 172
+279 175
+279 193
+279 195
+279 205
+279 206
+279 209
+279 217
+279 226
+279 228
+279 230
+279 233
+279 235
+279 237
+279 240
+279 250
+279 252
+279 259
+279 260
+279 264
+279 265
+279 267
+279 269
+279 270
+279 282
+279 289
+279 290
+279 294
+279 299
+279 301
+279 312
+279 313
+279 317
+279 322
+279 324
+279 326
+279 329
+279 330
+279 332
+279 334
+279 339
+279 342
+279 344
+279 349
+279 352
+279 354
+279 360
+279 362
+279 367
+279 373
+279 376
+279 377
+279 379
+279 380
+279 382
+279 386
+279 391
+279 399
+279 403
+279 405
+279 409
+279 412
+279 413
+279 427
+279 429
+279 435
+279 437
+279 441
+279 448
+279 449
+279 451
+279 455
+279 461
+279 465
+279 472
+279 474
+279 475
+279 479
+279 487
+279 491
+279 494
+279 495
+279 496
+279 502
+279 504
+279 509
+279 510
+279 519
+279 520
+279 524
+279 530
+279 532
+279 533
+279 536
+279 537
+279 538
+279 539
+279 541
+279 542
+279 550
+279 552
+279 562
+279 563
+279 564
+279 565
+279 573
+279 574
+279 575
+279 578
+279 579
+279 581
+279 583
+279 589
+279 593
+279 596
+279 605
+279 606
+279 610
+279 611
+279 614
+279 615
+279 618
+279 632
+279 638
+279 648
+279 655
+279 659
+279 662
+279 664
+279 670
+279 675
+279 676
+279 678
+279 679
+279 686
+279 692
+279 693
+279 696
+279 700
+279 701
+279 706
+279 707
+279 710
+279 714
+279 719
+279 722
+279 725
+279 727
+279 730
+279 732
+279 733
+279 739
+279 740
+279 742
+279 756
+279 763
+279 765
+279 770
+279 772
+279 774
+279 777
+279 778
+279 779
+279 781
+279 784
+279 787
+279 791
+279 798
+279 800
+279 801
+279 805
+279 808
+279 809
+279 813
+279 816
+279 822
+279 826
+279 829
+279 837
+279 838
+279 848
+279 853
+279 865
+279 868
+279 869
+279 870
+279 875
+279 877
+279 879
+279 881
+279 882
+279 883
+279 884
+279 890
+279 891
+279 894
+279 900
+279 905
+279 907
+279 923
+279 937
+279 946
+279 947
+279 949
+279 966
+279 970
+279 971
+279 976
+279 982
+279 985
+279 986
+279 989
+279 990
+279 995
+279 1003
+279 1004
+279 1005
+279 1010
+279 1019
+279 1021
+280 93
+280 193
+280 464
+280 679
+280 717
+280 800
+280 822
+280 946
+281 30
+281 520
+281 542
+281 756
+282 39
+282 50
+282 53
+282 59
+282 72
+282 83
+282 86
+282 98
+282 136
+282 140
+282 143
+282 151
+282 153
+282 155
+282 159
+282 162
+282 164
+282 172
+282 176
+282 205
+282 206
+282 209
+282 225
+282 235
+282 240
+282 250
+282 270
+282 271
+282 276
+282 279
+282 294
+282 307
+282 312
+282 327
+282 329
+282 330
+282 342
+282 344
+282 354
+282 360
+282 364
+282 373
+282 374
+282 391
+282 409
+282 435
+282 437
+282 454
+282 458
+282 461
+282 476
+282 479
+282 487
+282 495
+282 496
+282 504
+282 520
+282 524
+282 532
+282 536
+282 542
+282 569
+282 578
+282 579
+282 583
+282 585
+282 589
+282 591
+282 593
+282 611
+282 623
+282 626
+282 632
+282 633
+282 634
+282 637
+282 679
+282 686
+282 687
+282 688
+282 696
+282 700
+282 701
+282 706
+282 710
+282 730
+282 739
+282 759
+282 781
+282 787
+282 808
+282 816
+282 822
+282 826
+282 837
+282 838
+282 857
+282 869
+282 870
+282 877
+282 882
+282 891
+282 894
+282 905
+282 919
+282 946
+282 976
+282 986
+282 989
+282 1021
+283 2
+283 92
+283 117
+283 270
+283 373
+283 536
+283 542
+283 550
+283 589
+283 593
+283 632
+283 654
+283 692
+283 693
+283 706
+283 780
+283 787
+283 826
+283 946
+284 610
+285 536
+285 563
+285 611
+285 730
+285 822
+285 882
+286 86
+286 270
+286 391
+286 401
+287 464
+288 197
+288 312
+288 354
+288 360
+288 391
+288 435
+288 454
+288 479
+288 491
+288 536
+288 593
+288 648
+288 706
+288 763
+288 787
+288 865
+289 2
+289 91
+289 127
+289 205
+289 222
+289 270
+289 279
+289 339
+289 352
+289 362
+289 386
+289 479
+289 491
+289 496
+289 520
+289 536
+289 542
+289 574
+289 622
+289 707
+289 730
+289 772
+289 811
+289 812
+289 822
+289 826
+289 907
+289 999
+289 1021
+290 86
+290 127
+290 151
+290 153
+290 162
+290 174
+290 197
+290 205
+290 206
+290 254
+290 265
+290 270
+290 279
+290 312
+290 329
+290 349
+290 360
+290 391
+290 427
+290 432
+290 455
+290 532
+290 536
+290 538
+290 539
+290 542
+290 564
+290 589
+290 591
+290 686
+290 700
+290 724
+290 730
+290 740
+290 765
+290 791
+290 811
+290 822
+290 826
+290 881
+290 882
+290 883
+290 905
+290 919
+290 976
+290 1004
+290 1021
+291 894
+293 2
+293 117
+293 327
+293 380
+293 536
+293 594
+293 633
+293 707
+294 16
+294 22
+294 72
+294 86
+294 120
+294 127
+294 131
+294 162
+294 172
+294 193
+294 197
+294 211
+294 224
+294 228
+294 235
+294 270
+294 276
+294 279
+294 282
+294 299
+294 326
+294 329
+294 344
+294 349
+294 360
+294 367
+294 373
+294 386
+294 461
+294 474
+294 479
+294 491
+294 524
+294 536
+294 538
+294 578
+294 588
+294 594
+294 606
+294 633
+294 686
+294 714
+294 781
+294 787
+294 800
+294 803
+294 805
+294 869
+294 877
+294 881
+294 883
+294 891
+294 923
+294 925
+294 946
+294 955
+294 971
+294 976
+294 993
+294 1010
+294 1019
+294 1021
+295 162
+295 435
+295 947
+296 686
+296 766
+296 882
+298 354
+299 83
+299 86
+299 117
+299 145
+299 164
+299 196
+299 204
+299 205
+299 235
+299 252
+299 260
+299 265
+299 270
+299 279
+299 294
+299 349
+299 354
+299 367
+299 370
+299 373
+299 386
+299 398
+299 435
+299 447
+299 465
+299 520
+299 536
+299 573
+299 583
+299 609
+299 661
+299 701
+299 707
+299 710
+299 722
+299 739
+299 763
+299 781
+299 790
+299 800
+299 822
+299 882
+299 889
+299 898
+299 946
+299 976
+299 995
+299 1010
+300 205
+300 513
+300 717
+300 822
+301 279
+301 520
+301 536
+301 679
+301 769
+301 907
+302 2
+302 60
+302 127
+302 155
+302 265
+302 266
+302 267
+302 270
+302 360
+302 415
+302 495
+302 496
+302 536
+302 537
+302 539
+302 542
+302 589
+302 618
+302 633
+302 651
+302 655
+302 701
+302 886
+302 995
+302 1019
+303 224
+303 496
+303 536
+303 686
+303 730
+303 995
+304 162
+304 312
+304 360
+304 494
+304 495
+304 717
+304 822
+305 26
+305 86
+305 509
+305 519
+305 655
+305 704
+305 750
+305 787
+306 72
+306 162
+306 181
+306 191
+306 217
+306 240
+306 270
+306 329
+306 360
+306 373
+306 633
+306 662
+306 706
+306 733
+306 822
+306 896
+306 971
+307 30
+307 74
+307 282
+307 319
+307 322
+307 324
+307 342
+307 360
+307 536
+307 588
+307 593
+307 659
+307 666
+307 679
+307 763
+307 774
+307 830
+307 865
+307 910
+307 913
+307 995
+308 72
+308 111
+308 117
+308 137
+308 235
+308 313
+308 367
+308 373
+308 496
+308 526
+308 536
+308 538
+308 627
+308 706
+308 778
+308 781
+308 819
+308 838
+308 882
+308 886
+308 920
+308 966
+308 971
+310 496
+310 536
+310 542
+310 838
+311 117
+311 140
+311 162
+311 329
+311 496
+311 536
+311 662
+311 679
+312 2
+312 20
+312 22
+312 30
+312 35
+312 49
+312 60
+312 64
+312 72
+312 83
+312 86
+312 91
+312 97
+312 106
+312 109
+312 120
+312 129
+312 131
+312 137
+312 162
+312 164
+312 173
+312 175
+312 201
+312 205
+312 206
+312 209
+312 228
+312 235
+312 240
+312 253
+312 260
+312 264
+312 270
+312 279
+312 282
+312 288
+312 290
+312 304
+312 324
+312 345
+312 358
+312 360
+312 362
+312 373
+312 377
+312 378
+312 380
+312 386
+312 391
+312 413
+312 416
+312 437
+312 442
+312 445
+312 458
+312 479
+312 487
+312 491
+312 496
+312 520
+312 526
+312 530
+312 536
+312 539
+312 542
+312 556
+312 574
+312 577
+312 578
+312 579
+312 583
+312 585
+312 588
+312 593
+312 608
+312 611
+312 614
+312 615
+312 632
+312 633
+312 639
+312 648
+312 652
+312 659
+312 661
+312 662
+312 679
+312 686
+312 693
+312 696
+312 700
+312 710
+312 717
+312 730
+312 733
+312 751
+312 763
+312 765
+312 778
+312 781
+312 783
+312 791
+312 798
+312 805
+312 816
+312 822
+312 838
+312 841
+312 869
+312 878
+312 882
+312 883
+312 888
+312 891
+312 894
+312 898
+312 903
+312 907
+312 925
+312 929
+312 932
+312 939
+312 941
+312 946
+312 967
+312 971
+312 976
+312 982
+312 995
+312 999
+312 1019
+312 1021
+313 279
+313 308
+313 373
+313 386
+313 520
+313 536
+313 693
+313 706
+313 708
+313 787
+313 798
+313 813
+313 894
+314 80
+314 155
+314 206
+314 403
+314 496
+315 496
+316 679
+316 739
+317 127
+317 164
+317 178
+317 270
+317 279
+317 344
+317 536
+317 541
+317 589
+317 699
+317 710
+317 781
+317 822
+317 826
+317 859
+317 947
+317 1021
+318 22
+318 30
+318 162
+318 164
+318 270
+318 324
+318 360
+318 366
+318 536
+318 659
+318 701
+318 853
+318 946
+318 1021
+319 2
+319 22
+319 100
+319 117
+319 307
+319 366
+319 496
+319 533
+319 536
+319 589
+319 621
+319 700
+319 740
+319 755
+319 781
+319 822
+319 880
+319 926
+319 1010
+320 72
+320 264
+321 526
+321 539
+321 894
+321 913
+322 30
+322 53
+322 72
+322 117
+322 120
+322 127
+322 140
+322 155
+322 175
+322 206
+322 243
+322 250
+322 260
+322 270
+322 279
+322 307
+322 360
+322 362
+322 367
+322 391
+322 433
+322 479
+322 496
+322 498
+322 524
+322 530
+322 536
+322 568
+322 583
+322 589
+322 599
+322 679
+322 700
+322 706
+322 712
+322 721
+322 742
+322 746
+322 763
+322 782
+322 790
+322 798
+322 803
+322 805
+322 819
+322 853
+322 869
+322 879
+322 882
+322 976
+322 982
+322 995
+323 382
+323 822
+324 10
+324 72
+324 83
+324 86
+324 127
+324 140
+324 155
+324 158
+324 159
+324 162
+324 186
+324 197
+324 206
+324 211
+324 217
+324 219
+324 240
+324 270
+324 278
+324 279
+324 307
+324 312
+324 318
+324 326
+324 344
+324 354
+324 360
+324 367
+324 373
+324 402
+324 479
+324 494
+324 526
+324 530
+324 536
+324 539
+324 578
+324 589
+324 610
+324 632
+324 679
+324 701
+324 706
+324 740
+324 790
+324 791
+324 822
+324 837
+324 865
+324 918
+324 946
+324 947
+324 992
+324 995
+324 1004
+324 1013
+324 1019
+325 605
+326 20
+326 86
+326 197
+326 211
+326 240
+326 279
+326 294
+326 324
+326 373
+326 435
+326 536
+326 538
+326 542
+326 679
+326 773
+326 798
+326 809
+326 822
+326 905
+326 1019
+327 72
+327 80
+327 97
+327 143
+327 198
+327 282
+327 293
+327 342
+327 513
+327 687
+327 706
+327 730
+327 781
+327 787
+327 826
+327 829
+327 1004
+327 1013
+328 39
+328 264
+328 634
+328 701
+329 2
+329 5
+329 22
+329 30
+329 43
+329 51
+329 53
+329 54
+329 72
+329 86
+329 102
+329 111
+329 117
+329 127
+329 143
+329 156
+329 162
+329 164
+329 175
+329 177
+329 180
+329 181
+329 201
+329 205
+329 206
+329 212
+329 252
+329 260
+329 270
+329 278
+329 279
+329 282
+329 290
+329 294
+329 306
+329 311
+329 339
+329 344
+329 348
+329 350
+329 360
+329 370
+329 373
+329 386
+329 391
+329 403
+329 409
+329 435
+329 436
+329 447
+329 454
+329 455
+329 461
+329 479
+329 483
+329 496
+329 498
+329 513
+329 520
+329 521
+329 536
+329 542
+329 565
+329 574
+329 578
+329 579
+329 589
+329 593
+329 606
+329 611
+329 618
+329 629
+329 632
+329 635
+329 655
+329 661
+329 679
+329 686
+329 700
+329 701
+329 707
+329 710
+329 714
+329 720
+329 730
+329 751
+329 763
+329 776
+329 787
+329 791
+329 822
+329 826
+329 831
+329 838
+329 841
+329 847
+329 873
+329 877
+329 880
+329 883
+329 891
+329 894
+329 913
+329 923
+329 929
+329 939
+329 946
+329 966
+329 985
+329 995
+329 1000
+329 1010
+329 1019
+329 1021
+330 2
+330 22
+330 26
+330 53
+330 67
+330 153
+330 155
+330 159
+330 162
+330 164
+330 176
+330 204
+330 270
+330 279
+330 282
+330 344
+330 375
+330 403
+330 496
+330 524
+330 536
+330 542
+330 569
+330 573
+330 622
+330 644
+330 646
+330 660
+330 679
+330 686
+330 692
+330 717
+330 733
+330 740
+330 781
+330 822
+330 881
+330 946
+330 948
+330 979
+330 994
+330 995
+330 1021
+332 279
+332 512
+333 2
+333 267
+333 536
+333 730
+333 733
+334 86
+334 279
+334 360
+334 498
+334 536
+334 578
+334 686
+335 679
+336 153
+336 367
+336 633
+336 914
+336 954
+338 373
+338 536
+338 578
+338 791
+338 822
+338 826
+339 2
+339 22
+339 26
+339 53
+339 62
+339 63
+339 72
+339 74
+339 86
+339 117
+339 127
+339 131
+339 155
+339 162
+339 191
+339 205
+339 206
+339 211
+339 279
+339 289
+339 329
+339 342
+339 354
+339 360
+339 362
+339 398
+339 405
+339 409
+339 436
+339 495
+339 524
+339 536
+339 562
+339 568
+339 573
+339 581
+339 589
+339 591
+339 593
+339 606
+339 618
+339 632
+339 676
+339 679
+339 692
+339 765
+339 798
+339 822
+339 826
+339 839
+339 848
+339 873
+339 882
+339 964
+339 985
+339 990
+339 1003
+339 1019
+339 1021
+340 22
+340 162
+340 360
+340 563
+340 763
+340 954
+341 206
+341 360
+342 22
+342 59
+342 72
+342 113
+342 117
+342 127
+342 136
+342 143
+342 156
+342 162
+342 202
+342 217
+342 226
+342 253
+342 260
+342 270
+342 279
+342 282
+342 307
+342 327
+342 339
+342 344
+342 349
+342 391
+342 411
+342 427
+342 435
+342 442
+342 461
+342 463
+342 471
+342 479
+342 491
+342 496
+342 520
+342 533
+342 536
+342 539
+342 545
+342 564
+342 579
+342 583
+342 635
+342 657
+342 664
+342 686
+342 706
+342 717
+342 774
+342 781
+342 803
+342 826
+342 837
+342 869
+342 891
+342 905
+342 946
+342 976
+342 995
+342 1021
+343 91
+344 2
+344 7
+344 9
+344 22
+344 61
+344 66
+344 83
+344 86
+344 106
+344 117
+344 126
+344 127
+344 153
+344 155
+344 156
+344 158
+344 162
+344 169
+344 178
+344 181
+344 197
+344 205
+344 206
+344 211
+344 226
+344 230
+344 235
+344 248
+344 252
+344 260
+344 264
+344 267
+344 270
+344 278
+344 279
+344 282
+344 294
+344 317
+344 324
+344 329
+344 330
+344 342
+344 349
+344 354
+344 360
+344 366
+344 367
+344 373
+344 382
+344 391
+344 403
+344 413
+344 432
+344 433
+344 443
+344 448
+344 464
+344 465
+344 474
+344 476
+344 489
+344 491
+344 496
+344 503
+344 510
+344 520
+344 524
+344 536
+344 542
+344 552
+344 556
+344 562
+344 563
+344 568
+344 571
+344 574
+344 579
+344 589
+344 593
+344 594
+344 610
+344 614
+344 632
+344 633
+344 647
+344 648
+344 654
+344 655
+344 659
+344 662
+344 677
+344 679
+344 686
+344 687
+344 692
+344 693
+344 696
+344 701
+344 707
+344 710
+344 713
+344 722
+344 730
+344 732
+344 737
+344 740
+344 748
+344 756
+344 763
+344 765
+344 769
+344 781
+344 787
+344 819
+344 822
+344 824
+344 826
+344 829
+344 865
+344 869
+344 877
+344 879
+344 882
+344 891
+344 894
+344 907
+344 919
+344 929
+344 932
+344 946
+344 966
+344 976
+344 979
+344 986
+344 991
+344 995
+344 997
+344 1003
+345 80
+345 86
+345 127
+345 131
+345 162
+345 250
+345 260
+345 312
+345 435
+345 437
+345 536
+345 589
+345 644
+345 679
+345 729
+345 822
+345 826
+345 829
+345 869
+346 826
+348 74
+348 111
+348 162
+348 235
+348 329
+348 496
+348 524
+348 536
+348 542
+348 591
+348 615
+348 791
+348 808
+348 822
+348 882
+348 923
+348 985
+349 22
+349 54
+349 121
+349 127
+349 143
+349 235
+349 279
+349 290
+349 294
+349 299
+349 342
+349 344
+349 360
+349 373
+349 380
+349 409
+349 417
+349 496
+349 536
+349 573
+349 583
+349 633
+349 679
+349 701
+349 706
+349 714
+349 772
+349 798
+349 822
+349 894
+349 946
+349 982
+349 985
+349 1003
+350 86
+350 140
+350 173
+350 252
+350 329
+350 360
+350 524
+350 573
+350 589
+350 621
+350 679
+350 701
+350 706
+350 707
+350 822
+350 879
+350 894
+350 926
+350 1006
+350 1021
+351 211
+351 436
+351 562
+351 629
+351 707
+351 732
+351 903
+351 908
+351 976
+351 1003
+352 2
+352 72
+352 83
+352 86
+352 164
+352 206
+352 270
+352 279
+352 289
+352 367
+352 373
+352 421
+352 444
+352 536
+352 538
+352 589
+352 664
+352 707
+352 710
+352 756
+352 777
+352 869
+352 982
+352 999
+353 2
+353 117
+353 162
+353 197
+353 205
+353 373
+353 475
+353 513
+353 536
+353 578
+353 579
+353 593
+353 679
+353 701
+353 713
+353 782
+353 787
+353 819
+353 922
+353 1019
+354 63
+354 72
+354 83
+354 86
+354 109
+354 115
+354 127
+354 141
+354 158
+354 164
+354 197
+354 219
+354 260
+354 264
+354 266
+354 270
+354 279
+354 282
+354 288
+354 298
+354 299
+354 324
+354 339
+354 344
+354 367
+354 373
+354 380
+354 479
+354 496
+354 504
+354 513
+354 539
+354 570
+354 578
+354 583
+354 591
+354 593
+354 632
+354 648
+354 667
+354 679
+354 698
+354 707
+354 710
+354 717
+354 740
+354 787
+354 791
+354 822
+354 826
+354 829
+354 881
+354 894
+354 905
+354 908
+354 932
+354 985
+357 80
+357 86
+357 205
+358 175
+358 197
+358 312
+358 484
+358 536
+358 568
+358 618
+358 663
+358 679
+358 686
+358 869
+358 995
+359 270
+360 2
+360 6
+360 16
+360 19
+360 22
+360 27
+360 30
+360 31
+360 39
+360 44
+360 53
+360 54
+360 57
+360 59
+360 62
+360 63
+360 72
+360 83
+360 86
+360 102
+360 106
+360 110
+360 112
+360 113
+360 117
+360 121
+360 125
+360 126
+360 127
+360 130
+360 131
+360 136
+360 137
+360 140
+360 141
+360 145
+360 150
+360 155
+360 158
+360 159
+360 162
+360 164
+360 167
+360 177
+360 181
+360 189
+360 191
+360 193
+360 197
+360 202
+360 205
+360 206
+360 211
+360 218
+360 224
+360 228
+360 231
+360 233
+360 235
+360 240
+360 247
+360 250
+360 251
+360 252
+360 260
+360 264
+360 265
+360 267
+360 269
+360 270
+360 276
+360 278
+360 279
+360 282
+360 288
+360 290
+360 294
+360 302
+360 304
+360 306
+360 307
+360 312
+360 318
+360 322
+360 324
+360 329
+360 334
+360 339
+360 340
+360 341
+360 344
+360 349
+360 350
+360 366
+360 372
+360 373
+360 380
+360 386
+360 391
+360 397
+360 403
+360 410
+360 412
+360 413
+360 417
+360 421
+360 432
+360 435
+360 436
+360 443
+360 444
+360 458
+360 461
+360 471
+360 474
+360 485
+360 491
+360 496
+360 502
+360 503
+360 508
+360 510
+360 513
+360 520
+360 524
+360 526
+360 530
+360 532
+360 533
+360 536
+360 537
+360 538
+360 539
+360 542
+360 545
+360 549
+360 550
+360 554
+360 555
+360 560
+360 562
+360 563
+360 565
+360 569
+360 571
+360 573
+360 574
+360 579
+360 583
+360 589
+360 591
+360 593
+360 594
+360 595
+360 599
+360 605
+360 606
+360 610
+360 615
+360 629
+360 632
+360 633
+360 634
+360 635
+360 636
+360 637
+360 641
+360 647
+360 648
+360 650
+360 652
+360 655
+360 659
+360 662
+360 675
+360 677
+360 678
+360 679
+360 684
+360 686
+360 687
+360 688
+360 692
+360 700
+360 701
+360 706
+360 707
+360 710
+360 713
+360 717
+360 720
+360 724
+360 730
+360 733
+360 740
+360 742
+360 751
+360 763
+360 765
+360 768
+360 771
+360 772
+360 774
+360 779
+360 781
+360 785
+360 787
+360 796
+360 798
+360 800
+360 802
+360 803
+360 813
+360 819
+360 822
+360 823
+360 826
+360 837
+360 838
+360 841
+360 844
+360 854
+360 862
+360 865
+360 869
+360 870
+360 873
+360 876
+360 877
+360 880
+360 882
+360 883
+360 894
+360 905
+360 907
+360 913
+360 919
+360 923
+360 925
+360 926
+360 929
+360 939
+360 946
+360 954
+360 970
+360 971
+360 976
+360 985
+360 986
+360 989
+360 992
+360 994
+360 995
+360 1003
+360 1010
+360 1013
+360 1019
+360 1021
+360 1023
+361 1021
+362 2
+362 22
+362 72
+362 86
+362 113
+362 155
+362 156
+362 158
+362 159
+362 181
+362 205
+362 235
+362 259
+362 270
+362 279
+362 289
+362 312
+362 322
+362 339
+362 370
+362 373
+362 391
+362 437
+362 464
+362 495
+362 532
+362 536
+362 564
+362 574
+362 589
+362 657
+362 679
+362 701
+362 710
+362 763
+362 765
+362 781
+362 791
+362 805
+362 812
+362 822
+362 829
+362 830
+362 865
+362 891
+362 894
+362 919
+362 946
+362 948
+362 982
+362 999
+362 1000
+362 1015
+364 86
+364 162
+364 282
+364 373
+364 391
+364 502
+364 533
+364 577
+365 779
+366 26
+366 86
+366 111
+366 136
+366 150
+366 155
+366 156
+366 162
+366 193
+366 197
+366 206
+366 265
+366 267
+366 270
+366 318
+366 319
+366 344
+366 360
+366 435
+366 437
+366 495
+366 498
+366 514
+366 520
+366 533
+366 536
+366 545
+366 563
+366 578
+366 589
+366 591
+366 593
+366 594
+366 644
+366 655
+366 662
+366 664
+366 679
+366 687
+366 696
+366 714
+366 763
+366 787
+366 803
+366 822
+366 854
+366 877
+366 882
+366 894
+366 946
+366 966
+366 985
+366 1021
+367 26
+367 30
+367 79
+367 86
+367 162
+367 164
+367 185
+367 235
+367 266
+367 279
+367 294
+367 299
+367 308
+367 322
+367 324
+367 336
+367 344
+367 352
+367 354
+367 373
+367 398
+367 474
+367 479
+367 496
+367 524
+367 526
+367 533
+367 536
+367 538
+367 539
+367 542
+367 543
+367 563
+367 591
+367 610
+367 614
+367 629
+367 633
+367 648
+367 679
+367 687
+367 688
+367 692
+367 706
+367 707
+367 710
+367 730
+367 733
+367 756
+367 772
+367 782
+367 822
+367 826
+367 882
+367 946
+367 963
+367 1008
+368 97
+368 679
+370 26
+370 60
+370 162
+370 206
+370 299
+370 329
+370 362
+370 375
+370 538
+370 542
+370 679
+370 781
+370 798
+370 822
+370 1019
+371 251
+371 496
+372 43
+372 86
+372 127
+372 155
+372 162
+372 178
+372 360
+372 373
+372 479
+372 502
+372 536
+372 583
+372 593
+372 706
+372 765
+372 787
+372 894
+373 2
+373 4
+373 6
+373 22
+373 24
+373 30
+373 40
+373 45
+373 59
+373 60
+373 70
+373 72
+373 74
+373 80
+373 83
+373 86
+373 92
+373 93
+373 97
+373 100
+373 103
+373 106
+373 109
+373 112
+373 117
+373 120
+373 121
+373 127
+373 131
+373 133
+373 136
+373 138
+373 140
+373 143
+373 148
+373 150
+373 155
+373 156
+373 158
+373 159
+373 161
+373 162
+373 164
+373 167
+373 172
+373 177
+373 178
+373 181
+373 185
+373 195
+373 197
+373 201
+373 205
+373 206
+373 208
+373 209
+373 211
+373 216
+373 217
+373 224
+373 226
+373 235
+373 242
+373 250
+373 251
+373 252
+373 260
+373 265
+373 267
+373 269
+373 270
+373 273
+373 276
+373 278
+373 279
+373 282
+373 283
+373 294
+373 299
+373 306
+373 308
+373 312
+373 313
+373 324
+373 326
+373 329
+373 338
+373 344
+373 349
+373 352
+373 353
+373 354
+373 360
+373 362
+373 364
+373 367
+373 372
+373 375
+373 378
+373 380
+373 391
+373 398
+373 403
+373 405
+373 409
+373 412
+373 422
+373 427
+373 431
+373 435
+373 437
+373 442
+373 450
+373 453
+373 458
+373 459
+373 461
+373 465
+373 471
+373 479
+373 483
+373 487
+373 491
+373 496
+373 498
+373 503
+373 509
+373 510
+373 512
+373 513
+373 518
+373 520
+373 524
+373 532
+373 536
+373 537
+373 539
+373 542
+373 543
+373 546
+373 549
+373 550
+373 554
+373 559
+373 562
+373 565
+373 569
+373 574
+373 578
+373 579
+373 583
+373 588
+373 589
+373 591
+373 593
+373 594
+373 596
+373 599
+373 604
+373 611
+373 614
+373 618
+373 620
+373 622
+373 632
+373 633
+373 634
+373 635
+373 637
+373 644
+373 650
+373 654
+373 655
+373 659
+373 662
+373 664
+373 665
+373 670
+373 679
+373 686
+373 687
+373 692
+373 693
+373 696
+373 698
+373 699
+373 700
+373 701
+373 706
+373 707
+373 710
+373 717
+373 719
+373 725
+373 726
+373 730
+373 739
+373 740
+373 747
+373 750
+373 751
+373 756
+373 763
+373 765
+373 772
+373 781
+373 782
+373 787
+373 788
+373 791
+373 798
+373 800
+373 803
+373 809
+373 812
+373 819
+373 822
+373 829
+373 837
+373 838
+373 840
+373 846
+373 860
+373 865
+373 869
+373 877
+373 880
+373 882
+373 885
+373 889
+373 890
+373 891
+373 894
+373 896
+373 898
+373 903
+373 905
+373 919
+373 921
+373 923
+373 929
+373 934
+373 944
+373 946
+373 948
+373 950
+373 976
+373 982
+373 985
+373 986
+373 989
+373 991
+373 992
+373 994
+373 995
+373 997
+373 1000
+373 1002
+373 1003
+373 1010
+373 1021
+374 2
+374 136
+374 197
+374 205
+374 206
+374 282
+374 494
+374 536
+374 542
+374 583
+374 710
+374 894
+374 966
+375 26
+375 35
+375 53
+375 65
+375 83
+375 86
+375 145
+375 235
+375 252
+375 330
+375 370
+375 373
+375 423
+375 445
+375 491
+375 496
+375 517
+375 524
+375 536
+375 574
+375 601
+375 621
+375 696
+375 710
+375 733
+375 739
+375 822
+375 882
+376 240
+376 279
+376 569
+376 800
+377 2
+377 209
+377 270
+377 279
+377 312
+377 496
+377 536
+377 542
+377 565
+377 581
+377 583
+377 634
+377 635
+377 648
+377 679
+377 687
+377 730
+377 787
+377 979
+377 982
+378 127
+378 217
+378 240
+378 270
+378 276
+378 312
+378 373
+378 536
+378 692
+378 763
+378 894
+379 97
+379 270
+379 279
+379 700
+379 822
+379 974
+380 2
+380 26
+380 43
+380 72
+380 83
+380 117
+380 155
+380 164
+380 231
+380 235
+380 240
+380 260
+380 267
+380 279
+380 293
+380 312
+380 349
+380 354
+380 360
+380 373
+380 416
+380 421
+380 479
+380 496
+380 513
+380 530
+380 536
+380 542
+380 578
+380 579
+380 662
+380 679
+380 687
+380 692
+380 696
+380 717
+380 721
+380 733
+380 765
+380 791
+380 822
+380 826
+380 852
+380 865
+380 869
+380 925
+380 949
+380 976
+380 1015
+381 260
+381 536
+382 86
+382 155
+382 172
+382 181
+382 205
+382 266
+382 270
+382 279
+382 323
+382 344
+382 445
+382 502
+382 536
+382 542
+382 593
+382 700
+382 708
+382 733
+382 768
+382 939
+382 976
+382 995
+382 1006
+382 1021
+383 155
+383 181
+383 432
+383 536
+383 542
+383 610
+383 666
+383 673
+383 679
+383 707
+383 740
+383 782
+383 800
+383 822
+383 1019
+384 1003
+385 22
+385 181
+385 445
+385 496
+385 679
+385 830
+385 929
+385 995
+386 22
+386 26
+386 35
+386 49
+386 86
+386 117
+386 136
+386 137
+386 140
+386 153
+386 156
+386 162
+386 164
+386 193
+386 206
+386 240
+386 264
+386 270
+386 279
+386 289
+386 294
+386 299
+386 312
+386 313
+386 329
+386 360
+386 403
+386 437
+386 461
+386 474
+386 496
+386 502
+386 519
+386 526
+386 536
+386 542
+386 583
+386 618
+386 633
+386 634
+386 637
+386 655
+386 696
+386 700
+386 763
+386 822
+386 826
+386 829
+386 894
+386 913
+386 918
+386 919
+386 946
+386 949
+386 976
+386 982
+386 995
+386 997
+386 1010
+386 1013
+387 126
+387 270
+387 530
+387 536
+387 739
+387 881
+388 701
+389 22
+389 162
+389 197
+389 496
+389 536
+389 710
+390 710
+390 830
+391 2
+391 22
+391 62
+391 72
+391 86
+391 101
+391 103
+391 127
+391 131
+391 136
+391 140
+391 143
+391 155
+391 158
+391 159
+391 162
+391 164
+391 176
+391 185
+391 189
+391 195
+391 196
+391 204
+391 205
+391 206
+391 215
+391 240
+391 244
+391 260
+391 265
+391 269
+391 270
+391 279
+391 282
+391 286
+391 288
+391 290
+391 312
+391 322
+391 329
+391 342
+391 344
+391 360
+391 362
+391 364
+391 373
+391 401
+391 408
+391 435
+391 443
+391 444
+391 455
+391 461
+391 471
+391 475
+391 479
+391 496
+391 502
+391 520
+391 524
+391 532
+391 536
+391 542
+391 543
+391 556
+391 570
+391 579
+391 581
+391 583
+391 589
+391 591
+391 593
+391 596
+391 604
+391 610
+391 614
+391 633
+391 659
+391 660
+391 662
+391 677
+391 679
+391 685
+391 700
+391 727
+391 730
+391 733
+391 739
+391 742
+391 763
+391 768
+391 772
+391 779
+391 781
+391 787
+391 822
+391 826
+391 839
+391 854
+391 869
+391 876
+391 879
+391 882
+391 891
+391 894
+391 905
+391 907
+391 918
+391 926
+391 946
+391 976
+391 982
+391 985
+391 994
+391 1003
+391 1006
+391 1021
+392 86
+392 117
+392 127
+392 450
+392 496
+392 536
+392 589
+393 704
+397 197
+397 360
+397 719
+398 2
+398 5
+398 86
+398 97
+398 140
+398 162
+398 192
+398 217
+398 229
+398 270
+398 272
+398 299
+398 339
+398 367
+398 373
+398 401
+398 412
+398 442
+398 454
+398 479
+398 496
+398 524
+398 536
+398 539
+398 542
+398 583
+398 591
+398 593
+398 622
+398 632
+398 679
+398 701
+398 715
+398 751
+398 819
+398 822
+398 841
+398 907
+398 946
+398 948
+398 976
+398 986
+398 989
+398 995
+398 1003
+399 155
+399 177
+399 279
+399 648
+400 106
+400 536
+400 839
+401 197
+401 240
+401 286
+401 391
+401 398
+401 458
+401 495
+401 524
+401 536
+401 562
+401 599
+401 701
+401 707
+401 920
+401 1003
+401 1013
+402 324
+402 574
+402 701
+403 83
+403 86
+403 120
+403 127
+403 143
+403 155
+403 164
+403 178
+403 219
+403 250
+403 253
+403 267
+403 270
+403 279
+403 314
+403 329
+403 330
+403 344
+403 360
+403 373
+403 386
+403 410
+403 461
+403 476
+403 491
+403 496
+403 512
+403 520
+403 532
+403 536
+403 542
+403 578
+403 583
+403 589
+403 593
+403 632
+403 635
+403 647
+403 654
+403 655
+403 661
+403 664
+403 679
+403 700
+403 706
+403 725
+403 733
+403 816
+403 822
+403 829
+403 839
+403 877
+403 903
+403 976
+405 72
+405 86
+405 270
+405 279
+405 339
+405 373
+405 433
+405 487
+405 536
+405 591
+405 662
+405 679
+405 693
+405 706
+405 710
+405 730
+405 765
+405 772
+405 822
+405 837
+405 932
+405 947
+407 63
+407 240
+407 830
+407 919
+408 391
+408 536
+408 826
+409 153
+409 260
+409 278
+409 279
+409 282
+409 329
+409 339
+409 349
+409 373
+409 530
+409 579
+409 692
+409 706
+409 846
+409 860
+409 948
+409 989
+409 994
+410 22
+410 270
+410 360
+410 403
+410 536
+410 542
+410 545
+410 589
+410 593
+410 679
+410 700
+410 740
+410 756
+410 763
+410 781
+410 803
+410 946
+410 994
+410 1010
+411 2
+411 342
+412 86
+412 117
+412 162
+412 164
+412 206
+412 232
+412 279
+412 360
+412 373
+412 398
+412 461
+412 474
+412 496
+412 542
+412 644
+412 648
+412 692
+412 866
+412 946
+413 22
+413 26
+413 86
+413 96
+413 127
+413 131
+413 140
+413 143
+413 155
+413 172
+413 175
+413 215
+413 223
+413 260
+413 270
+413 279
+413 312
+413 344
+413 360
+413 435
+413 496
+413 536
+413 539
+413 583
+413 593
+413 594
+413 611
+413 618
+413 635
+413 643
+413 686
+413 700
+413 706
+413 710
+413 739
+413 763
+413 779
+413 800
+413 822
+413 826
+413 869
+413 873
+413 882
+413 889
+413 894
+413 920
+413 930
+413 953
+414 270
+414 588
+415 22
+415 193
+415 302
+415 946
+415 985
+416 9
+416 86
+416 106
+416 178
+416 206
+416 278
+416 312
+416 380
+416 536
+416 655
+416 686
+416 730
+416 787
+416 791
+416 822
+416 839
+416 882
+416 985
+417 86
+417 349
+417 360
+417 995
+418 593
+420 2
+420 995
+421 86
+421 352
+421 360
+421 380
+421 427
+421 533
+421 536
+421 610
+421 686
+421 733
+421 739
+421 791
+421 882
+422 250
+422 373
+422 542
+422 721
+422 772
+422 837
+422 881
+423 270
+423 375
+423 894
+424 97
+424 496
+424 512
+424 632
+425 679
+426 86
+426 474
+426 611
+427 2
+427 37
+427 106
+427 117
+427 137
+427 140
+427 143
+427 145
+427 155
+427 156
+427 162
+427 178
+427 206
+427 235
+427 260
+427 264
+427 270
+427 279
+427 290
+427 342
+427 373
+427 421
+427 487
+427 490
+427 492
+427 496
+427 526
+427 536
+427 542
+427 558
+427 565
+427 629
+427 632
+427 679
+427 688
+427 730
+427 750
+427 771
+427 787
+427 800
+427 822
+427 838
+427 862
+427 882
+427 894
+427 919
+427 976
+427 997
+427 1019
+427 1021
+428 536
+428 706
+429 7
+429 181
+429 206
+429 252
+429 279
+429 524
+429 822
+429 877
+430 250
+430 536
+430 830
+431 373
+431 496
+431 822
+431 873
+431 915
+431 923
+432 72
+432 164
+432 205
+432 235
+432 290
+432 344
+432 360
+432 383
+432 437
+432 496
+432 536
+432 565
+432 593
+432 664
+432 687
+432 739
+432 813
+432 822
+432 829
+432 860
+432 946
+433 22
+433 86
+433 117
+433 129
+433 162
+433 205
+433 322
+433 344
+433 405
+433 454
+433 479
+433 530
+433 536
+433 601
+433 632
+433 664
+433 693
+433 733
+433 740
+433 822
+433 830
+433 853
+433 874
+433 883
+435 9
+435 21
+435 22
+435 43
+435 63
+435 72
+435 86
+435 106
+435 109
+435 113
+435 117
+435 121
+435 125
+435 129
+435 140
+435 141
+435 153
+435 158
+435 159
+435 162
+435 164
+435 175
+435 193
+435 197
+435 205
+435 206
+435 228
+435 235
+435 240
+435 244
+435 264
+435 267
+435 270
+435 276
+435 278
+435 279
+435 282
+435 288
+435 295
+435 299
+435 326
+435 329
+435 342
+435 345
+435 360
+435 366
+435 373
+435 391
+435 413
+435 437
+435 447
+435 459
+435 461
+435 472
+435 479
+435 496
+435 497
+435 509
+435 510
+435 513
+435 520
+435 524
+435 530
+435 533
+435 536
+435 542
+435 573
+435 578
+435 589
+435 593
+435 618
+435 632
+435 634
+435 655
+435 659
+435 662
+435 664
+435 669
+435 679
+435 686
+435 693
+435 700
+435 701
+435 706
+435 710
+435 722
+435 763
+435 765
+435 781
+435 787
+435 798
+435 801
+435 802
+435 822
+435 826
+435 844
+435 869
+435 880
+435 881
+435 882
+435 894
+435 895
+435 897
+435 915
+435 934
+435 935
+435 945
+435 946
+435 952
+435 971
+435 976
+435 985
+435 990
+435 994
+435 995
+435 997
+435 1019
+435 1021
+436 80
+436 86
+436 143
+436 155
+436 164
+436 270
+436 329
+436 339
+436 351
+436 360
+436 439
+436 496
+436 498
+436 536
+436 537
+436 542
+436 581
+436 614
+436 679
+436 787
+436 791
+436 819
+436 826
+436 881
+436 919
+437 86
+437 102
+437 106
+437 109
+437 117
+437 153
+437 162
+437 177
+437 193
+437 235
+437 240
+437 265
+437 270
+437 279
+437 282
+437 312
+437 345
+437 362
+437 366
+437 373
+437 386
+437 432
+437 435
+437 513
+437 536
+437 542
+437 574
+437 644
+437 679
+437 692
+437 696
+437 763
+437 774
+437 781
+437 787
+437 822
+437 881
+437 921
+437 946
+437 950
+437 966
+437 995
+439 155
+439 162
+439 436
+439 536
+439 822
+439 838
+439 882
+439 946
+440 6
+440 117
+440 710
+440 883
+441 2
+441 279
+441 894
+442 74
+442 117
+442 172
+442 269
+442 312
+442 342
+442 373
+442 398
+442 536
+442 542
+442 578
+442 637
+442 648
+442 659
+442 679
+442 710
+442 766
+442 822
+442 826
+442 829
+442 841
+442 866
+442 991
+443 162
+443 344
+443 360
+443 391
+443 822
+443 882
+443 976
+444 28
+444 54
+444 131
+444 136
+444 162
+444 233
+444 260
+444 352
+444 360
+444 391
+444 461
+444 524
+444 687
+444 700
+444 763
+444 822
+444 966
+444 995
+444 997
+444 1010
+445 86
+445 217
+445 219
+445 312
+445 375
+445 382
+445 385
+445 458
+445 487
+445 536
+445 542
+445 565
+445 578
+445 583
+445 589
+445 599
+445 664
+445 826
+445 990
+445 995
+447 6
+447 299
+447 329
+447 435
+447 583
+447 948
+448 173
+448 205
+448 270
+448 279
+448 344
+448 496
+448 536
+448 569
+448 787
+448 822
+449 235
+449 279
+449 536
+449 830
+450 6
+450 60
+450 97
+450 140
+450 159
+450 197
+450 204
+450 206
+450 252
+450 265
+450 373
+450 392
+450 495
+450 520
+450 574
+450 632
+450 692
+450 769
+450 826
+450 830
+450 1003
+450 1004
+451 279
+452 153
+452 206
+452 270
+453 265
+453 373
+453 527
+453 589
+454 2
+454 22
+454 53
+454 162
+454 175
+454 205
+454 206
+454 278
+454 282
+454 288
+454 329
+454 398
+454 433
+454 510
+454 536
+454 593
+454 660
+454 873
+454 986
+455 72
+455 140
+455 143
+455 197
+455 256
+455 270
+455 279
+455 290
+455 329
+455 391
+455 496
+455 536
+455 539
+455 542
+455 618
+455 654
+455 837
+455 881
+456 162
+456 205
+456 211
+458 45
+458 86
+458 191
+458 217
+458 270
+458 282
+458 312
+458 360
+458 373
+458 401
+458 445
+458 536
+458 539
+458 542
+458 575
+458 717
+458 809
+458 822
+458 1010
+459 54
+459 74
+459 86
+459 178
+459 205
+459 206
+459 373
+459 435
+459 475
+459 536
+459 611
+459 679
+459 886
+459 948
+459 1021
+461 2
+461 86
+461 95
+461 109
+461 127
+461 131
+461 145
+461 156
+461 181
+461 270
+461 278
+461 279
+461 282
+461 294
+461 329
+461 342
+461 360
+461 373
+461 386
+461 391
+461 403
+461 412
+461 435
+461 444
+461 496
+461 502
+461 520
+461 521
+461 536
+461 542
+461 569
+461 574
+461 666
+461 677
+461 688
+461 701
+461 732
+461 781
+461 822
+461 869
+461 907
+461 986
+461 990
+461 1006
+461 1010
+463 86
+463 172
+463 205
+463 342
+463 474
+463 536
+463 577
+463 610
+463 706
+463 774
+463 781
+463 798
+463 826
+463 830
+463 907
+464 57
+464 83
+464 140
+464 162
+464 175
+464 251
+464 280
+464 287
+464 344
+464 362
+464 536
+464 542
+464 569
+464 578
+464 588
+464 589
+464 707
+464 725
+464 822
+464 826
+465 252
+465 279
+465 299
+465 344
+465 373
+465 502
+465 611
+465 679
+465 778
+465 781
+465 803
+465 819
+465 829
+465 946
+465 976
+465 994
+465 1021
+466 86
+466 164
+466 496
+466 700
+466 837
+467 162
+467 205
+467 513
+468 22
+469 701
+469 883
+470 126
+470 819
+471 49
+471 86
+471 136
+471 164
+471 264
+471 342
+471 360
+471 373
+471 391
+471 496
+471 498
+471 536
+471 593
+471 618
+471 686
+471 741
+471 822
+471 883
+471 919
+471 936
+471 991
+472 5
+472 185
+472 279
+472 435
+472 536
+472 543
+472 692
+473 34
+473 86
+473 679
+473 704
+473 707
+474 2
+474 140
+474 155
+474 197
+474 206
+474 235
+474 279
+474 294
+474 344
+474 360
+474 367
+474 386
+474 412
+474 426
+474 463
+474 496
+474 520
+474 536
+474 542
+474 579
+474 594
+474 679
+474 822
+474 894
+474 921
+474 966
+475 35
+475 59
+475 191
+475 279
+475 353
+475 391
+475 459
+475 536
+475 542
+475 659
+475 679
+475 707
+475 730
+475 782
+475 869
+475 882
+475 948
+475 986
+476 282
+476 344
+476 403
+476 822
+476 826
+477 131
+478 117
+478 706
+479 18
+479 22
+479 24
+479 39
+479 40
+479 49
+479 53
+479 59
+479 70
+479 75
+479 86
+479 98
+479 106
+479 117
+479 121
+479 127
+479 140
+479 142
+479 153
+479 158
+479 159
+479 162
+479 164
+479 166
+479 185
+479 193
+479 197
+479 205
+479 206
+479 224
+479 235
+479 244
+479 260
+479 267
+479 269
+479 270
+479 277
+479 279
+479 282
+479 288
+479 289
+479 294
+479 312
+479 322
+479 324
+479 329
+479 342
+479 354
+479 367
+479 372
+479 373
+479 380
+479 391
+479 398
+479 433
+479 435
+479 487
+479 491
+479 496
+479 497
+479 504
+479 520
+479 524
+479 530
+479 536
+479 538
+479 542
+479 548
+479 563
+479 573
+479 578
+479 583
+479 589
+479 593
+479 596
+479 606
+479 610
+479 614
+479 632
+479 638
+479 644
+479 648
+479 654
+479 662
+479 679
+479 701
+479 706
+479 707
+479 710
+479 717
+479 730
+479 750
+479 751
+479 763
+479 781
+479 791
+479 798
+479 822
+479 826
+479 830
+479 852
+479 865
+479 869
+479 873
+479 877
+479 882
+479 883
+479 894
+479 905
+479 919
+479 920
+479 929
+479 932
+479 946
+479 966
+479 976
+479 982
+479 985
+479 995
+479 999
+479 1004
+479 1021
+480 197
+480 494
+480 717
+481 127
+481 162
+481 496
+481 536
+481 593
+481 800
+481 905
+481 948
+482 39
+482 86
+482 159
+482 621
+482 661
+482 869
+483 52
+483 206
+483 252
+483 256
+483 270
+483 329
+483 373
+483 536
+483 574
+483 579
+483 632
+483 679
+483 740
+483 806
+483 830
+483 943
+483 946
+483 951
+483 1004
+484 49
+484 86
+484 358
+485 30
+485 72
+485 162
+485 360
+485 536
+485 700
+485 811
+487 21
+487 53
+487 72
+487 97
+487 162
+487 178
+487 181
+487 206
+487 235
+487 241
+487 260
+487 266
+487 267
+487 270
+487 278
+487 279
+487 282
+487 312
+487 373
+487 405
+487 427
+487 445
+487 479
+487 496
+487 536
+487 537
+487 542
+487 622
+487 637
+487 659
+487 662
+487 678
+487 688
+487 691
+487 692
+487 706
+487 707
+487 710
+487 717
+487 763
+487 786
+487 800
+487 822
+487 826
+487 830
+487 834
+487 840
+487 923
+487 953
+487 976
+487 995
+488 502
+489 344
+490 10
+490 121
+490 270
+490 278
+490 427
+490 536
+490 654
+490 706
+490 813
+491 22
+491 53
+491 97
+491 106
+491 150
+491 162
+491 206
+491 252
+491 260
+491 279
+491 288
+491 289
+491 294
+491 312
+491 342
+491 344
+491 360
+491 373
+491 375
+491 403
+491 479
+491 496
+491 503
+491 536
+491 562
+491 583
+491 589
+491 610
+491 622
+491 662
+491 679
+491 686
+491 701
+491 707
+491 730
+491 763
+491 787
+491 800
+491 826
+491 869
+491 894
+491 907
+491 990
+491 997
+491 1019
+492 427
+492 536
+493 569
+494 279
+494 304
+494 324
+494 374
+494 480
+494 554
+494 838
+495 2
+495 62
+495 86
+495 117
+495 140
+495 151
+495 162
+495 240
+495 260
+495 270
+495 279
+495 282
+495 302
+495 304
+495 339
+495 362
+495 366
+495 401
+495 450
+495 496
+495 520
+495 524
+495 536
+495 538
+495 542
+495 578
+495 610
+495 611
+495 622
+495 648
+495 686
+495 687
+495 696
+495 700
+495 701
+495 706
+495 707
+495 730
+495 739
+495 822
+495 829
+495 830
+495 844
+495 846
+495 946
+495 1004
+496 2
+496 3
+496 6
+496 22
+496 32
+496 47
+496 49
+496 50
+496 51
+496 53
+496 60
+496 61
+496 63
+496 72
+496 79
+496 83
+496 86
+496 97
+496 103
+496 113
+496 117
+496 119
+496 129
+496 131
+496 133
+496 135
+496 136
+496 140
+496 143
+496 148
+496 150
+496 153
+496 155
+496 156
+496 158
+496 159
+496 162
+496 164
+496 167
+496 169
+496 172
+496 175
+496 176
+496 177
+496 178
+496 181
+496 192
+496 195
+496 197
+496 205
+496 206
+496 209
+496 211
+496 217
+496 224
+496 230
+496 232
+496 235
+496 240
+496 241
+496 260
+496 265
+496 267
+496 269
+496 270
+496 273
+496 274
+496 278
+496 279
+496 282
+496 289
+496 302
+496 303
+496 308
+496 310
+496 311
+496 312
+496 314
+496 315
+496 319
+496 322
+496 329
+496 330
+496 342
+496 344
+496 348
+496 349
+496 354
+496 360
+496 367
+496 371
+496 373
+496 375
+496 377
+496 380
+496 385
+496 386
+496 389
+496 391
+496 392
+496 398
+496 403
+496 412
+496 413
+496 424
+496 427
+496 431
+496 432
+496 435
+496 436
+496 448
+496 455
+496 461
+496 466
+496 471
+496 474
+496 479
+496 481
+496 487
+496 491
+496 495
+496 503
+496 504
+496 519
+496 520
+496 524
+496 527
+496 532
+496 533
+496 536
+496 538
+496 539
+496 542
+496 545
+496 551
+496 559
+496 562
+496 568
+496 573
+496 578
+496 579
+496 581
+496 582
+496 583
+496 585
+496 588
+496 589
+496 593
+496 594
+496 611
+496 614
+496 620
+496 622
+496 628
+496 632
+496 637
+496 644
+496 646
+496 647
+496 652
+496 655
+496 659
+496 664
+496 665
+496 670
+496 677
+496 678
+496 679
+496 680
+496 686
+496 687
+496 692
+496 693
+496 696
+496 699
+496 700
+496 701
+496 706
+496 707
+496 710
+496 711
+496 717
+496 722
+496 725
+496 726
+496 730
+496 733
+496 737
+496 740
+496 763
+496 765
+496 770
+496 772
+496 780
+496 781
+496 787
+496 788
+496 798
+496 800
+496 810
+496 812
+496 816
+496 819
+496 820
+496 822
+496 826
+496 829
+496 837
+496 838
+496 841
+496 854
+496 865
+496 869
+496 877
+496 882
+496 883
+496 886
+496 894
+496 896
+496 897
+496 905
+496 907
+496 919
+496 920
+496 926
+496 929
+496 932
+496 937
+496 941
+496 946
+496 954
+496 956
+496 973
+496 976
+496 979
+496 980
+496 982
+496 985
+496 986
+496 993
+496 994
+496 995
+496 997
+496 1000
+496 1004
+496 1010
+496 1019
+496 1021
+497 260
+497 435
+497 479
+497 531
+497 536
+497 679
+497 692
+497 826
+497 882
+497 891
+498 11
+498 61
+498 125
+498 322
+498 329
+498 334
+498 366
+498 373
+498 436
+498 471
+498 536
+498 572
+498 614
+498 632
+498 740
+498 763
+498 781
+498 787
+498 822
+499 103
+499 542
+499 591
+500 536
+501 538
+502 2
+502 22
+502 26
+502 72
+502 86
+502 117
+502 162
+502 178
+502 181
+502 197
+502 228
+502 260
+502 270
+502 279
+502 360
+502 364
+502 372
+502 382
+502 386
+502 391
+502 461
+502 465
+502 488
+502 533
+502 536
+502 538
+502 565
+502 578
+502 583
+502 593
+502 614
+502 655
+502 700
+502 710
+502 769
+502 778
+502 788
+502 826
+502 880
+502 894
+502 925
+502 929
+502 946
+502 971
+502 995
+502 998
+503 22
+503 86
+503 117
+503 153
+503 164
+503 178
+503 267
+503 344
+503 360
+503 373
+503 491
+503 496
+503 563
+503 573
+503 581
+503 655
+503 699
+503 700
+503 710
+503 798
+503 1019
+504 103
+504 145
+504 193
+504 224
+504 279
+504 282
+504 354
+504 479
+504 496
+504 536
+504 549
+504 686
+504 706
+504 707
+504 710
+504 829
+504 898
+504 986
+504 997
+504 1021
+506 660
+506 891
+508 360
+508 946
+509 30
+509 39
+509 113
+509 117
+509 140
+509 175
+509 279
+509 305
+509 373
+509 435
+509 536
+509 706
+509 763
+510 86
+510 155
+510 176
+510 211
+510 242
+510 279
+510 344
+510 360
+510 373
+510 435
+510 454
+510 519
+510 536
+510 637
+510 692
+510 706
+510 710
+510 763
+510 781
+510 812
+510 822
+510 839
+510 966
+510 994
+511 260
+511 615
+511 700
+511 706
+511 883
+512 11
+512 86
+512 106
+512 155
+512 332
+512 373
+512 403
+512 424
+512 514
+512 523
+512 583
+512 632
+512 730
+512 763
+512 822
+512 829
+512 946
+512 976
+513 20
+513 24
+513 39
+513 63
+513 74
+513 83
+513 95
+513 113
+513 127
+513 136
+513 162
+513 164
+513 205
+513 206
+513 217
+513 240
+513 264
+513 270
+513 300
+513 327
+513 329
+513 353
+513 354
+513 360
+513 373
+513 380
+513 435
+513 437
+513 467
+513 520
+513 532
+513 536
+513 542
+513 564
+513 573
+513 577
+513 589
+513 591
+513 593
+513 605
+513 679
+513 686
+513 693
+513 707
+513 717
+513 730
+513 781
+513 787
+513 894
+513 913
+513 946
+513 962
+513 995
+513 1011
+514 72
+514 366
+514 512
+514 532
+514 632
+514 659
+514 679
+514 701
+514 706
+514 730
+514 829
+514 880
+515 882
+517 43
+517 375
+517 538
+517 686
+517 803
+517 822
+517 891
+517 944
+517 1019
+518 260
+518 373
+518 644
+519 53
+519 117
+519 158
+519 173
+519 235
+519 260
+519 279
+519 305
+519 386
+519 496
+519 510
+519 532
+519 576
+519 730
+519 826
+519 882
+519 1019
+520 2
+520 30
+520 44
+520 53
+520 60
+520 63
+520 72
+520 74
+520 86
+520 97
+520 101
+520 102
+520 103
+520 104
+520 117
+520 127
+520 131
+520 136
+520 140
+520 155
+520 162
+520 164
+520 167
+520 171
+520 172
+520 175
+520 178
+520 181
+520 189
+520 193
+520 195
+520 205
+520 206
+520 224
+520 230
+520 235
+520 240
+520 247
+520 256
+520 264
+520 265
+520 270
+520 276
+520 278
+520 279
+520 281
+520 282
+520 289
+520 299
+520 301
+520 312
+520 313
+520 329
+520 342
+520 344
+520 360
+520 366
+520 373
+520 391
+520 403
+520 435
+520 450
+520 461
+520 474
+520 479
+520 495
+520 496
+520 513
+520 524
+520 526
+520 533
+520 536
+520 537
+520 538
+520 539
+520 542
+520 544
+520 545
+520 550
+520 554
+520 558
+520 563
+520 569
+520 573
+520 574
+520 577
+520 583
+520 588
+520 589
+520 593
+520 599
+520 605
+520 610
+520 614
+520 618
+520 632
+520 644
+520 655
+520 662
+520 675
+520 679
+520 686
+520 693
+520 696
+520 707
+520 710
+520 714
+520 730
+520 763
+520 765
+520 774
+520 781
+520 787
+520 791
+520 798
+520 800
+520 822
+520 826
+520 865
+520 868
+520 870
+520 873
+520 881
+520 882
+520 894
+520 896
+520 900
+520 921
+520 923
+520 929
+520 946
+520 948
+520 966
+520 976
+520 978
+520 985
+520 991
+520 995
+520 997
+520 1000
+520 1010
+520 1019
+520 1021
+521 86
+521 329
+521 461
+521 706
+521 791
+521 883
+522 162
+522 536
+523 512
+524 2
+524 10
+524 15
+524 20
+524 22
+524 58
+524 72
+524 86
+524 106
+524 117
+524 127
+524 129
+524 136
+524 137
+524 141
+524 155
+524 162
+524 165
+524 167
+524 172
+524 175
+524 178
+524 206
+524 209
+524 210
+524 216
+524 217
+524 219
+524 235
+524 240
+524 270
+524 276
+524 278
+524 279
+524 282
+524 294
+524 322
+524 330
+524 339
+524 344
+524 348
+524 350
+524 360
+524 367
+524 373
+524 375
+524 391
+524 398
+524 401
+524 429
+524 435
+524 444
+524 479
+524 495
+524 496
+524 520
+524 530
+524 536
+524 538
+524 542
+524 549
+524 550
+524 559
+524 573
+524 578
+524 583
+524 589
+524 593
+524 618
+524 632
+524 633
+524 655
+524 661
+524 664
+524 679
+524 700
+524 701
+524 707
+524 710
+524 712
+524 730
+524 737
+524 763
+524 769
+524 782
+524 787
+524 791
+524 800
+524 816
+524 819
+524 822
+524 826
+524 869
+524 879
+524 881
+524 882
+524 894
+524 929
+524 946
+524 976
+524 994
+524 995
+524 997
+524 1003
+524 1010
+524 1021
+526 18
+526 72
+526 86
+526 117
+526 156
+526 160
+526 162
+526 209
+526 240
+526 264
+526 270
+526 308
+526 312
+526 321
+526 324
+526 360
+526 367
+526 386
+526 427
+526 520
+526 536
+526 537
+526 541
+526 542
+526 543
+526 591
+526 614
+526 632
+526 633
+526 634
+526 661
+526 665
+526 679
+526 701
+526 707
+526 710
+526 736
+526 740
+526 763
+526 787
+526 822
+526 860
+526 869
+526 877
+526 905
+526 923
+526 945
+526 956
+526 966
+526 976
+526 995
+526 1019
+526 1022
+527 453
+527 496
+528 86
+529 678
+530 2
+530 86
+530 112
+530 143
+530 162
+530 164
+530 200
+530 243
+530 252
+530 260
+530 279
+530 312
+530 322
+530 324
+530 360
+530 380
+530 387
+530 409
+530 433
+530 435
+530 479
+530 524
+530 536
+530 578
+530 583
+530 611
+530 621
+530 634
+530 687
+530 700
+530 706
+530 719
+530 765
+530 787
+530 829
+530 877
+530 882
+530 886
+530 923
+530 997
+530 1000
+530 1004
+530 1019
+531 497
+532 26
+532 72
+532 86
+532 96
+532 127
+532 155
+532 162
+532 166
+532 205
+532 206
+532 221
+532 232
+532 260
+532 270
+532 279
+532 282
+532 290
+532 360
+532 362
+532 373
+532 391
+532 403
+532 496
+532 513
+532 514
+532 519
+532 536
+532 542
+532 569
+532 578
+532 593
+532 594
+532 607
+532 610
+532 648
+532 679
+532 692
+532 701
+532 719
+532 730
+532 756
+532 763
+532 781
+532 787
+532 797
+532 841
+532 848
+532 882
+532 901
+532 907
+532 929
+532 1019
+532 1021
+533 49
+533 60
+533 74
+533 83
+533 86
+533 155
+533 162
+533 164
+533 190
+533 197
+533 251
+533 270
+533 279
+533 319
+533 342
+533 360
+533 364
+533 366
+533 367
+533 421
+533 435
+533 496
+533 502
+533 520
+533 536
+533 542
+533 546
+533 556
+533 564
+533 578
+533 593
+533 632
+533 679
+533 696
+533 706
+533 707
+533 730
+533 763
+533 781
+533 822
+533 839
+533 869
+533 870
+533 891
+533 946
+533 976
+533 1004
+533 1021
+534 593
+535 700
+536 2
+536 3
+536 4
+536 6
+536 8
+536 9
+536 10
+536 12
+536 13
+536 21
+536 22
+536 24
+536 25
+536 26
+536 27
+536 30
+536 35
+536 39
+536 43
+536 44
+536 48
+536 49
+536 51
+536 53
+536 54
+536 55
+536 56
+536 58
+536 60
+536 61
+536 62
+536 63
+536 65
+536 72
+536 73
+536 79
+536 80
+536 83
+536 86
+536 88
+536 90
+536 91
+536 97
+536 102
+536 106
+536 107
+536 109
+536 112
+536 113
+536 117
+536 119
+536 120
+536 122
+536 127
+536 128
+536 129
+536 131
+536 133
+536 134
+536 136
+536 137
+536 140
+536 141
+536 142
+536 143
+536 149
+536 150
+536 153
+536 155
+536 156
+536 158
+536 159
+536 160
+536 161
+536 162
+536 164
+536 165
+536 166
+536 167
+536 172
+536 175
+536 176
+536 178
+536 181
+536 187
+536 189
+536 191
+536 192
+536 193
+536 194
+536 195
+536 197
+536 204
+536 205
+536 206
+536 210
+536 211
+536 216
+536 217
+536 221
+536 222
+536 224
+536 226
+536 228
+536 229
+536 230
+536 234
+536 235
+536 240
+536 241
+536 242
+536 243
+536 244
+536 246
+536 247
+536 250
+536 251
+536 252
+536 256
+536 260
+536 262
+536 264
+536 265
+536 266
+536 267
+536 270
+536 273
+536 276
+536 277
+536 278
+536 279
+536 282
+536 283
+536 285
+536 288
+536 289
+536 290
+536 293
+536 294
+536 299
+536 301
+536 302
+536 303
+536 307
+536 308
+536 310
+536 311
+536 312
+536 313
+536 317
+536 318
+536 319
+536 322
+536 324
+536 326
+536 329
+536 330
+536 333
+536 334
+536 338
+536 339
+536 342
+536 344
+536 345
+536 348
+536 349
+536 352
+536 353
+536 358
+536 360
+536 362
+536 366
+536 367
+536 372
+536 373
+536 374
+536 375
+536 377
+536 378
+536 380
+536 381
+536 382
+536 383
+536 386
+536 387
+536 389
+536 391
+536 392
+536 398
+536 400
+536 401
+536 403
+536 405
+536 408
+536 410
+536 413
+536 416
+536 421
+536 427
+536 428
+536 430
+536 432
+536 433
+536 435
+536 436
+536 437
+536 439
+536 442
+536 445
+536 448
+536 449
+536 454
+536 455
+536 458
+536 459
+536 461
+536 463
+536 464
+536 471
+536 472
+536 474
+536 475
+536 479
+536 481
+536 483
+536 485
+536 487
+536 490
+536 491
+536 492
+536 495
+536 496
+536 497
+536 498
+536 500
+536 502
+536 504
+536 509
+536 510
+536 513
+536 520
+536 522
+536 524
+536 526
+536 530
+536 532
+536 533
+536 538
+536 539
+536 541
+536 542
+536 543
+536 545
+536 550
+536 552
+536 554
+536 555
+536 556
+536 562
+536 563
+536 565
+536 568
+536 569
+536 573
+536 574
+536 575
+536 576
+536 577
+536 578
+536 579
+536 583
+536 585
+536 588
+536 589
+536 591
+536 593
+536 594
+536 596
+536 601
+536 605
+536 606
+536 607
+536 608
+536 611
+536 614
+536 615
+536 617
+536 618
+536 621
+536 622
+536 624
+536 629
+536 632
+536 633
+536 637
+536 641
+536 644
+536 648
+536 654
+536 655
+536 660
+536 661
+536 662
+536 663
+536 664
+536 665
+536 666
+536 671
+536 677
+536 678
+536 679
+536 685
+536 686
+536 687
+536 688
+536 692
+536 693
+536 696
+536 698
+536 699
+536 700
+536 701
+536 704
+536 706
+536 707
+536 710
+536 711
+536 713
+536 714
+536 717
+536 721
+536 722
+536 725
+536 726
+536 730
+536 732
+536 733
+536 739
+536 740
+536 742
+536 744
+536 746
+536 747
+536 750
+536 751
+536 755
+536 758
+536 761
+536 762
+536 763
+536 765
+536 768
+536 769
+536 770
+536 771
+536 772
+536 774
+536 776
+536 777
+536 778
+536 779
+536 781
+536 782
+536 783
+536 785
+536 786
+536 787
+536 791
+536 796
+536 798
+536 800
+536 801
+536 808
+536 809
+536 811
+536 812
+536 816
+536 819
+536 822
+536 826
+536 828
+536 829
+536 830
+536 836
+536 837
+536 838
+536 839
+536 840
+536 841
+536 847
+536 848
+536 849
+536 851
+536 853
+536 860
+536 862
+536 865
+536 866
+536 867
+536 868
+536 869
+536 870
+536 873
+536 876
+536 877
+536 878
+536 879
+536 880
+536 881
+536 882
+536 883
+536 885
+536 886
+536 889
+536 891
+536 894
+536 896
+536 898
+536 905
+536 907
+536 910
+536 913
+536 919
+536 920
+536 921
+536 923
+536 925
+536 926
+536 929
+536 931
+536 932
+536 938
+536 942
+536 943
+536 946
+536 947
+536 948
+536 949
+536 950
+536 954
+536 955
+536 962
+536 964
+536 966
+536 967
+536 968
+536 970
+536 971
+536 973
+536 976
+536 977
+536 978
+536 980
+536 982
+536 985
+536 986
+536 990
+536 991
+536 994
+536 995
+536 997
+536 999
+536 1000
+536 1003
+536 1004
+536 1010
+536 1011
+536 1013
+536 1019
+536 1021
+536 1022
+537 86
+537 140
+537 224
+537 264
+537 279
+537 302
+537 360
+537 373
+537 436
+537 487
+537 520
+537 526
+537 542
+537 668
+537 669
+537 679
+537 707
+537 728
+537 730
+537 787
+537 816
+537 822
+537 907
+537 976
+538 2
+538 6
+538 60
+538 72
+538 97
+538 147
+538 148
+538 159
+538 164
+538 181
+538 205
+538 206
+538 217
+538 233
+538 235
+538 267
+538 270
+538 279
+538 290
+538 294
+538 308
+538 326
+538 352
+538 360
+538 367
+538 370
+538 479
+538 495
+538 496
+538 501
+538 502
+538 517
+538 520
+538 524
+538 536
+538 542
+538 565
+538 569
+538 573
+538 581
+538 591
+538 594
+538 599
+538 608
+538 611
+538 622
+538 632
+538 679
+538 693
+538 696
+538 700
+538 706
+538 707
+538 710
+538 722
+538 781
+538 787
+538 789
+538 809
+538 817
+538 822
+538 826
+538 830
+538 869
+538 881
+538 882
+538 898
+538 946
+538 971
+538 976
+538 982
+538 1011
+539 53
+539 72
+539 86
+539 136
+539 143
+539 162
+539 168
+539 189
+539 195
+539 201
+539 205
+539 259
+539 267
+539 270
+539 279
+539 290
+539 302
+539 312
+539 321
+539 324
+539 342
+539 354
+539 360
+539 367
+539 373
+539 398
+539 413
+539 455
+539 458
+539 496
+539 520
+539 536
+539 542
+539 554
+539 568
+539 574
+539 589
+539 605
+539 639
+539 648
+539 675
+539 679
+539 701
+539 707
+539 730
+539 739
+539 742
+539 760
+539 763
+539 781
+539 803
+539 816
+539 822
+539 830
+539 869
+539 881
+539 891
+539 946
+539 985
+540 15
+540 158
+540 787
+540 946
+541 155
+541 206
+541 220
+541 235
+541 269
+541 270
+541 279
+541 317
+541 526
+541 536
+541 593
+541 822
+541 826
+541 894
+542 2
+542 5
+542 6
+542 7
+542 8
+542 9
+542 10
+542 15
+542 22
+542 26
+542 30
+542 39
+542 50
+542 53
+542 59
+542 60
+542 61
+542 65
+542 67
+542 72
+542 74
+542 80
+542 83
+542 86
+542 92
+542 97
+542 100
+542 106
+542 117
+542 127
+542 129
+542 131
+542 133
+542 136
+542 137
+542 140
+542 151
+542 153
+542 155
+542 158
+542 159
+542 162
+542 164
+542 165
+542 167
+542 172
+542 175
+542 176
+542 181
+542 191
+542 197
+542 198
+542 205
+542 206
+542 217
+542 224
+542 226
+542 231
+542 234
+542 235
+542 240
+542 244
+542 248
+542 250
+542 252
+542 256
+542 260
+542 264
+542 267
+542 269
+542 270
+542 273
+542 277
+542 278
+542 279
+542 281
+542 282
+542 283
+542 289
+542 290
+542 302
+542 310
+542 312
+542 326
+542 329
+542 330
+542 344
+542 348
+542 360
+542 367
+542 370
+542 373
+542 374
+542 377
+542 380
+542 382
+542 383
+542 386
+542 391
+542 398
+542 403
+542 410
+542 412
+542 422
+542 427
+542 435
+542 436
+542 437
+542 442
+542 445
+542 455
+542 458
+542 461
+542 464
+542 474
+542 475
+542 479
+542 487
+542 495
+542 496
+542 499
+542 513
+542 520
+542 524
+542 526
+542 532
+542 533
+542 536
+542 537
+542 538
+542 539
+542 549
+542 562
+542 563
+542 564
+542 565
+542 568
+542 569
+542 573
+542 574
+542 578
+542 579
+542 581
+542 583
+542 585
+542 589
+542 591
+542 593
+542 594
+542 598
+542 599
+542 606
+542 610
+542 611
+542 614
+542 618
+542 623
+542 632
+542 633
+542 634
+542 644
+542 648
+542 654
+542 655
+542 656
+542 659
+542 661
+542 662
+542 664
+542 671
+542 676
+542 679
+542 685
+542 686
+542 687
+542 692
+542 693
+542 700
+542 701
+542 706
+542 707
+542 710
+542 717
+542 721
+542 724
+542 725
+542 730
+542 733
+542 739
+542 740
+542 741
+542 742
+542 743
+542 748
+542 751
+542 755
+542 763
+542 765
+542 781
+542 787
+542 788
+542 798
+542 800
+542 803
+542 805
+542 819
+542 822
+542 826
+542 830
+542 837
+542 839
+542 841
+542 847
+542 848
+542 849
+542 869
+542 877
+542 880
+542 881
+542 882
+542 887
+542 891
+542 894
+542 903
+542 905
+542 919
+542 920
+542 921
+542 923
+542 929
+542 932
+542 934
+542 944
+542 946
+542 947
+542 949
+542 954
+542 966
+542 976
+542 982
+542 986
+542 988
+542 991
+542 994
+542 995
+542 999
+542 1002
+542 1003
+542 1010
+542 1013
+542 1019
+542 1021
+543 270
+543 367
+543 373
+543 391
+543 472
+543 526
+543 536
+543 614
+543 982
+544 54
+544 520
+544 920
+545 43
+545 86
+545 140
+545 197
+545 240
+545 265
+545 342
+545 360
+545 366
+545 410
+545 496
+545 520
+545 536
+545 573
+545 707
+545 730
+545 763
+545 781
+545 820
+546 373
+546 533
+546 894
+548 479
+548 676
+549 22
+549 86
+549 153
+549 270
+549 360
+549 373
+549 504
+549 524
+549 542
+549 577
+549 583
+549 946
+549 984
+549 985
+550 2
+550 6
+550 109
+550 117
+550 197
+550 224
+550 252
+550 260
+550 267
+550 279
+550 283
+550 360
+550 373
+550 520
+550 524
+550 536
+550 583
+550 632
+550 869
+550 883
+550 894
+550 898
+551 197
+551 496
+551 632
+551 679
+551 686
+551 976
+552 72
+552 279
+552 344
+552 536
+552 869
+552 883
+554 6
+554 117
+554 127
+554 159
+554 162
+554 211
+554 224
+554 270
+554 360
+554 373
+554 494
+554 520
+554 536
+554 539
+554 591
+554 679
+554 686
+554 730
+554 822
+554 823
+554 860
+554 891
+554 946
+554 976
+554 998
+554 1019
+555 162
+555 193
+555 360
+555 536
+556 86
+556 155
+556 162
+556 312
+556 344
+556 391
+556 533
+556 536
+556 562
+556 686
+556 883
+556 923
+556 991
+557 579
+558 270
+558 427
+558 520
+558 730
+558 1010
+558 1021
+559 155
+559 162
+559 164
+559 373
+559 496
+559 524
+560 360
+560 985
+561 850
+562 60
+562 86
+562 162
+562 205
+562 279
+562 339
+562 344
+562 351
+562 360
+562 373
+562 401
+562 491
+562 496
+562 536
+562 542
+562 556
+562 565
+562 679
+562 733
+562 803
+563 6
+563 61
+563 69
+563 117
+563 140
+563 162
+563 181
+563 197
+563 205
+563 206
+563 235
+563 240
+563 250
+563 267
+563 270
+563 279
+563 285
+563 340
+563 344
+563 360
+563 366
+563 367
+563 479
+563 503
+563 520
+563 536
+563 542
+563 565
+563 583
+563 589
+563 593
+563 611
+563 632
+563 633
+563 651
+563 661
+563 687
+563 692
+563 701
+563 706
+563 707
+563 717
+563 730
+563 762
+563 778
+563 822
+563 837
+563 869
+563 876
+563 889
+563 896
+563 907
+563 921
+563 995
+564 4
+564 260
+564 279
+564 290
+564 342
+564 362
+564 513
+564 533
+564 542
+564 574
+564 610
+564 611
+564 618
+564 679
+564 701
+564 763
+564 765
+564 791
+564 882
+564 946
+564 997
+564 1021
+565 2
+565 54
+565 117
+565 155
+565 158
+565 162
+565 178
+565 181
+565 206
+565 224
+565 231
+565 233
+565 250
+565 278
+565 279
+565 329
+565 360
+565 373
+565 377
+565 427
+565 432
+565 445
+565 502
+565 536
+565 538
+565 542
+565 562
+565 563
+565 573
+565 578
+565 588
+565 589
+565 614
+565 622
+565 637
+565 660
+565 679
+565 686
+565 700
+565 701
+565 707
+565 721
+565 730
+565 733
+565 787
+565 811
+565 822
+565 830
+565 860
+565 869
+565 882
+565 930
+565 985
+565 995
+565 1021
+567 164
+568 72
+568 88
+568 178
+568 251
+568 322
+568 339
+568 344
+568 358
+568 496
+568 536
+568 539
+568 542
+568 589
+568 701
+568 822
+568 995
+569 2
+569 26
+569 60
+569 62
+569 83
+569 86
+569 141
+569 153
+569 156
+569 162
+569 191
+569 205
+569 218
+569 224
+569 252
+569 270
+569 282
+569 330
+569 360
+569 373
+569 376
+569 448
+569 461
+569 464
+569 493
+569 520
+569 532
+569 536
+569 538
+569 542
+569 578
+569 589
+569 607
+569 633
+569 662
+569 679
+569 701
+569 787
+569 803
+569 822
+569 865
+569 877
+569 882
+569 894
+569 946
+569 948
+569 976
+569 982
+569 992
+569 1021
+570 97
+570 205
+570 217
+570 354
+570 391
+570 663
+570 944
+571 141
+571 344
+571 360
+571 596
+571 725
+572 211
+572 498
+573 22
+573 26
+573 45
+573 72
+573 86
+573 97
+573 100
+573 117
+573 127
+573 136
+573 158
+573 162
+573 164
+573 205
+573 206
+573 260
+573 264
+573 279
+573 299
+573 330
+573 339
+573 349
+573 350
+573 360
+573 435
+573 479
+573 496
+573 503
+573 513
+573 520
+573 524
+573 536
+573 538
+573 542
+573 545
+573 565
+573 661
+573 679
+573 686
+573 700
+573 707
+573 710
+573 738
+573 798
+573 822
+573 826
+573 869
+573 871
+573 889
+573 891
+573 923
+573 946
+573 966
+573 976
+573 991
+573 1004
+573 1021
+574 7
+574 26
+574 72
+574 83
+574 86
+574 117
+574 127
+574 155
+574 162
+574 164
+574 252
+574 267
+574 279
+574 289
+574 312
+574 329
+574 344
+574 360
+574 362
+574 373
+574 375
+574 402
+574 437
+574 450
+574 461
+574 483
+574 520
+574 536
+574 539
+574 542
+574 564
+574 582
+574 589
+574 591
+574 594
+574 606
+574 610
+574 629
+574 679
+574 686
+574 706
+574 710
+574 730
+574 751
+574 763
+574 778
+574 787
+574 791
+574 819
+574 822
+574 826
+574 829
+574 971
+574 976
+574 1006
+574 1019
+575 205
+575 279
+575 458
+575 536
+575 822
+575 976
+576 86
+576 234
+576 519
+576 536
+576 946
+577 96
+577 103
+577 117
+577 191
+577 206
+577 270
+577 312
+577 364
+577 463
+577 513
+577 520
+577 536
+577 549
+577 578
+577 589
+577 594
+577 632
+577 659
+577 686
+577 706
+577 707
+577 717
+577 765
+577 819
+577 822
+577 994
+578 5
+578 22
+578 26
+578 49
+578 60
+578 81
+578 83
+578 86
+578 97
+578 103
+578 117
+578 127
+578 150
+578 153
+578 155
+578 156
+578 162
+578 164
+578 172
+578 173
+578 178
+578 187
+578 189
+578 197
+578 205
+578 206
+578 235
+578 260
+578 265
+578 267
+578 270
+578 279
+578 282
+578 294
+578 312
+578 324
+578 329
+578 334
+578 338
+578 353
+578 354
+578 366
+578 373
+578 380
+578 403
+578 435
+578 442
+578 445
+578 464
+578 479
+578 495
+578 496
+578 502
+578 524
+578 530
+578 532
+578 533
+578 536
+578 542
+578 565
+578 569
+578 577
+578 583
+578 591
+578 593
+578 594
+578 604
+578 605
+578 610
+578 615
+578 620
+578 632
+578 659
+578 664
+578 679
+578 686
+578 692
+578 693
+578 700
+578 701
+578 707
+578 708
+578 710
+578 740
+578 772
+578 777
+578 779
+578 781
+578 782
+578 787
+578 791
+578 798
+578 822
+578 826
+578 837
+578 849
+578 853
+578 867
+578 869
+578 883
+578 894
+578 901
+578 905
+578 930
+578 939
+578 946
+578 948
+578 966
+578 967
+578 970
+578 976
+578 979
+578 982
+578 985
+578 986
+578 991
+578 995
+578 997
+578 1010
+578 1021
+579 9
+579 22
+579 59
+579 86
+579 107
+579 140
+579 155
+579 159
+579 162
+579 205
+579 250
+579 254
+579 265
+579 270
+579 279
+579 282
+579 312
+579 329
+579 342
+579 344
+579 353
+579 360
+579 373
+579 380
+579 391
+579 409
+579 474
+579 483
+579 496
+579 536
+579 542
+579 557
+579 583
+579 585
+579 591
+579 593
+579 633
+579 664
+579 679
+579 686
+579 687
+579 706
+579 707
+579 730
+579 763
+579 781
+579 787
+579 822
+579 865
+579 891
+579 894
+579 901
+579 907
+579 923
+579 929
+579 943
+579 966
+579 976
+579 990
+579 995
+579 997
+579 1019
+581 53
+581 106
+581 117
+581 140
+581 162
+581 175
+581 206
+581 270
+581 279
+581 339
+581 377
+581 391
+581 436
+581 496
+581 503
+581 538
+581 542
+581 629
+581 774
+581 800
+581 995
+582 496
+582 574
+583 2
+583 6
+583 8
+583 20
+583 22
+583 33
+583 64
+583 72
+583 83
+583 86
+583 92
+583 131
+583 140
+583 150
+583 155
+583 158
+583 162
+583 164
+583 197
+583 205
+583 206
+583 216
+583 219
+583 224
+583 235
+583 236
+583 250
+583 252
+583 260
+583 265
+583 267
+583 270
+583 276
+583 279
+583 282
+583 299
+583 312
+583 322
+583 342
+583 349
+583 354
+583 360
+583 372
+583 373
+583 374
+583 377
+583 386
+583 391
+583 398
+583 403
+583 413
+583 445
+583 447
+583 479
+583 491
+583 496
+583 502
+583 512
+583 520
+583 524
+583 530
+583 536
+583 542
+583 549
+583 550
+583 563
+583 578
+583 579
+583 585
+583 593
+583 621
+583 623
+583 626
+583 654
+583 659
+583 686
+583 692
+583 693
+583 700
+583 701
+583 706
+583 707
+583 720
+583 721
+583 725
+583 730
+583 732
+583 733
+583 763
+583 765
+583 772
+583 781
+583 786
+583 787
+583 790
+583 801
+583 805
+583 816
+583 819
+583 822
+583 826
+583 829
+583 856
+583 864
+583 865
+583 868
+583 869
+583 882
+583 891
+583 894
+583 896
+583 921
+583 923
+583 946
+583 966
+583 976
+583 990
+583 995
+583 1019
+583 1021
+585 127
+585 162
+585 164
+585 197
+585 206
+585 282
+585 312
+585 496
+585 536
+585 542
+585 579
+585 583
+585 679
+585 822
+585 869
+585 923
+585 976
+585 1021
+586 162
+586 679
+586 813
+588 86
+588 155
+588 159
+588 193
+588 270
+588 294
+588 307
+588 312
+588 373
+588 414
+588 464
+588 496
+588 520
+588 536
+588 565
+588 593
+588 822
+588 826
+588 920
+588 1013
+589 2
+589 22
+589 26
+589 27
+589 53
+589 54
+589 59
+589 61
+589 72
+589 73
+589 83
+589 86
+589 117
+589 127
+589 131
+589 140
+589 155
+589 158
+589 162
+589 164
+589 172
+589 175
+589 193
+589 205
+589 206
+589 228
+589 235
+589 240
+589 250
+589 252
+589 256
+589 266
+589 270
+589 278
+589 279
+589 282
+589 283
+589 290
+589 302
+589 317
+589 319
+589 322
+589 324
+589 329
+589 339
+589 344
+589 345
+589 350
+589 352
+589 360
+589 362
+589 366
+589 373
+589 391
+589 392
+589 403
+589 410
+589 435
+589 445
+589 453
+589 464
+589 479
+589 491
+589 496
+589 513
+589 520
+589 524
+589 536
+589 539
+589 542
+589 563
+589 565
+589 568
+589 569
+589 574
+589 577
+589 591
+589 593
+589 594
+589 614
+589 615
+589 626
+589 632
+589 655
+589 659
+589 662
+589 670
+589 679
+589 686
+589 700
+589 701
+589 707
+589 710
+589 717
+589 721
+589 730
+589 751
+589 763
+589 778
+589 781
+589 787
+589 798
+589 819
+589 822
+589 826
+589 839
+589 841
+589 846
+589 849
+589 865
+589 869
+589 873
+589 876
+589 877
+589 881
+589 882
+589 885
+589 894
+589 905
+589 921
+589 923
+589 948
+589 976
+589 982
+589 991
+589 995
+589 1010
+591 10
+591 22
+591 24
+591 26
+591 30
+591 86
+591 97
+591 140
+591 155
+591 162
+591 205
+591 206
+591 235
+591 265
+591 270
+591 282
+591 290
+591 339
+591 348
+591 354
+591 360
+591 366
+591 367
+591 373
+591 391
+591 398
+591 405
+591 499
+591 513
+591 526
+591 536
+591 538
+591 542
+591 554
+591 574
+591 578
+591 579
+591 589
+591 635
+591 660
+591 679
+591 686
+591 700
+591 706
+591 707
+591 739
+591 781
+591 787
+591 822
+591 869
+591 880
+591 882
+591 891
+591 898
+591 946
+591 1003
+593 10
+593 13
+593 22
+593 31
+593 57
+593 60
+593 61
+593 72
+593 86
+593 92
+593 97
+593 106
+593 117
+593 127
+593 129
+593 136
+593 140
+593 141
+593 145
+593 155
+593 156
+593 162
+593 176
+593 178
+593 193
+593 197
+593 204
+593 206
+593 211
+593 224
+593 225
+593 235
+593 247
+593 252
+593 260
+593 267
+593 270
+593 273
+593 277
+593 279
+593 282
+593 283
+593 288
+593 307
+593 312
+593 329
+593 339
+593 344
+593 353
+593 354
+593 360
+593 366
+593 372
+593 373
+593 382
+593 391
+593 398
+593 403
+593 410
+593 413
+593 418
+593 432
+593 435
+593 454
+593 471
+593 479
+593 481
+593 496
+593 502
+593 513
+593 520
+593 524
+593 532
+593 533
+593 534
+593 536
+593 541
+593 542
+593 563
+593 578
+593 579
+593 583
+593 588
+593 589
+593 601
+593 605
+593 611
+593 614
+593 632
+593 633
+593 648
+593 654
+593 659
+593 660
+593 664
+593 679
+593 686
+593 687
+593 693
+593 700
+593 701
+593 706
+593 707
+593 710
+593 714
+593 730
+593 763
+593 765
+593 782
+593 787
+593 798
+593 800
+593 809
+593 822
+593 826
+593 858
+593 870
+593 873
+593 881
+593 882
+593 891
+593 894
+593 915
+593 917
+593 923
+593 943
+593 946
+593 948
+593 966
+593 976
+593 979
+593 990
+593 995
+593 1000
+593 1021
+594 72
+594 86
+594 113
+594 117
+594 131
+594 140
+594 155
+594 162
+594 164
+594 178
+594 193
+594 205
+594 218
+594 260
+594 273
+594 293
+594 294
+594 344
+594 360
+594 366
+594 373
+594 413
+594 474
+594 496
+594 532
+594 536
+594 538
+594 542
+594 574
+594 577
+594 578
+594 589
+594 614
+594 623
+594 664
+594 679
+594 701
+594 706
+594 707
+594 740
+594 769
+594 785
+594 822
+594 830
+594 869
+594 905
+594 919
+594 921
+594 923
+594 943
+594 949
+594 966
+594 982
+594 985
+594 1006
+594 1013
+594 1021
+595 156
+595 252
+595 360
+595 687
+595 822
+596 72
+596 117
+596 228
+596 279
+596 373
+596 391
+596 479
+596 536
+596 571
+596 611
+596 679
+596 686
+596 711
+596 822
+596 882
+596 894
+596 986
+598 2
+598 156
+598 542
+598 907
+599 2
+599 22
+599 117
+599 120
+599 158
+599 159
+599 162
+599 322
+599 360
+599 373
+599 401
+599 445
+599 520
+599 538
+599 542
+599 618
+599 632
+599 633
+599 662
+599 679
+599 707
+599 822
+600 235
+600 894
+601 72
+601 91
+601 260
+601 278
+601 375
+601 433
+601 536
+601 593
+601 662
+601 763
+601 769
+601 882
+601 976
+601 995
+601 1021
+603 197
+604 86
+604 155
+604 167
+604 217
+604 373
+604 391
+604 578
+604 664
+604 679
+604 739
+604 798
+604 819
+604 907
+605 72
+605 86
+605 117
+605 247
+605 279
+605 325
+605 360
+605 513
+605 520
+605 536
+605 539
+605 578
+605 593
+605 621
+605 629
+605 706
+605 733
+605 740
+605 787
+605 791
+605 822
+605 869
+605 954
+606 2
+606 8
+606 22
+606 86
+606 97
+606 279
+606 294
+606 329
+606 339
+606 360
+606 479
+606 536
+606 542
+606 574
+606 662
+606 686
+606 772
+606 852
+606 883
+606 891
+606 907
+607 235
+607 265
+607 532
+607 536
+607 569
+607 614
+607 717
+607 976
+607 1008
+608 86
+608 312
+608 536
+608 538
+608 701
+608 882
+608 997
+608 1021
+609 299
+610 72
+610 115
+610 117
+610 143
+610 145
+610 162
+610 164
+610 167
+610 178
+610 185
+610 205
+610 219
+610 252
+610 264
+610 270
+610 279
+610 284
+610 324
+610 344
+610 360
+610 367
+610 383
+610 391
+610 421
+610 463
+610 479
+610 491
+610 495
+610 520
+610 532
+610 542
+610 564
+610 574
+610 578
+610 614
+610 632
+610 670
+610 700
+610 701
+610 707
+610 710
+610 730
+610 765
+610 774
+610 800
+610 822
+610 862
+610 873
+610 882
+610 919
+610 925
+610 926
+610 946
+610 948
+610 995
+611 34
+611 86
+611 97
+611 117
+611 150
+611 155
+611 158
+611 162
+611 191
+611 206
+611 217
+611 226
+611 270
+611 279
+611 282
+611 285
+611 312
+611 329
+611 373
+611 413
+611 426
+611 459
+611 465
+611 495
+611 496
+611 530
+611 536
+611 538
+611 542
+611 563
+611 564
+611 593
+611 596
+611 615
+611 679
+611 693
+611 701
+611 707
+611 739
+611 763
+611 787
+611 808
+611 826
+611 829
+611 837
+611 838
+611 869
+611 870
+611 887
+611 894
+611 930
+611 946
+611 982
+611 985
+614 22
+614 26
+614 72
+614 127
+614 140
+614 155
+614 162
+614 197
+614 205
+614 240
+614 260
+614 270
+614 278
+614 279
+614 312
+614 344
+614 367
+614 373
+614 391
+614 436
+614 479
+614 496
+614 498
+614 502
+614 520
+614 526
+614 536
+614 542
+614 543
+614 565
+614 589
+614 593
+614 594
+614 607
+614 610
+614 615
+614 629
+614 632
+614 659
+614 700
+614 710
+614 724
+614 763
+614 772
+614 777
+614 826
+614 860
+614 882
+614 920
+614 923
+614 949
+614 982
+614 1003
+615 109
+615 162
+615 206
+615 279
+615 312
+615 348
+615 360
+615 511
+615 536
+615 578
+615 589
+615 611
+615 614
+615 645
+615 679
+615 774
+615 822
+615 946
+615 986
+615 995
+615 1004
+616 686
+616 701
+617 3
+617 49
+617 72
+617 205
+617 206
+617 536
+617 699
+617 751
+618 6
+618 30
+618 86
+618 136
+618 155
+618 162
+618 197
+618 224
+618 235
+618 279
+618 302
+618 329
+618 339
+618 358
+618 373
+618 386
+618 413
+618 435
+618 455
+618 471
+618 520
+618 524
+618 536
+618 542
+618 564
+618 599
+618 632
+618 679
+618 701
+618 730
+618 763
+618 822
+618 865
+618 869
+618 894
+618 896
+618 898
+618 962
+618 976
+618 995
+620 86
+620 373
+620 496
+620 578
+620 995
+621 48
+621 60
+621 117
+621 162
+621 319
+621 350
+621 375
+621 482
+621 530
+621 536
+621 583
+621 605
+621 632
+621 677
+621 696
+621 710
+621 730
+621 732
+621 740
+621 798
+621 822
+621 879
+621 889
+621 986
+621 994
+622 60
+622 127
+622 178
+622 289
+622 330
+622 373
+622 398
+622 487
+622 491
+622 495
+622 496
+622 536
+622 538
+622 565
+622 637
+622 655
+622 693
+623 22
+623 156
+623 164
+623 282
+623 542
+623 583
+623 594
+623 881
+623 995
+623 1003
+624 193
+624 536
+625 72
+626 267
+626 282
+626 583
+626 589
+626 822
+627 54
+627 308
+627 809
+628 496
+629 72
+629 93
+629 143
+629 156
+629 158
+629 267
+629 270
+629 329
+629 351
+629 360
+629 367
+629 427
+629 536
+629 574
+629 581
+629 605
+629 614
+629 633
+629 664
+629 701
+629 706
+629 787
+629 822
+629 883
+630 86
+630 839
+630 976
+631 946
+632 2
+632 6
+632 9
+632 20
+632 22
+632 24
+632 43
+632 60
+632 72
+632 86
+632 92
+632 103
+632 106
+632 117
+632 121
+632 127
+632 137
+632 140
+632 143
+632 162
+632 164
+632 172
+632 181
+632 191
+632 193
+632 197
+632 202
+632 205
+632 206
+632 211
+632 235
+632 240
+632 244
+632 245
+632 249
+632 265
+632 270
+632 273
+632 278
+632 279
+632 282
+632 283
+632 312
+632 324
+632 329
+632 339
+632 344
+632 354
+632 360
+632 373
+632 398
+632 403
+632 424
+632 427
+632 433
+632 435
+632 450
+632 479
+632 483
+632 496
+632 498
+632 512
+632 514
+632 520
+632 524
+632 526
+632 533
+632 536
+632 538
+632 542
+632 550
+632 551
+632 563
+632 577
+632 578
+632 589
+632 593
+632 599
+632 610
+632 614
+632 618
+632 621
+632 654
+632 657
+632 659
+632 664
+632 679
+632 682
+632 686
+632 687
+632 700
+632 706
+632 710
+632 717
+632 730
+632 739
+632 751
+632 763
+632 769
+632 771
+632 772
+632 787
+632 811
+632 822
+632 826
+632 838
+632 848
+632 865
+632 877
+632 878
+632 882
+632 883
+632 894
+632 907
+632 919
+632 921
+632 923
+632 925
+632 926
+632 929
+632 946
+632 947
+632 966
+632 976
+632 982
+632 995
+632 997
+632 1003
+632 1004
+632 1019
+632 1021
+633 4
+633 72
+633 86
+633 140
+633 143
+633 151
+633 187
+633 205
+633 206
+633 260
+633 265
+633 270
+633 273
+633 282
+633 293
+633 294
+633 302
+633 306
+633 312
+633 336
+633 344
+633 349
+633 360
+633 367
+633 373
+633 386
+633 391
+633 524
+633 526
+633 536
+633 542
+633 563
+633 569
+633 579
+633 593
+633 599
+633 629
+633 677
+633 679
+633 686
+633 710
+633 723
+633 742
+633 769
+633 798
+633 822
+633 826
+633 838
+633 841
+633 869
+633 891
+633 894
+633 898
+633 995
+633 997
+633 1004
+633 1021
+634 72
+634 131
+634 136
+634 158
+634 282
+634 328
+634 360
+634 373
+634 377
+634 386
+634 435
+634 526
+634 530
+634 542
+634 765
+634 923
+634 982
+635 60
+635 72
+635 185
+635 230
+635 329
+635 342
+635 360
+635 373
+635 377
+635 403
+635 413
+635 591
+635 662
+635 679
+635 732
+635 873
+635 999
+635 1021
+636 360
+636 822
+637 121
+637 156
+637 205
+637 211
+637 260
+637 270
+637 282
+637 360
+637 373
+637 386
+637 442
+637 487
+637 496
+637 510
+637 536
+637 565
+637 622
+637 675
+637 676
+638 158
+638 279
+638 479
+639 312
+639 539
+641 156
+641 260
+641 270
+641 360
+641 536
+641 648
+641 822
+643 164
+643 260
+643 413
+643 706
+643 860
+643 926
+643 976
+644 140
+644 167
+644 197
+644 260
+644 330
+644 345
+644 366
+644 373
+644 412
+644 437
+644 479
+644 496
+644 518
+644 520
+644 536
+644 542
+644 679
+644 707
+644 747
+644 781
+644 798
+644 839
+644 971
+644 1004
+645 615
+645 777
+646 158
+646 270
+646 330
+646 496
+646 707
+647 162
+647 265
+647 344
+647 360
+647 403
+647 496
+647 710
+647 774
+647 913
+648 2
+648 39
+648 86
+648 104
+648 140
+648 156
+648 160
+648 162
+648 226
+648 260
+648 270
+648 279
+648 288
+648 312
+648 344
+648 354
+648 360
+648 367
+648 377
+648 399
+648 412
+648 442
+648 479
+648 495
+648 532
+648 536
+648 539
+648 542
+648 593
+648 641
+648 655
+648 669
+648 679
+648 686
+648 750
+648 771
+648 781
+648 782
+648 787
+648 812
+648 822
+648 829
+648 838
+648 845
+648 881
+648 905
+648 907
+648 919
+648 948
+648 995
+649 205
+650 86
+650 121
+650 162
+650 185
+650 360
+650 373
+650 679
+650 700
+650 787
+650 790
+650 830
+650 864
+650 873
+650 877
+650 946
+651 2
+651 100
+651 217
+651 302
+651 563
+651 706
+651 781
+651 822
+652 72
+652 312
+652 360
+652 496
+652 661
+652 662
+652 701
+654 86
+654 127
+654 162
+654 240
+654 283
+654 344
+654 373
+654 403
+654 455
+654 479
+654 490
+654 536
+654 542
+654 583
+654 593
+654 632
+654 655
+654 692
+654 710
+654 714
+655 10
+655 22
+655 86
+655 140
+655 150
+655 162
+655 175
+655 206
+655 217
+655 235
+655 248
+655 260
+655 266
+655 267
+655 270
+655 279
+655 302
+655 305
+655 329
+655 344
+655 360
+655 366
+655 373
+655 386
+655 403
+655 416
+655 435
+655 496
+655 502
+655 503
+655 520
+655 524
+655 536
+655 542
+655 589
+655 622
+655 648
+655 654
+655 677
+655 696
+655 707
+655 778
+655 798
+655 800
+655 826
+655 828
+655 865
+655 905
+655 915
+655 921
+655 946
+655 956
+655 997
+656 86
+656 542
+656 738
+657 143
+657 342
+657 362
+657 632
+657 923
+658 30
+658 117
+658 994
+659 106
+659 156
+659 235
+659 264
+659 279
+659 307
+659 312
+659 318
+659 344
+659 360
+659 373
+659 391
+659 435
+659 442
+659 475
+659 487
+659 496
+659 514
+659 542
+659 577
+659 578
+659 583
+659 589
+659 593
+659 614
+659 632
+659 679
+659 719
+659 790
+659 826
+659 879
+659 894
+659 946
+659 954
+659 995
+659 1000
+659 1003
+659 1004
+660 127
+660 162
+660 205
+660 247
+660 260
+660 330
+660 391
+660 454
+660 506
+660 536
+660 565
+660 591
+660 593
+660 700
+660 740
+660 777
+660 812
+660 995
+660 1021
+660 1022
+661 2
+661 86
+661 97
+661 141
+661 162
+661 270
+661 299
+661 312
+661 329
+661 403
+661 482
+661 524
+661 526
+661 536
+661 542
+661 563
+661 573
+661 652
+661 679
+661 700
+661 717
+661 730
+661 733
+661 787
+661 882
+661 946
+661 997
+661 1006
+662 4
+662 7
+662 73
+662 86
+662 109
+662 117
+662 128
+662 140
+662 156
+662 159
+662 162
+662 164
+662 181
+662 205
+662 211
+662 246
+662 260
+662 270
+662 276
+662 279
+662 306
+662 311
+662 312
+662 344
+662 360
+662 366
+662 373
+662 380
+662 391
+662 405
+662 435
+662 479
+662 487
+662 491
+662 520
+662 536
+662 542
+662 569
+662 589
+662 599
+662 601
+662 606
+662 635
+662 652
+662 679
+662 686
+662 701
+662 707
+662 710
+662 730
+662 739
+662 763
+662 765
+662 800
+662 804
+662 812
+662 820
+662 822
+662 826
+662 830
+662 854
+662 881
+662 890
+662 921
+662 924
+662 926
+662 944
+662 995
+662 1019
+663 162
+663 358
+663 536
+663 570
+663 822
+664 6
+664 62
+664 86
+664 117
+664 151
+664 155
+664 162
+664 197
+664 206
+664 217
+664 260
+664 265
+664 270
+664 279
+664 342
+664 352
+664 366
+664 373
+664 403
+664 432
+664 433
+664 435
+664 445
+664 496
+664 524
+664 536
+664 542
+664 578
+664 579
+664 593
+664 594
+664 604
+664 629
+664 632
+664 665
+664 679
+664 693
+664 699
+664 701
+664 722
+664 791
+664 798
+664 822
+664 824
+664 830
+664 854
+664 862
+664 865
+664 882
+664 886
+664 894
+664 946
+664 970
+664 976
+664 994
+664 1019
+665 127
+665 373
+665 496
+665 526
+665 536
+665 664
+666 72
+666 175
+666 307
+666 383
+666 461
+666 536
+666 706
+666 869
+666 982
+667 260
+667 354
+668 191
+668 197
+668 537
+668 714
+668 798
+668 886
+668 901
+668 922
+669 164
+669 235
+669 435
+669 537
+669 648
+669 679
+669 779
+670 240
+670 279
+670 373
+670 496
+670 589
+670 610
+670 781
+670 860
+671 106
+671 215
+671 536
+671 542
+673 383
+673 976
+674 127
+675 217
+675 276
+675 279
+675 360
+675 520
+675 539
+675 637
+675 781
+675 882
+676 22
+676 155
+676 162
+676 205
+676 270
+676 279
+676 339
+676 542
+676 548
+676 637
+676 678
+676 822
+676 919
+676 946
+676 986
+677 6
+677 86
+677 120
+677 162
+677 219
+677 344
+677 360
+677 391
+677 461
+677 496
+677 536
+677 621
+677 633
+677 655
+677 700
+677 710
+677 751
+677 879
+677 882
+677 894
+677 992
+678 164
+678 279
+678 360
+678 487
+678 496
+678 529
+678 536
+678 676
+678 679
+678 700
+678 787
+678 822
+679 2
+679 6
+679 8
+679 12
+679 13
+679 20
+679 22
+679 25
+679 26
+679 30
+679 35
+679 43
+679 44
+679 45
+679 61
+679 72
+679 83
+679 85
+679 86
+679 87
+679 91
+679 97
+679 101
+679 106
+679 113
+679 117
+679 120
+679 121
+679 127
+679 131
+679 140
+679 141
+679 143
+679 145
+679 150
+679 153
+679 156
+679 159
+679 162
+679 164
+679 172
+679 176
+679 178
+679 184
+679 185
+679 187
+679 189
+679 191
+679 193
+679 197
+679 204
+679 205
+679 206
+679 209
+679 211
+679 215
+679 224
+679 226
+679 227
+679 235
+679 240
+679 242
+679 247
+679 249
+679 250
+679 251
+679 252
+679 253
+679 256
+679 260
+679 264
+679 267
+679 270
+679 273
+679 276
+679 279
+679 280
+679 282
+679 301
+679 307
+679 311
+679 312
+679 316
+679 322
+679 324
+679 326
+679 329
+679 330
+679 335
+679 339
+679 344
+679 345
+679 349
+679 350
+679 353
+679 354
+679 358
+679 360
+679 362
+679 366
+679 367
+679 368
+679 370
+679 373
+679 377
+679 380
+679 383
+679 385
+679 391
+679 398
+679 403
+679 405
+679 410
+679 425
+679 427
+679 435
+679 436
+679 437
+679 442
+679 459
+679 465
+679 473
+679 474
+679 475
+679 479
+679 483
+679 491
+679 496
+679 497
+679 513
+679 514
+679 520
+679 524
+679 526
+679 532
+679 533
+679 536
+679 537
+679 538
+679 539
+679 542
+679 551
+679 554
+679 562
+679 564
+679 565
+679 569
+679 573
+679 574
+679 578
+679 579
+679 585
+679 586
+679 589
+679 591
+679 593
+679 594
+679 596
+679 599
+679 604
+679 611
+679 615
+679 618
+679 632
+679 633
+679 635
+679 644
+679 648
+679 650
+679 659
+679 661
+679 662
+679 664
+679 669
+679 678
+679 686
+679 687
+679 692
+679 693
+679 696
+679 700
+679 701
+679 706
+679 707
+679 710
+679 711
+679 722
+679 725
+679 730
+679 733
+679 739
+679 748
+679 763
+679 765
+679 774
+679 776
+679 777
+679 781
+679 783
+679 787
+679 791
+679 800
+679 803
+679 809
+679 811
+679 819
+679 822
+679 826
+679 829
+679 837
+679 838
+679 839
+679 841
+679 848
+679 849
+679 852
+679 865
+679 869
+679 870
+679 873
+679 877
+679 880
+679 882
+679 883
+679 885
+679 888
+679 891
+679 894
+679 897
+679 901
+679 907
+679 909
+679 915
+679 916
+679 919
+679 923
+679 925
+679 929
+679 930
+679 946
+679 948
+679 950
+679 976
+679 980
+679 986
+679 990
+679 995
+679 998
+679 999
+679 1001
+679 1003
+679 1004
+679 1008
+679 1010
+679 1013
+679 1021
+680 270
+680 496
+680 822
+680 982
+681 819
+682 632
+684 260
+684 360
+685 86
+685 155
+685 164
+685 219
+685 270
+685 391
+685 536
+685 542
+685 701
+685 826
+685 907
+686 30
+686 35
+686 58
+686 63
+686 76
+686 86
+686 92
+686 117
+686 136
+686 140
+686 153
+686 164
+686 181
+686 190
+686 197
+686 205
+686 206
+686 219
+686 224
+686 248
+686 251
+686 252
+686 260
+686 264
+686 270
+686 278
+686 279
+686 282
+686 290
+686 294
+686 296
+686 303
+686 312
+686 329
+686 330
+686 334
+686 342
+686 344
+686 358
+686 360
+686 373
+686 413
+686 416
+686 421
+686 435
+686 471
+686 491
+686 495
+686 496
+686 504
+686 513
+686 517
+686 520
+686 536
+686 542
+686 551
+686 554
+686 556
+686 565
+686 573
+686 574
+686 577
+686 578
+686 579
+686 583
+686 589
+686 591
+686 593
+686 596
+686 606
+686 616
+686 632
+686 633
+686 648
+686 662
+686 679
+686 700
+686 706
+686 707
+686 710
+686 714
+686 717
+686 739
+686 763
+686 765
+686 772
+686 777
+686 779
+686 780
+686 781
+686 787
+686 810
+686 811
+686 822
+686 829
+686 838
+686 841
+686 873
+686 877
+686 882
+686 883
+686 891
+686 894
+686 897
+686 901
+686 905
+686 912
+686 923
+686 929
+686 943
+686 946
+686 947
+686 956
+686 976
+686 982
+686 985
+686 991
+686 994
+686 995
+686 1003
+686 1019
+687 2
+687 22
+687 86
+687 113
+687 117
+687 127
+687 140
+687 155
+687 162
+687 205
+687 250
+687 265
+687 270
+687 282
+687 327
+687 344
+687 360
+687 366
+687 367
+687 373
+687 377
+687 380
+687 432
+687 444
+687 495
+687 496
+687 530
+687 536
+687 542
+687 563
+687 579
+687 593
+687 595
+687 632
+687 679
+687 696
+687 700
+687 707
+687 769
+687 781
+687 787
+687 800
+687 822
+687 826
+687 838
+687 869
+687 894
+687 921
+687 948
+687 976
+687 982
+687 985
+687 986
+687 1004
+688 2
+688 86
+688 162
+688 206
+688 217
+688 260
+688 282
+688 360
+688 367
+688 427
+688 461
+688 487
+688 536
+688 692
+688 822
+691 487
+691 787
+692 2
+692 86
+692 117
+692 153
+692 155
+692 156
+692 158
+692 159
+692 205
+692 235
+692 260
+692 262
+692 267
+692 270
+692 279
+692 283
+692 330
+692 339
+692 344
+692 360
+692 367
+692 373
+692 378
+692 380
+692 409
+692 412
+692 437
+692 450
+692 472
+692 487
+692 496
+692 497
+692 510
+692 532
+692 536
+692 542
+692 563
+692 578
+692 583
+692 654
+692 679
+692 688
+692 696
+692 701
+692 730
+692 733
+692 740
+692 763
+692 774
+692 781
+692 787
+692 791
+692 798
+692 812
+692 822
+692 824
+692 869
+692 902
+692 907
+692 919
+692 923
+692 948
+692 973
+692 994
+692 1013
+692 1019
+692 1021
+693 22
+693 60
+693 100
+693 117
+693 140
+693 143
+693 155
+693 162
+693 164
+693 176
+693 185
+693 192
+693 195
+693 205
+693 206
+693 224
+693 253
+693 265
+693 279
+693 283
+693 312
+693 313
+693 344
+693 373
+693 405
+693 433
+693 435
+693 496
+693 513
+693 520
+693 536
+693 538
+693 542
+693 578
+693 583
+693 593
+693 611
+693 622
+693 664
+693 679
+693 707
+693 710
+693 717
+693 763
+693 781
+693 782
+693 801
+693 822
+693 826
+693 838
+693 839
+693 873
+693 878
+693 894
+693 896
+693 919
+693 954
+693 976
+693 980
+693 985
+693 994
+694 155
+696 2
+696 46
+696 83
+696 86
+696 127
+696 140
+696 143
+696 159
+696 162
+696 177
+696 197
+696 206
+696 240
+696 270
+696 279
+696 282
+696 312
+696 344
+696 366
+696 373
+696 375
+696 380
+696 386
+696 437
+696 495
+696 496
+696 520
+696 533
+696 536
+696 538
+696 621
+696 655
+696 679
+696 687
+696 692
+696 706
+696 707
+696 710
+696 763
+696 822
+696 826
+696 891
+696 894
+696 895
+696 901
+696 921
+696 964
+696 976
+696 985
+696 995
+696 1004
+697 2
+698 189
+698 270
+698 354
+698 373
+698 536
+698 756
+698 829
+698 946
+698 995
+699 86
+699 117
+699 129
+699 133
+699 172
+699 206
+699 254
+699 317
+699 373
+699 496
+699 503
+699 536
+699 617
+699 664
+699 701
+699 710
+699 883
+699 913
+699 985
+699 1008
+700 4
+700 22
+700 26
+700 35
+700 53
+700 60
+700 72
+700 83
+700 86
+700 97
+700 112
+700 113
+700 117
+700 140
+700 145
+700 158
+700 159
+700 162
+700 164
+700 196
+700 197
+700 205
+700 211
+700 221
+700 224
+700 235
+700 260
+700 270
+700 273
+700 279
+700 282
+700 290
+700 312
+700 319
+700 322
+700 329
+700 360
+700 373
+700 379
+700 382
+700 386
+700 391
+700 403
+700 410
+700 413
+700 435
+700 444
+700 466
+700 485
+700 495
+700 496
+700 502
+700 503
+700 511
+700 524
+700 530
+700 535
+700 536
+700 538
+700 542
+700 565
+700 573
+700 578
+700 583
+700 589
+700 591
+700 593
+700 610
+700 614
+700 632
+700 650
+700 660
+700 661
+700 677
+700 678
+700 679
+700 686
+700 687
+700 701
+700 706
+700 710
+700 717
+700 719
+700 722
+700 737
+700 746
+700 762
+700 763
+700 787
+700 788
+700 800
+700 801
+700 803
+700 811
+700 822
+700 826
+700 838
+700 860
+700 865
+700 869
+700 870
+700 874
+700 881
+700 883
+700 894
+700 897
+700 913
+700 925
+700 946
+700 949
+700 953
+700 966
+700 976
+700 989
+700 991
+700 995
+700 997
+700 1013
+700 1021
+701 2
+701 9
+701 20
+701 22
+701 39
+701 59
+701 72
+701 83
+701 86
+701 92
+701 106
+701 117
+701 127
+701 140
+701 141
+701 155
+701 159
+701 162
+701 164
+701 166
+701 196
+701 197
+701 205
+701 211
+701 224
+701 226
+701 233
+701 242
+701 252
+701 254
+701 263
+701 270
+701 279
+701 282
+701 299
+701 302
+701 318
+701 324
+701 328
+701 329
+701 344
+701 349
+701 350
+701 353
+701 360
+701 362
+701 373
+701 388
+701 398
+701 401
+701 402
+701 435
+701 461
+701 469
+701 479
+701 491
+701 495
+701 496
+701 514
+701 524
+701 526
+701 532
+701 536
+701 539
+701 542
+701 563
+701 564
+701 565
+701 568
+701 569
+701 578
+701 583
+701 589
+701 593
+701 594
+701 608
+701 610
+701 611
+701 616
+701 618
+701 629
+701 652
+701 662
+701 664
+701 679
+701 685
+701 692
+701 699
+701 700
+701 707
+701 732
+701 739
+701 751
+701 758
+701 765
+701 772
+701 777
+701 778
+701 787
+701 812
+701 822
+701 826
+701 838
+701 848
+701 876
+701 877
+701 896
+701 923
+701 946
+701 955
+701 973
+701 976
+701 986
+701 989
+701 1010
+701 1019
+701 1021
+704 158
+704 162
+704 252
+704 270
+704 278
+704 305
+704 393
+704 473
+704 536
+704 822
+704 826
+704 849
+704 905
+706 2
+706 6
+706 8
+706 22
+706 26
+706 60
+706 63
+706 72
+706 83
+706 86
+706 91
+706 117
+706 125
+706 127
+706 131
+706 136
+706 153
+706 155
+706 158
+706 162
+706 164
+706 172
+706 181
+706 191
+706 204
+706 205
+706 206
+706 211
+706 217
+706 220
+706 240
+706 260
+706 270
+706 278
+706 279
+706 282
+706 283
+706 288
+706 306
+706 308
+706 313
+706 322
+706 324
+706 327
+706 342
+706 349
+706 350
+706 360
+706 367
+706 372
+706 373
+706 403
+706 405
+706 409
+706 413
+706 428
+706 435
+706 463
+706 478
+706 479
+706 487
+706 490
+706 495
+706 496
+706 504
+706 509
+706 510
+706 511
+706 514
+706 521
+706 530
+706 533
+706 536
+706 538
+706 542
+706 563
+706 574
+706 577
+706 579
+706 583
+706 591
+706 593
+706 594
+706 605
+706 629
+706 632
+706 643
+706 651
+706 666
+706 679
+706 686
+706 696
+706 700
+706 707
+706 710
+706 725
+706 730
+706 772
+706 781
+706 782
+706 787
+706 791
+706 803
+706 805
+706 822
+706 826
+706 837
+706 869
+706 876
+706 879
+706 881
+706 882
+706 885
+706 894
+706 905
+706 946
+706 949
+706 952
+706 978
+706 982
+706 994
+706 995
+706 997
+706 1021
+707 2
+707 4
+707 7
+707 8
+707 21
+707 22
+707 24
+707 26
+707 53
+707 59
+707 72
+707 83
+707 86
+707 92
+707 103
+707 106
+707 109
+707 141
+707 155
+707 162
+707 164
+707 166
+707 178
+707 193
+707 197
+707 205
+707 217
+707 247
+707 250
+707 252
+707 260
+707 265
+707 278
+707 279
+707 289
+707 293
+707 299
+707 329
+707 344
+707 350
+707 351
+707 352
+707 354
+707 360
+707 367
+707 373
+707 383
+707 401
+707 464
+707 473
+707 475
+707 479
+707 487
+707 491
+707 495
+707 496
+707 504
+707 513
+707 520
+707 524
+707 526
+707 533
+707 536
+707 537
+707 538
+707 539
+707 542
+707 545
+707 563
+707 565
+707 573
+707 577
+707 578
+707 579
+707 583
+707 589
+707 591
+707 593
+707 594
+707 599
+707 610
+707 611
+707 644
+707 646
+707 655
+707 662
+707 679
+707 686
+707 687
+707 693
+707 696
+707 701
+707 706
+707 730
+707 739
+707 742
+707 755
+707 768
+707 772
+707 777
+707 779
+707 781
+707 786
+707 787
+707 798
+707 805
+707 822
+707 837
+707 865
+707 869
+707 877
+707 882
+707 887
+707 891
+707 894
+707 895
+707 898
+707 905
+707 932
+707 936
+707 946
+707 976
+707 979
+707 985
+707 994
+707 999
+707 1004
+707 1006
+707 1021
+708 22
+708 313
+708 382
+708 578
+709 217
+709 270
+709 763
+710 2
+710 6
+710 22
+710 72
+710 86
+710 106
+710 122
+710 140
+710 143
+710 150
+710 156
+710 162
+710 164
+710 175
+710 201
+710 205
+710 211
+710 215
+710 219
+710 224
+710 228
+710 235
+710 252
+710 260
+710 264
+710 265
+710 270
+710 279
+710 282
+710 299
+710 312
+710 317
+710 329
+710 344
+710 352
+710 354
+710 360
+710 362
+710 367
+710 373
+710 374
+710 375
+710 389
+710 390
+710 405
+710 413
+710 435
+710 440
+710 442
+710 479
+710 487
+710 496
+710 502
+710 503
+710 504
+710 510
+710 520
+710 524
+710 526
+710 536
+710 538
+710 542
+710 573
+710 574
+710 578
+710 589
+710 593
+710 610
+710 614
+710 621
+710 632
+710 633
+710 647
+710 654
+710 662
+710 677
+710 679
+710 686
+710 693
+710 696
+710 699
+710 700
+710 706
+710 725
+710 733
+710 739
+710 742
+710 746
+710 781
+710 786
+710 787
+710 805
+710 819
+710 822
+710 826
+710 830
+710 840
+710 846
+710 869
+710 877
+710 882
+710 883
+710 887
+710 894
+710 895
+710 896
+710 900
+710 907
+710 910
+710 919
+710 923
+710 946
+710 962
+710 964
+710 976
+710 978
+710 985
+710 989
+710 995
+710 997
+710 1004
+711 10
+711 64
+711 162
+711 496
+711 536
+711 596
+711 679
+711 976
+712 62
+712 260
+712 264
+712 278
+712 322
+712 524
+712 837
+712 838
+713 344
+713 353
+713 360
+713 536
+714 2
+714 86
+714 97
+714 127
+714 162
+714 279
+714 294
+714 329
+714 349
+714 366
+714 520
+714 536
+714 593
+714 654
+714 668
+714 686
+714 777
+714 985
+714 986
+715 2
+715 398
+715 803
+717 15
+717 43
+717 74
+717 86
+717 117
+717 158
+717 162
+717 172
+717 178
+717 248
+717 280
+717 300
+717 304
+717 312
+717 330
+717 342
+717 354
+717 360
+717 373
+717 380
+717 458
+717 479
+717 480
+717 487
+717 496
+717 513
+717 536
+717 542
+717 563
+717 577
+717 589
+717 607
+717 632
+717 661
+717 686
+717 693
+717 700
+717 719
+717 733
+717 787
+717 822
+717 826
+717 830
+717 838
+717 885
+717 891
+717 946
+717 966
+717 994
+717 1004
+717 1006
+719 2
+719 26
+719 39
+719 86
+719 206
+719 224
+719 240
+719 279
+719 373
+719 397
+719 530
+719 532
+719 659
+719 700
+719 717
+719 730
+719 781
+719 822
+719 873
+719 1021
+720 164
+720 270
+720 329
+720 360
+720 583
+720 910
+721 97
+721 158
+721 162
+721 197
+721 246
+721 322
+721 380
+721 422
+721 536
+721 542
+721 565
+721 583
+721 589
+721 787
+721 798
+721 882
+721 929
+721 986
+721 991
+722 86
+722 106
+722 115
+722 148
+722 162
+722 235
+722 279
+722 299
+722 344
+722 435
+722 496
+722 536
+722 538
+722 664
+722 679
+722 700
+722 873
+723 633
+724 159
+724 267
+724 290
+724 360
+724 542
+724 614
+725 2
+725 6
+725 22
+725 61
+725 72
+725 158
+725 265
+725 279
+725 373
+725 403
+725 464
+725 496
+725 536
+725 542
+725 571
+725 583
+725 679
+725 706
+725 710
+725 791
+725 826
+725 849
+725 877
+725 976
+725 995
+726 270
+726 373
+726 496
+726 536
+727 83
+727 279
+727 391
+728 22
+728 537
+728 822
+729 86
+729 345
+730 2
+730 22
+730 35
+730 53
+730 72
+730 86
+730 91
+730 117
+730 126
+730 131
+730 136
+730 140
+730 155
+730 162
+730 164
+730 175
+730 176
+730 197
+730 206
+730 211
+730 216
+730 248
+730 260
+730 270
+730 276
+730 279
+730 282
+730 285
+730 289
+730 290
+730 303
+730 312
+730 327
+730 329
+730 333
+730 344
+730 360
+730 367
+730 373
+730 377
+730 391
+730 405
+730 416
+730 427
+730 475
+730 479
+730 491
+730 495
+730 496
+730 512
+730 513
+730 514
+730 519
+730 520
+730 524
+730 532
+730 533
+730 536
+730 537
+730 539
+730 542
+730 545
+730 554
+730 558
+730 563
+730 565
+730 574
+730 579
+730 583
+730 589
+730 593
+730 610
+730 618
+730 621
+730 632
+730 661
+730 662
+730 679
+730 692
+730 706
+730 707
+730 719
+730 739
+730 740
+730 741
+730 765
+730 768
+730 771
+730 772
+730 800
+730 822
+730 826
+730 834
+730 862
+730 865
+730 869
+730 881
+730 882
+730 883
+730 894
+730 923
+730 947
+730 954
+730 966
+730 976
+730 994
+730 995
+730 1001
+732 2
+732 9
+732 151
+732 252
+732 279
+732 344
+732 351
+732 461
+732 536
+732 583
+732 621
+732 635
+732 701
+732 797
+732 920
+732 995
+733 61
+733 86
+733 117
+733 141
+733 172
+733 193
+733 197
+733 205
+733 215
+733 235
+733 270
+733 278
+733 279
+733 306
+733 312
+733 330
+733 333
+733 360
+733 367
+733 375
+733 380
+733 382
+733 391
+733 403
+733 421
+733 433
+733 496
+733 536
+733 542
+733 562
+733 565
+733 583
+733 605
+733 661
+733 679
+733 692
+733 710
+733 717
+733 747
+733 781
+733 790
+733 805
+733 819
+733 822
+733 849
+733 877
+733 966
+733 1019
+736 102
+736 526
+737 2
+737 74
+737 86
+737 162
+737 175
+737 224
+737 260
+737 270
+737 344
+737 496
+737 524
+737 700
+737 800
+737 826
+737 877
+737 923
+738 127
+738 573
+738 656
+738 822
+739 72
+739 86
+739 131
+739 143
+739 159
+739 162
+739 169
+739 240
+739 256
+739 270
+739 279
+739 282
+739 299
+739 316
+739 373
+739 375
+739 387
+739 391
+739 413
+739 421
+739 432
+739 495
+739 536
+739 539
+739 542
+739 591
+739 604
+739 611
+739 632
+739 662
+739 679
+739 686
+739 701
+739 707
+739 710
+739 730
+739 751
+739 765
+739 798
+739 812
+739 822
+739 882
+739 883
+739 919
+739 991
+739 1016
+740 2
+740 49
+740 72
+740 74
+740 86
+740 113
+740 162
+740 164
+740 181
+740 256
+740 269
+740 270
+740 279
+740 290
+740 319
+740 324
+740 330
+740 344
+740 354
+740 360
+740 373
+740 383
+740 410
+740 433
+740 483
+740 496
+740 498
+740 526
+740 536
+740 542
+740 578
+740 594
+740 605
+740 621
+740 660
+740 692
+740 730
+740 743
+740 763
+740 781
+740 787
+740 826
+740 830
+740 882
+740 894
+740 905
+740 907
+740 918
+740 976
+740 995
+740 998
+740 1006
+741 471
+741 542
+741 730
+742 6
+742 22
+742 86
+742 217
+742 250
+742 279
+742 322
+742 360
+742 391
+742 536
+742 539
+742 542
+742 633
+742 707
+742 710
+742 894
+742 934
+742 948
+742 995
+742 1010
+743 542
+743 740
+744 536
+744 905
+745 976
+746 322
+746 536
+746 700
+746 710
+747 22
+747 270
+747 373
+747 536
+747 644
+747 733
+748 6
+748 344
+748 542
+748 679
+748 750
+748 907
+750 140
+750 206
+750 305
+750 373
+750 427
+750 479
+750 536
+750 648
+750 748
+751 22
+751 100
+751 140
+751 185
+751 312
+751 329
+751 360
+751 373
+751 398
+751 479
+751 536
+751 542
+751 574
+751 589
+751 617
+751 632
+751 677
+751 701
+751 739
+751 822
+751 866
+751 905
+751 1021
+753 813
+754 4
+754 22
+755 319
+755 536
+755 542
+755 707
+756 111
+756 117
+756 181
+756 217
+756 260
+756 279
+756 281
+756 344
+756 352
+756 367
+756 373
+756 410
+756 532
+756 698
+756 822
+756 858
+756 869
+756 926
+756 971
+758 6
+758 205
+758 270
+758 536
+758 701
+759 162
+759 282
+760 539
+761 536
+762 536
+762 563
+762 700
+763 2
+763 4
+763 15
+763 22
+763 30
+763 43
+763 72
+763 86
+763 117
+763 127
+763 140
+763 142
+763 143
+763 145
+763 151
+763 153
+763 155
+763 159
+763 162
+763 164
+763 178
+763 181
+763 189
+763 197
+763 217
+763 218
+763 219
+763 221
+763 230
+763 235
+763 240
+763 243
+763 252
+763 260
+763 265
+763 267
+763 270
+763 279
+763 288
+763 299
+763 307
+763 312
+763 322
+763 329
+763 340
+763 344
+763 360
+763 362
+763 366
+763 373
+763 378
+763 386
+763 391
+763 410
+763 413
+763 435
+763 437
+763 444
+763 479
+763 487
+763 491
+763 496
+763 498
+763 509
+763 510
+763 512
+763 520
+763 524
+763 526
+763 532
+763 533
+763 536
+763 539
+763 542
+763 545
+763 564
+763 574
+763 579
+763 583
+763 589
+763 593
+763 601
+763 611
+763 614
+763 618
+763 632
+763 662
+763 679
+763 686
+763 692
+763 693
+763 696
+763 700
+763 709
+763 740
+763 771
+763 777
+763 781
+763 787
+763 798
+763 811
+763 812
+763 822
+763 826
+763 829
+763 865
+763 866
+763 869
+763 873
+763 882
+763 894
+763 896
+763 919
+763 932
+763 946
+763 970
+763 976
+763 994
+763 995
+763 997
+763 1004
+765 2
+765 83
+765 86
+765 100
+765 117
+765 121
+765 127
+765 137
+765 150
+765 155
+765 178
+765 197
+765 205
+765 206
+765 228
+765 235
+765 270
+765 279
+765 290
+765 312
+765 339
+765 344
+765 360
+765 362
+765 372
+765 373
+765 380
+765 405
+765 435
+765 496
+765 520
+765 530
+765 536
+765 542
+765 564
+765 577
+765 583
+765 593
+765 610
+765 634
+765 662
+765 679
+765 686
+765 701
+765 730
+765 739
+765 781
+765 787
+765 809
+765 822
+765 826
+765 866
+765 869
+765 877
+765 880
+765 881
+765 973
+765 994
+765 995
+766 251
+766 270
+766 296
+766 442
+766 882
+768 2
+768 97
+768 270
+768 360
+768 382
+768 391
+768 536
+768 707
+768 730
+769 2
+769 86
+769 140
+769 153
+769 197
+769 206
+769 301
+769 344
+769 450
+769 502
+769 524
+769 536
+769 594
+769 601
+769 632
+769 633
+769 687
+769 774
+769 778
+769 838
+769 915
+769 986
+770 155
+770 279
+770 496
+770 536
+770 869
+770 929
+771 43
+771 360
+771 427
+771 536
+771 632
+771 648
+771 730
+771 763
+771 781
+772 60
+772 106
+772 120
+772 140
+772 150
+772 162
+772 164
+772 193
+772 197
+772 205
+772 206
+772 217
+772 236
+772 250
+772 251
+772 260
+772 270
+772 279
+772 289
+772 349
+772 360
+772 367
+772 373
+772 391
+772 405
+772 422
+772 496
+772 536
+772 578
+772 583
+772 606
+772 614
+772 632
+772 686
+772 701
+772 706
+772 707
+772 730
+772 781
+772 820
+772 822
+772 882
+772 888
+772 907
+772 920
+772 976
+772 982
+773 326
+773 781
+773 826
+773 869
+773 923
+774 86
+774 121
+774 215
+774 279
+774 307
+774 342
+774 360
+774 437
+774 463
+774 520
+774 536
+774 581
+774 610
+774 615
+774 647
+774 679
+774 692
+774 769
+774 883
+776 329
+776 536
+776 679
+776 1004
+777 86
+777 92
+777 100
+777 117
+777 127
+777 162
+777 166
+777 266
+777 270
+777 279
+777 352
+777 536
+777 578
+777 614
+777 645
+777 660
+777 679
+777 686
+777 701
+777 707
+777 714
+777 763
+777 822
+777 826
+777 919
+778 86
+778 135
+778 140
+778 143
+778 206
+778 279
+778 308
+778 312
+778 465
+778 502
+778 536
+778 563
+778 574
+778 589
+778 655
+778 701
+778 769
+778 822
+778 946
+779 117
+779 240
+779 260
+779 279
+779 360
+779 365
+779 391
+779 413
+779 536
+779 578
+779 669
+779 686
+779 707
+779 819
+779 822
+779 869
+779 929
+779 939
+779 995
+780 22
+780 72
+780 247
+780 283
+780 496
+780 686
+780 781
+780 790
+781 2
+781 5
+781 22
+781 72
+781 79
+781 83
+781 86
+781 117
+781 120
+781 126
+781 136
+781 138
+781 140
+781 155
+781 158
+781 162
+781 164
+781 193
+781 197
+781 201
+781 224
+781 235
+781 244
+781 260
+781 267
+781 270
+781 278
+781 279
+781 282
+781 294
+781 299
+781 308
+781 312
+781 317
+781 319
+781 327
+781 330
+781 342
+781 344
+781 360
+781 362
+781 370
+781 373
+781 391
+781 410
+781 435
+781 437
+781 461
+781 463
+781 465
+781 479
+781 496
+781 498
+781 510
+781 513
+781 520
+781 532
+781 533
+781 536
+781 538
+781 539
+781 542
+781 545
+781 578
+781 579
+781 583
+781 589
+781 591
+781 644
+781 648
+781 651
+781 670
+781 675
+781 679
+781 686
+781 687
+781 692
+781 693
+781 706
+781 707
+781 710
+781 719
+781 733
+781 740
+781 763
+781 765
+781 771
+781 772
+781 773
+781 780
+781 787
+781 798
+781 800
+781 822
+781 826
+781 829
+781 837
+781 869
+781 882
+781 883
+781 887
+781 910
+781 923
+781 929
+781 934
+781 946
+781 949
+781 954
+781 971
+781 982
+781 985
+781 986
+781 994
+781 995
+781 1000
+781 1019
+781 1021
+782 22
+782 79
+782 97
+782 172
+782 181
+782 211
+782 322
+782 353
+782 367
+782 373
+782 383
+782 475
+782 524
+782 536
+782 578
+782 593
+782 648
+782 693
+782 706
+782 837
+782 923
+783 86
+783 243
+783 312
+783 536
+783 679
+784 141
+784 260
+784 279
+785 86
+785 205
+785 260
+785 270
+785 360
+785 536
+785 594
+785 829
+785 985
+786 86
+786 155
+786 159
+786 197
+786 205
+786 270
+786 487
+786 536
+786 583
+786 707
+786 710
+786 822
+786 966
+787 2
+787 20
+787 22
+787 26
+787 67
+787 74
+787 86
+787 96
+787 97
+787 107
+787 117
+787 127
+787 131
+787 136
+787 159
+787 162
+787 164
+787 172
+787 181
+787 205
+787 235
+787 240
+787 243
+787 247
+787 252
+787 264
+787 270
+787 273
+787 278
+787 279
+787 282
+787 283
+787 288
+787 294
+787 305
+787 313
+787 327
+787 329
+787 344
+787 353
+787 354
+787 360
+787 366
+787 372
+787 373
+787 377
+787 391
+787 416
+787 427
+787 435
+787 436
+787 437
+787 448
+787 491
+787 496
+787 498
+787 513
+787 520
+787 524
+787 526
+787 530
+787 532
+787 536
+787 537
+787 538
+787 540
+787 542
+787 565
+787 569
+787 574
+787 578
+787 579
+787 583
+787 589
+787 591
+787 593
+787 605
+787 611
+787 629
+787 632
+787 648
+787 650
+787 661
+787 678
+787 679
+787 686
+787 687
+787 691
+787 692
+787 700
+787 701
+787 706
+787 707
+787 710
+787 717
+787 721
+787 740
+787 763
+787 765
+787 781
+787 798
+787 800
+787 813
+787 822
+787 826
+787 834
+787 843
+787 862
+787 865
+787 869
+787 882
+787 889
+787 907
+787 919
+787 920
+787 925
+787 929
+787 948
+787 966
+787 976
+787 986
+787 991
+787 995
+787 1006
+787 1021
+788 373
+788 496
+788 502
+788 542
+788 700
+789 538
+790 4
+790 30
+790 72
+790 162
+790 197
+790 270
+790 299
+790 322
+790 324
+790 583
+790 650
+790 659
+790 733
+790 780
+790 891
+790 919
+790 946
+790 948
+791 2
+791 22
+791 26
+791 67
+791 72
+791 79
+791 86
+791 121
+791 136
+791 148
+791 153
+791 155
+791 162
+791 164
+791 206
+791 211
+791 220
+791 240
+791 242
+791 270
+791 279
+791 290
+791 312
+791 324
+791 329
+791 338
+791 348
+791 354
+791 362
+791 373
+791 380
+791 416
+791 421
+791 436
+791 479
+791 520
+791 521
+791 524
+791 536
+791 564
+791 574
+791 578
+791 605
+791 664
+791 679
+791 692
+791 706
+791 725
+791 798
+791 806
+791 809
+791 812
+791 822
+791 882
+791 907
+791 920
+791 923
+791 929
+791 946
+791 986
+791 1004
+791 1021
+796 34
+796 86
+796 164
+796 181
+796 270
+796 360
+796 536
+797 164
+797 532
+797 732
+797 993
+798 2
+798 5
+798 74
+798 151
+798 162
+798 164
+798 172
+798 178
+798 197
+798 205
+798 206
+798 235
+798 270
+798 279
+798 312
+798 313
+798 322
+798 326
+798 339
+798 349
+798 360
+798 370
+798 373
+798 435
+798 463
+798 479
+798 496
+798 503
+798 520
+798 536
+798 542
+798 573
+798 578
+798 589
+798 593
+798 604
+798 621
+798 633
+798 644
+798 655
+798 664
+798 668
+798 692
+798 707
+798 721
+798 739
+798 763
+798 781
+798 787
+798 791
+798 822
+798 826
+798 891
+798 894
+798 907
+798 944
+798 1021
+800 2
+800 117
+800 131
+800 151
+800 156
+800 164
+800 185
+800 197
+800 250
+800 279
+800 280
+800 294
+800 299
+800 360
+800 373
+800 376
+800 383
+800 413
+800 427
+800 481
+800 487
+800 491
+800 496
+800 520
+800 524
+800 536
+800 542
+800 581
+800 593
+800 610
+800 655
+800 662
+800 679
+800 687
+800 700
+800 730
+800 737
+800 781
+800 787
+800 811
+800 822
+800 829
+800 866
+800 883
+800 894
+800 919
+800 982
+800 997
+801 83
+801 164
+801 206
+801 265
+801 270
+801 279
+801 435
+801 536
+801 583
+801 693
+801 700
+801 862
+801 976
+801 1021
+802 151
+802 360
+802 435
+803 162
+803 212
+803 294
+803 322
+803 342
+803 360
+803 366
+803 373
+803 410
+803 465
+803 517
+803 539
+803 542
+803 562
+803 569
+803 679
+803 700
+803 706
+803 715
+803 873
+804 662
+805 72
+805 86
+805 162
+805 206
+805 250
+805 266
+805 279
+805 294
+805 312
+805 322
+805 362
+805 542
+805 583
+805 706
+805 707
+805 710
+805 733
+805 829
+805 982
+805 986
+805 1010
+805 1021
+806 483
+806 791
+806 882
+808 279
+808 282
+808 348
+808 536
+808 611
+808 822
+809 22
+809 72
+809 86
+809 206
+809 260
+809 270
+809 279
+809 326
+809 373
+809 458
+809 536
+809 538
+809 593
+809 627
+809 679
+809 765
+809 791
+809 830
+809 920
+809 946
+809 1021
+810 166
+810 496
+810 686
+810 849
+811 86
+811 127
+811 145
+811 155
+811 162
+811 164
+811 270
+811 272
+811 289
+811 290
+811 485
+811 536
+811 565
+811 632
+811 679
+811 686
+811 700
+811 763
+811 800
+811 915
+812 10
+812 162
+812 178
+812 289
+812 362
+812 373
+812 496
+812 510
+812 536
+812 648
+812 660
+812 662
+812 692
+812 701
+812 739
+812 763
+812 791
+812 894
+812 929
+812 1021
+813 140
+813 162
+813 279
+813 313
+813 360
+813 432
+813 490
+813 586
+813 753
+813 787
+816 2
+816 117
+816 151
+816 164
+816 205
+816 279
+816 282
+816 312
+816 403
+816 496
+816 524
+816 536
+816 537
+816 539
+816 583
+816 838
+816 885
+816 947
+816 976
+816 1010
+817 538
+819 60
+819 72
+819 86
+819 117
+819 149
+819 162
+819 197
+819 228
+819 264
+819 270
+819 308
+819 322
+819 344
+819 353
+819 360
+819 373
+819 398
+819 436
+819 465
+819 470
+819 496
+819 524
+819 536
+819 542
+819 574
+819 577
+819 583
+819 589
+819 604
+819 679
+819 681
+819 710
+819 733
+819 779
+819 822
+819 829
+819 854
+819 1019
+820 496
+820 545
+820 662
+820 772
+822 2
+822 4
+822 16
+822 22
+822 35
+822 39
+822 44
+822 58
+822 59
+822 60
+822 62
+822 72
+822 83
+822 86
+822 91
+822 97
+822 103
+822 104
+822 109
+822 112
+822 117
+822 120
+822 126
+822 127
+822 131
+822 140
+822 153
+822 154
+822 155
+822 158
+822 159
+822 162
+822 164
+822 167
+822 171
+822 172
+822 175
+822 178
+822 181
+822 185
+822 191
+822 192
+822 193
+822 196
+822 197
+822 205
+822 206
+822 211
+822 217
+822 220
+822 221
+822 228
+822 237
+822 240
+822 247
+822 250
+822 252
+822 254
+822 258
+822 260
+822 263
+822 264
+822 265
+822 267
+822 270
+822 271
+822 276
+822 277
+822 278
+822 279
+822 280
+822 282
+822 285
+822 289
+822 290
+822 299
+822 300
+822 304
+822 306
+822 312
+822 317
+822 319
+822 323
+822 324
+822 326
+822 329
+822 330
+822 338
+822 339
+822 344
+822 345
+822 348
+822 349
+822 350
+822 354
+822 360
+822 362
+822 366
+822 367
+822 370
+822 373
+822 375
+822 379
+822 380
+822 383
+822 386
+822 391
+822 398
+822 403
+822 405
+822 413
+822 416
+822 427
+822 429
+822 431
+822 432
+822 433
+822 435
+822 437
+822 439
+822 442
+822 443
+822 444
+822 448
+822 458
+822 461
+822 464
+822 471
+822 474
+822 476
+822 479
+822 487
+822 495
+822 496
+822 498
+822 510
+822 512
+822 517
+822 520
+822 524
+822 526
+822 533
+822 536
+822 537
+822 538
+822 539
+822 541
+822 542
+822 554
+822 563
+822 565
+822 568
+822 569
+822 573
+822 574
+822 575
+822 577
+822 578
+822 579
+822 583
+822 585
+822 588
+822 589
+822 591
+822 593
+822 594
+822 595
+822 596
+822 599
+822 605
+822 610
+822 615
+822 618
+822 621
+822 626
+822 629
+822 632
+822 633
+822 636
+822 641
+822 648
+822 651
+822 662
+822 663
+822 664
+822 676
+822 678
+822 679
+822 680
+822 686
+822 687
+822 688
+822 692
+822 693
+822 696
+822 700
+822 701
+822 704
+822 706
+822 707
+822 710
+822 717
+822 719
+822 728
+822 730
+822 733
+822 738
+822 739
+822 751
+822 756
+822 763
+822 765
+822 772
+822 777
+822 778
+822 779
+822 781
+822 786
+822 787
+822 791
+822 798
+822 800
+822 808
+822 819
+822 823
+822 826
+822 829
+822 837
+822 838
+822 839
+822 843
+822 846
+822 849
+822 853
+822 860
+822 862
+822 865
+822 869
+822 870
+822 873
+822 876
+822 878
+822 880
+822 881
+822 882
+822 889
+822 890
+822 894
+822 897
+822 901
+822 905
+822 907
+822 913
+822 915
+822 919
+822 921
+822 929
+822 930
+822 932
+822 946
+822 947
+822 948
+822 962
+822 966
+822 976
+822 985
+822 986
+822 993
+822 994
+822 995
+822 999
+822 1003
+822 1004
+822 1006
+822 1010
+822 1011
+822 1019
+822 1021
+823 86
+823 217
+823 360
+823 554
+823 822
+823 865
+824 344
+824 664
+824 692
+824 982
+824 1000
+826 2
+826 3
+826 9
+826 24
+826 34
+826 62
+826 72
+826 73
+826 79
+826 86
+826 97
+826 104
+826 106
+826 112
+826 117
+826 127
+826 131
+826 136
+826 140
+826 148
+826 162
+826 164
+826 165
+826 166
+826 193
+826 194
+826 197
+826 205
+826 206
+826 217
+826 235
+826 244
+826 260
+826 265
+826 266
+826 267
+826 270
+826 279
+826 282
+826 283
+826 289
+826 290
+826 317
+826 327
+826 329
+826 338
+826 339
+826 342
+826 344
+826 345
+826 346
+826 354
+826 360
+826 367
+826 380
+826 386
+826 391
+826 408
+826 413
+826 435
+826 436
+826 442
+826 445
+826 450
+826 463
+826 464
+826 476
+826 479
+826 487
+826 491
+826 496
+826 497
+826 502
+826 519
+826 520
+826 524
+826 536
+826 538
+826 541
+826 542
+826 573
+826 574
+826 578
+826 583
+826 588
+826 589
+826 593
+826 611
+826 614
+826 632
+826 633
+826 655
+826 659
+826 662
+826 679
+826 685
+826 687
+826 693
+826 696
+826 700
+826 701
+826 704
+826 706
+826 710
+826 717
+826 725
+826 730
+826 737
+826 740
+826 763
+826 765
+826 773
+826 777
+826 781
+826 787
+826 798
+826 822
+826 829
+826 848
+826 854
+826 857
+826 866
+826 869
+826 876
+826 881
+826 882
+826 888
+826 894
+826 898
+826 907
+826 909
+826 923
+826 939
+826 948
+826 976
+826 986
+826 994
+826 995
+826 1010
+826 1021
+828 536
+828 655
+829 2
+829 6
+829 30
+829 86
+829 127
+829 148
+829 165
+829 190
+829 264
+829 265
+829 267
+829 270
+829 279
+829 327
+829 344
+829 345
+829 354
+829 362
+829 373
+829 386
+829 403
+829 432
+829 442
+829 465
+829 495
+829 496
+829 504
+829 512
+829 514
+829 530
+829 536
+829 574
+829 583
+829 611
+829 648
+829 679
+829 686
+829 698
+829 763
+829 781
+829 785
+829 800
+829 805
+829 819
+829 822
+829 826
+829 865
+829 869
+829 877
+829 891
+829 929
+829 970
+830 22
+830 60
+830 72
+830 97
+830 112
+830 117
+830 131
+830 136
+830 140
+830 141
+830 162
+830 189
+830 205
+830 213
+830 222
+830 247
+830 260
+830 265
+830 270
+830 307
+830 362
+830 385
+830 390
+830 407
+830 430
+830 433
+830 449
+830 450
+830 463
+830 479
+830 483
+830 487
+830 495
+830 536
+830 538
+830 539
+830 542
+830 565
+830 594
+830 650
+830 662
+830 664
+830 710
+830 717
+830 740
+830 809
+830 838
+830 860
+830 894
+830 923
+830 995
+830 1021
+831 329
+834 487
+834 730
+834 787
+836 260
+836 536
+837 2
+837 17
+837 22
+837 86
+837 117
+837 120
+837 127
+837 158
+837 169
+837 197
+837 209
+837 222
+837 235
+837 244
+837 253
+837 260
+837 270
+837 279
+837 282
+837 324
+837 342
+837 360
+837 373
+837 405
+837 422
+837 455
+837 466
+837 496
+837 536
+837 542
+837 563
+837 578
+837 611
+837 679
+837 706
+837 707
+837 712
+837 781
+837 782
+837 822
+837 881
+837 882
+837 887
+837 905
+837 907
+837 929
+837 936
+837 985
+838 4
+838 6
+838 22
+838 86
+838 101
+838 131
+838 136
+838 162
+838 164
+838 235
+838 270
+838 279
+838 282
+838 308
+838 310
+838 312
+838 329
+838 360
+838 373
+838 427
+838 439
+838 494
+838 496
+838 536
+838 611
+838 632
+838 633
+838 648
+838 679
+838 686
+838 687
+838 693
+838 700
+838 701
+838 712
+838 717
+838 769
+838 816
+838 822
+838 830
+838 853
+838 869
+838 882
+838 894
+838 897
+838 913
+838 929
+838 966
+838 970
+838 976
+838 986
+838 995
+839 72
+839 155
+839 156
+839 164
+839 219
+839 339
+839 391
+839 400
+839 403
+839 416
+839 510
+839 533
+839 536
+839 542
+839 589
+839 630
+839 644
+839 679
+839 693
+839 822
+839 877
+839 882
+839 985
+840 193
+840 260
+840 270
+840 373
+840 487
+840 536
+840 710
+841 6
+841 136
+841 162
+841 270
+841 312
+841 329
+841 360
+841 398
+841 442
+841 496
+841 532
+841 536
+841 542
+841 589
+841 633
+841 679
+841 686
+841 882
+841 883
+841 966
+841 976
+843 787
+843 822
+843 898
+844 360
+844 435
+844 495
+844 891
+845 86
+845 267
+845 648
+845 1004
+846 72
+846 86
+846 131
+846 162
+846 181
+846 193
+846 197
+846 267
+846 373
+846 409
+846 495
+846 589
+846 710
+846 822
+846 882
+846 886
+846 985
+847 270
+847 329
+847 536
+847 542
+847 870
+848 127
+848 148
+848 279
+848 339
+848 532
+848 536
+848 542
+848 632
+848 679
+848 701
+848 826
+848 854
+848 865
+848 948
+848 966
+849 22
+849 26
+849 536
+849 542
+849 578
+849 589
+849 679
+849 704
+849 725
+849 733
+849 810
+849 822
+849 869
+849 870
+850 561
+851 536
+852 22
+852 158
+852 181
+852 196
+852 380
+852 479
+852 606
+852 679
+853 279
+853 318
+853 322
+853 433
+853 536
+853 578
+853 822
+853 838
+853 986
+854 251
+854 360
+854 366
+854 391
+854 496
+854 662
+854 664
+854 819
+854 826
+854 848
+854 994
+854 995
+856 256
+856 583
+857 140
+857 282
+857 826
+857 1007
+858 593
+858 756
+858 976
+858 1002
+859 62
+859 317
+860 86
+860 136
+860 164
+860 197
+860 235
+860 373
+860 409
+860 432
+860 526
+860 536
+860 554
+860 565
+860 614
+860 643
+860 670
+860 700
+860 822
+860 830
+860 907
+860 992
+860 995
+862 140
+862 143
+862 235
+862 269
+862 270
+862 360
+862 427
+862 536
+862 610
+862 664
+862 730
+862 787
+862 801
+862 822
+862 919
+862 985
+862 1010
+862 1021
+863 206
+864 127
+864 164
+864 583
+864 650
+864 1004
+865 86
+865 97
+865 121
+865 150
+865 162
+865 175
+865 205
+865 217
+865 250
+865 252
+865 260
+865 265
+865 270
+865 279
+865 288
+865 307
+865 324
+865 344
+865 360
+865 362
+865 373
+865 380
+865 479
+865 496
+865 520
+865 536
+865 569
+865 579
+865 583
+865 589
+865 618
+865 632
+865 655
+865 664
+865 679
+865 700
+865 707
+865 730
+865 763
+865 787
+865 822
+865 823
+865 829
+865 848
+865 879
+865 888
+865 891
+865 926
+865 929
+865 946
+865 949
+865 976
+865 986
+865 1010
+865 1021
+866 86
+866 117
+866 162
+866 228
+866 412
+866 442
+866 536
+866 751
+866 763
+866 765
+866 800
+866 826
+866 946
+867 127
+867 153
+867 278
+867 536
+867 578
+868 102
+868 279
+868 520
+868 536
+868 583
+868 1021
+869 2
+869 20
+869 22
+869 60
+869 72
+869 80
+869 83
+869 86
+869 92
+869 100
+869 106
+869 117
+869 127
+869 140
+869 155
+869 162
+869 171
+869 178
+869 191
+869 195
+869 196
+869 197
+869 205
+869 218
+869 228
+869 230
+869 235
+869 247
+869 250
+869 264
+869 265
+869 270
+869 276
+869 279
+869 282
+869 294
+869 312
+869 322
+869 342
+869 344
+869 345
+869 352
+869 358
+869 360
+869 373
+869 380
+869 391
+869 413
+869 435
+869 461
+869 475
+869 479
+869 482
+869 491
+869 496
+869 524
+869 526
+869 533
+869 536
+869 538
+869 539
+869 542
+869 550
+869 552
+869 563
+869 565
+869 573
+869 578
+869 583
+869 585
+869 589
+869 591
+869 594
+869 605
+869 611
+869 618
+869 633
+869 666
+869 679
+869 687
+869 692
+869 700
+869 706
+869 707
+869 710
+869 730
+869 756
+869 763
+869 765
+869 770
+869 773
+869 779
+869 781
+869 787
+869 822
+869 826
+869 829
+869 838
+869 849
+869 873
+869 882
+869 883
+869 894
+869 905
+869 916
+869 923
+869 937
+869 946
+869 948
+869 966
+869 976
+869 986
+869 994
+869 1003
+869 1010
+869 1021
+870 5
+870 67
+870 140
+870 162
+870 224
+870 279
+870 282
+870 360
+870 520
+870 533
+870 536
+870 593
+870 611
+870 679
+870 700
+870 822
+870 847
+870 849
+870 976
+871 0
+871 83
+871 126
+871 573
+873 86
+873 126
+873 162
+873 164
+873 172
+873 181
+873 235
+873 252
+873 270
+873 329
+873 339
+873 360
+873 413
+873 431
+873 454
+873 479
+873 520
+873 536
+873 589
+873 593
+873 610
+873 635
+873 650
+873 679
+873 686
+873 693
+873 719
+873 722
+873 763
+873 803
+873 822
+873 869
+873 907
+873 929
+873 976
+873 994
+874 260
+874 433
+874 700
+875 86
+875 162
+875 267
+875 273
+875 279
+876 67
+876 83
+876 86
+876 117
+876 137
+876 155
+876 206
+876 267
+876 360
+876 391
+876 536
+876 563
+876 589
+876 701
+876 706
+876 822
+876 826
+876 1004
+876 1010
+877 7
+877 8
+877 21
+877 86
+877 127
+877 135
+877 140
+877 155
+877 162
+877 164
+877 205
+877 206
+877 211
+877 235
+877 260
+877 270
+877 277
+877 279
+877 282
+877 294
+877 329
+877 344
+877 360
+877 366
+877 373
+877 403
+877 429
+877 479
+877 496
+877 526
+877 530
+877 536
+877 542
+877 569
+877 589
+877 632
+877 650
+877 679
+877 686
+877 701
+877 707
+877 710
+877 725
+877 733
+877 737
+877 765
+877 829
+877 839
+877 880
+877 894
+877 946
+877 976
+877 995
+877 1004
+877 1021
+878 20
+878 30
+878 59
+878 162
+878 197
+878 205
+878 260
+878 270
+878 312
+878 536
+878 632
+878 693
+878 822
+878 885
+878 898
+878 952
+879 102
+879 260
+879 279
+879 322
+879 344
+879 350
+879 391
+879 524
+879 536
+879 621
+879 659
+879 677
+879 706
+879 865
+879 946
+879 1003
+880 26
+880 162
+880 270
+880 319
+880 329
+880 360
+880 373
+880 435
+880 502
+880 514
+880 536
+880 542
+880 591
+880 679
+880 765
+880 822
+880 877
+880 943
+880 1021
+881 2
+881 10
+881 20
+881 33
+881 53
+881 72
+881 112
+881 120
+881 162
+881 167
+881 193
+881 196
+881 206
+881 211
+881 235
+881 256
+881 265
+881 270
+881 279
+881 290
+881 294
+881 330
+881 354
+881 387
+881 422
+881 435
+881 436
+881 437
+881 455
+881 520
+881 524
+881 536
+881 538
+881 539
+881 542
+881 589
+881 593
+881 623
+881 648
+881 662
+881 700
+881 706
+881 730
+881 765
+881 822
+881 826
+881 837
+881 919
+881 926
+881 946
+881 948
+881 976
+881 995
+881 999
+881 1010
+882 2
+882 22
+882 25
+882 27
+882 39
+882 65
+882 72
+882 86
+882 131
+882 136
+882 140
+882 153
+882 154
+882 155
+882 158
+882 161
+882 162
+882 164
+882 171
+882 172
+882 175
+882 178
+882 191
+882 197
+882 205
+882 211
+882 218
+882 228
+882 235
+882 260
+882 264
+882 265
+882 267
+882 269
+882 270
+882 278
+882 279
+882 282
+882 285
+882 290
+882 296
+882 299
+882 308
+882 312
+882 322
+882 339
+882 344
+882 348
+882 360
+882 366
+882 367
+882 373
+882 375
+882 391
+882 413
+882 416
+882 421
+882 427
+882 435
+882 439
+882 443
+882 475
+882 479
+882 496
+882 497
+882 515
+882 519
+882 520
+882 524
+882 530
+882 532
+882 536
+882 538
+882 542
+882 564
+882 565
+882 569
+882 583
+882 589
+882 591
+882 593
+882 596
+882 601
+882 608
+882 610
+882 614
+882 632
+882 661
+882 664
+882 675
+882 677
+882 679
+882 686
+882 706
+882 707
+882 710
+882 721
+882 730
+882 739
+882 740
+882 763
+882 766
+882 772
+882 781
+882 787
+882 791
+882 806
+882 822
+882 826
+882 837
+882 838
+882 839
+882 841
+882 846
+882 869
+882 895
+882 898
+882 907
+882 918
+882 919
+882 920
+882 926
+882 929
+882 946
+882 958
+882 966
+882 976
+882 985
+882 986
+882 995
+882 1003
+882 1008
+882 1010
+882 1019
+882 1021
+883 2
+883 13
+883 24
+883 86
+883 126
+883 141
+883 155
+883 156
+883 279
+883 290
+883 294
+883 312
+883 329
+883 360
+883 433
+883 440
+883 469
+883 471
+883 479
+883 496
+883 511
+883 521
+883 536
+883 550
+883 552
+883 556
+883 578
+883 606
+883 629
+883 632
+883 679
+883 686
+883 699
+883 700
+883 710
+883 730
+883 739
+883 774
+883 781
+883 800
+883 841
+883 869
+883 894
+883 946
+883 982
+883 994
+883 997
+883 999
+883 1004
+884 205
+884 270
+884 279
+885 150
+885 373
+885 536
+885 589
+885 679
+885 706
+885 717
+885 816
+885 878
+885 995
+886 106
+886 140
+886 155
+886 162
+886 270
+886 302
+886 308
+886 459
+886 496
+886 530
+886 536
+886 664
+886 668
+886 846
+886 891
+886 964
+887 2
+887 22
+887 72
+887 162
+887 222
+887 264
+887 542
+887 611
+887 707
+887 710
+887 781
+887 837
+888 140
+888 205
+888 312
+888 679
+888 772
+888 826
+888 865
+889 156
+889 162
+889 250
+889 252
+889 270
+889 273
+889 299
+889 373
+889 413
+889 536
+889 563
+889 573
+889 621
+889 787
+889 822
+889 946
+889 995
+889 1004
+890 162
+890 260
+890 279
+890 373
+890 662
+890 822
+890 976
+891 86
+891 112
+891 127
+891 131
+891 138
+891 162
+891 191
+891 205
+891 206
+891 270
+891 279
+891 282
+891 294
+891 312
+891 329
+891 342
+891 344
+891 362
+891 373
+891 391
+891 497
+891 506
+891 517
+891 533
+891 536
+891 539
+891 542
+891 554
+891 573
+891 579
+891 583
+891 591
+891 593
+891 606
+891 633
+891 679
+891 686
+891 696
+891 707
+891 717
+891 790
+891 798
+891 829
+891 844
+891 865
+891 886
+891 905
+891 946
+891 952
+891 966
+891 978
+891 986
+891 994
+891 997
+894 2
+894 22
+894 26
+894 30
+894 43
+894 86
+894 92
+894 100
+894 117
+894 125
+894 127
+894 140
+894 141
+894 143
+894 152
+894 153
+894 158
+894 162
+894 164
+894 178
+894 181
+894 185
+894 191
+894 193
+894 196
+894 205
+894 206
+894 217
+894 224
+894 235
+894 250
+894 260
+894 264
+894 270
+894 279
+894 282
+894 291
+894 312
+894 313
+894 321
+894 329
+894 344
+894 349
+894 350
+894 354
+894 360
+894 362
+894 366
+894 372
+894 373
+894 374
+894 378
+894 386
+894 391
+894 413
+894 423
+894 427
+894 435
+894 441
+894 474
+894 479
+894 491
+894 496
+894 502
+894 513
+894 520
+894 524
+894 536
+894 541
+894 542
+894 546
+894 550
+894 569
+894 578
+894 579
+894 583
+894 589
+894 593
+894 596
+894 600
+894 611
+894 618
+894 632
+894 633
+894 659
+894 664
+894 677
+894 679
+894 686
+894 687
+894 693
+894 696
+894 700
+894 706
+894 707
+894 710
+894 730
+894 740
+894 742
+894 763
+894 798
+894 800
+894 812
+894 822
+894 826
+894 830
+894 838
+894 869
+894 877
+894 883
+894 919
+894 921
+894 929
+894 946
+894 963
+894 966
+894 976
+894 985
+894 989
+894 1002
+894 1003
+894 1004
+894 1006
+894 1021
+895 155
+895 162
+895 247
+895 435
+895 696
+895 707
+895 710
+895 882
+896 43
+896 140
+896 162
+896 197
+896 306
+896 373
+896 496
+896 520
+896 536
+896 563
+896 583
+896 618
+896 693
+896 701
+896 710
+896 763
+896 946
+896 952
+896 978
+896 995
+896 1008
+897 117
+897 226
+897 435
+897 496
+897 679
+897 686
+897 700
+897 822
+897 838
+898 60
+898 140
+898 178
+898 299
+898 312
+898 373
+898 504
+898 536
+898 538
+898 550
+898 591
+898 618
+898 633
+898 707
+898 826
+898 843
+898 878
+898 882
+898 923
+898 985
+900 279
+900 520
+900 710
+901 26
+901 270
+901 532
+901 578
+901 579
+901 668
+901 679
+901 686
+901 696
+901 822
+902 692
+903 164
+903 193
+903 270
+903 312
+903 351
+903 373
+903 403
+903 542
+905 22
+905 35
+905 86
+905 117
+905 155
+905 162
+905 164
+905 217
+905 252
+905 264
+905 279
+905 282
+905 290
+905 326
+905 342
+905 354
+905 360
+905 373
+905 391
+905 479
+905 481
+905 496
+905 526
+905 536
+905 542
+905 578
+905 589
+905 594
+905 648
+905 655
+905 686
+905 704
+905 706
+905 707
+905 740
+905 744
+905 751
+905 822
+905 837
+905 869
+905 891
+905 909
+905 919
+905 946
+905 986
+905 994
+905 995
+907 29
+907 86
+907 97
+907 117
+907 120
+907 159
+907 162
+907 165
+907 197
+907 205
+907 206
+907 236
+907 260
+907 265
+907 270
+907 278
+907 279
+907 289
+907 301
+907 312
+907 344
+907 360
+907 391
+907 398
+907 461
+907 463
+907 491
+907 496
+907 532
+907 536
+907 537
+907 563
+907 579
+907 598
+907 604
+907 606
+907 632
+907 648
+907 679
+907 685
+907 692
+907 710
+907 740
+907 748
+907 772
+907 787
+907 791
+907 798
+907 822
+907 826
+907 837
+907 860
+907 873
+907 882
+907 913
+907 920
+907 923
+907 925
+907 946
+907 949
+907 977
+907 999
+907 1004
+908 189
+908 351
+908 354
+909 140
+909 679
+909 826
+909 905
+909 946
+910 157
+910 307
+910 536
+910 710
+910 720
+910 781
+911 240
+912 686
+913 162
+913 206
+913 247
+913 264
+913 307
+913 321
+913 329
+913 360
+913 386
+913 513
+913 536
+913 647
+913 699
+913 700
+913 822
+913 838
+913 907
+913 950
+913 985
+913 995
+914 336
+915 155
+915 197
+915 278
+915 431
+915 435
+915 593
+915 655
+915 679
+915 769
+915 811
+915 822
+915 1013
+916 679
+916 869
+917 593
+918 324
+918 386
+918 391
+918 740
+918 882
+919 2
+919 8
+919 22
+919 74
+919 86
+919 155
+919 156
+919 158
+919 164
+919 172
+919 195
+919 215
+919 270
+919 282
+919 290
+919 344
+919 360
+919 362
+919 373
+919 386
+919 407
+919 427
+919 436
+919 471
+919 479
+919 496
+919 536
+919 542
+919 594
+919 610
+919 632
+919 648
+919 676
+919 679
+919 692
+919 693
+919 710
+919 739
+919 763
+919 777
+919 787
+919 790
+919 800
+919 822
+919 862
+919 881
+919 882
+919 894
+919 905
+919 948
+919 966
+919 986
+919 995
+919 1021
+920 2
+920 117
+920 155
+920 252
+920 308
+920 401
+920 413
+920 479
+920 496
+920 536
+920 542
+920 544
+920 588
+920 614
+920 732
+920 772
+920 787
+920 791
+920 809
+920 882
+920 907
+920 995
+921 6
+921 22
+921 26
+921 86
+921 136
+921 162
+921 205
+921 267
+921 270
+921 373
+921 437
+921 474
+921 520
+921 536
+921 542
+921 563
+921 583
+921 589
+921 594
+921 632
+921 655
+921 662
+921 687
+921 696
+921 822
+921 894
+921 958
+922 353
+922 668
+923 53
+923 61
+923 63
+923 103
+923 127
+923 162
+923 164
+923 167
+923 197
+923 215
+923 252
+923 270
+923 279
+923 294
+923 329
+923 348
+923 360
+923 373
+923 431
+923 487
+923 520
+923 526
+923 530
+923 536
+923 542
+923 556
+923 573
+923 579
+923 583
+923 585
+923 589
+923 593
+923 594
+923 614
+923 632
+923 634
+923 657
+923 679
+923 686
+923 692
+923 701
+923 710
+923 730
+923 737
+923 773
+923 781
+923 782
+923 791
+923 826
+923 830
+923 869
+923 898
+923 907
+923 934
+923 975
+923 976
+923 982
+923 995
+924 172
+924 662
+925 72
+925 106
+925 181
+925 294
+925 312
+925 360
+925 380
+925 502
+925 536
+925 610
+925 632
+925 679
+925 700
+925 787
+925 907
+926 86
+926 103
+926 164
+926 172
+926 319
+926 350
+926 360
+926 391
+926 496
+926 536
+926 610
+926 632
+926 643
+926 662
+926 756
+926 865
+926 881
+926 882
+927 265
+928 270
+929 2
+929 86
+929 127
+929 155
+929 162
+929 181
+929 193
+929 197
+929 217
+929 240
+929 264
+929 270
+929 312
+929 329
+929 344
+929 360
+929 373
+929 385
+929 479
+929 496
+929 502
+929 520
+929 524
+929 532
+929 536
+929 542
+929 579
+929 632
+929 679
+929 686
+929 721
+929 770
+929 779
+929 781
+929 787
+929 791
+929 812
+929 822
+929 829
+929 837
+929 838
+929 865
+929 873
+929 882
+929 894
+929 949
+929 1019
+929 1021
+930 216
+930 267
+930 413
+930 565
+930 578
+930 611
+930 679
+930 822
+931 536
+932 143
+932 215
+932 224
+932 312
+932 344
+932 354
+932 405
+932 479
+932 496
+932 536
+932 542
+932 707
+932 763
+932 822
+932 995
+934 140
+934 373
+934 435
+934 542
+934 742
+934 781
+934 923
+935 435
+936 471
+936 707
+936 837
+937 2
+937 279
+937 496
+937 869
+937 997
+938 536
+939 6
+939 153
+939 312
+939 329
+939 360
+939 382
+939 578
+939 779
+939 826
+939 976
+941 312
+941 496
+942 536
+943 270
+943 483
+943 536
+943 579
+943 593
+943 594
+943 686
+943 880
+943 1013
+944 162
+944 235
+944 373
+944 517
+944 542
+944 570
+944 662
+944 798
+945 131
+945 155
+945 435
+945 526
+946 2
+946 7
+946 10
+946 22
+946 26
+946 30
+946 35
+946 37
+946 43
+946 61
+946 62
+946 72
+946 74
+946 80
+946 83
+946 86
+946 103
+946 112
+946 118
+946 127
+946 131
+946 140
+946 146
+946 162
+946 167
+946 178
+946 197
+946 204
+946 206
+946 211
+946 216
+946 224
+946 228
+946 235
+946 244
+946 263
+946 270
+946 278
+946 279
+946 280
+946 282
+946 283
+946 294
+946 299
+946 312
+946 318
+946 324
+946 329
+946 330
+946 342
+946 344
+946 349
+946 360
+946 362
+946 366
+946 367
+946 373
+946 386
+946 391
+946 398
+946 410
+946 412
+946 415
+946 432
+946 435
+946 437
+946 439
+946 465
+946 479
+946 483
+946 495
+946 496
+946 502
+946 508
+946 512
+946 513
+946 520
+946 524
+946 533
+946 536
+946 538
+946 539
+946 540
+946 542
+946 549
+946 554
+946 564
+946 569
+946 573
+946 576
+946 578
+946 583
+946 591
+946 593
+946 610
+946 611
+946 615
+946 631
+946 632
+946 650
+946 655
+946 659
+946 661
+946 664
+946 676
+946 679
+946 686
+946 698
+946 700
+946 701
+946 706
+946 707
+946 710
+946 717
+946 763
+946 778
+946 781
+946 790
+946 791
+946 809
+946 822
+946 865
+946 866
+946 869
+946 877
+946 879
+946 881
+946 882
+946 883
+946 889
+946 891
+946 894
+946 896
+946 905
+946 907
+946 909
+946 952
+946 976
+946 985
+946 988
+946 990
+946 995
+946 999
+946 1004
+946 1021
+947 72
+947 86
+947 206
+947 260
+947 270
+947 279
+947 295
+947 317
+947 324
+947 405
+947 536
+947 542
+947 632
+947 686
+947 730
+947 816
+947 822
+948 86
+948 117
+948 119
+948 121
+948 143
+948 164
+948 172
+948 205
+948 206
+948 250
+948 270
+948 330
+948 362
+948 373
+948 398
+948 409
+948 447
+948 459
+948 475
+948 481
+948 520
+948 536
+948 569
+948 578
+948 589
+948 593
+948 610
+948 648
+948 679
+948 687
+948 692
+948 742
+948 787
+948 790
+948 822
+948 826
+948 848
+948 869
+948 881
+948 919
+948 949
+948 966
+948 971
+948 976
+948 1010
+949 16
+949 117
+949 155
+949 235
+949 279
+949 380
+949 386
+949 536
+949 542
+949 594
+949 614
+949 700
+949 706
+949 781
+949 865
+949 907
+949 929
+949 948
+949 973
+950 97
+950 164
+950 373
+950 437
+950 536
+950 679
+950 913
+951 175
+951 483
+952 22
+952 162
+952 226
+952 435
+952 706
+952 878
+952 891
+952 896
+952 946
+953 162
+953 413
+953 487
+953 700
+953 973
+954 164
+954 205
+954 260
+954 270
+954 336
+954 340
+954 360
+954 496
+954 536
+954 542
+954 605
+954 659
+954 693
+954 730
+954 781
+954 976
+954 1021
+955 294
+955 536
+955 701
+956 2
+956 496
+956 526
+956 655
+956 686
+958 882
+958 921
+959 102
+959 206
+961 140
+962 513
+962 536
+962 618
+962 710
+962 822
+963 127
+963 367
+963 894
+964 49
+964 162
+964 192
+964 224
+964 270
+964 339
+964 536
+964 696
+964 710
+964 886
+966 39
+966 80
+966 117
+966 140
+966 143
+966 145
+966 205
+966 230
+966 249
+966 269
+966 270
+966 278
+966 279
+966 308
+966 329
+966 344
+966 366
+966 374
+966 437
+966 444
+966 474
+966 479
+966 510
+966 520
+966 526
+966 536
+966 542
+966 573
+966 578
+966 579
+966 583
+966 593
+966 594
+966 632
+966 700
+966 717
+966 730
+966 733
+966 786
+966 787
+966 822
+966 838
+966 841
+966 848
+966 869
+966 882
+966 891
+966 894
+966 919
+966 948
+966 976
+966 982
+966 994
+966 997
+967 143
+967 312
+967 536
+967 578
+968 536
+970 26
+970 86
+970 158
+970 172
+970 181
+970 217
+970 279
+970 360
+970 536
+970 578
+970 664
+970 763
+970 829
+970 838
+970 976
+971 177
+971 279
+971 294
+971 306
+971 308
+971 312
+971 360
+971 435
+971 502
+971 536
+971 538
+971 574
+971 644
+971 756
+971 781
+971 948
+971 995
+971 1000
+973 217
+973 247
+973 496
+973 536
+973 692
+973 701
+973 765
+973 949
+973 953
+974 86
+974 379
+975 923
+976 2
+976 6
+976 20
+976 22
+976 30
+976 35
+976 72
+976 86
+976 91
+976 97
+976 117
+976 125
+976 127
+976 131
+976 140
+976 143
+976 153
+976 159
+976 162
+976 164
+976 172
+976 185
+976 193
+976 197
+976 205
+976 206
+976 217
+976 224
+976 231
+976 235
+976 250
+976 260
+976 267
+976 270
+976 279
+976 282
+976 290
+976 294
+976 299
+976 312
+976 322
+976 342
+976 344
+976 351
+976 360
+976 373
+976 380
+976 382
+976 386
+976 391
+976 398
+976 403
+976 427
+976 435
+976 443
+976 465
+976 479
+976 487
+976 496
+976 512
+976 520
+976 524
+976 526
+976 533
+976 536
+976 537
+976 538
+976 542
+976 551
+976 554
+976 569
+976 573
+976 574
+976 575
+976 578
+976 579
+976 583
+976 585
+976 589
+976 593
+976 601
+976 607
+976 618
+976 630
+976 632
+976 643
+976 664
+976 673
+976 679
+976 686
+976 687
+976 693
+976 696
+976 700
+976 701
+976 707
+976 710
+976 711
+976 725
+976 730
+976 740
+976 745
+976 763
+976 772
+976 787
+976 801
+976 816
+976 822
+976 826
+976 838
+976 841
+976 858
+976 865
+976 869
+976 870
+976 873
+976 877
+976 881
+976 882
+976 890
+976 894
+976 923
+976 939
+976 946
+976 948
+976 954
+976 966
+976 970
+976 982
+976 995
+976 997
+976 1003
+976 1021
+977 127
+977 155
+977 162
+977 536
+977 907
+978 82
+978 162
+978 185
+978 278
+978 520
+978 536
+978 706
+978 710
+978 891
+978 896
+979 6
+979 77
+979 86
+979 330
+979 344
+979 377
+979 496
+979 578
+979 593
+979 707
+980 6
+980 496
+980 536
+980 679
+980 693
+981 176
+982 4
+982 35
+982 63
+982 86
+982 97
+982 102
+982 121
+982 126
+982 132
+982 137
+982 153
+982 155
+982 162
+982 175
+982 193
+982 240
+982 260
+982 278
+982 279
+982 312
+982 322
+982 349
+982 352
+982 362
+982 373
+982 377
+982 386
+982 391
+982 479
+982 496
+982 536
+982 538
+982 542
+982 543
+982 569
+982 578
+982 589
+982 594
+982 611
+982 614
+982 632
+982 634
+982 666
+982 680
+982 686
+982 687
+982 706
+982 772
+982 781
+982 800
+982 805
+982 824
+982 883
+982 923
+982 966
+982 976
+982 1010
+982 1021
+984 164
+984 549
+985 3
+985 20
+985 22
+985 86
+985 117
+985 143
+985 155
+985 164
+985 178
+985 206
+985 224
+985 235
+985 252
+985 279
+985 329
+985 339
+985 348
+985 349
+985 354
+985 360
+985 366
+985 373
+985 391
+985 415
+985 416
+985 435
+985 479
+985 496
+985 520
+985 536
+985 539
+985 549
+985 560
+985 565
+985 578
+985 594
+985 611
+985 686
+985 687
+985 693
+985 696
+985 699
+985 707
+985 710
+985 714
+985 781
+985 785
+985 822
+985 837
+985 839
+985 846
+985 862
+985 882
+985 894
+985 898
+985 913
+985 946
+985 988
+985 997
+986 6
+986 22
+986 24
+986 48
+986 53
+986 74
+986 80
+986 150
+986 162
+986 205
+986 206
+986 235
+986 251
+986 270
+986 279
+986 282
+986 344
+986 360
+986 373
+986 398
+986 454
+986 461
+986 475
+986 496
+986 504
+986 536
+986 542
+986 578
+986 596
+986 615
+986 621
+986 676
+986 679
+986 687
+986 701
+986 714
+986 721
+986 769
+986 781
+986 787
+986 791
+986 805
+986 822
+986 826
+986 838
+986 853
+986 865
+986 869
+986 882
+986 891
+986 905
+986 919
+988 86
+988 205
+988 250
+988 542
+988 946
+988 985
+989 72
+989 159
+989 197
+989 205
+989 217
+989 235
+989 279
+989 282
+989 360
+989 373
+989 398
+989 409
+989 700
+989 701
+989 710
+989 894
+990 2
+990 86
+990 136
+990 205
+990 264
+990 279
+990 339
+990 435
+990 445
+990 461
+990 491
+990 536
+990 579
+990 583
+990 593
+990 679
+990 946
+990 995
+991 164
+991 205
+991 224
+991 270
+991 344
+991 373
+991 442
+991 471
+991 520
+991 536
+991 542
+991 556
+991 573
+991 578
+991 589
+991 686
+991 700
+991 721
+991 739
+991 787
+991 1021
+992 88
+992 324
+992 360
+992 373
+992 569
+992 677
+992 860
+993 195
+993 197
+993 206
+993 294
+993 496
+993 797
+993 822
+994 22
+994 26
+994 65
+994 86
+994 106
+994 164
+994 206
+994 270
+994 330
+994 360
+994 373
+994 391
+994 409
+994 410
+994 435
+994 465
+994 496
+994 510
+994 524
+994 536
+994 542
+994 577
+994 621
+994 658
+994 664
+994 686
+994 692
+994 693
+994 706
+994 707
+994 717
+994 730
+994 763
+994 765
+994 781
+994 822
+994 826
+994 854
+994 869
+994 873
+994 883
+994 891
+994 905
+994 966
+994 1019
+995 0
+995 2
+995 26
+995 59
+995 61
+995 72
+995 79
+995 83
+995 86
+995 97
+995 103
+995 106
+995 113
+995 117
+995 127
+995 136
+995 140
+995 155
+995 159
+995 162
+995 168
+995 175
+995 193
+995 197
+995 204
+995 205
+995 206
+995 211
+995 219
+995 224
+995 235
+995 240
+995 250
+995 260
+995 265
+995 266
+995 270
+995 273
+995 279
+995 299
+995 302
+995 303
+995 307
+995 312
+995 322
+995 324
+995 329
+995 330
+995 342
+995 344
+995 358
+995 360
+995 373
+995 382
+995 385
+995 386
+995 398
+995 417
+995 420
+995 435
+995 437
+995 444
+995 445
+995 479
+995 487
+995 496
+995 502
+995 513
+995 520
+995 524
+995 526
+995 536
+995 542
+995 563
+995 565
+995 568
+995 578
+995 579
+995 581
+995 583
+995 589
+995 593
+995 601
+995 610
+995 615
+995 618
+995 620
+995 623
+995 632
+995 633
+995 648
+995 659
+995 660
+995 662
+995 679
+995 686
+995 696
+995 698
+995 700
+995 706
+995 710
+995 725
+995 730
+995 732
+995 740
+995 742
+995 763
+995 765
+995 779
+995 781
+995 787
+995 822
+995 826
+995 830
+995 838
+995 854
+995 860
+995 877
+995 881
+995 882
+995 885
+995 889
+995 896
+995 905
+995 913
+995 919
+995 920
+995 923
+995 932
+995 946
+995 971
+995 976
+995 990
+995 1013
+995 1021
+996 127
+997 22
+997 64
+997 72
+997 86
+997 117
+997 129
+997 131
+997 148
+997 162
+997 164
+997 167
+997 175
+997 181
+997 191
+997 206
+997 235
+997 252
+997 270
+997 344
+997 373
+997 386
+997 427
+997 435
+997 444
+997 491
+997 496
+997 504
+997 520
+997 524
+997 530
+997 536
+997 564
+997 578
+997 579
+997 608
+997 632
+997 633
+997 655
+997 661
+997 700
+997 706
+997 710
+997 763
+997 800
+997 883
+997 891
+997 937
+997 966
+997 976
+997 985
+997 1022
+998 86
+998 164
+998 502
+998 554
+998 679
+998 740
+999 8
+999 205
+999 206
+999 270
+999 289
+999 312
+999 352
+999 362
+999 479
+999 536
+999 542
+999 635
+999 679
+999 707
+999 822
+999 881
+999 883
+999 907
+999 946
+1000 30
+1000 178
+1000 205
+1000 252
+1000 270
+1000 329
+1000 362
+1000 373
+1000 496
+1000 520
+1000 530
+1000 536
+1000 593
+1000 659
+1000 781
+1000 824
+1000 971
+1001 679
+1001 730
+1002 86
+1002 373
+1002 542
+1002 858
+1002 894
+1002 1021
+1003 24
+1003 60
+1003 86
+1003 94
+1003 127
+1003 140
+1003 155
+1003 162
+1003 181
+1003 201
+1003 254
+1003 260
+1003 270
+1003 279
+1003 339
+1003 344
+1003 349
+1003 351
+1003 360
+1003 373
+1003 384
+1003 391
+1003 398
+1003 401
+1003 450
+1003 524
+1003 536
+1003 542
+1003 591
+1003 614
+1003 623
+1003 632
+1003 659
+1003 679
+1003 686
+1003 822
+1003 869
+1003 879
+1003 882
+1003 894
+1003 976
+1004 9
+1004 22
+1004 39
+1004 140
+1004 141
+1004 164
+1004 181
+1004 197
+1004 267
+1004 270
+1004 279
+1004 290
+1004 324
+1004 327
+1004 450
+1004 479
+1004 483
+1004 495
+1004 496
+1004 530
+1004 533
+1004 536
+1004 573
+1004 615
+1004 632
+1004 633
+1004 644
+1004 659
+1004 679
+1004 687
+1004 696
+1004 707
+1004 710
+1004 717
+1004 763
+1004 776
+1004 791
+1004 822
+1004 845
+1004 864
+1004 876
+1004 877
+1004 883
+1004 889
+1004 894
+1004 907
+1004 946
+1004 1021
+1005 279
+1006 86
+1006 117
+1006 162
+1006 175
+1006 197
+1006 205
+1006 228
+1006 350
+1006 382
+1006 391
+1006 461
+1006 574
+1006 594
+1006 661
+1006 707
+1006 717
+1006 740
+1006 787
+1006 822
+1006 894
+1007 2
+1007 857
+1008 2
+1008 86
+1008 270
+1008 367
+1008 607
+1008 679
+1008 699
+1008 882
+1008 896
+1010 2
+1010 60
+1010 63
+1010 86
+1010 97
+1010 143
+1010 162
+1010 260
+1010 270
+1010 272
+1010 279
+1010 294
+1010 299
+1010 319
+1010 329
+1010 360
+1010 373
+1010 386
+1010 410
+1010 444
+1010 458
+1010 461
+1010 496
+1010 520
+1010 524
+1010 536
+1010 542
+1010 558
+1010 578
+1010 589
+1010 679
+1010 701
+1010 742
+1010 805
+1010 816
+1010 822
+1010 826
+1010 862
+1010 865
+1010 869
+1010 876
+1010 881
+1010 882
+1010 948
+1010 982
+1011 513
+1011 536
+1011 538
+1011 822
+1013 2
+1013 127
+1013 162
+1013 324
+1013 327
+1013 360
+1013 386
+1013 401
+1013 536
+1013 542
+1013 588
+1013 594
+1013 679
+1013 692
+1013 700
+1013 915
+1013 943
+1013 995
+1015 362
+1015 380
+1016 739
+1017 117
+1018 252
+1019 2
+1019 24
+1019 43
+1019 60
+1019 83
+1019 101
+1019 140
+1019 158
+1019 175
+1019 178
+1019 197
+1019 201
+1019 252
+1019 254
+1019 256
+1019 270
+1019 279
+1019 294
+1019 302
+1019 312
+1019 324
+1019 326
+1019 329
+1019 339
+1019 353
+1019 360
+1019 370
+1019 383
+1019 427
+1019 435
+1019 491
+1019 496
+1019 503
+1019 517
+1019 519
+1019 520
+1019 526
+1019 530
+1019 532
+1019 536
+1019 542
+1019 554
+1019 574
+1019 579
+1019 583
+1019 632
+1019 662
+1019 664
+1019 686
+1019 692
+1019 701
+1019 733
+1019 781
+1019 819
+1019 822
+1019 882
+1019 929
+1019 994
+1020 153
+1021 2
+1021 10
+1021 22
+1021 30
+1021 49
+1021 53
+1021 54
+1021 62
+1021 72
+1021 74
+1021 80
+1021 83
+1021 86
+1021 91
+1021 97
+1021 104
+1021 106
+1021 117
+1021 127
+1021 128
+1021 131
+1021 136
+1021 140
+1021 143
+1021 151
+1021 155
+1021 158
+1021 162
+1021 164
+1021 167
+1021 171
+1021 197
+1021 205
+1021 206
+1021 217
+1021 223
+1021 224
+1021 235
+1021 248
+1021 252
+1021 260
+1021 265
+1021 266
+1021 270
+1021 279
+1021 282
+1021 289
+1021 290
+1021 294
+1021 312
+1021 317
+1021 318
+1021 329
+1021 330
+1021 339
+1021 342
+1021 350
+1021 360
+1021 361
+1021 366
+1021 373
+1021 382
+1021 391
+1021 427
+1021 435
+1021 459
+1021 465
+1021 479
+1021 496
+1021 504
+1021 520
+1021 524
+1021 532
+1021 533
+1021 536
+1021 542
+1021 558
+1021 564
+1021 565
+1021 569
+1021 573
+1021 578
+1021 583
+1021 585
+1021 593
+1021 594
+1021 601
+1021 608
+1021 632
+1021 633
+1021 635
+1021 660
+1021 679
+1021 692
+1021 700
+1021 701
+1021 706
+1021 707
+1021 719
+1021 751
+1021 781
+1021 787
+1021 791
+1021 798
+1021 801
+1021 805
+1021 809
+1021 812
+1021 822
+1021 826
+1021 830
+1021 862
+1021 865
+1021 868
+1021 869
+1021 877
+1021 880
+1021 882
+1021 894
+1021 919
+1021 929
+1021 946
+1021 954
+1021 976
+1021 982
+1021 991
+1021 995
+1021 1002
+1021 1004
+1022 526
+1022 536
+1022 660
+1022 997
+1023 360
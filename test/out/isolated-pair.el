@@ -0,0 +1 @@
+14 23
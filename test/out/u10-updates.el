@@ -0,0 +1,3000 @@
+0 28
+0 112
+0 152
+0 154
+0 167
+0 169
+0 211
+0 213
+0 278
+0 315
+0 320
+0 322
+0 336
+0 386
+0 405
+0 473
+0 476
+0 522
+0 541
+0 547
+0 556
+0 589
+0 604
+0 714
+0 715
+0 728
+0 776
+0 786
+0 825
+0 858
+0 861
+0 871
+0 894
+0 1003
+1 43
+1 225
+1 233
+1 251
+1 258
+1 315
+1 323
+1 327
+1 384
+1 433
+1 474
+1 482
+1 495
+1 549
+1 595
+1 613
+1 806
+1 811
+1 856
+1 1004
+1 1010
+2 22
+2 30
+2 53
+2 88
+2 134
+2 158
+2 186
+2 196
+2 203
+2 253
+2 287
+2 331
+2 350
+2 384
+2 425
+2 428
+2 478
+2 500
+2 518
+2 525
+2 537
+2 545
+2 586
+2 590
+2 594
+2 601
+2 678
+2 691
+2 701
+2 735
+2 759
+2 871
+2 912
+2 919
+2 923
+2 925
+2 990
+2 995
+2 1014
+3 36
+3 45
+3 49
+3 66
+3 78
+3 109
+3 150
+3 163
+3 181
+3 185
+3 226
+3 260
+3 291
+3 292
+3 309
+3 334
+3 366
+3 401
+3 432
+3 450
+3 463
+3 626
+3 705
+3 729
+3 736
+3 751
+3 777
+3 786
+3 787
+3 821
+3 866
+3 882
+3 883
+3 918
+3 958
+3 962
+3 978
+4 21
+4 24
+4 42
+4 59
+4 125
+4 161
+4 186
+4 198
+4 230
+4 256
+4 357
+4 365
+4 380
+4 394
+4 411
+4 519
+4 522
+4 547
+4 549
+4 566
+4 574
+4 584
+4 613
+4 796
+4 873
+4 891
+4 904
+4 919
+4 954
+5 25
+5 39
+5 41
+5 83
+5 86
+5 117
+5 130
+5 135
+5 164
+5 165
+5 212
+5 276
+5 302
+5 463
+5 467
+5 471
+5 483
+5 523
+5 531
+5 623
+5 700
+5 778
+5 782
+5 801
+5 830
+5 878
+5 920
+5 923
+5 984
+6 42
+6 50
+6 98
+6 120
+6 173
+6 210
+6 295
+6 312
+6 333
+6 335
+6 346
+6 421
+6 422
+6 434
+6 463
+6 519
+6 573
+6 637
+6 730
+6 761
+6 782
+6 814
+6 815
+6 824
+6 835
+6 853
+6 895
+6 971
+6 1012
+7 55
+7 58
+7 122
+7 153
+7 204
+7 238
+7 264
+7 271
+7 318
+7 376
+7 384
+7 478
+7 608
+7 611
+7 615
+7 631
+7 687
+7 698
+7 728
+7 730
+7 839
+7 859
+7 982
+7 998
+8 20
+8 39
+8 54
+8 74
+8 88
+8 97
+8 106
+8 164
+8 167
+8 178
+8 192
+8 276
+8 292
+8 321
+8 460
+8 493
+8 528
+8 605
+8 610
+8 627
+8 631
+8 658
+8 666
+8 836
+8 867
+8 877
+8 926
+8 960
+8 961
+8 984
+8 1005
+8 1020
+9 40
+9 53
+9 211
+9 232
+9 261
+9 323
+9 326
+9 370
+9 390
+9 405
+9 414
+9 450
+9 460
+9 551
+9 597
+9 680
+9 723
+9 725
+9 775
+9 787
+9 886
+9 911
+9 919
+9 928
+9 931
+9 941
+9 985
+10 39
+10 89
+10 168
+10 182
+10 231
+10 297
+10 345
+10 351
+10 393
+10 397
+10 432
+10 447
+10 451
+10 455
+10 477
+10 489
+10 498
+10 510
+10 543
+10 564
+10 664
+10 675
+10 695
+10 726
+10 730
+10 737
+10 801
+10 867
+10 869
+10 886
+10 1010
+10 1015
+11 73
+11 76
+11 104
+11 111
+11 128
+11 199
+11 275
+11 389
+11 459
+11 517
+11 528
+11 550
+11 594
+11 614
+11 680
+11 713
+11 716
+11 720
+11 734
+11 752
+11 785
+11 816
+11 820
+11 841
+11 843
+11 902
+11 932
+11 976
+11 1023
+12 34
+12 145
+12 169
+12 179
+12 182
+12 183
+12 227
+12 243
+12 263
+12 266
+12 323
+12 324
+12 341
+12 355
+12 408
+12 435
+12 459
+12 474
+12 500
+12 596
+12 627
+12 655
+12 709
+12 728
+12 760
+12 784
+12 814
+12 823
+12 833
+12 870
+12 924
+12 925
+12 940
+12 977
+12 983
+12 1017
+13 20
+13 26
+13 29
+13 56
+13 97
+13 165
+13 181
+13 266
+13 298
+13 342
+13 353
+13 369
+13 464
+13 480
+13 483
+13 492
+13 500
+13 528
+13 558
+13 589
+13 610
+13 653
+13 669
+13 676
+13 747
+13 853
+13 896
+13 955
+13 978
+13 1008
+13 1009
+14 26
+14 56
+14 66
+14 72
+14 103
+14 117
+14 135
+14 144
+14 202
+14 211
+14 231
+14 251
+14 259
+14 262
+14 266
+14 291
+14 317
+14 358
+14 376
+14 408
+14 462
+14 547
+14 555
+14 580
+14 633
+14 644
+14 645
+14 656
+14 679
+14 731
+14 770
+14 797
+14 847
+14 889
+14 934
+14 935
+15 17
+15 40
+15 57
+15 65
+15 93
+15 181
+15 188
+15 212
+15 233
+15 235
+15 259
+15 301
+15 306
+15 330
+15 337
+15 402
+15 425
+15 431
+15 437
+15 468
+15 509
+15 516
+15 540
+15 713
+15 731
+15 778
+15 789
+15 792
+15 807
+15 842
+15 860
+15 877
+15 879
+15 887
+15 889
+15 900
+15 946
+15 978
+15 986
+16 26
+16 106
+16 166
+16 195
+16 197
+16 230
+16 234
+16 249
+16 285
+16 343
+16 346
+16 382
+16 414
+16 428
+16 438
+16 454
+16 580
+16 672
+16 674
+16 686
+16 740
+16 743
+16 745
+16 850
+16 852
+16 921
+16 975
+17 15
+17 20
+17 104
+17 140
+17 153
+17 230
+17 247
+17 287
+17 291
+17 323
+17 331
+17 355
+17 401
+17 434
+17 459
+17 514
+17 657
+17 689
+17 710
+17 824
+17 883
+17 914
+17 931
+17 957
+17 959
+17 976
+17 1004
+18 29
+18 43
+18 47
+18 55
+18 79
+18 89
+18 167
+18 205
+18 247
+18 249
+18 253
+18 268
+18 278
+18 291
+18 369
+18 375
+18 403
+18 421
+18 460
+18 475
+18 486
+18 488
+18 507
+18 520
+18 527
+18 541
+18 568
+18 582
+18 634
+18 655
+18 660
+18 668
+18 769
+18 833
+18 868
+18 971
+18 996
+19 33
+19 40
+19 76
+19 131
+19 182
+19 234
+19 246
+19 342
+19 352
+19 364
+19 389
+19 427
+19 448
+19 482
+19 508
+19 543
+19 620
+19 732
+19 737
+19 763
+19 766
+19 801
+19 826
+19 866
+20 8
+20 13
+20 17
+20 45
+20 130
+20 173
+20 192
+20 202
+20 278
+20 292
+20 342
+20 385
+20 406
+20 419
+20 420
+20 455
+20 518
+20 548
+20 581
+20 589
+20 717
+20 777
+20 788
+20 803
+20 814
+20 822
+20 843
+20 867
+20 986
+20 998
+21 4
+21 58
+21 65
+21 70
+21 120
+21 123
+21 189
+21 199
+21 246
+21 247
+21 248
+21 258
+21 259
+21 403
+21 449
+21 474
+21 493
+21 521
+21 586
+21 605
+21 655
+21 686
+21 700
+21 708
+21 731
+21 801
+21 853
+21 902
+21 924
+21 943
+21 953
+21 993
+21 1018
+22 2
+22 24
+22 35
+22 58
+22 73
+22 97
+22 143
+22 156
+22 162
+22 304
+22 330
+22 385
+22 402
+22 409
+22 441
+22 492
+22 602
+22 623
+22 659
+22 731
+22 851
+22 854
+22 863
+22 883
+22 957
+22 982
+22 1002
+23 32
+23 46
+23 79
+23 138
+23 185
+23 189
+23 206
+23 215
+23 240
+23 280
+23 281
+23 301
+23 369
+23 376
+23 394
+23 398
+23 403
+23 451
+23 456
+23 514
+23 535
+23 539
+23 549
+23 560
+23 585
+23 640
+23 655
+23 705
+23 730
+23 808
+23 816
+23 834
+23 840
+23 897
+23 932
+23 976
+23 1017
+24 4
+24 22
+24 41
+24 65
+24 90
+24 186
+24 259
+24 316
+24 353
+24 392
+24 414
+24 434
+24 587
+24 614
+24 623
+24 636
+24 689
+24 711
+24 730
+24 747
+24 814
+24 830
+24 836
+24 876
+24 898
+24 917
+24 920
+24 995
+24 1022
+25 5
+25 81
+25 175
+25 182
+25 237
+25 306
+25 323
+25 397
+25 404
+25 427
+25 429
+25 439
+25 595
+25 642
+25 650
+25 672
+25 677
+25 705
+25 778
+25 789
+25 794
+25 800
+25 805
+25 899
+25 994
+25 1007
+25 1017
+26 13
+26 14
+26 16
+26 44
+26 59
+26 65
+26 161
+26 196
+26 276
+26 313
+26 380
+26 528
+26 543
+26 571
+26 578
+26 606
+26 633
+26 649
+26 695
+26 768
+26 776
+26 798
+26 799
+26 854
+26 873
+26 876
+26 906
+26 978
+26 991
+26 1005
+27 54
+27 60
+27 62
+27 81
+27 109
+27 112
+27 130
+27 242
+27 313
+27 321
+27 344
+27 352
+27 467
+27 473
+27 534
+27 611
+27 620
+27 736
+27 772
+27 782
+27 884
+27 931
+27 950
+27 964
+28 0
+28 38
+28 75
+28 101
+28 109
+28 110
+28 158
+28 183
+28 196
+28 281
+28 303
+28 338
+28 483
+28 495
+28 532
+28 571
+28 655
+28 681
+28 692
+28 746
+28 759
+28 773
+28 862
+28 881
+28 894
+28 972
+29 13
+29 18
+29 53
+29 81
+29 89
+29 109
+29 128
+29 186
+29 209
+29 248
+29 312
+29 320
+29 321
+29 354
+29 408
+29 460
+29 477
+29 567
+29 573
+29 595
+29 599
+29 619
+29 647
+29 651
+29 654
+29 686
+29 788
+29 797
+29 814
+29 859
+29 860
+29 866
+29 872
+29 910
+29 911
+29 943
+29 982
+29 996
+29 1019
+30 2
+30 37
+30 41
+30 143
+30 159
+30 176
+30 224
+30 239
+30 262
+30 303
+30 306
+30 321
+30 349
+30 370
+30 427
+30 443
+30 475
+30 488
+30 520
+30 543
+30 546
+30 636
+30 639
+30 820
+30 839
+30 872
+30 877
+30 880
+30 881
+30 916
+30 942
+30 1003
+31 48
+31 125
+31 311
+31 320
+31 377
+31 378
+31 399
+31 590
+31 594
+31 649
+31 670
+31 671
+31 709
+31 719
+31 743
+31 763
+31 848
+31 854
+31 873
+31 874
+31 940
+31 955
+31 957
+31 963
+31 964
+31 966
+32 23
+32 84
+32 111
+32 143
+32 148
+32 182
+32 202
+32 203
+32 270
+32 271
+32 275
+32 382
+32 386
+32 402
+32 404
+32 516
+32 535
+32 548
+32 682
+32 696
+32 708
+32 742
+32 789
+32 845
+32 847
+32 867
+32 905
+32 945
+32 958
+33 19
+33 36
+33 59
+33 91
+33 103
+33 115
+33 116
+33 172
+33 213
+33 291
+33 397
+33 469
+33 489
+33 505
+33 533
+33 542
+33 580
+33 583
+33 604
+33 646
+33 708
+33 842
+33 966
+33 1020
+34 12
+34 59
+34 124
+34 144
+34 149
+34 151
+34 212
+34 238
+34 294
+34 330
+34 343
+34 361
+34 364
+34 439
+34 451
+34 468
+34 474
+34 506
+34 566
+34 601
+34 602
+34 615
+34 653
+34 678
+34 690
+34 719
+34 733
+34 809
+34 812
+34 823
+34 828
+34 849
+34 900
+34 918
+34 930
+34 978
+34 992
+35 22
+35 41
+35 48
+35 54
+35 94
+35 128
+35 133
+35 332
+35 347
+35 374
+35 419
+35 465
+35 527
+35 569
+35 585
+35 590
+35 597
+35 614
+35 622
+35 649
+35 669
+35 704
+35 771
+35 847
+35 865
+35 889
+35 891
+35 893
+35 898
+35 904
+35 922
+35 978
+35 985
+35 997
+35 1013
+35 1014
+36 3
+36 33
+36 78
+36 121
+36 161
+36 162
+36 181
+36 185
+36 192
+36 195
+36 210
+36 240
+36 335
+36 349
+36 371
+36 394
+36 453
+36 458
+36 460
+36 469
+36 495
+36 498
+36 555
+36 561
+36 579
+36 617
+36 724
+36 753
+36 832
+36 843
+36 872
+36 903
+36 952
+36 961
+36 969
+36 1008
+37 30
+37 165
+37 179
+37 215
+37 232
+37 239
+37 306
+37 334
+37 335
+37 361
+37 383
+37 434
+37 535
+37 583
+37 603
+37 628
+37 644
+37 667
+37 681
+37 702
+37 717
+37 734
+37 743
+37 751
+37 780
+37 788
+37 796
+37 801
+37 857
+37 896
+37 955
+38 28
+38 90
+38 110
+38 123
+38 242
+38 303
+38 326
+38 351
+38 386
+38 394
+38 423
+38 448
+38 482
+38 502
+38 505
+38 521
+38 669
+38 708
+38 718
+38 725
+38 735
+38 780
+38 788
+38 803
+38 807
+38 808
+38 879
+38 897
+38 902
+38 921
+38 955
+39 5
+39 8
+39 10
+39 86
+39 99
+39 164
+39 167
+39 176
+39 286
+39 293
+39 299
+39 324
+39 413
+39 420
+39 429
+39 452
+39 463
+39 483
+39 512
+39 515
+39 522
+39 525
+39 541
+39 553
+39 601
+39 605
+39 613
+39 618
+39 636
+39 650
+39 678
+39 708
+39 733
+39 735
+39 770
+39 820
+39 836
+39 839
+39 902
+39 928
+39 933
+39 948
+39 996
+39 1010
+40 9
+40 15
+40 19
+40 104
+40 107
+40 108
+40 123
+40 203
+40 279
+40 364
+40 387
+40 480
+40 555
+40 576
+40 612
+40 661
+40 662
+40 700
+40 721
+40 752
+40 774
+40 796
+40 806
+40 828
+40 856
+40 914
+40 958
+40 992
+40 1000
+40 1013
+41 5
+41 24
+41 30
+41 35
+41 99
+41 142
+41 172
+41 219
+41 226
+41 231
+41 239
+41 304
+41 361
+41 416
+41 484
+41 543
+41 551
+41 559
+41 579
+41 720
+41 842
+41 869
+41 872
+41 880
+41 893
+41 937
+41 957
+41 989
+41 997
+41 1003
+41 1013
+42 4
+42 6
+42 54
+42 62
+42 65
+42 122
+42 132
+42 142
+42 232
+42 277
+42 282
+42 304
+42 315
+42 331
+42 346
+42 405
+42 490
+42 524
+42 527
+42 572
+42 597
+42 600
+42 607
+42 705
+42 706
+42 820
+42 867
+42 996
+42 1013
+43 1
+43 18
+43 56
+43 99
+43 124
+43 145
+43 170
+43 180
+43 190
+43 267
+43 285
+43 370
+43 380
+43 386
+43 427
+43 488
+43 515
+43 543
+43 548
+43 583
+43 652
+43 678
+43 708
+43 755
+43 807
+43 812
+43 834
+43 873
+43 896
+43 920
+43 982
+43 1006
+43 1020
+44 26
+44 53
+44 75
+44 121
+44 157
+44 183
+44 223
+44 256
+44 264
+44 269
+44 327
+44 418
+44 433
+44 447
+44 478
+44 541
+44 552
+44 566
+44 599
+44 634
+44 663
+44 670
+44 690
+44 805
+44 830
+44 909
+44 913
+44 929
+44 947
+44 1012
+45 3
+45 20
+45 173
+45 271
+45 318
+45 339
+45 343
+45 389
+45 422
+45 570
+45 580
+45 592
+45 604
+45 647
+45 707
+45 716
+45 748
+45 758
+45 766
+45 787
+45 867
+45 888
+45 921
+45 971
+45 997
+46 23
+46 60
+46 111
+46 124
+46 127
+46 168
+46 174
+46 178
+46 197
+46 215
+46 216
+46 253
+46 283
+46 344
+46 457
+46 503
+46 517
+46 556
+46 573
+46 604
+46 645
+46 669
+46 829
+46 919
+46 924
+46 925
+46 980
+46 984
+46 1009
+47 18
+47 71
+47 84
+47 142
+47 158
+47 207
+47 222
+47 238
+47 239
+47 297
+47 299
+47 380
+47 388
+47 396
+47 410
+47 412
+47 497
+47 547
+47 581
+47 597
+47 661
+47 690
+47 699
+47 727
+47 739
+47 757
+47 769
+47 826
+47 896
+47 909
+47 929
+47 942
+47 1023
+48 31
+48 35
+48 76
+48 105
+48 118
+48 120
+48 217
+48 228
+48 258
+48 283
+48 308
+48 326
+48 428
+48 460
+48 487
+48 488
+48 501
+48 507
+48 521
+48 542
+48 624
+48 653
+48 743
+48 752
+48 793
+48 909
+48 942
+49 3
+49 120
+49 127
+49 149
+49 159
+49 191
+49 269
+49 284
+49 294
+49 348
+49 349
+49 399
+49 404
+49 412
+49 516
+49 536
+49 545
+49 627
+49 631
+49 734
+49 758
+49 811
+49 814
+49 838
+49 842
+49 843
+49 852
+49 866
+49 869
+49 904
+49 913
+49 921
+49 926
+49 954
+50 6
+50 101
+50 120
+50 154
+50 172
+50 216
+50 238
+50 245
+50 294
+50 305
+50 355
+50 364
+50 444
+50 459
+50 488
+50 560
+50 574
+50 575
+50 592
+50 643
+50 644
+50 707
+50 727
+50 780
+50 813
+50 882
+50 913
+50 931
+50 954
+50 990
+50 1012
+51 115
+51 229
+51 298
+51 311
+51 391
+51 501
+51 509
+51 521
+51 576
+51 681
+51 700
+51 773
+51 785
+51 795
+51 805
+51 814
+51 823
+51 832
+51 872
+51 893
+51 915
+51 929
+51 933
+51 954
+51 960
+51 1006
+51 1014
+51 1015
+52 81
+52 111
+52 117
+52 158
+52 181
+52 262
+52 283
+52 284
+52 303
+52 348
+52 351
+52 440
+52 463
+52 471
+52 498
+52 511
+52 526
+52 537
+52 575
+52 590
+52 598
+52 620
+52 633
+52 662
+52 667
+52 822
+52 825
+52 888
+52 918
+52 962
+52 1019
+53 2
+53 9
+53 29
+53 44
+53 54
+53 65
+53 93
+53 98
+53 111
+53 184
+53 199
+53 215
+53 332
+53 348
+53 370
+53 549
+53 564
+53 570
+53 634
+53 641
+53 655
+53 726
+53 776
+53 813
+53 842
+53 845
+53 873
+53 882
+53 887
+53 921
+53 950
+53 973
+53 1018
+54 8
+54 27
+54 35
+54 42
+54 53
+54 133
+54 145
+54 167
+54 168
+54 247
+54 277
+54 307
+54 312
+54 315
+54 336
+54 402
+54 410
+54 412
+54 496
+54 501
+54 510
+54 637
+54 669
+54 713
+54 715
+54 718
+54 726
+54 756
+54 811
+54 842
+54 853
+54 893
+54 970
+54 978
+54 1005
+54 1019
+55 7
+55 18
+55 56
+55 62
+55 88
+55 104
+55 108
+55 120
+55 127
+55 263
+55 275
+55 312
+55 424
+55 438
+55 446
+55 453
+55 471
+55 487
+55 497
+55 527
+55 538
+55 568
+55 610
+55 615
+55 671
+55 706
+55 715
+55 747
+55 922
+55 961
+55 1008
+55 1022
+56 13
+56 14
+56 43
+56 55
+56 74
+56 84
+56 88
+56 115
+56 161
+56 240
+56 310
+56 311
+56 314
+56 317
+56 332
+56 405
+56 418
+56 435
+56 446
+56 467
+56 470
+56 493
+56 537
+56 580
+56 616
+56 623
+56 626
+56 676
+56 752
+56 783
+56 799
+56 849
+56 865
+56 942
+56 960
+56 973
+56 997
+56 1014
+57 15
+57 114
+57 151
+57 156
+57 242
+57 257
+57 269
+57 323
+57 346
+57 357
+57 408
+57 474
+57 480
+57 546
+57 587
+57 757
+57 775
+57 804
+57 902
+57 967
+57 979
+58 7
+58 21
+58 22
+58 61
+58 62
+58 115
+58 123
+58 164
+58 291
+58 300
+58 323
+58 412
+58 460
+58 499
+58 533
+58 551
+58 561
+58 681
+58 686
+58 697
+58 702
+58 720
+58 776
+58 789
+58 839
+58 843
+58 886
+58 888
+58 965
+58 998
+58 1007
+59 4
+59 26
+59 33
+59 34
+59 111
+59 112
+59 173
+59 177
+59 310
+59 384
+59 414
+59 425
+59 459
+59 507
+59 695
+59 820
+59 980
+59 1014
+59 1017
+59 1018
+59 1023
+60 27
+60 46
+60 70
+60 73
+60 86
+60 193
+60 222
+60 252
+60 272
+60 378
+60 392
+60 414
+60 416
+60 430
+60 453
+60 511
+60 548
+60 552
+60 576
+60 586
+60 708
+60 764
+60 804
+60 831
+60 885
+60 897
+60 952
+60 981
+60 982
+60 1012
+60 1015
+61 58
+61 149
+61 156
+61 160
+61 198
+61 201
+61 226
+61 251
+61 289
+61 291
+61 329
+61 402
+61 409
+61 432
+61 454
+61 474
+61 484
+61 517
+61 523
+61 525
+61 572
+61 576
+61 599
+61 629
+61 654
+61 677
+61 730
+61 751
+61 762
+61 779
+61 815
+61 817
+61 879
+61 883
+61 929
+61 951
+61 984
+61 1010
+61 1017
+62 27
+62 42
+62 55
+62 58
+62 79
+62 89
+62 104
+62 110
+62 115
+62 168
+62 228
+62 230
+62 241
+62 243
+62 261
+62 306
+62 329
+62 330
+62 367
+62 390
+62 400
+62 424
+62 428
+62 502
+62 528
+62 539
+62 582
+62 614
+62 625
+62 629
+62 664
+62 705
+62 751
+62 803
+62 827
+62 837
+62 860
+62 879
+62 881
+62 907
+62 915
+62 959
+62 986
+63 75
+63 115
+63 122
+63 132
+63 153
+63 232
+63 234
+63 274
+63 361
+63 389
+63 390
+63 425
+63 458
+63 485
+63 521
+63 546
+63 616
+63 618
+63 692
+63 693
+63 766
+63 834
+63 847
+63 870
+63 963
+63 974
+64 129
+64 182
+64 223
+64 254
+64 275
+64 343
+64 382
+64 388
+64 420
+64 432
+64 459
+64 520
+64 566
+64 571
+64 583
+64 652
+64 697
+64 746
+64 764
+64 779
+64 870
+64 934
+64 944
+64 952
+64 980
+64 990
+64 999
+65 15
+65 21
+65 24
+65 26
+65 42
+65 53
+65 91
+65 153
+65 181
+65 202
+65 276
+65 314
+65 325
+65 334
+65 337
+65 347
+65 389
+65 399
+65 408
+65 419
+65 451
+65 543
+65 575
+65 606
+65 618
+65 620
+65 679
+65 698
+65 771
+65 782
+65 787
+65 798
+65 912
+65 916
+66 3
+66 14
+66 107
+66 131
+66 133
+66 143
+66 159
+66 218
+66 245
+66 267
+66 297
+66 307
+66 420
+66 509
+66 512
+66 542
+66 617
+66 636
+66 714
+66 731
+66 760
+66 768
+66 795
+66 823
+66 824
+66 875
+66 884
+66 911
+66 936
+66 1023
+67 78
+67 89
+67 95
+67 112
+67 128
+67 130
+67 151
+67 238
+67 242
+67 263
+67 423
+67 464
+67 495
+67 523
+67 526
+67 530
+67 669
+67 671
+67 687
+67 689
+67 742
+67 768
+67 788
+67 805
+67 815
+67 835
+67 838
+67 855
+67 955
+67 967
+67 995
+68 69
+68 75
+68 117
+68 138
+68 192
+68 283
+68 295
+68 312
+68 330
+68 339
+68 365
+68 422
+68 432
+68 491
+68 515
+68 525
+68 551
+68 570
+68 573
+68 587
+68 616
+68 621
+68 637
+68 656
+68 664
+68 666
+68 673
+68 729
+68 769
+68 841
+68 951
+68 966
+68 989
+68 1005
+68 1009
+69 68
+69 81
+69 109
+69 116
+69 131
+69 215
+69 241
+69 268
+69 301
+69 308
+69 388
+69 426
+69 437
+69 438
+69 483
+69 484
+69 501
+69 524
+69 543
+69 548
+69 604
+69 609
+69 625
+69 645
+69 732
+69 788
+69 804
+69 859
+69 913
+69 916
+69 925
+69 932
+69 960
+69 1002
+70 21
+70 60
+70 105
+70 121
+70 152
+70 179
+70 233
+70 262
+70 292
+70 301
+70 313
+70 368
+70 402
+70 427
+70 438
+70 458
+70 498
+70 530
+70 540
+70 586
+70 639
+70 649
+70 687
+70 813
+70 830
+70 853
+70 861
+70 886
+70 906
+70 982
+70 990
+71 47
+71 78
+71 174
+71 178
+71 194
+71 221
+71 334
+71 359
+71 374
+71 398
+71 414
+71 481
+71 606
+71 711
+71 743
+71 750
+71 754
+71 795
+71 806
+71 827
+71 903
+71 970
+71 976
+71 994
+71 1013
+71 1020
+72 14
+72 81
+72 109
+72 172
+72 229
+72 263
+72 312
+72 325
+72 369
+72 531
+72 581
+72 618
+72 623
+72 686
+72 705
+72 708
+72 715
+72 720
+72 752
+72 845
+72 908
+72 911
+72 943
+72 949
+72 978
+72 985
+72 995
+72 1015
+73 11
+73 22
+73 60
+73 93
+73 101
+73 142
+73 166
+73 180
+73 238
+73 251
+73 305
+73 325
+73 337
+73 421
+73 423
+73 461
+73 496
+73 596
+73 627
+73 657
+73 703
+73 745
+73 755
+73 802
+73 803
+73 823
+73 922
+73 939
+73 941
+74 8
+74 56
+74 77
+74 147
+74 169
+74 172
+74 214
+74 277
+74 355
+74 401
+74 456
+74 519
+74 531
+74 569
+74 574
+74 653
+74 683
+74 729
+74 731
+74 737
+74 751
+74 777
+74 924
+74 928
+74 929
+74 946
+75 28
+75 44
+75 63
+75 68
+75 125
+75 179
+75 185
+75 190
+75 355
+75 366
+75 449
+75 460
+75 463
+75 472
+75 478
+75 490
+75 557
+75 578
+75 602
+75 618
+75 623
+75 650
+75 674
+75 724
+75 730
+75 755
+75 766
+75 823
+75 824
+75 883
+75 968
+75 1008
+76 11
+76 19
+76 48
+76 188
+76 197
+76 276
+76 305
+76 335
+76 340
+76 351
+76 473
+76 480
+76 492
+76 498
+76 534
+76 585
+76 654
+76 656
+76 711
+76 729
+76 744
+76 756
+76 757
+76 764
+76 768
+76 780
+76 781
+76 813
+76 823
+76 855
+76 860
+76 862
+76 878
+76 896
+76 942
+76 962
+77 74
+77 90
+77 109
+77 205
+77 270
+77 279
+77 299
+77 303
+77 325
+77 394
+77 398
+77 425
+77 454
+77 467
+77 468
+77 480
+77 484
+77 488
+77 520
+77 604
+77 695
+77 704
+77 714
+77 722
+77 762
+77 830
+77 851
+77 904
+77 914
+77 918
+77 944
+77 957
+77 962
+77 1002
+78 3
+78 36
+78 67
+78 71
+78 91
+78 96
+78 111
+78 169
+78 194
+78 210
+78 260
+78 268
+78 289
+78 430
+78 451
+78 477
+78 510
+78 580
+78 658
+78 681
+78 699
+78 705
+78 712
+78 722
+78 773
+78 789
+78 806
+78 848
+78 892
+78 898
+78 899
+78 963
+79 18
+79 23
+79 62
+79 106
+79 175
+79 223
+79 282
+79 332
+79 349
+79 371
+79 396
+79 410
+79 436
+79 457
+79 458
+79 477
+79 488
+79 493
+79 494
+79 531
+79 541
+79 648
+79 653
+79 655
+79 676
+79 678
+79 761
+79 786
+79 805
+79 826
+79 875
+79 910
+79 929
+79 936
+79 940
+79 1010
+79 1019
+79 1022
+80 102
+80 128
+80 148
+80 263
+80 264
+80 272
+80 308
+80 336
+80 350
+80 351
+80 367
+80 376
+80 390
+80 419
+80 491
+80 533
+80 592
+80 635
+80 659
+80 660
+80 669
+80 679
+80 738
+80 740
+80 749
+80 751
+80 752
+80 769
+80 771
+80 773
+80 779
+80 858
+80 905
+80 913
+80 944
+80 948
+80 969
+80 1004
+81 25
+81 27
+81 29
+81 52
+81 69
+81 72
+81 124
+81 152
+81 161
+81 168
+81 170
+81 172
+81 224
+81 245
+81 287
+81 291
+81 332
+81 345
+81 412
+81 417
+81 463
+81 553
+81 555
+81 680
+81 777
+81 786
+81 826
+81 829
+81 838
+81 841
+81 860
+81 887
+81 917
+81 958
+81 966
+82 164
+82 207
+82 217
+82 287
+82 288
+82 311
+82 313
+82 332
+82 334
+82 399
+82 421
+82 438
+82 501
+82 509
+82 568
+82 594
+82 611
+82 651
+82 652
+82 653
+82 669
+82 677
+82 696
+82 704
+82 744
+82 756
+82 765
+82 799
+82 803
+82 808
+82 918
+83 5
+83 113
+83 127
+83 159
+83 199
+83 237
+83 257
+83 281
+83 311
+83 316
+83 372
+83 391
+83 428
+83 446
+83 495
+83 524
+83 555
+83 642
+83 652
+83 665
+83 676
+83 705
+83 713
+83 784
+83 791
+83 828
+83 853
+83 882
+83 889
+83 920
+83 937
+83 970
+83 1012
+83 1018
+84 32
+84 47
+84 56
+84 98
+84 136
+84 202
+84 257
+84 260
+84 294
+84 319
+84 378
+84 389
+84 415
+84 500
+84 524
+84 525
+84 567
+84 616
+84 677
+84 680
+84 727
+84 774
+84 788
+84 804
+84 813
+84 951
+85 146
+85 159
+85 194
+85 246
+85 275
+85 323
+85 350
+85 366
+85 428
+85 498
+85 535
+85 596
+85 621
+85 622
+85 640
+85 677
+85 684
+85 690
+85 769
+85 774
+85 813
+85 824
+85 873
+85 965
+85 1006
+85 1020
+85 1022
+86 5
+86 39
+86 60
+86 102
+86 116
+86 118
+86 143
+86 144
+86 161
+86 167
+86 177
+86 199
+86 205
+86 233
+86 263
+86 283
+86 316
+86 331
+86 335
+86 356
+86 369
+86 441
+86 543
+86 552
+86 560
+86 593
+86 608
+86 644
+86 673
+86 684
+86 698
+86 699
+86 762
+86 807
+86 825
+86 837
+86 941
+86 944
+86 957
+87 102
+87 179
+87 181
+87 200
+87 202
+87 251
+87 287
+87 297
+87 563
+87 574
+87 605
+87 620
+87 639
+87 655
+87 704
+87 712
+87 736
+87 739
+87 767
+87 780
+87 819
+87 822
+87 897
+87 931
+87 969
+87 973
+87 976
+88 2
+88 8
+88 55
+88 56
+88 105
+88 136
+88 142
+88 158
+88 163
+88 188
+88 200
+88 219
+88 278
+88 290
+88 295
+88 300
+88 325
+88 386
+88 452
+88 454
+88 608
+88 616
+88 625
+88 714
+88 751
+88 772
+88 828
+88 860
+88 900
+88 904
+88 982
+89 10
+89 18
+89 29
+89 62
+89 67
+89 139
+89 140
+89 169
+89 171
+89 186
+89 199
+89 302
+89 310
+89 425
+89 434
+89 438
+89 443
+89 446
+89 462
+89 508
+89 517
+89 519
+89 585
+89 606
+89 611
+89 660
+89 662
+89 704
+89 734
+89 766
+89 771
+89 777
+89 779
+89 813
+89 821
+89 845
+89 854
+89 913
+89 925
+89 945
+89 977
+89 1021
+90 24
+90 38
+90 77
+90 123
+90 412
+90 451
+90 492
+90 498
+90 510
+90 636
+90 662
+90 683
+90 710
+90 737
+90 745
+90 830
+90 907
+90 935
+90 957
+90 963
+90 970
+90 986
+90 987
+90 989
+90 1013
+91 33
+91 65
+91 78
+91 113
+91 174
+91 176
+91 198
+91 237
+91 260
+91 288
+91 321
+91 326
+91 349
+91 353
+91 354
+91 442
+91 495
+91 497
+91 521
+91 555
+91 570
+91 584
+91 648
+91 656
+91 663
+91 670
+91 684
+91 706
+91 715
+91 719
+91 766
+91 800
+91 817
+91 865
+91 869
+91 870
+91 875
+91 889
+91 942
+91 947
+91 998
+91 1014
+92 135
+92 198
+92 219
+92 235
+92 283
+92 323
+92 339
+92 405
+92 450
+92 454
+92 499
+92 517
+92 552
+92 574
+92 584
+92 623
+92 669
+92 712
+92 749
+92 762
+92 777
+92 812
+92 835
+92 854
+92 894
+92 899
+92 951
+92 985
+92 987
+92 996
+92 998
+92 999
+92 1001
+93 15
+93 53
+93 73
+93 163
+93 181
+93 229
+93 242
+93 267
+93 321
+93 406
+93 495
+93 501
+93 506
+93 569
+93 572
+93 588
+93 675
+93 756
+93 895
+93 903
+93 920
+94 35
+94 104
+94 115
+94 135
+94 172
+94 174
+94 180
+94 192
+94 194
+94 200
+94 213
+94 315
+94 341
+94 347
+94 365
+94 366
+94 384
+94 436
+94 440
+94 489
+94 520
+94 628
+94 709
+94 710
+94 735
+94 772
+94 788
+94 809
+94 840
+94 850
+94 875
+94 922
+94 926
+94 942
+94 955
+94 968
+94 1018
+95 67
+95 106
+95 189
+95 310
+95 326
+95 331
+95 523
+95 544
+95 581
+95 616
+95 631
+95 635
+95 638
+95 652
+95 662
+95 668
+95 725
+95 732
+95 748
+95 770
@@ -0,0 +1,32250 @@
+0 28
+0 112
+0 152
+0 154
+0 167
+0 169
+0 211
+0 213
+0 278
+0 315
+0 320
+0 322
+0 336
+0 386
+0 405
+0 473
+0 476
+0 522
+0 541
+0 547
+0 556
+0 589
+0 604
+0 714
+0 715
+0 728
+0 776
+0 786
+0 825
+0 858
+0 861
+0 871
+0 894
+0 1003
+1 43
+1 225
+1 233
+1 251
+1 258
+1 315
+1 323
+1 327
+1 384
+1 433
+1 474
+1 482
+1 495
+1 549
+1 595
+1 613
+1 806
+1 811
+1 856
+1 1004
+1 1010
+2 22
+2 30
+2 53
+2 88
+2 134
+2 158
+2 186
+2 196
+2 203
+2 253
+2 287
+2 331
+2 350
+2 384
+2 425
+2 428
+2 478
+2 500
+2 518
+2 525
+2 537
+2 545
+2 586
+2 590
+2 594
+2 601
+2 678
+2 691
+2 701
+2 735
+2 759
+2 871
+2 912
+2 919
+2 923
+2 925
+2 990
+2 995
+2 1014
+3 36
+3 45
+3 49
+3 66
+3 78
+3 109
+3 150
+3 163
+3 181
+3 185
+3 226
+3 260
+3 291
+3 292
+3 309
+3 334
+3 366
+3 401
+3 432
+3 450
+3 463
+3 626
+3 705
+3 729
+3 736
+3 751
+3 777
+3 786
+3 787
+3 821
+3 866
+3 882
+3 883
+3 918
+3 958
+3 962
+3 978
+4 21
+4 24
+4 42
+4 59
+4 125
+4 161
+4 186
+4 198
+4 230
+4 256
+4 357
+4 365
+4 380
+4 394
+4 411
+4 519
+4 522
+4 547
+4 549
+4 566
+4 574
+4 584
+4 613
+4 796
+4 873
+4 891
+4 904
+4 919
+4 954
+5 25
+5 39
+5 41
+5 83
+5 86
+5 117
+5 130
+5 135
+5 164
+5 165
+5 212
+5 276
+5 302
+5 463
+5 467
+5 471
+5 483
+5 523
+5 531
+5 623
+5 700
+5 778
+5 782
+5 801
+5 830
+5 878
+5 920
+5 923
+5 984
+6 42
+6 50
+6 98
+6 120
+6 173
+6 210
+6 295
+6 312
+6 333
+6 335
+6 346
+6 421
+6 422
+6 434
+6 463
+6 519
+6 573
+6 637
+6 730
+6 761
+6 782
+6 814
+6 815
+6 824
+6 835
+6 853
+6 895
+6 971
+6 1012
+7 55
+7 58
+7 122
+7 153
+7 204
+7 238
+7 264
+7 271
+7 318
+7 376
+7 384
+7 478
+7 608
+7 611
+7 615
+7 631
+7 687
+7 698
+7 728
+7 730
+7 839
+7 859
+7 982
+7 998
+8 20
+8 39
+8 54
+8 74
+8 88
+8 97
+8 106
+8 164
+8 167
+8 178
+8 192
+8 276
+8 292
+8 321
+8 460
+8 493
+8 528
+8 605
+8 610
+8 627
+8 631
+8 658
+8 666
+8 836
+8 867
+8 877
+8 926
+8 960
+8 961
+8 984
+8 1005
+8 1020
+9 40
+9 53
+9 211
+9 232
+9 261
+9 323
+9 326
+9 370
+9 390
+9 405
+9 414
+9 450
+9 460
+9 551
+9 597
+9 680
+9 723
+9 725
+9 775
+9 787
+9 886
+9 911
+9 919
+9 928
+9 931
+9 941
+9 985
+10 39
+10 89
+10 168
+10 182
+10 231
+10 297
+10 345
+10 351
+10 393
+10 397
+10 432
+10 447
+10 451
+10 455
+10 477
+10 489
+10 498
+10 510
+10 543
+10 564
+10 664
+10 675
+10 695
+10 726
+10 730
+10 737
+10 801
+10 867
+10 869
+10 886
+10 1010
+10 1015
+11 73
+11 76
+11 104
+11 111
+11 128
+11 199
+11 275
+11 389
+11 459
+11 517
+11 528
+11 550
+11 594
+11 614
+11 680
+11 713
+11 716
+11 720
+11 734
+11 752
+11 785
+11 816
+11 820
+11 841
+11 843
+11 902
+11 932
+11 976
+11 1023
+12 34
+12 145
+12 169
+12 179
+12 182
+12 183
+12 227
+12 243
+12 263
+12 266
+12 323
+12 324
+12 341
+12 355
+12 408
+12 435
+12 459
+12 474
+12 500
+12 596
+12 627
+12 655
+12 709
+12 728
+12 760
+12 784
+12 814
+12 823
+12 833
+12 870
+12 924
+12 925
+12 940
+12 977
+12 983
+12 1017
+13 20
+13 26
+13 29
+13 56
+13 97
+13 165
+13 181
+13 266
+13 298
+13 342
+13 353
+13 369
+13 464
+13 480
+13 483
+13 492
+13 500
+13 528
+13 558
+13 589
+13 610
+13 653
+13 669
+13 676
+13 747
+13 853
+13 896
+13 955
+13 978
+13 1008
+13 1009
+14 26
+14 56
+14 66
+14 72
+14 103
+14 117
+14 135
+14 144
+14 202
+14 211
+14 231
+14 251
+14 259
+14 262
+14 266
+14 291
+14 317
+14 358
+14 376
+14 408
+14 462
+14 547
+14 555
+14 580
+14 633
+14 644
+14 645
+14 656
+14 679
+14 731
+14 770
+14 797
+14 847
+14 889
+14 934
+14 935
+15 17
+15 40
+15 57
+15 65
+15 93
+15 181
+15 188
+15 212
+15 233
+15 235
+15 259
+15 301
+15 306
+15 330
+15 337
+15 402
+15 425
+15 431
+15 437
+15 468
+15 509
+15 516
+15 540
+15 713
+15 731
+15 778
+15 789
+15 792
+15 807
+15 842
+15 860
+15 877
+15 879
+15 887
+15 889
+15 900
+15 946
+15 978
+15 986
+16 26
+16 106
+16 166
+16 195
+16 197
+16 230
+16 234
+16 249
+16 285
+16 343
+16 346
+16 382
+16 414
+16 428
+16 438
+16 454
+16 580
+16 672
+16 674
+16 686
+16 740
+16 743
+16 745
+16 850
+16 852
+16 921
+16 975
+17 15
+17 20
+17 104
+17 140
+17 153
+17 230
+17 247
+17 287
+17 291
+17 323
+17 331
+17 355
+17 401
+17 434
+17 459
+17 514
+17 657
+17 689
+17 710
+17 824
+17 883
+17 914
+17 931
+17 957
+17 959
+17 976
+17 1004
+18 29
+18 43
+18 47
+18 55
+18 79
+18 89
+18 167
+18 205
+18 247
+18 249
+18 253
+18 268
+18 278
+18 291
+18 369
+18 375
+18 403
+18 421
+18 460
+18 475
+18 486
+18 488
+18 507
+18 520
+18 527
+18 541
+18 568
+18 582
+18 634
+18 655
+18 660
+18 668
+18 769
+18 833
+18 868
+18 971
+18 996
+19 33
+19 40
+19 76
+19 131
+19 182
+19 234
+19 246
+19 342
+19 352
+19 364
+19 389
+19 427
+19 448
+19 482
+19 508
+19 543
+19 620
+19 732
+19 737
+19 763
+19 766
+19 801
+19 826
+19 866
+20 8
+20 13
+20 17
+20 45
+20 130
+20 173
+20 192
+20 202
+20 278
+20 292
+20 342
+20 385
+20 406
+20 419
+20 420
+20 455
+20 518
+20 548
+20 581
+20 589
+20 717
+20 777
+20 788
+20 803
+20 814
+20 822
+20 843
+20 867
+20 986
+20 998
+21 4
+21 58
+21 65
+21 70
+21 120
+21 123
+21 189
+21 199
+21 246
+21 247
+21 248
+21 258
+21 259
+21 403
+21 449
+21 474
+21 493
+21 521
+21 586
+21 605
+21 655
+21 686
+21 700
+21 708
+21 731
+21 801
+21 853
+21 902
+21 924
+21 943
+21 953
+21 993
+21 1018
+22 2
+22 24
+22 35
+22 58
+22 73
+22 97
+22 143
+22 156
+22 162
+22 304
+22 330
+22 385
+22 402
+22 409
+22 441
+22 492
+22 602
+22 623
+22 659
+22 731
+22 851
+22 854
+22 863
+22 883
+22 957
+22 982
+22 1002
+23 32
+23 46
+23 79
+23 138
+23 185
+23 189
+23 206
+23 215
+23 240
+23 280
+23 281
+23 301
+23 369
+23 376
+23 394
+23 398
+23 403
+23 451
+23 456
+23 514
+23 535
+23 539
+23 549
+23 560
+23 585
+23 640
+23 655
+23 705
+23 730
+23 808
+23 816
+23 834
+23 840
+23 897
+23 932
+23 976
+23 1017
+24 4
+24 22
+24 41
+24 65
+24 90
+24 186
+24 259
+24 316
+24 353
+24 392
+24 414
+24 434
+24 587
+24 614
+24 623
+24 636
+24 689
+24 711
+24 730
+24 747
+24 814
+24 830
+24 836
+24 876
+24 898
+24 917
+24 920
+24 995
+24 1022
+25 5
+25 81
+25 175
+25 182
+25 237
+25 306
+25 323
+25 397
+25 404
+25 427
+25 429
+25 439
+25 595
+25 642
+25 650
+25 672
+25 677
+25 705
+25 778
+25 789
+25 794
+25 800
+25 805
+25 899
+25 994
+25 1007
+25 1017
+26 13
+26 14
+26 16
+26 44
+26 59
+26 65
+26 161
+26 196
+26 276
+26 313
+26 380
+26 528
+26 543
+26 571
+26 578
+26 606
+26 633
+26 649
+26 695
+26 768
+26 776
+26 798
+26 799
+26 854
+26 873
+26 876
+26 906
+26 978
+26 991
+26 1005
+27 54
+27 60
+27 62
+27 81
+27 109
+27 112
+27 130
+27 242
+27 313
+27 321
+27 344
+27 352
+27 467
+27 473
+27 534
+27 611
+27 620
+27 736
+27 772
+27 782
+27 884
+27 931
+27 950
+27 964
+28 0
+28 38
+28 75
+28 101
+28 109
+28 110
+28 158
+28 183
+28 196
+28 281
+28 303
+28 338
+28 483
+28 495
+28 532
+28 571
+28 655
+28 681
+28 692
+28 746
+28 759
+28 773
+28 862
+28 881
+28 894
+28 972
+29 13
+29 18
+29 53
+29 81
+29 89
+29 109
+29 128
+29 186
+29 209
+29 248
+29 312
+29 320
+29 321
+29 354
+29 408
+29 460
+29 477
+29 567
+29 573
+29 595
+29 599
+29 619
+29 647
+29 651
+29 654
+29 686
+29 788
+29 797
+29 814
+29 859
+29 860
+29 866
+29 872
+29 910
+29 911
+29 943
+29 982
+29 996
+29 1019
+30 2
+30 37
+30 41
+30 143
+30 159
+30 176
+30 224
+30 239
+30 262
+30 303
+30 306
+30 321
+30 349
+30 370
+30 427
+30 443
+30 475
+30 488
+30 520
+30 543
+30 546
+30 636
+30 639
+30 820
+30 839
+30 872
+30 877
+30 880
+30 881
+30 916
+30 942
+30 1003
+31 48
+31 125
+31 311
+31 320
+31 377
+31 378
+31 399
+31 590
+31 594
+31 649
+31 670
+31 671
+31 709
+31 719
+31 743
+31 763
+31 848
+31 854
+31 873
+31 874
+31 940
+31 955
+31 957
+31 963
+31 964
+31 966
+32 23
+32 84
+32 111
+32 143
+32 148
+32 182
+32 202
+32 203
+32 270
+32 271
+32 275
+32 382
+32 386
+32 402
+32 404
+32 516
+32 535
+32 548
+32 682
+32 696
+32 708
+32 742
+32 789
+32 845
+32 847
+32 867
+32 905
+32 945
+32 958
+33 19
+33 36
+33 59
+33 91
+33 103
+33 115
+33 116
+33 172
+33 213
+33 291
+33 397
+33 469
+33 489
+33 505
+33 533
+33 542
+33 580
+33 583
+33 604
+33 646
+33 708
+33 842
+33 966
+33 1020
+34 12
+34 59
+34 124
+34 144
+34 149
+34 151
+34 212
+34 238
+34 294
+34 330
+34 343
+34 361
+34 364
+34 439
+34 451
+34 468
+34 474
+34 506
+34 566
+34 601
+34 602
+34 615
+34 653
+34 678
+34 690
+34 719
+34 733
+34 809
+34 812
+34 823
+34 828
+34 849
+34 900
+34 918
+34 930
+34 978
+34 992
+35 22
+35 41
+35 48
+35 54
+35 94
+35 128
+35 133
+35 332
+35 347
+35 374
+35 419
+35 465
+35 527
+35 569
+35 585
+35 590
+35 597
+35 614
+35 622
+35 649
+35 669
+35 704
+35 771
+35 847
+35 865
+35 889
+35 891
+35 893
+35 898
+35 904
+35 922
+35 978
+35 985
+35 997
+35 1013
+35 1014
+36 3
+36 33
+36 78
+36 121
+36 161
+36 162
+36 181
+36 185
+36 192
+36 195
+36 210
+36 240
+36 335
+36 349
+36 371
+36 394
+36 453
+36 458
+36 460
+36 469
+36 495
+36 498
+36 555
+36 561
+36 579
+36 617
+36 724
+36 753
+36 832
+36 843
+36 872
+36 903
+36 952
+36 961
+36 969
+36 1008
+37 30
+37 165
+37 179
+37 215
+37 232
+37 239
+37 306
+37 334
+37 335
+37 361
+37 383
+37 434
+37 535
+37 583
+37 603
+37 628
+37 644
+37 667
+37 681
+37 702
+37 717
+37 734
+37 743
+37 751
+37 780
+37 788
+37 796
+37 801
+37 857
+37 896
+37 955
+38 28
+38 90
+38 110
+38 123
+38 242
+38 303
+38 326
+38 351
+38 386
+38 394
+38 423
+38 448
+38 482
+38 502
+38 505
+38 521
+38 669
+38 708
+38 718
+38 725
+38 735
+38 780
+38 788
+38 803
+38 807
+38 808
+38 879
+38 897
+38 902
+38 921
+38 955
+39 5
+39 8
+39 10
+39 86
+39 99
+39 164
+39 167
+39 176
+39 286
+39 293
+39 299
+39 324
+39 413
+39 420
+39 429
+39 452
+39 463
+39 483
+39 512
+39 515
+39 522
+39 525
+39 541
+39 553
+39 601
+39 605
+39 613
+39 618
+39 636
+39 650
+39 678
+39 708
+39 733
+39 735
+39 770
+39 820
+39 836
+39 839
+39 902
+39 928
+39 933
+39 948
+39 996
+39 1010
+40 9
+40 15
+40 19
+40 104
+40 107
+40 108
+40 123
+40 203
+40 279
+40 364
+40 387
+40 480
+40 555
+40 576
+40 612
+40 661
+40 662
+40 700
+40 721
+40 752
+40 774
+40 796
+40 806
+40 828
+40 856
+40 914
+40 958
+40 992
+40 1000
+40 1013
+41 5
+41 24
+41 30
+41 35
+41 99
+41 142
+41 172
+41 219
+41 226
+41 231
+41 239
+41 304
+41 361
+41 416
+41 484
+41 543
+41 551
+41 559
+41 579
+41 720
+41 842
+41 869
+41 872
+41 880
+41 893
+41 937
+41 957
+41 989
+41 997
+41 1003
+41 1013
+42 4
+42 6
+42 54
+42 62
+42 65
+42 122
+42 132
+42 142
+42 232
+42 277
+42 282
+42 304
+42 315
+42 331
+42 346
+42 405
+42 490
+42 524
+42 527
+42 572
+42 597
+42 600
+42 607
+42 705
+42 706
+42 820
+42 867
+42 996
+42 1013
+43 1
+43 18
+43 56
+43 99
+43 124
+43 145
+43 170
+43 180
+43 190
+43 267
+43 285
+43 370
+43 380
+43 386
+43 427
+43 488
+43 515
+43 543
+43 548
+43 583
+43 652
+43 678
+43 708
+43 755
+43 807
+43 812
+43 834
+43 873
+43 896
+43 920
+43 982
+43 1006
+43 1020
+44 26
+44 53
+44 75
+44 121
+44 157
+44 183
+44 223
+44 256
+44 264
+44 269
+44 327
+44 418
+44 433
+44 447
+44 478
+44 541
+44 552
+44 566
+44 599
+44 634
+44 663
+44 670
+44 690
+44 805
+44 830
+44 909
+44 913
+44 929
+44 947
+44 1012
+45 3
+45 20
+45 173
+45 271
+45 318
+45 339
+45 343
+45 389
+45 422
+45 570
+45 580
+45 592
+45 604
+45 647
+45 707
+45 716
+45 748
+45 758
+45 766
+45 787
+45 867
+45 888
+45 921
+45 971
+45 997
+46 23
+46 60
+46 111
+46 124
+46 127
+46 168
+46 174
+46 178
+46 197
+46 215
+46 216
+46 253
+46 283
+46 344
+46 457
+46 503
+46 517
+46 556
+46 573
+46 604
+46 645
+46 669
+46 829
+46 919
+46 924
+46 925
+46 980
+46 984
+46 1009
+47 18
+47 71
+47 84
+47 142
+47 158
+47 207
+47 222
+47 238
+47 239
+47 297
+47 299
+47 380
+47 388
+47 396
+47 410
+47 412
+47 497
+47 547
+47 581
+47 597
+47 661
+47 690
+47 699
+47 727
+47 739
+47 757
+47 769
+47 826
+47 896
+47 909
+47 929
+47 942
+47 1023
+48 31
+48 35
+48 76
+48 105
+48 118
+48 120
+48 217
+48 228
+48 258
+48 283
+48 308
+48 326
+48 428
+48 460
+48 487
+48 488
+48 501
+48 507
+48 521
+48 542
+48 624
+48 653
+48 743
+48 752
+48 793
+48 909
+48 942
+49 3
+49 120
+49 127
+49 149
+49 159
+49 191
+49 269
+49 284
+49 294
+49 348
+49 349
+49 399
+49 404
+49 412
+49 516
+49 536
+49 545
+49 627
+49 631
+49 734
+49 758
+49 811
+49 814
+49 838
+49 842
+49 843
+49 852
+49 866
+49 869
+49 904
+49 913
+49 921
+49 926
+49 954
+50 6
+50 101
+50 120
+50 154
+50 172
+50 216
+50 238
+50 245
+50 294
+50 305
+50 355
+50 364
+50 444
+50 459
+50 488
+50 560
+50 574
+50 575
+50 592
+50 643
+50 644
+50 707
+50 727
+50 780
+50 813
+50 882
+50 913
+50 931
+50 954
+50 990
+50 1012
+51 115
+51 229
+51 298
+51 311
+51 391
+51 501
+51 509
+51 521
+51 576
+51 681
+51 700
+51 773
+51 785
+51 795
+51 805
+51 814
+51 823
+51 832
+51 872
+51 893
+51 915
+51 929
+51 933
+51 954
+51 960
+51 1006
+51 1014
+51 1015
+52 81
+52 111
+52 117
+52 158
+52 181
+52 262
+52 283
+52 284
+52 303
+52 348
+52 351
+52 440
+52 463
+52 471
+52 498
+52 511
+52 526
+52 537
+52 575
+52 590
+52 598
+52 620
+52 633
+52 662
+52 667
+52 822
+52 825
+52 888
+52 918
+52 962
+52 1019
+53 2
+53 9
+53 29
+53 44
+53 54
+53 65
+53 93
+53 98
+53 111
+53 184
+53 199
+53 215
+53 332
+53 348
+53 370
+53 549
+53 564
+53 570
+53 634
+53 641
+53 655
+53 726
+53 776
+53 813
+53 842
+53 845
+53 873
+53 882
+53 887
+53 921
+53 950
+53 973
+53 1018
+54 8
+54 27
+54 35
+54 42
+54 53
+54 133
+54 145
+54 167
+54 168
+54 247
+54 277
+54 307
+54 312
+54 315
+54 336
+54 402
+54 410
+54 412
+54 496
+54 501
+54 510
+54 637
+54 669
+54 713
+54 715
+54 718
+54 726
+54 756
+54 811
+54 842
+54 853
+54 893
+54 970
+54 978
+54 1005
+54 1019
+55 7
+55 18
+55 56
+55 62
+55 88
+55 104
+55 108
+55 120
+55 127
+55 263
+55 275
+55 312
+55 424
+55 438
+55 446
+55 453
+55 471
+55 487
+55 497
+55 527
+55 538
+55 568
+55 610
+55 615
+55 671
+55 706
+55 715
+55 747
+55 922
+55 961
+55 1008
+55 1022
+56 13
+56 14
+56 43
+56 55
+56 74
+56 84
+56 88
+56 115
+56 161
+56 240
+56 310
+56 311
+56 314
+56 317
+56 332
+56 405
+56 418
+56 435
+56 446
+56 467
+56 470
+56 493
+56 537
+56 580
+56 616
+56 623
+56 626
+56 676
+56 752
+56 783
+56 799
+56 849
+56 865
+56 942
+56 960
+56 973
+56 997
+56 1014
+57 15
+57 114
+57 151
+57 156
+57 242
+57 257
+57 269
+57 323
+57 346
+57 357
+57 408
+57 474
+57 480
+57 546
+57 587
+57 757
+57 775
+57 804
+57 902
+57 967
+57 979
+58 7
+58 21
+58 22
+58 61
+58 62
+58 115
+58 123
+58 164
+58 291
+58 300
+58 323
+58 412
+58 460
+58 499
+58 533
+58 551
+58 561
+58 681
+58 686
+58 697
+58 702
+58 720
+58 776
+58 789
+58 839
+58 843
+58 886
+58 888
+58 965
+58 998
+58 1007
+59 4
+59 26
+59 33
+59 34
+59 111
+59 112
+59 173
+59 177
+59 310
+59 384
+59 414
+59 425
+59 459
+59 507
+59 695
+59 820
+59 980
+59 1014
+59 1017
+59 1018
+59 1023
+60 27
+60 46
+60 70
+60 73
+60 86
+60 193
+60 222
+60 252
+60 272
+60 378
+60 392
+60 414
+60 416
+60 430
+60 453
+60 511
+60 548
+60 552
+60 576
+60 586
+60 708
+60 764
+60 804
+60 831
+60 885
+60 897
+60 952
+60 981
+60 982
+60 1012
+60 1015
+61 58
+61 149
+61 156
+61 160
+61 198
+61 201
+61 226
+61 251
+61 289
+61 291
+61 329
+61 402
+61 409
+61 432
+61 454
+61 474
+61 484
+61 517
+61 523
+61 525
+61 572
+61 576
+61 599
+61 629
+61 654
+61 677
+61 730
+61 751
+61 762
+61 779
+61 815
+61 817
+61 879
+61 883
+61 929
+61 951
+61 984
+61 1010
+61 1017
+62 27
+62 42
+62 55
+62 58
+62 79
+62 89
+62 104
+62 110
+62 115
+62 168
+62 228
+62 230
+62 241
+62 243
+62 261
+62 306
+62 329
+62 330
+62 367
+62 390
+62 400
+62 424
+62 428
+62 502
+62 528
+62 539
+62 582
+62 614
+62 625
+62 629
+62 664
+62 705
+62 751
+62 803
+62 827
+62 837
+62 860
+62 879
+62 881
+62 907
+62 915
+62 959
+62 986
+63 75
+63 115
+63 122
+63 132
+63 153
+63 232
+63 234
+63 274
+63 361
+63 389
+63 390
+63 425
+63 458
+63 485
+63 521
+63 546
+63 616
+63 618
+63 692
+63 693
+63 766
+63 834
+63 847
+63 870
+63 963
+63 974
+64 129
+64 182
+64 223
+64 254
+64 275
+64 343
+64 382
+64 388
+64 420
+64 432
+64 459
+64 520
+64 566
+64 571
+64 583
+64 652
+64 697
+64 746
+64 764
+64 779
+64 870
+64 934
+64 944
+64 952
+64 980
+64 990
+64 999
+65 15
+65 21
+65 24
+65 26
+65 42
+65 53
+65 91
+65 153
+65 181
+65 202
+65 276
+65 314
+65 325
+65 334
+65 337
+65 347
+65 389
+65 399
+65 408
+65 419
+65 451
+65 543
+65 575
+65 606
+65 618
+65 620
+65 679
+65 698
+65 771
+65 782
+65 787
+65 798
+65 912
+65 916
+66 3
+66 14
+66 107
+66 131
+66 133
+66 143
+66 159
+66 218
+66 245
+66 267
+66 297
+66 307
+66 420
+66 509
+66 512
+66 542
+66 617
+66 636
+66 714
+66 731
+66 760
+66 768
+66 795
+66 823
+66 824
+66 875
+66 884
+66 911
+66 936
+66 1023
+67 78
+67 89
+67 95
+67 112
+67 128
+67 130
+67 151
+67 238
+67 242
+67 263
+67 423
+67 464
+67 495
+67 523
+67 526
+67 530
+67 669
+67 671
+67 687
+67 689
+67 742
+67 768
+67 788
+67 805
+67 815
+67 835
+67 838
+67 855
+67 955
+67 967
+67 995
+68 69
+68 75
+68 117
+68 138
+68 192
+68 283
+68 295
+68 312
+68 330
+68 339
+68 365
+68 422
+68 432
+68 491
+68 515
+68 525
+68 551
+68 570
+68 573
+68 587
+68 616
+68 621
+68 637
+68 656
+68 664
+68 666
+68 673
+68 729
+68 769
+68 841
+68 951
+68 966
+68 989
+68 1005
+68 1009
+69 68
+69 81
+69 109
+69 116
+69 131
+69 215
+69 241
+69 268
+69 301
+69 308
+69 388
+69 426
+69 437
+69 438
+69 483
+69 484
+69 501
+69 524
+69 543
+69 548
+69 604
+69 609
+69 625
+69 645
+69 732
+69 788
+69 804
+69 859
+69 913
+69 916
+69 925
+69 932
+69 960
+69 1002
+70 21
+70 60
+70 105
+70 121
+70 152
+70 179
+70 233
+70 262
+70 292
+70 301
+70 313
+70 368
+70 402
+70 427
+70 438
+70 458
+70 498
+70 530
+70 540
+70 586
+70 639
+70 649
+70 687
+70 813
+70 830
+70 853
+70 861
+70 886
+70 906
+70 982
+70 990
+71 47
+71 78
+71 174
+71 178
+71 194
+71 221
+71 334
+71 359
+71 374
+71 398
+71 414
+71 481
+71 606
+71 711
+71 743
+71 750
+71 754
+71 795
+71 806
+71 827
+71 903
+71 970
+71 976
+71 994
+71 1013
+71 1020
+72 14
+72 81
+72 109
+72 172
+72 229
+72 263
+72 312
+72 325
+72 369
+72 531
+72 581
+72 618
+72 623
+72 686
+72 705
+72 708
+72 715
+72 720
+72 752
+72 845
+72 908
+72 911
+72 943
+72 949
+72 978
+72 985
+72 995
+72 1015
+73 11
+73 22
+73 60
+73 93
+73 101
+73 142
+73 166
+73 180
+73 238
+73 251
+73 305
+73 325
+73 337
+73 421
+73 423
+73 461
+73 496
+73 596
+73 627
+73 657
+73 703
+73 745
+73 755
+73 802
+73 803
+73 823
+73 922
+73 939
+73 941
+74 8
+74 56
+74 77
+74 147
+74 169
+74 172
+74 214
+74 277
+74 355
+74 401
+74 456
+74 519
+74 531
+74 569
+74 574
+74 653
+74 683
+74 729
+74 731
+74 737
+74 751
+74 777
+74 924
+74 928
+74 929
+74 946
+75 28
+75 44
+75 63
+75 68
+75 125
+75 179
+75 185
+75 190
+75 355
+75 366
+75 449
+75 460
+75 463
+75 472
+75 478
+75 490
+75 557
+75 578
+75 602
+75 618
+75 623
+75 650
+75 674
+75 724
+75 730
+75 755
+75 766
+75 823
+75 824
+75 883
+75 968
+75 1008
+76 11
+76 19
+76 48
+76 188
+76 197
+76 276
+76 305
+76 335
+76 340
+76 351
+76 473
+76 480
+76 492
+76 498
+76 534
+76 585
+76 654
+76 656
+76 711
+76 729
+76 744
+76 756
+76 757
+76 764
+76 768
+76 780
+76 781
+76 813
+76 823
+76 855
+76 860
+76 862
+76 878
+76 896
+76 942
+76 962
+77 74
+77 90
+77 109
+77 205
+77 270
+77 279
+77 299
+77 303
+77 325
+77 394
+77 398
+77 425
+77 454
+77 467
+77 468
+77 480
+77 484
+77 488
+77 520
+77 604
+77 695
+77 704
+77 714
+77 722
+77 762
+77 830
+77 851
+77 904
+77 914
+77 918
+77 944
+77 957
+77 962
+77 1002
+78 3
+78 36
+78 67
+78 71
+78 91
+78 96
+78 111
+78 169
+78 194
+78 210
+78 260
+78 268
+78 289
+78 430
+78 451
+78 477
+78 510
+78 580
+78 658
+78 681
+78 699
+78 705
+78 712
+78 722
+78 773
+78 789
+78 806
+78 848
+78 892
+78 898
+78 899
+78 963
+79 18
+79 23
+79 62
+79 106
+79 175
+79 223
+79 282
+79 332
+79 349
+79 371
+79 396
+79 410
+79 436
+79 457
+79 458
+79 477
+79 488
+79 493
+79 494
+79 531
+79 541
+79 648
+79 653
+79 655
+79 676
+79 678
+79 761
+79 786
+79 805
+79 826
+79 875
+79 910
+79 929
+79 936
+79 940
+79 1010
+79 1019
+79 1022
+80 102
+80 128
+80 148
+80 263
+80 264
+80 272
+80 308
+80 336
+80 350
+80 351
+80 367
+80 376
+80 390
+80 419
+80 491
+80 533
+80 592
+80 635
+80 659
+80 660
+80 669
+80 679
+80 738
+80 740
+80 749
+80 751
+80 752
+80 769
+80 771
+80 773
+80 779
+80 858
+80 905
+80 913
+80 944
+80 948
+80 969
+80 1004
+81 25
+81 27
+81 29
+81 52
+81 69
+81 72
+81 124
+81 152
+81 161
+81 168
+81 170
+81 172
+81 224
+81 245
+81 287
+81 291
+81 332
+81 345
+81 412
+81 417
+81 463
+81 553
+81 555
+81 680
+81 777
+81 786
+81 826
+81 829
+81 838
+81 841
+81 860
+81 887
+81 917
+81 958
+81 966
+82 164
+82 207
+82 217
+82 287
+82 288
+82 311
+82 313
+82 332
+82 334
+82 399
+82 421
+82 438
+82 501
+82 509
+82 568
+82 594
+82 611
+82 651
+82 652
+82 653
+82 669
+82 677
+82 696
+82 704
+82 744
+82 756
+82 765
+82 799
+82 803
+82 808
+82 918
+83 5
+83 113
+83 127
+83 159
+83 199
+83 237
+83 257
+83 281
+83 311
+83 316
+83 372
+83 391
+83 428
+83 446
+83 495
+83 524
+83 555
+83 642
+83 652
+83 665
+83 676
+83 705
+83 713
+83 784
+83 791
+83 828
+83 853
+83 882
+83 889
+83 920
+83 937
+83 970
+83 1012
+83 1018
+84 32
+84 47
+84 56
+84 98
+84 136
+84 202
+84 257
+84 260
+84 294
+84 319
+84 378
+84 389
+84 415
+84 500
+84 524
+84 525
+84 567
+84 616
+84 677
+84 680
+84 727
+84 774
+84 788
+84 804
+84 813
+84 951
+85 146
+85 159
+85 194
+85 246
+85 275
+85 323
+85 350
+85 366
+85 428
+85 498
+85 535
+85 596
+85 621
+85 622
+85 640
+85 677
+85 684
+85 690
+85 769
+85 774
+85 813
+85 824
+85 873
+85 965
+85 1006
+85 1020
+85 1022
+86 5
+86 39
+86 60
+86 102
+86 116
+86 118
+86 143
+86 144
+86 161
+86 167
+86 177
+86 199
+86 205
+86 233
+86 263
+86 283
+86 316
+86 331
+86 335
+86 356
+86 369
+86 441
+86 543
+86 552
+86 560
+86 593
+86 608
+86 644
+86 673
+86 684
+86 698
+86 699
+86 762
+86 807
+86 825
+86 837
+86 941
+86 944
+86 957
+87 102
+87 179
+87 181
+87 200
+87 202
+87 251
+87 287
+87 297
+87 563
+87 574
+87 605
+87 620
+87 639
+87 655
+87 704
+87 712
+87 736
+87 739
+87 767
+87 780
+87 819
+87 822
+87 897
+87 931
+87 969
+87 973
+87 976
+88 2
+88 8
+88 55
+88 56
+88 105
+88 136
+88 142
+88 158
+88 163
+88 188
+88 200
+88 219
+88 278
+88 290
+88 295
+88 300
+88 325
+88 386
+88 452
+88 454
+88 608
+88 616
+88 625
+88 714
+88 751
+88 772
+88 828
+88 860
+88 900
+88 904
+88 982
+89 10
+89 18
+89 29
+89 62
+89 67
+89 139
+89 140
+89 169
+89 171
+89 186
+89 199
+89 302
+89 310
+89 425
+89 434
+89 438
+89 443
+89 446
+89 462
+89 508
+89 517
+89 519
+89 585
+89 606
+89 611
+89 660
+89 662
+89 704
+89 734
+89 766
+89 771
+89 777
+89 779
+89 813
+89 821
+89 845
+89 854
+89 913
+89 925
+89 945
+89 977
+89 1021
+90 24
+90 38
+90 77
+90 123
+90 412
+90 451
+90 492
+90 498
+90 510
+90 636
+90 662
+90 683
+90 710
+90 737
+90 745
+90 830
+90 907
+90 935
+90 957
+90 963
+90 970
+90 986
+90 987
+90 989
+90 1013
+91 33
+91 65
+91 78
+91 113
+91 174
+91 176
+91 198
+91 237
+91 260
+91 288
+91 321
+91 326
+91 349
+91 353
+91 354
+91 442
+91 495
+91 497
+91 521
+91 555
+91 570
+91 584
+91 648
+91 656
+91 663
+91 670
+91 684
+91 706
+91 715
+91 719
+91 766
+91 800
+91 817
+91 865
+91 869
+91 870
+91 875
+91 889
+91 942
+91 947
+91 998
+91 1014
+92 135
+92 198
+92 219
+92 235
+92 283
+92 323
+92 339
+92 405
+92 450
+92 454
+92 499
+92 517
+92 552
+92 574
+92 584
+92 623
+92 669
+92 712
+92 749
+92 762
+92 777
+92 812
+92 835
+92 854
+92 894
+92 899
+92 951
+92 985
+92 987
+92 996
+92 998
+92 999
+92 1001
+93 15
+93 53
+93 73
+93 163
+93 181
+93 229
+93 242
+93 267
+93 321
+93 406
+93 495
+93 501
+93 506
+93 569
+93 572
+93 588
+93 675
+93 756
+93 895
+93 903
+93 920
+94 35
+94 104
+94 115
+94 135
+94 172
+94 174
+94 180
+94 192
+94 194
+94 200
+94 213
+94 315
+94 341
+94 347
+94 365
+94 366
+94 384
+94 436
+94 440
+94 489
+94 520
+94 628
+94 709
+94 710
+94 735
+94 772
+94 788
+94 809
+94 840
+94 850
+94 875
+94 922
+94 926
+94 942
+94 955
+94 968
+94 1018
+95 67
+95 106
+95 189
+95 310
+95 326
+95 331
+95 523
+95 544
+95 581
+95 616
+95 631
+95 635
+95 638
+95 652
+95 662
+95 668
+95 725
+95 732
+95 748
+95 770
+95 811
+95 824
+95 872
+95 901
+95 920
+95 933
+96 78
+96 102
+96 201
+96 203
+96 204
+96 317
+96 331
+96 391
+96 428
+96 436
+96 485
+96 609
+96 658
+96 727
+96 737
+96 763
+96 771
+96 809
+96 876
+96 882
+96 935
+96 981
+97 8
+97 13
+97 22
+97 115
+97 117
+97 132
+97 136
+97 206
+97 270
+97 289
+97 343
+97 347
+97 433
+97 450
+97 466
+97 522
+97 524
+97 544
+97 623
+97 664
+97 676
+97 680
+97 696
+97 704
+97 744
+97 808
+97 830
+97 839
+97 883
+97 892
+97 976
+97 997
+97 1008
+98 6
+98 53
+98 84
+98 106
+98 200
+98 218
+98 219
+98 222
+98 231
+98 237
+98 241
+98 281
+98 373
+98 389
+98 415
+98 428
+98 448
+98 460
+98 462
+98 488
+98 607
+98 649
+98 650
+98 655
+98 686
+98 787
+98 877
+98 934
+98 948
+98 952
+98 991
+98 997
+98 999
+98 1007
+98 1018
+99 39
+99 41
+99 43
+99 149
+99 177
+99 218
+99 219
+99 256
+99 286
+99 364
+99 370
+99 435
+99 461
+99 526
+99 528
+99 555
+99 576
+99 614
+99 642
+99 663
+99 667
+99 697
+99 722
+99 726
+99 766
+99 769
+99 776
+99 791
+99 855
+99 928
+99 939
+99 966
+99 971
+100 122
+100 123
+100 138
+100 147
+100 158
+100 265
+100 285
+100 348
+100 377
+100 423
+100 520
+100 535
+100 596
+100 625
+100 656
+100 686
+100 687
+100 690
+100 721
+100 738
+100 788
+100 796
+100 884
+100 929
+100 968
+100 971
+100 985
+100 995
+100 1007
+100 1012
+101 28
+101 50
+101 73
+101 102
+101 107
+101 131
+101 173
+101 227
+101 346
+101 372
+101 378
+101 385
+101 388
+101 395
+101 471
+101 475
+101 572
+101 602
+101 617
+101 676
+101 707
+101 709
+101 711
+101 748
+101 759
+101 770
+101 824
+101 831
+101 866
+101 896
+101 938
+102 80
+102 86
+102 87
+102 96
+102 101
+102 122
+102 245
+102 258
+102 274
+102 293
+102 305
+102 320
+102 351
+102 366
+102 417
+102 451
+102 464
+102 487
+102 495
+102 501
+102 560
+102 624
+102 648
+102 650
+102 668
+102 733
+102 744
+102 749
+102 756
+102 787
+102 806
+102 827
+102 982
+103 14
+103 33
+103 123
+103 152
+103 160
+103 229
+103 242
+103 252
+103 264
+103 268
+103 459
+103 466
+103 504
+103 542
+103 566
+103 592
+103 615
+103 639
+103 640
+103 662
+103 688
+103 729
+103 842
+103 951
+103 983
+104 11
+104 17
+104 40
+104 55
+104 62
+104 94
+104 151
+104 169
+104 174
+104 204
+104 240
+104 257
+104 270
+104 299
+104 302
+104 306
+104 313
+104 352
+104 536
+104 555
+104 574
+104 589
+104 629
+104 631
+104 702
+104 751
+104 758
+104 806
+104 810
+104 839
+104 843
+104 856
+104 891
+104 920
+104 953
+104 987
+105 48
+105 70
+105 88
+105 108
+105 127
+105 178
+105 195
+105 250
+105 331
+105 338
+105 369
+105 401
+105 459
+105 483
+105 510
+105 529
+105 558
+105 709
+105 757
+105 782
+105 813
+105 839
+105 908
+105 921
+105 991
+105 992
+106 8
+106 16
+106 79
+106 95
+106 98
+106 143
+106 159
+106 183
+106 328
+106 363
+106 377
+106 384
+106 385
+106 386
+106 442
+106 501
+106 512
+106 521
+106 554
+106 565
+106 612
+106 715
+106 717
+106 738
+106 806
+106 816
+106 825
+106 857
+106 915
+106 1009
+107 40
+107 66
+107 101
+107 116
+107 185
+107 202
+107 227
+107 309
+107 358
+107 368
+107 400
+107 414
+107 424
+107 445
+107 490
+107 501
+107 509
+107 535
+107 540
+107 655
+107 711
+107 720
+107 797
+107 918
+107 935
+107 993
+107 995
+107 1019
+108 40
+108 55
+108 105
+108 109
+108 121
+108 135
+108 183
+108 191
+108 226
+108 231
+108 236
+108 266
+108 317
+108 331
+108 350
+108 356
+108 422
+108 456
+108 464
+108 484
+108 505
+108 510
+108 562
+108 601
+108 616
+108 622
+108 627
+108 638
+108 672
+108 702
+108 710
+108 711
+108 798
+108 812
+108 855
+108 866
+109 3
+109 27
+109 28
+109 29
+109 69
+109 72
+109 77
+109 108
+109 114
+109 136
+109 170
+109 184
+109 233
+109 235
+109 337
+109 431
+109 444
+109 466
+109 513
+109 519
+109 528
+109 622
+109 694
+109 743
+109 801
+109 806
+109 810
+109 858
+109 932
+109 960
+110 28
+110 38
+110 62
+110 130
+110 138
+110 144
+110 307
+110 317
+110 329
+110 343
+110 345
+110 390
+110 480
+110 488
+110 505
+110 535
+110 538
+110 571
+110 622
+110 665
+110 695
+110 723
+110 760
+110 876
+110 877
+110 989
+110 991
+111 11
+111 32
+111 46
+111 52
+111 53
+111 59
+111 78
+111 169
+111 179
+111 201
+111 252
+111 261
+111 314
+111 352
+111 353
+111 393
+111 424
+111 436
+111 451
+111 473
+111 474
+111 552
+111 716
+111 754
+111 761
+111 775
+111 795
+111 838
+111 851
+111 939
+111 965
+111 983
+111 993
+112 0
+112 27
+112 59
+112 67
+112 199
+112 242
+112 254
+112 274
+112 326
+112 343
+112 361
+112 400
+112 414
+112 435
+112 444
+112 458
+112 482
+112 509
+112 518
+112 623
+112 626
+112 631
+112 645
+112 684
+112 699
+112 729
+112 731
+112 764
+112 798
+112 806
+112 841
+112 863
+112 930
+112 989
+113 83
+113 91
+113 131
+113 163
+113 183
+113 242
+113 279
+113 317
+113 321
+113 341
+113 542
+113 554
+113 605
+113 628
+113 660
+113 665
+113 676
+113 721
+113 747
+113 780
+113 807
+113 816
+113 854
+113 899
+113 947
+113 953
+113 993
+113 1015
+114 57
+114 109
+114 125
+114 132
+114 175
+114 204
+114 216
+114 302
+114 371
+114 379
+114 385
+114 455
+114 457
+114 469
+114 513
+114 523
+114 530
+114 559
+114 570
+114 583
+114 598
+114 632
+114 726
+114 727
+114 737
+114 744
+114 756
+114 798
+114 842
+114 898
+114 919
+114 929
+114 1021
+115 33
+115 51
+115 56
+115 58
+115 62
+115 63
+115 94
+115 97
+115 131
+115 239
+115 250
+115 262
+115 316
+115 330
+115 342
+115 354
+115 377
+115 397
+115 404
+115 421
+115 440
+115 480
+115 623
+115 642
+115 691
+115 717
+115 724
+115 780
+115 834
+115 860
+115 886
+115 896
+115 902
+115 936
+115 956
+115 958
+115 971
+116 33
+116 69
+116 86
+116 107
+116 207
+116 231
+116 259
+116 323
+116 382
+116 466
+116 502
+116 504
+116 506
+116 508
+116 536
+116 562
+116 574
+116 648
+116 662
+116 821
+116 851
+116 871
+116 923
+116 928
+116 1021
+117 5
+117 14
+117 52
+117 68
+117 97
+117 135
+117 141
+117 159
+117 173
+117 180
+117 186
+117 293
+117 303
+117 338
+117 345
+117 423
+117 449
+117 495
+117 538
+117 540
+117 548
+117 567
+117 568
+117 609
+117 685
+117 707
+117 737
+117 748
+117 801
+117 808
+117 879
+117 881
+117 985
+118 48
+118 86
+118 137
+118 141
+118 172
+118 175
+118 179
+118 215
+118 234
+118 241
+118 350
+118 369
+118 437
+118 442
+118 488
+118 495
+118 500
+118 515
+118 528
+118 530
+118 603
+118 643
+118 696
+118 711
+118 811
+118 817
+118 835
+118 844
+118 857
+118 872
+118 880
+118 888
+118 990
+118 1011
+119 129
+119 140
+119 155
+119 168
+119 187
+119 289
+119 299
+119 331
+119 349
+119 399
+119 419
+119 473
+119 499
+119 510
+119 552
+119 558
+119 568
+119 587
+119 597
+119 639
+119 641
+119 678
+119 714
+119 728
+119 767
+119 774
+119 799
+119 812
+119 834
+119 838
+119 844
+119 849
+119 862
+119 864
+119 912
+119 917
+119 920
+119 988
+120 6
+120 21
+120 48
+120 49
+120 50
+120 55
+120 266
+120 312
+120 407
+120 440
+120 448
+120 463
+120 535
+120 550
+120 577
+120 585
+120 608
+120 614
+120 643
+120 645
+120 668
+120 678
+120 694
+120 721
+120 735
+120 737
+120 740
+120 745
+120 751
+120 758
+120 824
+120 846
+120 863
+120 870
+120 918
+120 922
+120 926
+120 934
+120 949
+120 993
+120 995
+120 1017
+121 36
+121 44
+121 70
+121 108
+121 136
+121 204
+121 213
+121 224
+121 233
+121 246
+121 262
+121 313
+121 378
+121 421
+121 422
+121 424
+121 431
+121 434
+121 438
+121 442
+121 451
+121 539
+121 546
+121 583
+121 584
+121 617
+121 673
+121 681
+121 708
+121 718
+121 766
+121 778
+121 821
+121 934
+121 953
+121 991
+121 1002
+121 1017
+121 1022
+122 7
+122 42
+122 63
+122 100
+122 102
+122 146
+122 164
+122 176
+122 177
+122 179
+122 186
+122 273
+122 276
+122 282
+122 333
+122 407
+122 431
+122 443
+122 446
+122 466
+122 480
+122 481
+122 596
+122 671
+122 694
+122 710
+122 731
+122 776
+122 801
+122 829
+122 856
+122 884
+122 898
+122 918
+122 947
+122 984
+122 997
+122 1023
+123 21
+123 38
+123 40
+123 58
+123 90
+123 100
+123 103
+123 137
+123 177
+123 184
+123 204
+123 299
+123 349
+123 424
+123 477
+123 532
+123 583
+123 586
+123 595
+123 647
+123 750
+123 752
+123 776
+123 778
+123 786
+123 814
+123 930
+123 980
+123 987
+124 34
+124 43
+124 46
+124 81
+124 145
+124 146
+124 208
+124 267
+124 310
+124 312
+124 314
+124 378
+124 410
+124 418
+124 465
+124 564
+124 573
+124 579
+124 593
+124 597
+124 624
+124 628
+124 717
+124 752
+124 802
+124 818
+124 865
+124 871
+124 922
+124 949
+124 951
+124 979
+124 996
+125 4
+125 31
+125 75
+125 114
+125 127
+125 133
+125 181
+125 192
+125 271
+125 283
+125 311
+125 322
+125 348
+125 352
+125 494
+125 504
+125 642
+125 666
+125 669
+125 680
+125 684
+125 776
+125 787
+125 826
+125 833
+125 877
+125 892
+125 899
+125 901
+125 938
+125 945
+125 985
+125 1005
+125 1007
+126 145
+126 150
+126 243
+126 254
+126 288
+126 336
+126 422
+126 460
+126 522
+126 569
+126 581
+126 584
+126 611
+126 689
+126 739
+126 769
+126 830
+126 876
+126 884
+126 909
+126 924
+126 957
+126 968
+127 46
+127 49
+127 55
+127 83
+127 105
+127 125
+127 139
+127 148
+127 152
+127 166
+127 209
+127 237
+127 295
+127 331
+127 405
+127 414
+127 454
+127 500
+127 554
+127 564
+127 613
+127 653
+127 696
+127 739
+127 773
+127 785
+127 864
+127 892
+127 935
+127 945
+127 992
+128 11
+128 29
+128 35
+128 67
+128 80
+128 140
+128 214
+128 240
+128 256
+128 323
+128 330
+128 417
+128 446
+128 480
+128 568
+128 705
+128 717
+128 731
+128 791
+128 863
+128 888
+128 908
+128 922
+128 933
+128 956
+128 976
+128 1010
+129 64
+129 119
+129 167
+129 202
+129 223
+129 248
+129 251
+129 259
+129 347
+129 349
+129 353
+129 358
+129 365
+129 414
+129 449
+129 478
+129 593
+129 615
+129 639
+129 642
+129 661
+129 695
+129 715
+129 732
+129 755
+129 760
+129 777
+129 788
+129 790
+129 806
+129 820
+129 1001
+130 5
+130 20
+130 27
+130 67
+130 110
+130 134
+130 147
+130 247
+130 263
+130 300
+130 353
+130 462
+130 486
+130 520
+130 525
+130 535
+130 558
+130 625
+130 645
+130 653
+130 686
+130 687
+130 706
+130 876
+130 969
+130 982
+130 1016
+131 19
+131 66
+131 69
+131 101
+131 113
+131 115
+131 252
+131 321
+131 328
+131 341
+131 356
+131 378
+131 603
+131 632
+131 690
+131 701
+131 706
+131 713
+131 722
+131 740
+131 751
+131 822
+131 836
+131 861
+131 890
+131 917
+131 922
+131 923
+131 931
+131 940
+131 962
+131 1019
+132 42
+132 63
+132 97
+132 114
+132 140
+132 165
+132 192
+132 235
+132 253
+132 254
+132 290
+132 291
+132 316
+132 327
+132 373
+132 407
+132 415
+132 465
+132 507
+132 518
+132 608
+132 734
+132 740
+132 788
+132 823
+132 832
+132 840
+132 844
+132 859
+132 882
+132 974
+133 35
+133 54
+133 66
+133 125
+133 179
+133 205
+133 206
+133 275
+133 336
+133 369
+133 370
+133 427
+133 501
+133 519
+133 583
+133 638
+133 689
+133 736
+133 790
+133 858
+133 910
+134 2
+134 130
+134 175
+134 178
+134 183
+134 213
+134 320
+134 523
+134 528
+134 529
+134 537
+134 610
+134 671
+134 696
+134 706
+134 735
+134 754
+134 769
+134 806
+134 828
+134 846
+134 902
+134 908
+134 972
+134 1022
+135 5
+135 14
+135 92
+135 94
+135 108
+135 117
+135 216
+135 257
+135 297
+135 317
+135 332
+135 352
+135 392
+135 427
+135 430
+135 454
+135 518
+135 569
+135 585
+135 675
+135 679
+135 708
+135 718
+135 757
+135 804
+135 809
+135 836
+135 886
+135 891
+135 945
+135 959
+135 980
+135 1004
+136 84
+136 88
+136 97
+136 109
+136 121
+136 157
+136 190
+136 191
+136 198
+136 268
+136 304
+136 333
+136 488
+136 504
+136 521
+136 546
+136 622
+136 627
+136 693
+136 717
+136 739
+136 742
+136 745
+136 762
+136 776
+136 828
+136 849
+136 916
+136 926
+137 118
+137 123
+137 156
+137 159
+137 182
+137 187
+137 264
+137 302
+137 324
+137 344
+137 426
+137 546
+137 549
+137 581
+137 584
+137 590
+137 657
+137 701
+137 742
+137 754
+137 755
+137 765
+137 781
+137 810
+137 843
+137 873
+137 929
+137 949
+138 23
+138 68
+138 100
+138 110
+138 166
+138 208
+138 216
+138 240
+138 269
+138 302
+138 340
+138 349
+138 388
+138 416
+138 418
+138 422
+138 432
+138 458
+138 517
+138 536
+138 557
+138 565
+138 607
+138 634
+138 645
+138 649
+138 661
+138 670
+138 676
+138 767
+138 809
+138 818
+138 829
+138 839
+138 902
+138 915
+138 1009
+138 1021
+139 89
+139 127
+139 199
+139 253
+139 254
+139 264
+139 281
+139 345
+139 400
+139 439
+139 443
+139 448
+139 487
+139 548
+139 605
+139 609
+139 697
+139 716
+139 737
+139 803
+139 822
+139 830
+139 849
+139 878
+139 889
+139 933
+139 953
+139 968
+139 973
+139 1002
+139 1017
+140 17
+140 89
+140 119
+140 128
+140 132
+140 214
+140 221
+140 258
+140 274
+140 288
+140 294
+140 336
+140 371
+140 389
+140 409
+140 414
+140 480
+140 600
+140 602
+140 638
+140 648
+140 653
+140 669
+140 715
+140 723
+140 790
+140 796
+140 813
+140 836
+140 864
+140 885
+140 891
+140 909
+140 948
+141 117
+141 118
+141 171
+141 191
+141 325
+141 332
+141 340
+141 357
+141 389
+141 401
+141 423
+141 435
+141 443
+141 531
+141 540
+141 579
+141 592
+141 615
+141 675
+141 746
+141 786
+141 857
+141 872
+141 875
+141 905
+141 957
+141 1002
+141 1006
+141 1008
+142 41
+142 42
+142 47
+142 73
+142 88
+142 155
+142 160
+142 176
+142 199
+142 266
+142 287
+142 337
+142 387
+142 394
+142 484
+142 492
+142 500
+142 521
+142 653
+142 659
+142 662
+142 782
+142 846
+142 1002
+143 22
+143 30
+143 32
+143 66
+143 86
+143 106
+143 211
+143 247
+143 251
+143 253
+143 276
+143 283
+143 289
+143 323
+143 334
+143 347
+143 361
+143 400
+143 401
+143 406
+143 438
+143 490
+143 545
+143 562
+143 567
+143 593
+143 656
+143 660
+143 666
+143 693
+143 717
+143 756
+143 764
+143 824
+143 827
+143 852
+143 857
+143 890
+143 911
+143 922
+143 1015
+144 14
+144 34
+144 86
+144 110
+144 161
+144 210
+144 235
+144 243
+144 261
+144 362
+144 370
+144 417
+144 435
+144 440
+144 452
+144 514
+144 528
+144 539
+144 579
+144 605
+144 646
+144 664
+144 667
+144 676
+144 702
+144 703
+144 780
+144 798
+144 833
+144 899
+144 933
+144 1003
+145 12
+145 43
+145 54
+145 124
+145 126
+145 227
+145 310
+145 343
+145 359
+145 360
+145 396
+145 405
+145 577
+145 597
+145 603
+145 634
+145 639
+145 684
+145 688
+145 707
+145 724
+145 781
+145 785
+145 787
+145 824
+145 830
+145 868
+145 885
+145 927
+145 981
+145 988
+145 996
+146 85
+146 122
+146 124
+146 161
+146 178
+146 180
+146 350
+146 408
+146 472
+146 474
+146 514
+146 527
+146 553
+146 575
+146 603
+146 608
+146 611
+146 697
+146 701
+146 720
+146 764
+146 946
+146 956
+146 1023
+147 74
+147 100
+147 130
+147 165
+147 190
+147 229
+147 263
+147 295
+147 334
+147 368
+147 392
+147 420
+147 465
+147 487
+147 575
+147 617
+147 668
+147 728
+147 732
+147 920
+147 927
+147 935
+147 944
+147 996
+147 1007
+147 1020
+148 32
+148 80
+148 127
+148 155
+148 263
+148 335
+148 404
+148 409
+148 429
+148 464
+148 480
+148 505
+148 508
+148 556
+148 582
+148 603
+148 607
+148 613
+148 653
+148 675
+148 775
+148 857
+148 859
+148 883
+148 932
+148 958
+148 987
+148 995
+148 1001
+148 1014
+149 34
+149 49
+149 61
+149 99
+149 171
+149 172
+149 178
+149 380
+149 434
+149 462
+149 471
+149 524
+149 618
+149 621
+149 644
+149 649
+149 668
+149 698
+149 726
+149 749
+149 753
+149 766
+149 786
+149 815
+149 830
+149 835
+149 879
+149 925
+149 928
+149 941
+149 954
+150 3
+150 126
+150 166
+150 187
+150 201
+150 204
+150 216
+150 224
+150 249
+150 266
+150 321
+150 338
+150 355
+150 365
+150 382
+150 439
+150 453
+150 482
+150 501
+150 523
+150 539
+150 575
+150 586
+150 602
+150 611
+150 648
+150 669
+150 675
+150 696
+150 715
+150 735
+150 752
+150 763
+150 782
+150 810
+150 880
+150 903
+150 909
+150 936
+151 34
+151 57
+151 67
+151 104
+151 263
+151 293
+151 307
+151 423
+151 441
+151 462
+151 472
+151 524
+151 526
+151 547
+151 589
+151 645
+151 697
+151 717
+151 727
+151 744
+151 752
+151 795
+151 803
+151 810
+151 832
+151 839
+151 850
+151 915
+151 922
+151 925
+152 0
+152 70
+152 81
+152 103
+152 127
+152 194
+152 277
+152 329
+152 336
+152 352
+152 443
+152 466
+152 484
+152 492
+152 515
+152 531
+152 545
+152 577
+152 579
+152 584
+152 622
+152 641
+152 734
+152 740
+152 766
+152 887
+152 948
+152 956
+153 7
+153 17
+153 63
+153 65
+153 159
+153 172
+153 275
+153 305
+153 354
+153 396
+153 418
+153 441
+153 454
+153 476
+153 480
+153 495
+153 535
+153 613
+153 637
+153 646
+153 654
+153 660
+153 666
+153 718
+153 816
+153 844
+153 861
+153 864
+153 918
+153 948
+153 966
+153 973
+154 0
+154 50
+154 174
+154 404
+154 476
+154 499
+154 533
+154 566
+154 643
+154 647
+154 665
+154 780
+154 829
+154 839
+154 842
+154 877
+154 886
+154 959
+154 971
+154 973
+154 983
+155 119
+155 142
+155 148
+155 188
+155 248
+155 285
+155 297
+155 328
+155 400
+155 485
+155 492
+155 512
+155 690
+155 825
+155 855
+155 900
+155 997
+156 22
+156 57
+156 61
+156 137
+156 159
+156 162
+156 166
+156 265
+156 273
+156 351
+156 363
+156 395
+156 412
+156 475
+156 501
+156 544
+156 548
+156 582
+156 584
+156 593
+156 673
+156 798
+156 821
+156 866
+156 895
+156 913
+156 966
+156 970
+156 1013
+157 44
+157 136
+157 244
+157 339
+157 375
+157 377
+157 384
+157 395
+157 488
+157 517
+157 538
+157 562
+157 593
+157 626
+157 640
+157 645
+157 678
+157 714
+157 752
+157 798
+157 840
+157 851
+157 888
+157 892
+157 924
+157 937
+157 945
+157 947
+157 960
+157 1000
+158 2
+158 28
+158 47
+158 52
+158 88
+158 100
+158 257
+158 279
+158 285
+158 290
+158 303
+158 375
+158 383
+158 452
+158 462
+158 477
+158 504
+158 536
+158 589
+158 593
+158 597
+158 688
+158 723
+158 746
+158 766
+158 800
+158 806
+158 859
+158 882
+158 903
+158 944
+158 955
+158 995
+159 30
+159 49
+159 66
+159 83
+159 85
+159 106
+159 117
+159 137
+159 153
+159 156
+159 164
+159 182
+159 201
+159 261
+159 271
+159 278
+159 295
+159 338
+159 342
+159 346
+159 355
+159 420
+159 457
+159 461
+159 485
+159 513
+159 520
+159 531
+159 560
+159 629
+159 663
+159 699
+159 749
+159 781
+159 793
+159 882
+159 895
+159 901
+159 915
+159 922
+159 924
+159 1007
+160 61
+160 103
+160 142
+160 183
+160 200
+160 219
+160 327
+160 368
+160 387
+160 404
+160 412
+160 417
+160 451
+160 478
+160 502
+160 561
+160 588
+160 605
+160 617
+160 625
+160 645
+160 736
+160 783
+160 790
+160 879
+160 893
+160 902
+160 904
+160 916
+160 921
+160 1015
+161 4
+161 26
+161 36
+161 56
+161 81
+161 86
+161 144
+161 146
+161 196
+161 220
+161 238
+161 244
+161 270
+161 331
+161 370
+161 385
+161 474
+161 489
+161 512
+161 526
+161 551
+161 578
+161 614
+161 627
+161 652
+161 698
+161 703
+161 767
+161 779
+161 790
+161 799
+161 803
+161 811
+161 826
+161 842
+161 911
+161 945
+161 959
+161 963
+161 981
+162 22
+162 36
+162 156
+162 190
+162 194
+162 200
+162 226
+162 236
+162 274
+162 283
+162 327
+162 329
+162 405
+162 431
+162 432
+162 433
+162 442
+162 445
+162 452
+162 465
+162 480
+162 487
+162 555
+162 569
+162 609
+162 626
+162 638
+162 683
+162 693
+162 735
+162 750
+162 755
+162 765
+162 797
+162 900
+162 925
+162 965
+162 973
+163 3
+163 88
+163 93
+163 113
+163 193
+163 205
+163 275
+163 292
+163 332
+163 394
+163 488
+163 489
+163 527
+163 557
+163 587
+163 590
+163 744
+163 785
+163 937
+163 958
+163 970
+163 973
+163 992
+164 5
+164 8
+164 39
+164 58
+164 82
+164 122
+164 159
+164 169
+164 192
+164 250
+164 251
+164 263
+164 271
+164 376
+164 390
+164 408
+164 452
+164 470
+164 559
+164 569
+164 574
+164 632
+164 652
+164 654
+164 680
+164 683
+164 708
+164 739
+164 745
+164 786
+164 805
+164 814
+164 826
+164 827
+164 835
+164 876
+164 890
+164 972
+164 1014
+165 5
+165 13
+165 37
+165 132
+165 147
+165 235
+165 411
+165 439
+165 494
+165 513
+165 613
+165 631
+165 707
+165 739
+165 836
+165 901
+165 995
+165 1014
+166 16
+166 73
+166 127
+166 138
+166 150
+166 156
+166 191
+166 198
+166 222
+166 227
+166 230
+166 249
+166 268
+166 274
+166 284
+166 352
+166 358
+166 370
+166 410
+166 413
+166 437
+166 467
+166 519
+166 555
+166 626
+166 631
+166 684
+166 810
+166 847
+166 856
+166 908
+166 930
+166 949
+166 964
+167 0
+167 8
+167 18
+167 39
+167 54
+167 86
+167 129
+167 204
+167 207
+167 219
+167 278
+167 293
+167 323
+167 335
+167 364
+167 415
+167 450
+167 468
+167 479
+167 497
+167 540
+167 542
+167 543
+167 547
+167 687
+167 753
+167 767
+167 801
+167 812
+167 826
+167 844
+167 863
+167 887
+167 918
+167 920
+167 953
+167 956
+167 957
+167 959
+167 989
+167 996
+167 1008
+167 1010
+167 1013
+168 10
+168 46
+168 54
+168 62
+168 81
+168 119
+168 283
+168 293
+168 306
+168 461
+168 486
+168 496
+168 509
+168 560
+168 570
+168 595
+168 703
+168 738
+168 740
+168 806
+168 821
+168 951
+168 974
+168 1014
+169 0
+169 12
+169 74
+169 78
+169 89
+169 104
+169 111
+169 164
+169 219
+169 279
+169 291
+169 311
+169 380
+169 463
+169 522
+169 582
+169 594
+169 595
+169 647
+169 677
+169 731
+169 763
+169 821
+169 862
+169 867
+169 889
+169 946
+170 43
+170 81
+170 109
+170 189
+170 202
+170 214
+170 239
+170 270
+170 330
+170 411
+170 428
+170 440
+170 452
+170 457
+170 462
+170 521
+170 565
+170 602
+170 704
+170 710
+170 770
+170 823
+170 830
+170 838
+170 887
+170 903
+170 931
+170 935
+170 947
+170 1008
+171 89
+171 141
+171 149
+171 174
+171 222
+171 271
+171 294
+171 297
+171 363
+171 376
+171 381
+171 383
+171 391
+171 428
+171 434
+171 437
+171 448
+171 500
+171 510
+171 512
+171 565
+171 634
+171 657
+171 658
+171 787
+171 820
+171 828
+171 917
+171 922
+171 1022
+172 33
+172 41
+172 50
+172 72
+172 74
+172 81
+172 94
+172 118
+172 149
+172 153
+172 185
+172 287
+172 349
+172 366
+172 375
+172 400
+172 420
+172 431
+172 439
+172 449
+172 467
+172 567
+172 589
+172 606
+172 663
+172 703
+172 783
+172 789
+172 825
+172 846
+172 850
+172 887
+172 928
+172 943
+172 950
+172 951
+172 973
+172 1006
+173 6
+173 20
+173 45
+173 59
+173 101
+173 117
+173 219
+173 245
+173 261
+173 328
+173 360
+173 448
+173 453
+173 457
+173 495
+173 582
+173 612
+173 652
+173 707
+173 722
+173 732
+173 783
+173 792
+173 882
+173 1014
+173 1018
+173 1023
+174 46
+174 71
+174 91
+174 94
+174 104
+174 154
+174 171
+174 215
+174 228
+174 234
+174 238
+174 249
+174 289
+174 337
+174 355
+174 363
+174 412
+174 424
+174 478
+174 483
+174 487
+174 489
+174 518
+174 547
+174 550
+174 624
+174 632
+174 654
+174 658
+174 837
+174 839
+174 853
+174 857
+174 892
+174 960
+174 975
+174 999
+174 1005
+174 1011
+174 1012
+174 1020
+175 25
+175 79
+175 114
+175 118
+175 134
+175 210
+175 251
+175 256
+175 267
+175 333
+175 343
+175 367
+175 413
+175 415
+175 426
+175 440
+175 453
+175 520
+175 534
+175 537
+175 593
+175 627
+175 638
+175 664
+175 730
+175 744
+175 794
+175 828
+175 848
+175 893
+175 918
+175 950
+175 983
+176 30
+176 39
+176 91
+176 122
+176 142
+176 186
+176 206
+176 224
+176 258
+176 259
+176 272
+176 341
+176 431
+176 440
+176 454
+176 483
+176 513
+176 642
+176 671
+176 684
+176 709
+176 721
+176 731
+176 740
+176 750
+176 776
+176 778
+176 814
+176 847
+176 854
+176 954
+176 965
+176 971
+176 1001
+177 59
+177 86
+177 99
+177 122
+177 123
+177 200
+177 249
+177 320
+177 333
+177 398
+177 405
+177 436
+177 528
+177 553
+177 599
+177 613
+177 618
+177 627
+177 635
+177 645
+177 666
+177 674
+177 681
+177 690
+177 696
+177 731
+177 770
+177 865
+177 886
+177 916
+177 993
+177 995
+177 1021
+178 8
+178 46
+178 71
+178 105
+178 134
+178 146
+178 149
+178 197
+178 227
+178 232
+178 257
+178 367
+178 371
+178 419
+178 460
+178 495
+178 519
+178 565
+178 620
+178 640
+178 664
+178 712
+178 727
+178 767
+178 853
+178 935
+179 12
+179 37
+179 70
+179 75
+179 87
+179 111
+179 118
+179 122
+179 133
+179 189
+179 194
+179 203
+179 252
+179 296
+179 301
+179 416
+179 452
+179 485
+179 503
+179 548
+179 550
+179 567
+179 574
+179 631
+179 632
+179 655
+179 661
+179 718
+179 726
+179 729
+179 734
+179 774
+179 775
+179 780
+179 793
+179 826
+179 839
+179 852
+179 908
+179 938
+179 953
+179 964
+179 974
+179 985
+180 43
+180 73
+180 94
+180 117
+180 146
+180 232
+180 247
+180 249
+180 265
+180 267
+180 269
+180 271
+180 280
+180 345
+180 371
+180 385
+180 415
+180 419
+180 439
+180 445
+180 468
+180 471
+180 527
+180 556
+180 558
+180 584
+180 585
+180 591
+180 594
+180 611
+180 619
+180 624
+180 627
+180 676
+180 682
+180 689
+180 732
+180 746
+180 886
+180 907
+180 1019
+181 3
+181 13
+181 15
+181 36
+181 52
+181 65
+181 87
+181 93
+181 125
+181 222
+181 230
+181 240
+181 257
+181 261
+181 280
+181 307
+181 316
+181 334
+181 344
+181 499
+181 547
+181 556
+181 566
+181 623
+181 628
+181 645
+181 669
+181 679
+181 715
+181 761
+181 794
+181 851
+181 863
+181 871
+181 913
+181 923
+181 928
+181 937
+181 953
+181 984
+181 1006
+182 10
+182 12
+182 19
+182 25
+182 32
+182 64
+182 137
+182 159
+182 191
+182 193
+182 218
+182 242
+182 293
+182 314
+182 336
+182 430
+182 452
+182 468
+182 515
+182 519
+182 575
+182 580
+182 597
+182 609
+182 636
+182 645
+182 700
+182 730
+182 817
+182 828
+182 847
+182 873
+182 900
+182 901
+182 1009
+183 12
+183 28
+183 44
+183 106
+183 108
+183 113
+183 134
+183 160
+183 186
+183 213
+183 225
+183 242
+183 262
+183 288
+183 304
+183 413
+183 503
+183 545
+183 599
+183 628
+183 633
+183 637
+183 731
+183 736
+183 746
+183 776
+183 787
+183 795
+183 832
+183 844
+183 881
+183 898
+183 925
+183 960
+183 1015
+184 53
+184 109
+184 123
+184 237
+184 238
+184 273
+184 274
+184 283
+184 297
+184 340
+184 347
+184 377
+184 421
+184 534
+184 555
+184 598
+184 612
+184 615
+184 673
+184 712
+184 718
+184 760
+184 767
+184 778
+184 794
+184 812
+184 820
+184 828
+184 833
+184 843
+184 847
+184 866
+184 885
+184 900
+184 968
+184 981
+184 991
+185 3
+185 23
+185 36
+185 75
+185 107
+185 172
+185 230
+185 265
+185 267
+185 311
+185 342
+185 381
+185 416
+185 432
+185 468
+185 476
+185 483
+185 493
+185 525
+185 566
+185 698
+185 709
+185 740
+185 786
+185 790
+185 810
+185 822
+185 836
+185 881
+185 905
+185 933
+185 956
+185 1008
+186 2
+186 4
+186 24
+186 29
+186 89
+186 117
+186 122
+186 176
+186 183
+186 261
+186 268
+186 290
+186 306
+186 389
+186 514
+186 526
+186 583
+186 628
+186 634
+186 644
+186 651
+186 665
+186 678
+186 766
+186 801
+186 812
+186 816
+186 841
+186 850
+186 888
+186 911
+186 1007
+186 1021
+187 119
+187 137
+187 150
+187 216
+187 238
+187 323
+187 330
+187 350
+187 513
+187 548
+187 648
+187 656
+187 698
+187 707
+187 722
+187 744
+187 875
+187 927
+187 946
+187 1002
+188 15
+188 76
+188 88
+188 155
+188 214
+188 286
+188 311
+188 349
+188 392
+188 409
+188 438
+188 495
+188 502
+188 517
+188 539
+188 560
+188 575
+188 576
+188 673
+188 683
+188 806
+188 837
+188 914
+188 920
+188 963
+188 965
+188 971
+188 972
+189 21
+189 23
+189 95
+189 170
+189 179
+189 228
+189 252
+189 274
+189 281
+189 344
+189 392
+189 397
+189 559
+189 594
+189 611
+189 619
+189 630
+189 647
+189 648
+189 667
+189 705
+189 713
+189 745
+189 807
+189 814
+189 863
+189 878
+189 892
+189 973
+189 988
+190 43
+190 75
+190 136
+190 147
+190 162
+190 221
+190 299
+190 402
+190 460
+190 475
+190 499
+190 566
+190 569
+190 594
+190 618
+190 635
+190 653
+190 654
+190 670
+190 720
+190 853
+190 857
+190 868
+190 881
+190 913
+190 934
+190 971
+190 1000
+190 1008
+191 49
+191 108
+191 136
+191 141
+191 166
+191 182
+191 227
+191 243
+191 265
+191 283
+191 293
+191 318
+191 328
+191 352
+191 379
+191 404
+191 406
+191 418
+191 453
+191 490
+191 495
+191 505
+191 572
+191 586
+191 602
+191 663
+191 693
+191 703
+191 713
+191 723
+191 755
+191 770
+191 777
+191 818
+191 826
+191 867
+191 884
+191 891
+191 941
+191 984
+191 988
+192 8
+192 20
+192 36
+192 68
+192 94
+192 125
+192 132
+192 164
+192 254
+192 269
+192 367
+192 395
+192 423
+192 453
+192 489
+192 516
+192 517
+192 595
+192 604
+192 633
+192 640
+192 710
+192 743
+192 762
+192 827
+192 883
+192 915
+192 920
+192 950
+192 952
+192 981
+192 1021
+193 60
+193 163
+193 182
+193 278
+193 282
+193 300
+193 325
+193 357
+193 381
+193 395
+193 423
+193 474
+193 537
+193 549
+193 570
+193 585
+193 589
+193 617
+193 641
+193 752
+193 850
+193 856
+193 1003
+193 1009
+194 71
+194 78
+194 85
+194 94
+194 152
+194 162
+194 179
+194 217
+194 224
+194 251
+194 310
+194 383
+194 407
+194 409
+194 417
+194 496
+194 510
+194 537
+194 584
+194 603
+194 624
+194 677
+194 682
+194 727
+194 832
+194 869
+194 882
+194 910
+194 943
+194 944
+194 955
+194 977
+194 1006
+194 1020
+195 16
+195 36
+195 105
+195 242
+195 252
+195 257
+195 278
+195 302
+195 349
+195 367
+195 392
+195 393
+195 500
+195 505
+195 542
+195 547
+195 726
+195 730
+195 940
+195 1012
+196 2
+196 26
+196 28
+196 161
+196 197
+196 278
+196 327
+196 339
+196 349
+196 360
+196 384
+196 393
+196 397
+196 451
+196 472
+196 483
+196 491
+196 500
+196 523
+196 534
+196 599
+196 623
+196 661
+196 740
+196 742
+196 778
+196 822
+196 827
+196 837
+196 841
+196 843
+196 847
+196 938
+196 1009
+197 16
+197 46
+197 76
+197 178
+197 196
+197 245
+197 253
+197 259
+197 283
+197 284
+197 320
+197 358
+197 366
+197 374
+197 382
+197 410
+197 436
+197 447
+197 484
+197 519
+197 568
+197 608
+197 703
+197 777
+197 837
+197 901
+197 922
+197 928
+197 950
+197 964
+197 1000
+198 4
+198 61
+198 91
+198 92
+198 136
+198 166
+198 259
+198 280
+198 282
+198 294
+198 302
+198 315
+198 396
+198 399
+198 416
+198 485
+198 510
+198 518
+198 538
+198 542
+198 549
+198 568
+198 576
+198 619
+198 715
+198 733
+198 750
+198 759
+198 895
+198 971
+198 1002
+198 1004
+198 1012
+199 11
+199 21
+199 53
+199 83
+199 86
+199 89
+199 112
+199 139
+199 142
+199 265
+199 281
+199 347
+199 354
+199 408
+199 421
+199 445
+199 506
+199 509
+199 589
+199 615
+199 623
+199 650
+199 719
+199 792
+199 808
+199 810
+199 811
+199 812
+199 848
+199 859
+199 922
+199 979
+200 87
+200 88
+200 94
+200 98
+200 160
+200 162
+200 177
+200 217
+200 239
+200 257
+200 258
+200 339
+200 341
+200 380
+200 452
+200 467
+200 528
+200 538
+200 570
+200 648
+200 652
+200 684
+200 693
+200 744
+200 780
+200 798
+200 840
+200 853
+200 868
+200 961
+200 972
+200 1000
+200 1018
+200 1022
+201 61
+201 96
+201 111
+201 150
+201 159
+201 224
+201 269
+201 271
+201 274
+201 327
+201 340
+201 402
+201 435
+201 441
+201 507
+201 509
+201 525
+201 568
+201 573
+201 610
+201 612
+201 637
+201 687
+201 716
+201 740
+201 806
+201 820
+201 919
+201 922
+201 955
+201 963
+201 969
+201 971
+202 14
+202 20
+202 32
+202 65
+202 84
+202 87
+202 107
+202 129
+202 170
+202 216
+202 252
+202 287
+202 333
+202 336
+202 343
+202 349
+202 375
+202 404
+202 429
+202 654
+202 676
+202 677
+202 714
+202 718
+202 746
+202 782
+202 816
+202 826
+202 847
+202 852
+202 868
+202 918
+202 984
+202 1016
+203 2
+203 32
+203 40
+203 96
+203 179
+203 220
+203 239
+203 299
+203 317
+203 355
+203 514
+203 547
+203 551
+203 605
+203 673
+203 781
+203 782
+203 798
+203 813
+203 860
+203 880
+203 900
+203 918
+203 931
+203 986
+203 1010
+204 7
+204 96
+204 104
+204 114
+204 121
+204 123
+204 150
+204 167
+204 214
+204 241
+204 261
+204 283
+204 331
+204 366
+204 381
+204 386
+204 424
+204 472
+204 599
+204 660
+204 710
+204 732
+204 745
+204 746
+204 940
+204 997
+205 18
+205 77
+205 86
+205 133
+205 163
+205 238
+205 267
+205 288
+205 326
+205 327
+205 336
+205 351
+205 390
+205 415
+205 435
+205 485
+205 513
+205 645
+205 654
+205 701
+205 764
+205 769
+205 846
+205 851
+205 875
+205 884
+205 947
+205 990
+206 23
+206 97
+206 133
+206 176
+206 234
+206 248
+206 268
+206 281
+206 294
+206 322
+206 334
+206 336
+206 404
+206 426
+206 442
+206 524
+206 544
+206 613
+206 667
+206 684
+206 688
+206 715
+206 756
+206 775
+206 819
+206 833
+206 834
+206 855
+206 888
+206 902
+206 923
+206 967
+206 997
+207 47
+207 82
+207 116
+207 167
+207 250
+207 268
+207 272
+207 377
+207 398
+207 409
+207 453
+207 457
+207 463
+207 481
+207 495
+207 514
+207 521
+207 588
+207 612
+207 619
+207 627
+207 732
+207 753
+207 812
+207 813
+207 890
+207 895
+207 915
+207 916
+207 949
+207 980
+207 983
+208 124
+208 138
+208 271
+208 306
+208 460
+208 486
+208 593
+208 618
+208 633
+208 653
+208 780
+208 830
+208 854
+208 889
+208 893
+208 901
+208 964
+208 988
+208 998
+208 1006
+209 29
+209 127
+209 290
+209 361
+209 373
+209 387
+209 442
+209 444
+209 445
+209 465
+209 470
+209 494
+209 575
+209 603
+209 613
+209 633
+209 664
+209 668
+209 681
+209 686
+209 687
+209 716
+209 730
+209 733
+209 745
+209 796
+209 811
+209 855
+209 879
+209 882
+209 959
+209 973
+209 1016
+209 1018
+210 6
+210 36
+210 78
+210 144
+210 175
+210 239
+210 253
+210 275
+210 284
+210 409
+210 423
+210 460
+210 497
+210 506
+210 514
+210 594
+210 620
+210 633
+210 646
+210 684
+210 697
+210 704
+210 711
+210 716
+210 903
+210 912
+210 952
+210 962
+210 984
+210 985
+210 1005
+211 0
+211 9
+211 14
+211 143
+211 228
+211 261
+211 314
+211 323
+211 341
+211 351
+211 389
+211 445
+211 462
+211 487
+211 503
+211 515
+211 528
+211 534
+211 538
+211 620
+211 637
+211 706
+211 712
+211 747
+211 818
+211 851
+211 873
+211 875
+211 961
+211 976
+212 5
+212 15
+212 34
+212 224
+212 297
+212 303
+212 317
+212 406
+212 442
+212 514
+212 517
+212 522
+212 571
+212 579
+212 593
+212 628
+212 652
+212 658
+212 713
+212 733
+212 739
+212 794
+212 806
+212 825
+212 832
+212 904
+212 936
+212 953
+212 975
+212 1002
+213 0
+213 33
+213 94
+213 121
+213 134
+213 183
+213 216
+213 226
+213 234
+213 258
+213 263
+213 330
+213 332
+213 336
+213 351
+213 357
+213 364
+213 366
+213 382
+213 394
+213 406
+213 422
+213 595
+213 622
+213 731
+213 823
+213 843
+213 856
+213 910
+213 922
+213 931
+213 944
+213 959
+213 1008
+213 1009
+214 74
+214 128
+214 140
+214 170
+214 188
+214 204
+214 236
+214 311
+214 328
+214 349
+214 381
+214 447
+214 505
+214 561
+214 578
+214 628
+214 652
+214 680
+214 740
+214 741
+214 809
+214 842
+214 893
+214 900
+214 906
+214 999
+215 23
+215 37
+215 46
+215 53
+215 69
+215 118
+215 174
+215 240
+215 256
+215 293
+215 301
+215 329
+215 335
+215 374
+215 378
+215 380
+215 394
+215 398
+215 405
+215 406
+215 417
+215 450
+215 478
+215 540
+215 551
+215 555
+215 564
+215 644
+215 674
+215 681
+215 682
+215 699
+215 728
+215 740
+215 748
+215 757
+215 760
+215 803
+215 814
+215 868
+215 889
+215 927
+215 936
+215 998
+216 46
+216 50
+216 114
+216 135
+216 138
+216 150
+216 187
+216 202
+216 213
+216 248
+216 298
+216 316
+216 344
+216 351
+216 383
+216 464
+216 470
+216 501
+216 559
+216 583
+216 591
+216 646
+216 712
+216 843
+216 854
+216 866
+216 889
+216 913
+216 937
+216 969
+216 978
+216 989
+217 48
+217 82
+217 194
+217 200
+217 225
+217 247
+217 257
+217 333
+217 349
+217 365
+217 373
+217 453
+217 514
+217 529
+217 563
+217 565
+217 576
+217 587
+217 615
+217 624
+217 637
+217 667
+217 842
+217 845
+217 883
+217 886
+217 919
+217 928
+217 1018
+218 66
+218 98
+218 99
+218 182
+218 230
+218 284
+218 316
+218 322
+218 369
+218 388
+218 426
+218 504
+218 521
+218 539
+218 546
+218 568
+218 574
+218 587
+218 590
+218 651
+218 665
+218 760
+218 773
+218 843
+218 899
+218 909
+218 934
+218 955
+218 993
+218 1007
+219 41
+219 88
+219 92
+219 98
+219 99
+219 160
+219 167
+219 169
+219 173
+219 248
+219 255
+219 257
+219 333
+219 350
+219 395
+219 455
+219 461
+219 465
+219 470
+219 480
+219 557
+219 631
+219 698
+219 720
+219 725
+219 755
+219 756
+219 795
+219 869
+219 937
+219 948
+219 953
+219 964
+219 1002
+219 1017
+220 161
+220 203
+220 222
+220 223
+220 230
+220 257
+220 287
+220 292
+220 347
+220 410
+220 438
+220 463
+220 466
+220 520
+220 542
+220 547
+220 557
+220 574
+220 620
+220 641
+220 662
+220 730
+220 737
+220 741
+220 751
+220 763
+220 788
+220 831
+220 842
+220 853
+220 860
+220 894
+220 898
+220 905
+220 915
+220 958
+221 71
+221 140
+221 190
+221 256
+221 299
+221 337
+221 387
+221 506
+221 562
+221 640
+221 694
+221 762
+221 788
+221 798
+221 812
+221 815
+221 844
+221 870
+221 998
+221 1002
+222 47
+222 60
+222 98
+222 166
+222 171
+222 181
+222 220
+222 242
+222 257
+222 266
+222 287
+222 301
+222 306
+222 312
+222 347
+222 379
+222 415
+222 435
+222 452
+222 541
+222 553
+222 595
+222 599
+222 605
+222 636
+222 725
+222 756
+222 761
+222 771
+222 830
+222 850
+222 855
+222 896
+222 906
+222 912
+222 914
+222 925
+222 1023
+223 44
+223 64
+223 79
+223 129
+223 220
+223 260
+223 272
+223 365
+223 369
+223 391
+223 416
+223 418
+223 427
+223 488
+223 533
+223 543
+223 574
+223 587
+223 668
+223 702
+223 718
+223 719
+223 744
+223 769
+223 830
+223 854
+223 889
+223 901
+223 915
+223 935
+223 963
+223 972
+223 1012
+223 1017
+224 30
+224 81
+224 121
+224 150
+224 176
+224 194
+224 201
+224 212
+224 235
+224 240
+224 249
+224 273
+224 326
+224 375
+224 398
+224 432
+224 463
+224 508
+224 513
+224 570
+224 586
+224 631
+224 694
+224 758
+224 776
+224 800
+224 810
+224 850
+224 867
+224 869
+224 895
+224 922
+224 937
+224 1013
+225 1
+225 183
+225 217
+225 230
+225 249
+225 256
+225 297
+225 323
+225 396
+225 406
+225 419
+225 425
+225 446
+225 487
+225 518
+225 549
+225 551
+225 590
+225 599
+225 600
+225 609
+225 639
+225 693
+225 696
+225 701
+225 714
+225 721
+225 836
+225 838
+225 845
+225 850
+225 860
+225 878
+225 891
+225 893
+225 908
+225 916
+225 986
+225 1001
+225 1009
+226 3
+226 41
+226 61
+226 108
+226 162
+226 213
+226 243
+226 324
+226 329
+226 414
+226 418
+226 573
+226 576
+226 607
+226 624
+226 674
+226 685
+226 707
+226 721
+226 731
+226 740
+226 755
+226 837
+226 847
+226 859
+226 871
+226 934
+226 939
+226 958
+226 983
+226 995
+226 1001
+227 12
+227 101
+227 107
+227 145
+227 166
+227 178
+227 191
+227 268
+227 289
+227 295
+227 360
+227 378
+227 477
+227 480
+227 483
+227 544
+227 548
+227 624
+227 645
+227 695
+227 710
+227 748
+227 770
+227 802
+227 830
+227 848
+227 859
+227 865
+227 876
+227 919
+227 1019
+227 1021
+228 48
+228 62
+228 174
+228 189
+228 211
+228 254
+228 263
+228 294
+228 335
+228 342
+228 426
+228 439
+228 447
+228 468
+228 486
+228 574
+228 661
+228 675
+228 758
+228 763
+228 823
+228 827
+228 839
+228 860
+228 920
+228 930
+228 942
+228 945
+228 948
+228 954
+228 1007
+228 1013
+229 51
+229 72
+229 93
+229 103
+229 147
+229 256
+229 297
+229 299
+229 306
+229 316
+229 386
+229 398
+229 427
+229 452
+229 459
+229 467
+229 482
+229 495
+229 499
+229 596
+229 610
+229 615
+229 625
+229 655
+229 667
+229 710
+229 772
+229 786
+229 789
+229 795
+229 811
+229 930
+229 943
+229 988
+229 994
+229 1011
+229 1012
+229 1013
+230 4
+230 16
+230 17
+230 62
+230 166
+230 181
+230 185
+230 218
+230 220
+230 225
+230 246
+230 286
+230 334
+230 348
+230 360
+230 372
+230 396
+230 419
+230 427
+230 444
+230 537
+230 572
+230 633
+230 641
+230 672
+230 673
+230 686
+230 698
+230 746
+230 852
+230 867
+230 879
+230 896
+230 898
+230 945
+230 960
+230 965
+230 1010
+230 1019
+231 10
+231 14
+231 41
+231 98
+231 108
+231 116
+231 249
+231 268
+231 272
+231 294
+231 359
+231 502
+231 509
+231 541
+231 545
+231 553
+231 576
+231 664
+231 668
+231 671
+231 723
+231 787
+231 869
+231 953
+231 976
+231 994
+231 998
+231 1020
+231 1021
+232 9
+232 37
+232 42
+232 63
+232 178
+232 180
+232 286
+232 329
+232 330
+232 349
+232 364
+232 396
+232 434
+232 435
+232 441
+232 464
+232 508
+232 528
+232 577
+232 604
+232 610
+232 630
+232 768
+232 794
+232 868
+232 885
+232 895
+232 900
+232 924
+232 967
+232 992
+232 1007
+233 1
+233 15
+233 70
+233 86
+233 109
+233 121
+233 239
+233 310
+233 364
+233 419
+233 430
+233 433
+233 477
+233 518
+233 525
+233 591
+233 599
+233 605
+233 608
+233 653
+233 673
+233 752
+233 780
+233 789
+233 796
+233 845
+233 889
+233 911
+233 924
+233 925
+233 954
+233 985
+233 1022
+234 16
+234 19
+234 63
+234 118
+234 174
+234 206
+234 213
+234 253
+234 257
+234 303
+234 326
+234 370
+234 392
+234 420
+234 590
+234 599
+234 616
+234 630
+234 653
+234 743
+234 762
+234 770
+234 863
+234 880
+235 15
+235 92
+235 109
+235 132
+235 144
+235 165
+235 224
+235 253
+235 284
+235 302
+235 303
+235 336
+235 384
+235 386
+235 413
+235 419
+235 444
+235 461
+235 465
+235 482
+235 527
+235 558
+235 561
+235 580
+235 582
+235 693
+235 751
+235 774
+235 777
+235 850
+235 890
+235 956
+235 986
+236 108
+236 162
+236 214
+236 238
+236 263
+236 302
+236 336
+236 365
+236 461
+236 463
+236 472
+236 473
+236 482
+236 499
+236 585
+236 606
+236 617
+236 725
+236 753
+236 764
+236 801
+236 814
+236 832
+236 833
+236 850
+236 852
+236 955
+236 991
+236 1002
+237 25
+237 83
+237 91
+237 98
+237 127
+237 184
+237 249
+237 273
+237 294
+237 296
+237 302
+237 403
+237 435
+237 439
+237 444
+237 457
+237 479
+237 483
+237 528
+237 596
+237 615
+237 658
+237 695
+237 770
+237 833
+237 835
+237 836
+237 846
+237 847
+237 943
+237 958
+237 962
+237 1023
+238 7
+238 34
+238 47
+238 50
+238 67
+238 73
+238 161
+238 174
+238 184
+238 187
+238 205
+238 236
+238 253
+238 308
+238 331
+238 391
+238 456
+238 460
+238 489
+238 530
+238 587
+238 674
+238 753
+238 756
+238 766
+238 774
+238 780
+238 825
+238 866
+238 898
+238 952
+238 963
+238 1004
+239 30
+239 37
+239 41
+239 47
+239 115
+239 170
+239 200
+239 203
+239 210
+239 233
+239 328
+239 348
+239 376
+239 438
+239 448
+239 471
+239 514
+239 538
+239 564
+239 596
+239 680
+239 703
+239 729
+239 733
+239 775
+239 834
+239 840
+239 885
+239 891
+239 942
+240 23
+240 36
+240 56
+240 104
+240 128
+240 138
+240 181
+240 215
+240 224
+240 242
+240 261
+240 273
+240 288
+240 310
+240 319
+240 326
+240 327
+240 328
+240 365
+240 381
+240 399
+240 446
+240 516
+240 550
+240 557
+240 594
+240 604
+240 621
+240 632
+240 636
+240 639
+240 641
+240 857
+240 874
+240 890
+240 899
+240 954
+240 956
+240 962
+240 988
+240 993
+241 62
+241 69
+241 98
+241 118
+241 204
+241 363
+241 394
+241 423
+241 435
+241 440
+241 514
+241 539
+241 584
+241 651
+241 653
+241 654
+241 658
+241 729
+241 768
+241 776
+241 802
+241 844
+241 862
+241 883
+241 955
+241 970
+241 1009
+242 27
+242 38
+242 57
+242 67
+242 93
+242 103
+242 112
+242 113
+242 182
+242 183
+242 195
+242 222
+242 240
+242 260
+242 281
+242 346
+242 372
+242 382
+242 391
+242 541
+242 544
+242 581
+242 593
+242 606
+242 653
+242 701
+242 721
+242 940
+242 994
+242 1015
+243 12
+243 62
+243 126
+243 144
+243 191
+243 226
+243 248
+243 259
+243 364
+243 387
+243 428
+243 471
+243 520
+243 562
+243 565
+243 582
+243 603
+243 619
+243 660
+243 731
+243 741
+243 745
+243 812
+243 815
+243 931
+244 157
+244 161
+244 248
+244 265
+244 336
+244 399
+244 459
+244 462
+244 475
+244 511
+244 524
+244 575
+244 592
+244 606
+244 609
+244 623
+244 626
+244 669
+244 735
+244 758
+244 808
+244 840
+244 961
+244 976
+244 999
+245 50
+245 66
+245 81
+245 102
+245 173
+245 197
+245 248
+245 263
+245 284
+245 293
+245 311
+245 353
+245 370
+245 506
+245 519
+245 543
+245 588
+245 597
+245 599
+245 648
+245 659
+245 776
+245 800
+245 854
+245 906
+245 910
+245 929
+245 935
+245 961
+245 1011
+246 19
+246 21
+246 85
+246 121
+246 230
+246 252
+246 310
+246 334
+246 351
+246 352
+246 424
+246 471
+246 535
+246 536
+246 557
+246 663
+246 669
+246 697
+246 700
+246 702
+246 732
+246 735
+246 755
+246 801
+246 840
+246 1001
+246 1007
+246 1015
+246 1023
+247 17
+247 18
+247 21
+247 54
+247 130
+247 143
+247 180
+247 217
+247 295
+247 297
+247 307
+247 345
+247 365
+247 402
+247 431
+247 436
+247 448
+247 454
+247 471
+247 478
+247 508
+247 518
+247 536
+247 560
+247 571
+247 579
+247 595
+247 700
+247 708
+247 715
+247 746
+247 758
+247 836
+247 895
+247 936
+247 979
+247 998
+247 1012
+247 1016
+248 21
+248 29
+248 129
+248 155
+248 206
+248 216
+248 219
+248 243
+248 244
+248 245
+248 293
+248 305
+248 326
+248 328
+248 353
+248 355
+248 379
+248 447
+248 460
+248 465
+248 484
+248 519
+248 546
+248 577
+248 647
+248 787
+248 789
+248 819
+248 849
+248 851
+248 881
+248 1022
+249 16
+249 18
+249 150
+249 166
+249 174
+249 177
+249 180
+249 224
+249 225
+249 231
+249 237
+249 250
+249 313
+249 334
+249 454
+249 463
+249 464
+249 467
+249 671
+249 697
+249 719
+249 723
+249 792
+249 796
+249 809
+249 811
+249 876
+249 882
+249 890
+249 896
+249 903
+249 913
+249 965
+249 979
+249 1012
+250 105
+250 115
+250 164
+250 207
+250 249
+250 347
+250 354
+250 363
+250 376
+250 502
+250 509
+250 511
+250 545
+250 549
+250 553
+250 588
+250 589
+250 590
+250 684
+250 695
+250 714
+250 730
+250 773
+250 784
+250 803
+250 823
+250 897
+250 904
+250 914
+250 936
+250 987
+250 992
+250 1000
+251 1
+251 14
+251 61
+251 73
+251 87
+251 129
+251 143
+251 164
+251 175
+251 194
+251 311
+251 320
+251 344
+251 346
+251 354
+251 357
+251 362
+251 388
+251 396
+251 400
+251 414
+251 435
+251 510
+251 535
+251 559
+251 563
+251 565
+251 611
+251 622
+251 650
+251 680
+251 703
+251 740
+251 767
+251 781
+251 798
+251 821
+251 856
+251 939
+251 961
+251 964
+251 973
+251 977
+251 987
+251 996
+251 1006
+252 60
+252 103
+252 111
+252 131
+252 179
+252 189
+252 195
+252 202
+252 246
+252 267
+252 278
+252 311
+252 387
+252 417
+252 421
+252 518
+252 522
+252 561
+252 612
+252 669
+252 739
+252 807
+252 823
+252 843
+252 910
+252 914
+252 970
+252 980
+253 2
+253 18
+253 46
+253 132
+253 139
+253 143
+253 197
+253 210
+253 234
+253 235
+253 238
+253 260
+253 307
+253 325
+253 336
+253 349
+253 351
+253 358
+253 382
+253 403
+253 404
+253 513
+253 520
+253 582
+253 583
+253 589
+253 594
+253 664
+253 674
+253 687
+253 745
+253 765
+253 777
+253 837
+253 874
+253 886
+254 64
+254 112
+254 126
+254 132
+254 139
+254 192
+254 228
+254 264
+254 274
+254 366
+254 386
+254 484
+254 528
+254 542
+254 548
+254 558
+254 580
+254 594
+254 642
+254 668
+254 727
+254 760
+254 762
+254 764
+254 771
+254 803
+254 921
+254 935
+254 947
+255 219
+255 256
+255 331
+255 335
+255 410
+255 419
+255 437
+255 448
+255 529
+255 539
+255 608
+255 619
+255 636
+255 663
+255 673
+255 692
+255 706
+255 714
+255 724
+255 726
+255 756
+255 843
+255 893
+255 913
+255 916
+255 922
+255 1015
+256 4
+256 44
+256 99
+256 128
+256 175
+256 215
+256 221
+256 225
+256 229
+256 255
+256 260
+256 276
+256 421
+256 433
+256 447
+256 503
+256 538
+256 635
+256 652
+256 659
+256 697
+256 723
+256 762
+256 814
+256 820
+256 842
+256 847
+256 875
+256 887
+256 922
+256 947
+256 953
+256 1022
+257 57
+257 83
+257 84
+257 104
+257 135
+257 158
+257 178
+257 181
+257 195
+257 200
+257 217
+257 219
+257 220
+257 222
+257 234
+257 276
+257 313
+257 387
+257 443
+257 452
+257 455
+257 460
+257 464
+257 548
+257 553
+257 562
+257 563
+257 670
+257 796
+257 831
+257 862
+257 874
+257 891
+257 901
+257 915
+257 953
+257 973
+257 989
+258 1
+258 21
+258 48
+258 102
+258 140
+258 176
+258 200
+258 213
+258 261
+258 291
+258 294
+258 304
+258 340
+258 348
+258 366
+258 379
+258 405
+258 408
+258 410
+258 436
+258 461
+258 493
+258 502
+258 536
+258 591
+258 601
+258 665
+258 694
+258 697
+258 716
+258 741
+258 788
+258 805
+258 807
+258 812
+258 884
+258 919
+258 935
+258 940
+259 14
+259 15
+259 21
+259 24
+259 116
+259 129
+259 176
+259 197
+259 198
+259 243
+259 294
+259 348
+259 368
+259 372
+259 378
+259 379
+259 441
+259 486
+259 498
+259 508
+259 527
+259 576
+259 603
+259 608
+259 632
+259 685
+259 695
+259 708
+259 768
+259 826
+259 845
+259 854
+259 880
+259 887
+259 915
+259 980
+259 993
+259 1022
+260 3
+260 78
+260 84
+260 91
+260 223
+260 242
+260 253
+260 256
+260 284
+260 292
+260 343
+260 381
+260 421
+260 468
+260 488
+260 556
+260 630
+260 661
+260 688
+260 698
+260 714
+260 755
+260 797
+260 835
+260 848
+260 879
+260 1009
+261 9
+261 62
+261 111
+261 144
+261 159
+261 173
+261 181
+261 186
+261 204
+261 211
+261 240
+261 258
+261 294
+261 330
+261 369
+261 440
+261 476
+261 508
+261 541
+261 584
+261 597
+261 624
+261 653
+261 673
+261 676
+261 690
+261 757
+261 775
+261 818
+261 875
+261 885
+261 937
+261 952
+262 14
+262 30
+262 52
+262 70
+262 115
+262 121
+262 183
+262 271
+262 300
+262 364
+262 395
+262 399
+262 431
+262 498
+262 595
+262 641
+262 646
+262 655
+262 705
+262 713
+262 741
+262 766
+262 848
+262 891
+262 907
+262 980
+262 994
+263 12
+263 55
+263 67
+263 72
+263 80
+263 86
+263 130
+263 147
+263 148
+263 151
+263 164
+263 213
+263 228
+263 236
+263 245
+263 306
+263 318
+263 337
+263 365
+263 370
+263 377
+263 405
+263 505
+263 511
+263 514
+263 532
+263 576
+263 634
+263 651
+263 662
+263 670
+263 679
+263 736
+263 774
+263 784
+263 793
+263 858
+263 907
+263 1004
+263 1012
+264 7
+264 44
+264 80
+264 103
+264 137
+264 139
+264 254
+264 291
+264 303
+264 317
+264 326
+264 366
+264 388
+264 399
+264 439
+264 468
+264 478
+264 564
+264 630
+264 631
+264 708
+264 754
+264 763
+264 764
+264 773
+264 819
+264 878
+264 886
+264 918
+264 921
+264 972
+264 986
+265 100
+265 156
+265 180
+265 185
+265 191
+265 199
+265 244
+265 278
+265 295
+265 320
+265 368
+265 385
+265 417
+265 428
+265 434
+265 451
+265 468
+265 475
+265 540
+265 600
+265 609
+265 675
+265 677
+265 708
+265 755
+265 857
+265 863
+265 890
+265 942
+266 12
+266 13
+266 14
+266 108
+266 120
+266 142
+266 150
+266 222
+266 321
+266 373
+266 392
+266 408
+266 409
+266 524
+266 530
+266 557
+266 565
+266 567
+266 581
+266 651
+266 696
+266 719
+266 788
+266 810
+266 844
+266 855
+266 974
+267 43
+267 66
+267 93
+267 124
+267 175
+267 180
+267 185
+267 205
+267 252
+267 285
+267 341
+267 343
+267 405
+267 424
+267 471
+267 513
+267 520
+267 526
+267 541
+267 566
+267 595
+267 599
+267 609
+267 641
+267 669
+267 701
+267 707
+267 746
+267 756
+267 783
+267 790
+267 814
+267 878
+267 892
+267 897
+267 913
+267 950
+267 994
+268 18
+268 69
+268 78
+268 103
+268 136
+268 166
+268 186
+268 206
+268 207
+268 227
+268 231
+268 276
+268 297
+268 362
+268 417
+268 426
+268 483
+268 494
+268 551
+268 555
+268 619
+268 651
+268 660
+268 669
+268 739
+268 752
+268 829
+268 851
+268 865
+268 882
+268 944
+268 948
+268 952
+268 965
+268 976
+269 44
+269 49
+269 57
+269 138
+269 180
+269 192
+269 201
+269 306
+269 341
+269 422
+269 432
+269 446
+269 447
+269 464
+269 480
+269 499
+269 500
+269 535
+269 590
+269 611
+269 626
+269 653
+269 793
+269 818
+269 862
+269 865
+269 897
+269 903
+269 957
+269 958
+270 32
+270 77
+270 97
+270 104
+270 161
+270 170
+270 283
+270 438
+270 443
+270 481
+270 521
+270 541
+270 674
+270 680
+270 688
+270 693
+270 696
+270 700
+270 794
+270 822
+270 826
+270 852
+270 861
+270 869
+270 952
+270 1014
+271 7
+271 32
+271 45
+271 125
+271 159
+271 164
+271 171
+271 180
+271 201
+271 208
+271 262
+271 349
+271 382
+271 412
+271 421
+271 470
+271 493
+271 496
+271 558
+271 642
+271 647
+271 732
+271 736
+271 754
+271 785
+271 790
+271 856
+271 888
+271 913
+271 930
+271 1003
+271 1005
+272 60
+272 80
+272 176
+272 207
+272 223
+272 231
+272 327
+272 351
+272 370
+272 432
+272 438
+272 443
+272 445
+272 506
+272 511
+272 525
+272 558
+272 592
+272 637
+272 657
+272 664
+272 721
+272 745
+272 755
+272 777
+272 799
+272 803
+272 844
+272 912
+272 928
+272 940
+272 958
+273 122
+273 156
+273 184
+273 224
+273 237
+273 240
+273 277
+273 336
+273 387
+273 401
+273 409
+273 437
+273 447
+273 458
+273 475
+273 492
+273 514
+273 518
+273 522
+273 564
+273 573
+273 574
+273 636
+273 639
+273 672
+273 705
+273 731
+273 762
+273 837
+273 874
+273 900
+273 924
+273 925
+273 1015
+274 63
+274 102
+274 112
+274 140
+274 162
+274 166
+274 184
+274 189
+274 201
+274 254
+274 296
+274 332
+274 362
+274 382
+274 384
+274 437
+274 443
+274 462
+274 502
+274 601
+274 676
+274 681
+274 684
+274 719
+274 743
+274 749
+274 770
+274 818
+274 852
+274 855
+274 860
+274 865
+274 913
+274 951
+274 981
+275 11
+275 32
+275 55
+275 64
+275 85
+275 133
+275 153
+275 163
+275 210
+275 303
+275 313
+275 386
+275 395
+275 426
+275 528
+275 536
+275 581
+275 592
+275 603
+275 606
+275 648
+275 670
+275 763
+275 892
+275 907
+275 934
+275 950
+275 1003
+276 5
+276 8
+276 26
+276 65
+276 76
+276 122
+276 143
+276 256
+276 257
+276 268
+276 349
+276 372
+276 399
+276 422
+276 426
+276 453
+276 505
+276 510
+276 542
+276 678
+276 797
+276 814
+276 927
+276 944
+276 996
+276 1000
+276 1001
+277 42
+277 54
+277 74
+277 152
+277 273
+277 286
+277 311
+277 336
+277 339
+277 402
+277 438
+277 469
+277 474
+277 505
+277 515
+277 525
+277 530
+277 538
+277 551
+277 568
+277 587
+277 598
+277 609
+277 623
+277 640
+277 653
+277 712
+277 719
+277 735
+277 780
+277 834
+277 844
+277 854
+277 871
+277 898
+277 917
+277 1015
+278 0
+278 18
+278 20
+278 88
+278 159
+278 167
+278 193
+278 195
+278 196
+278 252
+278 265
+278 285
+278 329
+278 356
+278 370
+278 376
+278 390
+278 464
+278 500
+278 577
+278 585
+278 618
+278 656
+278 700
+278 713
+278 779
+278 790
+278 795
+278 802
+278 813
+278 833
+278 859
+278 910
+278 940
+278 993
+278 1003
+279 40
+279 77
+279 113
+279 158
+279 169
+279 301
+279 316
+279 328
+279 330
+279 394
+279 410
+279 441
+279 518
+279 632
+279 636
+279 768
+279 769
+279 783
+279 816
+279 862
+279 891
+279 927
+279 929
+279 956
+279 982
+280 23
+280 180
+280 181
+280 198
+280 310
+280 364
+280 416
+280 422
+280 434
+280 478
+280 510
+280 543
+280 551
+280 561
+280 646
+280 720
+280 721
+280 727
+280 745
+280 765
+280 855
+280 871
+280 889
+280 900
+280 944
+281 23
+281 28
+281 83
+281 98
+281 139
+281 189
+281 199
+281 206
+281 242
+281 285
+281 337
+281 343
+281 344
+281 386
+281 445
+281 467
+281 599
+281 610
+281 616
+281 618
+281 667
+281 687
+281 704
+281 707
+281 807
+281 864
+281 888
+281 978
+282 42
+282 79
+282 122
+282 193
+282 198
+282 336
+282 375
+282 411
+282 432
+282 677
+282 748
+282 852
+282 857
+282 883
+282 985
+282 987
+282 1009
+282 1017
+283 46
+283 48
+283 52
+283 68
+283 86
+283 92
+283 125
+283 143
+283 162
+283 168
+283 184
+283 191
+283 197
+283 204
+283 270
+283 306
+283 387
+283 417
+283 505
+283 512
+283 584
+283 598
+283 655
+283 677
+283 725
+283 761
+283 794
+283 839
+283 852
+283 868
+283 946
+283 947
+283 960
+283 981
+283 989
+283 1005
+284 49
+284 52
+284 166
+284 197
+284 210
+284 218
+284 235
+284 245
+284 260
+284 302
+284 400
+284 445
+284 504
+284 520
+284 552
+284 572
+284 585
+284 653
+284 661
+284 762
+284 782
+284 912
+284 916
+284 934
+284 942
+284 969
+284 1009
+284 1018
+285 16
+285 43
+285 100
+285 155
+285 158
+285 267
+285 278
+285 281
+285 335
+285 338
+285 358
+285 369
+285 376
+285 402
+285 491
+285 508
+285 526
+285 562
+285 567
+285 590
+285 618
+285 656
+285 709
+285 723
+285 752
+285 753
+285 756
+285 759
+285 792
+285 822
+285 823
+285 851
+285 852
+285 857
+285 878
+285 886
+285 905
+285 907
+286 39
+286 99
+286 188
+286 230
+286 232
+286 277
+286 311
+286 326
+286 342
+286 357
+286 415
+286 423
+286 476
+286 482
+286 541
+286 599
+286 602
+286 614
+286 633
+286 680
+286 715
+286 719
+286 771
+286 795
+286 827
+286 879
+286 1001
+287 2
+287 17
+287 81
+287 82
+287 87
+287 142
+287 172
+287 202
+287 220
+287 222
+287 301
+287 308
+287 316
+287 330
+287 334
+287 387
+287 403
+287 418
+287 435
+287 442
+287 489
+287 521
+287 648
+287 658
+287 696
+287 731
+287 749
+287 835
+287 882
+287 883
+287 885
+287 902
+287 950
+288 82
+288 91
+288 126
+288 140
+288 183
+288 205
+288 240
+288 308
+288 344
+288 390
+288 402
+288 447
+288 461
+288 471
+288 478
+288 484
+288 510
+288 538
+288 555
+288 625
+288 643
+288 719
+288 732
+288 883
+288 889
+288 956
+288 958
+288 961
+288 982
+288 1023
+289 61
+289 78
+289 97
+289 119
+289 143
+289 174
+289 227
+289 353
+289 358
+289 395
+289 519
+289 528
+289 534
+289 544
+289 545
+289 578
+289 697
+289 702
+289 808
+289 856
+289 860
+289 902
+289 908
+289 928
+289 999
+289 1010
+289 1012
+290 88
+290 132
+290 158
+290 186
+290 209
+290 311
+290 318
+290 322
+290 349
+290 393
+290 394
+290 395
+290 447
+290 475
+290 496
+290 553
+290 560
+290 649
+290 650
+290 709
+290 774
+290 777
+290 787
+290 803
+290 809
+290 814
+290 815
+290 853
+290 868
+290 870
+290 928
+290 961
+290 988
+291 3
+291 14
+291 17
+291 18
+291 33
+291 58
+291 61
+291 81
+291 132
+291 169
+291 258
+291 264
+291 307
+291 310
+291 338
+291 357
+291 361
+291 426
+291 480
+291 533
+291 538
+291 540
+291 586
+291 611
+291 613
+291 620
+291 653
+291 670
+291 708
+291 721
+291 767
+291 775
+291 786
+291 826
+291 827
+291 840
+291 846
+291 865
+291 956
+291 960
+291 1012
+292 3
+292 8
+292 20
+292 70
+292 163
+292 220
+292 260
+292 374
+292 486
+292 544
+292 611
+292 629
+292 649
+292 677
+292 684
+292 718
+292 720
+292 739
+292 816
+292 818
+292 843
+292 1008
+292 1013
+293 39
+293 102
+293 117
+293 151
+293 167
+293 168
+293 182
+293 191
+293 215
+293 245
+293 248
+293 338
+293 344
+293 374
+293 378
+293 381
+293 407
+293 434
+293 444
+293 465
+293 509
+293 544
+293 581
+293 607
+293 684
+293 869
+293 883
+293 891
+293 897
+293 898
+293 903
+293 982
+293 999
+294 34
+294 49
+294 50
+294 84
+294 140
+294 171
+294 198
+294 206
+294 228
+294 231
+294 237
+294 258
+294 259
+294 261
+294 326
+294 366
+294 406
+294 454
+294 479
+294 495
+294 522
+294 538
+294 565
+294 577
+294 603
+294 650
+294 656
+294 677
+294 741
+294 762
+294 824
+294 898
+294 908
+294 951
+294 1001
+295 6
+295 68
+295 88
+295 127
+295 147
+295 159
+295 227
+295 247
+295 265
+295 332
+295 401
+295 418
+295 558
+295 569
+295 614
+295 616
+295 641
+295 656
+295 657
+295 738
+295 747
+295 841
+295 842
+295 913
+295 920
+295 954
+295 958
+295 979
+295 986
+295 996
+295 1001
+296 179
+296 237
+296 274
+296 303
+296 366
+296 374
+296 395
+296 421
+296 440
+296 457
+296 501
+296 534
+296 568
+296 639
+296 672
+296 689
+296 796
+296 817
+296 934
+296 939
+296 947
+296 950
+296 964
+296 987
+296 1001
+297 10
+297 47
+297 66
+297 87
+297 135
+297 155
+297 171
+297 184
+297 212
+297 225
+297 229
+297 247
+297 268
+297 307
+297 371
+297 375
+297 378
+297 454
+297 501
+297 505
+297 519
+297 527
+297 581
+297 618
+297 619
+297 634
+297 693
+297 719
+297 772
+297 773
+297 796
+297 885
+297 983
+297 1005
+297 1006
+298 13
+298 51
+298 216
+298 326
+298 357
+298 360
+298 369
+298 383
+298 402
+298 459
+298 535
+298 544
+298 566
+298 603
+298 767
+298 825
+298 909
+298 934
+298 995
+298 1002
+298 1020
+299 39
+299 47
+299 77
+299 104
+299 119
+299 123
+299 190
+299 203
+299 221
+299 229
+299 351
+299 356
+299 380
+299 394
+299 444
+299 455
+299 488
+299 542
+299 580
+299 673
+299 686
+299 727
+299 740
+299 746
+299 768
+299 770
+299 778
+299 800
+299 852
+299 905
+299 908
+299 935
+299 959
+299 964
+299 974
+299 987
+299 990
+299 999
+299 1010
+300 58
+300 88
+300 130
+300 193
+300 262
+300 374
+300 454
+300 494
+300 555
+300 569
+300 574
+300 756
+300 772
+300 790
+300 811
+300 828
+300 875
+300 876
+300 908
+300 985
+300 986
+300 1004
+300 1005
+301 15
+301 23
+301 69
+301 70
+301 179
+301 215
+301 222
+301 279
+301 287
+301 361
+301 476
+301 485
+301 519
+301 520
+301 534
+301 544
+301 560
+301 593
+301 627
+301 628
+301 759
+301 813
+301 826
+301 829
+301 836
+301 853
+301 865
+301 880
+301 888
+301 900
+301 933
+301 997
+301 998
+302 5
+302 89
+302 104
+302 114
+302 137
+302 138
+302 195
+302 198
+302 235
+302 236
+302 237
+302 284
+302 325
+302 341
+302 351
+302 361
+302 438
+302 443
+302 465
+302 474
+302 517
+302 646
+302 671
+302 690
+302 758
+302 792
+302 819
+302 908
+302 918
+302 919
+302 992
+303 28
+303 30
+303 38
+303 52
+303 77
+303 117
+303 158
+303 212
+303 234
+303 235
+303 264
+303 275
+303 296
+303 312
+303 335
+303 341
+303 482
+303 499
+303 508
+303 628
+303 642
+303 664
+303 811
+303 837
+303 907
+303 913
+303 916
+303 942
+303 1006
+303 1019
+303 1021
+304 22
+304 41
+304 42
+304 136
+304 183
+304 258
+304 338
+304 350
+304 370
+304 403
+304 428
+304 439
+304 448
+304 460
+304 466
+304 482
+304 484
+304 491
+304 499
+304 606
+304 663
+304 689
+304 715
+304 725
+304 755
+304 777
+304 868
+304 897
+304 959
+304 967
+305 50
+305 73
+305 76
+305 102
+305 153
+305 248
+305 316
+305 318
+305 369
+305 403
+305 430
+305 441
+305 447
+305 461
+305 465
+305 469
+305 487
+305 517
+305 594
+305 607
+305 627
+305 645
+305 688
+305 712
+305 732
+305 801
+305 831
+305 924
+305 966
+305 973
+306 15
+306 25
+306 30
+306 37
+306 62
+306 104
+306 168
+306 186
+306 208
+306 222
+306 229
+306 263
+306 269
+306 283
+306 463
+306 488
+306 496
+306 561
+306 576
+306 714
+306 722
+306 731
+306 797
+306 854
+306 909
+306 948
+306 1008
+306 1023
+307 54
+307 66
+307 110
+307 151
+307 181
+307 247
+307 253
+307 291
+307 297
+307 372
+307 389
+307 424
+307 436
+307 441
+307 447
+307 461
+307 465
+307 507
+307 513
+307 517
+307 519
+307 524
+307 537
+307 591
+307 593
+307 594
+307 602
+307 694
+307 706
+307 743
+307 777
+307 810
+307 840
+307 876
+307 926
+307 962
+307 979
+307 1003
+308 48
+308 69
+308 80
+308 238
+308 287
+308 288
+308 311
+308 318
+308 325
+308 349
+308 403
+308 407
+308 469
+308 496
+308 506
+308 538
+308 616
+308 632
+308 636
+308 657
+308 693
+308 705
+308 724
+308 727
+308 738
+308 739
+308 758
+308 860
+308 861
+308 894
+308 929
+308 932
+308 935
+308 962
+309 3
+309 107
+309 312
+309 325
+309 344
+309 399
+309 464
+309 496
+309 524
+309 557
+309 605
+309 705
+309 738
+309 748
+309 761
+309 802
+309 853
+309 875
+309 959
+309 996
+309 1016
+309 1017
+310 56
+310 59
+310 89
+310 95
+310 124
+310 145
+310 194
+310 233
+310 240
+310 246
+310 280
+310 291
+310 324
+310 375
+310 381
+310 431
+310 455
+310 466
+310 554
+310 571
+310 611
+310 616
+310 640
+310 658
+310 660
+310 679
+310 710
+310 762
+310 782
+310 844
+310 956
+310 959
+310 964
+310 983
+310 1018
+311 31
+311 51
+311 56
+311 82
+311 83
+311 125
+311 169
+311 185
+311 188
+311 214
+311 245
+311 251
+311 252
+311 277
+311 286
+311 290
+311 308
+311 315
+311 329
+311 363
+311 388
+311 392
+311 413
+311 435
+311 500
+311 515
+311 562
+311 588
+311 596
+311 600
+311 601
+311 602
+311 649
+311 673
+311 737
+311 741
+311 753
+311 808
+311 830
+311 859
+311 868
+311 901
+311 916
+311 957
+311 960
+311 982
+312 6
+312 29
+312 54
+312 55
+312 68
+312 72
+312 120
+312 124
+312 222
+312 303
+312 309
+312 315
+312 385
+312 415
+312 465
+312 485
+312 504
+312 523
+312 544
+312 577
+312 583
+312 593
+312 747
+312 768
+312 802
+312 821
+312 875
+312 878
+312 925
+312 984
+312 995
+312 1002
+312 1010
+313 26
+313 27
+313 70
+313 82
+313 104
+313 121
+313 249
+313 257
+313 275
+313 351
+313 417
+313 434
+313 435
+313 469
+313 571
+313 582
+313 588
+313 618
+313 668
+313 679
+313 681
+313 756
+313 815
+313 822
+313 826
+313 828
+313 864
+313 917
+313 922
+313 933
+313 941
+313 1002
+314 56
+314 65
+314 111
+314 124
+314 182
+314 211
+314 326
+314 361
+314 374
+314 388
+314 491
+314 534
+314 554
+314 559
+314 574
+314 598
+314 639
+314 685
+314 715
+314 732
+314 752
+314 789
+314 812
+314 840
+314 847
+314 858
+314 862
+314 882
+314 979
+314 994
+314 1013
+315 0
+315 1
+315 42
+315 54
+315 94
+315 198
+315 311
+315 312
+315 340
+315 371
+315 433
+315 480
+315 517
+315 543
+315 559
+315 566
+315 579
+315 697
+315 778
+315 786
+315 803
+315 917
+315 940
+315 1022
+316 24
+316 83
+316 86
+316 115
+316 132
+316 181
+316 216
+316 218
+316 229
+316 279
+316 287
+316 305
+316 330
+316 360
+316 398
+316 419
+316 448
+316 454
+316 502
+316 520
+316 602
+316 673
+316 684
+316 729
+316 770
+316 782
+316 823
+316 940
+316 945
+316 979
+316 980
+316 999
+316 1023
+317 14
+317 56
+317 96
+317 108
+317 110
+317 113
+317 135
+317 203
+317 212
+317 264
+317 344
+317 367
+317 388
+317 399
+317 403
+317 465
+317 476
+317 490
+317 502
+317 521
+317 603
+317 632
+317 664
+317 716
+317 851
+317 866
+317 878
+317 882
+317 890
+317 892
+317 960
+317 984
+318 7
+318 45
+318 191
+318 263
+318 290
+318 305
+318 308
+318 326
+318 415
+318 417
+318 545
+318 563
+318 601
+318 656
+318 721
+318 743
+318 780
+318 957
+318 958
+318 969
+318 998
+318 1000
+319 84
+319 240
+319 376
+319 378
+319 381
+319 400
+319 491
+319 524
+319 537
+319 563
+319 569
+319 574
+319 605
+319 623
+319 673
+319 687
+319 790
+319 803
+319 840
+319 870
+319 876
+319 922
+319 941
+319 958
+319 997
+319 1023
+320 0
+320 29
+320 31
+320 102
+320 134
+320 177
+320 197
+320 251
+320 265
+320 324
+320 383
+320 387
+320 390
+320 474
+320 524
+320 530
+320 540
+320 546
+320 629
+320 655
+320 666
+320 710
+320 740
+320 792
+320 793
+320 871
+320 874
+320 940
+320 944
+320 1003
+321 8
+321 27
+321 29
+321 30
+321 91
+321 93
+321 113
+321 131
+321 150
+321 266
+321 367
+321 389
+321 429
+321 448
+321 581
+321 606
+321 622
+321 625
+321 633
+321 668
+321 735
+321 749
+321 774
+321 869
+321 886
+321 890
+321 900
+321 975
+321 994
+322 0
+322 125
+322 206
+322 218
+322 290
+322 328
+322 338
+322 418
+322 484
+322 503
+322 584
+322 616
+322 728
+322 845
+322 879
+322 895
+322 923
+322 949
+322 956
+323 1
+323 9
+323 12
+323 17
+323 25
+323 57
+323 58
+323 85
+323 92
+323 116
+323 128
+323 143
+323 167
+323 187
+323 211
+323 225
+323 326
+323 334
+323 448
+323 511
+323 520
+323 536
+323 550
+323 671
+323 685
+323 721
+323 743
+323 766
+323 769
+323 781
+323 821
+323 824
+323 843
+323 853
+323 888
+323 904
+323 931
+323 982
+323 992
+323 1023
+324 12
+324 39
+324 137
+324 226
+324 310
+324 320
+324 346
+324 364
+324 385
+324 389
+324 395
+324 441
+324 458
+324 490
+324 523
+324 535
+324 597
+324 604
+324 708
+324 711
+324 712
+324 747
+324 751
+324 867
+324 889
+324 894
+324 920
+324 921
+324 923
+324 946
+324 958
+324 976
+325 65
+325 72
+325 73
+325 77
+325 88
+325 141
+325 193
+325 253
+325 302
+325 308
+325 309
+325 392
+325 395
+325 475
+325 522
+325 539
+325 590
+325 601
+325 604
+325 622
+325 648
+325 691
+325 692
+325 725
+325 728
+325 756
+325 855
+325 856
+325 868
+325 933
+325 964
+325 1015
+326 9
+326 38
+326 48
+326 91
+326 95
+326 112
+326 205
+326 224
+326 234
+326 240
+326 248
+326 264
+326 286
+326 294
+326 298
+326 314
+326 318
+326 323
+326 336
+326 406
+326 511
+326 571
+326 585
+326 618
+326 638
+326 660
+326 684
+326 737
+326 739
+326 767
+326 812
+326 838
+326 851
+326 881
+326 888
+326 896
+326 900
+326 909
+326 918
+326 923
+326 924
+326 926
+326 941
+326 962
+326 996
+326 1020
+327 1
+327 44
+327 132
+327 160
+327 162
+327 196
+327 201
+327 205
+327 240
+327 272
+327 330
+327 407
+327 466
+327 521
+327 524
+327 540
+327 607
+327 617
+327 741
+327 742
+327 794
+327 802
+327 818
+327 842
+327 855
+327 925
+328 106
+328 131
+328 155
+328 173
+328 191
+328 214
+328 239
+328 240
+328 248
+328 279
+328 322
+328 342
+328 386
+328 444
+328 452
+328 458
+328 511
+328 537
+328 581
+328 638
+328 689
+328 739
+328 759
+328 771
+328 811
+328 827
+328 828
+328 878
+328 893
+328 902
+328 923
+329 61
+329 62
+329 110
+329 152
+329 162
+329 215
+329 226
+329 232
+329 278
+329 311
+329 368
+329 379
+329 482
+329 498
+329 586
+329 591
+329 615
+329 622
+329 677
+329 679
+329 725
+329 801
+329 802
+329 811
+329 823
+329 858
+329 953
+329 966
+329 990
+329 1002
+330 15
+330 22
+330 34
+330 62
+330 68
+330 115
+330 128
+330 170
+330 187
+330 213
+330 232
+330 261
+330 279
+330 287
+330 316
+330 327
+330 399
+330 403
+330 425
+330 550
+330 578
+330 681
+330 686
+330 764
+330 773
+330 846
+330 865
+330 901
+330 903
+330 945
+330 946
+330 957
+330 972
+330 973
+330 994
+330 1009
+331 2
+331 17
+331 42
+331 86
+331 95
+331 96
+331 105
+331 108
+331 119
+331 127
+331 161
+331 204
+331 238
+331 255
+331 340
+331 351
+331 407
+331 428
+331 552
+331 565
+331 573
+331 619
+331 674
+331 681
+331 702
+331 741
+331 751
+331 791
+331 796
+331 814
+331 986
+331 1017
+331 1020
+332 35
+332 53
+332 56
+332 79
+332 81
+332 82
+332 135
+332 141
+332 163
+332 213
+332 274
+332 295
+332 333
+332 334
+332 432
+332 444
+332 457
+332 490
+332 597
+332 602
+332 638
+332 640
+332 686
+332 767
+332 774
+332 796
+332 825
+332 852
+332 901
+332 929
+332 965
+332 986
+332 1009
+332 1015
+333 6
+333 122
+333 136
+333 175
+333 177
+333 202
+333 217
+333 219
+333 332
+333 354
+333 373
+333 407
+333 435
+333 498
+333 526
+333 575
+333 626
+333 663
+333 682
+333 703
+333 731
+333 764
+333 770
+333 843
+333 926
+333 976
+333 982
+333 983
+333 996
+333 1002
+334 3
+334 37
+334 65
+334 71
+334 82
+334 143
+334 147
+334 181
+334 206
+334 230
+334 246
+334 249
+334 287
+334 323
+334 332
+334 335
+334 344
+334 374
+334 401
+334 481
+334 548
+334 623
+334 626
+334 676
+334 783
+334 849
+334 868
+334 910
+334 915
+334 931
+334 934
+334 967
+335 6
+335 36
+335 37
+335 76
+335 86
+335 148
+335 167
+335 215
+335 228
+335 255
+335 285
+335 303
+335 334
+335 352
+335 358
+335 378
+335 399
+335 447
+335 483
+335 548
+335 570
+335 603
+335 615
+335 629
+335 637
+335 643
+335 647
+335 649
+335 660
+335 661
+335 679
+335 695
+335 753
+335 769
+335 808
+335 850
+335 865
+335 896
+335 944
+335 960
+335 965
+335 966
+335 986
+336 0
+336 54
+336 80
+336 126
+336 133
+336 140
+336 152
+336 182
+336 202
+336 205
+336 206
+336 213
+336 235
+336 236
+336 244
+336 253
+336 273
+336 277
+336 282
+336 326
+336 347
+336 354
+336 377
+336 397
+336 403
+336 411
+336 466
+336 504
+336 505
+336 609
+336 639
+336 646
+336 672
+336 779
+336 840
+336 901
+336 914
+336 922
+336 944
+336 991
+336 997
+337 15
+337 65
+337 73
+337 109
+337 142
+337 174
+337 221
+337 263
+337 281
+337 366
+337 412
+337 415
+337 431
+337 493
+337 545
+337 570
+337 578
+337 608
+337 655
+337 852
+337 918
+337 1002
+338 28
+338 105
+338 117
+338 150
+338 159
+338 285
+338 291
+338 293
+338 304
+338 322
+338 356
+338 374
+338 399
+338 453
+338 464
+338 486
+338 499
+338 611
+338 681
+338 697
+338 724
+338 732
+338 733
+338 769
+338 784
+338 788
+338 793
+338 816
+338 835
+338 923
+338 944
+338 954
+338 989
+339 45
+339 68
+339 92
+339 157
+339 196
+339 200
+339 277
+339 372
+339 391
+339 405
+339 456
+339 459
+339 467
+339 525
+339 574
+339 598
+339 619
+339 631
+339 640
+339 678
+339 706
+339 741
+339 790
+339 813
+339 826
+339 834
+339 842
+339 982
+339 984
+339 1014
+340 76
+340 138
+340 141
+340 184
+340 201
+340 258
+340 315
+340 331
+340 357
+340 362
+340 369
+340 382
+340 430
+340 438
+340 440
+340 564
+340 582
+340 583
+340 616
+340 653
+340 660
+340 664
+340 684
+340 705
+340 727
+340 794
+340 811
+340 835
+340 928
+340 939
+340 943
+340 979
+341 12
+341 94
+341 113
+341 131
+341 176
+341 200
+341 211
+341 267
+341 269
+341 302
+341 303
+341 353
+341 361
+341 427
+341 449
+341 463
+341 474
+341 499
+341 510
+341 566
+341 570
+341 686
+341 689
+341 702
+341 790
+341 795
+341 804
+341 902
+341 945
+341 966
+342 13
+342 19
+342 20
+342 115
+342 159
+342 185
+342 228
+342 286
+342 328
+342 370
+342 378
+342 383
+342 427
+342 479
+342 562
+342 564
+342 602
+342 604
+342 626
+342 644
+342 647
+342 650
+342 651
+342 672
+342 719
+342 721
+342 732
+342 761
+342 860
+342 962
+342 963
+342 976
+343 16
+343 34
+343 45
+343 64
+343 97
+343 110
+343 112
+343 145
+343 175
+343 202
+343 260
+343 267
+343 281
+343 364
+343 635
+343 649
+343 655
+343 690
+343 703
+343 724
+343 755
+343 775
+343 831
+343 841
+343 865
+343 869
+343 871
+343 872
+343 879
+343 890
+343 901
+343 917
+344 27
+344 46
+344 137
+344 181
+344 189
+344 216
+344 251
+344 281
+344 288
+344 293
+344 309
+344 317
+344 334
+344 370
+344 373
+344 400
+344 412
+344 427
+344 511
+344 521
+344 583
+344 608
+344 654
+344 711
+344 748
+344 760
+344 767
+344 825
+344 849
+344 878
+344 885
+344 898
+344 920
+345 10
+345 81
+345 110
+345 117
+345 139
+345 180
+345 247
+345 396
+345 407
+345 452
+345 468
+345 548
+345 555
+345 559
+345 577
+345 601
+345 661
+345 678
+345 724
+345 776
+345 788
+345 827
+345 834
+345 859
+345 860
+345 934
+345 936
+345 955
+345 980
+345 987
+345 995
+346 6
+346 16
+346 42
+346 57
+346 101
+346 159
+346 242
+346 251
+346 324
+346 384
+346 464
+346 492
+346 497
+346 517
+346 522
+346 551
+346 556
+346 579
+346 583
+346 640
+346 642
+346 653
+346 665
+346 686
+346 762
+346 876
+346 898
+346 938
+347 35
+347 65
+347 94
+347 97
+347 129
+347 143
+347 184
+347 199
+347 220
+347 222
+347 250
+347 336
+347 405
+347 531
+347 579
+347 583
+347 594
+347 605
+347 620
+347 634
+347 635
+347 643
+347 654
+347 684
+347 698
+347 701
+347 720
+347 814
+347 828
+347 875
+347 936
+347 950
+347 1013
+348 49
+348 52
+348 53
+348 100
+348 125
+348 230
+348 239
+348 258
+348 259
+348 388
+348 450
+348 471
+348 539
+348 549
+348 568
+348 574
+348 626
+348 681
+348 774
+348 825
+348 957
+348 1007
+349 30
+349 36
+349 49
+349 79
+349 91
+349 119
+349 123
+349 129
+349 138
+349 172
+349 188
+349 195
+349 196
+349 202
+349 214
+349 217
+349 232
+349 253
+349 271
+349 276
+349 290
+349 308
+349 377
+349 457
+349 480
+349 494
+349 504
+349 506
+349 543
+349 574
+349 646
+349 658
+349 693
+349 792
+349 796
+349 891
+349 911
+349 991
+350 2
+350 80
+350 85
+350 108
+350 118
+350 146
+350 187
+350 219
+350 304
+350 373
+350 403
+350 405
+350 413
+350 419
+350 435
+350 475
+350 476
+350 509
+350 566
+350 610
+350 628
+350 646
+350 683
+350 752
+350 814
+350 819
+350 859
+350 864
+350 868
+350 875
+350 991
+351 10
+351 38
+351 52
+351 76
+351 80
+351 102
+351 156
+351 205
+351 211
+351 213
+351 216
+351 246
+351 253
+351 272
+351 299
+351 302
+351 313
+351 331
+351 410
+351 450
+351 520
+351 536
+351 537
+351 599
+351 608
+351 638
+351 655
+351 664
+351 667
+351 693
+351 749
+351 803
+351 833
+351 848
+351 860
+351 864
+351 874
+351 935
+351 992
+351 1017
+351 1020
+351 1021
+352 19
+352 27
+352 104
+352 111
+352 125
+352 135
+352 152
+352 166
+352 191
+352 246
+352 335
+352 359
+352 378
+352 382
+352 414
+352 418
+352 449
+352 458
+352 459
+352 482
+352 499
+352 509
+352 522
+352 537
+352 623
+352 631
+352 639
+352 672
+352 676
+352 686
+352 693
+352 721
+352 859
+352 879
+352 935
+352 967
+352 981
+352 984
+352 992
+353 13
+353 24
+353 91
+353 111
+353 129
+353 130
+353 245
+353 248
+353 289
+353 341
+353 375
+353 554
+353 568
+353 585
+353 595
+353 616
+353 639
+353 644
+353 691
+353 695
+353 736
+353 761
+353 790
+353 804
+353 874
+353 879
+353 909
+353 913
+353 953
+353 984
+353 991
+353 1011
+353 1016
+354 29
+354 91
+354 115
+354 153
+354 199
+354 250
+354 251
+354 333
+354 336
+354 429
+354 451
+354 452
+354 465
+354 506
+354 523
+354 673
+354 698
+354 708
+354 722
+354 729
+354 784
+354 840
+354 859
+354 905
+355 12
+355 17
+355 50
+355 74
+355 75
+355 150
+355 159
+355 174
+355 203
+355 248
+355 361
+355 412
+355 423
+355 495
+355 505
+355 554
+355 565
+355 593
+355 610
+355 624
+355 644
+355 682
+355 686
+355 702
+355 709
+355 753
+355 806
+355 827
+355 859
+355 870
+355 952
+355 984
+355 990
+355 1000
+356 86
+356 108
+356 131
+356 278
+356 299
+356 338
+356 364
+356 402
+356 474
+356 490
+356 497
+356 567
+356 571
+356 616
+356 628
+356 681
+356 721
+356 779
+356 793
+356 827
+356 854
+356 867
+356 869
+356 1013
+357 4
+357 57
+357 141
+357 193
+357 213
+357 251
+357 286
+357 291
+357 298
+357 340
+357 372
+357 418
+357 428
+357 459
+357 503
+357 539
+357 551
+357 574
+357 583
+357 619
+357 641
+357 653
+357 671
+357 685
+357 704
+357 734
+357 763
+357 778
+357 851
+357 908
+357 946
+357 1013
+358 14
+358 107
+358 129
+358 166
+358 197
+358 253
+358 285
+358 289
+358 335
+358 378
+358 449
+358 464
+358 469
+358 477
+358 479
+358 493
+358 494
+358 509
+358 548
+358 555
+358 588
+358 596
+358 604
+358 612
+358 651
+358 691
+358 705
+358 798
+358 846
+358 871
+358 958
+358 963
+358 1014
+359 71
+359 145
+359 231
+359 352
+359 381
+359 383
+359 478
+359 479
+359 494
+359 497
+359 506
+359 592
+359 602
+359 678
+359 707
+359 719
+359 740
+359 763
+359 875
+359 881
+359 913
+359 990
+360 145
+360 173
+360 196
+360 227
+360 230
+360 298
+360 316
+360 374
+360 407
+360 433
+360 546
+360 613
+360 629
+360 704
+360 733
+360 775
+360 832
+360 842
+360 855
+360 863
+360 911
+360 1004
+360 1023
+361 34
+361 37
+361 41
+361 63
+361 112
+361 143
+361 209
+361 291
+361 301
+361 302
+361 314
+361 341
+361 355
+361 397
+361 407
+361 409
+361 457
+361 468
+361 480
+361 483
+361 516
+361 539
+361 578
+361 598
+361 640
+361 720
+361 822
+361 852
+361 934
+361 986
+361 1013
+362 144
+362 251
+362 268
+362 274
+362 340
+362 380
+362 384
+362 406
+362 479
+362 509
+362 535
+362 563
+362 580
+362 593
+362 699
+362 721
+362 764
+362 852
+362 870
+362 903
+362 931
+362 962
+362 972
+363 106
+363 156
+363 171
+363 174
+363 241
+363 250
+363 311
+363 414
+363 424
+363 451
+363 465
+363 504
+363 606
+363 623
+363 629
+363 652
+363 664
+363 671
+363 673
+363 700
+363 764
+363 940
+363 973
+363 997
+363 998
+363 1006
+364 19
+364 34
+364 40
+364 50
+364 99
+364 167
+364 213
+364 232
+364 233
+364 243
+364 262
+364 280
+364 324
+364 343
+364 356
+364 378
+364 440
+364 495
+364 500
+364 520
+364 550
+364 588
+364 596
+364 602
+364 608
+364 742
+364 759
+364 774
+364 797
+364 803
+364 809
+364 905
+364 966
+364 972
+364 988
+365 4
+365 68
+365 94
+365 129
+365 150
+365 217
+365 223
+365 236
+365 240
+365 247
+365 263
+365 398
+365 476
+365 484
+365 556
+365 557
+365 568
+365 574
+365 644
+365 670
+365 789
+365 829
+365 858
+365 880
+365 918
+365 944
+365 951
+365 955
+366 3
+366 75
+366 85
+366 94
+366 102
+366 172
+366 197
+366 204
+366 213
+366 254
+366 258
+366 264
+366 294
+366 296
+366 337
+366 379
+366 436
+366 483
+366 517
+366 526
+366 536
+366 561
+366 602
+366 613
+366 653
+366 715
+366 755
+366 797
+366 873
+366 893
+366 946
+366 954
+366 975
+366 1013
+367 62
+367 80
+367 175
+367 178
+367 192
+367 195
+367 317
+367 321
+367 444
+367 457
+367 485
+367 545
+367 556
+367 775
+367 805
+367 871
+367 914
+367 940
+367 949
+368 70
+368 107
+368 147
+368 160
+368 259
+368 265
+368 329
+368 383
+368 386
+368 402
+368 422
+368 472
+368 531
+368 552
+368 560
+368 566
+368 594
+368 628
+368 641
+368 650
+368 662
+368 678
+368 679
+368 757
+368 763
+368 780
+368 798
+368 825
+368 828
+368 865
+368 892
+368 900
+368 905
+368 949
+368 1022
+369 13
+369 18
+369 23
+369 72
+369 86
+369 105
+369 118
+369 133
+369 218
+369 223
+369 261
+369 285
+369 298
+369 305
+369 340
+369 380
+369 397
+369 409
+369 511
+369 539
+369 544
+369 629
+369 640
+369 642
+369 644
+369 669
+369 713
+369 723
+369 726
+369 747
+369 749
+369 767
+369 774
+369 826
+369 915
+369 955
+369 985
+369 1018
+369 1019
+370 9
+370 30
+370 43
+370 53
+370 99
+370 133
+370 144
+370 161
+370 166
+370 234
+370 245
+370 263
+370 272
+370 278
+370 304
+370 342
+370 344
+370 372
+370 375
+370 444
+370 446
+370 447
+370 470
+370 579
+370 601
+370 613
+370 638
+370 663
+370 716
+370 744
+370 793
+370 808
+370 879
+370 897
+370 911
+370 924
+370 928
+370 969
+370 977
+371 36
+371 79
+371 114
+371 140
+371 178
+371 180
+371 297
+371 315
+371 413
+371 470
+371 563
+371 584
+371 627
+371 637
+371 647
+371 656
+371 662
+371 722
+371 739
+371 943
+371 977
+371 983
+371 985
+372 83
+372 101
+372 230
+372 242
+372 259
+372 276
+372 307
+372 339
+372 357
+372 370
+372 399
+372 502
+372 614
+372 626
+372 693
+372 696
+372 732
+372 751
+372 753
+372 800
+372 806
+372 885
+372 895
+372 900
+372 901
+372 902
+372 920
+372 972
+373 98
+373 132
+373 209
+373 217
+373 266
+373 333
+373 344
+373 350
+373 374
+373 409
+373 416
+373 513
+373 523
+373 528
+373 529
+373 585
+373 589
+373 594
+373 647
+373 654
+373 657
+373 671
+373 700
+373 753
+373 757
+373 764
+373 790
+373 843
+373 846
+373 871
+373 891
+373 907
+373 929
+373 979
+374 35
+374 71
+374 197
+374 215
+374 292
+374 293
+374 296
+374 300
+374 314
+374 334
+374 338
+374 360
+374 373
+374 486
+374 497
+374 544
+374 593
+374 650
+374 772
+374 842
+374 844
+374 851
+374 884
+374 912
+374 935
+374 986
+375 18
+375 157
+375 158
+375 172
+375 202
+375 224
+375 282
+375 297
+375 310
+375 353
+375 370
+375 438
+375 479
+375 485
+375 528
+375 542
+375 544
+375 545
+375 558
+375 571
+375 588
+375 612
+375 633
+375 635
+375 677
+375 724
+375 733
+375 737
+375 741
+375 805
+375 811
+375 976
+376 7
+376 14
+376 23
+376 80
+376 164
+376 171
+376 239
+376 250
+376 278
+376 285
+376 319
+376 379
+376 383
+376 441
+376 546
+376 556
+376 657
+376 676
+376 692
+376 731
+376 742
+376 769
+376 810
+376 908
+376 909
+376 914
+376 925
+376 947
+376 975
+377 31
+377 100
+377 106
+377 115
+377 157
+377 184
+377 207
+377 263
+377 336
+377 349
+377 473
+377 495
+377 570
+377 613
+377 654
+377 664
+377 683
+377 696
+377 712
+377 770
+377 800
+377 821
+377 840
+377 848
+377 921
+377 937
+377 952
+377 985
+377 990
+377 992
+377 995
+377 998
+377 1005
+378 31
+378 60
+378 84
+378 101
+378 121
+378 124
+378 131
+378 215
+378 227
+378 259
+378 293
+378 297
+378 319
+378 335
+378 342
+378 352
+378 358
+378 364
+378 389
+378 434
+378 453
+378 618
+378 620
+378 656
+378 673
+378 709
+378 719
+378 721
+378 756
+378 778
+378 782
+378 820
+378 829
+378 913
+378 921
+378 979
+379 114
+379 191
+379 222
+379 248
+379 258
+379 259
+379 329
+379 366
+379 376
+379 537
+379 554
+379 555
+379 560
+379 603
+379 621
+379 643
+379 656
+379 710
+379 730
+379 745
+379 767
+379 800
+379 804
+379 805
+379 838
+379 866
+379 879
+379 882
+379 902
+379 909
+379 957
+379 1003
+380 4
+380 26
+380 43
+380 47
+380 149
+380 169
+380 200
+380 215
+380 299
+380 362
+380 369
+380 390
+380 450
+380 460
+380 534
+380 568
+380 647
+380 663
+380 668
+380 671
+380 684
+380 870
+380 881
+380 888
+380 980
+380 1011
+381 171
+381 185
+381 193
+381 204
+381 214
+381 240
+381 260
+381 293
+381 310
+381 319
+381 359
+381 386
+381 433
+381 435
+381 557
+381 594
+381 640
+381 729
+381 742
+381 793
+381 796
+381 803
+381 804
+381 826
+381 861
+381 901
+381 937
+381 940
+382 16
+382 32
+382 64
+382 116
+382 150
+382 197
+382 213
+382 242
+382 253
+382 271
+382 274
+382 340
+382 352
+382 390
+382 393
+382 425
+382 429
+382 537
+382 548
+382 573
+382 631
+382 645
+382 713
+382 749
+382 772
+382 870
+382 878
+382 884
+382 890
+382 942
+382 948
+382 964
+382 1016
+383 37
+383 158
+383 171
+383 194
+383 216
+383 298
+383 320
+383 342
+383 359
+383 368
+383 376
+383 384
+383 403
+383 415
+383 435
+383 439
+383 507
+383 556
+383 573
+383 583
+383 640
+383 653
+383 732
+383 755
+383 789
+383 794
+383 823
+383 831
+383 841
+383 852
+383 853
+383 858
+383 864
+383 884
+383 885
+383 898
+383 941
+383 953
+383 982
+384 1
+384 2
+384 7
+384 59
+384 94
+384 106
+384 157
+384 196
+384 235
+384 274
+384 346
+384 362
+384 383
+384 427
+384 448
+384 449
+384 459
+384 502
+384 536
+384 698
+384 712
+384 713
+384 717
+384 724
+384 765
+384 815
+384 827
+384 845
+384 857
+384 869
+384 919
+384 968
+384 970
+384 1020
+385 20
+385 22
+385 101
+385 106
+385 114
+385 161
+385 180
+385 265
+385 312
+385 324
+385 390
+385 408
+385 434
+385 454
+385 478
+385 493
+385 500
+385 546
+385 547
+385 561
+385 589
+385 593
+385 691
+385 766
+385 768
+385 790
+385 807
+385 810
+385 817
+385 867
+385 874
+385 895
+385 1017
+386 0
+386 32
+386 38
+386 43
+386 88
+386 106
+386 204
+386 229
+386 235
+386 254
+386 275
+386 281
+386 328
+386 368
+386 381
+386 424
+386 481
+386 543
+386 552
+386 555
+386 566
+386 580
+386 612
+386 661
+386 670
+386 678
+386 708
+386 732
+386 777
+386 784
+386 807
+386 808
+386 891
+386 927
+387 40
+387 142
+387 160
+387 209
+387 221
+387 243
+387 252
+387 257
+387 273
+387 283
+387 287
+387 320
+387 398
+387 422
+387 540
+387 568
+387 598
+387 616
+387 643
+387 670
+387 704
+387 771
+387 772
+387 825
+387 889
+387 948
+387 963
+387 1010
+388 47
+388 64
+388 69
+388 101
+388 138
+388 218
+388 251
+388 264
+388 311
+388 314
+388 317
+388 348
+388 400
+388 423
+388 460
+388 500
+388 536
+388 547
+388 575
+388 704
+388 734
+388 751
+388 753
+388 755
+388 767
+388 774
+388 824
+388 857
+388 870
+388 919
+388 940
+388 977
+388 1005
+388 1006
+388 1012
+389 11
+389 19
+389 45
+389 63
+389 65
+389 84
+389 98
+389 140
+389 141
+389 186
+389 211
+389 307
+389 321
+389 324
+389 378
+389 434
+389 449
+389 513
+389 556
+389 603
+389 610
+389 631
+389 693
+389 847
+389 869
+389 929
+389 960
+389 976
+389 993
+389 998
+390 9
+390 62
+390 63
+390 80
+390 110
+390 164
+390 205
+390 278
+390 288
+390 320
+390 380
+390 382
+390 385
+390 407
+390 412
+390 532
+390 555
+390 562
+390 567
+390 626
+390 641
+390 678
+390 718
+390 730
+390 731
+390 749
+390 769
+390 785
+390 824
+390 888
+390 894
+390 899
+390 902
+390 911
+390 926
+390 929
+390 959
+390 982
+390 989
+390 1015
+390 1020
+390 1021
+391 51
+391 83
+391 96
+391 171
+391 223
+391 238
+391 242
+391 339
+391 472
+391 473
+391 516
+391 591
+391 615
+391 621
+391 675
+391 734
+391 766
+391 800
+391 876
+391 947
+391 977
+391 1021
+392 24
+392 60
+392 135
+392 147
+392 188
+392 189
+392 195
+392 234
+392 266
+392 311
+392 325
+392 400
+392 419
+392 424
+392 444
+392 473
+392 516
+392 551
+392 567
+392 571
+392 611
+392 625
+392 712
+392 718
+392 731
+392 737
+392 757
+392 796
+392 881
+392 925
+392 947
+393 10
+393 111
+393 195
+393 196
+393 290
+393 382
+393 397
+393 501
+393 537
+393 557
+393 590
+393 594
+393 624
+393 644
+393 709
+393 786
+393 807
+393 828
+393 857
+393 908
+393 937
+393 1014
+394 4
+394 23
+394 36
+394 38
+394 77
+394 142
+394 163
+394 213
+394 215
+394 241
+394 279
+394 290
+394 299
+394 396
+394 428
+394 462
+394 551
+394 575
+394 627
+394 790
+394 815
+394 840
+394 877
+394 882
+394 890
+394 910
+395 101
+395 156
+395 157
+395 192
+395 193
+395 219
+395 262
+395 275
+395 289
+395 290
+395 296
+395 324
+395 325
+395 480
+395 541
+395 553
+395 655
+395 663
+395 772
+395 774
+395 812
+395 814
+395 853
+395 864
+395 874
+395 908
+395 915
+395 937
+395 959
+395 1022
+396 47
+396 79
+396 145
+396 153
+396 198
+396 225
+396 230
+396 232
+396 251
+396 345
+396 394
+396 402
+396 429
+396 432
+396 459
+396 625
+396 646
+396 648
+396 689
+396 796
+396 829
+396 871
+396 882
+396 907
+396 918
+396 946
+396 947
+396 1023
+397 10
+397 25
+397 33
+397 115
+397 189
+397 196
+397 336
+397 361
+397 369
+397 393
+397 419
+397 447
+397 559
+397 564
+397 576
+397 592
+397 602
+397 641
+397 718
+397 741
+397 859
+397 886
+397 893
+397 920
+397 931
+397 955
+397 987
+398 23
+398 71
+398 77
+398 177
+398 207
+398 215
+398 224
+398 229
+398 316
+398 365
+398 387
+398 409
+398 442
+398 491
+398 505
+398 515
+398 550
+398 558
+398 652
+398 662
+398 776
+398 818
+398 820
+398 905
+398 912
+398 932
+398 947
+398 954
+398 975
+398 1012
+399 31
+399 49
+399 65
+399 82
+399 119
+399 198
+399 240
+399 244
+399 262
+399 264
+399 276
+399 309
+399 317
+399 330
+399 335
+399 338
+399 372
+399 434
+399 545
+399 547
+399 575
+399 605
+399 626
+399 684
+399 728
+399 743
+399 755
+399 797
+399 813
+399 820
+399 878
+399 880
+399 994
+399 1004
+399 1023
+400 62
+400 107
+400 112
+400 139
+400 143
+400 155
+400 172
+400 251
+400 284
+400 319
+400 344
+400 388
+400 392
+400 403
+400 411
+400 427
+400 452
+400 485
+400 523
+400 606
+400 613
+400 680
+400 690
+400 693
+400 733
+400 735
+400 801
+400 824
+400 863
+400 889
+400 938
+400 985
+401 3
+401 17
+401 74
+401 105
+401 141
+401 143
+401 273
+401 295
+401 334
+401 428
+401 474
+401 533
+401 541
+401 631
+401 670
+401 693
+401 701
+401 742
+401 761
+401 809
+401 813
+401 814
+401 840
+401 881
+401 919
+401 984
+402 15
+402 22
+402 32
+402 54
+402 61
+402 70
+402 190
+402 201
+402 247
+402 277
+402 285
+402 288
+402 298
+402 356
+402 368
+402 396
+402 496
+402 505
+402 584
+402 607
+402 663
+402 677
+402 753
+402 763
+402 774
+402 823
+402 845
+402 846
+402 901
+402 914
+402 947
+402 1001
+402 1008
+402 1015
+402 1019
+403 18
+403 21
+403 23
+403 237
+403 253
+403 287
+403 304
+403 305
+403 308
+403 317
+403 330
+403 336
+403 350
+403 383
+403 400
+403 459
+403 461
+403 473
+403 474
+403 480
+403 485
+403 488
+403 491
+403 499
+403 513
+403 520
+403 528
+403 562
+403 581
+403 592
+403 642
+403 697
+403 748
+403 759
+403 778
+403 792
+403 881
+403 907
+403 920
+403 922
+403 932
+403 964
+404 25
+404 32
+404 49
+404 115
+404 148
+404 154
+404 160
+404 191
+404 202
+404 206
+404 253
+404 411
+404 447
+404 493
+404 494
+404 525
+404 529
+404 623
+404 639
+404 652
+404 720
+404 787
+404 879
+404 911
+405 0
+405 9
+405 42
+405 56
+405 92
+405 127
+405 145
+405 162
+405 177
+405 215
+405 258
+405 263
+405 267
+405 339
+405 347
+405 350
+405 434
+405 442
+405 462
+405 521
+405 536
+405 564
+405 619
+405 625
+405 673
+405 687
+405 706
+405 724
+405 792
+405 835
+405 854
+405 857
+405 886
+405 923
+405 974
+405 1005
+405 1020
+406 20
+406 93
+406 143
+406 191
+406 212
+406 213
+406 215
+406 225
+406 294
+406 326
+406 362
+406 463
+406 545
+406 677
+406 709
+406 739
+406 742
+406 763
+406 767
+406 807
+406 835
+406 841
+406 866
+406 970
+406 1001
+407 120
+407 122
+407 132
+407 194
+407 293
+407 308
+407 327
+407 331
+407 333
+407 345
+407 360
+407 361
+407 390
+407 425
+407 430
+407 443
+407 474
+407 479
+407 527
+407 593
+407 609
+407 654
+407 670
+407 674
+407 713
+407 746
+407 803
+407 811
+407 826
+407 865
+407 909
+407 910
+407 915
+407 929
+407 976
+407 982
+407 1006
+408 12
+408 14
+408 29
+408 57
+408 65
+408 146
+408 164
+408 199
+408 258
+408 266
+408 385
+408 443
+408 444
+408 466
+408 470
+408 479
+408 529
+408 537
+408 557
+408 583
+408 592
+408 593
+408 601
+408 611
+408 640
+408 656
+408 689
+408 699
+408 759
+408 780
+408 790
+408 802
+408 824
+408 834
+408 987
+409 22
+409 61
+409 140
+409 148
+409 188
+409 194
+409 207
+409 210
+409 266
+409 273
+409 361
+409 369
+409 373
+409 398
+409 417
+409 494
+409 496
+409 712
+409 775
+409 779
+409 790
+409 811
+409 842
+409 882
+409 893
+409 901
+409 924
+410 47
+410 54
+410 79
+410 124
+410 166
+410 197
+410 220
+410 255
+410 258
+410 279
+410 351
+410 431
+410 478
+410 480
+410 501
+410 527
+410 542
+410 547
+410 575
+410 650
+410 770
+410 807
+410 944
+410 952
+410 958
+410 995
+410 1010
+411 4
+411 165
+411 170
+411 282
+411 336
+411 400
+411 404
+411 419
+411 511
+411 584
+411 630
+411 643
+411 700
+411 712
+411 753
+411 764
+411 801
+411 830
+411 857
+411 878
+411 879
+411 908
+411 972
+411 1017
+412 47
+412 49
+412 54
+412 58
+412 81
+412 90
+412 156
+412 160
+412 174
+412 271
+412 337
+412 344
+412 355
+412 390
+412 452
+412 481
+412 536
+412 562
+412 586
+412 594
+412 625
+412 642
+412 657
+412 677
+412 701
+412 709
+412 722
+412 772
+412 778
+412 861
+412 921
+412 944
+412 947
+412 998
+413 39
+413 166
+413 175
+413 183
+413 235
+413 311
+413 350
+413 371
+413 420
+413 440
+413 481
+413 487
+413 524
+413 573
+413 574
+413 604
+413 638
+413 644
+413 647
+413 649
+413 651
+413 701
+413 724
+413 760
+413 783
+413 819
+413 873
+413 934
+413 937
+413 938
+413 958
+413 994
+413 1019
+413 1023
+414 9
+414 16
+414 24
+414 59
+414 60
+414 71
+414 107
+414 112
+414 127
+414 129
+414 140
+414 226
+414 251
+414 352
+414 363
+414 465
+414 491
+414 506
+414 521
+414 658
+414 663
+414 670
+414 687
+414 719
+414 735
+414 738
+414 763
+414 780
+414 792
+414 805
+414 840
+414 886
+414 896
+414 904
+414 914
+414 925
+414 928
+414 985
+415 84
+415 98
+415 132
+415 167
+415 175
+415 180
+415 205
+415 222
+415 286
+415 312
+415 318
+415 337
+415 383
+415 450
+415 455
+415 481
+415 561
+415 598
+415 628
+415 662
+415 663
+415 681
+415 720
+415 737
+415 775
+415 831
+415 834
+415 842
+415 860
+415 904
+416 41
+416 60
+416 138
+416 179
+416 185
+416 198
+416 223
+416 280
+416 373
+416 432
+416 435
+416 475
+416 479
+416 483
+416 494
+416 576
+416 601
+416 627
+416 666
+416 687
+416 780
+416 813
+416 815
+416 863
+416 880
+416 889
+416 915
+416 927
+416 942
+416 991
+416 1008
+416 1023
+417 81
+417 102
+417 128
+417 144
+417 160
+417 194
+417 215
+417 252
+417 265
+417 268
+417 283
+417 313
+417 318
+417 409
+417 445
+417 476
+417 584
+417 657
+417 677
+417 724
+417 741
+417 744
+417 801
+417 869
+417 932
+417 955
+417 972
+417 1007
+418 44
+418 56
+418 124
+418 138
+418 153
+418 191
+418 223
+418 226
+418 287
+418 295
+418 322
+418 352
+418 357
+418 426
+418 437
+418 475
+418 548
+418 620
+418 626
+418 651
+418 678
+418 679
+418 705
+418 724
+418 735
+418 742
+418 781
+418 798
+418 806
+418 839
+418 859
+418 867
+418 932
+418 951
+419 20
+419 35
+419 65
+419 80
+419 119
+419 178
+419 180
+419 225
+419 230
+419 233
+419 235
+419 255
+419 316
+419 350
+419 392
+419 397
+419 411
+419 425
+419 510
+419 595
+419 615
+419 633
+419 663
+419 692
+419 751
+419 754
+419 793
+419 836
+419 858
+419 873
+419 874
+419 901
+419 937
+419 948
+419 960
+419 967
+419 976
+420 20
+420 39
+420 64
+420 66
+420 147
+420 159
+420 172
+420 234
+420 413
+420 473
+420 494
+420 514
+420 540
+420 565
+420 596
+420 640
+420 641
+420 653
+420 692
+420 701
+420 758
+420 833
+420 890
+420 915
+420 930
+420 936
+420 954
+420 961
+420 1000
+420 1012
+420 1015
+421 6
+421 18
+421 73
+421 82
+421 115
+421 121
+421 184
+421 199
+421 252
+421 256
+421 260
+421 271
+421 296
+421 433
+421 488
+421 517
+421 542
+421 559
+421 580
+421 584
+421 600
+421 663
+421 721
+421 808
+421 836
+421 850
+421 866
+421 905
+421 912
+421 987
+422 6
+422 45
+422 68
+422 108
+422 121
+422 126
+422 138
+422 213
+422 269
+422 276
+422 280
+422 368
+422 387
+422 479
+422 526
+422 582
+422 588
+422 593
+422 613
+422 632
+422 646
+422 670
+422 675
+422 704
+422 712
+422 735
+422 745
+422 771
+422 777
+422 959
+423 38
+423 67
+423 73
+423 100
+423 117
+423 141
+423 151
+423 192
+423 193
+423 210
+423 241
+423 286
+423 355
+423 388
+423 452
+423 466
+423 496
+423 498
+423 530
+423 544
+423 592
+423 661
+423 689
+423 730
+423 734
+423 740
+423 787
+423 794
+423 796
+423 899
+423 985
+424 55
+424 62
+424 107
+424 111
+424 121
+424 123
+424 174
+424 204
+424 246
+424 267
+424 307
+424 363
+424 386
+424 392
+424 440
+424 525
+424 530
+424 550
+424 558
+424 571
+424 578
+424 681
+424 685
+424 689
+424 728
+424 779
+424 800
+424 866
+424 891
+424 902
+424 917
+424 918
+424 956
+424 963
+424 974
+424 1009
+425 2
+425 15
+425 59
+425 63
+425 77
+425 89
+425 225
+425 330
+425 382
+425 407
+425 419
+425 437
+425 446
+425 478
+425 525
+425 526
+425 633
+425 650
+425 745
+425 764
+425 803
+425 807
+425 817
+425 833
+425 848
+425 875
+425 898
+425 922
+425 943
+425 946
+425 947
+425 954
+425 1022
+426 69
+426 137
+426 175
+426 206
+426 218
+426 228
+426 268
+426 275
+426 276
+426 291
+426 418
+426 432
+426 444
+426 501
+426 506
+426 507
+426 586
+426 603
+426 612
+426 650
+426 660
+426 686
+426 752
+426 792
+426 808
+426 885
+426 907
+426 928
+426 959
+426 973
+427 19
+427 25
+427 30
+427 43
+427 70
+427 133
+427 135
+427 223
+427 229
+427 230
+427 341
+427 342
+427 344
+427 384
+427 400
+427 435
+427 457
+427 475
+427 507
+427 511
+427 573
+427 638
+427 684
+427 686
+427 696
+427 711
+427 775
+427 814
+427 881
+427 964
+427 986
+427 1002
+428 2
+428 16
+428 48
+428 62
+428 83
+428 85
+428 96
+428 98
+428 170
+428 171
+428 243
+428 265
+428 304
+428 331
+428 357
+428 394
+428 401
+428 445
+428 466
+428 488
+428 508
+428 518
+428 539
+428 566
+428 662
+428 728
+428 736
+428 788
+428 899
+428 907
+428 936
+428 975
+428 984
+428 997
+429 25
+429 39
+429 148
+429 202
+429 321
+429 354
+429 382
+429 396
+429 448
+429 479
+429 485
+429 493
+429 528
+429 530
+429 548
+429 564
+429 588
+429 636
+429 656
+429 741
+429 807
+429 812
+429 829
+429 884
+429 901
+429 938
+429 957
+429 989
+430 60
+430 78
+430 135
+430 182
+430 233
+430 305
+430 340
+430 407
+430 449
+430 450
+430 460
+430 493
+430 542
+430 560
+430 600
+430 603
+430 610
+430 687
+430 707
+430 744
+430 755
+430 783
+430 811
+430 837
+430 858
+430 887
+430 895
+430 896
+430 906
+430 956
+430 973
+430 1017
+431 15
+431 109
+431 121
+431 122
+431 162
+431 172
+431 176
+431 247
+431 262
+431 310
+431 337
+431 410
+431 451
+431 455
+431 471
+431 502
+431 546
+431 608
+431 613
+431 630
+431 640
+431 655
+431 670
+431 724
+431 876
+431 900
+431 908
+431 927
+432 3
+432 10
+432 61
+432 64
+432 68
+432 138
+432 162
+432 185
+432 224
+432 269
+432 272
+432 282
+432 332
+432 396
+432 416
+432 426
+432 434
+432 495
+432 544
+432 547
+432 562
+432 566
+432 585
+432 609
+432 620
+432 650
+432 682
+432 693
+432 725
+432 760
+432 790
+432 791
+432 816
+432 830
+432 873
+432 874
+432 906
+432 908
+432 982
+432 996
+433 1
+433 44
+433 97
+433 162
+433 233
+433 256
+433 315
+433 360
+433 381
+433 421
+433 464
+433 499
+433 502
+433 507
+433 698
+433 707
+433 711
+433 727
+433 728
+433 730
+433 850
+433 856
+433 866
+433 900
+433 916
+433 953
+433 974
+433 975
+433 1020
+434 6
+434 17
+434 24
+434 37
+434 89
+434 121
+434 149
+434 171
+434 232
+434 265
+434 280
+434 293
+434 313
+434 378
+434 385
+434 389
+434 399
+434 405
+434 432
+434 448
+434 461
+434 498
+434 502
+434 512
+434 553
+434 556
+434 564
+434 580
+434 583
+434 607
+434 703
+434 721
+434 855
+434 861
+434 879
+434 914
+434 958
+435 12
+435 56
+435 99
+435 112
+435 141
+435 144
+435 201
+435 205
+435 222
+435 232
+435 237
+435 241
+435 251
+435 287
+435 311
+435 313
+435 333
+435 350
+435 381
+435 383
+435 416
+435 427
+435 443
+435 479
+435 500
+435 577
+435 589
+435 624
+435 689
+435 692
+435 838
+435 854
+435 866
+435 949
+435 952
+435 977
+435 1010
+436 79
+436 94
+436 96
+436 111
+436 177
+436 197
+436 247
+436 258
+436 307
+436 366
+436 457
+436 462
+436 468
+436 502
+436 636
+436 646
+436 694
+436 749
+436 764
+436 813
+436 823
+436 844
+436 861
+436 873
+436 889
+436 924
+436 993
+437 15
+437 69
+437 118
+437 166
+437 171
+437 255
+437 273
+437 274
+437 418
+437 425
+437 442
+437 465
+437 507
+437 551
+437 553
+437 604
+437 689
+437 724
+437 792
+437 795
+437 796
+437 841
+437 938
+437 951
+438 16
+438 55
+438 69
+438 70
+438 82
+438 89
+438 121
+438 143
+438 188
+438 220
+438 239
+438 270
+438 272
+438 277
+438 302
+438 340
+438 375
+438 459
+438 502
+438 572
+438 604
+438 630
+438 679
+438 686
+438 736
+438 742
+438 806
+438 807
+438 826
+438 866
+438 867
+438 874
+438 875
+438 889
+438 892
+438 893
+438 904
+438 969
+438 1011
+439 25
+439 34
+439 139
+439 150
+439 165
+439 172
+439 180
+439 228
+439 237
+439 264
+439 304
+439 383
+439 442
+439 649
+439 701
+439 739
+439 762
+439 764
+439 824
+439 875
+439 969
+439 1000
+439 1011
+439 1013
+440 52
+440 94
+440 115
+440 120
+440 144
+440 170
+440 175
+440 176
+440 241
+440 261
+440 296
+440 340
+440 364
+440 413
+440 424
+440 446
+440 474
+440 551
+440 553
+440 679
+440 705
+440 719
+440 722
+440 726
+440 727
+440 738
+440 740
+440 756
+440 819
+440 829
+440 855
+440 925
+440 933
+440 973
+440 975
+440 1005
+440 1020
+441 22
+441 86
+441 151
+441 153
+441 201
+441 232
+441 259
+441 279
+441 305
+441 307
+441 324
+441 376
+441 535
+441 666
+441 681
+441 686
+441 732
+441 822
+441 869
+441 892
+441 915
+441 921
+441 935
+441 1020
+442 91
+442 106
+442 118
+442 121
+442 162
+442 206
+442 209
+442 212
+442 287
+442 398
+442 405
+442 437
+442 439
+442 475
+442 489
+442 519
+442 557
+442 663
+442 677
+442 715
+442 721
+442 726
+442 729
+442 757
+442 778
+442 782
+442 885
+442 894
+442 931
+442 939
+442 946
+442 969
+442 981
+442 1015
+443 30
+443 89
+443 122
+443 139
+443 141
+443 152
+443 257
+443 270
+443 272
+443 274
+443 302
+443 407
+443 408
+443 435
+443 454
+443 473
+443 484
+443 486
+443 487
+443 518
+443 529
+443 543
+443 550
+443 579
+443 582
+443 663
+443 673
+443 701
+443 728
+443 756
+443 785
+443 835
+443 942
+443 965
+443 1003
+444 50
+444 109
+444 112
+444 209
+444 230
+444 235
+444 237
+444 293
+444 299
+444 328
+444 332
+444 367
+444 370
+444 392
+444 408
+444 426
+444 446
+444 481
+444 510
+444 531
+444 589
+444 656
+444 698
+444 712
+444 744
+444 777
+444 813
+444 841
+444 864
+444 891
+444 919
+444 949
+444 968
+444 993
+444 996
+444 997
+444 1018
+445 107
+445 162
+445 180
+445 199
+445 209
+445 211
+445 272
+445 281
+445 284
+445 417
+445 428
+445 512
+445 538
+445 646
+445 697
+445 699
+445 709
+445 777
+445 802
+445 847
+445 912
+445 917
+445 919
+445 956
+445 987
+446 55
+446 56
+446 83
+446 89
+446 122
+446 128
+446 225
+446 240
+446 269
+446 370
+446 425
+446 440
+446 444
+446 541
+446 544
+446 577
+446 605
+446 606
+446 612
+446 671
+446 693
+446 727
+446 783
+446 790
+446 850
+446 855
+446 864
+446 888
+446 895
+446 978
+446 1001
+446 1018
+447 10
+447 44
+447 197
+447 214
+447 228
+447 248
+447 256
+447 269
+447 273
+447 288
+447 290
+447 305
+447 307
+447 335
+447 370
+447 397
+447 404
+447 453
+447 484
+447 535
+447 627
+447 628
+447 668
+447 681
+447 706
+447 727
+447 789
+447 790
+447 811
+447 823
+447 847
+447 963
+447 1019
+448 19
+448 38
+448 98
+448 120
+448 139
+448 171
+448 173
+448 239
+448 247
+448 255
+448 304
+448 316
+448 321
+448 323
+448 384
+448 429
+448 434
+448 451
+448 509
+448 531
+448 557
+448 610
+448 661
+448 671
+448 689
+448 712
+448 733
+448 737
+448 762
+448 832
+448 835
+448 883
+448 968
+449 21
+449 75
+449 117
+449 129
+449 172
+449 341
+449 352
+449 358
+449 384
+449 389
+449 430
+449 477
+449 502
+449 511
+449 516
+449 557
+449 587
+449 689
+449 864
+449 924
+449 937
+449 1021
+450 3
+450 9
+450 92
+450 97
+450 167
+450 215
+450 348
+450 351
+450 380
+450 415
+450 430
+450 477
+450 497
+450 519
+450 543
+450 584
+450 589
+450 675
+450 716
+450 742
+450 765
+450 778
+450 793
+450 809
+450 817
+450 845
+450 846
+450 851
+450 852
+450 860
+450 869
+450 888
+451 10
+451 23
+451 34
+451 65
+451 78
+451 90
+451 102
+451 111
+451 121
+451 160
+451 196
+451 265
+451 354
+451 363
+451 431
+451 448
+451 462
+451 478
+451 487
+451 507
+451 538
+451 545
+451 556
+451 590
+451 594
+451 650
+451 707
+451 732
+451 764
+451 787
+451 802
+451 815
+451 826
+451 851
+451 939
+451 972
+451 993
+452 39
+452 88
+452 144
+452 158
+452 162
+452 164
+452 170
+452 179
+452 182
+452 200
+452 222
+452 229
+452 257
+452 328
+452 345
+452 354
+452 400
+452 412
+452 423
+452 488
+452 500
+452 580
+452 613
+452 620
+452 647
+452 697
+452 730
+452 738
+452 755
+452 927
+452 937
+452 982
+453 36
+453 55
+453 60
+453 150
+453 173
+453 175
+453 191
+453 192
+453 207
+453 217
+453 276
+453 338
+453 378
+453 447
+453 467
+453 477
+453 560
+453 627
+453 638
+453 755
+453 829
+453 851
+453 860
+453 879
+453 893
+453 914
+453 920
+453 949
+453 1013
+454 16
+454 61
+454 77
+454 88
+454 92
+454 127
+454 135
+454 153
+454 176
+454 247
+454 249
+454 294
+454 297
+454 300
+454 316
+454 385
+454 443
+454 507
+454 576
+454 578
+454 628
+454 676
+454 746
+454 793
+454 836
+454 866
+454 904
+454 941
+454 952
+454 961
+454 1018
+455 10
+455 20
+455 114
+455 219
+455 257
+455 299
+455 310
+455 415
+455 431
+455 488
+455 500
+455 529
+455 571
+455 637
+455 686
+455 727
+455 729
+455 859
+455 887
+455 894
+455 896
+455 923
+455 973
+455 1006
+456 23
+456 74
+456 108
+456 238
+456 339
+456 540
+456 545
+456 551
+456 562
+456 567
+456 624
+456 645
+456 650
+456 667
+456 832
+456 946
+456 970
+456 978
+456 990
+456 1000
+456 1007
+456 1010
+457 46
+457 79
+457 114
+457 159
+457 170
+457 173
+457 207
+457 237
+457 296
+457 332
+457 349
+457 361
+457 367
+457 427
+457 436
+457 563
+457 584
+457 631
+457 661
+457 702
+457 753
+457 756
+457 762
+457 790
+457 799
+457 855
+457 936
+458 36
+458 63
+458 70
+458 79
+458 112
+458 138
+458 273
+458 324
+458 328
+458 352
+458 461
+458 475
+458 502
+458 558
+458 564
+458 608
+458 631
+458 654
+458 695
+458 706
+458 710
+458 777
+458 847
+458 874
+458 1016
+458 1018
+459 11
+459 12
+459 17
+459 50
+459 59
+459 64
+459 103
+459 105
+459 229
+459 244
+459 298
+459 339
+459 352
+459 357
+459 384
+459 396
+459 403
+459 438
+459 481
+459 577
+459 694
+459 730
+459 731
+459 750
+459 806
+459 824
+459 845
+459 861
+459 871
+459 903
+459 917
+459 941
+459 957
+459 972
+459 1004
+460 8
+460 9
+460 18
+460 29
+460 36
+460 48
+460 58
+460 75
+460 98
+460 126
+460 178
+460 190
+460 208
+460 210
+460 238
+460 248
+460 257
+460 304
+460 380
+460 388
+460 430
+460 469
+460 497
+460 502
+460 506
+460 535
+460 544
+460 562
+460 581
+460 592
+460 606
+460 645
+460 662
+460 682
+460 683
+460 727
+460 747
+460 756
+460 837
+460 862
+460 863
+460 895
+460 899
+460 906
+460 929
+460 950
+460 1013
+461 73
+461 99
+461 159
+461 168
+461 219
+461 235
+461 236
+461 258
+461 288
+461 305
+461 307
+461 403
+461 434
+461 458
+461 463
+461 520
+461 610
+461 623
+461 650
+461 672
+461 684
+461 716
+461 767
+461 774
+461 780
+461 786
+461 808
+461 835
+461 838
+461 843
+461 875
+461 1013
+462 14
+462 89
+462 98
+462 130
+462 149
+462 151
+462 158
+462 170
+462 211
+462 244
+462 274
+462 394
+462 405
+462 436
+462 451
+462 464
+462 468
+462 488
+462 509
+462 531
+462 539
+462 581
+462 584
+462 608
+462 613
+462 623
+462 641
+462 644
+462 673
+462 678
+462 771
+462 794
+462 830
+462 836
+462 914
+462 930
+462 958
+462 978
+462 1017
+463 3
+463 5
+463 6
+463 39
+463 52
+463 75
+463 81
+463 120
+463 169
+463 207
+463 220
+463 224
+463 236
+463 249
+463 306
+463 341
+463 406
+463 461
+463 543
+463 563
+463 585
+463 587
+463 631
+463 646
+463 678
+463 691
+463 728
+463 774
+463 793
+463 829
+463 909
+464 13
+464 67
+464 102
+464 108
+464 148
+464 216
+464 232
+464 249
+464 257
+464 269
+464 278
+464 309
+464 338
+464 346
+464 358
+464 433
+464 462
+464 485
+464 543
+464 565
+464 590
+464 603
+464 728
+464 738
+464 775
+464 791
+464 805
+464 841
+464 846
+464 857
+464 879
+464 895
+464 934
+464 954
+464 956
+464 988
+464 992
+464 1021
+464 1022
+465 35
+465 124
+465 132
+465 147
+465 162
+465 209
+465 219
+465 235
+465 248
+465 293
+465 302
+465 305
+465 307
+465 312
+465 317
+465 354
+465 363
+465 414
+465 437
+465 473
+465 481
+465 525
+465 557
+465 570
+465 577
+465 588
+465 623
+465 647
+465 692
+465 697
+465 709
+465 726
+465 733
+465 781
+465 790
+465 795
+465 802
+465 825
+465 904
+465 938
+465 990
+465 1016
+466 97
+466 103
+466 109
+466 116
+466 122
+466 152
+466 220
+466 304
+466 310
+466 327
+466 336
+466 408
+466 423
+466 428
+466 487
+466 505
+466 626
+466 656
+466 726
+466 763
+466 837
+466 840
+466 861
+466 877
+466 911
+466 946
+466 952
+466 977
+466 1000
+466 1022
+467 5
+467 27
+467 56
+467 77
+467 166
+467 172
+467 200
+467 229
+467 249
+467 281
+467 339
+467 453
+467 538
+467 582
+467 602
+467 606
+467 665
+467 691
+467 704
+467 752
+467 769
+467 787
+467 840
+467 853
+467 874
+467 899
+467 948
+467 1003
+468 15
+468 34
+468 77
+468 167
+468 180
+468 182
+468 185
+468 228
+468 260
+468 264
+468 265
+468 345
+468 361
+468 436
+468 462
+468 493
+468 547
+468 665
+468 711
+468 788
+468 791
+468 837
+468 860
+468 871
+468 904
+468 964
+468 976
+468 1007
+468 1022
+468 1023
+469 33
+469 36
+469 114
+469 277
+469 305
+469 308
+469 313
+469 358
+469 460
+469 516
+469 539
+469 616
+469 626
+469 691
+469 715
+469 743
+469 756
+469 786
+469 824
+469 907
+469 919
+469 938
+469 962
+470 56
+470 164
+470 209
+470 216
+470 219
+470 271
+470 370
+470 371
+470 408
+470 484
+470 489
+470 561
+470 567
+470 600
+470 651
+470 732
+470 737
+470 779
+470 809
+470 946
+471 5
+471 52
+471 55
+471 101
+471 149
+471 180
+471 239
+471 243
+471 246
+471 247
+471 267
+471 288
+471 348
+471 431
+471 472
+471 475
+471 519
+471 527
+471 654
+471 658
+471 666
+471 675
+471 692
+471 752
+471 788
+471 880
+471 925
+471 939
+471 982
+471 983
+471 994
+471 1006
+472 75
+472 146
+472 151
+472 196
+472 204
+472 236
+472 368
+472 391
+472 471
+472 524
+472 544
+472 563
+472 564
+472 644
+472 679
+472 708
+472 749
+472 759
+472 783
+472 827
+472 848
+472 897
+472 938
+472 943
+472 948
+472 956
+472 1006
+472 1017
+473 0
+473 27
+473 76
+473 111
+473 119
+473 236
+473 377
+473 391
+473 392
+473 403
+473 420
+473 443
+473 465
+473 513
+473 541
+473 548
+473 596
+473 643
+473 667
+473 726
+473 752
+473 780
+473 833
+473 834
+473 922
+473 979
+473 989
+473 991
+473 1010
+473 1016
+474 1
+474 12
+474 21
+474 34
+474 57
+474 61
+474 111
+474 146
+474 161
+474 193
+474 277
+474 302
+474 320
+474 341
+474 356
+474 401
+474 403
+474 407
+474 440
+474 523
+474 541
+474 549
+474 582
+474 592
+474 640
+474 781
+474 793
+474 875
+474 892
+474 921
+474 928
+474 937
+474 1016
+475 18
+475 30
+475 101
+475 156
+475 190
+475 244
+475 265
+475 273
+475 290
+475 325
+475 350
+475 416
+475 418
+475 427
+475 442
+475 458
+475 471
+475 545
+475 609
+475 696
+475 698
+475 728
+475 757
+475 768
+475 810
+475 812
+475 817
+475 824
+475 840
+475 896
+475 923
+475 942
+476 0
+476 153
+476 154
+476 185
+476 261
+476 286
+476 301
+476 317
+476 350
+476 365
+476 417
+476 478
+476 523
+476 527
+476 542
+476 623
+476 630
+476 648
+476 718
+476 734
+476 743
+476 747
+476 913
+476 918
+476 957
+476 1010
+477 10
+477 29
+477 78
+477 79
+477 123
+477 158
+477 227
+477 233
+477 358
+477 449
+477 450
+477 453
+477 522
+477 550
+477 582
+477 640
+477 672
+477 677
+477 679
+477 726
+477 730
+477 781
+477 796
+477 832
+477 836
+477 844
+477 881
+477 893
+477 994
+478 2
+478 7
+478 44
+478 75
+478 129
+478 160
+478 174
+478 215
+478 247
+478 264
+478 280
+478 288
+478 359
+478 385
+478 410
+478 425
+478 451
+478 476
+478 501
+478 511
+478 515
+478 529
+478 535
+478 547
+478 572
+478 631
+478 636
+478 700
+478 759
+478 786
+478 859
+478 871
+478 875
+478 899
+478 923
+478 944
+478 959
+479 167
+479 237
+479 294
+479 342
+479 358
+479 359
+479 362
+479 375
+479 407
+479 408
+479 416
+479 422
+479 429
+479 435
+479 480
+479 541
+479 614
+479 665
+479 712
+479 719
+479 765
+479 793
+479 807
+479 873
+479 886
+479 911
+479 922
+479 930
+479 975
+479 980
+480 13
+480 40
+480 57
+480 76
+480 77
+480 110
+480 115
+480 122
+480 128
+480 140
+480 148
+480 153
+480 162
+480 219
+480 227
+480 269
+480 291
+480 315
+480 349
+480 361
+480 395
+480 403
+480 410
+480 479
+480 496
+480 510
+480 539
+480 555
+480 577
+480 618
+480 627
+480 665
+480 688
+480 709
+480 718
+480 761
+480 764
+480 794
+480 843
+480 878
+480 881
+480 930
+480 1005
+480 1006
+480 1012
+481 71
+481 122
+481 207
+481 270
+481 334
+481 386
+481 412
+481 413
+481 415
+481 444
+481 459
+481 465
+481 487
+481 494
+481 729
+481 732
+481 780
+481 826
+481 867
+481 887
+481 889
+481 900
+481 924
+481 964
+481 967
+481 987
+481 1013
+482 1
+482 19
+482 38
+482 112
+482 150
+482 229
+482 235
+482 236
+482 286
+482 303
+482 304
+482 329
+482 352
+482 506
+482 512
+482 541
+482 561
+482 564
+482 599
+482 609
+482 732
+482 745
+482 786
+482 799
+482 825
+482 848
+482 922
+482 961
+482 1020
+483 5
+483 13
+483 28
+483 39
+483 69
+483 105
+483 174
+483 176
+483 185
+483 196
+483 227
+483 237
+483 268
+483 335
+483 361
+483 366
+483 416
+483 571
+483 624
+483 635
+483 686
+483 761
+483 774
+483 796
+483 797
+483 822
+483 837
+483 861
+483 914
+483 926
+483 935
+483 948
+483 995
+483 996
+483 1001
+483 1012
+484 41
+484 61
+484 69
+484 77
+484 108
+484 142
+484 152
+484 197
+484 248
+484 254
+484 288
+484 304
+484 322
+484 365
+484 443
+484 447
+484 470
+484 531
+484 532
+484 534
+484 659
+484 676
+484 688
+484 742
+484 793
+484 829
+484 923
+484 993
+484 1002
+485 63
+485 96
+485 155
+485 159
+485 179
+485 198
+485 205
+485 301
+485 312
+485 367
+485 375
+485 400
+485 403
+485 429
+485 464
+485 514
+485 545
+485 546
+485 583
+485 637
+485 655
+485 670
+485 733
+485 746
+485 764
+485 889
+485 911
+485 946
+485 978
+485 986
+486 18
+486 130
+486 168
+486 208
+486 228
+486 259
+486 292
+486 338
+486 374
+486 443
+486 499
+486 504
+486 516
+486 557
+486 576
+486 599
+486 616
+486 755
+486 773
+486 804
+486 926
+486 942
+487 48
+487 55
+487 102
+487 139
+487 147
+487 162
+487 174
+487 211
+487 225
+487 305
+487 413
+487 443
+487 451
+487 466
+487 481
+487 494
+487 506
+487 511
+487 548
+487 565
+487 569
+487 585
+487 614
+487 643
+487 684
+487 686
+487 735
+487 796
+487 856
+487 873
+487 876
+487 896
+487 916
+487 936
+487 949
+487 981
+488 18
+488 30
+488 43
+488 48
+488 50
+488 77
+488 79
+488 98
+488 110
+488 118
+488 136
+488 157
+488 163
+488 223
+488 260
+488 299
+488 306
+488 403
+488 421
+488 428
+488 452
+488 455
+488 462
+488 510
+488 529
+488 535
+488 541
+488 545
+488 579
+488 606
+488 616
+488 625
+488 661
+488 667
+488 669
+488 679
+488 680
+488 747
+488 797
+488 806
+488 808
+488 871
+488 911
+488 941
+488 956
+488 982
+488 1010
+488 1013
+489 10
+489 33
+489 94
+489 161
+489 163
+489 174
+489 192
+489 238
+489 287
+489 442
+489 470
+489 539
+489 541
+489 551
+489 585
+489 595
+489 699
+489 707
+489 712
+489 714
+489 765
+489 909
+489 963
+489 1002
+489 1010
+490 42
+490 75
+490 107
+490 143
+490 191
+490 317
+490 324
+490 332
+490 356
+490 564
+490 596
+490 641
+490 673
+490 715
+490 749
+490 828
+490 851
+490 856
+490 893
+490 905
+490 912
+490 941
+490 943
+490 960
+490 969
+490 990
+490 1008
+490 1012
+490 1019
+490 1022
+491 68
+491 80
+491 196
+491 285
+491 304
+491 314
+491 319
+491 398
+491 403
+491 414
+491 500
+491 554
+491 580
+491 625
+491 688
+491 693
+491 706
+491 715
+491 718
+491 730
+491 748
+491 760
+491 769
+491 784
+491 809
+491 922
+491 939
+491 971
+491 1013
+492 13
+492 22
+492 76
+492 90
+492 142
+492 152
+492 155
+492 273
+492 346
+492 529
+492 530
+492 533
+492 625
+492 648
+492 657
+492 690
+492 708
+492 716
+492 718
+492 743
+492 871
+492 872
+492 874
+492 899
+492 923
+492 970
+492 1013
+493 8
+493 21
+493 56
+493 79
+493 185
+493 258
+493 271
+493 337
+493 358
+493 385
+493 404
+493 429
+493 430
+493 468
+493 495
+493 521
+493 528
+493 570
+493 572
+493 589
+493 624
+493 641
+493 696
+493 721
+493 813
+493 825
+493 852
+493 908
+493 941
+493 970
+493 982
+494 79
+494 125
+494 165
+494 209
+494 268
+494 300
+494 349
+494 358
+494 359
+494 404
+494 409
+494 416
+494 420
+494 481
+494 487
+494 508
+494 513
+494 562
+494 598
+494 624
+494 669
+494 707
+494 733
+494 791
+494 792
+494 916
+494 923
+494 928
+494 942
+494 982
+494 1010
+494 1021
+495 1
+495 28
+495 36
+495 67
+495 83
+495 91
+495 93
+495 102
+495 117
+495 118
+495 153
+495 173
+495 178
+495 188
+495 191
+495 207
+495 229
+495 294
+495 355
+495 364
+495 377
+495 432
+495 493
+495 496
+495 509
+495 538
+495 642
+495 644
+495 645
+495 661
+495 671
+495 747
+495 792
+495 874
+495 876
+495 882
+495 1006
+496 54
+496 73
+496 168
+496 194
+496 271
+496 290
+496 306
+496 308
+496 309
+496 402
+496 409
+496 423
+496 480
+496 495
+496 517
+496 576
+496 613
+496 616
+496 624
+496 626
+496 656
+496 676
+496 680
+496 704
+496 790
+496 795
+496 822
+496 902
+496 925
+496 963
+496 964
+496 966
+496 979
+496 1001
+496 1021
+497 47
+497 55
+497 91
+497 167
+497 210
+497 346
+497 356
+497 359
+497 374
+497 450
+497 460
+497 528
+497 535
+497 536
+497 560
+497 575
+497 585
+497 594
+497 663
+497 713
+497 717
+497 719
+497 755
+497 855
+497 880
+497 883
+497 896
+497 938
+497 952
+497 959
+497 973
+497 1013
+498 10
+498 36
+498 52
+498 70
+498 76
+498 85
+498 90
+498 259
+498 262
+498 329
+498 333
+498 423
+498 434
+498 572
+498 579
+498 607
+498 641
+498 644
+498 663
+498 708
+498 709
+498 760
+498 787
+498 788
+498 795
+498 834
+498 854
+498 875
+498 897
+498 919
+498 939
+498 1014
+499 58
+499 92
+499 119
+499 154
+499 181
+499 190
+499 229
+499 236
+499 269
+499 303
+499 304
+499 338
+499 341
+499 352
+499 403
+499 433
+499 486
+499 543
+499 549
+499 706
+499 751
+499 754
+499 773
+499 824
+499 853
+499 871
+499 873
+499 929
+499 932
+499 948
+499 971
+499 973
+499 990
+499 1007
+499 1009
+500 2
+500 12
+500 13
+500 84
+500 118
+500 127
+500 142
+500 171
+500 195
+500 196
+500 269
+500 278
+500 311
+500 364
+500 385
+500 388
+500 435
+500 452
+500 455
+500 491
+500 504
+500 506
+500 514
+500 546
+500 550
+500 565
+500 566
+500 585
+500 589
+500 633
+500 636
+500 642
+500 654
+500 762
+500 785
+500 788
+500 792
+500 819
+500 820
+500 845
+500 870
+500 953
+500 1016
+501 48
+501 51
+501 54
+501 69
+501 82
+501 93
+501 102
+501 106
+501 107
+501 133
+501 150
+501 156
+501 216
+501 296
+501 297
+501 393
+501 410
+501 426
+501 478
+501 561
+501 634
+501 653
+501 680
+501 707
+501 732
+501 792
+501 826
+501 831
+501 853
+501 859
+501 860
+501 866
+501 885
+501 938
+501 964
+501 972
+501 1002
+501 1003
+502 38
+502 62
+502 116
+502 160
+502 188
+502 231
+502 250
+502 258
+502 274
+502 316
+502 317
+502 372
+502 384
+502 431
+502 433
+502 434
+502 436
+502 438
+502 449
+502 458
+502 460
+502 505
+502 524
+502 533
+502 551
+502 563
+502 595
+502 612
+502 630
+502 676
+502 744
+502 803
+502 844
+502 863
+502 879
+502 889
+502 940
+503 46
+503 179
+503 183
+503 211
+503 256
+503 322
+503 357
+503 545
+503 554
+503 565
+503 632
+503 664
+503 700
+503 785
+503 863
+503 875
+503 887
+503 902
+503 928
+503 935
+503 994
+503 1002
+504 103
+504 116
+504 125
+504 136
+504 158
+504 218
+504 284
+504 312
+504 336
+504 349
+504 363
+504 486
+504 500
+504 612
+504 624
+504 635
+504 651
+504 658
+504 676
+504 717
+504 740
+504 742
+504 764
+504 773
+504 783
+504 810
+504 835
+504 845
+504 896
+504 946
+504 1011
+504 1019
+505 33
+505 38
+505 108
+505 110
+505 148
+505 191
+505 195
+505 214
+505 263
+505 276
+505 277
+505 283
+505 297
+505 336
+505 355
+505 398
+505 402
+505 466
+505 502
+505 554
+505 558
+505 563
+505 567
+505 586
+505 640
+505 755
+505 814
+505 884
+505 899
+505 1002
+506 34
+506 93
+506 116
+506 199
+506 210
+506 221
+506 245
+506 272
+506 308
+506 349
+506 354
+506 359
+506 414
+506 426
+506 460
+506 482
+506 487
+506 500
+506 586
+506 631
+506 635
+506 679
+506 686
+506 700
+506 726
+506 732
+506 763
+506 805
+506 816
+506 818
+506 819
+506 842
+506 853
+506 876
+506 878
+506 890
+506 900
+506 954
+506 959
+506 966
+506 986
+507 18
+507 48
+507 59
+507 132
+507 201
+507 307
+507 383
+507 426
+507 427
+507 433
+507 437
+507 451
+507 454
+507 547
+507 574
+507 704
+507 727
+507 733
+507 760
+507 762
+507 979
+507 991
+507 1009
+507 1010
+508 19
+508 89
+508 116
+508 148
+508 224
+508 232
+508 247
+508 259
+508 261
+508 285
+508 303
+508 428
+508 494
+508 526
+508 558
+508 559
+508 651
+508 662
+508 690
+508 695
+508 718
+508 745
+508 794
+508 807
+508 889
+508 981
+509 15
+509 51
+509 66
+509 82
+509 107
+509 112
+509 168
+509 199
+509 201
+509 231
+509 250
+509 293
+509 350
+509 352
+509 358
+509 362
+509 448
+509 462
+509 495
+509 541
+509 584
+509 587
+509 589
+509 594
+509 654
+509 733
+509 744
+509 787
+509 798
+509 800
+509 823
+509 853
+509 865
+509 929
+509 933
+509 947
+509 948
+509 1014
+510 10
+510 54
+510 78
+510 90
+510 105
+510 108
+510 119
+510 171
+510 194
+510 198
+510 251
+510 276
+510 280
+510 288
+510 341
+510 419
+510 444
+510 480
+510 488
+510 525
+510 562
+510 597
+510 723
+510 737
+510 827
+510 852
+510 875
+510 934
+510 952
+510 975
+510 1004
+511 52
+511 60
+511 244
+511 250
+511 263
+511 272
+511 323
+511 326
+511 328
+511 344
+511 369
+511 411
+511 427
+511 449
+511 478
+511 487
+511 543
+511 644
+511 666
+511 700
+511 712
+511 737
+511 785
+511 788
+511 820
+511 839
+511 848
+511 880
+511 911
+511 913
+511 1008
+511 1020
+512 39
+512 66
+512 106
+512 155
+512 161
+512 171
+512 283
+512 434
+512 445
+512 482
+512 564
+512 579
+512 593
+512 643
+512 659
+512 668
+512 676
+512 718
+512 768
+512 773
+512 929
+512 932
+512 966
+512 984
+512 987
+512 1015
+513 109
+513 114
+513 159
+513 165
+513 176
+513 187
+513 205
+513 224
+513 253
+513 267
+513 307
+513 373
+513 389
+513 403
+513 473
+513 494
+513 551
+513 555
+513 594
+513 641
+513 646
+513 657
+513 696
+513 706
+513 707
+513 753
+513 834
+513 897
+513 933
+513 949
+513 976
+513 1001
+514 17
+514 23
+514 144
+514 146
+514 186
+514 203
+514 207
+514 210
+514 212
+514 217
+514 239
+514 241
+514 263
+514 273
+514 420
+514 485
+514 500
+514 550
+514 555
+514 563
+514 634
+514 687
+514 707
+514 711
+514 721
+514 729
+514 742
+514 792
+514 843
+514 862
+514 870
+514 893
+514 946
+514 958
+514 966
+514 983
+514 985
+514 1023
+515 39
+515 43
+515 68
+515 118
+515 152
+515 182
+515 211
+515 277
+515 311
+515 398
+515 478
+515 517
+515 534
+515 556
+515 607
+515 613
+515 628
+515 632
+515 640
+515 658
+515 670
+515 849
+515 857
+515 872
+515 928
+515 992
+515 1001
+516 15
+516 32
+516 49
+516 192
+516 240
+516 361
+516 391
+516 392
+516 449
+516 469
+516 486
+516 526
+516 531
+516 608
+516 615
+516 664
+516 709
+516 744
+516 783
+516 849
+516 853
+516 860
+516 889
+516 904
+516 917
+516 918
+516 924
+516 987
+517 11
+517 46
+517 61
+517 89
+517 92
+517 138
+517 157
+517 188
+517 192
+517 212
+517 302
+517 305
+517 307
+517 315
+517 346
+517 366
+517 421
+517 496
+517 515
+517 631
+517 663
+517 683
+517 747
+517 757
+517 822
+517 847
+517 895
+517 972
+517 994
+518 2
+518 20
+518 112
+518 132
+518 135
+518 174
+518 198
+518 225
+518 233
+518 247
+518 252
+518 273
+518 279
+518 428
+518 443
+518 525
+518 581
+518 602
+518 660
+518 707
+518 729
+518 858
+518 879
+518 900
+519 4
+519 6
+519 74
+519 89
+519 109
+519 133
+519 166
+519 178
+519 182
+519 197
+519 245
+519 248
+519 289
+519 297
+519 301
+519 307
+519 442
+519 450
+519 471
+519 604
+519 629
+519 696
+519 700
+519 801
+519 813
+519 857
+519 883
+519 951
+519 986
+520 18
+520 30
+520 64
+520 77
+520 94
+520 100
+520 130
+520 159
+520 175
+520 220
+520 243
+520 253
+520 267
+520 284
+520 301
+520 316
+520 323
+520 351
+520 364
+520 403
+520 461
+520 541
+520 574
+520 673
+520 690
+520 711
+520 758
+520 761
+520 820
+520 848
+520 856
+520 895
+520 940
+520 946
+521 21
+521 38
+521 48
+521 51
+521 63
+521 91
+521 106
+521 136
+521 142
+521 170
+521 207
+521 218
+521 270
+521 287
+521 317
+521 327
+521 344
+521 405
+521 414
+521 493
+521 541
+521 545
+521 573
+521 599
+521 600
+521 625
+521 641
+521 720
+521 772
+521 818
+521 824
+521 838
+521 877
+521 899
+521 915
+521 926
+521 940
+521 963
+521 1021
+521 1023
+522 0
+522 4
+522 39
+522 97
+522 126
+522 169
+522 212
+522 252
+522 273
+522 294
+522 325
+522 346
+522 352
+522 477
+522 568
+522 581
+522 620
+522 623
+522 627
+522 659
+522 673
+522 693
+522 709
+522 767
+522 810
+522 824
+522 866
+522 980
+522 1006
+523 5
+523 61
+523 67
+523 95
+523 114
+523 134
+523 150
+523 196
+523 312
+523 324
+523 354
+523 373
+523 400
+523 474
+523 476
+523 530
+523 705
+523 766
+523 777
+523 789
+523 805
+523 835
+523 856
+523 874
+523 899
+523 993
+524 42
+524 69
+524 83
+524 84
+524 97
+524 149
+524 151
+524 206
+524 244
+524 266
+524 307
+524 309
+524 319
+524 320
+524 327
+524 413
+524 472
+524 502
+524 576
+524 577
+524 634
+524 667
+524 701
+524 706
+524 719
+524 844
+524 881
+524 910
+524 918
+524 930
+524 942
+524 974
+524 1013
+525 2
+525 39
+525 61
+525 68
+525 84
+525 130
+525 185
+525 201
+525 233
+525 272
+525 277
+525 339
+525 404
+525 424
+525 425
+525 465
+525 510
+525 518
+525 544
+525 564
+525 572
+525 573
+525 590
+525 637
+525 658
+525 665
+525 668
+525 684
+525 693
+525 702
+525 704
+525 719
+525 720
+525 740
+525 745
+525 753
+525 794
+525 798
+525 882
+525 908
+526 52
+526 67
+526 99
+526 151
+526 161
+526 186
+526 267
+526 285
+526 333
+526 366
+526 422
+526 425
+526 508
+526 516
+526 618
+526 647
+526 669
+526 673
+526 750
+526 852
+526 865
+526 894
+526 922
+526 947
+527 18
+527 35
+527 42
+527 55
+527 146
+527 163
+527 180
+527 235
+527 259
+527 297
+527 407
+527 410
+527 471
+527 476
+527 550
+527 557
+527 562
+527 580
+527 592
+527 662
+527 733
+527 777
+527 859
+527 890
+527 898
+527 991
+527 1010
+528 8
+528 11
+528 13
+528 26
+528 62
+528 99
+528 109
+528 118
+528 134
+528 144
+528 177
+528 200
+528 211
+528 232
+528 237
+528 254
+528 275
+528 289
+528 373
+528 375
+528 403
+528 429
+528 493
+528 497
+528 557
+528 635
+528 714
+528 734
+528 839
+528 848
+528 864
+528 939
+528 960
+528 964
+528 974
+528 975
+528 991
+528 1018
+529 105
+529 134
+529 217
+529 255
+529 373
+529 404
+529 408
+529 443
+529 455
+529 478
+529 488
+529 492
+529 562
+529 570
+529 609
+529 636
+529 661
+529 676
+529 699
+529 768
+529 795
+529 863
+530 67
+530 70
+530 114
+530 118
+530 238
+530 266
+530 277
+530 320
+530 423
+530 424
+530 429
+530 492
+530 523
+530 561
+530 568
+530 607
+530 636
+530 638
+530 650
+530 744
+530 758
+530 812
+530 813
+530 850
+530 887
+530 888
+530 924
+530 932
+530 935
+530 957
+530 968
+530 971
+530 974
+531 5
+531 72
+531 74
+531 79
+531 141
+531 152
+531 159
+531 347
+531 368
+531 444
+531 448
+531 462
+531 484
+531 516
+531 539
+531 544
+531 548
+531 562
+531 586
+531 656
+531 736
+531 777
+531 780
+531 841
+531 844
+531 894
+531 906
+531 932
+531 954
+531 985
+531 1016
+532 28
+532 123
+532 263
+532 390
+532 484
+532 543
+532 575
+532 587
+532 641
+532 662
+532 669
+532 697
+532 701
+532 782
+532 786
+532 832
+532 935
+532 993
+533 33
+533 58
+533 80
+533 154
+533 223
+533 291
+533 401
+533 492
+533 502
+533 580
+533 640
+533 653
+533 658
+533 660
+533 762
+533 859
+533 863
+533 902
+533 948
+533 959
+533 967
+533 989
+533 991
+534 27
+534 76
+534 175
+534 184
+534 196
+534 211
+534 289
+534 296
+534 301
+534 314
+534 380
+534 484
+534 515
+534 546
+534 620
+534 638
+534 666
+534 673
+534 830
+534 880
+534 892
+535 23
+535 32
+535 37
+535 85
+535 100
+535 107
+535 110
+535 120
+535 130
+535 153
+535 246
+535 251
+535 269
+535 298
+535 324
+535 362
+535 441
+535 447
+535 460
+535 478
+535 488
+535 497
+535 536
+535 578
+535 591
+535 614
+535 730
+535 745
+535 856
+535 863
+535 918
+535 927
+535 948
+535 959
+535 1015
+536 49
+536 104
+536 116
+536 138
+536 158
+536 246
+536 247
+536 258
+536 275
+536 323
+536 351
+536 366
+536 384
+536 388
+536 405
+536 412
+536 497
+536 535
+536 565
+536 570
+536 597
+536 650
+536 667
+536 689
+536 695
+536 722
+536 755
+536 773
+536 827
+536 899
+536 905
+536 934
+536 977
+537 2
+537 52
+537 56
+537 134
+537 175
+537 193
+537 194
+537 230
+537 307
+537 319
+537 328
+537 351
+537 352
+537 379
+537 382
+537 393
+537 408
+537 538
+537 566
+537 585
+537 605
+537 685
+537 815
+537 821
+537 836
+537 837
+537 849
+537 863
+537 882
+537 971
+537 993
+537 1015
+538 55
+538 110
+538 117
+538 157
+538 198
+538 200
+538 211
+538 239
+538 256
+538 277
+538 288
+538 291
+538 294
+538 308
+538 445
+538 451
+538 467
+538 495
+538 537
+538 554
+538 635
+538 636
+538 652
+538 684
+538 714
+538 774
+538 794
+538 831
+538 866
+538 869
+538 903
+539 23
+539 62
+539 121
+539 144
+539 150
+539 188
+539 218
+539 241
+539 255
+539 325
+539 348
+539 357
+539 361
+539 369
+539 428
+539 462
+539 469
+539 480
+539 489
+539 531
+539 554
+539 580
+539 698
+539 703
+539 743
+539 750
+539 769
+539 807
+539 813
+539 857
+539 903
+539 922
+539 931
+539 941
+539 995
+539 996
+540 15
+540 70
+540 107
+540 117
+540 141
+540 167
+540 215
+540 265
+540 291
+540 320
+540 327
+540 387
+540 420
+540 456
+540 577
+540 627
+540 665
+540 710
+540 732
+540 745
+540 868
+540 882
+540 899
+540 995
+541 0
+541 18
+541 39
+541 44
+541 79
+541 222
+541 231
+541 242
+541 261
+541 267
+541 270
+541 286
+541 395
+541 401
+541 446
+541 473
+541 474
+541 479
+541 482
+541 488
+541 489
+541 509
+541 520
+541 521
+541 558
+541 574
+541 606
+541 625
+541 739
+541 748
+541 856
+541 879
+541 907
+541 911
+541 999
+541 1020
+542 33
+542 48
+542 66
+542 103
+542 113
+542 167
+542 195
+542 198
+542 220
+542 254
+542 276
+542 299
+542 375
+542 410
+542 421
+542 430
+542 476
+542 552
+542 553
+542 558
+542 560
+542 568
+542 581
+542 647
+542 762
+542 776
+542 815
+542 855
+542 878
+542 888
+542 912
+542 983
+542 1018
+542 1021
+543 10
+543 19
+543 26
+543 30
+543 41
+543 43
+543 65
+543 69
+543 86
+543 167
+543 223
+543 245
+543 280
+543 315
+543 349
+543 386
+543 443
+543 450
+543 463
+543 464
+543 499
+543 511
+543 532
+543 647
+543 667
+543 712
+543 786
+543 815
+543 825
+543 835
+543 881
+543 899
+543 922
+543 951
+543 973
+544 95
+544 97
+544 156
+544 206
+544 227
+544 242
+544 289
+544 292
+544 293
+544 298
+544 301
+544 312
+544 369
+544 374
+544 375
+544 423
+544 432
+544 446
+544 460
+544 472
+544 525
+544 531
+544 584
+544 592
+544 687
+544 699
+544 716
+544 750
+544 835
+544 870
+544 882
+544 925
+544 935
+544 948
+544 966
+545 2
+545 49
+545 143
+545 152
+545 183
+545 231
+545 250
+545 289
+545 318
+545 337
+545 367
+545 375
+545 399
+545 406
+545 451
+545 456
+545 475
+545 485
+545 488
+545 503
+545 521
+545 573
+545 580
+545 591
+545 618
+545 652
+545 719
+545 739
+545 770
+545 795
+545 858
+545 899
+545 929
+545 1006
+546 30
+546 57
+546 63
+546 121
+546 136
+546 137
+546 218
+546 248
+546 320
+546 360
+546 376
+546 385
+546 431
+546 485
+546 500
+546 534
+546 555
+546 607
+546 692
+546 739
+546 747
+546 757
+546 807
+546 808
+546 863
+546 901
+546 1004
+546 1010
+547 0
+547 4
+547 14
+547 47
+547 151
+547 167
+547 174
+547 181
+547 195
+547 203
+547 220
+547 385
+547 388
+547 399
+547 410
+547 432
+547 468
+547 478
+547 507
+547 569
+547 579
+547 588
+547 598
+547 626
+547 693
+547 987
+548 20
+548 32
+548 43
+548 60
+548 69
+548 117
+548 139
+548 156
+548 179
+548 187
+548 227
+548 254
+548 257
+548 334
+548 335
+548 345
+548 358
+548 382
+548 418
+548 429
+548 473
+548 487
+548 531
+548 552
+548 578
+548 604
+548 655
+548 762
+548 851
+548 894
+548 898
+548 907
+548 1013
+549 1
+549 4
+549 23
+549 53
+549 137
+549 193
+549 198
+549 225
+549 250
+549 348
+549 474
+549 499
+549 586
+549 653
+549 690
+549 691
+549 706
+549 729
+549 767
+549 769
+549 782
+549 882
+549 948
+549 952
+549 1021
+550 11
+550 120
+550 174
+550 179
+550 240
+550 323
+550 330
+550 364
+550 398
+550 424
+550 443
+550 477
+550 500
+550 514
+550 527
+550 563
+550 592
+550 643
+550 673
+550 719
+550 786
+550 879
+550 927
+550 928
+550 936
+550 970
+550 976
+550 991
+551 9
+551 41
+551 58
+551 68
+551 161
+551 203
+551 215
+551 225
+551 268
+551 277
+551 280
+551 346
+551 357
+551 392
+551 394
+551 437
+551 440
+551 456
+551 489
+551 502
+551 513
+551 554
+551 558
+551 595
+551 598
+551 613
+551 624
+551 658
+551 667
+551 696
+551 698
+551 709
+551 739
+551 783
+551 804
+551 809
+551 811
+551 814
+551 881
+551 896
+551 899
+551 941
+551 959
+551 961
+552 44
+552 60
+552 86
+552 92
+552 111
+552 119
+552 284
+552 331
+552 368
+552 386
+552 542
+552 548
+552 612
+552 620
+552 687
+552 693
+552 718
+552 720
+552 755
+552 893
+552 972
+552 973
+552 1002
+552 1014
+553 39
+553 81
+553 146
+553 177
+553 222
+553 231
+553 250
+553 257
+553 290
+553 395
+553 434
+553 437
+553 440
+553 542
+553 584
+553 590
+553 597
+553 607
+553 632
+553 671
+553 681
+553 721
+553 749
+553 764
+553 778
+553 888
+553 908
+553 921
+553 970
+553 986
+554 106
+554 113
+554 127
+554 310
+554 314
+554 353
+554 355
+554 379
+554 491
+554 503
+554 505
+554 538
+554 539
+554 551
+554 561
+554 568
+554 576
+554 586
+554 589
+554 599
+554 604
+554 644
+554 687
+554 690
+554 730
+554 741
+554 770
+554 810
+554 817
+554 827
+554 885
+554 933
+554 967
+554 975
+554 977
+555 14
+555 36
+555 40
+555 81
+555 83
+555 91
+555 99
+555 104
+555 162
+555 166
+555 184
+555 215
+555 268
+555 288
+555 300
+555 345
+555 358
+555 379
+555 386
+555 390
+555 480
+555 513
+555 514
+555 546
+555 576
+555 595
+555 596
+555 610
+555 627
+555 653
+555 696
+555 728
+555 786
+555 787
+555 836
+555 908
+555 915
+555 921
+555 948
+555 958
+555 996
+556 0
+556 46
+556 148
+556 180
+556 181
+556 260
+556 346
+556 365
+556 367
+556 376
+556 383
+556 389
+556 434
+556 451
+556 515
+556 558
+556 601
+556 658
+556 712
+556 729
+556 774
+556 777
+556 794
+556 796
+556 806
+556 865
+556 882
+556 897
+556 900
+556 947
+556 986
+556 1022
+557 75
+557 138
+557 163
+557 219
+557 220
+557 240
+557 246
+557 266
+557 309
+557 365
+557 381
+557 393
+557 408
+557 442
+557 448
+557 449
+557 465
+557 486
+557 527
+557 528
+557 590
+557 625
+557 663
+557 669
+557 671
+557 689
+557 744
+557 754
+557 837
+557 844
+557 852
+557 984
+557 1023
+558 13
+558 105
+558 119
+558 130
+558 180
+558 235
+558 254
+558 271
+558 272
+558 295
+558 375
+558 398
+558 424
+558 458
+558 505
+558 508
+558 541
+558 542
+558 551
+558 556
+558 580
+558 582
+558 717
+558 737
+558 741
+558 785
+558 793
+558 803
+558 805
+558 815
+558 972
+558 1004
+558 1008
+559 41
+559 114
+559 164
+559 189
+559 216
+559 251
+559 314
+559 315
+559 345
+559 397
+559 421
+559 508
+559 562
+559 580
+559 581
+559 586
+559 627
+559 631
+559 669
+559 671
+559 769
+559 781
+559 783
+559 804
+559 947
+559 984
+559 1005
+560 23
+560 50
+560 86
+560 102
+560 159
+560 168
+560 188
+560 247
+560 290
+560 301
+560 368
+560 379
+560 430
+560 453
+560 497
+560 542
+560 658
+560 689
+560 798
+560 814
+560 837
+560 849
+560 896
+560 903
+560 929
+561 36
+561 58
+561 160
+561 214
+561 235
+561 252
+561 280
+561 306
+561 366
+561 385
+561 415
+561 470
+561 482
+561 501
+561 530
+561 554
+561 592
+561 602
+561 616
+561 657
+561 684
+561 686
+561 701
+561 708
+561 717
+561 830
+561 833
+561 982
+561 996
+562 108
+562 116
+562 143
+562 157
+562 221
+562 243
+562 257
+562 285
+562 311
+562 342
+562 390
+562 403
+562 412
+562 432
+562 456
+562 460
+562 494
+562 510
+562 527
+562 529
+562 531
+562 559
+562 570
+562 594
+562 601
+562 611
+562 615
+562 672
+562 793
+562 799
+562 822
+562 857
+562 876
+562 931
+562 953
+562 979
+562 1017
+563 87
+563 217
+563 251
+563 257
+563 318
+563 319
+563 362
+563 371
+563 457
+563 463
+563 472
+563 502
+563 505
+563 514
+563 550
+563 567
+563 574
+563 602
+563 610
+563 652
+563 662
+563 690
+563 803
+563 851
+563 913
+563 931
+563 945
+563 951
+563 1023
+564 10
+564 53
+564 124
+564 127
+564 215
+564 239
+564 264
+564 273
+564 340
+564 342
+564 397
+564 405
+564 429
+564 434
+564 458
+564 472
+564 482
+564 490
+564 512
+564 525
+564 587
+564 757
+564 762
+564 818
+564 839
+564 894
+564 912
+564 984
+564 996
+564 1000
+565 106
+565 138
+565 170
+565 171
+565 178
+565 217
+565 243
+565 251
+565 266
+565 294
+565 331
+565 355
+565 420
+565 464
+565 487
+565 500
+565 503
+565 536
+565 609
+565 712
+565 739
+565 755
+565 771
+565 772
+565 796
+565 828
+565 831
+565 867
+565 898
+565 923
+565 945
+565 965
+565 977
+565 987
+566 4
+566 34
+566 44
+566 64
+566 103
+566 154
+566 181
+566 185
+566 190
+566 267
+566 298
+566 315
+566 341
+566 350
+566 368
+566 386
+566 428
+566 432
+566 500
+566 537
+566 586
+566 655
+566 662
+566 694
+566 701
+566 760
+566 790
+566 819
+566 829
+566 847
+566 908
+566 946
+566 976
+566 1003
+566 1016
+567 29
+567 84
+567 117
+567 143
+567 172
+567 179
+567 266
+567 285
+567 356
+567 390
+567 392
+567 456
+567 470
+567 505
+567 563
+567 585
+567 851
+567 890
+567 897
+568 18
+568 55
+568 82
+568 117
+568 119
+568 128
+568 197
+568 198
+568 201
+568 218
+568 277
+568 296
+568 348
+568 353
+568 365
+568 380
+568 387
+568 522
+568 530
+568 542
+568 554
+568 599
+568 633
+568 722
+568 756
+568 799
+568 807
+568 884
+568 910
+568 929
+568 941
+568 966
+568 1002
+568 1008
+569 35
+569 74
+569 93
+569 126
+569 135
+569 162
+569 164
+569 190
+569 295
+569 300
+569 319
+569 487
+569 547
+569 570
+569 581
+569 596
+569 700
+569 731
+569 737
+569 746
+569 768
+569 794
+569 825
+569 851
+569 968
+569 1000
+570 45
+570 53
+570 68
+570 91
+570 114
+570 168
+570 193
+570 200
+570 224
+570 335
+570 337
+570 341
+570 377
+570 465
+570 493
+570 529
+570 536
+570 562
+570 569
+570 608
+570 624
+570 695
+570 699
+570 746
+570 787
+570 818
+570 960
+570 1013
+571 26
+571 28
+571 64
+571 110
+571 212
+571 247
+571 310
+571 313
+571 326
+571 356
+571 375
+571 392
+571 424
+571 455
+571 483
+571 606
+571 642
+571 662
+571 723
+571 729
+571 745
+571 750
+571 771
+571 825
+571 831
+571 833
+571 839
+571 878
+571 939
+571 1019
+572 42
+572 61
+572 93
+572 101
+572 191
+572 230
+572 284
+572 438
+572 478
+572 493
+572 498
+572 525
+572 581
+572 583
+572 665
+572 679
+572 741
+572 751
+572 773
+572 788
+572 840
+572 849
+572 857
+572 891
+572 940
+572 974
+573 6
+573 29
+573 46
+573 68
+573 124
+573 201
+573 226
+573 273
+573 331
+573 382
+573 383
+573 413
+573 427
+573 521
+573 525
+573 545
+573 597
+573 637
+573 653
+573 667
+573 725
+573 805
+573 807
+573 818
+573 832
+573 843
+573 879
+573 938
+573 958
+573 998
+574 4
+574 50
+574 74
+574 87
+574 92
+574 104
+574 116
+574 164
+574 179
+574 218
+574 220
+574 223
+574 228
+574 273
+574 300
+574 314
+574 319
+574 339
+574 348
+574 349
+574 357
+574 365
+574 413
+574 507
+574 520
+574 541
+574 563
+574 585
+574 655
+574 696
+574 736
+574 815
+574 818
+574 867
+574 873
+574 926
+574 981
+574 983
+574 991
+574 1004
+575 50
+575 52
+575 65
+575 146
+575 147
+575 150
+575 182
+575 188
+575 209
+575 244
+575 333
+575 388
+575 394
+575 399
+575 410
+575 497
+575 532
+575 590
+575 599
+575 600
+575 645
+575 648
+575 697
+575 719
+575 727
+575 754
+575 776
+575 795
+575 807
+575 841
+575 853
+575 913
+575 940
+575 982
+575 1009
+576 40
+576 51
+576 60
+576 61
+576 99
+576 188
+576 198
+576 217
+576 226
+576 231
+576 259
+576 263
+576 306
+576 397
+576 416
+576 454
+576 486
+576 496
+576 524
+576 554
+576 555
+576 582
+576 641
+576 699
+576 702
+576 753
+576 770
+576 773
+576 816
+576 832
+576 897
+577 120
+577 145
+577 152
+577 232
+577 248
+577 278
+577 294
+577 312
+577 345
+577 435
+577 446
+577 459
+577 465
+577 480
+577 524
+577 540
+577 599
+577 665
+577 676
+577 687
+577 751
+577 842
+577 875
+577 906
+577 910
+577 944
+577 948
+577 1006
+578 26
+578 75
+578 161
+578 214
+578 289
+578 330
+578 337
+578 361
+578 424
+578 454
+578 535
+578 548
+578 605
+578 617
+578 641
+578 678
+578 713
+578 733
+578 790
+578 797
+578 814
+578 827
+578 863
+578 922
+578 974
+579 36
+579 41
+579 124
+579 141
+579 144
+579 152
+579 212
+579 247
+579 315
+579 346
+579 347
+579 370
+579 443
+579 488
+579 498
+579 512
+579 547
+579 599
+579 603
+579 633
+579 660
+579 672
+579 682
+579 685
+579 698
+579 750
+579 759
+579 762
+579 819
+579 841
+579 884
+579 922
+579 938
+579 959
+579 1012
+580 14
+580 16
+580 33
+580 45
+580 56
+580 78
+580 182
+580 235
+580 254
+580 299
+580 362
+580 386
+580 421
+580 434
+580 452
+580 491
+580 527
+580 533
+580 539
+580 545
+580 558
+580 559
+580 679
+580 730
+580 751
+580 768
+580 771
+580 786
+580 789
+580 924
+580 943
+580 956
+580 983
+581 20
+581 47
+581 72
+581 95
+581 126
+581 137
+581 242
+581 266
+581 275
+581 293
+581 297
+581 321
+581 328
+581 403
+581 460
+581 462
+581 518
+581 522
+581 542
+581 559
+581 569
+581 572
+581 590
+581 634
+581 737
+581 742
+581 764
+581 787
+581 789
+581 803
+581 824
+581 834
+581 850
+581 865
+581 887
+581 900
+581 914
+581 1018
+582 18
+582 62
+582 148
+582 156
+582 169
+582 173
+582 235
+582 243
+582 253
+582 313
+582 340
+582 422
+582 443
+582 467
+582 474
+582 477
+582 558
+582 576
+582 657
+582 678
+582 713
+582 765
+582 773
+582 778
+582 836
+582 850
+582 906
+582 920
+582 928
+582 991
+583 33
+583 37
+583 43
+583 64
+583 114
+583 121
+583 123
+583 133
+583 186
+583 216
+583 253
+583 312
+583 340
+583 344
+583 346
+583 347
+583 357
+583 383
+583 408
+583 434
+583 485
+583 572
+583 603
+583 648
+583 661
+583 838
+583 845
+583 848
+583 873
+583 964
+583 988
+583 989
+584 4
+584 91
+584 92
+584 121
+584 126
+584 137
+584 152
+584 156
+584 180
+584 194
+584 241
+584 261
+584 283
+584 322
+584 371
+584 402
+584 411
+584 417
+584 421
+584 450
+584 457
+584 462
+584 509
+584 544
+584 553
+584 602
+584 632
+584 659
+584 665
+584 668
+584 707
+584 740
+584 913
+584 968
+585 23
+585 35
+585 76
+585 89
+585 120
+585 135
+585 180
+585 193
+585 236
+585 278
+585 284
+585 326
+585 353
+585 373
+585 432
+585 463
+585 487
+585 489
+585 497
+585 500
+585 537
+585 567
+585 574
+585 635
+585 718
+585 784
+585 797
+585 878
+585 885
+585 917
+585 964
+585 996
+585 1016
+586 2
+586 21
+586 60
+586 70
+586 123
+586 150
+586 191
+586 224
+586 291
+586 329
+586 412
+586 426
+586 505
+586 506
+586 531
+586 549
+586 554
+586 559
+586 566
+586 597
+586 683
+586 702
+586 753
+586 824
+586 845
+586 848
+586 849
+586 859
+586 863
+586 887
+586 892
+586 919
+586 942
+586 951
+586 978
+586 1023
+587 24
+587 57
+587 68
+587 119
+587 163
+587 217
+587 218
+587 223
+587 238
+587 277
+587 449
+587 463
+587 509
+587 532
+587 564
+587 602
+587 656
+587 665
+587 715
+587 720
+587 756
+587 759
+587 760
+587 805
+587 817
+587 879
+587 916
+587 922
+587 949
+587 974
+587 1008
+587 1017
+588 93
+588 160
+588 207
+588 245
+588 250
+588 311
+588 313
+588 358
+588 364
+588 375
+588 422
+588 429
+588 465
+588 547
+588 614
+588 629
+588 652
+588 666
+588 680
+588 719
+588 721
+588 725
+588 727
+588 766
+588 787
+588 794
+588 819
+588 893
+588 896
+588 940
+588 963
+588 1004
+588 1009
+589 0
+589 13
+589 20
+589 104
+589 151
+589 158
+589 172
+589 193
+589 199
+589 250
+589 253
+589 373
+589 385
+589 435
+589 444
+589 450
+589 493
+589 500
+589 509
+589 554
+589 591
+589 623
+589 648
+589 656
+589 670
+589 694
+589 748
+589 786
+589 849
+589 865
+589 876
+589 887
+589 900
+589 949
+590 2
+590 31
+590 35
+590 52
+590 137
+590 163
+590 218
+590 225
+590 234
+590 250
+590 269
+590 285
+590 325
+590 393
+590 451
+590 464
+590 525
+590 553
+590 557
+590 575
+590 581
+590 671
+590 674
+590 678
+590 718
+590 809
+590 836
+590 847
+590 849
+590 894
+590 905
+590 923
+590 925
+590 954
+590 967
+590 1005
+590 1018
+591 180
+591 216
+591 233
+591 258
+591 307
+591 329
+591 391
+591 535
+591 545
+591 589
+591 620
+591 659
+591 663
+591 717
+591 736
+591 754
+591 774
+591 797
+591 816
+591 826
+591 837
+591 873
+591 883
+591 919
+591 1006
+592 45
+592 50
+592 80
+592 103
+592 141
+592 244
+592 272
+592 275
+592 359
+592 397
+592 403
+592 408
+592 423
+592 460
+592 474
+592 527
+592 544
+592 550
+592 561
+592 642
+592 671
+592 688
+592 689
+592 710
+592 732
+592 739
+592 796
+592 811
+592 842
+592 865
+592 878
+592 880
+592 928
+592 977
+592 982
+593 86
+593 124
+593 129
+593 143
+593 156
+593 157
+593 158
+593 175
+593 208
+593 212
+593 242
+593 301
+593 307
+593 312
+593 355
+593 362
+593 374
+593 385
+593 407
+593 408
+593 422
+593 512
+593 655
+593 664
+593 760
+593 762
+593 775
+593 809
+593 820
+593 852
+593 853
+593 960
+593 963
+593 987
+594 2
+594 11
+594 31
+594 82
+594 169
+594 180
+594 189
+594 190
+594 210
+594 240
+594 253
+594 254
+594 305
+594 307
+594 347
+594 368
+594 373
+594 381
+594 393
+594 412
+594 451
+594 497
+594 509
+594 513
+594 562
+594 628
+594 633
+594 637
+594 656
+594 661
+594 740
+594 808
+594 819
+594 868
+594 923
+594 935
+594 944
+594 958
+594 1000
+594 1014
+595 1
+595 25
+595 29
+595 123
+595 168
+595 169
+595 192
+595 213
+595 222
+595 247
+595 262
+595 267
+595 353
+595 419
+595 489
+595 502
+595 551
+595 555
+595 625
+595 638
+595 647
+595 671
+595 736
+595 760
+595 889
+595 901
+595 910
+595 919
+595 947
+595 970
+595 983
+595 1005
+596 12
+596 73
+596 85
+596 100
+596 122
+596 229
+596 237
+596 239
+596 311
+596 358
+596 364
+596 420
+596 473
+596 490
+596 555
+596 569
+596 630
+596 634
+596 676
+596 697
+596 705
+596 783
+596 790
+596 806
+596 817
+596 850
+596 893
+596 904
+596 908
+597 9
+597 35
+597 42
+597 47
+597 119
+597 124
+597 145
+597 158
+597 182
+597 245
+597 261
+597 324
+597 332
+597 510
+597 536
+597 553
+597 573
+597 586
+597 624
+597 629
+597 670
+597 697
+597 781
+597 820
+597 888
+597 985
+598 52
+598 114
+598 184
+598 277
+598 283
+598 314
+598 339
+598 361
+598 387
+598 415
+598 494
+598 547
+598 551
+598 600
+598 637
+598 657
+598 661
+598 664
+598 674
+598 682
+598 710
+598 723
+598 731
+598 733
+598 747
+598 788
+598 797
+598 841
+598 862
+598 901
+598 905
+598 910
+598 950
+599 29
+599 44
+599 61
+599 177
+599 183
+599 196
+599 204
+599 222
+599 225
+599 233
+599 234
+599 245
+599 267
+599 281
+599 286
+599 351
+599 482
+599 486
+599 521
+599 554
+599 568
+599 575
+599 577
+599 579
+599 620
+599 659
+599 671
+599 731
+599 733
+599 760
+599 812
+599 819
+599 863
+599 866
+599 892
+599 946
+599 948
+599 949
+599 951
+599 972
+600 42
+600 140
+600 225
+600 265
+600 311
+600 421
+600 430
+600 470
+600 521
+600 575
+600 598
+600 717
+600 732
+600 755
+600 773
+600 807
+600 817
+600 839
+600 844
+600 944
+600 955
+600 975
+600 979
+600 1002
+601 2
+601 34
+601 39
+601 108
+601 258
+601 274
+601 311
+601 318
+601 325
+601 345
+601 370
+601 408
+601 416
+601 556
+601 562
+601 675
+601 774
+601 788
+601 803
+601 814
+601 816
+601 818
+601 865
+601 962
+601 968
+602 22
+602 34
+602 75
+602 101
+602 140
+602 150
+602 170
+602 191
+602 286
+602 307
+602 311
+602 316
+602 332
+602 342
+602 359
+602 364
+602 366
+602 397
+602 467
+602 518
+602 561
+602 563
+602 584
+602 587
+602 691
+602 744
+602 751
+602 755
+602 778
+602 926
+602 983
+602 989
+602 991
+603 37
+603 118
+603 131
+603 145
+603 146
+603 148
+603 194
+603 209
+603 243
+603 259
+603 275
+603 294
+603 298
+603 317
+603 335
+603 379
+603 389
+603 426
+603 430
+603 464
+603 579
+603 583
+603 612
+603 629
+603 657
+603 673
+603 683
+603 688
+603 739
+603 803
+603 809
+603 903
+603 925
+603 978
+603 998
+603 1014
+604 0
+604 33
+604 45
+604 46
+604 69
+604 77
+604 192
+604 232
+604 240
+604 324
+604 325
+604 342
+604 358
+604 413
+604 437
+604 438
+604 519
+604 548
+604 554
+604 620
+604 640
+604 646
+604 647
+604 659
+604 691
+604 779
+604 811
+604 830
+604 900
+604 901
+604 946
+604 947
+604 975
+604 992
+604 1023
+605 8
+605 21
+605 39
+605 87
+605 113
+605 139
+605 144
+605 160
+605 203
+605 222
+605 233
+605 309
+605 319
+605 347
+605 399
+605 446
+605 537
+605 578
+605 614
+605 653
+605 675
+605 726
+605 730
+605 890
+605 897
+605 942
+605 976
+605 1017
+605 1019
+605 1023
+606 26
+606 65
+606 71
+606 89
+606 172
+606 236
+606 242
+606 244
+606 275
+606 304
+606 321
+606 363
+606 400
+606 446
+606 460
+606 467
+606 488
+606 541
+606 571
+606 826
+606 838
+606 862
+606 885
+606 897
+606 965
+606 1018
+606 1021
+606 1023
+607 42
+607 98
+607 138
+607 148
+607 226
+607 293
+607 305
+607 327
+607 402
+607 434
+607 498
+607 515
+607 530
+607 546
+607 553
+607 618
+607 629
+607 644
+607 657
+607 667
+607 698
+607 705
+607 847
+607 862
+607 877
+607 922
+607 1010
+608 7
+608 86
+608 88
+608 120
+608 132
+608 146
+608 197
+608 233
+608 255
+608 259
+608 337
+608 344
+608 351
+608 364
+608 431
+608 458
+608 462
+608 516
+608 570
+608 638
+608 640
+608 645
+608 694
+608 711
+608 732
+608 804
+608 841
+608 844
+608 869
+608 904
+608 927
+609 69
+609 96
+609 117
+609 139
+609 162
+609 182
+609 225
+609 244
+609 265
+609 267
+609 277
+609 336
+609 407
+609 432
+609 475
+609 482
+609 529
+609 565
+609 610
+609 613
+609 628
+609 659
+609 672
+609 756
+609 785
+609 846
+609 855
+609 878
+609 977
+609 985
+609 1009
+609 1022
+610 8
+610 13
+610 55
+610 134
+610 201
+610 229
+610 232
+610 281
+610 350
+610 355
+610 389
+610 430
+610 448
+610 461
+610 555
+610 563
+610 609
+610 638
+610 720
+610 737
+610 740
+610 816
+610 829
+610 831
+610 856
+610 858
+610 885
+610 902
+610 931
+610 982
+610 1010
+611 7
+611 27
+611 82
+611 89
+611 126
+611 146
+611 150
+611 180
+611 189
+611 251
+611 269
+611 291
+611 292
+611 310
+611 338
+611 392
+611 408
+611 562
+611 684
+611 706
+611 786
+611 791
+611 810
+611 812
+611 871
+611 890
+611 906
+611 953
+611 1001
+612 40
+612 106
+612 173
+612 184
+612 201
+612 207
+612 252
+612 358
+612 375
+612 386
+612 426
+612 446
+612 502
+612 504
+612 552
+612 603
+612 626
+612 687
+612 695
+612 845
+612 865
+612 879
+612 902
+612 953
+612 963
+613 1
+613 4
+613 39
+613 127
+613 148
+613 153
+613 165
+613 177
+613 206
+613 209
+613 291
+613 360
+613 366
+613 370
+613 377
+613 400
+613 422
+613 431
+613 452
+613 462
+613 496
+613 515
+613 551
+613 609
+613 639
+613 700
+613 738
+613 761
+613 847
+613 908
+613 963
+613 965
+613 987
+613 1006
+614 11
+614 24
+614 35
+614 62
+614 99
+614 120
+614 161
+614 286
+614 295
+614 372
+614 479
+614 487
+614 535
+614 588
+614 605
+614 684
+614 707
+614 735
+614 887
+614 891
+614 927
+614 962
+614 969
+614 982
+615 7
+615 34
+615 55
+615 103
+615 129
+615 141
+615 184
+615 199
+615 217
+615 229
+615 237
+615 329
+615 335
+615 391
+615 419
+615 516
+615 562
+615 632
+615 638
+615 656
+615 664
+615 798
+615 830
+615 844
+615 855
+615 860
+615 861
+615 902
+615 1010
+616 56
+616 63
+616 68
+616 84
+616 88
+616 95
+616 108
+616 234
+616 281
+616 295
+616 308
+616 310
+616 322
+616 340
+616 353
+616 356
+616 387
+616 469
+616 486
+616 488
+616 496
+616 561
+616 670
+616 733
+616 736
+616 739
+616 743
+616 749
+616 750
+616 770
+616 805
+616 813
+616 828
+616 832
+616 854
+616 875
+616 892
+616 918
+616 931
+616 953
+616 964
+616 982
+617 36
+617 66
+617 101
+617 121
+617 147
+617 160
+617 193
+617 236
+617 327
+617 578
+617 635
+617 655
+617 671
+617 674
+617 688
+617 689
+617 713
+617 750
+617 767
+617 769
+617 791
+617 797
+617 807
+617 825
+617 829
+617 853
+617 971
+617 974
+618 39
+618 63
+618 65
+618 72
+618 75
+618 149
+618 177
+618 190
+618 208
+618 278
+618 281
+618 285
+618 297
+618 313
+618 326
+618 378
+618 480
+618 526
+618 545
+618 607
+618 663
+618 669
+618 685
+618 697
+618 710
+618 770
+618 781
+618 821
+618 824
+618 830
+618 862
+618 866
+618 874
+618 895
+618 944
+618 984
+618 998
+619 29
+619 180
+619 189
+619 198
+619 207
+619 243
+619 255
+619 268
+619 297
+619 331
+619 339
+619 357
+619 405
+619 665
+619 669
+619 766
+619 770
+619 813
+619 814
+619 820
+619 856
+619 858
+619 914
+619 936
+619 968
+619 978
+619 985
+620 19
+620 27
+620 52
+620 65
+620 87
+620 178
+620 210
+620 211
+620 220
+620 291
+620 347
+620 378
+620 418
+620 432
+620 452
+620 522
+620 534
+620 552
+620 591
+620 599
+620 604
+620 630
+620 707
+620 721
+620 727
+620 746
+620 786
+620 861
+620 862
+620 901
+620 933
+620 945
+620 966
+620 994
+620 1015
+621 68
+621 85
+621 149
+621 240
+621 379
+621 391
+621 628
+621 644
+621 645
+621 716
+621 779
+621 789
+621 897
+621 900
+621 904
+621 908
+621 971
+621 1023
+622 35
+622 85
+622 108
+622 109
+622 110
+622 136
+622 152
+622 213
+622 251
+622 321
+622 325
+622 329
+622 689
+622 697
+622 782
+622 807
+622 820
+622 835
+622 837
+622 906
+622 937
+622 998
+622 1013
+623 5
+623 22
+623 24
+623 56
+623 72
+623 75
+623 92
+623 97
+623 112
+623 115
+623 181
+623 196
+623 199
+623 244
+623 277
+623 319
+623 334
+623 352
+623 363
+623 404
+623 461
+623 462
+623 465
+623 476
+623 522
+623 589
+623 628
+623 645
+623 659
+623 675
+623 696
+623 786
+623 828
+623 871
+623 906
+623 909
+623 962
+624 48
+624 102
+624 124
+624 174
+624 180
+624 194
+624 217
+624 226
+624 227
+624 261
+624 355
+624 393
+624 435
+624 456
+624 483
+624 493
+624 494
+624 496
+624 504
+624 551
+624 570
+624 597
+624 779
+624 840
+624 858
+624 881
+624 945
+624 965
+625 62
+625 69
+625 88
+625 100
+625 130
+625 160
+625 229
+625 288
+625 321
+625 392
+625 396
+625 405
+625 412
+625 488
+625 491
+625 492
+625 521
+625 541
+625 557
+625 595
+625 659
+625 704
+625 709
+625 734
+625 793
+625 820
+625 835
+625 866
+625 873
+625 876
+625 911
+625 967
+626 3
+626 56
+626 112
+626 157
+626 162
+626 166
+626 244
+626 269
+626 333
+626 334
+626 342
+626 348
+626 372
+626 390
+626 399
+626 418
+626 466
+626 469
+626 496
+626 547
+626 612
+626 654
+626 669
+626 729
+626 730
+626 733
+626 767
+626 818
+626 827
+626 851
+626 864
+626 899
+626 900
+626 949
+626 970
+626 982
+626 1014
+627 8
+627 12
+627 49
+627 73
+627 108
+627 136
+627 161
+627 175
+627 177
+627 180
+627 207
+627 301
+627 305
+627 371
+627 394
+627 416
+627 447
+627 453
+627 480
+627 522
+627 540
+627 555
+627 559
+627 636
+627 664
+627 680
+627 744
+627 747
+627 748
+627 768
+627 867
+627 891
+627 895
+627 984
+627 991
+628 37
+628 94
+628 113
+628 124
+628 181
+628 183
+628 186
+628 212
+628 214
+628 301
+628 303
+628 350
+628 356
+628 368
+628 415
+628 447
+628 454
+628 515
+628 594
+628 609
+628 621
+628 623
+628 665
+628 703
+628 747
+628 778
+628 834
+628 874
+628 888
+628 928
+628 953
+628 1021
+629 61
+629 62
+629 104
+629 159
+629 292
+629 320
+629 335
+629 360
+629 363
+629 369
+629 519
+629 588
+629 597
+629 603
+629 607
+629 640
+629 655
+629 663
+629 674
+629 807
+629 887
+629 904
+629 939
+629 980
+630 189
+630 232
+630 234
+630 260
+630 264
+630 411
+630 431
+630 438
+630 476
+630 502
+630 596
+630 620
+630 700
+630 704
+630 707
+630 709
+630 757
+630 774
+630 815
+630 864
+630 866
+630 884
+630 904
+630 923
+630 972
+630 986
+630 999
+631 7
+631 8
+631 49
+631 95
+631 104
+631 112
+631 165
+631 166
+631 179
+631 219
+631 224
+631 264
+631 339
+631 352
+631 382
+631 389
+631 401
+631 457
+631 458
+631 463
+631 478
+631 506
+631 517
+631 559
+631 669
+631 744
+631 755
+631 779
+631 800
+631 806
+631 810
+631 862
+631 875
+631 957
+631 976
+631 990
+631 998
+632 114
+632 131
+632 164
+632 174
+632 179
+632 240
+632 259
+632 279
+632 308
+632 317
+632 422
+632 503
+632 515
+632 553
+632 584
+632 615
+632 654
+632 702
+632 741
+632 746
+632 783
+632 883
+632 888
+632 941
+632 997
+632 1016
+633 14
+633 26
+633 52
+633 183
+633 192
+633 208
+633 209
+633 210
+633 230
+633 286
+633 321
+633 375
+633 419
+633 425
+633 500
+633 568
+633 579
+633 594
+633 648
+633 673
+633 692
+633 694
+633 868
+633 882
+633 888
+633 934
+633 952
+633 994
+634 18
+634 44
+634 53
+634 138
+634 145
+634 171
+634 186
+634 263
+634 297
+634 347
+634 501
+634 514
+634 524
+634 581
+634 596
+634 636
+634 710
+634 727
+634 782
+634 788
+634 803
+634 819
+634 821
+634 841
+634 848
+634 860
+634 907
+634 928
+634 967
+634 971
+634 976
+634 991
+634 1003
+634 1007
+634 1020
+635 80
+635 95
+635 177
+635 190
+635 256
+635 343
+635 347
+635 375
+635 483
+635 504
+635 506
+635 528
+635 538
+635 585
+635 617
+635 669
+635 706
+635 721
+635 760
+635 786
+635 845
+635 938
+635 940
+635 1000
+636 24
+636 30
+636 39
+636 66
+636 90
+636 182
+636 222
+636 240
+636 255
+636 273
+636 279
+636 308
+636 429
+636 436
+636 478
+636 500
+636 529
+636 530
+636 538
+636 627
+636 634
+636 641
+636 676
+636 698
+636 741
+636 799
+636 810
+636 822
+636 844
+636 861
+636 1012
+636 1017
+637 6
+637 54
+637 68
+637 153
+637 183
+637 201
+637 211
+637 217
+637 272
+637 335
+637 371
+637 455
+637 485
+637 525
+637 573
+637 594
+637 598
+637 648
+637 655
+637 690
+637 730
+637 745
+637 746
+637 772
+637 776
+637 798
+637 802
+637 841
+637 990
+638 95
+638 108
+638 133
+638 140
+638 162
+638 175
+638 326
+638 328
+638 332
+638 351
+638 370
+638 413
+638 427
+638 453
+638 530
+638 534
+638 595
+638 608
+638 610
+638 615
+638 662
+638 714
+638 754
+638 782
+638 783
+638 793
+638 813
+638 830
+638 833
+638 891
+638 912
+638 917
+638 943
+638 956
+638 960
+638 974
+638 987
+638 1003
+638 1014
+639 30
+639 70
+639 87
+639 103
+639 119
+639 129
+639 145
+639 225
+639 240
+639 273
+639 296
+639 314
+639 336
+639 352
+639 353
+639 404
+639 613
+639 651
+639 678
+639 719
+639 741
+639 759
+639 845
+639 848
+639 902
+639 919
+639 990
+639 1002
+639 1021
+640 23
+640 85
+640 103
+640 157
+640 178
+640 192
+640 221
+640 277
+640 310
+640 332
+640 339
+640 346
+640 361
+640 369
+640 381
+640 383
+640 408
+640 420
+640 431
+640 474
+640 477
+640 505
+640 515
+640 533
+640 604
+640 608
+640 629
+640 710
+640 742
+640 748
+640 761
+640 862
+640 864
+640 880
+640 891
+640 974
+640 983
+641 53
+641 119
+641 152
+641 193
+641 220
+641 230
+641 240
+641 262
+641 267
+641 295
+641 357
+641 368
+641 390
+641 397
+641 420
+641 462
+641 490
+641 493
+641 498
+641 513
+641 521
+641 532
+641 576
+641 578
+641 636
+641 642
+641 789
+641 815
+641 832
+641 851
+641 874
+641 919
+641 938
+641 973
+641 986
+641 1016
+642 25
+642 83
+642 99
+642 115
+642 125
+642 129
+642 176
+642 254
+642 271
+642 303
+642 346
+642 369
+642 403
+642 412
+642 495
+642 500
+642 571
+642 592
+642 641
+642 644
+642 693
+642 695
+642 739
+642 743
+642 844
+642 865
+642 904
+642 910
+642 979
+643 50
+643 118
+643 120
+643 154
+643 288
+643 335
+643 347
+643 379
+643 387
+643 411
+643 473
+643 487
+643 512
+643 550
+643 667
+643 702
+643 706
+643 725
+643 734
+643 762
+643 875
+643 903
+643 927
+644 14
+644 37
+644 50
+644 86
+644 149
+644 186
+644 215
+644 342
+644 353
+644 355
+644 365
+644 369
+644 393
+644 413
+644 462
+644 472
+644 495
+644 498
+644 511
+644 554
+644 607
+644 621
+644 642
+644 649
+644 673
+644 695
+644 699
+644 714
+644 753
+644 772
+644 777
+644 801
+644 821
+644 828
+644 839
+644 856
+644 917
+644 932
+644 941
+644 956
+644 958
+644 960
+644 979
+645 14
+645 46
+645 69
+645 112
+645 120
+645 130
+645 138
+645 151
+645 157
+645 160
+645 177
+645 181
+645 182
+645 205
+645 227
+645 305
+645 382
+645 456
+645 460
+645 495
+645 575
+645 608
+645 621
+645 623
+645 670
+645 676
+645 764
+645 813
+645 868
+645 944
+645 983
+645 989
+645 1003
+646 33
+646 144
+646 153
+646 210
+646 216
+646 262
+646 280
+646 302
+646 336
+646 349
+646 350
+646 396
+646 422
+646 436
+646 445
+646 463
+646 513
+646 604
+646 755
+646 894
+646 925
+646 955
+646 962
+646 964
+646 986
+646 1016
+647 29
+647 45
+647 123
+647 154
+647 169
+647 189
+647 248
+647 271
+647 335
+647 342
+647 371
+647 373
+647 380
+647 413
+647 452
+647 465
+647 526
+647 542
+647 543
+647 595
+647 604
+647 680
+647 722
+647 729
+647 778
+647 813
+647 832
+647 863
+647 885
+647 910
+647 938
+647 1017
+648 79
+648 91
+648 102
+648 116
+648 140
+648 150
+648 187
+648 189
+648 200
+648 245
+648 275
+648 287
+648 325
+648 396
+648 476
+648 492
+648 575
+648 583
+648 589
+648 633
+648 637
+648 693
+648 720
+648 726
+648 730
+648 765
+648 832
+648 857
+648 859
+648 869
+648 948
+648 981
+649 26
+649 31
+649 35
+649 70
+649 98
+649 138
+649 149
+649 290
+649 292
+649 311
+649 335
+649 343
+649 413
+649 439
+649 644
+649 655
+649 659
+649 706
+649 724
+649 727
+649 746
+649 756
+649 773
+649 783
+649 787
+649 813
+649 833
+649 842
+649 862
+649 881
+649 882
+649 888
+649 949
+649 971
+649 998
+650 25
+650 39
+650 75
+650 98
+650 102
+650 199
+650 251
+650 290
+650 294
+650 342
+650 368
+650 374
+650 410
+650 425
+650 426
+650 432
+650 451
+650 456
+650 461
+650 530
+650 536
+650 695
+650 725
+650 773
+650 831
+650 872
+650 911
+650 918
+650 921
+650 934
+650 935
+650 953
+650 973
+650 1011
+651 29
+651 82
+651 186
+651 218
+651 241
+651 263
+651 266
+651 268
+651 342
+651 358
+651 413
+651 418
+651 470
+651 504
+651 508
+651 639
+651 661
+651 672
+651 691
+651 694
+651 699
+651 734
+651 758
+651 771
+651 789
+651 801
+651 809
+651 810
+651 830
+651 837
+651 877
+651 964
+652 43
+652 64
+652 82
+652 83
+652 95
+652 161
+652 164
+652 173
+652 200
+652 212
+652 214
+652 256
+652 363
+652 398
+652 404
+652 538
+652 545
+652 563
+652 588
+652 690
+652 703
+652 734
+652 749
+652 755
+652 763
+652 805
+652 845
+652 909
+652 934
+652 956
+652 970
+653 13
+653 34
+653 48
+653 74
+653 79
+653 82
+653 127
+653 130
+653 140
+653 142
+653 148
+653 190
+653 208
+653 233
+653 234
+653 241
+653 242
+653 261
+653 269
+653 277
+653 284
+653 291
+653 340
+653 346
+653 357
+653 366
+653 383
+653 420
+653 501
+653 533
+653 549
+653 555
+653 573
+653 605
+653 835
+653 870
+653 917
+653 922
+653 975
+653 993
+653 996
+653 1007
+654 29
+654 61
+654 76
+654 153
+654 164
+654 174
+654 190
+654 202
+654 205
+654 241
+654 344
+654 347
+654 373
+654 377
+654 407
+654 458
+654 471
+654 500
+654 509
+654 626
+654 632
+654 660
+654 677
+654 698
+654 755
+654 803
+654 818
+654 827
+654 834
+654 864
+654 875
+654 908
+654 953
+654 968
+655 12
+655 18
+655 21
+655 23
+655 28
+655 53
+655 79
+655 87
+655 98
+655 107
+655 179
+655 229
+655 262
+655 283
+655 320
+655 337
+655 343
+655 351
+655 395
+655 431
+655 485
+655 548
+655 566
+655 574
+655 593
+655 617
+655 629
+655 637
+655 649
+655 705
+655 738
+655 739
+655 835
+655 917
+655 922
+655 928
+655 941
+655 949
+656 14
+656 68
+656 76
+656 91
+656 100
+656 143
+656 187
+656 278
+656 285
+656 294
+656 295
+656 318
+656 371
+656 378
+656 379
+656 408
+656 429
+656 444
+656 466
+656 496
+656 531
+656 587
+656 589
+656 594
+656 615
+656 665
+656 678
+656 691
+656 714
+656 723
+656 730
+656 734
+656 846
+656 861
+656 887
+656 897
+656 905
+656 986
+656 990
+656 1000
+657 17
+657 73
+657 137
+657 171
+657 272
+657 295
+657 308
+657 373
+657 376
+657 412
+657 417
+657 492
+657 513
+657 561
+657 582
+657 598
+657 603
+657 607
+657 662
+657 687
+657 688
+657 708
+657 741
+657 747
+657 768
+657 823
+657 842
+657 864
+657 908
+657 910
+657 939
+658 8
+658 78
+658 96
+658 171
+658 174
+658 212
+658 237
+658 241
+658 287
+658 310
+658 349
+658 414
+658 471
+658 504
+658 515
+658 525
+658 533
+658 551
+658 556
+658 560
+658 702
+658 714
+658 741
+658 780
+658 829
+658 887
+658 963
+658 1022
+659 22
+659 80
+659 142
+659 245
+659 256
+659 484
+659 512
+659 522
+659 584
+659 591
+659 599
+659 604
+659 609
+659 623
+659 625
+659 649
+659 697
+659 712
+659 861
+659 877
+659 986
+660 18
+660 80
+660 89
+660 113
+660 143
+660 153
+660 204
+660 243
+660 268
+660 310
+660 326
+660 335
+660 340
+660 426
+660 518
+660 533
+660 579
+660 654
+660 663
+660 720
+660 744
+660 765
+660 784
+660 854
+660 927
+660 982
+660 1006
+660 1007
+661 40
+661 47
+661 129
+661 138
+661 179
+661 196
+661 228
+661 260
+661 284
+661 335
+661 345
+661 386
+661 423
+661 448
+661 457
+661 488
+661 495
+661 529
+661 583
+661 594
+661 598
+661 651
+661 684
+661 708
+661 737
+661 772
+661 784
+661 786
+661 862
+661 889
+661 890
+661 922
+661 945
+661 957
+661 1009
+662 40
+662 52
+662 89
+662 90
+662 95
+662 103
+662 116
+662 142
+662 220
+662 263
+662 368
+662 371
+662 398
+662 415
+662 428
+662 460
+662 508
+662 527
+662 532
+662 563
+662 566
+662 571
+662 638
+662 657
+662 748
+662 783
+662 811
+662 823
+662 854
+662 950
+662 972
+662 1022
+663 44
+663 91
+663 99
+663 159
+663 172
+663 191
+663 246
+663 255
+663 304
+663 333
+663 370
+663 380
+663 395
+663 402
+663 414
+663 415
+663 419
+663 421
+663 442
+663 443
+663 497
+663 498
+663 517
+663 557
+663 591
+663 618
+663 629
+663 660
+663 673
+663 690
+663 692
+663 696
+663 702
+663 713
+663 714
+663 764
+663 767
+663 818
+663 839
+663 921
+663 991
+664 10
+664 62
+664 68
+664 97
+664 144
+664 175
+664 178
+664 209
+664 231
+664 253
+664 272
+664 303
+664 317
+664 340
+664 351
+664 363
+664 377
+664 503
+664 516
+664 593
+664 598
+664 615
+664 627
+664 690
+664 712
+664 713
+664 726
+664 740
+664 758
+664 780
+664 799
+664 820
+664 854
+664 872
+664 876
+664 906
+664 949
+664 951
+664 973
+664 978
+664 1010
+664 1015
+665 83
+665 110
+665 113
+665 154
+665 186
+665 218
+665 258
+665 346
+665 467
+665 468
+665 479
+665 480
+665 525
+665 540
+665 572
+665 577
+665 584
+665 587
+665 619
+665 628
+665 656
+665 670
+665 755
+665 799
+665 802
+665 877
+665 902
+665 914
+665 924
+665 925
+665 998
+666 8
+666 68
+666 125
+666 143
+666 153
+666 177
+666 320
+666 416
+666 441
+666 471
+666 511
+666 534
+666 588
+666 730
+666 760
+666 775
+666 783
+666 791
+666 792
+666 829
+666 864
+666 890
+666 900
+666 911
+666 946
+666 947
+666 979
+666 1017
+667 37
+667 52
+667 99
+667 144
+667 189
+667 206
+667 217
+667 229
+667 281
+667 351
+667 456
+667 473
+667 488
+667 524
+667 536
+667 543
+667 551
+667 573
+667 607
+667 643
+667 675
+667 677
+667 740
+667 780
+667 815
+667 869
+667 893
+667 986
+668 18
+668 95
+668 102
+668 120
+668 147
+668 149
+668 209
+668 223
+668 231
+668 254
+668 313
+668 321
+668 380
+668 447
+668 512
+668 525
+668 584
+668 715
+668 716
+668 794
+668 813
+668 814
+668 827
+668 914
+668 919
+668 932
+668 970
+668 998
+669 13
+669 35
+669 38
+669 46
+669 54
+669 67
+669 80
+669 82
+669 92
+669 125
+669 140
+669 150
+669 181
+669 244
+669 246
+669 252
+669 267
+669 268
+669 369
+669 488
+669 494
+669 526
+669 532
+669 557
+669 559
+669 618
+669 619
+669 626
+669 631
+669 635
+669 681
+669 703
+669 773
+669 834
+669 848
+669 852
+669 893
+669 899
+669 901
+669 906
+669 923
+670 31
+670 44
+670 91
+670 138
+670 190
+670 257
+670 263
+670 275
+670 291
+670 365
+670 386
+670 387
+670 401
+670 407
+670 414
+670 422
+670 431
+670 485
+670 515
+670 589
+670 597
+670 616
+670 645
+670 665
+670 687
+670 818
+670 871
+670 958
+670 981
+670 991
+671 31
+671 55
+671 67
+671 122
+671 134
+671 176
+671 231
+671 249
+671 302
+671 323
+671 357
+671 363
+671 373
+671 380
+671 446
+671 448
+671 495
+671 553
+671 557
+671 559
+671 590
+671 592
+671 595
+671 599
+671 617
+671 676
+671 691
+671 728
+671 761
+671 774
+671 802
+671 817
+671 840
+671 853
+671 866
+671 875
+671 894
+671 942
+671 996
+672 16
+672 25
+672 108
+672 230
+672 273
+672 296
+672 336
+672 342
+672 352
+672 461
+672 477
+672 562
+672 579
+672 609
+672 651
+672 684
+672 715
+672 749
+672 755
+672 767
+672 799
+672 863
+672 879
+672 889
+672 890
+672 932
+672 991
+673 68
+673 86
+673 121
+673 156
+673 184
+673 188
+673 203
+673 230
+673 233
+673 255
+673 261
+673 299
+673 311
+673 316
+673 319
+673 354
+673 363
+673 378
+673 405
+673 443
+673 462
+673 490
+673 520
+673 522
+673 526
+673 534
+673 550
+673 603
+673 633
+673 644
+673 663
+673 697
+673 703
+673 708
+673 732
+673 756
+673 800
+673 843
+673 907
+673 943
+673 971
+673 996
+674 16
+674 75
+674 177
+674 215
+674 226
+674 238
+674 253
+674 270
+674 331
+674 407
+674 590
+674 598
+674 617
+674 629
+674 679
+674 703
+674 739
+674 911
+674 976
+674 995
+674 1014
+675 10
+675 93
+675 135
+675 141
+675 148
+675 150
+675 228
+675 265
+675 391
+675 422
+675 450
+675 471
+675 601
+675 605
+675 623
+675 667
+675 701
+675 773
+675 789
+675 790
+675 832
+675 843
+675 877
+675 930
+675 934
+675 935
+675 936
+675 991
+676 13
+676 56
+676 79
+676 83
+676 97
+676 101
+676 113
+676 138
+676 144
+676 180
+676 202
+676 261
+676 274
+676 334
+676 352
+676 376
+676 454
+676 484
+676 496
+676 502
+676 504
+676 512
+676 529
+676 577
+676 596
+676 636
+676 645
+676 671
+676 731
+676 758
+676 771
+676 825
+676 908
+676 928
+676 944
+676 974
+676 1020
+676 1022
+677 25
+677 61
+677 82
+677 84
+677 85
+677 169
+677 194
+677 202
+677 265
+677 282
+677 283
+677 292
+677 294
+677 329
+677 375
+677 402
+677 406
+677 412
+677 417
+677 442
+677 477
+677 654
+677 667
+677 711
+677 714
+677 775
+677 782
+677 825
+677 919
+677 974
+677 990
+677 1020
+678 2
+678 34
+678 39
+678 43
+678 79
+678 119
+678 120
+678 157
+678 186
+678 276
+678 339
+678 345
+678 359
+678 368
+678 386
+678 390
+678 418
+678 462
+678 463
+678 578
+678 582
+678 590
+678 639
+678 656
+678 704
+678 713
+678 721
+678 736
+678 745
+678 746
+678 765
+678 853
+678 854
+678 988
+678 1005
+678 1007
+678 1015
+678 1017
+678 1021
+679 14
+679 65
+679 80
+679 135
+679 181
+679 263
+679 310
+679 313
+679 329
+679 335
+679 368
+679 418
+679 438
+679 440
+679 472
+679 477
+679 488
+679 506
+679 572
+679 580
+679 674
+679 730
+679 804
+679 806
+679 807
+679 830
+679 990
+680 9
+680 11
+680 81
+680 84
+680 97
+680 125
+680 164
+680 214
+680 239
+680 251
+680 270
+680 286
+680 400
+680 488
+680 496
+680 501
+680 588
+680 627
+680 647
+680 712
+680 725
+680 748
+680 760
+680 761
+680 801
+680 840
+680 854
+680 909
+680 918
+680 926
+680 992
+680 1003
+680 1013
+681 28
+681 37
+681 51
+681 58
+681 78
+681 121
+681 177
+681 209
+681 215
+681 274
+681 313
+681 330
+681 331
+681 338
+681 348
+681 356
+681 415
+681 424
+681 441
+681 447
+681 553
+681 669
+681 712
+681 715
+681 723
+681 724
+681 743
+681 755
+681 766
+681 803
+681 816
+681 828
+681 835
+681 916
+681 981
+681 1009
+682 32
+682 180
+682 194
+682 215
+682 333
+682 355
+682 432
+682 460
+682 579
+682 598
+682 737
+682 774
+682 809
+682 834
+682 839
+682 853
+682 987
+682 1014
+683 74
+683 90
+683 162
+683 164
+683 188
+683 350
+683 377
+683 460
+683 517
+683 586
+683 603
+683 709
+683 716
+683 723
+683 738
+683 772
+683 782
+683 803
+683 815
+683 821
+683 872
+683 878
+683 960
+683 983
+683 989
+684 85
+684 86
+684 91
+684 112
+684 125
+684 145
+684 166
+684 176
+684 200
+684 206
+684 210
+684 250
+684 274
+684 292
+684 293
+684 316
+684 326
+684 340
+684 347
+684 380
+684 399
+684 427
+684 461
+684 487
+684 525
+684 538
+684 561
+684 611
+684 614
+684 661
+684 672
+684 728
+684 778
+684 790
+684 836
+684 913
+684 952
+684 962
+684 969
+684 978
+684 995
+684 1012
+684 1013
+685 117
+685 226
+685 259
+685 314
+685 323
+685 357
+685 424
+685 537
+685 579
+685 618
+685 687
+685 716
+685 795
+685 804
+685 811
+685 815
+685 821
+685 906
+685 916
+685 918
+686 16
+686 21
+686 29
+686 58
+686 72
+686 98
+686 100
+686 130
+686 209
+686 230
+686 299
+686 330
+686 332
+686 341
+686 346
+686 352
+686 355
+686 426
+686 427
+686 438
+686 441
+686 455
+686 483
+686 487
+686 506
+686 561
+686 707
+686 719
+686 721
+686 723
+686 755
+686 800
+686 825
+686 883
+686 945
+686 976
+686 983
+687 7
+687 67
+687 70
+687 100
+687 130
+687 167
+687 201
+687 209
+687 253
+687 281
+687 319
+687 405
+687 414
+687 416
+687 430
+687 514
+687 544
+687 552
+687 554
+687 577
+687 612
+687 657
+687 670
+687 685
+687 716
+687 735
+687 781
+687 793
+687 813
+687 854
+687 874
+687 895
+687 1022
+688 103
+688 145
+688 158
+688 206
+688 260
+688 270
+688 305
+688 480
+688 484
+688 491
+688 592
+688 603
+688 617
+688 657
+688 733
+688 741
+688 782
+688 794
+688 810
+688 823
+688 852
+688 873
+688 929
+688 981
+688 1011
+689 17
+689 24
+689 67
+689 126
+689 133
+689 180
+689 296
+689 304
+689 328
+689 341
+689 396
+689 408
+689 423
+689 424
+689 435
+689 437
+689 448
+689 449
+689 536
+689 557
+689 560
+689 592
+689 617
+689 622
+689 728
+689 732
+689 737
+689 745
+689 763
+689 788
+689 794
+689 799
+689 819
+689 852
+689 908
+689 926
+689 958
+689 989
+689 1003
+689 1004
+689 1021
+690 34
+690 44
+690 47
+690 85
+690 100
+690 131
+690 155
+690 177
+690 261
+690 302
+690 343
+690 400
+690 492
+690 508
+690 520
+690 549
+690 554
+690 563
+690 637
+690 652
+690 663
+690 664
+690 697
+690 777
+690 806
+690 827
+690 884
+690 900
+690 944
+690 983
+690 987
+690 1010
+690 1022
+691 2
+691 115
+691 325
+691 353
+691 358
+691 385
+691 463
+691 467
+691 469
+691 549
+691 602
+691 604
+691 651
+691 656
+691 671
+691 697
+691 725
+691 755
+691 839
+691 841
+691 873
+691 882
+691 986
+691 1004
+692 28
+692 63
+692 255
+692 325
+692 376
+692 419
+692 420
+692 435
+692 465
+692 471
+692 546
+692 633
+692 663
+692 699
+692 745
+692 796
+692 847
+692 851
+692 859
+692 878
+692 880
+692 919
+692 930
+692 954
+692 990
+692 1003
+693 63
+693 136
+693 143
+693 162
+693 191
+693 200
+693 225
+693 235
+693 270
+693 297
+693 308
+693 349
+693 351
+693 352
+693 372
+693 389
+693 400
+693 401
+693 432
+693 446
+693 491
+693 522
+693 525
+693 547
+693 552
+693 642
+693 648
+693 711
+693 754
+693 774
+693 810
+693 852
+693 866
+693 903
+693 934
+693 971
+693 1001
+694 109
+694 120
+694 122
+694 221
+694 224
+694 258
+694 307
+694 436
+694 459
+694 566
+694 589
+694 608
+694 633
+694 651
+694 750
+694 782
+694 830
+694 848
+694 1012
+695 10
+695 26
+695 59
+695 77
+695 110
+695 129
+695 227
+695 237
+695 250
+695 259
+695 335
+695 353
+695 458
+695 508
+695 536
+695 570
+695 612
+695 642
+695 644
+695 650
+695 792
+695 855
+695 866
+695 908
+695 922
+696 32
+696 82
+696 97
+696 118
+696 127
+696 134
+696 150
+696 177
+696 225
+696 266
+696 270
+696 287
+696 372
+696 377
+696 427
+696 475
+696 493
+696 513
+696 519
+696 551
+696 555
+696 574
+696 623
+696 663
+696 709
+696 790
+696 805
+696 857
+696 871
+696 892
+696 963
+696 975
+696 987
+696 993
+697 58
+697 64
+697 99
+697 139
+697 146
+697 151
+697 210
+697 246
+697 249
+697 256
+697 258
+697 289
+697 315
+697 338
+697 403
+697 445
+697 452
+697 465
+697 532
+697 575
+697 596
+697 597
+697 618
+697 622
+697 659
+697 673
+697 690
+697 691
+697 736
+697 749
+697 791
+697 825
+697 829
+697 856
+697 886
+697 887
+697 898
+697 957
+697 959
+697 1016
+698 7
+698 65
+698 86
+698 149
+698 161
+698 185
+698 187
+698 219
+698 230
+698 260
+698 347
+698 354
+698 384
+698 433
+698 444
+698 475
+698 539
+698 551
+698 579
+698 607
+698 636
+698 654
+698 711
+698 765
+698 827
+698 832
+698 896
+698 899
+698 908
+698 910
+698 917
+698 929
+698 932
+698 939
+698 978
+698 983
+698 986
+698 1008
+699 47
+699 78
+699 86
+699 112
+699 159
+699 215
+699 362
+699 408
+699 445
+699 489
+699 529
+699 544
+699 570
+699 576
+699 644
+699 651
+699 692
+699 710
+699 786
+699 808
+699 817
+699 898
+699 908
+699 937
+700 5
+700 21
+700 40
+700 51
+700 182
+700 246
+700 247
+700 270
+700 278
+700 363
+700 373
+700 411
+700 478
+700 503
+700 506
+700 511
+700 519
+700 569
+700 613
+700 630
+700 714
+700 776
+700 811
+700 922
+700 926
+700 941
+700 945
+700 949
+701 2
+701 131
+701 137
+701 146
+701 205
+701 225
+701 242
+701 267
+701 347
+701 401
+701 412
+701 413
+701 420
+701 439
+701 443
+701 524
+701 532
+701 561
+701 566
+701 675
+701 770
+701 791
+701 816
+701 834
+701 870
+701 878
+701 886
+701 922
+701 972
+701 983
+702 37
+702 58
+702 104
+702 108
+702 144
+702 223
+702 246
+702 289
+702 331
+702 341
+702 355
+702 457
+702 525
+702 576
+702 586
+702 632
+702 643
+702 658
+702 663
+702 718
+702 747
+702 766
+702 818
+702 822
+702 845
+702 934
+702 995
+703 73
+703 144
+703 161
+703 168
+703 172
+703 191
+703 197
+703 239
+703 251
+703 333
+703 343
+703 434
+703 539
+703 628
+703 652
+703 669
+703 673
+703 674
+703 717
+703 849
+703 934
+704 35
+704 77
+704 82
+704 87
+704 89
+704 97
+704 170
+704 210
+704 281
+704 357
+704 360
+704 387
+704 388
+704 422
+704 467
+704 496
+704 507
+704 525
+704 625
+704 630
+704 678
+704 715
+704 727
+704 743
+704 746
+704 818
+704 842
+704 875
+704 900
+704 906
+704 930
+704 948
+704 957
+704 986
+705 3
+705 23
+705 25
+705 42
+705 62
+705 72
+705 78
+705 83
+705 128
+705 189
+705 262
+705 273
+705 308
+705 309
+705 340
+705 358
+705 418
+705 440
+705 523
+705 596
+705 607
+705 655
+705 732
+705 735
+705 772
+705 801
+705 834
+705 844
+705 885
+705 886
+705 892
+705 939
+705 945
+705 968
+705 973
+706 42
+706 55
+706 91
+706 130
+706 131
+706 134
+706 211
+706 255
+706 307
+706 339
+706 405
+706 447
+706 458
+706 491
+706 499
+706 513
+706 524
+706 549
+706 611
+706 635
+706 643
+706 649
+706 715
+706 717
+706 788
+706 790
+706 840
+706 843
+706 900
+706 905
+706 911
+706 917
+706 939
+706 946
+706 999
+707 45
+707 50
+707 101
+707 117
+707 145
+707 165
+707 173
+707 187
+707 226
+707 267
+707 281
+707 359
+707 430
+707 433
+707 451
+707 489
+707 494
+707 501
+707 513
+707 514
+707 518
+707 584
+707 614
+707 620
+707 630
+707 686
+707 718
+707 749
+707 762
+707 778
+707 790
+707 800
+707 826
+707 840
+707 858
+707 871
+707 893
+707 915
+707 934
+707 954
+707 980
+708 21
+708 32
+708 33
+708 38
+708 39
+708 43
+708 60
+708 72
+708 121
+708 135
+708 164
+708 247
+708 259
+708 264
+708 265
+708 291
+708 324
+708 354
+708 386
+708 472
+708 492
+708 498
+708 561
+708 657
+708 661
+708 673
+708 759
+708 771
+708 790
+708 791
+708 807
+708 812
+708 832
+708 845
+708 846
+708 859
+708 912
+708 952
+708 975
+708 995
+708 1002
+709 12
+709 31
+709 94
+709 101
+709 105
+709 176
+709 185
+709 285
+709 290
+709 355
+709 378
+709 393
+709 406
+709 412
+709 445
+709 465
+709 480
+709 498
+709 516
+709 522
+709 551
+709 625
+709 630
+709 683
+709 696
+709 741
+709 742
+709 751
+709 770
+709 811
+709 892
+709 903
+709 906
+709 984
+709 989
+709 1009
+710 17
+710 90
+710 94
+710 108
+710 122
+710 170
+710 192
+710 204
+710 227
+710 229
+710 310
+710 320
+710 379
+710 458
+710 540
+710 592
+710 598
+710 618
+710 634
+710 640
+710 699
+710 714
+710 718
+710 772
+710 778
+710 784
+710 787
+710 788
+710 821
+710 841
+710 846
+710 870
+710 899
+710 954
+710 992
+711 24
+711 71
+711 76
+711 101
+711 107
+711 108
+711 118
+711 210
+711 324
+711 344
+711 427
+711 433
+711 468
+711 514
+711 520
+711 608
+711 677
+711 693
+711 698
+711 713
+711 724
+711 812
+711 856
+711 911
+711 924
+711 966
+712 78
+712 87
+712 92
+712 178
+712 184
+712 211
+712 216
+712 277
+712 305
+712 324
+712 377
+712 384
+712 392
+712 409
+712 411
+712 422
+712 444
+712 448
+712 479
+712 489
+712 511
+712 543
+712 556
+712 565
+712 659
+712 664
+712 680
+712 681
+712 741
+712 745
+712 756
+712 775
+712 788
+712 799
+712 813
+712 817
+712 829
+712 836
+712 948
+712 986
+712 1015
+712 1018
+713 11
+713 15
+713 54
+713 83
+713 131
+713 189
+713 191
+713 212
+713 262
+713 278
+713 369
+713 382
+713 384
+713 407
+713 497
+713 578
+713 582
+713 617
+713 663
+713 664
+713 678
+713 711
+713 719
+713 738
+713 770
+713 779
+713 818
+713 832
+713 843
+713 845
+713 897
+713 912
+714 0
+714 66
+714 77
+714 88
+714 119
+714 157
+714 202
+714 225
+714 250
+714 255
+714 260
+714 306
+714 489
+714 528
+714 538
+714 638
+714 644
+714 656
+714 658
+714 663
+714 677
+714 700
+714 710
+714 758
+714 773
+714 781
+714 790
+714 802
+714 816
+714 869
+714 908
+714 947
+714 982
+714 989
+714 1023
+715 0
+715 54
+715 55
+715 72
+715 91
+715 106
+715 129
+715 140
+715 150
+715 181
+715 198
+715 206
+715 247
+715 286
+715 304
+715 314
+715 366
+715 442
+715 469
+715 490
+715 491
+715 587
+715 668
+715 672
+715 681
+715 704
+715 706
+715 718
+715 770
+715 774
+715 851
+715 863
+715 865
+715 981
+715 997
+716 11
+716 45
+716 111
+716 139
+716 201
+716 209
+716 210
+716 258
+716 317
+716 370
+716 450
+716 461
+716 492
+716 544
+716 621
+716 668
+716 683
+716 685
+716 687
+716 914
+716 930
+716 934
+716 942
+716 1016
+717 20
+717 37
+717 106
+717 115
+717 124
+717 128
+717 136
+717 143
+717 151
+717 384
+717 497
+717 504
+717 558
+717 561
+717 591
+717 600
+717 703
+717 706
+717 723
+717 729
+717 733
+717 735
+717 758
+717 821
+717 1019
+718 38
+718 54
+718 121
+718 135
+718 153
+718 179
+718 184
+718 202
+718 223
+718 292
+718 390
+718 392
+718 397
+718 476
+718 480
+718 491
+718 492
+718 508
+718 512
+718 552
+718 585
+718 590
+718 702
+718 707
+718 710
+718 715
+718 773
+718 786
+718 808
+718 821
+718 840
+718 860
+718 867
+718 897
+718 908
+718 989
+718 1006
+719 31
+719 34
+719 91
+719 199
+719 223
+719 249
+719 266
+719 274
+719 277
+719 286
+719 288
+719 297
+719 342
+719 359
+719 378
+719 414
+719 440
+719 479
+719 497
+719 524
+719 525
+719 545
+719 550
+719 575
+719 588
+719 639
+719 686
+719 713
+719 743
+719 754
+719 809
+719 823
+719 868
+719 870
+719 914
+719 919
+719 923
+719 983
+719 993
+719 1019
+720 11
+720 41
+720 58
+720 72
+720 107
+720 146
+720 190
+720 219
+720 280
+720 292
+720 347
+720 361
+720 404
+720 415
+720 521
+720 525
+720 552
+720 587
+720 610
+720 648
+720 660
+720 741
+720 746
+720 770
+720 772
+720 785
+720 799
+720 802
+720 870
+720 912
+720 916
+720 927
+720 933
+720 937
+720 951
+720 1006
+720 1017
+721 40
+721 100
+721 113
+721 120
+721 176
+721 225
+721 226
+721 242
+721 272
+721 280
+721 291
+721 318
+721 323
+721 342
+721 352
+721 356
+721 362
+721 378
+721 421
+721 434
+721 442
+721 493
+721 514
+721 553
+721 588
+721 620
+721 635
+721 678
+721 686
+721 728
+721 777
+721 835
+721 840
+721 847
+721 860
+721 867
+721 930
+721 942
+721 963
+721 972
+722 77
+722 78
+722 99
+722 131
+722 173
+722 187
+722 306
+722 354
+722 371
+722 412
+722 440
+722 536
+722 568
+722 647
+722 776
+722 805
+722 816
+722 861
+722 930
+722 964
+722 1021
+723 9
+723 110
+723 140
+723 158
+723 191
+723 231
+723 249
+723 256
+723 285
+723 369
+723 510
+723 571
+723 598
+723 656
+723 681
+723 683
+723 686
+723 717
+723 741
+723 766
+723 782
+723 783
+723 795
+723 806
+723 863
+723 948
+723 979
+723 991
+723 992
+723 1016
+723 1017
+723 1022
+724 36
+724 75
+724 115
+724 145
+724 255
+724 308
+724 338
+724 343
+724 345
+724 375
+724 384
+724 405
+724 413
+724 417
+724 418
+724 431
+724 437
+724 649
+724 681
+724 711
+724 833
+724 843
+724 881
+724 886
+724 942
+724 950
+724 962
+724 979
+724 1005
+725 9
+725 38
+725 95
+725 219
+725 222
+725 236
+725 283
+725 304
+725 325
+725 329
+725 432
+725 573
+725 588
+725 643
+725 650
+725 680
+725 691
+725 733
+725 765
+725 767
+725 777
+725 849
+725 894
+725 1005
+726 10
+726 53
+726 54
+726 99
+726 114
+726 149
+726 179
+726 195
+726 255
+726 369
+726 440
+726 442
+726 465
+726 466
+726 473
+726 477
+726 506
+726 605
+726 648
+726 664
+726 738
+726 801
+726 892
+726 937
+726 947
+727 47
+727 50
+727 84
+727 96
+727 114
+727 151
+727 178
+727 194
+727 254
+727 280
+727 299
+727 308
+727 340
+727 433
+727 440
+727 446
+727 447
+727 455
+727 460
+727 507
+727 575
+727 588
+727 620
+727 634
+727 649
+727 704
+727 759
+727 848
+727 882
+727 934
+727 942
+727 943
+727 945
+727 986
+727 994
+727 1015
+727 1022
+728 0
+728 7
+728 12
+728 119
+728 147
+728 215
+728 322
+728 325
+728 399
+728 424
+728 428
+728 433
+728 443
+728 463
+728 464
+728 475
+728 555
+728 671
+728 684
+728 689
+728 721
+728 776
+728 789
+728 828
+728 892
+728 918
+728 934
+728 949
+728 964
+728 1009
+728 1021
+729 3
+729 68
+729 74
+729 76
+729 103
+729 112
+729 179
+729 239
+729 241
+729 316
+729 354
+729 381
+729 442
+729 455
+729 481
+729 514
+729 518
+729 549
+729 556
+729 571
+729 626
+729 647
+729 717
+729 731
+729 824
+729 841
+729 847
+729 861
+729 887
+729 908
+729 952
+729 956
+729 979
+729 1008
+730 6
+730 7
+730 10
+730 23
+730 24
+730 61
+730 75
+730 175
+730 182
+730 195
+730 209
+730 220
+730 250
+730 379
+730 390
+730 423
+730 433
+730 452
+730 459
+730 477
+730 491
+730 535
+730 554
+730 580
+730 605
+730 626
+730 637
+730 648
+730 656
+730 666
+730 679
+730 749
+730 777
+730 829
+730 855
+730 861
+730 956
+730 973
+730 1000
+731 14
+731 15
+731 21
+731 22
+731 66
+731 74
+731 112
+731 122
+731 128
+731 169
+731 176
+731 177
+731 183
+731 213
+731 226
+731 243
+731 273
+731 287
+731 306
+731 333
+731 376
+731 390
+731 392
+731 459
+731 569
+731 598
+731 599
+731 676
+731 729
+731 813
+731 820
+731 826
+731 834
+731 839
+731 854
+731 884
+731 910
+731 979
+731 990
+731 997
+732 19
+732 69
+732 95
+732 129
+732 147
+732 173
+732 180
+732 204
+732 207
+732 246
+732 271
+732 288
+732 305
+732 314
+732 338
+732 342
+732 372
+732 383
+732 386
+732 441
+732 451
+732 470
+732 481
+732 482
+732 501
+732 506
+732 540
+732 592
+732 600
+732 608
+732 673
+732 689
+732 705
+732 741
+732 765
+732 771
+732 790
+732 807
+732 827
+732 852
+732 869
+732 931
+732 937
+732 948
+732 954
+732 999
+733 34
+733 39
+733 102
+733 198
+733 209
+733 212
+733 239
+733 338
+733 360
+733 375
+733 400
+733 448
+733 465
+733 485
+733 494
+733 507
+733 509
+733 527
+733 578
+733 598
+733 599
+733 616
+733 626
+733 688
+733 717
+733 725
+733 769
+733 779
+733 823
+733 908
+733 948
+734 11
+734 37
+734 49
+734 89
+734 132
+734 152
+734 179
+734 357
+734 388
+734 391
+734 423
+734 476
+734 528
+734 625
+734 643
+734 651
+734 652
+734 656
+734 766
+734 800
+734 805
+734 809
+734 815
+734 829
+734 833
+734 865
+734 869
+734 893
+734 900
+734 952
+734 970
+734 985
+734 1009
+735 2
+735 38
+735 39
+735 94
+735 120
+735 134
+735 150
+735 162
+735 244
+735 246
+735 277
+735 321
+735 400
+735 414
+735 418
+735 422
+735 487
+735 614
+735 687
+735 705
+735 717
+735 764
+735 786
+735 787
+735 862
+735 864
+735 888
+735 917
+735 966
+736 3
+736 27
+736 87
+736 133
+736 160
+736 183
+736 263
+736 271
+736 353
+736 428
+736 438
+736 531
+736 574
+736 591
+736 595
+736 616
+736 678
+736 697
+736 829
+736 834
+736 870
+736 879
+736 911
+736 929
+736 945
+736 953
+736 971
+736 1001
+736 1002
+736 1004
+737 10
+737 19
+737 74
+737 90
+737 96
+737 114
+737 117
+737 120
+737 139
+737 220
+737 311
+737 326
+737 375
+737 392
+737 415
+737 448
+737 470
+737 510
+737 511
+737 558
+737 569
+737 581
+737 610
+737 661
+737 682
+737 689
+737 739
+737 744
+737 775
+737 777
+737 855
+737 962
+737 969
+737 973
+737 976
+737 993
+737 994
+738 80
+738 100
+738 106
+738 168
+738 295
+738 308
+738 309
+738 414
+738 440
+738 452
+738 464
+738 613
+738 655
+738 683
+738 713
+738 726
+738 743
+738 758
+738 829
+738 853
+738 854
+738 894
+738 900
+738 969
+738 1007
+739 47
+739 87
+739 126
+739 127
+739 136
+739 164
+739 165
+739 212
+739 252
+739 268
+739 292
+739 308
+739 326
+739 328
+739 371
+739 406
+739 439
+739 541
+739 545
+739 546
+739 551
+739 565
+739 592
+739 603
+739 616
+739 642
+739 655
+739 674
+739 737
+739 771
+739 805
+739 861
+739 877
+739 886
+739 900
+739 968
+739 973
+739 1004
+740 16
+740 80
+740 120
+740 131
+740 132
+740 152
+740 168
+740 176
+740 185
+740 196
+740 201
+740 214
+740 215
+740 226
+740 251
+740 299
+740 320
+740 359
+740 423
+740 440
+740 504
+740 525
+740 584
+740 594
+740 610
+740 664
+740 667
+740 766
+740 853
+740 863
+740 956
+740 1000
+740 1019
+741 214
+741 220
+741 243
+741 258
+741 262
+741 294
+741 311
+741 327
+741 331
+741 339
+741 375
+741 397
+741 417
+741 429
+741 554
+741 558
+741 572
+741 632
+741 636
+741 639
+741 657
+741 658
+741 688
+741 709
+741 712
+741 720
+741 723
+741 732
+741 759
+741 804
+741 807
+741 852
+741 856
+741 865
+741 873
+741 907
+741 934
+741 942
+741 986
+742 32
+742 67
+742 136
+742 137
+742 196
+742 327
+742 364
+742 376
+742 381
+742 401
+742 406
+742 418
+742 438
+742 450
+742 484
+742 504
+742 514
+742 581
+742 640
+742 709
+742 771
+742 811
+742 847
+742 880
+742 916
+743 16
+743 31
+743 37
+743 48
+743 71
+743 109
+743 192
+743 234
+743 274
+743 307
+743 318
+743 323
+743 399
+743 469
+743 476
+743 492
+743 539
+743 616
+743 642
+743 681
+743 704
+743 719
+743 738
+743 783
+743 785
+743 807
+743 811
+743 841
+743 873
+743 912
+743 996
+744 76
+744 82
+744 97
+744 102
+744 114
+744 151
+744 163
+744 175
+744 187
+744 200
+744 223
+744 370
+744 417
+744 430
+744 444
+744 502
+744 509
+744 516
+744 530
+744 557
+744 602
+744 627
+744 631
+744 660
+744 737
+744 753
+744 762
+744 788
+744 798
+744 814
+744 825
+744 855
+744 960
+744 974
+744 1014
+745 16
+745 73
+745 90
+745 120
+745 136
+745 164
+745 189
+745 204
+745 209
+745 243
+745 253
+745 272
+745 280
+745 379
+745 422
+745 425
+745 482
+745 508
+745 525
+745 535
+745 540
+745 571
+745 637
+745 678
+745 689
+745 692
+745 712
+745 753
+745 764
+745 768
+745 774
+745 841
+745 897
+745 914
+745 931
+745 949
+745 974
+745 976
+745 993
+745 1009
+745 1016
+746 28
+746 64
+746 141
+746 158
+746 180
+746 183
+746 202
+746 204
+746 230
+746 247
+746 267
+746 299
+746 407
+746 454
+746 485
+746 569
+746 570
+746 620
+746 632
+746 637
+746 649
+746 678
+746 704
+746 720
+746 785
+746 786
+746 790
+746 822
+746 828
+746 888
+746 922
+746 1005
+747 13
+747 24
+747 55
+747 113
+747 211
+747 295
+747 312
+747 324
+747 369
+747 460
+747 476
+747 488
+747 495
+747 517
+747 546
+747 598
+747 627
+747 628
+747 657
+747 702
+747 757
+747 781
+747 814
+747 819
+747 886
+747 919
+747 976
+747 983
+748 45
+748 95
+748 101
+748 117
+748 215
+748 227
+748 282
+748 309
+748 344
+748 403
+748 491
+748 541
+748 589
+748 627
+748 640
+748 662
+748 680
+748 764
+748 768
+748 785
+748 848
+748 909
+748 944
+748 960
+748 999
+749 80
+749 92
+749 102
+749 149
+749 159
+749 274
+749 287
+749 321
+749 351
+749 369
+749 382
+749 390
+749 436
+749 472
+749 490
+749 553
+749 616
+749 652
+749 672
+749 697
+749 707
+749 730
+749 786
+749 862
+749 877
+749 896
+749 930
+749 972
+749 976
+749 978
+749 1010
+750 71
+750 123
+750 162
+750 176
+750 198
+750 459
+750 526
+750 539
+750 544
+750 571
+750 579
+750 616
+750 617
+750 694
+750 791
+750 857
+750 899
+750 911
+750 915
+750 957
+750 963
+750 978
+750 1019
+751 3
+751 37
+751 61
+751 62
+751 74
+751 80
+751 88
+751 104
+751 120
+751 131
+751 220
+751 235
+751 324
+751 331
+751 372
+751 388
+751 419
+751 499
+751 572
+751 577
+751 580
+751 602
+751 709
+751 816
+751 826
+751 884
+751 898
+751 992
+752 11
+752 40
+752 48
+752 56
+752 72
+752 80
+752 123
+752 124
+752 150
+752 151
+752 157
+752 193
+752 233
+752 268
+752 285
+752 314
+752 350
+752 426
+752 467
+752 471
+752 473
+752 758
+752 776
+752 780
+752 818
+752 836
+752 847
+752 874
+752 909
+752 936
+752 966
+753 36
+753 149
+753 167
+753 207
+753 236
+753 238
+753 285
+753 311
+753 335
+753 355
+753 372
+753 373
+753 388
+753 402
+753 411
+753 457
+753 513
+753 525
+753 576
+753 586
+753 644
+753 744
+753 745
+753 804
+753 871
+753 981
+754 71
+754 111
+754 134
+754 137
+754 264
+754 271
+754 419
+754 499
+754 557
+754 575
+754 591
+754 638
+754 693
+754 719
+754 760
+754 959
+754 967
+754 981
+754 986
+754 1016
+755 43
+755 73
+755 75
+755 129
+755 137
+755 162
+755 191
+755 219
+755 226
+755 246
+755 260
+755 265
+755 272
+755 304
+755 343
+755 366
+755 383
+755 388
+755 399
+755 430
+755 452
+755 453
+755 486
+755 497
+755 505
+755 536
+755 552
+755 565
+755 600
+755 602
+755 631
+755 646
+755 652
+755 654
+755 665
+755 672
+755 681
+755 686
+755 691
+755 956
+755 991
+755 999
+756 54
+756 76
+756 82
+756 93
+756 102
+756 114
+756 143
+756 206
+756 219
+756 222
+756 238
+756 255
+756 267
+756 285
+756 300
+756 313
+756 325
+756 378
+756 440
+756 443
+756 457
+756 460
+756 469
+756 568
+756 587
+756 609
+756 649
+756 673
+756 712
+756 850
+756 872
+756 877
+756 923
+756 932
+756 956
+756 962
+756 966
+756 990
+756 992
+757 47
+757 57
+757 76
+757 105
+757 135
+757 215
+757 261
+757 368
+757 373
+757 392
+757 442
+757 475
+757 517
+757 546
+757 564
+757 630
+757 747
+757 872
+757 884
+757 892
+757 954
+757 977
+757 1023
+758 45
+758 49
+758 104
+758 120
+758 224
+758 228
+758 244
+758 247
+758 302
+758 308
+758 420
+758 520
+758 530
+758 651
+758 664
+758 676
+758 714
+758 717
+758 738
+758 752
+758 836
+758 844
+758 968
+758 972
+758 976
+758 1007
+759 2
+759 28
+759 101
+759 198
+759 285
+759 301
+759 328
+759 364
+759 403
+759 408
+759 472
+759 478
+759 579
+759 587
+759 639
+759 708
+759 727
+759 741
+759 814
+759 907
+759 918
+759 961
+759 976
+759 982
+760 12
+760 66
+760 110
+760 129
+760 184
+760 215
+760 218
+760 254
+760 344
+760 413
+760 432
+760 491
+760 498
+760 507
+760 566
+760 587
+760 593
+760 595
+760 599
+760 635
+760 666
+760 680
+760 754
+760 788
+760 789
+760 823
+760 893
+760 914
+760 931
+760 980
+761 6
+761 79
+761 111
+761 181
+761 222
+761 283
+761 309
+761 342
+761 353
+761 401
+761 480
+761 483
+761 520
+761 613
+761 640
+761 671
+761 680
+761 764
+761 786
+761 826
+761 833
+761 852
+761 861
+761 876
+761 903
+761 976
+761 1015
+762 61
+762 77
+762 86
+762 92
+762 136
+762 192
+762 221
+762 234
+762 254
+762 256
+762 273
+762 284
+762 294
+762 310
+762 346
+762 439
+762 448
+762 457
+762 500
+762 507
+762 533
+762 542
+762 548
+762 564
+762 579
+762 593
+762 643
+762 707
+762 744
+762 766
+762 822
+762 826
+762 886
+762 907
+762 983
+762 995
+762 1016
+763 19
+763 31
+763 96
+763 150
+763 169
+763 220
+763 228
+763 264
+763 275
+763 357
+763 359
+763 368
+763 402
+763 406
+763 414
+763 466
+763 506
+763 652
+763 689
+763 765
+763 812
+763 820
+763 834
+763 838
+763 840
+763 847
+763 961
+763 1021
+764 60
+764 64
+764 76
+764 112
+764 143
+764 146
+764 205
+764 236
+764 254
+764 264
+764 330
+764 333
+764 362
+764 363
+764 373
+764 411
+764 425
+764 436
+764 439
+764 451
+764 480
+764 485
+764 504
+764 553
+764 581
+764 645
+764 663
+764 735
+764 745
+764 748
+764 761
+764 824
+764 842
+764 849
+764 955
+764 995
+764 1006
+764 1014
+764 1020
+765 82
+765 137
+765 162
+765 253
+765 280
+765 384
+765 450
+765 479
+765 489
+765 582
+765 648
+765 660
+765 678
+765 698
+765 725
+765 732
+765 763
+765 790
+765 799
+765 820
+765 827
+765 882
+765 884
+765 886
+765 950
+765 965
+765 967
+765 977
+765 989
+765 1004
+765 1009
+766 19
+766 45
+766 63
+766 75
+766 89
+766 91
+766 99
+766 121
+766 149
+766 152
+766 158
+766 186
+766 238
+766 262
+766 323
+766 385
+766 391
+766 523
+766 588
+766 619
+766 681
+766 702
+766 723
+766 734
+766 740
+766 762
+766 784
+766 794
+766 798
+766 801
+766 813
+766 983
+766 989
+767 87
+767 119
+767 138
+767 161
+767 167
+767 178
+767 184
+767 251
+767 291
+767 298
+767 326
+767 332
+767 344
+767 369
+767 379
+767 388
+767 406
+767 461
+767 522
+767 549
+767 617
+767 626
+767 663
+767 672
+767 725
+767 838
+767 864
+767 915
+767 916
+767 923
+767 931
+767 981
+767 990
+768 26
+768 66
+768 67
+768 76
+768 232
+768 241
+768 259
+768 279
+768 299
+768 312
+768 385
+768 475
+768 512
+768 529
+768 569
+768 580
+768 627
+768 657
+768 745
+768 748
+768 890
+768 910
+768 922
+768 948
+768 960
+768 975
+768 983
+768 1023
+769 18
+769 47
+769 68
+769 80
+769 85
+769 99
+769 126
+769 134
+769 205
+769 223
+769 279
+769 323
+769 335
+769 338
+769 376
+769 390
+769 467
+769 491
+769 539
+769 549
+769 559
+769 617
+769 733
+769 826
+769 831
+769 881
+770 14
+770 39
+770 95
+770 101
+770 170
+770 177
+770 191
+770 227
+770 234
+770 237
+770 274
+770 299
+770 316
+770 333
+770 377
+770 410
+770 545
+770 554
+770 576
+770 616
+770 618
+770 619
+770 701
+770 709
+770 713
+770 715
+770 720
+770 798
+770 806
+770 831
+770 833
+770 942
+770 1016
+770 1018
+771 35
+771 65
+771 80
+771 89
+771 96
+771 222
+771 254
+771 286
+771 328
+771 387
+771 422
+771 462
+771 565
+771 571
+771 580
+771 651
+771 676
+771 708
+771 732
+771 739
+771 742
+771 782
+771 784
+771 785
+771 787
+771 826
+771 830
+771 932
+771 934
+771 989
+771 1023
+772 27
+772 88
+772 94
+772 229
+772 297
+772 300
+772 374
+772 382
+772 387
+772 395
+772 412
+772 521
+772 565
+772 637
+772 644
+772 661
+772 683
+772 705
+772 710
+772 720
+772 781
+772 803
+772 804
+772 834
+772 855
+772 896
+772 928
+772 972
+773 28
+773 51
+773 78
+773 80
+773 127
+773 218
+773 250
+773 264
+773 297
+773 330
+773 486
+773 499
+773 504
+773 512
+773 536
+773 572
+773 576
+773 582
+773 600
+773 649
+773 650
+773 669
+773 675
+773 714
+773 718
+773 806
+773 845
+773 871
+773 878
+773 882
+773 923
+773 986
+773 995
+773 1014
+773 1019
+774 40
+774 84
+774 85
+774 119
+774 179
+774 235
+774 238
+774 263
+774 290
+774 321
+774 332
+774 348
+774 364
+774 369
+774 388
+774 395
+774 402
+774 461
+774 463
+774 483
+774 538
+774 556
+774 591
+774 601
+774 630
+774 671
+774 682
+774 693
+774 715
+774 745
+774 811
+774 825
+774 857
+774 868
+774 886
+774 927
+774 963
+774 993
+774 1008
+774 1015
+775 9
+775 57
+775 111
+775 148
+775 179
+775 206
+775 239
+775 261
+775 291
+775 343
+775 360
+775 367
+775 409
+775 415
+775 427
+775 464
+775 593
+775 666
+775 677
+775 712
+775 737
+775 874
+775 937
+775 967
+775 968
+775 974
+775 986
+775 1016
+776 0
+776 26
+776 53
+776 58
+776 99
+776 122
+776 123
+776 125
+776 136
+776 176
+776 183
+776 224
+776 241
+776 245
+776 345
+776 398
+776 542
+776 575
+776 637
+776 700
+776 722
+776 728
+776 752
+776 839
+776 855
+776 910
+776 911
+776 976
+776 979
+776 989
+777 3
+777 20
+777 74
+777 81
+777 89
+777 92
+777 129
+777 191
+777 197
+777 235
+777 253
+777 272
+777 290
+777 304
+777 307
+777 386
+777 422
+777 444
+777 445
+777 458
+777 523
+777 527
+777 531
+777 556
+777 644
+777 690
+777 721
+777 725
+777 730
+777 737
+777 847
+777 872
+777 878
+777 888
+777 897
+777 935
+777 954
+778 5
+778 15
+778 25
+778 121
+778 123
+778 176
+778 184
+778 196
+778 299
+778 315
+778 357
+778 378
+778 403
+778 412
+778 442
+778 450
+778 553
+778 582
+778 602
+778 628
+778 647
+778 684
+778 707
+778 710
+778 881
+778 915
+778 938
+778 976
+779 61
+779 64
+779 80
+779 89
+779 161
+779 278
+779 336
+779 356
+779 409
+779 424
+779 470
+779 604
+779 621
+779 624
+779 631
+779 713
+779 733
+779 790
+779 814
+779 815
+779 824
+779 838
+779 890
+779 901
+779 946
+779 960
+779 990
+780 37
+780 38
+780 50
+780 76
+780 87
+780 113
+780 115
+780 144
+780 154
+780 179
+780 200
+780 208
+780 233
+780 238
+780 277
+780 318
+780 368
+780 408
+780 414
+780 416
+780 461
+780 473
+780 481
+780 531
+780 658
+780 664
+780 667
+780 752
+780 786
+780 853
+780 872
+780 909
+780 925
+780 938
+780 963
+780 1013
+781 76
+781 137
+781 145
+781 159
+781 203
+781 251
+781 323
+781 418
+781 465
+781 474
+781 477
+781 559
+781 597
+781 618
+781 687
+781 714
+781 747
+781 772
+781 812
+781 830
+781 858
+781 861
+781 880
+781 910
+781 978
+781 1008
+781 1023
+782 5
+782 6
+782 27
+782 65
+782 105
+782 142
+782 150
+782 202
+782 203
+782 284
+782 310
+782 316
+782 378
+782 442
+782 532
+782 549
+782 622
+782 634
+782 638
+782 677
+782 683
+782 688
+782 694
+782 723
+782 771
+782 834
+782 874
+782 1019
+783 56
+783 160
+783 172
+783 173
+783 267
+783 279
+783 334
+783 413
+783 430
+783 446
+783 472
+783 504
+783 516
+783 551
+783 559
+783 596
+783 632
+783 638
+783 649
+783 662
+783 666
+783 723
+783 743
+783 789
+783 798
+783 799
+783 806
+783 809
+783 820
+783 855
+783 858
+783 874
+783 920
+783 993
+783 994
+783 1001
+783 1016
+784 12
+784 83
+784 250
+784 263
+784 338
+784 354
+784 386
+784 491
+784 585
+784 660
+784 661
+784 710
+784 766
+784 771
+784 822
+784 835
+784 844
+784 870
+784 871
+784 917
+784 924
+784 971
+784 976
+784 985
+784 1006
+785 11
+785 51
+785 127
+785 145
+785 163
+785 271
+785 390
+785 443
+785 500
+785 503
+785 511
+785 558
+785 609
+785 720
+785 743
+785 746
+785 748
+785 771
+785 797
+785 803
+785 831
+785 834
+785 841
+785 854
+785 863
+785 931
+785 958
+785 974
+785 985
+785 1011
+785 1017
+786 0
+786 3
+786 79
+786 81
+786 123
+786 141
+786 149
+786 164
+786 185
+786 229
+786 291
+786 315
+786 393
+786 461
+786 469
+786 478
+786 482
+786 532
+786 543
+786 550
+786 555
+786 580
+786 589
+786 611
+786 620
+786 623
+786 635
+786 661
+786 699
+786 718
+786 735
+786 746
+786 749
+786 761
+786 780
+786 787
+786 826
+786 835
+786 851
+786 949
+786 959
+786 966
+786 986
+787 3
+787 9
+787 45
+787 65
+787 98
+787 102
+787 125
+787 145
+787 171
+787 183
+787 231
+787 248
+787 290
+787 404
+787 423
+787 451
+787 467
+787 498
+787 509
+787 555
+787 570
+787 581
+787 588
+787 649
+787 710
+787 735
+787 771
+787 786
+787 819
+787 821
+787 824
+787 894
+787 901
+787 927
+787 937
+787 948
+787 988
+788 20
+788 29
+788 37
+788 38
+788 67
+788 69
+788 84
+788 94
+788 100
+788 129
+788 132
+788 220
+788 221
+788 258
+788 266
+788 338
+788 345
+788 428
+788 468
+788 471
+788 498
+788 500
+788 511
+788 572
+788 598
+788 601
+788 634
+788 689
+788 706
+788 710
+788 712
+788 744
+788 760
+788 823
+788 945
+788 948
+788 980
+788 1004
+789 15
+789 25
+789 32
+789 58
+789 78
+789 172
+789 229
+789 233
+789 248
+789 314
+789 365
+789 383
+789 447
+789 523
+789 580
+789 581
+789 621
+789 641
+789 651
+789 675
+789 728
+789 760
+789 783
+789 802
+789 804
+789 826
+789 830
+789 851
+789 915
+789 1006
+790 129
+790 133
+790 140
+790 160
+790 161
+790 185
+790 267
+790 271
+790 278
+790 300
+790 319
+790 339
+790 341
+790 353
+790 373
+790 385
+790 394
+790 408
+790 409
+790 432
+790 446
+790 447
+790 457
+790 465
+790 496
+790 566
+790 578
+790 596
+790 675
+790 684
+790 696
+790 706
+790 707
+790 708
+790 714
+790 732
+790 746
+790 765
+790 779
+790 808
+790 910
+790 948
+790 980
+791 83
+791 99
+791 128
+791 331
+791 432
+791 464
+791 468
+791 494
+791 611
+791 617
+791 666
+791 697
+791 701
+791 708
+791 750
+791 804
+791 813
+791 866
+791 881
+791 923
+791 931
+791 934
+791 999
+791 1014
+791 1016
+792 15
+792 173
+792 199
+792 249
+792 285
+792 302
+792 320
+792 349
+792 403
+792 405
+792 414
+792 426
+792 437
+792 494
+792 495
+792 500
+792 501
+792 514
+792 666
+792 695
+792 819
+792 837
+792 869
+792 882
+792 905
+792 911
+792 914
+792 952
+793 48
+793 159
+793 179
+793 263
+793 269
+793 320
+793 338
+793 356
+793 370
+793 381
+793 419
+793 450
+793 454
+793 463
+793 474
+793 479
+793 484
+793 558
+793 562
+793 625
+793 638
+793 687
+793 796
+793 815
+793 816
+793 858
+793 921
+793 925
+793 946
+793 953
+793 978
+794 25
+794 175
+794 181
+794 184
+794 212
+794 232
+794 270
+794 283
+794 327
+794 340
+794 383
+794 423
+794 462
+794 480
+794 508
+794 525
+794 538
+794 556
+794 569
+794 588
+794 668
+794 688
+794 689
+794 766
+794 813
+794 871
+794 922
+794 979
+794 988
+794 1012
+794 1021
+795 51
+795 66
+795 71
+795 111
+795 151
+795 183
+795 219
+795 229
+795 278
+795 286
+795 341
+795 437
+795 465
+795 496
+795 498
+795 529
+795 545
+795 575
+795 685
+795 723
+795 807
+795 844
+795 871
+795 902
+795 928
+795 946
+795 948
+795 975
+795 988
+796 4
+796 37
+796 40
+796 100
+796 140
+796 209
+796 233
+796 249
+796 257
+796 296
+796 297
+796 331
+796 332
+796 349
+796 381
+796 392
+796 396
+796 423
+796 437
+796 477
+796 483
+796 487
+796 556
+796 565
+796 592
+796 692
+796 793
+796 861
+796 918
+796 928
+796 959
+796 968
+796 1013
+797 14
+797 29
+797 107
+797 162
+797 260
+797 276
+797 306
+797 364
+797 366
+797 399
+797 483
+797 488
+797 578
+797 585
+797 591
+797 598
+797 617
+797 785
+797 877
+797 972
+797 979
+797 993
+797 999
+798 26
+798 65
+798 108
+798 112
+798 114
+798 144
+798 156
+798 157
+798 200
+798 203
+798 221
+798 251
+798 358
+798 368
+798 418
+798 509
+798 525
+798 560
+798 615
+798 637
+798 744
+798 766
+798 770
+798 783
+798 850
+798 862
+798 902
+798 929
+798 947
+798 975
+798 993
+798 996
+798 1002
+799 26
+799 56
+799 82
+799 119
+799 161
+799 272
+799 457
+799 482
+799 562
+799 568
+799 636
+799 664
+799 665
+799 672
+799 689
+799 712
+799 720
+799 765
+799 783
+799 803
+799 808
+799 859
+799 879
+799 890
+799 893
+799 952
+799 980
+800 25
+800 91
+800 158
+800 224
+800 245
+800 299
+800 372
+800 377
+800 379
+800 391
+800 424
+800 509
+800 631
+800 673
+800 686
+800 707
+800 734
+800 827
+800 843
+800 853
+800 859
+800 921
+800 973
+801 5
+801 10
+801 19
+801 21
+801 37
+801 109
+801 117
+801 122
+801 167
+801 186
+801 236
+801 246
+801 305
+801 329
+801 400
+801 411
+801 417
+801 519
+801 644
+801 651
+801 680
+801 705
+801 726
+801 766
+801 815
+801 904
+801 920
+801 930
+801 969
+801 1002
+801 1015
+802 73
+802 124
+802 227
+802 241
+802 278
+802 309
+802 312
+802 327
+802 329
+802 408
+802 445
+802 451
+802 465
+802 637
+802 665
+802 671
+802 714
+802 720
+802 789
+802 831
+802 863
+802 892
+802 946
+802 948
+802 970
+802 971
+802 999
+802 1007
+802 1018
+803 20
+803 38
+803 62
+803 73
+803 82
+803 139
+803 151
+803 161
+803 215
+803 250
+803 254
+803 272
+803 290
+803 315
+803 319
+803 351
+803 364
+803 381
+803 407
+803 425
+803 502
+803 558
+803 563
+803 581
+803 601
+803 603
+803 634
+803 654
+803 681
+803 683
+803 772
+803 785
+803 799
+803 897
+803 908
+803 911
+803 973
+803 977
+803 1001
+803 1009
+804 57
+804 60
+804 69
+804 84
+804 135
+804 341
+804 353
+804 379
+804 381
+804 486
+804 551
+804 559
+804 608
+804 679
+804 685
+804 741
+804 753
+804 772
+804 789
+804 791
+804 842
+804 913
+804 965
+804 975
+804 998
+805 25
+805 44
+805 51
+805 67
+805 79
+805 164
+805 258
+805 367
+805 375
+805 379
+805 414
+805 464
+805 506
+805 523
+805 558
+805 573
+805 587
+805 616
+805 652
+805 696
+805 722
+805 734
+805 739
+805 835
+805 852
+805 875
+805 922
+805 926
+805 997
+805 1021
+806 1
+806 40
+806 71
+806 78
+806 102
+806 104
+806 106
+806 109
+806 112
+806 129
+806 134
+806 158
+806 168
+806 188
+806 201
+806 212
+806 355
+806 372
+806 418
+806 438
+806 459
+806 488
+806 556
+806 596
+806 631
+806 679
+806 690
+806 723
+806 770
+806 773
+806 783
+806 924
+806 925
+806 929
+806 1007
+806 1020
+807 15
+807 38
+807 43
+807 86
+807 113
+807 189
+807 252
+807 258
+807 281
+807 385
+807 386
+807 393
+807 406
+807 410
+807 425
+807 429
+807 438
+807 479
+807 508
+807 539
+807 546
+807 568
+807 573
+807 575
+807 600
+807 617
+807 622
+807 629
+807 679
+807 708
+807 732
+807 741
+807 743
+807 795
+807 813
+807 819
+807 843
+807 845
+807 897
+807 900
+807 918
+807 929
+807 952
+807 989
+807 1010
+808 23
+808 38
+808 82
+808 97
+808 117
+808 199
+808 244
+808 289
+808 311
+808 335
+808 370
+808 386
+808 421
+808 426
+808 461
+808 488
+808 546
+808 594
+808 699
+808 718
+808 790
+808 799
+808 821
+808 886
+808 949
+808 981
+808 1002
+809 34
+809 94
+809 96
+809 135
+809 138
+809 214
+809 249
+809 290
+809 364
+809 401
+809 450
+809 470
+809 491
+809 551
+809 590
+809 593
+809 603
+809 651
+809 682
+809 719
+809 734
+809 783
+809 814
+809 823
+809 933
+809 943
+809 997
+810 104
+810 109
+810 137
+810 150
+810 151
+810 166
+810 185
+810 199
+810 224
+810 266
+810 307
+810 376
+810 385
+810 475
+810 504
+810 522
+810 554
+810 611
+810 631
+810 636
+810 651
+810 688
+810 693
+810 814
+810 870
+810 947
+810 952
+810 998
+810 1000
+810 1009
+810 1015
+811 1
+811 49
+811 54
+811 95
+811 118
+811 161
+811 199
+811 209
+811 229
+811 249
+811 300
+811 303
+811 328
+811 329
+811 340
+811 375
+811 407
+811 409
+811 430
+811 447
+811 551
+811 592
+811 604
+811 662
+811 685
+811 700
+811 709
+811 742
+811 743
+811 774
+811 852
+811 863
+811 898
+811 915
+811 930
+811 958
+812 34
+812 43
+812 92
+812 108
+812 119
+812 167
+812 184
+812 186
+812 199
+812 207
+812 221
+812 243
+812 258
+812 314
+812 326
+812 395
+812 429
+812 475
+812 530
+812 599
+812 611
+812 708
+812 711
+812 763
+812 781
+812 827
+812 852
+812 869
+812 890
+812 925
+812 971
+812 1009
+813 50
+813 53
+813 70
+813 76
+813 84
+813 85
+813 89
+813 105
+813 140
+813 203
+813 207
+813 278
+813 301
+813 339
+813 399
+813 401
+813 416
+813 436
+813 444
+813 493
+813 519
+813 530
+813 539
+813 616
+813 619
+813 638
+813 645
+813 647
+813 649
+813 668
+813 687
+813 712
+813 731
+813 766
+813 791
+813 794
+813 807
+813 843
+813 859
+813 867
+813 939
+813 993
+813 1015
+814 6
+814 12
+814 20
+814 24
+814 29
+814 49
+814 51
+814 123
+814 164
+814 176
+814 189
+814 215
+814 236
+814 256
+814 267
+814 276
+814 290
+814 331
+814 347
+814 350
+814 395
+814 401
+814 427
+814 505
+814 551
+814 560
+814 578
+814 601
+814 619
+814 668
+814 744
+814 747
+814 759
+814 779
+814 809
+814 810
+814 866
+814 905
+814 922
+814 930
+814 997
+815 6
+815 61
+815 67
+815 149
+815 221
+815 243
+815 290
+815 313
+815 384
+815 394
+815 416
+815 451
+815 537
+815 542
+815 543
+815 558
+815 574
+815 630
+815 641
+815 667
+815 683
+815 685
+815 734
+815 779
+815 793
+815 801
+815 954
+815 1019
+816 11
+816 23
+816 106
+816 113
+816 153
+816 186
+816 202
+816 279
+816 292
+816 338
+816 432
+816 506
+816 576
+816 591
+816 601
+816 610
+816 681
+816 701
+816 714
+816 722
+816 751
+816 793
+816 819
+816 824
+816 829
+816 832
+816 835
+816 851
+816 898
+816 959
+816 999
+816 1022
+817 61
+817 91
+817 118
+817 182
+817 296
+817 385
+817 425
+817 450
+817 475
+817 554
+817 587
+817 596
+817 600
+817 671
+817 699
+817 712
+817 836
+817 852
+817 857
+817 870
+817 903
+817 957
+817 986
+817 1011
+818 124
+818 138
+818 191
+818 211
+818 261
+818 269
+818 274
+818 292
+818 327
+818 398
+818 506
+818 521
+818 564
+818 570
+818 573
+818 574
+818 601
+818 626
+818 654
+818 663
+818 670
+818 702
+818 704
+818 713
+818 752
+818 869
+818 874
+819 87
+819 206
+819 248
+819 264
+819 302
+819 350
+819 413
+819 440
+819 500
+819 506
+819 566
+819 579
+819 588
+819 594
+819 599
+819 634
+819 689
+819 747
+819 787
+819 792
+819 807
+819 816
+819 825
+819 830
+819 851
+819 858
+819 861
+819 870
+819 897
+819 993
+819 995
+820 11
+820 30
+820 39
+820 42
+820 59
+820 129
+820 171
+820 184
+820 201
+820 256
+820 378
+820 398
+820 399
+820 500
+820 511
+820 520
+820 593
+820 597
+820 619
+820 622
+820 625
+820 664
+820 731
+820 763
+820 765
+820 783
+820 858
+820 860
+820 927
+820 974
+820 976
+820 979
+820 989
+820 993
+821 3
+821 89
+821 116
+821 121
+821 156
+821 168
+821 169
+821 251
+821 312
+821 323
+821 377
+821 537
+821 618
+821 634
+821 644
+821 683
+821 685
+821 710
+821 717
+821 718
+821 787
+821 808
+821 825
+821 838
+821 866
+821 868
+821 885
+821 1000
+821 1015
+822 20
+822 52
+822 87
+822 131
+822 139
+822 185
+822 196
+822 270
+822 285
+822 313
+822 361
+822 441
+822 483
+822 496
+822 517
+822 562
+822 636
+822 702
+822 746
+822 762
+822 784
+823 12
+823 34
+823 51
+823 66
+823 73
+823 75
+823 76
+823 132
+823 170
+823 213
+823 228
+823 250
+823 252
+823 285
+823 316
+823 329
+823 383
+823 402
+823 436
+823 447
+823 509
+823 657
+823 662
+823 688
+823 719
+823 733
+823 760
+823 788
+823 809
+823 834
+823 860
+823 868
+823 916
+823 922
+823 937
+823 980
+823 996
+823 1007
+824 6
+824 17
+824 66
+824 75
+824 85
+824 95
+824 101
+824 120
+824 143
+824 145
+824 294
+824 323
+824 388
+824 390
+824 400
+824 408
+824 439
+824 459
+824 469
+824 475
+824 499
+824 521
+824 522
+824 581
+824 586
+824 618
+824 729
+824 764
+824 779
+824 787
+824 816
+824 906
+824 923
+824 976
+824 1011
+824 1023
+825 0
+825 52
+825 86
+825 106
+825 155
+825 172
+825 212
+825 238
+825 298
+825 332
+825 344
+825 348
+825 368
+825 387
+825 465
+825 482
+825 493
+825 543
+825 569
+825 571
+825 617
+825 676
+825 677
+825 686
+825 697
+825 744
+825 774
+825 819
+825 821
+825 831
+825 834
+825 881
+825 912
+826 19
+826 47
+826 79
+826 81
+826 125
+826 161
+826 164
+826 167
+826 179
+826 191
+826 202
+826 259
+826 270
+826 291
+826 301
+826 313
+826 339
+826 369
+826 381
+826 407
+826 438
+826 451
+826 481
+826 501
+826 591
+826 606
+826 707
+826 731
+826 751
+826 761
+826 762
+826 769
+826 771
+826 786
+826 789
+826 828
+826 866
+826 959
+826 996
+827 62
+827 71
+827 102
+827 143
+827 164
+827 192
+827 196
+827 228
+827 286
+827 291
+827 328
+827 345
+827 355
+827 356
+827 384
+827 472
+827 510
+827 536
+827 554
+827 578
+827 626
+827 654
+827 668
+827 690
+827 698
+827 732
+827 765
+827 800
+827 812
+827 852
+827 878
+827 884
+827 896
+827 899
+827 964
+827 1019
+827 1023
+828 34
+828 40
+828 83
+828 88
+828 134
+828 136
+828 171
+828 175
+828 182
+828 184
+828 300
+828 313
+828 328
+828 347
+828 368
+828 393
+828 490
+828 565
+828 616
+828 623
+828 644
+828 681
+828 728
+828 746
+828 826
+828 919
+828 965
+828 1002
+829 46
+829 81
+829 122
+829 138
+829 154
+829 268
+829 301
+829 365
+829 378
+829 396
+829 429
+829 440
+829 453
+829 463
+829 484
+829 566
+829 610
+829 617
+829 658
+829 666
+829 697
+829 712
+829 730
+829 734
+829 736
+829 738
+829 816
+829 842
+829 844
+829 852
+829 857
+829 930
+829 944
+829 969
+829 982
+829 984
+829 986
+829 994
+829 1005
+829 1020
+830 5
+830 24
+830 44
+830 70
+830 77
+830 90
+830 97
+830 126
+830 139
+830 145
+830 149
+830 170
+830 208
+830 222
+830 223
+830 227
+830 311
+830 411
+830 432
+830 462
+830 534
+830 561
+830 604
+830 615
+830 618
+830 638
+830 651
+830 679
+830 694
+830 771
+830 781
+830 789
+830 819
+830 835
+830 839
+830 844
+830 905
+830 966
+831 60
+831 101
+831 220
+831 257
+831 305
+831 343
+831 383
+831 415
+831 501
+831 538
+831 565
+831 571
+831 610
+831 650
+831 769
+831 770
+831 785
+831 802
+831 825
+831 841
+831 942
+831 1002
+831 1011
+832 36
+832 51
+832 132
+832 151
+832 183
+832 194
+832 212
+832 236
+832 360
+832 448
+832 456
+832 477
+832 532
+832 573
+832 576
+832 616
+832 641
+832 647
+832 648
+832 675
+832 698
+832 708
+832 713
+832 816
+832 850
+832 870
+832 890
+832 894
+832 901
+832 924
+832 941
+832 955
+832 957
+832 1010
+833 12
+833 18
+833 125
+833 144
+833 184
+833 206
+833 236
+833 237
+833 278
+833 351
+833 420
+833 425
+833 473
+833 561
+833 571
+833 638
+833 649
+833 724
+833 734
+833 761
+833 770
+833 873
+833 879
+833 900
+833 938
+833 992
+834 23
+834 43
+834 63
+834 115
+834 119
+834 206
+834 239
+834 277
+834 339
+834 345
+834 408
+834 415
+834 473
+834 498
+834 513
+834 581
+834 628
+834 654
+834 669
+834 682
+834 701
+834 705
+834 731
+834 736
+834 763
+834 772
+834 782
+834 785
+834 823
+834 825
+834 919
+835 6
+835 67
+835 92
+835 118
+835 149
+835 164
+835 237
+835 260
+835 287
+835 338
+835 340
+835 405
+835 406
+835 443
+835 448
+835 461
+835 504
+835 523
+835 543
+835 544
+835 622
+835 625
+835 653
+835 655
+835 681
+835 721
+835 784
+835 786
+835 805
+835 816
+835 830
+835 957
+835 977
+835 1011
+836 8
+836 24
+836 39
+836 131
+836 135
+836 140
+836 165
+836 185
+836 225
+836 237
+836 247
+836 301
+836 419
+836 421
+836 454
+836 462
+836 477
+836 537
+836 555
+836 582
+836 590
+836 684
+836 712
+836 752
+836 758
+836 817
+836 840
+836 850
+836 861
+836 880
+836 885
+836 946
+836 955
+836 993
+836 995
+836 1014
+837 62
+837 86
+837 174
+837 188
+837 196
+837 197
+837 226
+837 253
+837 273
+837 303
+837 430
+837 460
+837 466
+837 468
+837 483
+837 537
+837 557
+837 560
+837 591
+837 622
+837 651
+837 792
+837 855
+837 908
+837 935
+837 957
+837 979
+837 1013
+838 49
+838 67
+838 81
+838 111
+838 119
+838 170
+838 225
+838 326
+838 379
+838 435
+838 461
+838 521
+838 583
+838 606
+838 763
+838 767
+838 779
+838 821
+838 883
+838 908
+838 939
+838 970
+839 7
+839 30
+839 39
+839 58
+839 97
+839 104
+839 105
+839 138
+839 151
+839 154
+839 174
+839 179
+839 228
+839 283
+839 418
+839 511
+839 528
+839 564
+839 571
+839 600
+839 644
+839 663
+839 682
+839 691
+839 731
+839 776
+839 830
+839 853
+839 878
+839 886
+839 944
+839 992
+839 993
+840 23
+840 94
+840 132
+840 157
+840 200
+840 239
+840 244
+840 246
+840 291
+840 307
+840 314
+840 319
+840 336
+840 354
+840 377
+840 394
+840 401
+840 414
+840 466
+840 467
+840 475
+840 572
+840 624
+840 671
+840 680
+840 706
+840 707
+840 718
+840 721
+840 763
+840 836
+840 861
+840 878
+840 885
+840 905
+840 908
+840 931
+840 954
+840 955
+840 962
+840 997
+841 11
+841 68
+841 81
+841 112
+841 186
+841 196
+841 295
+841 343
+841 383
+841 406
+841 437
+841 444
+841 464
+841 531
+841 575
+841 579
+841 598
+841 608
+841 634
+841 637
+841 691
+841 710
+841 729
+841 743
+841 745
+841 785
+841 831
+841 874
+841 938
+841 979
+841 987
+841 1001
+842 15
+842 33
+842 41
+842 49
+842 53
+842 54
+842 103
+842 114
+842 154
+842 161
+842 214
+842 217
+842 220
+842 256
+842 295
+842 327
+842 339
+842 360
+842 374
+842 409
+842 415
+842 506
+842 577
+842 592
+842 649
+842 657
+842 704
+842 764
+842 804
+842 829
+842 880
+842 910
+842 939
+842 957
+842 1005
+843 11
+843 20
+843 36
+843 49
+843 58
+843 104
+843 137
+843 184
+843 196
+843 213
+843 216
+843 218
+843 252
+843 255
+843 292
+843 323
+843 333
+843 373
+843 461
+843 480
+843 514
+843 573
+843 673
+843 675
+843 706
+843 713
+843 724
+843 800
+843 807
+843 813
+843 1007
+844 118
+844 119
+844 132
+844 153
+844 167
+844 183
+844 221
+844 241
+844 266
+844 272
+844 277
+844 310
+844 374
+844 436
+844 477
+844 502
+844 524
+844 531
+844 557
+844 600
+844 608
+844 615
+844 636
+844 642
+844 705
+844 758
+844 784
+844 795
+844 829
+844 830
+845 32
+845 53
+845 72
+845 89
+845 217
+845 225
+845 233
+845 259
+845 322
+845 384
+845 402
+845 450
+845 459
+845 500
+845 504
+845 583
+845 586
+845 612
+845 635
+845 639
+845 652
+845 702
+845 708
+845 713
+845 773
+845 807
+845 921
+845 965
+845 1015
+846 120
+846 134
+846 142
+846 172
+846 205
+846 237
+846 291
+846 330
+846 358
+846 373
+846 402
+846 450
+846 464
+846 609
+846 656
+846 708
+846 710
+846 855
+846 927
+846 929
+846 968
+846 989
+846 1020
+847 14
+847 32
+847 35
+847 63
+847 166
+847 176
+847 182
+847 184
+847 196
+847 202
+847 226
+847 237
+847 256
+847 314
+847 389
+847 445
+847 447
+847 458
+847 517
+847 566
+847 590
+847 607
+847 613
+847 692
+847 721
+847 729
+847 742
+847 752
+847 763
+847 777
+847 859
+848 31
+848 78
+848 175
+848 199
+848 227
+848 260
+848 262
+848 351
+848 377
+848 425
+848 472
+848 482
+848 511
+848 520
+848 528
+848 583
+848 586
+848 634
+848 639
+848 669
+848 694
+848 727
+848 748
+848 878
+848 937
+848 954
+849 34
+849 56
+849 119
+849 136
+849 139
+849 248
+849 334
+849 344
+849 515
+849 516
+849 537
+849 560
+849 572
+849 586
+849 589
+849 590
+849 703
+849 725
+849 764
+849 865
+849 881
+849 954
+849 961
+850 16
+850 94
+850 151
+850 172
+850 186
+850 193
+850 222
+850 224
+850 225
+850 235
+850 236
+850 335
+850 421
+850 433
+850 446
+850 530
+850 581
+850 582
+850 596
+850 756
+850 798
+850 832
+850 836
+850 867
+850 963
+850 966
+850 996
+850 1015
+851 22
+851 77
+851 111
+851 116
+851 157
+851 181
+851 205
+851 211
+851 248
+851 268
+851 285
+851 317
+851 326
+851 357
+851 374
+851 450
+851 451
+851 453
+851 490
+851 548
+851 563
+851 567
+851 569
+851 626
+851 641
+851 692
+851 715
+851 786
+851 789
+851 816
+851 819
+851 878
+851 892
+851 916
+851 918
+851 939
+851 948
+851 976
+852 16
+852 49
+852 143
+852 179
+852 202
+852 230
+852 236
+852 270
+852 274
+852 282
+852 283
+852 285
+852 299
+852 332
+852 337
+852 361
+852 362
+852 383
+852 450
+852 493
+852 510
+852 526
+852 557
+852 593
+852 669
+852 688
+852 689
+852 693
+852 732
+852 741
+852 761
+852 805
+852 811
+852 812
+852 817
+852 827
+852 829
+852 916
+852 946
+852 976
+852 1018
+853 6
+853 13
+853 21
+853 54
+853 70
+853 83
+853 174
+853 178
+853 190
+853 200
+853 220
+853 290
+853 301
+853 309
+853 323
+853 383
+853 395
+853 467
+853 499
+853 501
+853 506
+853 509
+853 516
+853 575
+853 593
+853 617
+853 671
+853 678
+853 682
+853 738
+853 740
+853 780
+853 800
+853 839
+853 863
+853 867
+853 875
+853 876
+853 1012
+854 22
+854 26
+854 31
+854 89
+854 92
+854 113
+854 176
+854 208
+854 216
+854 223
+854 245
+854 259
+854 277
+854 306
+854 356
+854 405
+854 435
+854 498
+854 616
+854 660
+854 662
+854 664
+854 678
+854 680
+854 687
+854 731
+854 738
+854 785
+854 875
+854 893
+854 918
+854 1010
+854 1015
+855 67
+855 76
+855 99
+855 108
+855 155
+855 206
+855 209
+855 222
+855 266
+855 274
+855 280
+855 325
+855 327
+855 360
+855 434
+855 440
+855 446
+855 457
+855 497
+855 542
+855 609
+855 615
+855 695
+855 730
+855 737
+855 744
+855 772
+855 776
+855 783
+855 837
+855 846
+855 869
+855 926
+855 931
+855 936
+855 953
+855 1001
+856 1
+856 40
+856 104
+856 122
+856 166
+856 193
+856 213
+856 251
+856 271
+856 289
+856 325
+856 433
+856 487
+856 490
+856 520
+856 523
+856 535
+856 541
+856 610
+856 619
+856 644
+856 697
+856 711
+856 741
+856 874
+856 884
+856 900
+856 903
+856 913
+856 943
+856 998
+856 1020
+857 37
+857 106
+857 118
+857 141
+857 143
+857 148
+857 174
+857 190
+857 240
+857 265
+857 282
+857 285
+857 384
+857 388
+857 393
+857 405
+857 411
+857 464
+857 515
+857 519
+857 539
+857 562
+857 572
+857 648
+857 696
+857 750
+857 774
+857 817
+857 829
+857 904
+857 915
+857 927
+858 0
+858 80
+858 109
+858 133
+858 263
+858 314
+858 329
+858 365
+858 383
+858 419
+858 430
+858 518
+858 545
+858 610
+858 619
+858 624
+858 707
+858 781
+858 783
+858 793
+858 819
+858 820
+858 882
+858 926
+858 952
+858 1008
+858 1017
+859 7
+859 29
+859 69
+859 132
+859 148
+859 158
+859 199
+859 226
+859 227
+859 278
+859 311
+859 345
+859 350
+859 352
+859 354
+859 355
+859 397
+859 418
+859 455
+859 478
+859 501
+859 527
+859 533
+859 586
+859 648
+859 692
+859 708
+859 799
+859 800
+859 813
+859 847
+859 866
+859 968
+859 970
+859 976
+859 1010
+859 1016
+860 15
+860 29
+860 62
+860 76
+860 81
+860 88
+860 115
+860 203
+860 220
+860 225
+860 228
+860 274
+860 289
+860 308
+860 342
+860 345
+860 351
+860 415
+860 450
+860 453
+860 468
+860 501
+860 516
+860 615
+860 634
+860 718
+860 721
+860 820
+860 823
+860 876
+860 910
+861 0
+861 70
+861 131
+861 153
+861 270
+861 308
+861 381
+861 412
+861 434
+861 436
+861 459
+861 466
+861 483
+861 615
+861 620
+861 636
+861 656
+861 659
+861 722
+861 729
+861 730
+861 739
+861 761
+861 781
+861 796
+861 819
+861 836
+861 840
+861 883
+861 899
+861 932
+861 942
+861 1016
+862 28
+862 76
+862 119
+862 169
+862 241
+862 257
+862 269
+862 279
+862 314
+862 460
+862 514
+862 598
+862 606
+862 607
+862 618
+862 620
+862 631
+862 640
+862 649
+862 661
+862 735
+862 749
+862 798
+862 874
+862 896
+862 1015
+862 1021
+863 22
+863 112
+863 120
+863 128
+863 167
+863 181
+863 189
+863 234
+863 265
+863 360
+863 400
+863 416
+863 460
+863 502
+863 503
+863 529
+863 533
+863 535
+863 537
+863 546
+863 578
+863 586
+863 599
+863 647
+863 672
+863 715
+863 723
+863 740
+863 785
+863 802
+863 811
+863 853
+863 897
+863 900
+863 929
+863 986
+864 119
+864 127
+864 140
+864 153
+864 281
+864 313
+864 350
+864 351
+864 383
+864 395
+864 444
+864 446
+864 449
+864 528
+864 626
+864 630
+864 640
+864 654
+864 657
+864 666
+864 735
+864 767
+864 877
+864 879
+864 919
+864 934
+864 947
+864 958
+864 979
+864 984
+864 996
+864 1017
+865 35
+865 56
+865 91
+865 124
+865 177
+865 227
+865 268
+865 269
+865 274
+865 291
+865 301
+865 330
+865 335
+865 343
+865 368
+865 407
+865 509
+865 526
+865 556
+865 581
+865 589
+865 592
+865 601
+865 612
+865 642
+865 715
+865 734
+865 741
+865 849
+865 875
+865 910
+865 951
+865 983
+865 992
+865 1023
+866 3
+866 19
+866 29
+866 49
+866 101
+866 108
+866 156
+866 184
+866 216
+866 238
+866 317
+866 379
+866 406
+866 421
+866 424
+866 433
+866 435
+866 438
+866 454
+866 501
+866 522
+866 538
+866 599
+866 618
+866 625
+866 630
+866 671
+866 693
+866 695
+866 791
+866 814
+866 821
+866 826
+866 859
+866 939
+866 957
+866 966
+866 1002
+866 1013
+866 1018
+867 8
+867 10
+867 20
+867 32
+867 42
+867 45
+867 169
+867 191
+867 224
+867 230
+867 324
+867 356
+867 385
+867 418
+867 438
+867 481
+867 565
+867 574
+867 627
+867 718
+867 721
+867 813
+867 850
+867 853
+867 946
+867 992
+868 18
+868 145
+868 190
+868 200
+868 202
+868 215
+868 232
+868 283
+868 290
+868 304
+868 311
+868 325
+868 334
+868 350
+868 540
+868 594
+868 633
+868 645
+868 719
+868 774
+868 821
+868 823
+868 873
+868 920
+868 954
+868 976
+868 985
+868 1002
+868 1005
+869 10
+869 41
+869 49
+869 91
+869 194
+869 219
+869 224
+869 231
+869 270
+869 293
+869 321
+869 343
+869 356
+869 384
+869 389
+869 417
+869 441
+869 450
+869 538
+869 608
+869 648
+869 667
+869 714
+869 732
+869 734
+869 792
+869 812
+869 818
+869 855
+869 895
+869 968
+869 1005
+869 1017
+870 12
+870 63
+870 64
+870 91
+870 120
+870 221
+870 290
+870 319
+870 355
+870 362
+870 380
+870 382
+870 388
+870 500
+870 514
+870 544
+870 653
+870 701
+870 710
+870 719
+870 720
+870 736
+870 784
+870 810
+870 817
+870 819
+870 832
+870 874
+870 885
+870 909
+870 946
+870 948
+870 956
+870 963
+870 981
+870 1010
+871 0
+871 2
+871 116
+871 124
+871 181
+871 226
+871 277
+871 280
+871 320
+871 343
+871 358
+871 367
+871 373
+871 396
+871 459
+871 468
+871 478
+871 488
+871 492
+871 499
+871 611
+871 623
+871 670
+871 696
+871 707
+871 753
+871 773
+871 784
+871 794
+871 795
+871 891
+871 893
+871 946
+871 973
+871 997
+871 1020
+872 29
+872 30
+872 36
+872 41
+872 51
+872 95
+872 118
+872 141
+872 343
+872 492
+872 515
+872 650
+872 664
+872 683
+872 756
+872 757
+872 777
+872 780
+872 900
+872 907
+872 950
+873 4
+873 26
+873 31
+873 43
+873 53
+873 85
+873 137
+873 182
+873 211
+873 366
+873 413
+873 419
+873 432
+873 436
+873 479
+873 487
+873 499
+873 574
+873 583
+873 591
+873 625
+873 688
+873 691
+873 741
+873 743
+873 833
+873 868
+873 878
+873 934
+873 1021
+874 31
+874 240
+874 253
+874 257
+874 273
+874 320
+874 351
+874 353
+874 385
+874 395
+874 419
+874 432
+874 438
+874 458
+874 467
+874 492
+874 495
+874 523
+874 618
+874 628
+874 641
+874 687
+874 752
+874 775
+874 782
+874 783
+874 818
+874 841
+874 856
+874 862
+874 870
+874 914
+874 946
+874 960
+874 962
+874 978
+874 983
+874 986
+875 66
+875 79
+875 91
+875 94
+875 141
+875 187
+875 205
+875 211
+875 256
+875 261
+875 300
+875 309
+875 312
+875 347
+875 350
+875 359
+875 425
+875 438
+875 439
+875 461
+875 474
+875 478
+875 498
+875 503
+875 510
+875 577
+875 616
+875 631
+875 643
+875 654
+875 671
+875 704
+875 805
+875 853
+875 854
+875 865
+875 879
+875 881
+875 901
+875 946
+876 24
+876 26
+876 96
+876 110
+876 126
+876 130
+876 164
+876 227
+876 249
+876 300
+876 307
+876 319
+876 346
+876 391
+876 431
+876 487
+876 495
+876 506
+876 562
+876 589
+876 625
+876 664
+876 761
+876 853
+876 860
+876 945
+877 8
+877 15
+877 30
+877 98
+877 110
+877 125
+877 154
+877 394
+877 466
+877 521
+877 607
+877 651
+877 659
+877 665
+877 675
+877 739
+877 749
+877 756
+877 797
+877 864
+878 5
+878 76
+878 139
+878 189
+878 225
+878 264
+878 267
+878 285
+878 312
+878 317
+878 328
+878 344
+878 382
+878 399
+878 411
+878 480
+878 506
+878 542
+878 571
+878 585
+878 592
+878 609
+878 683
+878 692
+878 701
+878 773
+878 777
+878 827
+878 839
+878 840
+878 848
+878 851
+878 873
+878 930
+878 933
+878 950
+878 966
+879 15
+879 38
+879 61
+879 62
+879 117
+879 149
+879 160
+879 209
+879 230
+879 260
+879 286
+879 322
+879 343
+879 352
+879 353
+879 370
+879 379
+879 404
+879 411
+879 434
+879 453
+879 464
+879 502
+879 518
+879 541
+879 550
+879 573
+879 587
+879 612
+879 672
+879 736
+879 799
+879 833
+879 864
+879 875
+879 881
+879 896
+879 949
+879 950
+880 30
+880 41
+880 118
+880 150
+880 203
+880 234
+880 259
+880 301
+880 365
+880 399
+880 416
+880 471
+880 497
+880 511
+880 534
+880 592
+880 640
+880 692
+880 742
+880 781
+880 836
+880 842
+880 932
+880 949
+880 968
+880 989
+880 993
+881 28
+881 30
+881 62
+881 117
+881 183
+881 185
+881 190
+881 248
+881 326
+881 359
+881 380
+881 392
+881 401
+881 403
+881 427
+881 477
+881 480
+881 524
+881 543
+881 551
+881 624
+881 649
+881 724
+881 769
+881 778
+881 791
+881 825
+881 849
+881 875
+881 879
+881 905
+881 909
+881 942
+881 969
+881 970
+881 977
+882 3
+882 50
+882 53
+882 83
+882 96
+882 132
+882 158
+882 159
+882 173
+882 194
+882 209
+882 249
+882 268
+882 287
+882 314
+882 317
+882 379
+882 394
+882 396
+882 409
+882 495
+882 525
+882 537
+882 540
+882 544
+882 549
+882 556
+882 633
+882 649
+882 691
+882 727
+882 765
+882 773
+882 792
+882 858
+882 898
+882 907
+882 926
+882 939
+882 969
+882 989
+882 1010
+882 1015
+883 3
+883 17
+883 22
+883 61
+883 75
+883 97
+883 148
+883 192
+883 217
+883 241
+883 282
+883 287
+883 288
+883 293
+883 448
+883 497
+883 519
+883 591
+883 632
+883 686
+883 838
+883 861
+883 905
+883 950
+883 963
+883 1007
+883 1013
+884 27
+884 66
+884 100
+884 122
+884 126
+884 191
+884 205
+884 258
+884 374
+884 382
+884 383
+884 429
+884 505
+884 568
+884 579
+884 630
+884 690
+884 731
+884 751
+884 757
+884 765
+884 827
+884 856
+884 919
+884 964
+884 1015
+885 60
+885 140
+885 145
+885 184
+885 232
+885 239
+885 261
+885 287
+885 297
+885 344
+885 372
+885 383
+885 426
+885 442
+885 501
+885 554
+885 585
+885 606
+885 610
+885 647
+885 705
+885 821
+885 836
+885 840
+885 870
+885 925
+885 954
+885 990
+886 9
+886 10
+886 58
+886 70
+886 115
+886 135
+886 154
+886 177
+886 180
+886 217
+886 253
+886 264
+886 285
+886 321
+886 397
+886 405
+886 414
+886 479
+886 697
+886 701
+886 705
+886 724
+886 739
+886 747
+886 762
+886 765
+886 774
+886 808
+886 839
+886 918
+886 926
+886 938
+886 956
+886 1011
+886 1022
+887 15
+887 53
+887 81
+887 152
+887 167
+887 170
+887 172
+887 256
+887 259
+887 430
+887 455
+887 481
+887 503
+887 530
+887 581
+887 586
+887 589
+887 614
+887 629
+887 656
+887 658
+887 697
+887 729
+887 919
+887 946
+887 956
+887 995
+888 45
+888 52
+888 58
+888 118
+888 128
+888 157
+888 186
+888 206
+888 271
+888 281
+888 301
+888 323
+888 326
+888 380
+888 390
+888 446
+888 450
+888 530
+888 542
+888 553
+888 597
+888 628
+888 632
+888 633
+888 649
+888 735
+888 746
+888 777
+888 894
+888 895
+888 923
+888 924
+888 986
+888 990
+888 994
+888 1009
+889 14
+889 15
+889 35
+889 83
+889 91
+889 139
+889 169
+889 208
+889 215
+889 216
+889 223
+889 233
+889 280
+889 288
+889 324
+889 387
+889 400
+889 416
+889 436
+889 438
+889 481
+889 485
+889 502
+889 508
+889 516
+889 595
+889 661
+889 672
+889 934
+889 938
+889 950
+889 991
+890 131
+890 143
+890 164
+890 207
+890 235
+890 240
+890 249
+890 265
+890 317
+890 321
+890 343
+890 382
+890 394
+890 420
+890 506
+890 527
+890 567
+890 605
+890 611
+890 661
+890 666
+890 672
+890 768
+890 779
+890 799
+890 812
+890 832
+890 892
+890 898
+890 904
+890 907
+890 910
+890 913
+890 980
+890 981
+890 991
+891 4
+891 35
+891 104
+891 135
+891 140
+891 191
+891 225
+891 239
+891 257
+891 262
+891 279
+891 293
+891 349
+891 373
+891 386
+891 424
+891 444
+891 572
+891 614
+891 627
+891 638
+891 640
+891 871
+891 901
+891 903
+891 943
+891 1015
+892 78
+892 97
+892 125
+892 127
+892 157
+892 174
+892 189
+892 267
+892 275
+892 317
+892 368
+892 438
+892 441
+892 474
+892 534
+892 586
+892 599
+892 616
+892 696
+892 705
+892 709
+892 726
+892 728
+892 757
+892 802
+892 851
+892 890
+892 912
+892 919
+892 925
+892 935
+892 936
+893 35
+893 41
+893 51
+893 54
+893 160
+893 175
+893 208
+893 214
+893 225
+893 255
+893 328
+893 366
+893 397
+893 409
+893 438
+893 453
+893 477
+893 490
+893 514
+893 552
+893 588
+893 596
+893 667
+893 669
+893 707
+893 734
+893 760
+893 799
+893 854
+893 871
+893 926
+893 960
+893 1013
+894 0
+894 28
+894 92
+894 220
+894 308
+894 324
+894 390
+894 442
+894 455
+894 526
+894 531
+894 548
+894 564
+894 590
+894 646
+894 671
+894 725
+894 738
+894 787
+894 832
+894 888
+894 900
+894 953
+894 968
+894 1006
+894 1010
+895 6
+895 93
+895 156
+895 159
+895 198
+895 207
+895 224
+895 232
+895 247
+895 322
+895 372
+895 385
+895 430
+895 446
+895 460
+895 464
+895 517
+895 520
+895 618
+895 627
+895 687
+895 869
+895 888
+895 933
+895 949
+896 13
+896 37
+896 43
+896 47
+896 76
+896 101
+896 115
+896 222
+896 230
+896 249
+896 326
+896 335
+896 414
+896 430
+896 455
+896 475
+896 487
+896 497
+896 504
+896 551
+896 560
+896 588
+896 698
+896 749
+896 772
+896 827
+896 862
+896 879
+896 954
+896 972
+896 987
+896 1005
+897 23
+897 38
+897 60
+897 87
+897 250
+897 267
+897 269
+897 293
+897 304
+897 370
+897 472
+897 498
+897 513
+897 556
+897 567
+897 576
+897 605
+897 606
+897 621
+897 656
+897 713
+897 718
+897 745
+897 777
+897 803
+897 807
+897 819
+897 863
+897 911
+897 916
+897 935
+897 944
+898 24
+898 35
+898 78
+898 114
+898 122
+898 183
+898 220
+898 230
+898 238
+898 277
+898 293
+898 294
+898 344
+898 346
+898 383
+898 425
+898 527
+898 548
+898 565
+898 697
+898 699
+898 751
+898 811
+898 816
+898 882
+898 890
+898 939
+898 964
+898 1008
+899 25
+899 78
+899 92
+899 113
+899 125
+899 144
+899 218
+899 240
+899 390
+899 423
+899 428
+899 460
+899 467
+899 478
+899 492
+899 505
+899 521
+899 523
+899 536
+899 540
+899 543
+899 545
+899 551
+899 626
+899 669
+899 698
+899 710
+899 750
+899 827
+899 861
+899 914
+899 952
+899 1021
+900 15
+900 34
+900 88
+900 155
+900 162
+900 182
+900 184
+900 203
+900 214
+900 232
+900 273
+900 280
+900 301
+900 321
+900 326
+900 368
+900 372
+900 431
+900 433
+900 481
+900 506
+900 518
+900 556
+900 581
+900 589
+900 604
+900 621
+900 626
+900 666
+900 690
+900 704
+900 706
+900 734
+900 738
+900 739
+900 807
+900 833
+900 856
+900 863
+900 872
+900 894
+900 935
+900 939
+900 961
+901 95
+901 125
+901 159
+901 165
+901 182
+901 197
+901 208
+901 223
+901 257
+901 311
+901 330
+901 332
+901 336
+901 343
+901 372
+901 381
+901 402
+901 409
+901 419
+901 429
+901 546
+901 595
+901 598
+901 604
+901 620
+901 669
+901 779
+901 787
+901 832
+901 875
+901 891
+901 936
+901 961
+902 11
+902 21
+902 38
+902 39
+902 57
+902 115
+902 134
+902 138
+902 160
+902 206
+902 287
+902 289
+902 328
+902 341
+902 372
+902 379
+902 390
+902 424
+902 496
+902 503
+902 533
+902 610
+902 612
+902 615
+902 639
+902 665
+902 795
+902 798
+902 938
+902 950
+902 981
+903 36
+903 71
+903 93
+903 150
+903 158
+903 170
+903 210
+903 249
+903 269
+903 293
+903 330
+903 362
+903 459
+903 538
+903 539
+903 560
+903 603
+903 643
+903 693
+903 709
+903 761
+903 817
+903 856
+903 891
+903 912
+903 950
+904 4
+904 35
+904 49
+904 77
+904 88
+904 160
+904 212
+904 250
+904 323
+904 414
+904 415
+904 438
+904 454
+904 465
+904 468
+904 516
+904 596
+904 608
+904 621
+904 629
+904 630
+904 642
+904 801
+904 857
+904 890
+904 912
+904 918
+904 942
+904 1015
+905 32
+905 80
+905 141
+905 185
+905 220
+905 285
+905 299
+905 354
+905 364
+905 368
+905 398
+905 421
+905 490
+905 536
+905 590
+905 598
+905 656
+905 706
+905 792
+905 814
+905 830
+905 840
+905 881
+905 883
+905 936
+905 955
+905 962
+905 991
+905 998
+905 1008
+906 26
+906 70
+906 214
+906 222
+906 245
+906 430
+906 432
+906 460
+906 531
+906 577
+906 582
+906 611
+906 622
+906 623
+906 664
+906 669
+906 685
+906 704
+906 709
+906 824
+906 945
+906 970
+907 62
+907 90
+907 180
+907 262
+907 263
+907 275
+907 285
+907 303
+907 373
+907 396
+907 403
+907 426
+907 428
+907 469
+907 541
+907 548
+907 634
+907 673
+907 741
+907 759
+907 762
+907 872
+907 882
+907 890
+907 948
+907 966
+908 72
+908 105
+908 128
+908 134
+908 166
+908 179
+908 225
+908 289
+908 294
+908 299
+908 300
+908 302
+908 357
+908 376
+908 393
+908 395
+908 411
+908 431
+908 432
+908 493
+908 525
+908 553
+908 555
+908 566
+908 596
+908 613
+908 621
+908 654
+908 657
+908 676
+908 689
+908 695
+908 698
+908 699
+908 714
+908 718
+908 729
+908 733
+908 803
+908 837
+908 838
+908 840
+908 956
+908 979
+908 980
+909 44
+909 47
+909 48
+909 126
+909 140
+909 150
+909 218
+909 298
+909 306
+909 326
+909 353
+909 376
+909 379
+909 407
+909 463
+909 489
+909 623
+909 652
+909 680
+909 748
+909 752
+909 780
+909 870
+909 881
+909 919
+909 951
+909 957
+909 976
+909 1019
+909 1020
+910 29
+910 79
+910 133
+910 194
+910 213
+910 245
+910 252
+910 278
+910 334
+910 394
+910 407
+910 524
+910 568
+910 577
+910 595
+910 598
+910 642
+910 647
+910 657
+910 698
+910 731
+910 768
+910 776
+910 781
+910 790
+910 842
+910 860
+910 865
+910 890
+910 918
+910 932
+910 962
+910 980
+910 1022
+911 9
+911 29
+911 66
+911 72
+911 143
+911 161
+911 186
+911 233
+911 349
+911 360
+911 370
+911 390
+911 404
+911 466
+911 479
+911 485
+911 488
+911 511
+911 541
+911 625
+911 650
+911 666
+911 674
+911 706
+911 711
+911 736
+911 750
+911 776
+911 792
+911 803
+911 897
+911 963
+911 971
+911 1000
+912 2
+912 65
+912 119
+912 210
+912 222
+912 272
+912 284
+912 374
+912 398
+912 421
+912 445
+912 490
+912 542
+912 564
+912 638
+912 708
+912 713
+912 720
+912 743
+912 825
+912 892
+912 903
+912 904
+912 982
+913 44
+913 49
+913 50
+913 69
+913 80
+913 89
+913 156
+913 181
+913 190
+913 216
+913 249
+913 255
+913 267
+913 271
+913 274
+913 295
+913 303
+913 353
+913 359
+913 378
+913 476
+913 511
+913 563
+913 575
+913 584
+913 684
+913 804
+913 856
+913 890
+913 936
+913 994
+913 1022
+914 17
+914 40
+914 77
+914 188
+914 222
+914 250
+914 252
+914 336
+914 367
+914 376
+914 402
+914 414
+914 434
+914 453
+914 462
+914 483
+914 581
+914 619
+914 665
+914 668
+914 716
+914 719
+914 745
+914 760
+914 792
+914 874
+914 899
+914 941
+914 1020
+915 51
+915 62
+915 106
+915 138
+915 151
+915 159
+915 192
+915 207
+915 220
+915 223
+915 257
+915 259
+915 334
+915 369
+915 395
+915 407
+915 416
+915 420
+915 441
+915 521
+915 555
+915 707
+915 750
+915 767
+915 778
+915 789
+915 811
+915 857
+915 939
+915 948
+915 999
+916 30
+916 65
+916 69
+916 136
+916 160
+916 177
+916 207
+916 225
+916 255
+916 284
+916 303
+916 311
+916 433
+916 487
+916 494
+916 587
+916 681
+916 685
+916 720
+916 742
+916 767
+916 823
+916 851
+916 852
+916 897
+916 960
+916 989
+917 24
+917 81
+917 119
+917 131
+917 171
+917 277
+917 313
+917 315
+917 343
+917 424
+917 445
+917 459
+917 516
+917 585
+917 638
+917 644
+917 653
+917 655
+917 698
+917 706
+917 735
+917 784
+917 974
+917 988
+918 3
+918 34
+918 52
+918 77
+918 82
+918 107
+918 120
+918 122
+918 153
+918 167
+918 175
+918 202
+918 203
+918 264
+918 302
+918 326
+918 337
+918 365
+918 396
+918 424
+918 476
+918 516
+918 524
+918 535
+918 616
+918 650
+918 680
+918 685
+918 728
+918 759
+918 796
+918 807
+918 851
+918 854
+918 886
+918 904
+918 910
+918 920
+918 992
+918 1023
+919 2
+919 4
+919 9
+919 46
+919 114
+919 201
+919 217
+919 227
+919 258
+919 302
+919 384
+919 388
+919 401
+919 444
+919 445
+919 469
+919 498
+919 586
+919 591
+919 595
+919 639
+919 641
+919 668
+919 677
+919 692
+919 719
+919 747
+919 828
+919 834
+919 864
+919 884
+919 887
+919 892
+919 909
+919 982
+920 5
+920 24
+920 43
+920 83
+920 93
+920 95
+920 104
+920 119
+920 147
+920 167
+920 188
+920 192
+920 228
+920 295
+920 324
+920 344
+920 372
+920 397
+920 403
+920 453
+920 582
+920 783
+920 801
+920 868
+920 918
+920 1002
+920 1011
+921 16
+921 38
+921 45
+921 49
+921 53
+921 105
+921 160
+921 254
+921 264
+921 324
+921 377
+921 378
+921 412
+921 441
+921 474
+921 553
+921 555
+921 650
+921 663
+921 793
+921 800
+921 845
+921 954
+921 973
+921 989
+922 35
+922 55
+922 73
+922 94
+922 120
+922 124
+922 128
+922 131
+922 143
+922 151
+922 159
+922 171
+922 197
+922 199
+922 201
+922 213
+922 224
+922 255
+922 256
+922 313
+922 319
+922 336
+922 403
+922 425
+922 473
+922 479
+922 482
+922 491
+922 526
+922 539
+922 543
+922 578
+922 579
+922 587
+922 607
+922 653
+922 655
+922 661
+922 695
+922 700
+922 701
+922 746
+922 768
+922 794
+922 805
+922 814
+922 823
+922 951
+922 965
+922 999
+923 2
+923 5
+923 116
+923 131
+923 181
+923 206
+923 322
+923 324
+923 326
+923 328
+923 338
+923 405
+923 455
+923 475
+923 478
+923 484
+923 492
+923 494
+923 565
+923 590
+923 594
+923 630
+923 669
+923 719
+923 756
+923 767
+923 773
+923 791
+923 824
+923 888
+923 978
+923 1000
+924 12
+924 21
+924 46
+924 74
+924 126
+924 157
+924 159
+924 232
+924 233
+924 273
+924 305
+924 326
+924 370
+924 409
+924 436
+924 449
+924 481
+924 516
+924 530
+924 580
+924 665
+924 711
+924 784
+924 806
+924 832
+924 888
+924 929
+924 936
+924 993
+925 2
+925 12
+925 46
+925 69
+925 89
+925 149
+925 151
+925 162
+925 183
+925 222
+925 233
+925 273
+925 312
+925 327
+925 376
+925 392
+925 414
+925 440
+925 471
+925 496
+925 544
+925 590
+925 603
+925 646
+925 665
+925 780
+925 793
+925 806
+925 812
+925 885
+925 892
+925 934
+925 1020
+926 8
+926 49
+926 94
+926 120
+926 136
+926 307
+926 326
+926 333
+926 390
+926 483
+926 486
+926 521
+926 574
+926 602
+926 680
+926 689
+926 700
+926 805
+926 855
+926 858
+926 882
+926 886
+926 893
+926 929
+926 956
+926 998
+927 145
+927 147
+927 187
+927 215
+927 276
+927 279
+927 386
+927 416
+927 431
+927 452
+927 535
+927 550
+927 608
+927 614
+927 643
+927 660
+927 720
+927 774
+927 787
+927 820
+927 846
+927 857
+927 990
+927 1016
+928 9
+928 39
+928 74
+928 99
+928 116
+928 149
+928 172
+928 181
+928 197
+928 217
+928 272
+928 289
+928 290
+928 340
+928 370
+928 414
+928 426
+928 474
+928 494
+928 503
+928 515
+928 550
+928 582
+928 592
+928 628
+928 634
+928 655
+928 676
+928 772
+928 795
+928 796
+928 948
+928 954
+929 44
+929 47
+929 51
+929 61
+929 74
+929 79
+929 100
+929 114
+929 137
+929 245
+929 279
+929 308
+929 332
+929 373
+929 389
+929 390
+929 407
+929 460
+929 499
+929 509
+929 512
+929 545
+929 560
+929 568
+929 688
+929 698
+929 736
+929 798
+929 806
+929 807
+929 846
+929 863
+929 924
+929 926
+929 997
+929 1001
+929 1005
+930 34
+930 112
+930 123
+930 166
+930 228
+930 229
+930 271
+930 420
+930 462
+930 479
+930 480
+930 524
+930 675
+930 692
+930 704
+930 716
+930 721
+930 722
+930 749
+930 801
+930 811
+930 814
+930 829
+930 878
+930 952
+930 977
+931 9
+931 17
+931 27
+931 50
+931 87
+931 131
+931 170
+931 203
+931 213
+931 243
+931 323
+931 334
+931 362
+931 397
+931 442
+931 539
+931 562
+931 563
+931 610
+931 616
+931 732
+931 745
+931 760
+931 767
+931 785
+931 791
+931 840
+931 855
+931 972
+931 992
+931 1018
+932 11
+932 23
+932 69
+932 109
+932 148
+932 308
+932 398
+932 403
+932 417
+932 418
+932 499
+932 512
+932 530
+932 531
+932 644
+932 668
+932 672
+932 698
+932 756
+932 771
+932 861
+932 880
+932 910
+932 937
+932 1015
+933 39
+933 51
+933 95
+933 128
+933 139
+933 144
+933 185
+933 301
+933 313
+933 325
+933 440
+933 509
+933 513
+933 554
+933 620
+933 720
+933 809
+933 878
+933 895
+933 986
+933 1002
+934 14
+934 64
+934 98
+934 120
+934 121
+934 190
+934 218
+934 226
+934 275
+934 284
+934 296
+934 298
+934 334
+934 345
+934 361
+934 413
+934 464
+934 510
+934 536
+934 633
+934 650
+934 652
+934 675
+934 693
+934 702
+934 703
+934 707
+934 716
+934 727
+934 728
+934 741
+934 771
+934 791
+934 864
+934 873
+934 889
+934 925
+934 973
+934 985
+934 998
+935 14
+935 90
+935 96
+935 107
+935 127
+935 147
+935 170
+935 178
+935 223
+935 245
+935 254
+935 258
+935 299
+935 308
+935 351
+935 352
+935 374
+935 441
+935 483
+935 503
+935 530
+935 532
+935 544
+935 594
+935 650
+935 675
+935 777
+935 837
+935 892
+935 897
+935 900
+936 66
+936 79
+936 115
+936 150
+936 212
+936 215
+936 247
+936 250
+936 345
+936 347
+936 420
+936 428
+936 457
+936 487
+936 550
+936 619
+936 675
+936 752
+936 855
+936 892
+936 901
+936 905
+936 913
+936 924
+936 953
+936 1001
+936 1004
+937 41
+937 83
+937 157
+937 163
+937 181
+937 216
+937 219
+937 224
+937 261
+937 377
+937 381
+937 393
+937 395
+937 413
+937 419
+937 449
+937 452
+937 474
+937 622
+937 699
+937 720
+937 726
+937 732
+937 775
+937 787
+937 823
+937 848
+937 932
+937 959
+937 965
+937 972
+938 101
+938 125
+938 179
+938 196
+938 346
+938 400
+938 413
+938 429
+938 437
+938 465
+938 469
+938 472
+938 497
+938 501
+938 573
+938 579
+938 635
+938 641
+938 647
+938 778
+938 780
+938 833
+938 841
+938 886
+938 889
+938 902
+938 950
+938 957
+938 972
+939 73
+939 99
+939 111
+939 226
+939 251
+939 296
+939 340
+939 442
+939 451
+939 471
+939 491
+939 498
+939 528
+939 571
+939 629
+939 657
+939 698
+939 705
+939 706
+939 813
+939 838
+939 842
+939 851
+939 866
+939 882
+939 898
+939 900
+939 915
+939 1001
+940 12
+940 31
+940 79
+940 131
+940 195
+940 204
+940 242
+940 258
+940 272
+940 278
+940 315
+940 316
+940 320
+940 363
+940 367
+940 381
+940 388
+940 502
+940 520
+940 521
+940 572
+940 575
+940 588
+940 635
+940 966
+940 1000
+941 9
+941 73
+941 86
+941 149
+941 191
+941 313
+941 319
+941 326
+941 383
+941 454
+941 459
+941 488
+941 490
+941 493
+941 539
+941 551
+941 568
+941 632
+941 644
+941 655
+941 700
+941 832
+941 914
+941 963
+941 992
+942 30
+942 47
+942 48
+942 56
+942 76
+942 91
+942 94
+942 228
+942 239
+942 265
+942 284
+942 303
+942 382
+942 416
+942 443
+942 475
+942 486
+942 494
+942 524
+942 586
+942 605
+942 671
+942 716
+942 721
+942 724
+942 727
+942 741
+942 770
+942 831
+942 861
+942 881
+942 904
+942 950
+942 952
+942 987
+943 21
+943 29
+943 72
+943 172
+943 194
+943 229
+943 237
+943 340
+943 371
+943 425
+943 472
+943 490
+943 580
+943 638
+943 673
+943 727
+943 809
+943 856
+943 891
+943 956
+943 959
+944 64
+944 77
+944 80
+944 86
+944 147
+944 158
+944 194
+944 213
+944 268
+944 276
+944 280
+944 320
+944 335
+944 336
+944 338
+944 365
+944 410
+944 412
+944 478
+944 577
+944 594
+944 600
+944 618
+944 645
+944 676
+944 690
+944 748
+944 829
+944 839
+944 897
+944 1019
+945 32
+945 89
+945 125
+945 127
+945 135
+945 157
+945 161
+945 228
+945 230
+945 316
+945 330
+945 341
+945 563
+945 565
+945 620
+945 624
+945 661
+945 686
+945 700
+945 705
+945 727
+945 736
+945 788
+945 876
+945 906
+945 949
+945 959
+945 983
+946 15
+946 74
+946 146
+946 169
+946 187
+946 283
+946 324
+946 330
+946 357
+946 366
+946 396
+946 425
+946 442
+946 456
+946 466
+946 470
+946 485
+946 504
+946 514
+946 520
+946 566
+946 599
+946 604
+946 666
+946 706
+946 779
+946 793
+946 795
+946 802
+946 836
+946 852
+946 867
+946 870
+946 871
+946 874
+946 875
+946 887
+946 954
+946 967
+946 972
+946 996
+946 1021
+947 44
+947 91
+947 113
+947 122
+947 157
+947 170
+947 205
+947 254
+947 256
+947 283
+947 296
+947 376
+947 391
+947 392
+947 396
+947 398
+947 402
+947 412
+947 425
+947 509
+947 526
+947 556
+947 559
+947 595
+947 604
+947 666
+947 714
+947 726
+947 798
+947 810
+947 864
+947 998
+948 39
+948 80
+948 98
+948 140
+948 152
+948 153
+948 219
+948 228
+948 268
+948 306
+948 382
+948 387
+948 419
+948 467
+948 472
+948 483
+948 499
+948 509
+948 533
+948 535
+948 544
+948 549
+948 555
+948 577
+948 599
+948 648
+948 704
+948 712
+948 723
+948 732
+948 733
+948 768
+948 787
+948 788
+948 790
+948 795
+948 802
+948 851
+948 870
+948 907
+948 915
+948 928
+948 973
+948 986
+948 994
+949 72
+949 120
+949 124
+949 137
+949 166
+949 207
+949 322
+949 367
+949 368
+949 435
+949 444
+949 453
+949 487
+949 513
+949 587
+949 589
+949 599
+949 626
+949 649
+949 655
+949 664
+949 700
+949 728
+949 745
+949 786
+949 808
+949 879
+949 880
+949 895
+949 945
+949 992
+949 999
+950 27
+950 53
+950 172
+950 175
+950 192
+950 197
+950 267
+950 275
+950 287
+950 296
+950 347
+950 460
+950 598
+950 662
+950 724
+950 765
+950 872
+950 878
+950 879
+950 883
+950 889
+950 902
+950 903
+950 938
+950 942
+950 991
+950 995
+951 61
+951 68
+951 84
+951 92
+951 103
+951 124
+951 168
+951 172
+951 274
+951 294
+951 365
+951 418
+951 437
+951 519
+951 543
+951 563
+951 586
+951 599
+951 664
+951 720
+951 865
+951 909
+951 922
+951 966
+951 992
+952 36
+952 60
+952 64
+952 98
+952 192
+952 210
+952 238
+952 261
+952 268
+952 270
+952 355
+952 377
+952 410
+952 435
+952 454
+952 466
+952 497
+952 510
+952 549
+952 633
+952 684
+952 708
+952 729
+952 734
+952 792
+952 799
+952 807
+952 810
+952 858
+952 899
+952 930
+952 942
+952 969
+952 1010
+952 1016
+953 21
+953 104
+953 113
+953 121
+953 139
+953 167
+953 179
+953 181
+953 212
+953 219
+953 231
+953 256
+953 257
+953 329
+953 353
+953 383
+953 433
+953 500
+953 562
+953 611
+953 612
+953 616
+953 628
+953 650
+953 654
+953 736
+953 793
+953 855
+953 894
+953 936
+953 985
+953 1016
+954 4
+954 49
+954 50
+954 51
+954 149
+954 176
+954 228
+954 233
+954 240
+954 295
+954 338
+954 366
+954 398
+954 420
+954 425
+954 464
+954 506
+954 531
+954 590
+954 692
+954 707
+954 710
+954 732
+954 757
+954 777
+954 815
+954 840
+954 848
+954 849
+954 868
+954 885
+954 896
+954 921
+954 928
+954 946
+954 966
+954 989
+955 13
+955 31
+955 37
+955 38
+955 67
+955 94
+955 158
+955 194
+955 201
+955 218
+955 236
+955 241
+955 345
+955 365
+955 369
+955 397
+955 417
+955 600
+955 646
+955 764
+955 832
+955 836
+955 840
+955 905
+955 998
+956 115
+956 128
+956 146
+956 152
+956 167
+956 185
+956 235
+956 240
+956 279
+956 288
+956 291
+956 310
+956 322
+956 424
+956 430
+956 445
+956 464
+956 472
+956 488
+956 580
+956 638
+956 644
+956 652
+956 729
+956 730
+956 740
+956 755
+956 756
+956 870
+956 886
+956 887
+956 908
+956 926
+956 943
+956 961
+956 1016
+956 1019
+957 17
+957 22
+957 31
+957 41
+957 77
+957 86
+957 90
+957 126
+957 141
+957 167
+957 269
+957 311
+957 318
+957 330
+957 348
+957 379
+957 429
+957 459
+957 476
+957 530
+957 631
+957 661
+957 697
+957 704
+957 750
+957 817
+957 832
+957 835
+957 837
+957 842
+957 866
+957 909
+957 938
+958 3
+958 32
+958 40
+958 81
+958 115
+958 148
+958 163
+958 220
+958 226
+958 237
+958 269
+958 272
+958 288
+958 295
+958 318
+958 319
+958 324
+958 358
+958 410
+958 413
+958 434
+958 462
+958 514
+958 555
+958 573
+958 594
+958 644
+958 670
+958 689
+958 785
+958 811
+958 864
+958 981
+958 1011
+959 17
+959 62
+959 135
+959 154
+959 161
+959 167
+959 209
+959 213
+959 299
+959 304
+959 309
+959 310
+959 390
+959 395
+959 422
+959 426
+959 478
+959 497
+959 506
+959 533
+959 535
+959 551
+959 579
+959 697
+959 754
+959 786
+959 796
+959 816
+959 826
+959 937
+959 943
+959 945
+959 964
+959 1015
+960 8
+960 51
+960 56
+960 69
+960 109
+960 157
+960 174
+960 183
+960 230
+960 283
+960 291
+960 311
+960 317
+960 335
+960 389
+960 419
+960 490
+960 528
+960 570
+960 593
+960 638
+960 644
+960 683
+960 744
+960 748
+960 768
+960 779
+960 874
+960 893
+960 916
+960 964
+960 1001
+961 8
+961 36
+961 55
+961 200
+961 211
+961 244
+961 245
+961 251
+961 288
+961 290
+961 420
+961 454
+961 482
+961 551
+961 759
+961 763
+961 849
+961 900
+961 901
+961 956
+961 976
+962 3
+962 52
+962 76
+962 77
+962 131
+962 210
+962 237
+962 240
+962 307
+962 308
+962 326
+962 342
+962 362
+962 469
+962 601
+962 614
+962 623
+962 646
+962 684
+962 724
+962 737
+962 756
+962 840
+962 874
+962 905
+962 910
+962 1014
+962 1021
+963 31
+963 63
+963 78
+963 90
+963 161
+963 188
+963 201
+963 223
+963 238
+963 342
+963 358
+963 387
+963 424
+963 447
+963 489
+963 496
+963 521
+963 588
+963 593
+963 612
+963 613
+963 658
+963 696
+963 721
+963 750
+963 774
+963 780
+963 850
+963 870
+963 883
+963 911
+963 941
+963 992
+964 27
+964 31
+964 166
+964 179
+964 197
+964 208
+964 219
+964 251
+964 296
+964 299
+964 310
+964 325
+964 382
+964 403
+964 427
+964 468
+964 481
+964 496
+964 501
+964 528
+964 583
+964 585
+964 616
+964 646
+964 651
+964 722
+964 728
+964 827
+964 884
+964 898
+964 959
+964 960
+965 58
+965 85
+965 111
+965 162
+965 176
+965 188
+965 230
+965 249
+965 268
+965 332
+965 335
+965 443
+965 565
+965 606
+965 613
+965 624
+965 765
+965 804
+965 828
+965 845
+965 922
+965 937
+965 1009
+966 31
+966 33
+966 68
+966 81
+966 99
+966 153
+966 156
+966 305
+966 329
+966 335
+966 341
+966 364
+966 496
+966 506
+966 512
+966 514
+966 544
+966 568
+966 620
+966 711
+966 735
+966 752
+966 756
+966 786
+966 830
+966 850
+966 866
+966 878
+966 907
+966 940
+966 951
+966 954
+966 979
+966 985
+967 57
+967 67
+967 206
+967 232
+967 304
+967 334
+967 352
+967 419
+967 481
+967 533
+967 554
+967 590
+967 625
+967 634
+967 754
+967 765
+967 775
+967 946
+967 1006
+967 1016
+968 75
+968 94
+968 100
+968 126
+968 139
+968 184
+968 384
+968 444
+968 448
+968 530
+968 569
+968 584
+968 601
+968 619
+968 654
+968 705
+968 739
+968 758
+968 775
+968 796
+968 846
+968 859
+968 869
+968 880
+968 894
+968 973
+968 1006
+968 1011
+969 36
+969 80
+969 87
+969 130
+969 201
+969 216
+969 284
+969 318
+969 370
+969 438
+969 439
+969 442
+969 490
+969 614
+969 684
+969 737
+969 738
+969 801
+969 829
+969 881
+969 882
+969 952
+969 976
+970 54
+970 71
+970 83
+970 90
+970 156
+970 163
+970 241
+970 252
+970 384
+970 406
+970 456
+970 492
+970 493
+970 550
+970 553
+970 595
+970 626
+970 652
+970 668
+970 734
+970 802
+970 838
+970 859
+970 881
+970 906
+970 1005
+971 6
+971 18
+971 45
+971 99
+971 100
+971 115
+971 154
+971 176
+971 188
+971 190
+971 198
+971 201
+971 491
+971 499
+971 530
+971 537
+971 617
+971 621
+971 634
+971 649
+971 673
+971 693
+971 736
+971 784
+971 802
+971 812
+971 911
+972 28
+972 134
+972 164
+972 188
+972 200
+972 223
+972 264
+972 330
+972 362
+972 364
+972 372
+972 411
+972 417
+972 451
+972 459
+972 501
+972 517
+972 552
+972 558
+972 599
+972 630
+972 662
+972 701
+972 721
+972 749
+972 758
+972 772
+972 797
+972 896
+972 931
+972 937
+972 938
+972 946
+972 978
+972 992
+972 1005
+973 53
+973 56
+973 87
+973 139
+973 153
+973 154
+973 162
+973 163
+973 172
+973 189
+973 209
+973 251
+973 257
+973 305
+973 330
+973 363
+973 426
+973 430
+973 440
+973 455
+973 497
+973 499
+973 543
+973 552
+973 641
+973 650
+973 664
+973 705
+973 730
+973 737
+973 739
+973 800
+973 803
+973 871
+973 921
+973 934
+973 948
+973 968
+973 1002
+973 1013
+974 63
+974 132
+974 168
+974 179
+974 266
+974 299
+974 405
+974 424
+974 433
+974 524
+974 528
+974 530
+974 572
+974 578
+974 587
+974 617
+974 638
+974 640
+974 676
+974 677
+974 744
+974 745
+974 775
+974 785
+974 820
+974 917
+975 16
+975 174
+975 212
+975 321
+975 366
+975 376
+975 398
+975 428
+975 433
+975 440
+975 479
+975 510
+975 528
+975 554
+975 600
+975 604
+975 653
+975 696
+975 708
+975 768
+975 795
+975 798
+975 804
+975 992
+975 1006
+976 11
+976 17
+976 23
+976 71
+976 87
+976 97
+976 128
+976 211
+976 231
+976 244
+976 268
+976 324
+976 333
+976 342
+976 375
+976 389
+976 407
+976 419
+976 468
+976 513
+976 550
+976 566
+976 605
+976 631
+976 634
+976 674
+976 686
+976 737
+976 745
+976 747
+976 749
+976 758
+976 759
+976 761
+976 776
+976 778
+976 784
+976 820
+976 824
+976 851
+976 852
+976 859
+976 868
+976 909
+976 961
+976 969
+977 12
+977 89
+977 194
+977 251
+977 370
+977 371
+977 388
+977 391
+977 435
+977 466
+977 536
+977 554
+977 565
+977 592
+977 609
+977 757
+977 765
+977 803
+977 835
+977 881
+977 930
+977 986
+977 996
+978 3
+978 13
+978 15
+978 26
+978 34
+978 35
+978 54
+978 72
+978 216
+978 281
+978 446
+978 456
+978 462
+978 485
+978 586
+978 603
+978 619
+978 664
+978 684
+978 698
+978 749
+978 750
+978 781
+978 793
+978 874
+978 923
+978 972
+978 994
+978 1013
+979 57
+979 124
+979 199
+979 247
+979 249
+979 295
+979 307
+979 314
+979 316
+979 340
+979 373
+979 378
+979 473
+979 496
+979 507
+979 562
+979 600
+979 642
+979 644
+979 666
+979 723
+979 724
+979 729
+979 731
+979 776
+979 794
+979 797
+979 820
+979 837
+979 841
+979 864
+979 908
+979 966
+979 1010
+980 46
+980 59
+980 64
+980 123
+980 135
+980 207
+980 252
+980 259
+980 262
+980 316
+980 345
+980 380
+980 479
+980 522
+980 629
+980 707
+980 760
+980 788
+980 790
+980 799
+980 823
+980 890
+980 908
+980 910
+980 981
+981 60
+981 96
+981 145
+981 161
+981 184
+981 192
+981 274
+981 283
+981 352
+981 442
+981 487
+981 508
+981 574
+981 648
+981 670
+981 681
+981 688
+981 715
+981 753
+981 754
+981 767
+981 808
+981 870
+981 890
+981 902
+981 958
+981 980
+981 986
+981 1004
+981 1015
+982 7
+982 22
+982 29
+982 43
+982 60
+982 70
+982 88
+982 102
+982 130
+982 279
+982 288
+982 293
+982 311
+982 323
+982 333
+982 339
+982 383
+982 390
+982 407
+982 432
+982 452
+982 471
+982 488
+982 493
+982 494
+982 561
+982 575
+982 592
+982 610
+982 614
+982 616
+982 626
+982 660
+982 714
+982 759
+982 829
+982 912
+982 919
+982 983
+983 12
+983 103
+983 111
+983 154
+983 175
+983 207
+983 226
+983 297
+983 310
+983 333
+983 371
+983 471
+983 514
+983 542
+983 574
+983 580
+983 595
+983 602
+983 640
+983 645
+983 683
+983 686
+983 690
+983 698
+983 701
+983 719
+983 747
+983 762
+983 766
+983 768
+983 865
+983 874
+983 945
+983 982
+983 988
+983 1001
+983 1005
+983 1023
+984 5
+984 8
+984 46
+984 61
+984 122
+984 181
+984 191
+984 202
+984 210
+984 312
+984 317
+984 339
+984 352
+984 353
+984 355
+984 401
+984 428
+984 512
+984 557
+984 559
+984 564
+984 618
+984 627
+984 709
+984 829
+984 864
+984 992
+984 1002
+984 1023
+985 9
+985 35
+985 72
+985 92
+985 100
+985 117
+985 125
+985 179
+985 210
+985 233
+985 282
+985 300
+985 369
+985 371
+985 377
+985 400
+985 414
+985 423
+985 514
+985 531
+985 597
+985 609
+985 619
+985 734
+985 784
+985 785
+985 868
+985 934
+985 953
+985 966
+985 1006
+986 15
+986 20
+986 62
+986 90
+986 203
+986 225
+986 235
+986 264
+986 295
+986 300
+986 331
+986 332
+986 335
+986 361
+986 374
+986 427
+986 485
+986 506
+986 519
+986 553
+986 556
+986 630
+986 641
+986 646
+986 656
+986 659
+986 667
+986 691
+986 698
+986 704
+986 712
+986 727
+986 741
+986 754
+986 773
+986 775
+986 786
+986 817
+986 829
+986 863
+986 874
+986 888
+986 933
+986 948
+986 977
+986 981
+986 1010
+986 1016
+987 90
+987 92
+987 104
+987 123
+987 148
+987 250
+987 251
+987 282
+987 296
+987 299
+987 345
+987 397
+987 408
+987 421
+987 445
+987 481
+987 512
+987 516
+987 547
+987 565
+987 593
+987 613
+987 638
+987 682
+987 690
+987 696
+987 841
+987 896
+987 942
+987 1017
+988 119
+988 145
+988 189
+988 191
+988 208
+988 229
+988 240
+988 290
+988 364
+988 464
+988 583
+988 678
+988 787
+988 794
+988 795
+988 917
+988 983
+988 990
+989 41
+989 68
+989 90
+989 110
+989 112
+989 167
+989 216
+989 257
+989 283
+989 338
+989 390
+989 429
+989 473
+989 533
+989 583
+989 602
+989 645
+989 683
+989 689
+989 709
+989 714
+989 718
+989 765
+989 766
+989 771
+989 776
+989 807
+989 820
+989 846
+989 880
+989 882
+989 916
+989 921
+989 954
+989 1013
+990 2
+990 50
+990 64
+990 70
+990 118
+990 205
+990 299
+990 329
+990 355
+990 359
+990 377
+990 456
+990 465
+990 490
+990 499
+990 631
+990 637
+990 639
+990 656
+990 677
+990 679
+990 692
+990 731
+990 756
+990 767
+990 779
+990 885
+990 888
+990 927
+990 988
+990 1006
+990 1017
+991 26
+991 98
+991 105
+991 110
+991 121
+991 184
+991 236
+991 336
+991 349
+991 350
+991 353
+991 416
+991 473
+991 507
+991 527
+991 528
+991 533
+991 550
+991 574
+991 582
+991 602
+991 627
+991 634
+991 663
+991 670
+991 672
+991 675
+991 723
+991 755
+991 889
+991 890
+991 905
+991 950
+992 34
+992 40
+992 105
+992 127
+992 163
+992 232
+992 250
+992 302
+992 323
+992 351
+992 352
+992 377
+992 464
+992 515
+992 604
+992 680
+992 710
+992 723
+992 751
+992 756
+992 833
+992 839
+992 865
+992 867
+992 918
+992 931
+992 941
+992 949
+992 951
+992 963
+992 972
+992 975
+992 984
+992 994
+992 1003
+993 21
+993 107
+993 111
+993 113
+993 120
+993 177
+993 218
+993 240
+993 259
+993 278
+993 389
+993 436
+993 444
+993 451
+993 484
+993 523
+993 532
+993 537
+993 653
+993 696
+993 719
+993 737
+993 745
+993 774
+993 783
+993 797
+993 798
+993 813
+993 819
+993 820
+993 836
+993 839
+993 880
+993 924
+993 1007
+994 25
+994 71
+994 229
+994 231
+994 242
+994 262
+994 267
+994 314
+994 321
+994 330
+994 399
+994 413
+994 471
+994 477
+994 503
+994 517
+994 620
+994 633
+994 727
+994 737
+994 783
+994 829
+994 888
+994 913
+994 948
+994 978
+994 992
+995 2
+995 24
+995 67
+995 72
+995 100
+995 107
+995 120
+995 148
+995 158
+995 165
+995 177
+995 226
+995 298
+995 312
+995 345
+995 377
+995 410
+995 483
+995 539
+995 540
+995 674
+995 684
+995 702
+995 708
+995 762
+995 764
+995 773
+995 819
+995 836
+995 887
+995 950
+996 18
+996 29
+996 39
+996 42
+996 92
+996 124
+996 145
+996 147
+996 167
+996 251
+996 276
+996 295
+996 309
+996 326
+996 333
+996 432
+996 444
+996 483
+996 539
+996 555
+996 561
+996 564
+996 585
+996 653
+996 671
+996 673
+996 743
+996 798
+996 823
+996 826
+996 850
+996 864
+996 946
+996 977
+997 35
+997 41
+997 45
+997 56
+997 97
+997 98
+997 122
+997 155
+997 204
+997 206
+997 301
+997 319
+997 336
+997 363
+997 428
+997 444
+997 632
+997 715
+997 731
+997 805
+997 809
+997 814
+997 840
+997 871
+997 929
+998 7
+998 20
+998 58
+998 91
+998 92
+998 208
+998 215
+998 221
+998 231
+998 247
+998 301
+998 318
+998 363
+998 377
+998 389
+998 412
+998 573
+998 603
+998 618
+998 622
+998 631
+998 649
+998 665
+998 668
+998 804
+998 810
+998 856
+998 905
+998 926
+998 934
+998 947
+998 955
+998 1015
+999 64
+999 92
+999 98
+999 174
+999 214
+999 244
+999 289
+999 293
+999 299
+999 316
+999 541
+999 630
+999 706
+999 732
+999 748
+999 755
+999 791
+999 797
+999 802
+999 816
+999 915
+999 922
+999 949
+1000 40
+1000 157
+1000 190
+1000 197
+1000 200
+1000 250
+1000 276
+1000 318
+1000 355
+1000 420
+1000 439
+1000 456
+1000 466
+1000 564
+1000 569
+1000 594
+1000 635
+1000 656
+1000 730
+1000 740
+1000 810
+1000 821
+1000 911
+1000 923
+1000 940
+1000 1010
+1001 92
+1001 129
+1001 148
+1001 176
+1001 225
+1001 226
+1001 246
+1001 276
+1001 286
+1001 294
+1001 295
+1001 296
+1001 402
+1001 406
+1001 446
+1001 483
+1001 496
+1001 513
+1001 515
+1001 611
+1001 693
+1001 736
+1001 783
+1001 803
+1001 841
+1001 855
+1001 929
+1001 936
+1001 939
+1001 960
+1001 983
+1002 22
+1002 69
+1002 77
+1002 121
+1002 139
+1002 141
+1002 142
+1002 187
+1002 198
+1002 212
+1002 219
+1002 221
+1002 236
+1002 298
+1002 312
+1002 313
+1002 329
+1002 333
+1002 337
+1002 427
+1002 484
+1002 489
+1002 501
+1002 503
+1002 505
+1002 552
+1002 568
+1002 600
+1002 639
+1002 708
+1002 736
+1002 798
+1002 801
+1002 808
+1002 828
+1002 831
+1002 866
+1002 868
+1002 920
+1002 933
+1002 973
+1002 984
+1002 1005
+1002 1016
+1003 0
+1003 30
+1003 41
+1003 144
+1003 193
+1003 271
+1003 275
+1003 278
+1003 307
+1003 320
+1003 379
+1003 443
+1003 467
+1003 501
+1003 566
+1003 634
+1003 638
+1003 645
+1003 680
+1003 689
+1003 692
+1003 992
+1004 1
+1004 17
+1004 80
+1004 135
+1004 198
+1004 238
+1004 263
+1004 300
+1004 360
+1004 399
+1004 459
+1004 510
+1004 546
+1004 558
+1004 574
+1004 588
+1004 689
+1004 691
+1004 736
+1004 739
+1004 765
+1004 788
+1004 936
+1004 981
+1005 8
+1005 26
+1005 54
+1005 68
+1005 125
+1005 174
+1005 210
+1005 271
+1005 283
+1005 297
+1005 300
+1005 377
+1005 388
+1005 405
+1005 440
+1005 480
+1005 559
+1005 590
+1005 595
+1005 678
+1005 724
+1005 725
+1005 746
+1005 829
+1005 842
+1005 868
+1005 869
+1005 896
+1005 929
+1005 970
+1005 972
+1005 983
+1005 1002
+1006 43
+1006 51
+1006 85
+1006 141
+1006 172
+1006 181
+1006 194
+1006 208
+1006 251
+1006 297
+1006 303
+1006 363
+1006 388
+1006 407
+1006 455
+1006 471
+1006 472
+1006 480
+1006 495
+1006 522
+1006 545
+1006 577
+1006 591
+1006 613
+1006 660
+1006 718
+1006 720
+1006 764
+1006 784
+1006 789
+1006 894
+1006 967
+1006 968
+1006 975
+1006 985
+1006 990
+1006 1020
+1007 25
+1007 58
+1007 98
+1007 100
+1007 125
+1007 147
+1007 159
+1007 186
+1007 218
+1007 228
+1007 232
+1007 246
+1007 348
+1007 417
+1007 456
+1007 468
+1007 499
+1007 634
+1007 653
+1007 660
+1007 678
+1007 738
+1007 758
+1007 802
+1007 806
+1007 823
+1007 843
+1007 883
+1007 993
+1007 1012
+1008 13
+1008 36
+1008 55
+1008 75
+1008 97
+1008 141
+1008 167
+1008 170
+1008 185
+1008 190
+1008 213
+1008 292
+1008 306
+1008 402
+1008 416
+1008 490
+1008 511
+1008 558
+1008 568
+1008 587
+1008 698
+1008 729
+1008 774
+1008 781
+1008 858
+1008 898
+1008 905
+1009 13
+1009 46
+1009 68
+1009 106
+1009 138
+1009 182
+1009 193
+1009 196
+1009 213
+1009 225
+1009 241
+1009 260
+1009 282
+1009 284
+1009 330
+1009 332
+1009 424
+1009 499
+1009 507
+1009 575
+1009 588
+1009 609
+1009 661
+1009 681
+1009 709
+1009 728
+1009 734
+1009 745
+1009 765
+1009 803
+1009 810
+1009 812
+1009 888
+1009 965
+1009 1018
+1010 1
+1010 10
+1010 39
+1010 61
+1010 79
+1010 128
+1010 167
+1010 203
+1010 230
+1010 289
+1010 299
+1010 312
+1010 387
+1010 410
+1010 435
+1010 456
+1010 473
+1010 476
+1010 488
+1010 489
+1010 494
+1010 507
+1010 527
+1010 546
+1010 607
+1010 610
+1010 615
+1010 664
+1010 690
+1010 749
+1010 807
+1010 832
+1010 854
+1010 859
+1010 870
+1010 882
+1010 894
+1010 952
+1010 979
+1010 986
+1010 1000
+1010 1022
+1011 118
+1011 174
+1011 229
+1011 245
+1011 353
+1011 380
+1011 438
+1011 439
+1011 504
+1011 650
+1011 688
+1011 785
+1011 817
+1011 824
+1011 831
+1011 835
+1011 886
+1011 920
+1011 958
+1011 968
+1012 6
+1012 44
+1012 50
+1012 60
+1012 83
+1012 100
+1012 174
+1012 195
+1012 198
+1012 223
+1012 229
+1012 247
+1012 249
+1012 263
+1012 289
+1012 291
+1012 388
+1012 398
+1012 420
+1012 480
+1012 483
+1012 490
+1012 579
+1012 636
+1012 684
+1012 694
+1012 794
+1012 853
+1012 1007
+1013 35
+1013 40
+1013 41
+1013 42
+1013 71
+1013 90
+1013 156
+1013 167
+1013 224
+1013 228
+1013 229
+1013 292
+1013 314
+1013 347
+1013 356
+1013 357
+1013 361
+1013 366
+1013 439
+1013 453
+1013 460
+1013 461
+1013 481
+1013 488
+1013 491
+1013 492
+1013 497
+1013 524
+1013 548
+1013 570
+1013 622
+1013 680
+1013 684
+1013 780
+1013 796
+1013 837
+1013 866
+1013 883
+1013 893
+1013 973
+1013 978
+1013 989
+1014 2
+1014 35
+1014 51
+1014 56
+1014 59
+1014 91
+1014 148
+1014 164
+1014 165
+1014 168
+1014 173
+1014 270
+1014 339
+1014 358
+1014 393
+1014 498
+1014 509
+1014 552
+1014 594
+1014 603
+1014 626
+1014 638
+1014 674
+1014 682
+1014 744
+1014 764
+1014 773
+1014 791
+1014 836
+1014 962
+1015 10
+1015 51
+1015 60
+1015 72
+1015 113
+1015 143
+1015 160
+1015 183
+1015 242
+1015 246
+1015 255
+1015 273
+1015 277
+1015 325
+1015 332
+1015 390
+1015 402
+1015 420
+1015 442
+1015 512
+1015 535
+1015 537
+1015 620
+1015 664
+1015 678
+1015 712
+1015 727
+1015 761
+1015 774
+1015 801
+1015 810
+1015 813
+1015 821
+1015 845
+1015 850
+1015 854
+1015 862
+1015 882
+1015 884
+1015 891
+1015 904
+1015 932
+1015 959
+1015 981
+1015 998
+1016 130
+1016 202
+1016 209
+1016 247
+1016 309
+1016 353
+1016 382
+1016 458
+1016 465
+1016 473
+1016 474
+1016 500
+1016 531
+1016 566
+1016 585
+1016 632
+1016 641
+1016 646
+1016 697
+1016 716
+1016 723
+1016 745
+1016 754
+1016 762
+1016 770
+1016 775
+1016 783
+1016 791
+1016 859
+1016 861
+1016 927
+1016 952
+1016 953
+1016 956
+1016 967
+1016 986
+1016 1002
+1017 12
+1017 23
+1017 25
+1017 59
+1017 61
+1017 120
+1017 121
+1017 139
+1017 219
+1017 223
+1017 282
+1017 309
+1017 331
+1017 351
+1017 385
+1017 411
+1017 430
+1017 462
+1017 472
+1017 562
+1017 587
+1017 605
+1017 636
+1017 647
+1017 666
+1017 678
+1017 720
+1017 723
+1017 785
+1017 858
+1017 864
+1017 869
+1017 987
+1017 990
+1018 21
+1018 53
+1018 59
+1018 83
+1018 94
+1018 98
+1018 173
+1018 200
+1018 209
+1018 217
+1018 284
+1018 310
+1018 369
+1018 444
+1018 446
+1018 454
+1018 458
+1018 528
+1018 542
+1018 581
+1018 590
+1018 606
+1018 712
+1018 770
+1018 802
+1018 852
+1018 866
+1018 931
+1018 1009
+1019 29
+1019 52
+1019 54
+1019 79
+1019 107
+1019 131
+1019 180
+1019 227
+1019 230
+1019 303
+1019 369
+1019 402
+1019 413
+1019 447
+1019 490
+1019 504
+1019 571
+1019 605
+1019 717
+1019 719
+1019 740
+1019 750
+1019 773
+1019 782
+1019 815
+1019 827
+1019 909
+1019 944
+1019 956
+1020 8
+1020 33
+1020 43
+1020 71
+1020 85
+1020 147
+1020 174
+1020 194
+1020 231
+1020 298
+1020 326
+1020 331
+1020 351
+1020 384
+1020 390
+1020 405
+1020 433
+1020 440
+1020 441
+1020 482
+1020 511
+1020 541
+1020 634
+1020 676
+1020 677
+1020 764
+1020 806
+1020 829
+1020 846
+1020 856
+1020 871
+1020 909
+1020 914
+1020 925
+1020 1006
+1020 1023
+1021 89
+1021 114
+1021 116
+1021 138
+1021 177
+1021 186
+1021 192
+1021 227
+1021 231
+1021 303
+1021 351
+1021 390
+1021 391
+1021 449
+1021 464
+1021 494
+1021 496
+1021 521
+1021 542
+1021 549
+1021 606
+1021 628
+1021 639
+1021 678
+1021 689
+1021 722
+1021 728
+1021 763
+1021 794
+1021 805
+1021 862
+1021 873
+1021 899
+1021 946
+1021 962
+1022 24
+1022 55
+1022 79
+1022 85
+1022 121
+1022 134
+1022 171
+1022 200
+1022 233
+1022 248
+1022 256
+1022 259
+1022 315
+1022 368
+1022 395
+1022 425
+1022 464
+1022 466
+1022 468
+1022 490
+1022 556
+1022 609
+1022 658
+1022 662
+1022 676
+1022 687
+1022 690
+1022 723
+1022 727
+1022 816
+1022 886
+1022 910
+1022 913
+1022 1010
+1023 11
+1023 47
+1023 59
+1023 66
+1023 122
+1023 146
+1023 173
+1023 222
+1023 237
+1023 246
+1023 288
+1023 306
+1023 316
+1023 319
+1023 323
+1023 360
+1023 396
+1023 399
+1023 413
+1023 416
+1023 468
+1023 514
+1023 521
+1023 557
+1023 563
+1023 586
+1023 604
+1023 605
+1023 606
+1023 621
+1023 714
+1023 757
+1023 768
+1023 771
+1023 781
+1023 824
+1023 827
+1023 865
+1023 918
+1023 983
+1023 984
+1023 1020
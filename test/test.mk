@@ -7,7 +7,10 @@
 #-----------------------------------------------------------------------#
 
 # Dependencies are the tests it will run
-test-all: test-build test-generate test-load test-verify
+test-all: test-build test-generate test-load test-serialize test-stream \
+          test-verify test-compressed test-intersect test-reorder \
+          test-report test-counters test-server test-epoch test-id64 \
+          test-pr-warm test-bc-batch test-split test-suite test-scaling
 
 # Does everthing, intended target for users
 test: test-score
@@ -66,6 +69,244 @@ test-load-%: test/out/load-%.out
 	fi
 
 
+# Serialized graphs written by converter, then read back in or memory-mapped
+SERIALIZE_GRAPHS = 4.el g10
+test-serialize: $(addprefix test-serialize-read-, $(SERIALIZE_GRAPHS)) \
+                $(addprefix test-serialize-map-, $(SERIALIZE_GRAPHS)) \
+                test-serialize-v1
+
+test/out/g10.sg: test/out converter
+	./converter -g10 -b $@
+
+test/out/%.sg: test/out converter
+	./converter -f test/graphs/$* -b $@
+
+test/out/serialize-read-%.out: test/out/%.sg $(GENERATE_KERNEL)
+	./$(GENERATE_KERNEL) -f $< -n0 > $@
+
+test/out/serialize-map-%.out: test/out/%.sg $(GENERATE_KERNEL)
+	./$(GENERATE_KERNEL) -f $< -M -n0 > $@
+
+.SECONDARY:
+test-serialize-read-%: test/out/serialize-read-%.out
+	@if grep -q "`cat test/reference/graph-$*.out`" $<; \
+		then echo " $(PASS) Serialize & Read $*"; \
+		else echo " $(FAIL) Serialize & Read $*"; \
+	fi
+
+test-serialize-map-%: test/out/serialize-map-%.out
+	@if grep -q "`cat test/reference/graph-$*.out`" $< && \
+			grep -q "Map Time" $<; \
+		then echo " $(PASS) Serialize & Map $*"; \
+		else echo " $(FAIL) Serialize & Map $*"; \
+	fi
+
+# The first version 1 headers left neighbor sizes (and ID widths) as zeros
+test/out/g10-v1.sg: test/out/g10.sg
+	cp $< $@
+	printf '\001' | dd of=$@ bs=1 seek=4 conv=notrunc 2> /dev/null
+	dd if=/dev/zero of=$@ bs=1 seek=10 count=6 conv=notrunc 2> /dev/null
+	dd if=/dev/zero of=$@ bs=1 seek=32 count=16 conv=notrunc 2> /dev/null
+
+test/out/serialize-v1-g10.out: test/out/g10-v1.sg $(GENERATE_KERNEL)
+	./$(GENERATE_KERNEL) -f $< -n0 > $@
+
+test-serialize-v1: test/out/serialize-v1-g10.out
+	@if grep -q "`cat test/reference/graph-g10.out`" $<; \
+		then echo " $(PASS) Serialize & Read version 1"; \
+		else echo " $(FAIL) Serialize & Read version 1"; \
+	fi
+
+# Out-of-core conversion (-o) should write same file as in-memory conversion
+STREAM_GRAPHS = 4.el 4.mtx 4.gr g10
+test-stream: $(addprefix test-stream-, $(STREAM_GRAPHS)) test-stream-sym-4.el \
+             test-stream-fast-g10
+
+test/out/stream-g10.sg: test/out converter
+	./converter -g10 -o -b $@ > /dev/null
+
+test/out/stream-%.sg: test/out converter
+	./converter -f test/graphs/$* -o -b $@ > /dev/null
+
+test/out/sym-%.sg: test/out converter
+	./converter -f test/graphs/$* -s -b $@ > /dev/null
+
+test/out/stream-sym-%.sg: test/out converter
+	./converter -f test/graphs/$* -s -o -b $@ > /dev/null
+
+.SECONDARY:
+test-stream-%: test/out/stream-%.sg test/out/%.sg
+	@if cmp -s $^; \
+		then echo " $(PASS) Out-of-core Convert $*"; \
+		else echo " $(FAIL) Out-of-core Convert $*"; \
+	fi
+
+# Fast generator (-q) streams its edges straight into the graph
+test/out/stream-fast-g10.out: test/out bfs
+	./bfs -g10 -q -vn1 > $@
+
+test-stream-fast-g10: test/out/stream-fast-g10.out
+	@if grep -q "Generate & Build Time" $< && \
+			grep -q "Verification: *PASS" $<; \
+		then echo " $(PASS) Fast Generate & Build g10"; \
+		else echo " $(FAIL) Fast Generate & Build g10"; \
+	fi
+
+
+# Converter writes relabeled graphs (-O) that still report original IDs
+VERTEX_ORDERS = degree hubsort hubcluster rcm gorder
+test-reorder: $(addprefix test-reorder-, $(VERTEX_ORDERS))
+
+test/out/reorder-%.sg: test/out converter
+	./converter -g10 -O $* -b $@ > /dev/null
+
+test/out/reorder-%.out: test/out/reorder-%.sg pr_spmv
+	./pr_spmv -f $< -M -n1 -a | grep "^[0-9]*:" | cut -d: -f1 > $@
+
+test/out/top-scores-g10.out: test/out pr_spmv
+	./pr_spmv -g10 -n1 -a | grep "^[0-9]*:" | cut -d: -f1 > $@
+
+.SECONDARY:
+test-reorder-%: test/out/reorder-%.out test/out/top-scores-g10.out
+	@if cmp -s $^; \
+		then echo " $(PASS) Reorder $*"; \
+		else echo " $(FAIL) Reorder $*"; \
+	fi
+
+
+# Machine-readable results (-j) have a record for every trial
+REPORT_FORMATS = json csv
+test-report: $(addprefix test-report-, $(REPORT_FORMATS))
+
+test/out/report-g10.%: test/out bfs
+	./bfs -g10 -n2 -l -j $@ > /dev/null
+
+.SECONDARY:
+test-report-json: test/out/report-g10.json
+	@if [ `grep -c '"type": "trial", "kernel": "bfs"' $<` -eq 2 ]; \
+		then echo " $(PASS) Report json"; \
+		else echo " $(FAIL) Report json"; \
+	fi
+
+.SECONDARY:
+test-report-csv: test/out/report-g10.csv
+	@if [ `grep -c '^bfs,[0-9]*,trial,[01],seconds,' $<` -eq 2 ]; \
+		then echo " $(PASS) Report csv"; \
+		else echo " $(FAIL) Report csv"; \
+	fi
+
+
+# Counters (-p) print a row per region after each trial, if available
+test/out/counters-g10.out: test/out bfs
+	./bfs -g10 -n1 -p > $@
+
+.SECONDARY:
+test-counters: test/out/counters-g10.out
+	@if grep -q "^trial \|No performance counters" $<; \
+		then echo " $(PASS) Counters"; \
+		else echo " $(FAIL) Counters"; \
+	fi
+
+
+# Server runs (and verifies) a request per kernel on one loaded graph
+test/out/server-g10.out: test/out server
+	printf '$(foreach k, $(SERVER_KERNELS),$(k) -v\n)quit\n' | ./server -g10 > $@
+
+.SECONDARY:
+test-server: test/out/server-g10.out test-server-update test-server-compact
+	@if [ `grep -c "Verification: *PASS" $<` -eq $(words $(SERVER_KERNELS)) ]; \
+		then echo " $(PASS) Server"; \
+		else echo " $(FAIL) Server"; \
+	fi
+
+# Kernels verify on the updated graph, and reinserting gives original back
+UPDATE_KERNELS = bfs cc pr
+test/out/g10-updates.el: test/out converter
+	./converter -g10 -e test/out/g10.el > /dev/null
+	head -n 300 test/out/g10.el > $@
+
+test/out/server-update-g10.out: test/out/g10-updates.el server
+	printf 'tc -a\ndelete $<\n$(foreach k, $(UPDATE_KERNELS),$(k) -v\n)' > $@.in
+	printf 'insert $<\ntc -a\n' >> $@.in
+	./server -g10 < $@.in > $@
+
+test-server-update: test/out/server-update-g10.out
+	@if [ `grep -c "Verification: *PASS" $<` -eq $(words $(UPDATE_KERNELS)) ] && \
+			[ `grep "triangles" $< | wc -l` -eq 2 ] && \
+			[ `grep "triangles" $< | uniq | wc -l` -eq 1 ] && \
+			grep -q "Updates hold [1-9]" $<; \
+		then echo " $(PASS) Server Updates"; \
+		else echo " $(FAIL) Server Updates"; \
+	fi
+
+# Updates to a relabeled graph use input IDs (an edge joining two isolated
+# vertices of g10 makes a 2-vertex BFS tree), and compacting them keeps its
+# original IDs, so a fixed source (-r) is the same vertex before and after
+test/out/u10-updates.el: test/out converter
+	./converter -u10 -e test/out/u10.el > /dev/null
+	head -n 3000 test/out/u10.el > $@
+
+test/out/server-compact-g10.out: test/out/u10-updates.el server
+	printf '14 23\n' > test/out/isolated-pair.el
+	printf 'insert test/out/isolated-pair.el\nbfs -r 14 -a\n' > $@.in
+	printf 'bfs -r 7 -l -v\ninsert $<\nbfs -r 7 -l -v\n' >> $@.in
+	./server -g10 -O degree < $@.in > $@
+
+test-server-compact: test/out/server-compact-g10.out
+	@if grep -q "BFS Tree has 2 nodes" $< && \
+			[ `grep -c "Verification: *PASS" $<` -eq 2 ] && \
+			[ `grep "Source" $< | wc -l` -eq 2 ] && \
+			[ `grep "Source" $< | uniq | wc -l` -eq 1 ] && \
+			grep -q "Updates hold 0" $<; \
+		then echo " $(PASS) Server Compact"; \
+		else echo " $(FAIL) Server Compact"; \
+	fi
+
+# Suite runner (gapbs) runs a plan of kernels with their own trial counts, on
+# variants of the graph read from files
+test/out/g10.wsg: test/out converter
+	./converter -g10 -wb $@ > /dev/null
+
+test/out/suite-g10.out: test/out/g10.sg test/out/g10.wsg gapbs
+	printf '$(foreach k, $(SERVER_KERNELS),$(k) -n2 -v\n)' > $@.in
+	./gapbs -g10 -w test/out/g10.wsg -U test/out/g10.sg -P $@.in > $@
+
+test-suite: test/out/suite-g10.out
+	@if [ `grep -c "Verification: *PASS" $<` -eq \
+			$$((2 * $(words $(SERVER_KERNELS)))) ] && grep -q "Suite Time" $<; \
+		then echo " $(PASS) Suite Runner"; \
+		else echo " $(FAIL) Suite Runner"; \
+	fi
+
+# Scaling sweep (-T) verifies warmups & trials at each thread count, which
+# all run the same sources
+test/out/scaling-g10.out: test/out bfs
+	./bfs -g10 -T 1,2 -I1 -n3 -v -l > $@
+
+test-scaling: test/out/scaling-g10.out
+	@if [ `grep -c "Verification: *PASS" $<` -eq 8 ] && \
+			[ `grep -c "Median Time" $<` -eq 2 ] && \
+			[ `grep -c "Source" $<` -eq 8 ] && \
+			[ "`grep Source $< | head -n 4`" = "`grep Source $< | tail -n 4`" ]; \
+		then echo " $(PASS) Scaling Sweep"; \
+		else echo " $(FAIL) Scaling Sweep"; \
+	fi
+
+# PageRank started from saved scores (-y), and propagating changes (-e)
+test/out/pr-scores-g10.txt: test/out pr
+	./pr -g10 -n1 -z $@ > /dev/null
+
+test/out/pr-warm-g10.out: test/out/pr-scores-g10.txt pr
+	./pr -g10 -n1 -v -y $< > $@
+	./pr -g10 -n1 -v -e >> $@
+	./pr -g10 -n1 -v -e -y $< >> $@
+
+test-pr-warm: test/out/pr-warm-g10.out
+	@if [ `grep -c "Verification: *PASS" $<` -eq 3 ]; \
+		then echo " $(PASS) PageRank Warm Start"; \
+		else echo " $(FAIL) PageRank Warm Start"; \
+	fi
+
 
 # Kernel Output Verification -------------------------------------------#
 #-----------------------------------------------------------------------#
@@ -84,3 +325,121 @@ test-verify-%-$(TEST_GRAPH): test/out/verify-%-$(TEST_GRAPH).out
 	fi
 
 test-verify: $(addsuffix -$(TEST_GRAPH), $(addprefix test-verify-, $(KERNELS)))
+
+# Kernels that support compressed graphs (.csg) verified on one from converter
+COMPRESSED_KERNELS = bfs cc pr
+
+test/out/$(TEST_GRAPH).csg: test/out converter
+	./converter -$(TEST_GRAPH) -c $@
+
+test/out/compressed-%-$(TEST_GRAPH).out: test/out/$(TEST_GRAPH).csg %
+	./$* -f $< -vn1 > $@
+
+.SECONDARY:
+test-compressed-%-$(TEST_GRAPH): test/out/compressed-%-$(TEST_GRAPH).out
+	@if grep -q "Verification:           PASS" $<; \
+		then echo " $(PASS) Verify compressed $*"; \
+		else echo " $(FAIL) Verify compressed $*"; \
+	fi
+
+test-compressed: $(addsuffix -$(TEST_GRAPH), \
+                   $(addprefix test-compressed-, $(COMPRESSED_KERNELS)))
+
+# Each set intersection method for tc (unsupported ones fall back to merge)
+INTERSECT_METHODS = merge gallop sse avx2 avx512
+
+test/out/intersect-%-$(TEST_GRAPH).out: test/out tc
+	./tc -$(TEST_GRAPH) -x $* -vn1 > $@
+
+.SECONDARY:
+test-intersect-%-$(TEST_GRAPH): test/out/intersect-%-$(TEST_GRAPH).out
+	@if grep -q "Verification:           PASS" $<; \
+		then echo " $(PASS) Verify tc intersect $*"; \
+		else echo " $(FAIL) Verify tc intersect $*"; \
+	fi
+
+test-intersect: $(addsuffix -$(TEST_GRAPH), \
+                  $(addprefix test-intersect-, $(INTERSECT_METHODS)))
+
+# Kernels with epoch-tagged state (-E), over several trials to reuse it
+EPOCH_KERNELS = bc bfs
+
+test/out/epoch-%-$(TEST_GRAPH).out: test/out %
+	./$* -$(TEST_GRAPH) -E -vn4 > $@
+
+.SECONDARY:
+test-epoch-%-$(TEST_GRAPH): test/out/epoch-%-$(TEST_GRAPH).out
+	@if [ `grep -c "Verification:           PASS" $<` -eq 4 ]; \
+		then echo " $(PASS) Verify epoch-tagged $*"; \
+		else echo " $(FAIL) Verify epoch-tagged $*"; \
+	fi
+
+test-epoch: $(addsuffix -$(TEST_GRAPH), \
+              $(addprefix test-epoch-, $(EPOCH_KERNELS)))
+
+# Batched bc, with a partial last batch & several trials to reuse its state
+test/out/bc-batch-$(TEST_GRAPH).out: test/out bc
+	./bc -$(TEST_GRAPH) -b8 -i20 -vn3 > $@
+
+test-bc-batch: test/out/bc-batch-$(TEST_GRAPH).out
+	@if [ `grep -c "Verification:           PASS" $<` -eq 3 ]; \
+		then echo " $(PASS) Verify batched bc"; \
+		else echo " $(FAIL) Verify batched bc"; \
+	fi
+
+# Weights kept apart from neighbors (-W), built or read (& mapped) from .swsg
+SPLIT_BITS = 8 16
+
+test/out/split-%-$(TEST_GRAPH).out: test/out sssp
+	./sssp -$(TEST_GRAPH) -W$* -vn1 > $@
+
+test/out/$(TEST_GRAPH).swsg: test/out converter
+	./converter -$(TEST_GRAPH) -W8 -wb $@ > /dev/null
+
+test/out/split-map-%-$(TEST_GRAPH).out: test/out/$(TEST_GRAPH).swsg %
+	./$* -f $< -M -vn1 > $@
+
+.SECONDARY:
+test-split-%-$(TEST_GRAPH): test/out/split-%-$(TEST_GRAPH).out
+	@if grep -q "Verification:           PASS" $<; \
+		then echo " $(PASS) Verify split weights $*"; \
+		else echo " $(FAIL) Verify split weights $*"; \
+	fi
+
+test-split: $(addsuffix -$(TEST_GRAPH), \
+              $(addprefix test-split-, $(SPLIT_BITS) map-sssp map-bfs))
+
+
+# 64-bit ID builds read 32-bit serialized graphs and vice versa
+test-id64: test-id64-read-g10 test-id64-write-g10 test-id64-verify
+
+test/out/g10-64.sg: test/out converter64
+	./converter64 -g10 -b $@ > /dev/null
+
+test/out/id64-read-%.out: test/out/%.sg bfs64
+	./bfs64 -f $< -n0 > $@
+
+test/out/id64-write-%.out: test/out/%-64.sg $(GENERATE_KERNEL)
+	./$(GENERATE_KERNEL) -f $< -n0 > $@
+
+test/out/id64-verify.out: test/out bfs64
+	./bfs64 -g10 -vn2 > $@
+
+.SECONDARY:
+test-id64-read-%: test/out/id64-read-%.out
+	@if grep -q "`cat test/reference/graph-$*.out`" $<; \
+		then echo " $(PASS) 64-bit IDs Read $*"; \
+		else echo " $(FAIL) 64-bit IDs Read $*"; \
+	fi
+
+test-id64-write-%: test/out/id64-write-%.out
+	@if grep -q "`cat test/reference/graph-$*.out`" $<; \
+		then echo " $(PASS) 64-bit IDs Write $*"; \
+		else echo " $(FAIL) 64-bit IDs Write $*"; \
+	fi
+
+test-id64-verify: test/out/id64-verify.out
+	@if [ "`grep -c PASS $<`" = "2" ]; \
+		then echo " $(PASS) 64-bit IDs Verify"; \
+		else echo " $(FAIL) 64-bit IDs Verify"; \
+	fi